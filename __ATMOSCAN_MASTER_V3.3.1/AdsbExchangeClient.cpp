@@ -23,93 +23,69 @@
   See more at http://blog.squix.ch
 */
 
+#include <algorithm>
 #include "AdsbExchangeClient.h"
 #include <ESP8266WiFi.h>
 #include <WiFiClient.h>
 
-// Extern variables
-extern WiFiClient wifiClient;
-
 // Prototypes
 void errLog(String msg);
 
-AdsbExchangeClient::AdsbExchangeClient() {}
-
-void AdsbExchangeClient::updateVisibleAircraft(String searchQuery)
+// Copies into a fixed capacity field, truncating
+static void copyField(char *field, size_t size, const char *value)
 {
-  JsonStreamingParser parser;
-  parser.setListener(this);
+  strncpy(field, value, size - 1);
+  field[size - 1] = '\0';
+}
 
-  // http://public-api.adsbexchange.com/VirtualRadar/AircraftList.json?lat=47.437691&lng=8.568854&fDstL=0&fDstU=20&fAltL=0&fAltU=5000
+AdsbExchangeClient::AdsbExchangeClient()
+{
+  hostName = F("global.adsbexchange.com");
 
-  const char host[]  = "global.adsbexchange.com";
+  // Called by the screen: the user must not wait for the download
+  abortOnUserEvent = true;
+}
 
-  const int httpPort = 80;
-  if (!wifiClient.connect(host, httpPort))
-  {
-    errLog(F("Can't connect to adsbexchange.com"));
-    return;
-  }
+void AdsbExchangeClient::setSearchQuery(const String &searchQuery)
+{
+  requestPath = F("/VirtualRadar/AircraftList.json?");
+  requestPath += searchQuery;
+}
 
-  // Get Aircrafts list
-  wifiClient.print(F("GET "));
-  wifiClient.print(F("/VirtualRadar/AircraftList.json?"));
-  wifiClient.print(searchQuery);
-  wifiClient.print(F(" HTTP/1.1\r\nHost: "));
-  wifiClient.print(host);
-  wifiClient.print(F("\r\nConnection: close\r\n\r\n"));
+void AdsbExchangeClient::updateVisibleAircraft()
+{
+  JsonTokenizer parser(this);
 
-  int retryCounter = 0;
-  while (!wifiClient.available())
-  {
-    delay(1000);
-    retryCounter++;
-    if (retryCounter > 10)
-    {
-      errLog(F("ADSBexchange - no data available"));
-      return;
-    }
-  }
+  // Nothing left over from the previous refresh, should this one fail
+  counter = 0;
 
-  int pos = 0;
-  bool isBody = false;
-  char c;
+  // http://public-api.adsbexchange.com/VirtualRadar/AircraftList.json?lat=47.437691&lng=8.568854&fDstL=0&fDstU=20&fAltL=0&fAltU=5000
 
-  int size = 0;
-  wifiClient.setNoDelay(false);
-  while (wifiClient.connected())
+  if (!httpConnect())
   {
-    while ((size = wifiClient.available()) > 0)
-    {
-      c = wifiClient.read();
-      if (c == '{' || c == '[')
-      {
-        isBody = true;
-      }
-      if (isBody) {
-        parser.parse(c);
-      }
-    }
+    errLog(F("Can't connect to adsbexchange.com"));
+    return;
   }
-  endDocument();
-}
 
+  // Get Aircrafts list, bounded in time (timeouts are logged, user events just abort)
+  if (httpGet(requestPath) && skipResponseHeaders())
+    readBody(parser);
 
-void AdsbExchangeClient::whitespace(char c)
-{
-
+  disconnect();
 }
 
+
 void AdsbExchangeClient::startDocument() {
   counter = 0;
   index = -1;
+  lastSightingMillis = millis();
 }
 
-void AdsbExchangeClient::key(String key) {
-  currentKey = key;
+void AdsbExchangeClient::key(uint32_t keyId, const char *, uint16_t) {
+  currentKey = keyId;
 }
 
-void AdsbExchangeClient::value(String value) {
+void AdsbExchangeClient::value(char *value, uint16_t length) {
   /*String from = "";
     String to = "";
     String altitude = "";
@@ -133,107 +109,140 @@ void AdsbExchangeClient::value(String value) {
     //-#ifdef DEBUG_SERIAL Serial.println(F("Max Aircrafts reached...."));
     return;
   }
-  if (currentKey == F("Id"))
+
+  // Nothing else before the first aircraft
+  if (index < 0 && currentKey != jsonKey("Id"))
+    return;
+
+  switch (currentKey)
   {
-    counter++;
-    index = counter - 1;
-    aircrafts[index] = {};
-    histories[index] = {};
+    case jsonKey("Id"):
+    {
+      counter++;
+      index = counter - 1;
+      aircrafts[index] = {};
+      histories[index].counter = 0;
+      trailIndex = 0;
+      break;
+    }
 
-    trailIndex = 0;
-    for (int i = 0; i < MAX_HISTORY_TEMP; i++)
+    case jsonKey("From"):
+    case jsonKey("To"):
     {
-      positionTemp[i] = {};
+      // "LSZH Zurich, Zurich, Switzerland": the city, after the airport code
+      char *comma = strchr(value, ',');
+      if (comma)
+        *comma = '\0';
+      char *place = currentKey == jsonKey("From") ? aircrafts[index].fromShort : aircrafts[index].toShort;
+      copyField(place, AIRCRAFT_PLACE_SIZE, length > 4 ? value + 4 : "");
+      break;
     }
 
-  } else if (currentKey == F("From")) {
-    // aircrafts[index].from = value;
-    // aircrafts[index].fromCode = value.substring(0, 4);
-    int indexOfFirstComma = value.indexOf(F(","));
-    aircrafts[index].fromShort = value.substring(4, indexOfFirstComma);
-  } else if (currentKey == F("To")) {
-    // aircrafts[index].to = value;
-    // aircrafts[index].toCode = value.substring(0, 4);
-    int indexOfFirstComma = value.indexOf(F(","));
-    aircrafts[index].toShort = value.substring(4, indexOfFirstComma);
-  } else if (currentKey == F("OpIcao")) {
-    // aircrafts[index].operatorCode = value;
-  } else if (currentKey == F("Dst")) {
-    aircrafts[index].distance = value.toFloat();
-  } else if (currentKey == F("Mdl")) {
-    aircrafts[index].aircraftType = value;
-  } else if (currentKey == F("Trak")) {
-    aircrafts[index].heading = value.toFloat();
-  } else if (currentKey == F("Alt")) {
-    aircrafts[index].altitude = value.toInt();;
-  } else if (currentKey == F("Lat")) {
-    aircrafts[index].lat = value.toFloat();
-  } else if (currentKey == F("Long")) {
-    aircrafts[index].lon = value.toFloat();
-  } else if (currentKey == F("Spd")) {
-    aircrafts[index].speed = value.toFloat();
-  } else if (currentKey == F("Icao")) {
-    // aircrafts[index].icao = value;
-  } else if (currentKey == F("Call")) {
-    //-#ifdef DEBUG_SERIAL Serial.println("Saw " + value);
-    aircrafts[index].call = value;
-  } else if (currentKey == F("PosStale")) {
-    aircrafts[index].posStall = (value == F("true"));
-  } else if (currentKey == F("Cos")) {
-    int tempIndex = trailIndex / 4;
-    if (tempIndex < MAX_HISTORY_TEMP) {
-      AircraftPosition position = positionTemp[tempIndex];
-      Coordinates coordinates = position.coordinates;
+    case jsonKey("Dst"):
+      aircrafts[index].distance = atof(value);
+      break;
+
+    case jsonKey("Mdl"):
+      copyField(aircrafts[index].aircraftType, AIRCRAFT_TYPE_SIZE, value);
+      break;
+
+    case jsonKey("Trak"):
+      aircrafts[index].heading = atof(value);
+      break;
+
+    case jsonKey("Alt"):
+      aircrafts[index].altitude = atoi(value);
+      break;
+
+    case jsonKey("Lat"):
+      aircrafts[index].lat = aircrafts[index].reportedLat = atof(value);
+      break;
+
+    case jsonKey("Long"):
+      aircrafts[index].lon = aircrafts[index].reportedLon = atof(value);
+      break;
+
+    case jsonKey("Spd"):
+      aircrafts[index].speed = atof(value);
+      break;
+
+    case jsonKey("Call"):
+      //-#ifdef DEBUG_SERIAL Serial.println("Saw " + value);
+      copyField(aircrafts[index].call, AIRCRAFT_CALL_SIZE, value);
+      break;
+
+    case jsonKey("PosStale"):
+      aircrafts[index].posStall = !strcmp(value, "true");
+      break;
+
+    case jsonKey("Cos"):
+    {
+      // Trail of lat, lon, time, alt, oldest first: the latest MAX_HISTORY positions
+      // are kept in a ring in place, put in order by endArray()
       if (trailIndex % 4 == 0) {
-        coordinates.lat = value.toFloat();
+        trailPosition.coordinates.lat = atof(value);
       } else if (trailIndex % 4 == 1) {
-        coordinates.lon = value.toFloat();
+        trailPosition.coordinates.lon = atof(value);
       } else if (trailIndex % 4 == 3) {
-        position.altitude = value.toInt();
+        trailPosition.altitude = atoi(value);
+        histories[index].positions[(trailIndex / 4) % MAX_HISTORY] = trailPosition;
       }
-      position.coordinates = coordinates;
-      positionTemp[tempIndex] = position;
       trailIndex++;
+      break;
     }
 
-  } else if (currentKey == F("Trt")) {
-    if (aircrafts[index].posStall) {
-      //-#ifdef DEBUG_SERIAL Serial.println(F("This aircraft is stalled. Ignoring it"));
-      counter--;
-      index = counter - 1;
-    }
+    case jsonKey("Trt"):
+      if (aircrafts[index].posStall) {
+        //-#ifdef DEBUG_SERIAL Serial.println(F("This aircraft is stalled. Ignoring it"));
+        counter--;
+        index = counter - 1;
+      }
+      break;
   }
-
 }
 
-Aircraft AdsbExchangeClient::getAircraft(int i)
+const Aircraft &AdsbExchangeClient::getAircraft(int i)
 {
-  if (i < MAX_AIRCRAFTS) {
-    return aircrafts[i];
-  }
-  //return nullptr;
+  return aircrafts[i];
 }
 
-AircraftHistory AdsbExchangeClient::getAircraftHistory(int i) {
+const AircraftHistory &AdsbExchangeClient::getAircraftHistory(int i) {
   return histories[i];
 }
 
+void AdsbExchangeClient::extrapolate()
+{
+  unsigned long elapsed = millis() - lastSightingMillis;
+  if (elapsed > ADSB_MAX_EXTRAPOLATION)
+    elapsed = ADSB_MAX_EXTRAPOLATION;
+
+  for (int i = 0; i < counter; i++)
+  {
+    Aircraft &aircraft = aircrafts[i];
+
+    // Knots, and a nautical mile is a minute of latitude: degrees flown along the track
+    double distance = aircraft.speed * elapsed / 3600000.0 / 60.0;
+    double track = aircraft.heading * PI / 180;
+
+    aircraft.lat = aircraft.reportedLat + distance * cos(track);
+    aircraft.lon = aircraft.reportedLon + distance * sin(track) / cos(aircraft.reportedLat * PI / 180);
+  }
+}
+
 int AdsbExchangeClient::getNumberOfAircrafts() {
   return counter;
 }
 
-Aircraft AdsbExchangeClient::getClosestAircraft(double lat, double lon) {
+const Aircraft &AdsbExchangeClient::getClosestAircraft(double lat, double lon) {
   double minDistance = 999999.0;
-  Aircraft closestAircraft = aircrafts[0];
+  int closest = 0;
   for (int i = 0; i < getNumberOfAircrafts(); i++) {
-    Aircraft currentAircraft = aircrafts[i];
-
-    if (currentAircraft.distance < minDistance) {
-      minDistance = currentAircraft.distance;
-      closestAircraft = currentAircraft;
+    if (aircrafts[i].distance < minDistance) {
+      minDistance = aircrafts[i].distance;
+      closest = i;
     }
   }
-  return closestAircraft;
+  return aircrafts[closest];
 }
 
 void AdsbExchangeClient::endArray()
@@ -243,30 +252,19 @@ void AdsbExchangeClient::endArray()
     //-#ifdef DEBUG_SERIAL Serial.println(F("Max Aircrafts reached:end array"));
     return;
   }
-  if (currentKey == F("Cos") && trailIndex > 0) {
-    AircraftHistory history = {};
-    uint16_t items = (trailIndex / 4);
+  if (currentKey == jsonKey("Cos") && trailIndex > 0) {
+    AircraftHistory &history = histories[index];
+    int items = trailIndex / 4;
     //-#ifdef DEBUG_SERIAL Serial.println("Finished history array: " + String(items) + " elements");
-    int historyCounter = 0;
-    for (int i = 0; i < min(items, MAX_HISTORY); i++) {
-      AircraftPosition position = {};
-      Coordinates coordinates = position.coordinates;
-      coordinates.lat = positionTemp[items - i - 1].coordinates.lat;
-      coordinates.lon = positionTemp[items - i - 1].coordinates.lon;
-      position.coordinates = coordinates;
-      position.altitude = positionTemp[items - i - 1].altitude;
-      history.positions[i] = position;
-      historyCounter++;
-    }
-    history.call = aircrafts[index].call;
-    history.counter = historyCounter;
-    histories[index] = history;
-    currentKey = F("");
-  }
-}
 
-void AdsbExchangeClient::endObject() {
+    // Ring wrapped: the oldest position is next to the latest
+    if (items > MAX_HISTORY)
+      std::rotate(history.positions, history.positions + items % MAX_HISTORY, history.positions + MAX_HISTORY);
 
+    history.counter = min(items, MAX_HISTORY);
+    std::reverse(history.positions, history.positions + history.counter);
+    currentKey = 0;
+  }
 }
 
 void AdsbExchangeClient::endDocument()
@@ -280,11 +278,3 @@ void AdsbExchangeClient::endDocument()
     }
     }*/
 }
-
-void AdsbExchangeClient::startArray() {
-
-}
-
-void AdsbExchangeClient::startObject() {
-
-}
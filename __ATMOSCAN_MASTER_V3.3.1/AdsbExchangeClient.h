@@ -25,13 +25,20 @@
 
 #pragma once
 
-#include <JsonListener.h>
-#include <JsonStreamingParser.h>  // https://github.com/squix78/json-streaming-parser
+#include "JsonTokenizer.h"
+#include "WsClient.h"
 #include "GeoMap.h"
 
 #define MAX_AIRCRAFTS 8
 #define MAX_HISTORY 20
-#define MAX_HISTORY_TEMP 40
+
+// Fixed capacity text fields (terminator included), longer values are truncated
+#define AIRCRAFT_CALL_SIZE 10
+#define AIRCRAFT_PLACE_SIZE 24
+#define AIRCRAFT_TYPE_SIZE 32
+
+// Aircrafts are not flown on for longer than this without news
+#define ADSB_MAX_EXTRAPOLATION 30000      // ms
 
 #define min(a,b) ((a)<(b)?(a):(b))
 
@@ -40,8 +47,8 @@ struct AircraftPosition {
   Coordinates coordinates;
 };
 
+// Latest positions first
 struct AircraftHistory {
-  String call;
   AircraftPosition positions[MAX_HISTORY];
   int counter;
 };
@@ -49,64 +56,66 @@ struct AircraftHistory {
 struct Aircraft {
   // String from;
   // String fromCode;
-  String fromShort;
+  char fromShort[AIRCRAFT_PLACE_SIZE];
   // String to;
   // String toCode;
-  String toShort;
+  char toShort[AIRCRAFT_PLACE_SIZE];
   double speed;
   double lat;
   double lon;
+  double reportedLat;                     // As polled, lat and lon are extrapolated from it
+  double reportedLon;
   uint16_t altitude;
   double distance;
-  String aircraftType;
+  char aircraftType[AIRCRAFT_TYPE_SIZE];
   // String operatorCode;
   double heading;
   // String icao;
-  String call;
+  char call[AIRCRAFT_CALL_SIZE];
   bool posStall;
 };
 
 
-class AdsbExchangeClient: public JsonListener {
+// Long lived: the aircraft arena is reused by every refresh, nothing is allocated
+class AdsbExchangeClient: public JsonHandler, public WsClient {
   private:
     int counter = 0;
     int index = 0;
-    String currentKey = "";
+    uint32_t currentKey = 0;
     Aircraft aircrafts[MAX_AIRCRAFTS];
     AircraftHistory histories[MAX_AIRCRAFTS];
-    AircraftPosition positionTemp[MAX_HISTORY_TEMP];
-    long lastSightingMillis = 0;
+    AircraftPosition trailPosition;
+    unsigned long lastSightingMillis = 0;   // When the positions were polled
     int trailIndex = 0;
+    String requestPath;
 
   public:
     AdsbExchangeClient();
 
-    void updateVisibleAircraft(String searchQuery);
+    // Once, the query only depends on the map
+    void setSearchQuery(const String &searchQuery);
 
-    Aircraft getAircraft(int i);
+    void updateVisibleAircraft();
 
-    AircraftHistory getAircraftHistory(int i);
+    // Dead reckoning: positions flown on since the poll
+    void extrapolate();
 
-    int getNumberOfAircrafts();
+    const Aircraft &getAircraft(int i);
+
+    const AircraftHistory &getAircraftHistory(int i);
 
-    Aircraft getClosestAircraft(double lat, double lon);
+    int getNumberOfAircrafts();
 
-    virtual void whitespace(char c);
+    const Aircraft &getClosestAircraft(double lat, double lon);
 
     virtual void startDocument();
 
-    virtual void key(String key);
+    virtual void key(uint32_t keyId, const char *key, uint16_t length);
 
-    virtual void value(String value);
+    virtual void value(char *value, uint16_t length);
 
     virtual void endArray();
 
-    virtual void endObject();
-
     virtual void endDocument();
 
-    virtual void startArray();
-
-    virtual void startObject();
-
 };
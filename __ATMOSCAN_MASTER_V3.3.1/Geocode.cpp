@@ -8,7 +8,6 @@
 #include <ArduinoJson.h>
 #include "ESP8266WiFi.h"
 #include <NtpClientLib.h>         // http://github.com/gmag11/NtpClient
-#include <JsonStreamingParser.h>
 #include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
 #include "WsClient.h"
 #include "TimeSpace.h"
@@ -25,10 +24,6 @@ extern Syslog syslog;
 bool Geocode::acquire(double latitude, double longitude)
 {
 
-#ifdef DEBUG_SYSLOG
-  String myBuffer;
-#endif
-
   //Connect to the client and make the api call
   if (httpConnect())
   {
@@ -54,46 +49,21 @@ bool Geocode::acquire(double latitude, double longitude)
       country = FPSTR(empty);
       countryCode = FPSTR(empty);
 
-      // Allow for slow server...
-      int retryCounter = 0;
-      while (!client.available())
-      {
-        delay(1000);
-        retryCounter++;
-        if (retryCounter > 10)
-        {
-          return false;
-        }
-      }
+      JsonTokenizer parser(this);
 
-      while (client.available())
+      // Bounded in time, a slow server does not hold the system
+      if (!readBody(parser))
       {
-        JsonStreamingParser parser;
-        parser.setListener(this);
-        char c;
-
-        while (client.available())
-        {
-          c = client.read();
-
-#ifdef DEBUG_SERIAL
-          Serial.print(c);
-#endif
-
-#ifdef DEBUG_SYSLOG
-          myBuffer = myBuffer + String(c);
-#endif
-
-          parser.parse(c);
-
-          // Improves reliability from ESP version 2.4.0
-          yield();
-        }
+        disconnect();
+        return false;
       }
     }
     else
+    {
       // Get failed
+      disconnect();
       return false;
+    }
   }
   else
     // Could not connect
@@ -101,56 +71,48 @@ bool Geocode::acquire(double latitude, double longitude)
 
   disconnect();
 
-#ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, "RESPONSE = " + myBuffer);
-#endif
-
   if (country == F("") || countryCode == F(""))
     return false;
   else
     return true;
 }
 
-void Geocode::whitespace(char c) {
-#ifdef DEBUG_LOG
-  Serial.println("whitespace");
-#endif
-}
-
 void Geocode::startDocument() {
 #ifdef DEBUG_LOG
   Serial.println("start document");
 #endif
 }
 
-void Geocode::key(String key)
+void Geocode::key(uint32_t keyId, const char *, uint16_t)
 {
 #ifdef DEBUG_LOG
-  Serial.println("key: " + key);
+  Serial.println(String("key ID: ") + String(keyId, HEX));
 #endif
-  currentKey = key;
+  currentKey = keyId;
 }
 
-void Geocode::value(String value)
+void Geocode::value(char *value, uint16_t)
 {
 #ifdef DEBUG_LOG
-  Serial.println("value: " + value);
+  Serial.println(String("value: ") + value);
 #endif
-  if (currentKey == F("name"))
-  {
-    locality = value;
-  }
-  else if (currentKey == F("countryName"))
-  {
-    country = value;
-  }
-  else if (currentKey == F("countryCode"))
+
+  switch (currentKey)
   {
-    countryCode = value;
+    case jsonKey("name"):
+      locality = value;
+      break;
+
+    case jsonKey("countryName"):
+      country = value;
+      break;
+
+    case jsonKey("countryCode"):
+      countryCode = value;
+      break;
   }
 }
 
-
 void Geocode::endArray() {
 #ifdef DEBUG_LOG
   Serial.println("end array. ");
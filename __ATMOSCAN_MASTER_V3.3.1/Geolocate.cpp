@@ -31,7 +31,6 @@
 */
 
 #include "ESP8266WiFi.h"
-#include <JsonStreamingParser.h>
 #include "WsClient.h"
 #include "TimeSpace.h"
 //#include "UserConfig.h"
@@ -46,9 +45,9 @@ extern Syslog syslog;
   Get latitude and longitude via Wifi triangulation
 **********************************************************/
 
-bool Geolocate::acquire()
+bool Geolocate::acquire(int networks)
 {
-  int n = min(WiFi.scanNetworks(false, true), MAX_SSIDS);
+  int n = min(networks, MAX_SSIDS);
   String multiAPString = "";
 
   for (int i = 0; i < n; i++)
@@ -78,7 +77,6 @@ bool Geolocate::acquire()
 
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, "URL = " + url);
-  String myBuffer;
 #endif
 
   //Connect to the client and make the api call
@@ -86,36 +84,13 @@ bool Geolocate::acquire()
   {
     if (httpGet(url) && skipResponseHeaders())
     {
-      JsonStreamingParser parser;
-      parser.setListener(this);
-      char c;
+      JsonTokenizer parser(this);
 
-      // Allow for slow server...
-      int retryCounter = 0;
-      while (!client.available())
+      // Bounded in time, a slow server does not hold the system
+      if (!readBody(parser))
       {
-        delay(1000);
-        retryCounter++;
-        if (retryCounter > 10)
-        {
-          return false;
-        }
-      }
-
-      while (client.available())
-      {
-        c = client.read();
-#ifdef DEBUG_SERIAL
-        Serial.print(c);
-#endif
-        parser.parse(c);
-
-#ifdef DEBUG_SYSLOG
-        myBuffer = myBuffer + String(c);
-#endif
-
-        // Improves reliability from ESP version 2.4.0
-        yield();
+        disconnect();
+        return false;
       }
     }
     else
@@ -124,6 +99,7 @@ bool Geolocate::acquire()
 #ifdef DEBUG_SERIAL
       Serial.println("get failed");
 #endif
+      disconnect();
       return false;
     }
   }
@@ -139,32 +115,31 @@ bool Geolocate::acquire()
 
   disconnect();
 
-#ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, "RESPONSE = " + myBuffer);
-#endif
-
   if (latitude == 0 || longitude == 0)
     return false;
   else
     return true;
 }
 
-void Geolocate::key(String key) {
-  currentKey = key;
+void Geolocate::key(uint32_t keyId, const char *, uint16_t) {
+  currentKey = keyId;
 }
 
-void Geolocate::value(String value)
+void Geolocate::value(char *value, uint16_t)
 {
-  if (currentKey == F("lat"))
+  switch (currentKey)
   {
-    latitude = value.toFloat();
-  }
-  if (currentKey == F("lon"))
-  {
-    longitude = value.toFloat();
+    case jsonKey("lat"):
+      latitude = atof(value);
+      break;
+
+    case jsonKey("lon"):
+      longitude = atof(value);
+      break;
   }
+
 #ifdef DEBUG_SERIAL
-  Serial.println("Key " + currentKey + ", value: " + value);
+  Serial.println(String("Value: ") + value);
 #endif
 }
 
@@ -177,10 +152,6 @@ double Geolocate::getLatitude() {
 }
 
 
-void Geolocate::whitespace(char c) {
-
-}
-
 void Geolocate::startDocument() {
 
 }
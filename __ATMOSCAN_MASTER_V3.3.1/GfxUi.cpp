@@ -224,8 +224,11 @@ uint32_t GfxUi::read32(fs::File &f) {
 //====================================================================================
 void GfxUi::drawJpeg(String filename, int xpos, int ypos)
 {
+  drawJpeg(filename, xpos, ypos, 0, 0, _tft->width(), _tft->height());
+}
 
-
+void GfxUi::drawJpeg(String filename, int xpos, int ypos, int clipX, int clipY, int clipWidth, int clipHeight)
+{
   // Open the named file (the Jpeg decoder library will close it after rendering image)
   fs::File jpegFile = SPIFFS.open( filename, "r");    // File handle reference for SPIFFS
   //  File jpegFile = SD.open( filename, FILE_READ);  // or, file handle reference for SD library
@@ -255,7 +258,7 @@ void GfxUi::drawJpeg(String filename, int xpos, int ypos)
     // jpegInfo();
 
     // render the image onto the screen at given coordinates
-    renderJPEG(xpos, ypos);
+    renderJPEG(xpos, ypos, clipX, clipY, clipWidth, clipHeight);
   }
   else
   {
@@ -387,6 +390,7 @@ int GfxUi::fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry,
     x1 = x3;
     y1 = y3;
   }
+  return 0;
 }
 
 
@@ -439,47 +443,641 @@ void GfxUi::drawBitmap(const unsigned short * icon, uint16_t x, uint16_t y, uint
   setTurbo(false);
 }
 
-void GfxUi::renderJPEG(int32_t xpos, int32_t ypos)
+//====================================================================================
+// Draws a palette + RLE bitmap from program memory (FLASH), generated by
+// _TOOLS/bitmap_converter.py: width and height come with it.
+// Runs and packed indexes expand straight into the pixel buffer sent to the display.
+//====================================================================================
+
+// Palette entry, little endian (no alignment in the array)
+static uint16_t packedColor(const uint8_t *palette, uint8_t index)
+{
+  return pgm_read_byte(&palette[index * 2]) | (pgm_read_byte(&palette[index * 2 + 1]) << 8);
+}
+
+void GfxUi::drawPackedBitmap(const uint8_t * bitmap, uint16_t x, uint16_t y)
+{
+  uint16_t width = pgm_read_byte(&bitmap[0]) | (pgm_read_byte(&bitmap[1]) << 8);
+  uint16_t height = pgm_read_byte(&bitmap[2]) | (pgm_read_byte(&bitmap[3]) << 8);
+  uint8_t bits = pgm_read_byte(&bitmap[4]);
+  uint16_t colors = pgm_read_byte(&bitmap[5]) + 1;
+  uint8_t mask = (1 << bits) - 1;
+
+  const uint8_t *palette = &bitmap[PACKED_BITMAP_HEADER_SIZE];
+  const uint8_t *data = palette + colors * 2;
+
+  //  TURBO mode
+  setTurbo(true);
+
+  uint16_t pix_buffer[BUFF_SIZE];   // Pixel buffer (16 bits per pixel)
+  uint16_t count = 0;
+  uint32_t left = (uint32_t)width * height;
+
+  _tft->setWindow(x, y, x + width - 1, y + height - 1);
+
+  while (left > 0)
+  {
+    uint8_t code = pgm_read_byte(data++);
+
+    // Run of one colour
+    if (code >= 128)
+    {
+      uint16_t color = packedColor(palette, pgm_read_byte(data++));
+      for (uint8_t n = code - 127; n > 0 && left > 0; n--, left--)
+      {
+        pix_buffer[count++] = color;
+        if (count == BUFF_SIZE)
+        {
+          _tft->pushColors(pix_buffer, BUFF_SIZE);
+          count = 0;
+        }
+      }
+    }
+
+    // Packed indexes, MSB first
+    else
+    {
+      uint8_t packed = 0;
+      uint8_t available = 0;
+      for (uint8_t n = code + 1; n > 0 && left > 0; n--, left--)
+      {
+        if (available == 0)
+        {
+          packed = pgm_read_byte(data++);
+          available = 8;
+        }
+        available -= bits;
+        pix_buffer[count++] = packedColor(palette, (packed >> available) & mask);
+        if (count == BUFF_SIZE)
+        {
+          _tft->pushColors(pix_buffer, BUFF_SIZE);
+          count = 0;
+        }
+      }
+    }
+  }
+
+  // Send any partial buffer left over
+  if (count)
+    _tft->pushColors(pix_buffer, count);
+
+  //  NORMAL mode
+  setTurbo(false);
+}
+
+void GfxUi::renderJPEG(int xpos, int ypos)
+{
+  renderJPEG(xpos, ypos, 0, 0, _tft->width(), _tft->height());
+}
+
+//====================================================================================
+//   Sends the decoded MCUs that fall in the clip window (and on the screen).
+//   Edge MCUs are cropped instead of skipped, and decoding stops after the last
+//   visible MCU. Each MCU is sent on its own, from the decoder's buffer: no heap.
+//   NOTE: the ESP8266 has no DMA to the display, SPI transfers and decoding cannot
+//   overlap: the gain is in what is not decoded, not in concurrency (assembling
+//   MCU rows into a strip saved windows, but no measurable time)
+//====================================================================================
+void GfxUi::renderJPEG(int xpos, int ypos, int clipX, int clipY, int clipWidth, int clipHeight)
+{
+  int32_t mcuWidth = JpegDec.MCUWidth;
+  int32_t mcuHeight = JpegDec.MCUHeight;
+
+  // Visible part of the image
+  int32_t left = xpos;
+  int32_t top = ypos;
+  int32_t right = xpos + JpegDec.width;
+  int32_t bottom = ypos + JpegDec.height;
+
+  if (left < clipX) left = clipX;
+  if (left < 0) left = 0;
+  if (top < clipY) top = clipY;
+  if (top < 0) top = 0;
+  if (right > clipX + clipWidth) right = clipX + clipWidth;
+  if (right > _tft->width()) right = _tft->width();
+  if (bottom > clipY + clipHeight) bottom = clipY + clipHeight;
+  if (bottom > _tft->height()) bottom = _tft->height();
+
+  if (left >= right || top >= bottom)
+  {
+    JpegDec.abort();
+    return;
+  }
+
+  while (JpegDec.readSwappedBytes())
+  {
+    uint16_t *pImg = JpegDec.pImage;
+    int32_t mcuX = JpegDec.MCUx * mcuWidth + xpos;
+    int32_t mcuY = JpegDec.MCUy * mcuHeight + ypos;
+
+    // Part of the MCU in the visible window
+    int32_t x0 = mcuX < left ? left : mcuX;
+    int32_t y0 = mcuY < top ? top : mcuY;
+    int32_t x1 = mcuX + mcuWidth > right ? right : mcuX + mcuWidth;
+    int32_t y1 = mcuY + mcuHeight > bottom ? bottom : mcuY + mcuHeight;
+
+    if (x0 >= x1 || y0 >= y1)
+      continue;
+
+    uint32_t width = x1 - x0;
+    uint32_t height = y1 - y0;
+    uint16_t *source = pImg + (y0 - mcuY) * mcuWidth + (x0 - mcuX);
+
+    // Cropped rows packed at the start of the MCU buffer
+    if (width != (uint32_t)mcuWidth)
+    {
+      for (uint32_t row = 0; row < height; row++)
+        memmove(&pImg[row * width], &source[row * mcuWidth], width * sizeof(uint16_t));
+      source = pImg;
+    }
+
+    _tft->setWindow(x0, y0, x1 - 1, y1 - 1);
+    _tft->pushColors((uint8_t *)source, width * height * sizeof(uint16_t));
+
+    // Nothing visible after the last MCU of the bottom row
+    if (x1 == right && y1 == bottom)
+    {
+      JpegDec.abort();
+      break;
+    }
+  }
+}
+
+//====================================================================================
+//   Frames: a JPEG decoded once and stored as palette indexes, run length encoded,
+//   so that drawing it again is a single window streamed from SPIFFS, without
+//   decoding nor TURBO mode.
+//   Radar maps use few colours: the most frequent ones (4 bits per channel bins)
+//   make the palette, averaged over their pixels, other bins map to the nearest.
+//
+//   Layout: magic, width, height, colours, 0     (uint32 + 4 x uint16)
+//           runs, in rows: n < 128   n + 1 literal indexes follow
+//                          n >= 128  next index repeated n - 127 times
+//           palette: colours x RGB565, byte swapped (as sent to the display)
+//====================================================================================
+
+#define FRAME_BINS 4096
+#define FRAME_RUN_MAX 128
+#define FRAME_IO_SIZE 256
+
+// 4 bits per channel bin of an RGB565 colour
+static uint16_t frameBin(uint16_t color)
+{
+  return ((color >> 12) << 8) | (((color >> 7) & 0x0F) << 4) | ((color >> 1) & 0x0F);
+}
+
+// Buffered writes to a frame file
+class FrameWriter
+{
+  public:
+    FrameWriter(fs::File &file) : file(file) {}
+
+    void put(uint8_t value)
+    {
+      buffer[length++] = value;
+      if (length == FRAME_IO_SIZE)
+        flush();
+    }
+
+    void put(const void *data, size_t size)
+    {
+      for (size_t i = 0; i < size; i++)
+        put(((const uint8_t *)data)[i]);
+    }
+
+    // False if anything was lost (file system full)
+    bool flush()
+    {
+      if (length > 0 && file.write(buffer, length) != length)
+        failed = true;
+      length = 0;
+      return !failed;
+    }
+
+  private:
+    fs::File &file;
+    uint8_t buffer[FRAME_IO_SIZE];
+    uint16_t length = 0;
+    bool failed = false;
+};
+
+// Buffered reads of the runs of a frame file
+class FrameReader
+{
+  public:
+    FrameReader(fs::File &file, size_t size) : file(file), remaining(size) {}
+
+    // Next byte, -1 at the end
+    int next()
+    {
+      if (position == length)
+      {
+        length = remaining < FRAME_IO_SIZE ? remaining : FRAME_IO_SIZE;
+        if (length == 0 || file.read(buffer, length) != length)
+          return -1;
+        remaining -= length;
+        position = 0;
+      }
+      return buffer[position++];
+    }
+
+  private:
+    fs::File &file;
+    size_t remaining;
+    uint8_t buffer[FRAME_IO_SIZE];
+    uint16_t position = 0;
+    uint16_t length = 0;
+};
+
+// Runs of a sequence of palette indexes
+static void frameEncode(FrameWriter &out, const uint8_t *indexes, uint32_t count)
+{
+  uint32_t i = 0;
+  while (i < count)
+  {
+    uint32_t run = 1;
+    while (i + run < count && run < FRAME_RUN_MAX && indexes[i + run] == indexes[i])
+      run++;
+
+    if (run > 1)
+    {
+      out.put(127 + run);
+      out.put(indexes[i]);
+      i += run;
+      continue;
+    }
+
+    // Literals, up to the start of the next run
+    uint32_t literal = 1;
+    while (i + literal < count && literal < FRAME_RUN_MAX &&
+           !(i + literal + 1 < count && indexes[i + literal] == indexes[i + literal + 1]))
+      literal++;
+
+    out.put(literal - 1);
+    out.put(&indexes[i], literal);
+    i += literal;
+  }
+}
+
+bool GfxUi::jpegToFrame(String jpegName, String frameName)
 {
+  if (!JpegDec.decodeFsFile(jpegName))
+    return false;
+
+  uint32_t width = JpegDec.width;
+  uint32_t height = JpegDec.height;
+  uint32_t mcuWidth = JpegDec.MCUWidth;
+  uint32_t mcuHeight = JpegDec.MCUHeight;
+
+  // Room for the worst case (all literals)
+  FSInfo fsInfo;
+  size_t worstSize = FRAME_HEADER_SIZE + width * height + width * height / FRAME_RUN_MAX + height + FRAME_MAX_COLORS * 2;
+  if (!SPIFFS.info(fsInfo) || fsInfo.totalBytes - fsInfo.usedBytes < worstSize + fsInfo.blockSize)
+  {
+    JpegDec.abort();
+    return false;
+  }
+
+  // Histogram of the bins (then their palette index), one MCU row of indexes, palette sums
+  size_t stripSize = width * mcuHeight;
+  size_t sumsSize = FRAME_MAX_COLORS * 4 * sizeof(uint32_t);
+  if (ESP.getFreeHeap() < FRAME_BINS * sizeof(uint16_t) + stripSize + sumsSize + JPEG_STRIP_HEAP_RESERVE)
+  {
+    JpegDec.abort();
+    return false;
+  }
+
+  uint16_t *histogram = (uint16_t *)calloc(FRAME_BINS, sizeof(uint16_t));
+  uint8_t *strip = (uint8_t *)malloc(stripSize);
+  uint32_t *sums = (uint32_t *)calloc(FRAME_MAX_COLORS * 4, sizeof(uint32_t));
+  if (!histogram || !strip || !sums)
+  {
+    free(histogram);
+    free(strip);
+    free(sums);
+    JpegDec.abort();
+    return false;
+  }
 
-  uint8_t  *pImg;
-  uint32_t mcu_w = JpegDec.MCUWidth;
-  uint32_t mcu_h = JpegDec.MCUHeight;
-  int32_t max_x = JpegDec.width;
-  int32_t max_y = JpegDec.height;
+  //  TURBO mode
+  setTurbo(true);
 
-  uint32_t min_w = min(mcu_w, max_x % mcu_w);
-  uint32_t min_h = min(mcu_h, max_y % mcu_h);
+  // First pass: colour histogram
+  while (JpegDec.read())
+  {
+    uint32_t mcuX = JpegDec.MCUx * mcuWidth;
+    uint32_t mcuY = JpegDec.MCUy * mcuHeight;
+    uint32_t w = min(mcuWidth, width - mcuX);
+    uint32_t h = min(mcuHeight, height - mcuY);
+
+    for (uint32_t row = 0; row < h; row++)
+      for (uint32_t col = 0; col < w; col++)
+      {
+        uint16_t &count = histogram[frameBin(JpegDec.pImage[row * mcuWidth + col])];
+        if (count < UINT16_MAX)
+          count++;
+      }
+  }
 
-  uint32_t win_w = mcu_w;
-  uint32_t win_h = mcu_h;
+  // Palette: the most frequent bins
+  uint16_t paletteBins[FRAME_MAX_COLORS];
+  uint16_t colors = 0;
+  while (colors < FRAME_MAX_COLORS)
+  {
+    uint16_t best = 0;
+    for (uint16_t bin = 1; bin < FRAME_BINS; bin++)
+      if (histogram[bin] > histogram[best])
+        best = bin;
 
-  uint32_t drawTime = millis();
+    if (histogram[best] == 0)
+      break;
 
-  max_x += xpos;
-  max_y += ypos;
+    paletteBins[colors++] = best;
+    histogram[best] = 0;
+  }
 
-  while ( JpegDec.readSwappedBytes())
+  // Histogram no longer needed: reused as the bin to palette index map
+  uint8_t *map = (uint8_t *)histogram;
+  for (uint16_t bin = 0; bin < FRAME_BINS; bin++)
   {
+    uint32_t nearest = UINT32_MAX;
+    for (uint16_t c = 0; c < colors; c++)
+    {
+      int32_t dr = (int32_t)(bin >> 8) - (paletteBins[c] >> 8);
+      int32_t dg = (int32_t)((bin >> 4) & 0x0F) - ((paletteBins[c] >> 4) & 0x0F);
+      int32_t db = (int32_t)(bin & 0x0F) - (paletteBins[c] & 0x0F);
+      uint32_t distance = 3 * dr * dr + 4 * dg * dg + 2 * db * db;
+      if (distance < nearest)
+      {
+        nearest = distance;
+        map[bin] = c;
+      }
+    }
+  }
 
-    pImg = (uint8_t*)JpegDec.pImage;
-    int32_t mcu_x = JpegDec.MCUx * mcu_w + xpos;
-    int32_t mcu_y = JpegDec.MCUy * mcu_h + ypos;
+  // Second pass: indexes, in rows
+  bool written = false;
+  fs::File file = SPIFFS.open(frameName, "w");
+  if (colors > 0 && file && JpegDec.decodeFsFile(jpegName))
+  {
+    FrameWriter out(file);
+    uint32_t magic = FRAME_MAGIC;
+    uint16_t header[4] = {(uint16_t)width, (uint16_t)height, colors, 0};
+    out.put(&magic, sizeof(magic));
+    out.put(header, sizeof(header));
 
-    if (mcu_x + mcu_w <= max_x) win_w = mcu_w;
-    else win_w = min_w;
-    if (mcu_y + mcu_h <= max_y) win_h = mcu_h;
-    else win_h = min_h;
+    while (JpegDec.read())
+    {
+      uint32_t mcuX = JpegDec.MCUx * mcuWidth;
+      uint32_t mcuY = JpegDec.MCUy * mcuHeight;
+      uint32_t w = min(mcuWidth, width - mcuX);
+      uint32_t h = min(mcuHeight, height - mcuY);
+
+      for (uint32_t row = 0; row < h; row++)
+        for (uint32_t col = 0; col < w; col++)
+        {
+          uint16_t color = JpegDec.pImage[row * mcuWidth + col];
+          uint16_t bin = frameBin(color);
+          uint8_t index = map[bin];
+          strip[row * width + mcuX + col] = index;
+
+          // Palette colours are the average of their own bin
+          if (paletteBins[index] == bin)
+          {
+            uint32_t *sum = &sums[index * 4];
+            sum[0] += color >> 11;
+            sum[1] += (color >> 5) & 0x3F;
+            sum[2] += color & 0x1F;
+            sum[3]++;
+          }
+        }
 
-    uint32_t mcu_pixels = win_w * win_h * 2;
+      // MCU row complete
+      if (mcuX + w == width)
+        frameEncode(out, strip, width * h);
+    }
 
-    if ( ( mcu_x + win_w) <= _tft->width() && ( mcu_y + win_h) <= _tft->height())
+    for (uint16_t c = 0; c < colors; c++)
     {
+      uint32_t *sum = &sums[c * 4];
+      uint16_t color = sum[3] ? ((sum[0] / sum[3]) << 11) | ((sum[1] / sum[3]) << 5) | (sum[2] / sum[3]) : 0;
+      color = (color >> 8) | (color << 8);
+      out.put(&color, sizeof(color));
+    }
+
+    written = out.flush();
+  }
+
+  //  NORMAL mode
+  setTurbo(false);
+
+  if (file)
+    file.close();
+  free(histogram);
+  free(strip);
+  free(sums);
+
+  if (!written)
+    SPIFFS.remove(frameName);
+  return written;
+}
 
-      _tft->setWindow(mcu_x, mcu_y, mcu_x + win_w - 1, mcu_y + win_h - 1);
-      _tft->pushColors(pImg, mcu_pixels);    // pushColors via 64 byte SPI port buffer
+bool GfxUi::drawFrame(String frameName, int xpos, int ypos)
+{
+  fs::File file = SPIFFS.open(frameName, "r");
+  if (!file)
+    return false;
+
+  uint32_t magic = 0;
+  uint16_t header[4] = {0};
+  uint16_t palette[FRAME_MAX_COLORS];
+
+  bool valid = file.read((uint8_t *)&magic, sizeof(magic)) == sizeof(magic) && magic == FRAME_MAGIC &&
+               file.read((uint8_t *)header, sizeof(header)) == sizeof(header);
+
+  uint16_t width = header[0];
+  uint16_t height = header[1];
+  uint16_t colors = header[2];
+  size_t paletteSize = colors * sizeof(uint16_t);
+
+  // Palette at the end
+  valid = valid && width > 0 && height > 0 && colors > 0 && colors <= FRAME_MAX_COLORS &&
+          file.size() >= FRAME_HEADER_SIZE + paletteSize &&
+          file.seek(file.size() - paletteSize, fs::SeekSet) && file.read((uint8_t *)palette, paletteSize) == paletteSize &&
+          file.seek(FRAME_HEADER_SIZE, fs::SeekSet);
+  if (!valid)
+  {
+    file.close();
+    return false;
+  }
+
+  FrameReader in(file, file.size() - FRAME_HEADER_SIZE - paletteSize);
+  uint16_t pixels[BUFF_SIZE];
+  uint16_t count = 0;
+  uint32_t left = (uint32_t)width * height;
+
+  _tft->setWindow(xpos, ypos, xpos + width - 1, ypos + height - 1);
+
+  while (left > 0)
+  {
+    int code = in.next();
+    int index = code >= FRAME_RUN_MAX ? in.next() : 0;
+    if (code < 0 || index < 0)
+      break;
+
+    uint16_t length = code >= FRAME_RUN_MAX ? code - 127 : code + 1;
+    for (uint16_t i = 0; i < length && left > 0; i++, left--)
+    {
+      if (code < FRAME_RUN_MAX && (index = in.next()) < 0)
+        break;
+
+      pixels[count++] = palette[index < colors ? index : 0];
+      if (count == BUFF_SIZE)
+      {
+        _tft->pushColors((uint8_t *)pixels, count * sizeof(uint16_t));
+        count = 0;
+      }
     }
+    if (index < 0)
+      break;
+  }
+
+  if (count)
+    _tft->pushColors((uint8_t *)pixels, count * sizeof(uint16_t));
 
-    else if ( ( mcu_y + mcu_h) >= _tft->height()) JpegDec.abort();
+  file.close();
+  return left == 0;
+}
+
+//====================================================================================
+//   Raw copies: a JPEG decoded once as RGB565 rows, byte swapped (as sent to the
+//   display). Bigger than a frame, but any rectangle of it can be drawn again with
+//   a few seeks, so that what was drawn over an image can be erased in place.
+//
+//   Layout: magic, width, height     (uint32 + 2 x uint16)
+//           pixels, in rows
+//====================================================================================
+
+bool GfxUi::jpegToRaw(String jpegName, String rawName)
+{
+  if (!JpegDec.decodeFsFile(jpegName))
+    return false;
+
+  uint32_t width = JpegDec.width;
+  uint32_t height = JpegDec.height;
+  uint32_t mcuWidth = JpegDec.MCUWidth;
+  uint32_t mcuHeight = JpegDec.MCUHeight;
+
+  FSInfo fsInfo;
+  size_t rawSize = RAW_HEADER_SIZE + width * height * sizeof(uint16_t);
+  if (!SPIFFS.info(fsInfo) || fsInfo.totalBytes - fsInfo.usedBytes < rawSize + fsInfo.blockSize)
+  {
+    JpegDec.abort();
+    return false;
+  }
+
+  // One MCU row
+  size_t stripSize = width * mcuHeight * sizeof(uint16_t);
+  uint16_t *strip = NULL;
+  if (ESP.getFreeHeap() > stripSize + JPEG_STRIP_HEAP_RESERVE)
+    strip = (uint16_t *)malloc(stripSize);
+
+  fs::File file;
+  if (strip)
+    file = SPIFFS.open(rawName, "w");
+  if (!file)
+  {
+    free(strip);
+    JpegDec.abort();
+    return false;
+  }
+
+  //  TURBO mode
+  setTurbo(true);
+
+  uint32_t magic = RAW_MAGIC;
+  uint16_t header[2] = {(uint16_t)width, (uint16_t)height};
+  bool written = file.write((uint8_t *)&magic, sizeof(magic)) == sizeof(magic) &&
+                 file.write((uint8_t *)header, sizeof(header)) == sizeof(header);
+
+  while (written && JpegDec.readSwappedBytes())
+  {
+    uint32_t mcuX = JpegDec.MCUx * mcuWidth;
+    uint32_t mcuY = JpegDec.MCUy * mcuHeight;
+    uint32_t w = min(mcuWidth, width - mcuX);
+    uint32_t h = min(mcuHeight, height - mcuY);
+
+    for (uint32_t row = 0; row < h; row++)
+      memcpy(&strip[row * width + mcuX], &JpegDec.pImage[row * mcuWidth], w * sizeof(uint16_t));
+
+    // MCU row complete
+    if (mcuX + w == width)
+    {
+      size_t size = width * h * sizeof(uint16_t);
+      written = file.write((uint8_t *)strip, size) == size;
+    }
   }
+
+  //  NORMAL mode
+  setTurbo(false);
+
+  written = written && file.size() == rawSize;
+  file.close();
+  free(strip);
+
+  if (!written)
+  {
+    JpegDec.abort();
+    SPIFFS.remove(rawName);
+  }
+  return written;
+}
+
+bool GfxUi::drawRaw(fs::File &file, int xpos, int ypos, int clipX, int clipY, int clipWidth, int clipHeight)
+{
+  uint32_t magic = 0;
+  uint16_t header[2] = {0};
+
+  if (!file.seek(0, fs::SeekSet) ||
+      file.read((uint8_t *)&magic, sizeof(magic)) != sizeof(magic) || magic != RAW_MAGIC ||
+      file.read((uint8_t *)header, sizeof(header)) != sizeof(header))
+    return false;
+
+  // Part of the image inside the clip window (and on the screen)
+  int32_t left = xpos;
+  int32_t top = ypos;
+  int32_t right = xpos + header[0];
+  int32_t bottom = ypos + header[1];
+
+  if (left < clipX) left = clipX;
+  if (left < 0) left = 0;
+  if (top < clipY) top = clipY;
+  if (top < 0) top = 0;
+  if (right > clipX + clipWidth) right = clipX + clipWidth;
+  if (right > _tft->width()) right = _tft->width();
+  if (bottom > clipY + clipHeight) bottom = clipY + clipHeight;
+  if (bottom > _tft->height()) bottom = _tft->height();
+
+  if (left >= right || top >= bottom)
+    return true;
+
+  uint16_t pixels[BUFF_SIZE];
+
+  _tft->setWindow(left, top, right - 1, bottom - 1);
+
+  for (int32_t y = top; y < bottom; y++)
+  {
+    if (!file.seek(RAW_HEADER_SIZE + ((y - ypos) * header[0] + (left - xpos)) * sizeof(uint16_t), fs::SeekSet))
+      return false;
+
+    for (int32_t x = left; x < right; x += BUFF_SIZE)
+    {
+      size_t size = (right - x < BUFF_SIZE ? right - x : BUFF_SIZE) * sizeof(uint16_t);
+      if (file.read((uint8_t *)pixels, size) != size)
+        return false;
+      _tft->pushColors((uint8_t *)pixels, size);
+    }
+  }
+
+  return true;
 }
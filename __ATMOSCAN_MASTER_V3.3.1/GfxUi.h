@@ -34,6 +34,21 @@
 // A larger value of 80 is better for SD cards
 #define BUFFPIXEL 32
 
+// Heap left to the rest of the sketch when a JPEG strip buffer is taken
+#define JPEG_STRIP_HEAP_RESERVE 8192
+
+// Palette indexed, run length encoded frames transcoded from JPEGs (see jpegToFrame)
+#define FRAME_MAGIC 0x314D5246          // "FRM1"
+#define FRAME_HEADER_SIZE 12
+#define FRAME_MAX_COLORS 64
+
+// Raw RGB565 copies of JPEGs, drawn back by rectangles (see jpegToRaw)
+#define RAW_MAGIC 0x31574152            // "RAW1"
+#define RAW_HEADER_SIZE 8
+
+// Palette + RLE artwork in PROGMEM (see _TOOLS/bitmap_converter.py)
+#define PACKED_BITMAP_HEADER_SIZE 6
+
 class GfxUi
 {
   public:
@@ -47,11 +62,24 @@ class GfxUi
     int fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry, int w, unsigned int colour);
 
     void drawBitmap(const unsigned short * icon, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+    void drawPackedBitmap(const uint8_t * bitmap, uint16_t x, uint16_t y);
 
     // Draw from filesystem
     void drawJpeg(String filename, int xpos, int ypos);
     void renderJPEG(int xpos, int ypos);
 
+    // Same, only the part of the image inside the clip window is decoded and sent
+    void drawJpeg(String filename, int xpos, int ypos, int clipX, int clipY, int clipWidth, int clipHeight);
+    void renderJPEG(int xpos, int ypos, int clipX, int clipY, int clipWidth, int clipHeight);
+
+    // Decode a JPEG once into a frame file, then draw it with no decoding
+    bool jpegToFrame(String jpegName, String frameName);
+    bool drawFrame(String frameName, int xpos, int ypos);
+
+    // Decode a JPEG once into a raw file, then draw any part of it with no decoding
+    bool jpegToRaw(String jpegName, String rawName);
+    bool drawRaw(fs::File &file, int xpos, int ypos, int clipX, int clipY, int clipWidth, int clipHeight);
+
     // Additions
     int rightOffset(String text, String sub);
     int leftOffset(String text, String sub);
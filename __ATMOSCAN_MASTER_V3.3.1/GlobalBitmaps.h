@@ -19,1582 +19,1048 @@ const uint16_t splashHeight = 150;
 // Image Size     : 168x150 pixels
 // Memory usage   : 50400 bytes
 
-const unsigned short Splash_Screen[25200] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0010 (16) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0030 (48) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0040 (64) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0050 (80) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0060 (96) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0070 (112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0080 (128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0090 (144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00A0 (160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00B0 (176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00C0 (192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00D0 (208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00E0 (224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00F0 (240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0100 (256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0110 (272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0120 (288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0130 (304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0140 (320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0150 (336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0160 (352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0170 (368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0180 (384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0190 (400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01A0 (416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01B0 (432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01C0 (448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01D0 (464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01E0 (480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01F0 (496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0200 (512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0210 (528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0220 (544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0230 (560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0240 (576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0000, 0x0883, 0x08A4, 0x10C5, 0x10C5, 0x1107, 0x1107, 0x1107, 0x1107, 0x1107, 0x10C5,   // 0x0250 (592) pixels
-  0x08A4, 0x08A4, 0x0883, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0260 (608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0270 (624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0280 (640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0290 (656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02A0 (672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02B0 (688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02C0 (704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02D0 (720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02E0 (736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0883, 0x10E6, 0x1948, 0x21EC, 0x32B1, 0x4332, 0x53B4, 0x6C56, 0x6C56,   // 0x02F0 (752) pixels
-  0x84F9, 0x8519, 0x855A, 0x8519, 0x855A, 0x957A, 0x8519, 0x8519, 0x74D8, 0x7497, 0x6C56, 0x5B93, 0x4332, 0x32B1, 0x2A0C, 0x1948,   // 0x0300 (768) pixels
-  0x10E6, 0x0883, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0310 (784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0320 (800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0330 (816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0340 (832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0350 (848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0360 (864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0370 (880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0380 (896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x1107, 0x21CA, 0x326E, 0x5B93, 0x74D8,   // 0x0390 (912) pixels
-  0x855A, 0x9E1D, 0xB6BE, 0xC6DE, 0xB6BE, 0xB6BE, 0xC6DE, 0xB6BE, 0xCF1F, 0xB6BE, 0xB6BE, 0xCF1F, 0xC6DE, 0xB6BE, 0xB6BE, 0xA65E,   // 0x03A0 (928) pixels
-  0xA65E, 0x9E3E, 0x9E3E, 0x9E3E, 0xA65E, 0xA65E, 0xA65E, 0x9E1D, 0x855A, 0x6C99, 0x53B4, 0x3A8F, 0x21CA, 0x10E6, 0x08A4, 0x0000,   // 0x03B0 (944) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03C0 (960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03D0 (976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03E0 (992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03F0 (1008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0400 (1024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0410 (1040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0420 (1056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x08A4,   // 0x0430 (1072) pixels
-  0x1948, 0x326E, 0x53D6, 0x957A, 0xB65C, 0xB6BE, 0xB6BE, 0xAE9F, 0xA65E, 0xAE9F, 0xB6BE, 0xA65E, 0x9E3E, 0xA65E, 0x9E3E, 0x9E3E,   // 0x0440 (1088) pixels
-  0x85BE, 0x9E3E, 0xA65E, 0xAE9F, 0xA65E, 0x85BE, 0x7D9E, 0x6D1E, 0x64FE, 0x54BE, 0x4C9E, 0x54BE, 0x4C9E, 0x54BE, 0x54BE, 0x6D1E,   // 0x0450 (1104) pixels
-  0x755E, 0x85BE, 0x9E3E, 0xA63D, 0xA63D, 0x855A, 0x53B4, 0x3A8F, 0x1948, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0460 (1120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0470 (1136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0480 (1152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0490 (1168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04A0 (1184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04B0 (1200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04C0 (1216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04D0 (1232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x21CA, 0x4B31, 0x74D8, 0xA63D, 0xC6DE, 0xCF1F, 0xA65E, 0x85BE, 0x85BE, 0x7D9E, 0x85BE,   // 0x04E0 (1248) pixels
-  0x95FE, 0x85BE, 0x7D9E, 0x7D9E, 0x9E3E, 0x85BE, 0xA65E, 0xB6BE, 0xB65C, 0xB6BE, 0xA63D, 0x9DDC, 0xA65E, 0xA65E, 0x64FE, 0x5C9D,   // 0x04F0 (1264) pixels
-  0x443D, 0x443D, 0x443D, 0x443D, 0x443D, 0x443D, 0x443D, 0x4C7E, 0x4C7E, 0x4C7E, 0x54BE, 0x6D1E, 0x755E, 0x9E3E, 0xB6BE, 0xB6BE,   // 0x0500 (1280) pixels
-  0x9DDC, 0x74D8, 0x4332, 0x21CA, 0x10E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x10A2, 0x0000, 0x0000,   // 0x0510 (1296) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0520 (1312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0530 (1328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0540 (1344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0550 (1360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0560 (1376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0570 (1392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x1989, 0x32B1, 0x74D8, 0xA63D, 0xCF1F, 0xB6BE,   // 0x0580 (1408) pixels
-  0xA65E, 0x85BE, 0x8D9D, 0x7D3C, 0xA65E, 0x9E3E, 0x755E, 0x6D1E, 0x64FE, 0x64DD, 0x64FE, 0x95FE, 0xC6DE, 0xCF1F, 0xEF9F, 0xD73F,   // 0x0590 (1424) pixels
-  0xA63D, 0xA63D, 0x9DDC, 0xA63D, 0xB6BE, 0x9E1D, 0x74FC, 0x545A, 0x545A, 0x545A, 0x545A, 0x545A, 0x4C1B, 0x545A, 0x4C1B, 0x4C1B,   // 0x05A0 (1440) pixels
-  0x545C, 0x545C, 0x443D, 0x443D, 0x54BE, 0x54BE, 0x6D1E, 0x6D1E, 0x9E3E, 0xA65E, 0xB6BE, 0xA63D, 0x74D8, 0x32B1, 0x1989, 0x08A4,   // 0x05B0 (1456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05C0 (1472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05D0 (1488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05E0 (1504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05F0 (1520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0600 (1536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0610 (1552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107,   // 0x0620 (1568) pixels
-  0x2A0C, 0x6415, 0x9DDC, 0xB6BE, 0xB6BE, 0xA65E, 0x85BE, 0x85BE, 0x85BE, 0x857C, 0x64DD, 0x755E, 0x64DD, 0x5C9D, 0x545C, 0x5C9D,   // 0x0630 (1584) pixels
-  0x5C9D, 0x74FC, 0x9E3E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9F, 0xC6DE, 0x95FE, 0x74FA, 0x64BA, 0x5C18, 0x5C18,   // 0x0640 (1600) pixels
-  0x4C1B, 0x4C1B, 0x43D9, 0x43D9, 0x43D9, 0x43D9, 0x3356, 0x3378, 0x3356, 0x3378, 0x43D9, 0x43FA, 0x43FA, 0x443D, 0x443D, 0x443D,   // 0x0650 (1616) pixels
-  0x54BE, 0x6D1E, 0x85BE, 0x9E3E, 0xB6BE, 0xB6BE, 0x9DDC, 0x6415, 0x324D, 0x10C5, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0660 (1632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0670 (1648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0680 (1664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0690 (1680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06A0 (1696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06B0 (1712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06C0 (1728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x3A8F, 0x74D8, 0xA65E, 0xAE9F, 0xA65E, 0x85BE, 0x85BE, 0x6D1D, 0x7D3C, 0x7D3C,   // 0x06D0 (1744) pixels
-  0x64DD, 0x545C, 0x5C9D, 0x64DD, 0x64DD, 0x74FC, 0x857C, 0xA5FC, 0xC6DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06E0 (1760) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xD73F, 0xB67E, 0x9DBB, 0x6C56, 0x53F8, 0x4B96, 0x3356, 0x3356, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314,   // 0x06F0 (1776) pixels
-  0x4376, 0x4B96, 0x43D9, 0x43D9, 0x43D9, 0x43D9, 0x4C1B, 0x4C1B, 0x4C1B, 0x54BE, 0x64FE, 0x755E, 0x85BE, 0x9E3E, 0xAE9F, 0xB6BE,   // 0x0700 (1792) pixels
-  0xB67E, 0x74D8, 0x3A8F, 0x1107, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0710 (1808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0720 (1824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0730 (1840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0740 (1856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0750 (1872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0760 (1888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x1948, 0x42F0, 0x855A, 0xA65E, 0xA65E,   // 0x0770 (1904) pixels
-  0x95FE, 0x85BE, 0x755E, 0x755E, 0x755E, 0x64DD, 0x64FE, 0x64DD, 0x64DD, 0x64BA, 0x7D1B, 0x74FA, 0xB65C, 0xE75E, 0xFFFF, 0xFFFF,   // 0x0780 (1920) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC6BD, 0x957A, 0x855A, 0x6458, 0x4354,   // 0x0790 (1936) pixels
-  0x4376, 0x3314, 0x3314, 0x3314, 0x32F4, 0x32F4, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3356, 0x3314, 0x3356, 0x3B97,   // 0x07A0 (1952) pixels
-  0x43D9, 0x43FA, 0x545C, 0x5C9D, 0x6D1E, 0x755E, 0x7D9E, 0x8E1F, 0x9E3E, 0xB6BE, 0xA65E, 0x855A, 0x4332, 0x1107, 0x0042, 0x0000,   // 0x07B0 (1968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07C0 (1984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07D0 (2000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07E0 (2016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07F0 (2032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0800 (2048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0810 (2064) pixels
-  0x0000, 0x1107, 0x32B1, 0x7D19, 0xA65E, 0x9E3E, 0x85BE, 0x7D9E, 0x755E, 0x6D1E, 0x64FE, 0x64FE, 0x64DD, 0x64DD, 0x74FA, 0x855A,   // 0x0820 (2080) pixels
-  0xA5DA, 0xC6BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0830 (2096) pixels
-  0xFFFF, 0xEF9F, 0xC6BD, 0xB65C, 0xBE9D, 0x855A, 0x4B96, 0x3314, 0x32F4, 0x3314, 0x2AB2, 0x32F4, 0x2AB2, 0x3314, 0x2AF4, 0x32F4,   // 0x0840 (2112) pixels
-  0x2AF4, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3356, 0x3356, 0x3356, 0x3356, 0x3378, 0x43D9, 0x4C1B, 0x64DD, 0x6D1E, 0x755E,   // 0x0850 (2128) pixels
-  0x7D9E, 0x85BE, 0x9E3E, 0xAE9F, 0xA65E, 0x7D19, 0x3A8F, 0x1107, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0860 (2144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0870 (2160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0880 (2176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0890 (2192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08A0 (2208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08B0 (2224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x326E, 0x8519, 0xBE9D, 0x9E3E, 0x85BE, 0x755E, 0x755E, 0x64DD,   // 0x08C0 (2240) pixels
-  0x5C9D, 0x545C, 0x5C9D, 0x64DD, 0xA65E, 0xC6DE, 0xE75E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08D0 (2256) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75E, 0xC6DE, 0x9DBB, 0x74FA, 0x74D8, 0x74FA, 0x6458, 0x3314, 0x3314,   // 0x08E0 (2272) pixels
-  0x3314, 0x3314, 0x3314, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32F4, 0x32F4, 0x32F4, 0x3314, 0x3314, 0x3314, 0x3314, 0x3356, 0x3356,   // 0x08F0 (2288) pixels
-  0x3314, 0x3356, 0x3356, 0x3356, 0x3B97, 0x43D9, 0x545C, 0x64FE, 0x64DD, 0x857C, 0x7D9E, 0x85BE, 0x85BE, 0xA65E, 0xA63D, 0x84F9,   // 0x0900 (2304) pixels
-  0x324D, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0910 (2320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0920 (2336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0930 (2352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0940 (2368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0950 (2384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x21CA, 0x6415,   // 0x0960 (2400) pixels
-  0xA63D, 0xA65E, 0x857E, 0x755E, 0x6D1E, 0x54BE, 0x443D, 0x4C1B, 0x4C1B, 0x545A, 0x855A, 0xB65C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0970 (2416) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE9D, 0x9DDC, 0x855A,   // 0x0980 (2432) pixels
-  0x6458, 0x5C18, 0x5C18, 0x53F8, 0x53D6, 0x3314, 0x3314, 0x53D6, 0x53D6, 0x4B96, 0x4376, 0x3314, 0x32F4, 0x32F4, 0x3314, 0x3314,   // 0x0990 (2448) pixels
-  0x3314, 0x3314, 0x4376, 0x3356, 0x4B96, 0x4376, 0x4B96, 0x53D6, 0x43D9, 0x53D6, 0x4B96, 0x4B96, 0x4B96, 0x43D9, 0x43D9, 0x545C,   // 0x09A0 (2464) pixels
-  0x64FE, 0x64FE, 0x7D3C, 0x755E, 0x755E, 0x85BE, 0x85BE, 0xAE9F, 0xA65E, 0x6415, 0x21CA, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09B0 (2480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09C0 (2496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09D0 (2512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09E0 (2528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09F0 (2544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A00 (2560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10E6, 0x4B31, 0x9DBB, 0xB67E, 0x85BE, 0x755E, 0x54BE, 0x545C, 0x43FA, 0x43FA, 0x43D9, 0x43D9,   // 0x0A10 (2576) pixels
-  0x855A, 0xD73F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BC, 0xE75E,   // 0x0A20 (2592) pixels
-  0xB65C, 0xAD99, 0x9DBB, 0xAD99, 0x9DBB, 0x6458, 0x5C18, 0x5C18, 0x5C18, 0x5C18, 0x53F8, 0x3314, 0x3314, 0x4354, 0x4354, 0x53F8,   // 0x0A30 (2608) pixels
-  0x6458, 0x53D6, 0x5C17, 0x53F8, 0x53D6, 0x53D6, 0x53F8, 0x53F8, 0x5C18, 0x5C18, 0x5C18, 0x5C18, 0x5C18, 0x5C18, 0x5C18, 0x5C18,   // 0x0A40 (2624) pixels
-  0x545A, 0x74FA, 0xA65E, 0x857C, 0x64BA, 0x64BA, 0x647A, 0x64DD, 0x64DD, 0x64DD, 0x64FE, 0x6D1E, 0x64DD, 0x7D3C, 0x74FA, 0x857C,   // 0x0A50 (2640) pixels
-  0x85BE, 0xB6BE, 0xA5FC, 0x4B31, 0x1107, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A60 (2656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A70 (2672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A80 (2688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A90 (2704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AA0 (2720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x21CA, 0x6C56, 0xB6BE, 0xA65E, 0x755E,   // 0x0AB0 (2736) pixels
-  0x6D1D, 0x545C, 0x4C1B, 0x43D9, 0x3B99, 0x43D9, 0x647A, 0xB65C, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75E, 0xC6BD, 0xC6BD, 0xD6BC, 0xD73F,   // 0x0AC0 (2752) pixels
-  0xD6FE, 0xEF9F, 0xFFFF, 0xFFFF, 0xBE1A, 0x9558, 0x8CF6, 0x9536, 0x7D19, 0x6458, 0x6C56, 0x53D6, 0x53D6, 0x4B96, 0x4354, 0x4354,   // 0x0AD0 (2768) pixels
-  0x3314, 0x4354, 0x32D2, 0x3314, 0x32D2, 0x3314, 0x4354, 0x6458, 0x9558, 0xA5DA, 0x9DBB, 0xA5DA, 0x6458, 0x5C18, 0x5C18, 0x5C18,   // 0x0AE0 (2784) pixels
-  0x5C18, 0x6458, 0x6458, 0x7D1B, 0x74FA, 0x5C18, 0x5C18, 0x545A, 0x5C18, 0x6458, 0x5C18, 0x855A, 0x8D9D, 0x855A, 0x6C56, 0x6C56,   // 0x0AF0 (2800) pixels
-  0x647A, 0x64BA, 0x64BA, 0x64DD, 0x64BA, 0x64BA, 0x74FA, 0x74D8, 0x7D1B, 0x7D3C, 0xAE9F, 0xB6BE, 0x6C56, 0x21CA, 0x0042, 0x0000,   // 0x0B00 (2816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B10 (2832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B20 (2848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B30 (2864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B40 (2880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B50 (2896) pixels
-  0x0000, 0x10C5, 0x32B1, 0x9DDC, 0xA65E, 0x7D9E, 0x755E, 0x64DD, 0x4C1B, 0x43FA, 0x43D9, 0x3B99, 0x4B96, 0x6458, 0xB65C, 0xFFFF,   // 0x0B60 (2912) pixels
-  0xC6BD, 0xA5DA, 0x855A, 0x6458, 0x6458, 0x6458, 0x6458, 0x6458, 0x6458, 0x6C56, 0x74D8, 0x9558, 0x9558, 0x6415, 0x6C56, 0x53D6,   // 0x0B70 (2928) pixels
-  0x53D6, 0x4B96, 0x4B96, 0x3314, 0x3314, 0x3B13, 0x32D2, 0x32D2, 0x32D2, 0x2AB2, 0x3314, 0x32D2, 0x3314, 0x4354, 0x53D6, 0x6C56,   // 0x0B80 (2944) pixels
-  0x7497, 0x7497, 0x6C56, 0x6C56, 0x53D6, 0x5C18, 0x5C18, 0x5C17, 0x5C18, 0x53F8, 0x53D6, 0x6458, 0x5C18, 0x5C18, 0x5C18, 0x5C18,   // 0x0B90 (2960) pixels
-  0x6458, 0x6458, 0x545A, 0x5C18, 0x647A, 0x647A, 0x6458, 0x63D2, 0x7432, 0x63D2, 0x6C56, 0x64BA, 0x64BA, 0x6C56, 0x7456, 0x7456,   // 0x0BA0 (2976) pixels
-  0x74D8, 0x74D8, 0x7D1B, 0x9E3E, 0xB6BE, 0x9DBB, 0x32B1, 0x10C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BB0 (2992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BC0 (3008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BD0 (3024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BE0 (3040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BF0 (3056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1948, 0x6415, 0xA65E, 0x9E3E, 0x7D9E, 0x64DD, 0x64DD, 0x443D,   // 0x0C00 (3072) pixels
-  0x43D9, 0x3356, 0x4B96, 0x4B96, 0x53F8, 0x855A, 0x855A, 0x6458, 0x53D6, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x53F8, 0x5C18,   // 0x0C10 (3088) pixels
-  0x53D6, 0x53F8, 0x53D6, 0x53D6, 0x4B96, 0x53D6, 0x4B96, 0x4B96, 0x4376, 0x4B96, 0x4354, 0x4354, 0x3314, 0x3314, 0x32D2, 0x32D2,   // 0x0C20 (3104) pixels
-  0x32D2, 0x32D2, 0x32D2, 0x3B13, 0x4354, 0x3314, 0x4B96, 0x6458, 0x74D8, 0x53B4, 0x74D8, 0x53F8, 0x5C18, 0x5C18, 0x5C18, 0x5C18,   // 0x0C30 (3120) pixels
-  0x5C18, 0x53F8, 0x5C18, 0x5C18, 0x5C18, 0x53D6, 0x5C18, 0x5C18, 0x5C18, 0x5C18, 0x6458, 0x5C18, 0x545A, 0x6458, 0x53D6, 0x63F4,   // 0x0C40 (3136) pixels
-  0x63D0, 0x63D2, 0x63D0, 0x63D2, 0x63D2, 0x63D2, 0x7432, 0x7454, 0x6415, 0x6415, 0x7497, 0x74D8, 0x85BE, 0xB6BE, 0xB6BE, 0x63F4,   // 0x0C50 (3152) pixels
-  0x1948, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C60 (3168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C70 (3184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C80 (3200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C90 (3216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x21CA,   // 0x0CA0 (3232) pixels
-  0x74D8, 0xA65E, 0x9E3E, 0x7D9E, 0x64BA, 0x64BA, 0x4C1B, 0x3B99, 0x3356, 0x3356, 0x3356, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x3356,   // 0x0CB0 (3248) pixels
-  0x3356, 0x3314, 0x3314, 0x3314, 0x4354, 0x4B96, 0x53D6, 0x5C18, 0x5C17, 0x5C18, 0x53F8, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96,   // 0x0CC0 (3264) pixels
-  0x4376, 0x53D6, 0x4354, 0x3314, 0x4332, 0x32D2, 0x32F4, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x3314, 0x3314, 0x4354, 0x53D6, 0x53D6,   // 0x0CD0 (3280) pixels
-  0x53F8, 0x53F8, 0x53D6, 0x53D6, 0x53F8, 0x5C18, 0x5C17, 0x5C18, 0x53D6, 0x5C18, 0x53D6, 0x53F8, 0x5C17, 0x5C18, 0x53D6, 0x53D6,   // 0x0CE0 (3296) pixels
-  0x6458, 0x5C18, 0x5C18, 0x6458, 0x6458, 0x6458, 0x6C56, 0x5B93, 0x63D0, 0x63D0, 0x63D0, 0x63D2, 0x63D0, 0x63D2, 0x63D0, 0x63D0,   // 0x0CF0 (3312) pixels
-  0x63D2, 0x63D0, 0x6415, 0x7456, 0x74D8, 0x8D9D, 0xA65E, 0xB6BE, 0x74D8, 0x2A0C, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D00 (3328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D10 (3344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D20 (3360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D30 (3376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D40 (3392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x326E, 0x9DDC, 0xA65E, 0x9E3E, 0x7D9E, 0x6D1E, 0x5C9D, 0x43FA, 0x4B96, 0x4376,   // 0x0D50 (3408) pixels
-  0x3356, 0x3314, 0x3356, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x4354, 0x4354, 0x3314, 0x4354, 0x4B96, 0x5C18, 0x53D6, 0x5350,   // 0x0D60 (3424) pixels
-  0x5B93, 0x53D6, 0x53D6, 0x53D6, 0x4B96, 0x4354, 0x4354, 0x4354, 0x4354, 0x4354, 0x3314, 0x32D2, 0x32D2, 0x3314, 0x3B13, 0x32D2,   // 0x0D70 (3440) pixels
-  0x32D2, 0x32D2, 0x3B13, 0x3314, 0x4354, 0x4354, 0x53F8, 0x5C17, 0x53D6, 0x5C18, 0x53D6, 0x53F8, 0x53D6, 0x53D6, 0x53D6, 0x53F8,   // 0x0D80 (3456) pixels
-  0x53D6, 0x5C18, 0x53F8, 0x5C17, 0x5C18, 0x5C18, 0x6C56, 0x9558, 0xA5DA, 0x5C17, 0x5C18, 0x6458, 0x5C18, 0x5C18, 0x53D6, 0x63D0,   // 0x0D90 (3472) pixels
-  0x63D0, 0x63D0, 0x63D0, 0x63D0, 0x63D0, 0x63D0, 0x7432, 0x63D0, 0x63D2, 0x63D0, 0x63D0, 0x5B93, 0x6415, 0x74D8, 0x7D3C, 0x9E3E,   // 0x0DA0 (3488) pixels
-  0xB6BE, 0x9DBB, 0x326E, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DB0 (3504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DC0 (3520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DD0 (3536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DE0 (3552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x42F0, 0x9E1D, 0x9E3E,   // 0x0DF0 (3568) pixels
-  0x85BE, 0x64DD, 0x64DD, 0x64DD, 0x43FA, 0x3356, 0x3356, 0x3356, 0x3356, 0x3314, 0x3314, 0x4354, 0x4354, 0x3314, 0x4354, 0x4354,   // 0x0E00 (3584) pixels
-  0x4354, 0x4354, 0x4354, 0x4B96, 0x53F8, 0x53D6, 0x5350, 0x63D0, 0x5B90, 0x5B90, 0x53B4, 0x5C17, 0x4B96, 0x4354, 0x4354, 0x4354,   // 0x0E10 (3600) pixels
-  0x3314, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x3B13, 0x4354, 0x4354, 0x4B96, 0x53D6, 0x53D6, 0x53F8,   // 0x0E20 (3616) pixels
-  0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x5C18, 0x5C18, 0x53D6, 0x5C18, 0x53D6, 0x53F8, 0x53F8, 0x5C18, 0x53D6, 0xB65C, 0xB65C,   // 0x0E30 (3632) pixels
-  0x6C56, 0x5C18, 0x5C18, 0x5C18, 0x5C18, 0x5C18, 0x5C17, 0x5372, 0x63D0, 0x6B8E, 0x6B8E, 0x63D0, 0x6B8E, 0x63D0, 0x63D0, 0x63D0,   // 0x0E40 (3648) pixels
-  0x63D0, 0x63D0, 0x63D2, 0x63D0, 0x63D2, 0x63F4, 0x6C56, 0x74FA, 0x85BE, 0xAE9F, 0xA63D, 0x4B31, 0x08A4, 0x0000, 0x0000, 0x0000,   // 0x0E50 (3664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E60 (3680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E70 (3696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E80 (3712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E90 (3728) pixels
-  0x0000, 0x0000, 0x0000, 0x10E6, 0x53B4, 0xBE9D, 0x9E3E, 0x7D9E, 0x64BA, 0x64BA, 0x545A, 0x3B99, 0x3356, 0x3356, 0x3356, 0x4354,   // 0x0EA0 (3744) pixels
-  0x3356, 0x4376, 0x4376, 0x4376, 0x4376, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4354, 0x4B95, 0x53D6, 0x53B4, 0x5B8F, 0x8472,   // 0x0EB0 (3760) pixels
-  0x84B4, 0x6B8E, 0x5B93, 0x53D6, 0x4B96, 0x4354, 0x4354, 0x32D2, 0x32B1, 0x32B1, 0x32B1, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2,   // 0x0EC0 (3776) pixels
-  0x32D2, 0x3314, 0x3B13, 0x4354, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53F8,   // 0x0ED0 (3792) pixels
-  0x53D6, 0x53F8, 0x5C18, 0x53D6, 0x53F8, 0x63F6, 0xA5DA, 0x53D6, 0x5C17, 0x5C18, 0x6458, 0x5C18, 0x5C18, 0x53D6, 0x53D6, 0x5B93,   // 0x0EE0 (3808) pixels
-  0x6B8E, 0x73F0, 0x6B8E, 0x63D0, 0x534E, 0x534E, 0x63D0, 0x63D0, 0x63D0, 0x5350, 0x63D0, 0x63D0, 0x63D0, 0x5B93, 0x6C13, 0x5C15,   // 0x0EF0 (3824) pixels
-  0x6C99, 0x7D3C, 0x9E3E, 0xAE9F, 0x4354, 0x10C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F00 (3840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F10 (3856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F20 (3872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F30 (3888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x53B4, 0xB6BE, 0x9E3E, 0x85BE, 0x64DD,   // 0x0F40 (3904) pixels
-  0x64BA, 0x545A, 0x43D9, 0x3356, 0x3314, 0x4354, 0x3356, 0x4354, 0x4B96, 0x4376, 0x3314, 0x4354, 0x3314, 0x4354, 0x4354, 0x4354,   // 0x0F50 (3920) pixels
-  0x4354, 0x4354, 0x4B96, 0x4354, 0x4354, 0x4332, 0x5B93, 0x6415, 0x8CF6, 0x5B93, 0x53D6, 0x53D6, 0x53D6, 0x4354, 0x32D2, 0x32B1,   // 0x0F60 (3936) pixels
-  0x2A91, 0x2A91, 0x2AB2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x4354, 0x4354, 0x53D6, 0x53D6, 0x53D6,   // 0x0F70 (3952) pixels
-  0x53D6, 0x53D6, 0x53D6, 0x53F8, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x6415, 0x8474, 0x53B4,   // 0x0F80 (3968) pixels
-  0x53F8, 0x5C18, 0x5C18, 0x63F4, 0x63F4, 0x53B4, 0x53B4, 0x5350, 0x63D0, 0x636E, 0x636E, 0x636E, 0x636E, 0x534E, 0x6B8E, 0x63D0,   // 0x0F90 (3984) pixels
-  0x63D0, 0x534E, 0x5350, 0x63D0, 0x63D0, 0x63D0, 0x5B93, 0x63F4, 0x6C56, 0x6C99, 0x7D3C, 0x9E3E, 0xB6BE, 0x53B4, 0x1107, 0x0000,   // 0x0FA0 (4000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FB0 (4016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FC0 (4032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FD0 (4048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FE0 (4064) pixels
-  0x0000, 0x1107, 0x6C56, 0xB6BE, 0x85BE, 0x85BE, 0x6D1E, 0x6D1E, 0x4C1B, 0x3B99, 0x3314, 0x3314, 0x3356, 0x3314, 0x4376, 0x4354,   // 0x0FF0 (4080) pixels
-  0x4354, 0x4376, 0x3314, 0x4354, 0x4354, 0x4354, 0x4354, 0x3314, 0x4354, 0x3314, 0x3B13, 0x4354, 0x4354, 0x4354, 0x4354, 0x4354,   // 0x1000 (4096) pixels
-  0x53D6, 0x53D6, 0x4B96, 0x4354, 0x4354, 0x32D2, 0x32B1, 0x32B1, 0x32D2, 0x32D2, 0x3B13, 0x4B96, 0x4354, 0x4354, 0x32D2, 0x32D2,   // 0x1010 (4112) pixels
-  0x32D2, 0x32D2, 0x4354, 0x4354, 0x53B4, 0x53B4, 0x53D6, 0x4332, 0x5372, 0x53B4, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6,   // 0x1020 (4128) pixels
-  0x53F8, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x63F4, 0x63D2, 0x53D6, 0x5C17, 0x5C17, 0x5C17, 0x53D6, 0x63D0, 0x63D0, 0x63D2, 0x63D0,   // 0x1030 (4144) pixels
-  0x534E, 0x534E, 0x636E, 0x636E, 0x6B8E, 0x63D0, 0x63D0, 0x63D0, 0x6B8E, 0x63D0, 0x532C, 0x5350, 0x63D0, 0x63D0, 0x63D0, 0x5B90,   // 0x1040 (4160) pixels
-  0x5B93, 0x6415, 0x6C56, 0x6D1D, 0x7D9E, 0xAE9F, 0x6C56, 0x1107, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1050 (4176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1060 (4192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1070 (4208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1080 (4224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x6415, 0xB67E, 0x755E, 0x755E, 0x755E, 0x6D1E, 0x545C,   // 0x1090 (4240) pixels
-  0x4B96, 0x3314, 0x3314, 0x3314, 0x3314, 0x4354, 0x4354, 0x4354, 0x3314, 0x3314, 0x3314, 0x3314, 0x4354, 0x3314, 0x3314, 0x3B13,   // 0x10A0 (4256) pixels
-  0x3314, 0x3314, 0x3314, 0x3B13, 0x3314, 0x4354, 0x4354, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x3B13, 0x32B1, 0x32B1, 0x2A91, 0x32D2,   // 0x10B0 (4272) pixels
-  0x32D2, 0x3B13, 0x4354, 0x4354, 0x4B96, 0x53B4, 0x4376, 0x53D6, 0x53D6, 0x4354, 0x4B31, 0x42F0, 0x4B0F, 0x4ACC, 0x52EC, 0x532C,   // 0x10C0 (4288) pixels
-  0x4B0F, 0x534E, 0x5350, 0x53D6, 0x53F8, 0x53D6, 0x53F8, 0x53D6, 0x53D6, 0x53D6, 0x5C18, 0x53D6, 0x53D6, 0x5B93, 0x636E, 0x53B4,   // 0x10D0 (4304) pixels
-  0x53D6, 0x53F8, 0x5C18, 0x53D6, 0x5B93, 0x636E, 0x63D0, 0x63D0, 0x636E, 0x6B8E, 0x532C, 0x532C, 0x532C, 0x636E, 0x534E, 0x6B8E,   // 0x10E0 (4320) pixels
-  0x63D0, 0x63D0, 0x5350, 0x636E, 0x5B90, 0x5B90, 0x63D2, 0x5B90, 0x5B90, 0x6C13, 0x6415, 0x6C56, 0x64BA, 0x85BE, 0xAE9F, 0x6415,   // 0x10F0 (4336) pixels
-  0x1107, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1100 (4352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1110 (4368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1120 (4384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107,   // 0x1130 (4400) pixels
-  0x6C56, 0xB6BE, 0x755E, 0x6D1E, 0x755E, 0x6D1E, 0x64DD, 0x43D9, 0x3314, 0x3314, 0x32F4, 0x3314, 0x32D2, 0x3314, 0x3314, 0x3314,   // 0x1140 (4416) pixels
-  0x3314, 0x3314, 0x3B13, 0x32D2, 0x3314, 0x32D2, 0x3B13, 0x3314, 0x4354, 0x4354, 0x4354, 0x4354, 0x4354, 0x4354, 0x4B95, 0x53D6,   // 0x1150 (4432) pixels
-  0x53D6, 0x53D6, 0x4B95, 0x3314, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x4354, 0x4354, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6,   // 0x1160 (4448) pixels
-  0x4332, 0x42EE, 0x4ACC, 0x4B0D, 0x532C, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x42AA, 0x4B31, 0x53B4, 0x53D6, 0x53D6, 0x53D6,   // 0x1170 (4464) pixels
-  0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x5372, 0x5372, 0x53D6, 0x53D6, 0x53D6, 0x5C18, 0x53B4, 0x6B8E, 0x532C, 0x5B90,   // 0x1180 (4480) pixels
-  0x636E, 0x534E, 0x534E, 0x6B8E, 0x636E, 0x636E, 0x4ACC, 0x63D0, 0x534E, 0x534E, 0x6B8D, 0x534E, 0x6B8E, 0x5B90, 0x534E, 0x5B90,   // 0x1190 (4496) pixels
-  0x5B90, 0x5B93, 0x5B90, 0x53B4, 0x6C56, 0x74FA, 0x85BE, 0xB6BE, 0x6415, 0x1107, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11A0 (4512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11B0 (4528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11C0 (4544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11D0 (4560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x5B93, 0xB67E, 0x755E, 0x64FE, 0x5C9D, 0x4C1B, 0x545A, 0x43D9, 0x3314,   // 0x11E0 (4576) pixels
-  0x32F4, 0x32F4, 0x32D2, 0x32F4, 0x32D2, 0x32D2, 0x3314, 0x3314, 0x3314, 0x32D2, 0x3B13, 0x3314, 0x4354, 0x4354, 0x4B96, 0x4B96,   // 0x11F0 (4592) pixels
-  0x4B96, 0x4B96, 0x4B96, 0x4354, 0x53D6, 0x4B96, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x53D6, 0x4354, 0x4354, 0x3B13, 0x4332, 0x4332,   // 0x1200 (4608) pixels
-  0x4332, 0x4354, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x32B1, 0x534E, 0x532C, 0x532C, 0x52EC, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x1210 (4624) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x4ACC, 0x534E, 0x4332, 0x53B4, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6,   // 0x1220 (4640) pixels
-  0x53D6, 0x53B4, 0x5B93, 0x5350, 0x53B4, 0x5B93, 0x534E, 0x532C, 0x5350, 0x5350, 0x63D0, 0x534E, 0x532C, 0x532C, 0x532C, 0x52EC,   // 0x1230 (4656) pixels
-  0x532C, 0x534E, 0x636E, 0x534E, 0x534E, 0x534E, 0x5B90, 0x534E, 0x5B90, 0x5B8F, 0x5B90, 0x5B90, 0x5C15, 0x6C56, 0x74FA, 0x85BE,   // 0x1240 (4672) pixels
-  0xB6BE, 0x53B4, 0x10C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1250 (4688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1260 (4704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1270 (4720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x5372, 0xA65E,   // 0x1280 (4736) pixels
-  0x755E, 0x4C9E, 0x443D, 0x3378, 0x3356, 0x3314, 0x3314, 0x2AF4, 0x32F4, 0x2AF4, 0x32D2, 0x32D2, 0x32F4, 0x32D2, 0x32D2, 0x32D2,   // 0x1290 (4752) pixels
-  0x32D2, 0x3B13, 0x32D2, 0x4354, 0x4354, 0x4B96, 0x4B95, 0x4B96, 0x53D6, 0x4B95, 0x4B96, 0x4354, 0x4354, 0x4354, 0x4B96, 0x53D6,   // 0x12A0 (4768) pixels
-  0x53B4, 0x53D6, 0x4376, 0x4354, 0x4354, 0x4354, 0x4376, 0x4354, 0x4332, 0x4354, 0x53D6, 0x53D6, 0x53D6, 0x4332, 0x3A8F, 0x4ACC,   // 0x12B0 (4784) pixels
-  0x4ACC, 0x4ACC, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x4ACC, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x534E, 0x5B93,   // 0x12C0 (4800) pixels
-  0x53D6, 0x53D6, 0x53B4, 0x53B4, 0x53B4, 0x5B93, 0x5B93, 0x5350, 0x5350, 0x5350, 0x534E, 0x532C, 0x636D, 0x636D, 0x63D0, 0x532C,   // 0x12D0 (4816) pixels
-  0x534E, 0x63D0, 0x636E, 0x52EC, 0x532C, 0x532C, 0x534E, 0x52EC, 0x4ACC, 0x532C, 0x534E, 0x532C, 0x534E, 0x532C, 0x534E, 0x534E,   // 0x12E0 (4832) pixels
-  0x532C, 0x5B90, 0x5B90, 0x5B90, 0x5B90, 0x5B93, 0x6C56, 0x74FA, 0x95FE, 0xC6DE, 0x5372, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12F0 (4848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1300 (4864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1310 (4880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1320 (4896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x3A8F, 0xA65E, 0x755E, 0x54BE, 0x443D, 0x3378, 0x3356, 0x3356, 0x3314, 0x2AF4, 0x32F4,   // 0x1330 (4912) pixels
-  0x2AB2, 0x2AF4, 0x2AB2, 0x32D2, 0x3314, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x3314, 0x4354, 0x4B96, 0x53D6, 0x53D6,   // 0x1340 (4928) pixels
-  0x53D6, 0x53D6, 0x4354, 0x4354, 0x4354, 0x4354, 0x4B95, 0x53D6, 0x4354, 0x4B96, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6,   // 0x1350 (4944) pixels
-  0x53D6, 0x53D6, 0x53B4, 0x4B31, 0x42F0, 0x42AA, 0x42AA, 0x4ACC, 0x42AA, 0x42AA, 0x42AA, 0x426A, 0x426A, 0x42AA, 0x42AA, 0x42AA,   // 0x1360 (4960) pixels
-  0x426A, 0x42AA, 0x42AA, 0x426A, 0x42AA, 0x42AA, 0x52EC, 0x4ACC, 0x5350, 0x53D6, 0x534E, 0x5350, 0x53B4, 0x5372, 0x534E, 0x52EC,   // 0x1370 (4976) pixels
-  0x532C, 0x532C, 0x4B0D, 0x532C, 0x532C, 0x4ACC, 0x532C, 0x636E, 0x636E, 0x534E, 0x63D2, 0x534E, 0x532C, 0x532C, 0x532C, 0x534E,   // 0x1380 (4992) pixels
-  0x4ACC, 0x4ACC, 0x532C, 0x532C, 0x532C, 0x532C, 0x534E, 0x532C, 0x5B8F, 0x534E, 0x534E, 0x5B90, 0x5B90, 0x63D2, 0x6415, 0x6C56,   // 0x1390 (5008) pixels
-  0x64BA, 0x9E3E, 0xBE9D, 0x3A8F, 0x0883, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13A0 (5024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13B0 (5040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13C0 (5056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x326E, 0x9E1D, 0x85BE, 0x54BE,   // 0x13D0 (5072) pixels
-  0x443D, 0x3B99, 0x2B36, 0x3314, 0x2AF4, 0x2AF4, 0x2AF4, 0x2AB2, 0x32F4, 0x32D2, 0x32F4, 0x3314, 0x32D2, 0x32D2, 0x32D2, 0x32D2,   // 0x13E0 (5088) pixels
-  0x2AB2, 0x32D2, 0x3B13, 0x4354, 0x4B96, 0x53D6, 0x53D6, 0x4B96, 0x4B95, 0x4354, 0x4354, 0x4354, 0x4B96, 0x53D6, 0x53D6, 0x53D6,   // 0x13F0 (5104) pixels
-  0x53D6, 0x53D6, 0x53B4, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x53B4, 0x42EE, 0x42EE, 0x42AA, 0x4ACC, 0x42AA, 0x42AA, 0x4ACC, 0x42AA,   // 0x1400 (5120) pixels
-  0x42AA, 0x42AA, 0x426A, 0x42AA, 0x42EE, 0x42F0, 0x4ACC, 0x42AA, 0x426A, 0x42AA, 0x426A, 0x426A, 0x4ACC, 0x42EE, 0x4ACC, 0x4ACC,   // 0x1410 (5136) pixels
-  0x4B31, 0x53B4, 0x5350, 0x4B0F, 0x5350, 0x532C, 0x4ACC, 0x4ACC, 0x52EB, 0x52EB, 0x532C, 0x52EB, 0x532C, 0x636D, 0x636E, 0x4ACC,   // 0x1420 (5152) pixels
-  0x4ACC, 0x4ACC, 0x42EE, 0x532C, 0x636E, 0x532C, 0x532C, 0x4ACC, 0x532C, 0x532C, 0x4ACC, 0x532C, 0x534E, 0x532C, 0x532C, 0x534E,   // 0x1430 (5168) pixels
-  0x4B0F, 0x534E, 0x5B8F, 0x534E, 0x534E, 0x5B93, 0x6C13, 0x6415, 0x6C97, 0x7D1B, 0x9E3E, 0xA63D, 0x326E, 0x0000, 0x0000, 0x0000,   // 0x1440 (5184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1450 (5200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1460 (5216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1470 (5232) pixels
-  0x0000, 0x0000, 0x0000, 0x2189, 0x855A, 0x85BE, 0x54BE, 0x3C1C, 0x3B99, 0x3356, 0x2B15, 0x3314, 0x3314, 0x2AF4, 0x32F4, 0x32D2,   // 0x1480 (5248) pixels
-  0x2AB2, 0x32F4, 0x3314, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x2AB2, 0x32D2, 0x32D2, 0x4354, 0x4332, 0x4354, 0x32D2, 0x32D2, 0x32D2,   // 0x1490 (5264) pixels
-  0x32D2, 0x4332, 0x4354, 0x53D6, 0x53D6, 0x4354, 0x53B4, 0x53D6, 0x53B4, 0x53D6, 0x53B4, 0x53D6, 0x53D6, 0x53D6, 0x4332, 0x4ACC,   // 0x14A0 (5280) pixels
-  0x63D0, 0x6B8E, 0x532C, 0x4ACC, 0x4ACC, 0x42AA, 0x42AA, 0x426A, 0x42AA, 0x426A, 0x42AA, 0x42EE, 0x53B4, 0x4B31, 0x42AA, 0x426A,   // 0x14B0 (5296) pixels
-  0x42AA, 0x42AA, 0x426A, 0x426A, 0x42EE, 0x53B4, 0x4332, 0x5372, 0x534E, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x42AA, 0x42AA, 0x42AA,   // 0x14C0 (5312) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x4ACC, 0x52EC, 0x52EB, 0x532C, 0x52EC, 0x532C, 0x532C, 0x532C, 0x534E, 0x4ACC, 0x532C,   // 0x14D0 (5328) pixels
-  0x4ACC, 0x532C, 0x532C, 0x4ACC, 0x532C, 0x532C, 0x4B0D, 0x532C, 0x4B0F, 0x534E, 0x532C, 0x4B0F, 0x5350, 0x534E, 0x5350, 0x6C13,   // 0x14E0 (5344) pixels
-  0x6415, 0x6C97, 0x7D3C, 0xAE9F, 0x957A, 0x1989, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x14F0 (5360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1500 (5376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1510 (5392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x6C97, 0x85BE, 0x6D1E, 0x3C1C, 0x3BDA,   // 0x1520 (5408) pixels
-  0x3356, 0x2B36, 0x3314, 0x3314, 0x2AF4, 0x2AF4, 0x2AF4, 0x32F4, 0x32F4, 0x32F4, 0x32D2, 0x32D2, 0x2AB2, 0x2AB2, 0x32D2, 0x2A91,   // 0x1530 (5424) pixels
-  0x32B1, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x3B13, 0x32D2, 0x32D2, 0x4332, 0x4354, 0x53D6, 0x53D6, 0x4B31, 0x4B0F, 0x534E, 0x4332,   // 0x1540 (5440) pixels
-  0x53B4, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x3A8C, 0x532C, 0x532C, 0x52EC, 0x42AA, 0x530B, 0x42AA, 0x42AA, 0x426A, 0x426A,   // 0x1550 (5456) pixels
-  0x3A8C, 0x4B31, 0x42F0, 0x42F0, 0x4ACC, 0x42AA, 0x42AA, 0x426A, 0x426A, 0x42AA, 0x42AA, 0x42AA, 0x4ACC, 0x4332, 0x4B31, 0x5372,   // 0x1560 (5472) pixels
-  0x4ACC, 0x42AA, 0x42AA, 0x42AA, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x42AA, 0x52EC,   // 0x1570 (5488) pixels
-  0x42AA, 0x52EC, 0x530B, 0x532C, 0x532C, 0x4ACC, 0x532C, 0x532C, 0x532C, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4B0D,   // 0x1580 (5504) pixels
-  0x534E, 0x4B0D, 0x532C, 0x534E, 0x534E, 0x4B31, 0x5B8F, 0x63D2, 0x63D2, 0x5C15, 0x6C99, 0x8D9D, 0xAE9F, 0x6C56, 0x1107, 0x0000,   // 0x1590 (5520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15A0 (5536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15B0 (5552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15C0 (5568) pixels
-  0x0000, 0x08A4, 0x4332, 0x9E3E, 0x6D1E, 0x443D, 0x3BDA, 0x3378, 0x3356, 0x2B15, 0x2B15, 0x3314, 0x3314, 0x32D2, 0x3314, 0x32F4,   // 0x15D0 (5584) pixels
-  0x32D2, 0x3314, 0x3314, 0x2AB2, 0x32D2, 0x32D2, 0x32D2, 0x2AB2, 0x2270, 0x2270, 0x32D2, 0x3B13, 0x4354, 0x4354, 0x4354, 0x3314,   // 0x15E0 (5600) pixels
-  0x4B96, 0x53D6, 0x53D6, 0x4332, 0x532C, 0x4ACC, 0x4ACC, 0x53B4, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x4B31, 0x4ACC, 0x636E,   // 0x15F0 (5616) pixels
-  0x4ACC, 0x42AA, 0x42AA, 0x426A, 0x42AA, 0x42AA, 0x426A, 0x3A8C, 0x53B4, 0x53D6, 0x4B0F, 0x42AA, 0x426A, 0x3A6A, 0x3A69, 0x42AA,   // 0x1600 (5632) pixels
-  0x426A, 0x426A, 0x42AA, 0x42AA, 0x42AA, 0x4ACC, 0x4ACC, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x4269, 0x42AA, 0x42AA, 0x426A,   // 0x1610 (5648) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x52EB, 0x52EC, 0x52EB, 0x4ACC, 0x52EC, 0x4ACC, 0x532C, 0x4ACC, 0x4ACC,   // 0x1620 (5664) pixels
-  0x4ACC, 0x4ACC, 0x532C, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x534E, 0x532C, 0x4B0F, 0x532C, 0x532C, 0x534E, 0x5B93,   // 0x1630 (5680) pixels
-  0x63D0, 0x5C15, 0x6415, 0x6C99, 0x9E3E, 0xB6BE, 0x5372, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1640 (5696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1650 (5712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1660 (5728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x324D, 0x9E1D, 0x6D1E, 0x443D, 0x3BDA, 0x3378, 0x3356,   // 0x1670 (5744) pixels
-  0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x32F4, 0x3314, 0x32D2, 0x32D2, 0x2AB2, 0x2A91, 0x2270, 0x2270, 0x2270,   // 0x1680 (5760) pixels
-  0x2270, 0x2AB2, 0x4354, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x5372, 0x5350, 0x5372, 0x42EE, 0x4ACC, 0x4ACC, 0x5350, 0x53D6,   // 0x1690 (5776) pixels
-  0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x42EE, 0x4ACC, 0x42AA, 0x42AA, 0x426A, 0x426A, 0x426A, 0x426A, 0x3A69, 0x3A6A, 0x5372,   // 0x16A0 (5792) pixels
-  0x53D6, 0x53D6, 0x42EE, 0x42AA, 0x3A69, 0x3A6A, 0x3A6A, 0x3A69, 0x3A6A, 0x426A, 0x426A, 0x426A, 0x426A, 0x42AA, 0x4ACC, 0x42AA,   // 0x16B0 (5808) pixels
-  0x42AA, 0x42AA, 0x3A69, 0x426A, 0x42AA, 0x3A69, 0x426A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x16C0 (5824) pixels
-  0x42AA, 0x42AA, 0x52EB, 0x42AA, 0x532C, 0x52EB, 0x52EC, 0x52EC, 0x532C, 0x4ACC, 0x52EC, 0x4ACC, 0x532C, 0x4ACC, 0x4B0D, 0x4ACC,   // 0x16D0 (5840) pixels
-  0x4B0D, 0x4ACC, 0x4ACC, 0x4B0D, 0x4B0D, 0x4B0F, 0x534E, 0x534E, 0x5B93, 0x63D2, 0x53B4, 0x6C56, 0x74FC, 0x9E3E, 0x9E1D, 0x2A0C,   // 0x16E0 (5856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x16F0 (5872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1700 (5888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1710 (5904) pixels
-  0x1107, 0x855A, 0x85BE, 0x4C9E, 0x3BFC, 0x3378, 0x3356, 0x3356, 0x2B15, 0x2B15, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314,   // 0x1720 (5920) pixels
-  0x3314, 0x32D2, 0x2AB2, 0x2AB2, 0x2A91, 0x2A91, 0x2270, 0x2270, 0x2270, 0x32D2, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x4B31, 0x532C,   // 0x1730 (5936) pixels
-  0x4ACC, 0x4ACC, 0x4B31, 0x532C, 0x42AA, 0x5350, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x4B0F, 0x42AA, 0x42AA,   // 0x1740 (5952) pixels
-  0x3A8C, 0x3A6A, 0x3A6A, 0x3A69, 0x3A6A, 0x426A, 0x42AA, 0x42F0, 0x5372, 0x4B31, 0x42AA, 0x42AA, 0x3A6A, 0x3A6A, 0x3A6A, 0x3A6A,   // 0x1750 (5968) pixels
-  0x3A6A, 0x3A6A, 0x42AA, 0x3A6A, 0x3A6A, 0x426A, 0x42AA, 0x42AA, 0x426A, 0x42AA, 0x42AA, 0x4269, 0x3A69, 0x3A6A, 0x42AA, 0x426A,   // 0x1760 (5984) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x4ACC, 0x42AA, 0x42AA, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC,   // 0x1770 (6000) pixels
-  0x52EB, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4B0D, 0x4ACC, 0x4B0F, 0x532C, 0x4B31,   // 0x1780 (6016) pixels
-  0x5B90, 0x5B93, 0x6C13, 0x6415, 0x6C97, 0x7D3C, 0xAE9F, 0x855A, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1790 (6032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x17A0 (6048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x17B0 (6064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x53B4, 0xA65E, 0x54BE, 0x3C1C, 0x3B99, 0x3356, 0x3356, 0x2AF4,   // 0x17C0 (6080) pixels
-  0x32F4, 0x32F4, 0x3314, 0x3314, 0x3314, 0x3314, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x2270, 0x2270, 0x2A91, 0x2270, 0x2270, 0x2270,   // 0x17D0 (6096) pixels
-  0x2AB2, 0x4354, 0x4354, 0x4B95, 0x53D6, 0x5B93, 0x4ACC, 0x42AA, 0x532C, 0x5350, 0x5B93, 0x534E, 0x4ACC, 0x5B93, 0x53D6, 0x53D6,   // 0x17E0 (6112) pixels
-  0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x4332, 0x53B4, 0x5374, 0x42AA, 0x3A6A, 0x3A6A, 0x42AA, 0x42AA, 0x42AA, 0x3A6A,   // 0x17F0 (6128) pixels
-  0x32B1, 0x3A8A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A6A, 0x3A6A, 0x3A6A, 0x2A0A, 0x3A6A, 0x3A6A, 0x3A6A, 0x3A6A, 0x3A6A, 0x42AA,   // 0x1800 (6144) pixels
-  0x42AA, 0x4269, 0x42AA, 0x42AA, 0x4269, 0x4269, 0x42AA, 0x3A6A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A6A, 0x42AA, 0x42AA,   // 0x1810 (6160) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x52EB, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x52EC, 0x52EC, 0x532C, 0x4ACC, 0x52EB, 0x4ACC, 0x4B0D, 0x4ACC,   // 0x1820 (6176) pixels
-  0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4B0D, 0x4ACC, 0x532C, 0x4B0F, 0x534E, 0x53B4, 0x63D2, 0x63D2, 0x6C97, 0x7D1B, 0x85BE, 0xAE9F,   // 0x1830 (6192) pixels
-  0x53B4, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1840 (6208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1850 (6224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x324D,   // 0x1860 (6240) pixels
-  0xB6BE, 0x755E, 0x443D, 0x3BDA, 0x3378, 0x3356, 0x3314, 0x2AF4, 0x3314, 0x3314, 0x3314, 0x3314, 0x4354, 0x3B13, 0x3314, 0x32D2,   // 0x1870 (6256) pixels
-  0x32D2, 0x2270, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x32D2, 0x4354, 0x53D6, 0x4332, 0x532C, 0x532C, 0x4B0D,   // 0x1880 (6272) pixels
-  0x5372, 0x53B4, 0x53B4, 0x532C, 0x532C, 0x53B4, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x4B31, 0x4B31,   // 0x1890 (6288) pixels
-  0x4B31, 0x3A6A, 0x426A, 0x3A6A, 0x3A6A, 0x42AA, 0x3A8F, 0x42F0, 0x5374, 0x4332, 0x42F0, 0x42EE, 0x3A8F, 0x3A8F, 0x42EE, 0x4ACC,   // 0x18A0 (6304) pixels
-  0x3A6A, 0x3A6A, 0x3A6A, 0x3A69, 0x3A6A, 0x3A6A, 0x426A, 0x42AA, 0x3A69, 0x42AA, 0x3A6A, 0x3A69, 0x42AA, 0x42AA, 0x42AA, 0x3A69,   // 0x18B0 (6320) pixels
-  0x3A6A, 0x3A69, 0x3A6A, 0x42AA, 0x42AA, 0x3A6A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x52EC, 0x42AA, 0x52EB, 0x42AA, 0x52EB, 0x52EB,   // 0x18C0 (6336) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x532C, 0x4ACC, 0x532C, 0x532C, 0x4B0D, 0x42AA, 0x4ACC, 0x4ACC, 0x4ACC, 0x532C, 0x532C, 0x42EE, 0x532C,   // 0x18D0 (6352) pixels
-  0x532C, 0x5350, 0x5B93, 0x7432, 0x6415, 0x8519, 0x7D3C, 0x9E3E, 0xB6BE, 0x3A8F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18E0 (6368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18F0 (6384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1900 (6400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x84F9, 0x95FE, 0x4C7E, 0x3BDA, 0x3B99, 0x3378, 0x3356, 0x2AF4, 0x3314,   // 0x1910 (6416) pixels
-  0x3314, 0x3356, 0x4354, 0x3314, 0x3314, 0x3B13, 0x32D2, 0x32D2, 0x2AB2, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x222F, 0x2270,   // 0x1920 (6432) pixels
-  0x32D2, 0x4354, 0x4B95, 0x53D6, 0x53B4, 0x5B93, 0x5B93, 0x5B93, 0x53B4, 0x4B0D, 0x532C, 0x4ACC, 0x532C, 0x53D6, 0x53D6, 0x53D6,   // 0x1930 (6448) pixels
-  0x53D6, 0x53B4, 0x53D6, 0x53B4, 0x5B93, 0x532C, 0x532C, 0x5372, 0x4B31, 0x3A6A, 0x3A6A, 0x3A6A, 0x42AA, 0x5374, 0x53B4, 0x53B4,   // 0x1940 (6464) pixels
-  0x53D6, 0x4B31, 0x42EE, 0x4ACC, 0x4ACC, 0x42EE, 0x42F0, 0x42AA, 0x4ACC, 0x3A6A, 0x42AA, 0x4269, 0x42AA, 0x42AA, 0x426A, 0x42AA,   // 0x1950 (6480) pixels
-  0x42AA, 0x3A69, 0x42AA, 0x3A89, 0x3A69, 0x3A6A, 0x3A69, 0x3A6A, 0x3A69, 0x3A6A, 0x42AA, 0x3A6A, 0x3A69, 0x4269, 0x3A6A, 0x42AA,   // 0x1960 (6496) pixels
-  0x42AA, 0x52EB, 0x52EB, 0x4ACC, 0x52EC, 0x42AA, 0x4ACC, 0x42AA, 0x4ACC, 0x52EB, 0x4ACC, 0x4ACC, 0x52EB, 0x4ACC, 0x42AA, 0x42AA,   // 0x1970 (6512) pixels
-  0x42AA, 0x42AA, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x532C, 0x534E, 0x534E, 0x5B93, 0x63D0, 0x6C13, 0x8519, 0x9DBB, 0x8D9D,   // 0x1980 (6528) pixels
-  0xB6BE, 0x8519, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1990 (6544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x19A0 (6560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x4332, 0xA65E,   // 0x19B0 (6576) pixels
-  0x6D1E, 0x443D, 0x3B99, 0x3B99, 0x3356, 0x3314, 0x3314, 0x3314, 0x4376, 0x3356, 0x4354, 0x3314, 0x32D2, 0x32D2, 0x32D2, 0x2AB2,   // 0x19C0 (6592) pixels
-  0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x222F, 0x2270, 0x2270, 0x3314, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x5374,   // 0x19D0 (6608) pixels
-  0x532C, 0x532C, 0x530B, 0x532C, 0x534E, 0x53B4, 0x53D6, 0x53D6, 0x63F6, 0x53D6, 0x53B4, 0x53B4, 0x534E, 0x4ACC, 0x42EE, 0x4B31,   // 0x19E0 (6624) pixels
-  0x4B0F, 0x42AA, 0x3A6A, 0x3A6A, 0x42EE, 0x4332, 0x4B31, 0x53D6, 0x53B4, 0x42F0, 0x4B31, 0x4ACC, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x19F0 (6640) pixels
-  0x426A, 0x42AA, 0x42AA, 0x426A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A6A, 0x3A89, 0x42AA, 0x42AA, 0x42AA, 0x4289,   // 0x1A00 (6656) pixels
-  0x3A8A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A6A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x52EB, 0x52EB, 0x42AA, 0x52EB, 0x42AA,   // 0x1A10 (6672) pixels
-  0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x4ACC, 0x532C, 0x42AA, 0x4B0D, 0x4B0F, 0x4ACC, 0x4B0D, 0x4ACC, 0x532C,   // 0x1A20 (6688) pixels
-  0x534E, 0x534E, 0x5B90, 0x5B93, 0x5B90, 0x6415, 0x957A, 0x857C, 0x9E3E, 0xB6BE, 0x4332, 0x0883, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A30 (6704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A40 (6720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A50 (6736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21CA, 0x9DDC, 0x85BE, 0x4C7E, 0x3BDA, 0x3B99, 0x3356, 0x3356, 0x3356, 0x3356, 0x4B96,   // 0x1A60 (6752) pixels
-  0x4B96, 0x4354, 0x4354, 0x3314, 0x32D2, 0x32D2, 0x2AB2, 0x2A91, 0x2270, 0x2270, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,   // 0x1A70 (6768) pixels
-  0x32B1, 0x53B4, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x5350, 0x532C, 0x530B, 0x530B, 0x52EB, 0x534E, 0x53B4, 0x53D6, 0x53D6,   // 0x1A80 (6784) pixels
-  0x63F6, 0x53B4, 0x53D6, 0x53B4, 0x532C, 0x42AA, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x42EE, 0x42EE, 0x53B4, 0x53B4, 0x53B4, 0x53B4,   // 0x1A90 (6800) pixels
-  0x42EE, 0x4B0F, 0x5372, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A6A, 0x42AA, 0x426A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x1AA0 (6816) pixels
-  0x42AA, 0x3A6A, 0x4289, 0x3A6A, 0x3A69, 0x3A69, 0x3A69, 0x3A89, 0x3A69, 0x3A6A, 0x42AA, 0x3A6A, 0x3A69, 0x42AA, 0x3A69, 0x3A6A,   // 0x1AB0 (6832) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x4ACC, 0x52EB, 0x42AA, 0x42AA, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x4ACC, 0x4B0D,   // 0x1AC0 (6848) pixels
-  0x4ACC, 0x532C, 0x4B0D, 0x532C, 0x4ACC, 0x4ACC, 0x534E, 0x534E, 0x534E, 0x5350, 0x534E, 0x5B93, 0x63D0, 0x5B90, 0x8CF6, 0xA5DA,   // 0x1AD0 (6864) pixels
-  0x85BE, 0xC6DE, 0xA63D, 0x2189, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1AE0 (6880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1AF0 (6896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x53B4, 0xA65E, 0x64FE,   // 0x1B00 (6912) pixels
-  0x443D, 0x43D9, 0x3B99, 0x3B97, 0x4B96, 0x4B96, 0x4B96, 0x43D9, 0x4376, 0x3314, 0x3314, 0x32D2, 0x32D2, 0x32D2, 0x2A91, 0x2A91,   // 0x1B10 (6928) pixels
-  0x222F, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x222F, 0x222F, 0x4354, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x5372, 0x4B31,   // 0x1B20 (6944) pixels
-  0x532C, 0x532C, 0x42AA, 0x532C, 0x5350, 0x53D6, 0x53D6, 0x5B93, 0x534E, 0x534E, 0x5350, 0x534E, 0x4ACC, 0x4ACC, 0x42F0, 0x4B31,   // 0x1B30 (6960) pixels
-  0x53B4, 0x4332, 0x53D6, 0x53B4, 0x53D6, 0x53D6, 0x53D6, 0x42EE, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x1B40 (6976) pixels
-  0x42AA, 0x42AA, 0x3A6A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x4269, 0x4289, 0x42AA, 0x3A6A, 0x3A69, 0x3A89, 0x42AA, 0x42AA, 0x42AA,   // 0x1B50 (6992) pixels
-  0x42AA, 0x42AA, 0x4289, 0x42AA, 0x42AA, 0x3A89, 0x3A6A, 0x3A6A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x52EC, 0x52EC,   // 0x1B60 (7008) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x52EB, 0x4B0D, 0x42AA, 0x4ACC, 0x530B, 0x4ACC, 0x532C, 0x42AA, 0x4ACC, 0x532C, 0x532C, 0x4ACC, 0x532C,   // 0x1B70 (7024) pixels
-  0x5B8F, 0x63D0, 0x63D0, 0x5B90, 0x6C13, 0x5B93, 0x7454, 0x9558, 0x9DDC, 0xA65E, 0xCF1F, 0x63F4, 0x08A4, 0x0000, 0x0000, 0x0000,   // 0x1B80 (7040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B90 (7056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2,   // 0x1BA0 (7072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x21CA, 0x9DDC, 0x755E, 0x54BE, 0x43FA, 0x43D9, 0x43D9, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96,   // 0x1BB0 (7088) pixels
-  0x4B96, 0x4354, 0x32F4, 0x32D2, 0x32D2, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x222F, 0x2270, 0x2270, 0x2270,   // 0x1BC0 (7104) pixels
-  0x2270, 0x32D2, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x53D6, 0x5350, 0x532C, 0x5350, 0x53B4, 0x53B4, 0x5350, 0x532C,   // 0x1BD0 (7120) pixels
-  0x42AA, 0x52EB, 0x42AA, 0x42AA, 0x4B0D, 0x4ACC, 0x532C, 0x4ACC, 0x4332, 0x53B4, 0x53B4, 0x5B93, 0x53B4, 0x53D6, 0x5372, 0x532C,   // 0x1BE0 (7136) pixels
-  0x42AA, 0x532C, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A6A, 0x4289, 0x4289, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x1BF0 (7152) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x3A6A, 0x3A6A, 0x42AA, 0x3A69, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A8A,   // 0x1C00 (7168) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x530B, 0x532C, 0x42AA, 0x532C, 0x532C, 0x532C, 0x532C,   // 0x1C10 (7184) pixels
-  0x42AA, 0x532C, 0x532C, 0x42AA, 0x532C, 0x532C, 0x4ACC, 0x4ACC, 0x532C, 0x63D0, 0x5350, 0x5B8F, 0x63D0, 0x63D0, 0x7432, 0x9558,   // 0x1C20 (7200) pixels
-  0x957A, 0xA65E, 0xB6BE, 0xB65C, 0x2A0C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C30 (7216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C40 (7232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x5C17, 0x95FE, 0x64FE, 0x443D,   // 0x1C50 (7248) pixels
-  0x43D9, 0x3356, 0x3314, 0x4376, 0x3314, 0x3314, 0x4B96, 0x4376, 0x4354, 0x3314, 0x32D2, 0x2AB2, 0x32D2, 0x2270, 0x2270, 0x2A91,   // 0x1C60 (7264) pixels
-  0x2A91, 0x222F, 0x222F, 0x2270, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x3270, 0x53B4, 0x53D6, 0x5372, 0x5372, 0x53B4, 0x5372,   // 0x1C70 (7280) pixels
-  0x53B4, 0x53B4, 0x5B93, 0x534E, 0x534E, 0x534E, 0x52EB, 0x42AA, 0x530B, 0x530B, 0x4ACC, 0x42AA, 0x532C, 0x42AA, 0x42AA, 0x4ACC,   // 0x1C80 (7296) pixels
-  0x4ACC, 0x4ACC, 0x42EE, 0x4ACC, 0x4B0F, 0x4B0F, 0x4B0D, 0x42AA, 0x4ACC, 0x530B, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A6A, 0x42AA,   // 0x1C90 (7312) pixels
-  0x4289, 0x3A89, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x532C,   // 0x1CA0 (7328) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x52EB, 0x42AA, 0x532C, 0x530B, 0x530B,   // 0x1CB0 (7344) pixels
-  0x532C, 0x530B, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x42AA, 0x4ACC, 0x4ACC, 0x42AA, 0x532C,   // 0x1CC0 (7360) pixels
-  0x532C, 0x534E, 0x63D0, 0x63D0, 0x63D0, 0x7432, 0x84B4, 0xA578, 0xB5FB, 0xA5FC, 0xB6BE, 0xCF1F, 0x6C56, 0x08A4, 0x0000, 0x0000,   // 0x1CD0 (7376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1CE0 (7392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1CF0 (7408) pixels
-  0x0000, 0x0000, 0x0000, 0x2A0C, 0x9DDC, 0x755E, 0x54BE, 0x43FA, 0x3B99, 0x3356, 0x3356, 0x4354, 0x4354, 0x3314, 0x4354, 0x4354,   // 0x1D00 (7424) pixels
-  0x4354, 0x32D2, 0x32D2, 0x2270, 0x32B1, 0x2A91, 0x222F, 0x2270, 0x222F, 0x222F, 0x222F, 0x222F, 0x2270, 0x2270, 0x2270, 0x2270,   // 0x1D10 (7440) pixels
-  0x222F, 0x222F, 0x4332, 0x53D6, 0x5350, 0x532C, 0x4B31, 0x532C, 0x4B31, 0x532C, 0x532C, 0x532C, 0x532C, 0x530B, 0x530B, 0x532C,   // 0x1D20 (7456) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x4ACC, 0x42AA, 0x42AA, 0x530B,   // 0x1D30 (7472) pixels
-  0x42AA, 0x42AA, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A8A, 0x42AA, 0x3A8A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x1D40 (7488) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x42AA, 0x42AA, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x1D50 (7504) pixels
-  0x3A8A, 0x42AA, 0x532C, 0x532C, 0x52EB, 0x532C, 0x4B0D, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x6B8E, 0x6B8E, 0x636E, 0x6B8E,   // 0x1D60 (7520) pixels
-  0x532C, 0x532C, 0x532C, 0x532C, 0x42AA, 0x42AA, 0x4ACC, 0x534E, 0x6B8E, 0x534E, 0x63D0, 0x8472, 0x7432, 0x8472, 0x9536, 0xAD99,   // 0x1D70 (7536) pixels
-  0xB5FB, 0xC65C, 0xA65E, 0xB6BE, 0xB65C, 0x21CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D80 (7552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D90 (7568) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x6415, 0x95FE, 0x64FE, 0x443D, 0x43D9,   // 0x1DA0 (7584) pixels
-  0x3356, 0x4354, 0x3314, 0x3356, 0x3314, 0x3314, 0x32D2, 0x3314, 0x3314, 0x2AB2, 0x2270, 0x2270, 0x2270, 0x222F, 0x222F, 0x222F,   // 0x1DB0 (7600) pixels
-  0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x2270, 0x32B1, 0x53D6, 0x5B93, 0x4ACC, 0x530B, 0x530B,   // 0x1DC0 (7616) pixels
-  0x530B, 0x532C, 0x532C, 0x530B, 0x532C, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x532C, 0x530B, 0x42AA, 0x42AA,   // 0x1DD0 (7632) pixels
-  0x42AA, 0x42AA, 0x532C, 0x532C, 0x530B, 0x42AA, 0x42AA, 0x530B, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x1DE0 (7648) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x42AA, 0x532C, 0x52EB,   // 0x1DF0 (7664) pixels
-  0x532C, 0x532C, 0x530B, 0x532C, 0x530B, 0x532C, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C,   // 0x1E00 (7680) pixels
-  0x636D, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8D, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x532C, 0x534E, 0x532C, 0x532C, 0x42AA, 0x534E, 0x6B8E,   // 0x1E10 (7696) pixels
-  0x7C11, 0x8472, 0x73F0, 0x7432, 0x7432, 0x8472, 0x9D15, 0xAD99, 0xC65A, 0xD6BC, 0xC6DE, 0x9E3E, 0xCF1F, 0x6415, 0x08A4, 0x0000,   // 0x1E20 (7712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E30 (7728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E40 (7744) pixels
-  0x0000, 0x0000, 0x21CA, 0x9E1D, 0x755E, 0x4C9E, 0x3BDA, 0x3B99, 0x3356, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x32D2, 0x4354,   // 0x1E50 (7760) pixels
-  0x32D2, 0x2AB2, 0x2270, 0x222F, 0x222F, 0x222F, 0x1A0E, 0x222F, 0x2A0C, 0x1A0E, 0x2270, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F,   // 0x1E60 (7776) pixels
-  0x222F, 0x222F, 0x2A91, 0x53D6, 0x4B96, 0x534E, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x42AA, 0x42AA, 0x52EB,   // 0x1E70 (7792) pixels
-  0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x532C, 0x532C, 0x532C, 0x530B, 0x530B, 0x532C, 0x530B,   // 0x1E80 (7808) pixels
-  0x42AA, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x42AA, 0x42AA, 0x4289, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x42AA,   // 0x1E90 (7824) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x530B, 0x42AA, 0x530B, 0x530B, 0x530B, 0x530B, 0x532C, 0x530B, 0x532C, 0x42AA, 0x42AA,   // 0x1EA0 (7840) pixels
-  0x42AA, 0x42AA, 0x532C, 0x532C, 0x532C, 0x636D, 0x532C, 0x6B8E, 0x6B8E, 0x532C, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E,   // 0x1EB0 (7856) pixels
-  0x73CF, 0x6B8E, 0x6B8E, 0x532C, 0x532C, 0x42AA, 0x532C, 0x6B8E, 0x8472, 0x9CF4, 0x9CB2, 0x8472, 0x7C11, 0x7432, 0x9CF4, 0xB5D8,   // 0x1EC0 (7872) pixels
-  0xC65A, 0xD6BC, 0xD6FE, 0xA65E, 0xAE9F, 0xA63D, 0x21CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1ED0 (7888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EE0 (7904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x5B93, 0xB6BE, 0x54BE, 0x4C7E, 0x43FA, 0x3356,   // 0x1EF0 (7920) pixels
-  0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x32D2, 0x2AB2, 0x32D2, 0x32D2, 0x2270, 0x2270, 0x222F, 0x222F, 0x222F, 0x222F, 0x1A0E,   // 0x1F00 (7936) pixels
-  0x222F, 0x222F, 0x32D2, 0x32D2, 0x32D2, 0x53B4, 0x32D2, 0x222F, 0x222F, 0x222F, 0x222F, 0x53D6, 0x53B4, 0x534E, 0x532C, 0x532C,   // 0x1F10 (7952) pixels
-  0x530B, 0x530B, 0x532C, 0x532C, 0x530B, 0x532C, 0x530B, 0x42AA, 0x530B, 0x532C, 0x530B, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x1F20 (7968) pixels
-  0x530B, 0x52EB, 0x530B, 0x530B, 0x532C, 0x52EB, 0x532C, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x42AA, 0x42AA, 0x42AA, 0x42AA,   // 0x1F30 (7984) pixels
-  0x530B, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x42AA, 0x532C, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x532C, 0x42AA, 0x530B,   // 0x1F40 (8000) pixels
-  0x42AA, 0x42AA, 0x52EB, 0x52EB, 0x532C, 0x532C, 0x532C, 0x4289, 0x4289, 0x530B, 0x532C, 0x636D, 0x6B8E, 0x636D, 0x6B8E, 0x6B8E,   // 0x1F50 (8016) pixels
-  0x532C, 0x6B8E, 0x6B8D, 0x73CF, 0x73CF, 0x73F0, 0x73F0, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8D, 0x534E, 0x532C, 0x532C, 0x532C, 0x73F0,   // 0x1F60 (8032) pixels
-  0x8C92, 0x9CF4, 0xB575, 0x9CF4, 0x8472, 0x84B4, 0x8472, 0xB575, 0xD658, 0xD6BC, 0xD6FE, 0xA65E, 0x9E3E, 0xC6DE, 0x53B4, 0x0042,   // 0x1F70 (8048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F80 (8064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F90 (8080) pixels
-  0x0000, 0x1948, 0x9DBB, 0x85BE, 0x4C7E, 0x3BDA, 0x3356, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x2A91, 0x2AB2, 0x2A91, 0x2A91,   // 0x1FA0 (8096) pixels
-  0x2A91, 0x2270, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x1A0E, 0x222F, 0x32D2, 0x4332, 0x4332, 0x4B0F, 0x4B31, 0x32D2,   // 0x1FB0 (8112) pixels
-  0x2270, 0x2270, 0x32B1, 0x53D6, 0x53B4, 0x636D, 0x636D, 0x530B, 0x532C, 0x530B, 0x42AA, 0x530B, 0x530B, 0x42AA, 0x42AA, 0x42AA,   // 0x1FC0 (8128) pixels
-  0x42AA, 0x530B, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x530B, 0x42AA, 0x532C, 0x42AA, 0x530B, 0x532C, 0x42AA, 0x530B, 0x532C, 0x42AA,   // 0x1FD0 (8144) pixels
-  0x42AA, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x530B, 0x530B, 0x530B,   // 0x1FE0 (8160) pixels
-  0x52EB, 0x42AA, 0x52EB, 0x530B, 0x52EB, 0x42AA, 0x42AA, 0x52EC, 0x52EB, 0x532C, 0x532C, 0x532C, 0x532C, 0x530B, 0x532C, 0x4289,   // 0x1FF0 (8176) pixels
-  0x42AA, 0x532C, 0x532C, 0x636E, 0x6B8D, 0x6B8E, 0x6B8E, 0x6B8D, 0x6B8E, 0x636D, 0x6B8E, 0x6B8E, 0x6B8E, 0x73F0, 0x73F0, 0x83F0,   // 0x2000 (8192) pixels
-  0x73F0, 0x63D0, 0x63D0, 0x636D, 0x42AA, 0x532C, 0x636E, 0x7C11, 0x9CF4, 0xB575, 0xCDD5, 0xB5D8, 0xB575, 0xB575, 0xB575, 0xBE1A,   // 0x2010 (8208) pixels
-  0xC65A, 0xCE9B, 0xD6BC, 0xC65C, 0x95FE, 0xC6DE, 0x9DBB, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2020 (8224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2030 (8240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B31, 0xAE9F, 0x54BE, 0x443D, 0x3378, 0x3356, 0x32F4,   // 0x2040 (8256) pixels
-  0x32F4, 0x32D2, 0x3314, 0x2AB2, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x222F, 0x222F, 0x1A0E, 0x222F, 0x1A0E, 0x1A0E, 0x222F,   // 0x2050 (8272) pixels
-  0x222F, 0x2A91, 0x32D2, 0x4332, 0x4ACC, 0x42AA, 0x42AA, 0x5350, 0x4332, 0x2A91, 0x3B13, 0x4354, 0x534E, 0x636D, 0x532C, 0x42AA,   // 0x2060 (8288) pixels
-  0x530B, 0x530B, 0x42AA, 0x532C, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x52EB, 0x530B, 0x52EB, 0x42AA, 0x42AA, 0x52EB, 0x42AA,   // 0x2070 (8304) pixels
-  0x42AA, 0x52EB, 0x52EB, 0x530B, 0x532C, 0x530B, 0x532C, 0x530B, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x530B,   // 0x2080 (8320) pixels
-  0x530B, 0x42AA, 0x42AA, 0x532C, 0x52EB, 0x530B, 0x52EB, 0x530B, 0x530B, 0x42AA, 0x52EB, 0x52EB, 0x532C, 0x42AA, 0x42AA, 0x530B,   // 0x2090 (8336) pixels
-  0x52EB, 0x52EB, 0x532C, 0x52EB, 0x532C, 0x636D, 0x532C, 0x42AA, 0x42AA, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E,   // 0x20A0 (8352) pixels
-  0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x73CF, 0x73F0, 0x73F0, 0x8450, 0x8450, 0x8450, 0x73F0, 0x73CF, 0x534E, 0x532C, 0x636D, 0x63D0,   // 0x20B0 (8368) pixels
-  0x8450, 0x84B4, 0xB575, 0xB575, 0xAD99, 0xB575, 0xCE38, 0xCE38, 0xCE38, 0xB5FB, 0xC6BD, 0xBE1A, 0x9DDC, 0xAE9F, 0xB6BE, 0x42F0,   // 0x20C0 (8384) pixels
-  0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA2, 0x0000, 0x0000,   // 0x20D0 (8400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20E0 (8416) pixels
-  0x08A4, 0x74D8, 0xA65E, 0x4C7E, 0x3BDA, 0x3356, 0x2AF4, 0x2AB2, 0x2AF4, 0x3314, 0x3314, 0x2A91, 0x2270, 0x2270, 0x2270, 0x222F,   // 0x20F0 (8432) pixels
-  0x222F, 0x222F, 0x2270, 0x1A0E, 0x222F, 0x222F, 0x2270, 0x222F, 0x222F, 0x222F, 0x32D2, 0x5350, 0x4ACC, 0x4ACC, 0x532C, 0x532C,   // 0x2100 (8448) pixels
-  0x4B0F, 0x4332, 0x53B4, 0x4B31, 0x532C, 0x532C, 0x42AA, 0x42AA, 0x530B, 0x530B, 0x530B, 0x42AA, 0x42AA, 0x530B, 0x42AA, 0x42AA,   // 0x2110 (8464) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x532C, 0x52EB, 0x42AA, 0x42AA, 0x52EB, 0x530B, 0x42AA, 0x42AA, 0x530B,   // 0x2120 (8480) pixels
-  0x530B, 0x530B, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x52EB, 0x530B, 0x530B, 0x530B, 0x530B, 0x532C, 0x530B, 0x530B, 0x52EB, 0x42AA,   // 0x2130 (8496) pixels
-  0x52EC, 0x52EB, 0x52EC, 0x52EB, 0x52EB, 0x52EB, 0x530B, 0x532C, 0x530B, 0x52EC, 0x636D, 0x636D, 0x532C, 0x6B8E, 0x532C, 0x532C,   // 0x2140 (8512) pixels
-  0x42AA, 0x6B8D, 0x6B8E, 0x6B8E, 0x6B8E, 0x73CF, 0x6B8E, 0x8450, 0x73CF, 0x73F0, 0x73CF, 0x8C2E, 0x73CF, 0x73CF, 0x73CF, 0x73CF,   // 0x2150 (8528) pixels
-  0x83F0, 0x8450, 0x8450, 0x8450, 0x6B8E, 0x6B8E, 0x6B8E, 0x73CF, 0x7C11, 0x73CF, 0x9CF4, 0xB575, 0xAD99, 0xB575, 0xB575, 0xB5D8,   // 0x2160 (8544) pixels
-  0xCE38, 0xAD99, 0xD6BC, 0xB5FB, 0x9DDC, 0x9E3E, 0xCF1F, 0x6C97, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2170 (8560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x18A0, 0x93A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2180 (8576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21CA, 0xB6BE, 0x6D1E, 0x443D, 0x3378, 0x2B36, 0x3314, 0x2AB2,   // 0x2190 (8592) pixels
-  0x2AF4, 0x3314, 0x32D2, 0x2270, 0x222F, 0x2270, 0x222F, 0x222F, 0x222F, 0x1A0E, 0x222F, 0x2270, 0x1A0E, 0x222F, 0x2270, 0x222F,   // 0x21A0 (8608) pixels
-  0x222F, 0x32D2, 0x5B93, 0x4ACC, 0x636D, 0x532C, 0x73CF, 0x73CF, 0x532C, 0x4ACC, 0x5350, 0x4ACC, 0x530B, 0x636D, 0x530B, 0x530B,   // 0x21B0 (8624) pixels
-  0x42AA, 0x4B0D, 0x530B, 0x42AA, 0x530B, 0x636D, 0x532C, 0x532C, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x532C,   // 0x21C0 (8640) pixels
-  0x42AA, 0x42AA, 0x4289, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x530B, 0x532C, 0x530B, 0x530B, 0x52EB, 0x530B, 0x42AA, 0x42AA, 0x530B,   // 0x21D0 (8656) pixels
-  0x530B, 0x532C, 0x530B, 0x530B, 0x530B, 0x532C, 0x532C, 0x530B, 0x52EC, 0x52EB, 0x52EB, 0x42AA, 0x532C, 0x530B, 0x636D, 0x636D,   // 0x21E0 (8672) pixels
-  0x636D, 0x6B8D, 0x6B8E, 0x6B8E, 0x636D, 0x6B8D, 0x6B8D, 0x6B8E, 0x532C, 0x6B8E, 0x73CF, 0x73CF, 0x83F0, 0x8C2E, 0x73CF, 0x73F0,   // 0x21F0 (8688) pixels
-  0x8450, 0x83F0, 0x73F0, 0x83F0, 0x73F0, 0x63D0, 0x73F0, 0x73CF, 0x73CF, 0x7C11, 0x8450, 0x8450, 0x73F0, 0x7C11, 0x8472, 0x9CF4,   // 0x2200 (8704) pixels
-  0xB575, 0xB575, 0x9CB2, 0x9CF4, 0xB575, 0xB575, 0xB575, 0xB5D8, 0xB5D8, 0xB5D8, 0xC65C, 0xB5FB, 0xA5DA, 0x8D9D, 0xB6BE, 0xA65E,   // 0x2210 (8720) pixels
-  0x21CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000,   // 0x2220 (8736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042,   // 0x2230 (8752) pixels
-  0x4B31, 0xC6DE, 0x54BE, 0x3BDA, 0x3356, 0x2AF4, 0x2AF4, 0x2AF4, 0x2AF4, 0x2AB2, 0x2A91, 0x222F, 0x2270, 0x2270, 0x222F, 0x2270,   // 0x2240 (8768) pixels
-  0x222F, 0x2270, 0x2270, 0x2270, 0x32B1, 0x2270, 0x222F, 0x2270, 0x32D2, 0x5372, 0x42EE, 0x52EC, 0x6B8E, 0x7C0F, 0x8C2E, 0x73CF,   // 0x2250 (8784) pixels
-  0x636D, 0x636E, 0x42AA, 0x530B, 0x6B8D, 0x6B8E, 0x530B, 0x42AA, 0x52EB, 0x52EB, 0x530B, 0x636D, 0x532C, 0x42AA, 0x42AA, 0x532C,   // 0x2260 (8800) pixels
-  0x532C, 0x530B, 0x532C, 0x42AA, 0x4289, 0x4289, 0x532C, 0x532C, 0x532C, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x4289, 0x42AA, 0x530B,   // 0x2270 (8816) pixels
-  0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x532C, 0x530B, 0x42AA, 0x530B, 0x530B, 0x532C, 0x532C, 0x530B,   // 0x2280 (8832) pixels
-  0x532C, 0x532C, 0x532C, 0x6B6B, 0x532C, 0x532C, 0x636D, 0x532C, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E,   // 0x2290 (8848) pixels
-  0x6B8E, 0x73CF, 0x73CF, 0x83EF, 0x8450, 0x8C2E, 0x8450, 0x83F0, 0x8450, 0x8450, 0x8450, 0x8450, 0x8450, 0x73CF, 0x6B8E, 0x73CF,   // 0x22A0 (8864) pixels
-  0x73F0, 0x73F0, 0x8450, 0x7C11, 0x8450, 0x8450, 0x8472, 0x73CF, 0x8C92, 0xB575, 0xB575, 0xB575, 0xB575, 0x8CF6, 0x9536, 0xB575,   // 0x22B0 (8880) pixels
-  0xB575, 0xAD99, 0xD69B, 0xC65A, 0xA5DA, 0x857C, 0xA65E, 0xCF1F, 0x4332, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22C0 (8896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22D0 (8912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10C5, 0x8519, 0x9E3E, 0x443D, 0x2B36, 0x3314, 0x2AF4, 0x2AF4, 0x2AB2,   // 0x22E0 (8928) pixels
-  0x32F4, 0x2AB2, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2A91, 0x2A91, 0x2A91, 0x32D2, 0x32B1, 0x222F, 0x222F, 0x2270,   // 0x22F0 (8944) pixels
-  0x5372, 0x534E, 0x530B, 0x532C, 0x636D, 0x73F0, 0x6B8E, 0x73CF, 0x636D, 0x8450, 0x6B8D, 0x530B, 0x42AA, 0x532C, 0x530B, 0x532C,   // 0x2300 (8960) pixels
-  0x636D, 0x532C, 0x636D, 0x532C, 0x532C, 0x636D, 0x530B, 0x52EB, 0x42AA, 0x42AA, 0x42AA, 0x4289, 0x4289, 0x42AA, 0x532C, 0x530B,   // 0x2310 (8976) pixels
-  0x532C, 0x530B, 0x530B, 0x530B, 0x532C, 0x42AA, 0x4289, 0x42AA, 0x532C, 0x530B, 0x530B, 0x532C, 0x532C, 0x532C, 0x52EB, 0x52EB,   // 0x2320 (8992) pixels
-  0x530B, 0x532C, 0x530B, 0x532C, 0x52EB, 0x530B, 0x52EB, 0x532C, 0x52EB, 0x52EB, 0x52EC, 0x532C, 0x636D, 0x636D, 0x6B8E, 0x6B8E,   // 0x2330 (9008) pixels
-  0x6B8E, 0x6B8E, 0x6B8D, 0x73CF, 0x73CF, 0x73CF, 0x73CF, 0x73CD, 0x73CF, 0x73CF, 0x6B8E, 0x8450, 0x73CF, 0x8450, 0x8450, 0x8450,   // 0x2340 (9024) pixels
-  0x8450, 0x8450, 0x8450, 0x8450, 0x8450, 0x8450, 0x73F0, 0x8450, 0x8450, 0x8450, 0x8472, 0x8450, 0x8450, 0x73F0, 0x73CF, 0x73F0,   // 0x2350 (9040) pixels
-  0x9CF4, 0xCE38, 0xCE38, 0xB575, 0x9CF4, 0x84B4, 0xB575, 0xB575, 0xAD99, 0xC65A, 0xD69B, 0xD6BC, 0xB65C, 0x9DBB, 0x85BE, 0xB6BE,   // 0x2360 (9056) pixels
-  0x855A, 0x10E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xC4C5, 0x0000, 0x0000,   // 0x2370 (9072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x20E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21CA,   // 0x2380 (9088) pixels
-  0xA63D, 0x755E, 0x3BFC, 0x2B36, 0x2AF4, 0x2AF4, 0x2AB2, 0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2, 0x2270, 0x2270, 0x2270, 0x2A91, 0x2270,   // 0x2390 (9104) pixels
-  0x32D2, 0x32D2, 0x32D2, 0x222F, 0x222F, 0x222F, 0x222F, 0x32B1, 0x4332, 0x532C, 0x6B8E, 0x6B8E, 0x532C, 0x73CD, 0x73CF, 0x6B8E,   // 0x23A0 (9120) pixels
-  0x73CF, 0x9491, 0x73CF, 0x636D, 0x52EB, 0x532C, 0x5350, 0x5350, 0x532C, 0x532C, 0x636D, 0x4ACC, 0x42AA, 0x52EB, 0x6B8E, 0x6B6B,   // 0x23B0 (9136) pixels
-  0x532C, 0x5350, 0x42AA, 0x42AA, 0x42AA, 0x52EB, 0x532C, 0x532C, 0x532C, 0x532C, 0x6B6B, 0x532C, 0x530B, 0x530B, 0x4289, 0x4289,   // 0x23C0 (9152) pixels
-  0x42AA, 0x532C, 0x6B6B, 0x532C, 0x530B, 0x532C, 0x532C, 0x530B, 0x42AA, 0x530B, 0x530B, 0x530B, 0x532C, 0x530B, 0x530B, 0x530B,   // 0x23D0 (9168) pixels
-  0x532C, 0x532C, 0x532C, 0x6B8E, 0x6B8E, 0x6B8E, 0x73CF, 0x73CF, 0x83EF, 0x73CF, 0x73CF, 0x73CF, 0x73CF, 0x83EF, 0x8450, 0x83F0,   // 0x23E0 (9184) pixels
-  0x73CF, 0x8450, 0x8450, 0x8450, 0x8450, 0x9CB2, 0x9471, 0x9471, 0x9CB2, 0x8450, 0x8450, 0x8450, 0x9471, 0x8450, 0x9471, 0x8450,   // 0x23F0 (9200) pixels
-  0x8472, 0x9CB2, 0x8472, 0x9471, 0x9CB2, 0x8450, 0x7C11, 0x9CB2, 0x9CB2, 0xB575, 0xD616, 0xB575, 0xB575, 0x9536, 0x9CF4, 0xAD99,   // 0x2400 (9216) pixels
-  0xC65A, 0xCE38, 0xD69B, 0xD69B, 0xB5FB, 0xA5DA, 0x855A, 0x9E3E, 0xBE9D, 0x21CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2410 (9232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xDD46,   // 0x2420 (9248) pixels
-  0x5A22, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4332, 0xB6BE, 0x54BE, 0x3B99, 0x2B15, 0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2,   // 0x2430 (9264) pixels
-  0x2A91, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2AB2, 0x32D2, 0x2AB2, 0x2A91, 0x32B1, 0x2270, 0x222F, 0x222F, 0x32B1, 0x2A91, 0x4332,   // 0x2440 (9280) pixels
-  0x534E, 0x6B8D, 0x6B8E, 0x6B8D, 0x636D, 0x8450, 0x9471, 0x73CF, 0x73CF, 0x8450, 0x73CF, 0x636D, 0x52EC, 0x4ACC, 0x3B13, 0x4332,   // 0x2450 (9296) pixels
-  0x32B1, 0x4ACC, 0x3A8F, 0x42EE, 0x32B1, 0x4ACC, 0x52EB, 0x636D, 0x5B90, 0x5B93, 0x4ACC, 0x4289, 0x42AA, 0x42AA, 0x530B, 0x532C,   // 0x2460 (9312) pixels
-  0x636D, 0x532C, 0x532C, 0x532C, 0x52EB, 0x530B, 0x42AA, 0x4269, 0x42AA, 0x532C, 0x532C, 0x530B, 0x4ACC, 0x530B, 0x52EB, 0x532C,   // 0x2470 (9328) pixels
-  0x532C, 0x530B, 0x532C, 0x42AA, 0x52EB, 0x530B, 0x530B, 0x532C, 0x530B, 0x636D, 0x636D, 0x6B8D, 0x6B8E, 0x6B8D, 0x73CF, 0x73CF,   // 0x2480 (9344) pixels
-  0x8C2E, 0x83EF, 0x73CF, 0x8C2E, 0x7C0F, 0x83EF, 0x8450, 0x8450, 0x8450, 0x8450, 0x8C2E, 0x8450, 0x9491, 0x9491, 0x9CB2, 0x9CB2,   // 0x2490 (9360) pixels
-  0x9CB2, 0x9471, 0x8472, 0x9491, 0x9CB2, 0x9471, 0x9CB2, 0x8472, 0x9CB2, 0x9CB2, 0x8C92, 0x8472, 0x7432, 0x7432, 0x6B8E, 0x7C11,   // 0x24A0 (9376) pixels
-  0x8C92, 0x9CF4, 0x9D15, 0x9D15, 0x9CF4, 0xB575, 0xB5D8, 0xB5D8, 0xCE38, 0xC65A, 0xCE38, 0xD69B, 0xBE1A, 0x9DBB, 0x7D1B, 0x85BE,   // 0x24B0 (9392) pixels
-  0xCF1F, 0x4B31, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xC4C5, 0x0000, 0x0000,   // 0x24C0 (9408) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B63, 0xEDA6, 0xEDA6, 0xEDA6, 0x8B63, 0x1060, 0x0000, 0x0000, 0x0000, 0x08A4, 0x74D8,   // 0x24D0 (9424) pixels
-  0xB6BE, 0x4C9E, 0x2B36, 0x2AF4, 0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x2AB2, 0x32D2,   // 0x24E0 (9440) pixels
-  0x2A91, 0x2A91, 0x2A91, 0x32B1, 0x2270, 0x222F, 0x2270, 0x4332, 0x534E, 0x534E, 0x636D, 0x6B8E, 0x6B8E, 0x9471, 0x9471, 0x636D,   // 0x24F0 (9456) pixels
-  0x636E, 0x6B8E, 0x5350, 0x42F0, 0x42F0, 0x42F0, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32D2, 0x4354, 0x5350, 0x42AA, 0x532C,   // 0x2500 (9472) pixels
-  0x5350, 0x53B4, 0x326E, 0x42AA, 0x4289, 0x42AA, 0x530B, 0x532C, 0x532C, 0x532C, 0x532C, 0x530B, 0x4289, 0x530B, 0x42AA, 0x42AA,   // 0x2510 (9488) pixels
-  0x42AA, 0x532C, 0x530B, 0x532C, 0x530B, 0x636D, 0x52EB, 0x530B, 0x532C, 0x52EB, 0x532C, 0x532C, 0x6B6B, 0x532C, 0x532C, 0x636D,   // 0x2520 (9504) pixels
-  0x532C, 0x636D, 0x6B8D, 0x6B8E, 0x73CF, 0x6B8E, 0x73CF, 0x8450, 0x8450, 0x9471, 0x8C2E, 0x8450, 0x8450, 0x8450, 0x9471, 0x8450,   // 0x2530 (9520) pixels
-  0x8450, 0x9491, 0x8450, 0x9491, 0x9CB2, 0x9CB2, 0xAD33, 0xB575, 0x9CB2, 0x9CB2, 0x9471, 0x9CB2, 0x9CB2, 0x9CB2, 0x9CB2, 0x9491,   // 0x2540 (9536) pixels
-  0x9CB2, 0x9CF4, 0xB575, 0xB575, 0x9CB2, 0x7C0F, 0x73CF, 0x8C92, 0xB575, 0x8472, 0x8C92, 0x8472, 0x9CB2, 0xB575, 0xB5FB, 0xCE38,   // 0x2550 (9552) pixels
-  0xB5D8, 0xC65A, 0xCE38, 0xD6BC, 0xD69B, 0xA5DA, 0x7497, 0x8D9D, 0xB6BE, 0x6C97, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2560 (9568) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC4C5, 0xEDA6, 0xEDA6,   // 0x2570 (9584) pixels
-  0xEDA6, 0xEDA6, 0x6AA2, 0x0000, 0x0000, 0x0000, 0x1948, 0xB65C, 0x85BE, 0x3C1C, 0x2B36, 0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2,   // 0x2580 (9600) pixels
-  0x2A91, 0x2AB2, 0x2270, 0x2A91, 0x2A91, 0x2A91, 0x2270, 0x2A91, 0x2A91, 0x2270, 0x2270, 0x222F, 0x2270, 0x2270, 0x32B1, 0x4332,   // 0x2590 (9616) pixels
-  0x5372, 0x6B8E, 0x73CD, 0x6B8E, 0x636D, 0x73CF, 0x9471, 0x73CF, 0x5B90, 0x4332, 0x4332, 0x4332, 0x32D2, 0x32D2, 0x32D2, 0x32B1,   // 0x25A0 (9632) pixels
-  0x32B1, 0x32B1, 0x32D2, 0x42EE, 0x4332, 0x4B0F, 0x530B, 0x52EB, 0x6B8E, 0x53B4, 0x4B31, 0x530B, 0x42AA, 0x4289, 0x52EB, 0x52EB,   // 0x25B0 (9648) pixels
-  0x636D, 0x530B, 0x532C, 0x4289, 0x42AA, 0x530B, 0x530B, 0x42AA, 0x42AA, 0x530B, 0x636D, 0x530B, 0x530B, 0x532C, 0x636D, 0x636D,   // 0x25C0 (9664) pixels
-  0x532C, 0x532C, 0x532C, 0x532C, 0x52EC, 0x532C, 0x532C, 0x530B, 0x532C, 0x6B6B, 0x636D, 0x6B8E, 0x73CF, 0x73CF, 0x73CF, 0x8450,   // 0x25D0 (9680) pixels
-  0x8450, 0x9471, 0x9471, 0x9491, 0x9471, 0x9491, 0x9491, 0x9CB2, 0x9CB2, 0x9CB2, 0x9CB2, 0x9CB2, 0x9CB2, 0xB575, 0xB575, 0xB575,   // 0x25E0 (9696) pixels
-  0xAD33, 0xA4D2, 0x9CB2, 0x9CB2, 0x9CB2, 0xA4D2, 0x9CB2, 0x9CB2, 0x9CB2, 0x8C92, 0xB575, 0xB575, 0x9CB2, 0x73CF, 0x7C11, 0x7C11,   // 0x25F0 (9712) pixels
-  0x7C11, 0x7C11, 0x8450, 0x8472, 0xB575, 0xB575, 0xB5D8, 0xB5D8, 0xCE38, 0xB5FB, 0xB575, 0xAD99, 0xB5D8, 0xA5DA, 0x8519, 0x855A,   // 0x2600 (9728) pixels
-  0xA65E, 0xA5FC, 0x2189, 0x0000, 0x6AA2, 0x8B63, 0x18A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xC4C5, 0x0000, 0x0000,   // 0x2610 (9744) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x0000, 0x0000, 0x0000, 0x324D, 0xB6BE,   // 0x2620 (9760) pixels
-  0x755E, 0x3BDA, 0x2B15, 0x2AF4, 0x2AB2, 0x2AB2, 0x2A91, 0x2A91, 0x2AB2, 0x2A91, 0x2A91, 0x2AB2, 0x2270, 0x2270, 0x2A91, 0x2A91,   // 0x2630 (9776) pixels
-  0x2270, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x32D2, 0x4354, 0x53B4, 0x63D0, 0x7C11, 0x8450, 0x8C2E, 0x6B8E, 0x8450, 0x73CF,   // 0x2640 (9792) pixels
-  0x5372, 0x4354, 0x4354, 0x4332, 0x4354, 0x32B1, 0x32B1, 0x32D2, 0x32B1, 0x32B1, 0x32D2, 0x42EE, 0x4354, 0x5350, 0x532C, 0x530B,   // 0x2650 (9808) pixels
-  0x534E, 0x53B4, 0x4354, 0x532C, 0x532C, 0x42AA, 0x4289, 0x42AA, 0x532C, 0x532C, 0x42AA, 0x42AA, 0x4289, 0x42AA, 0x42AA, 0x42AA,   // 0x2660 (9824) pixels
-  0x42AA, 0x6B8D, 0x6B8D, 0x532C, 0x532C, 0x5350, 0x52EC, 0x636E, 0x532C, 0x636D, 0x532C, 0x534E, 0x5350, 0x63D0, 0x532C, 0x532C,   // 0x2670 (9840) pixels
-  0x636D, 0x636D, 0x636E, 0x73CF, 0x73CD, 0x73CF, 0x83EF, 0x73CF, 0x8450, 0x8450, 0x9491, 0xA4D2, 0x9CB2, 0x9CB2, 0xA4D2, 0x9CB2,   // 0x2680 (9856) pixels
-  0x9CB2, 0x9CB2, 0xA4D2, 0xA4D2, 0x9CB2, 0xB575, 0xB575, 0xAD33, 0xAD33, 0xB575, 0xB575, 0xA4D2, 0xB575, 0xA4D2, 0xA4D2, 0xA4D2,   // 0x2690 (9872) pixels
-  0x9CF4, 0x9CB2, 0x9491, 0x9CB2, 0x8472, 0x73CF, 0x9CB2, 0x8450, 0x7C0F, 0x73CF, 0x7432, 0x9CB2, 0xB5D8, 0xC65A, 0xC65A, 0xCE38,   // 0x26A0 (9888) pixels
-  0xC65A, 0xB5D8, 0x9536, 0x8474, 0x84B4, 0xAD99, 0x8519, 0x74D8, 0x9DDC, 0xD6BC, 0x9429, 0xDD46, 0xEDA6, 0xEDA6, 0x5A22, 0x0000,   // 0x26B0 (9904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A0, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x26C0 (9920) pixels
-  0xEDA6, 0xEDA6, 0xC4C5, 0x1060, 0x0000, 0x0042, 0x4B31, 0x9E3E, 0x64DD, 0x3B99, 0x3356, 0x2AF4, 0x2AB2, 0x2AF4, 0x2AB2, 0x2270,   // 0x26D0 (9936) pixels
-  0x2AB2, 0x2AB2, 0x2270, 0x2A91, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2A91, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2A91, 0x32D2, 0x4354,   // 0x26E0 (9952) pixels
-  0x53B4, 0x4ACC, 0x534E, 0x63D0, 0x63D0, 0x8450, 0x8450, 0x5B93, 0x5374, 0x4332, 0x4354, 0x4B31, 0x4B31, 0x32B1, 0x32B1, 0x32B1,   // 0x26F0 (9968) pixels
-  0x32B1, 0x32D2, 0x4B31, 0x4332, 0x4332, 0x4332, 0x534E, 0x52EB, 0x636D, 0x5B93, 0x53B4, 0x4B31, 0x42AA, 0x532C, 0x4289, 0x42AA,   // 0x2700 (9984) pixels
-  0x530B, 0x530B, 0x42AA, 0x636D, 0x530B, 0x530B, 0x532C, 0x530B, 0x636D, 0x6B6B, 0x6B8D, 0x532C, 0x5B93, 0x53B4, 0x5372, 0x534E,   // 0x2710 (10000) pixels
-  0x6B8E, 0x532C, 0x5372, 0x53B4, 0x53B4, 0x5B90, 0x532C, 0x532C, 0x532C, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x73CF, 0x8C2E, 0x8450,   // 0x2720 (10016) pixels
-  0x73CF, 0x8450, 0x8450, 0x6415, 0x63D0, 0x7C11, 0xB575, 0xAD33, 0xAD33, 0xAD33, 0xAD33, 0xAD33, 0x9D13, 0x8450, 0xB575, 0xCDD5,   // 0x2730 (10032) pixels
-  0xB575, 0xCDD5, 0xB575, 0xB575, 0xAD33, 0xAD33, 0xB575, 0x9CB2, 0x9CB2, 0xA4D2, 0x9CB2, 0x9CB2, 0x8450, 0x8472, 0x9CB2, 0x73CF,   // 0x2740 (10048) pixels
-  0x6B8E, 0x8450, 0x8472, 0xB575, 0x9D15, 0xCE38, 0xC65C, 0xCE38, 0xCE38, 0xBE1A, 0xB575, 0x8472, 0x7454, 0x9558, 0x8CF6, 0x6C97,   // 0x2750 (10064) pixels
-  0x8D9D, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xC4C5, 0x0000, 0x0000,   // 0x2760 (10080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x49C1, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x20E0, 0x0000, 0x08A4, 0x6C56, 0x95FE,   // 0x2770 (10096) pixels
-  0xD549, 0xB4A9, 0x7C0F, 0x4B31, 0x2AB2, 0x2AB2, 0x2AB2, 0x2A91, 0x2270, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x2AB2,   // 0x2780 (10112) pixels
-  0x2AB2, 0x32D2, 0x32D2, 0x2A91, 0x32D2, 0x4332, 0x4B95, 0x53D6, 0x63D0, 0x5350, 0x4354, 0x4332, 0x5350, 0x4B31, 0x32B1, 0x32B1,   // 0x2790 (10128) pixels
-  0x32B1, 0x4332, 0x32B1, 0x32B1, 0x32D2, 0x32B1, 0x32B1, 0x32D2, 0x3B13, 0x5350, 0x4ACC, 0x42F0, 0x32B1, 0x4332, 0x5350, 0x532C,   // 0x27A0 (10144) pixels
-  0x530B, 0x5350, 0x53B4, 0x53B4, 0x42EE, 0x532C, 0x52EB, 0x42AA, 0x42AA, 0x530B, 0x52EB, 0x532C, 0x636D, 0x532C, 0x636D, 0x530B,   // 0x27B0 (10160) pixels
-  0x636D, 0x6B8E, 0x532C, 0x5350, 0x53D6, 0x53D6, 0x53B4, 0x5350, 0x6B8E, 0x636D, 0x5350, 0x5372, 0x5350, 0x532C, 0x530B, 0x530B,   // 0x27C0 (10176) pixels
-  0x532C, 0x532C, 0x6B8D, 0x6B8E, 0x6B8E, 0x73CF, 0x83EF, 0x8C2E, 0x6B8E, 0x532C, 0x5372, 0x53D6, 0x53D6, 0x6415, 0x9CB2, 0xB575,   // 0x27D0 (10192) pixels
-  0xAD33, 0xAD33, 0xAD33, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xAD33, 0xB575, 0xB575, 0xB575, 0xA4D2, 0xA4D2, 0x9CB2,   // 0x27E0 (10208) pixels
-  0x9CB2, 0x9CB2, 0x9471, 0x8450, 0x73F0, 0x6B8E, 0x73F0, 0x73F0, 0x8C92, 0xB575, 0xB575, 0xCE38, 0xCE38, 0xCE38, 0xD6BC, 0xD658,   // 0x27F0 (10224) pixels
-  0xC65A, 0xCE38, 0xAD99, 0xB575, 0x8CF6, 0x84B4, 0x84B4, 0x6C56, 0x9D15, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x18A0,   // 0x2800 (10240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2810 (10256) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0x3121, 0x0000, 0x1107, 0x855A, 0x85BE, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xB4A9, 0x636D, 0x32B1, 0x2A91,   // 0x2820 (10272) pixels
-  0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x32D2, 0x2AB2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x3B13, 0x53B4, 0x53B4, 0x53B4, 0x63D0,   // 0x2830 (10288) pixels
-  0x6B8E, 0x5350, 0x63D2, 0x4354, 0x4332, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32D2, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32D2,   // 0x2840 (10304) pixels
-  0x4332, 0x534E, 0x4ACC, 0x32B1, 0x32B1, 0x3A8F, 0x32B1, 0x5350, 0x532C, 0x532C, 0x5350, 0x53B4, 0x4332, 0x4B31, 0x530B, 0x52EB,   // 0x2850 (10320) pixels
-  0x530B, 0x530B, 0x42AA, 0x530B, 0x532C, 0x636D, 0x6B6B, 0x530B, 0x530B, 0x532C, 0x5B93, 0x53B4, 0x53B4, 0x4354, 0x4332, 0x4332,   // 0x2860 (10336) pixels
-  0x532C, 0x4ACC, 0x4B31, 0x4B31, 0x532C, 0x530B, 0x532C, 0x532C, 0x530B, 0x532C, 0x6B6B, 0x6B8E, 0x6B8D, 0x73CF, 0x8C2E, 0x6B8E,   // 0x2870 (10352) pixels
-  0x532C, 0x5B93, 0x53D6, 0x53D6, 0x6415, 0x8C92, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xCE38, 0xBE38, 0xCE38, 0xB575,   // 0x2880 (10368) pixels
-  0xB575, 0xB575, 0xB575, 0xA4D2, 0x9CB2, 0xAD33, 0xB575, 0x9CB2, 0x9CB2, 0x9491, 0x8450, 0x73F0, 0x7C11, 0x534E, 0x6B8E, 0xB575,   // 0x2890 (10384) pixels
-  0x9536, 0xB575, 0xB575, 0xCE38, 0xCE38, 0xDE98, 0xD69B, 0xCE38, 0xDF1D, 0xD6BC, 0xC65A, 0xC65A, 0xB575, 0x84B4, 0x7432, 0x6C56,   // 0x28A0 (10400) pixels
-  0x9D13, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x6AA2, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xC4C5, 0x0000, 0x0000,   // 0x28B0 (10416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x8B63, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x5A22, 0x0000, 0x2A0C, 0x8D9D, 0x755E,   // 0x28C0 (10432) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xB4A9, 0x83C9, 0x534E, 0x32D2, 0x3B13, 0x32D2, 0x32D2, 0x32D2, 0x3314,   // 0x28D0 (10448) pixels
-  0x3B13, 0x4354, 0x4354, 0x53B4, 0x73F0, 0x73F0, 0x6B8E, 0x6B8E, 0x73CF, 0x7C11, 0x9CB2, 0x5B93, 0x5374, 0x4332, 0x5372, 0x5372,   // 0x28E0 (10464) pixels
-  0x4332, 0x32B1, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32B1, 0x4332, 0x4B0F, 0x3A8F, 0x32B1, 0x2270, 0x2270, 0x32B1, 0x4B31,   // 0x28F0 (10480) pixels
-  0x534E, 0x636D, 0x6B8E, 0x4332, 0x4332, 0x53B4, 0x532C, 0x532C, 0x532C, 0x530B, 0x42AA, 0x52EB, 0x42AA, 0x42AA, 0x52EB, 0x532C,   // 0x2900 (10496) pixels
-  0x532C, 0x534E, 0x4332, 0x4332, 0x4332, 0x32D2, 0x32D2, 0x42EE, 0x3A8F, 0x32B1, 0x32D2, 0x4332, 0x32B1, 0x4ACC, 0x42AA, 0x42AA,   // 0x2910 (10512) pixels
-  0x52EB, 0x530B, 0x532C, 0x636D, 0x6B8E, 0x73CF, 0x73CF, 0x63D0, 0x53B4, 0x53D6, 0x53B4, 0x63F4, 0x9D15, 0xB575, 0xB575, 0xB575,   // 0x2920 (10528) pixels
-  0xB575, 0xB575, 0xCDD5, 0xB575, 0xBE38, 0xB575, 0xCE38, 0xD616, 0xD616, 0xCDD5, 0xB575, 0xAD33, 0xA4D2, 0x9CB2, 0x9CB2, 0x9471,   // 0x2930 (10544) pixels
-  0x8450, 0x8450, 0x7C11, 0x73CF, 0x7C11, 0x6B8E, 0x9CF4, 0x9CF4, 0xB575, 0xB575, 0xCE38, 0xDE98, 0xD658, 0xEED8, 0xC65A, 0xC65A,   // 0x2940 (10560) pixels
-  0xD6BC, 0xD658, 0xC65A, 0xB5D8, 0xB575, 0x7454, 0x6C13, 0x6415, 0xAD33, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x93A4,   // 0x2950 (10576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB465, 0xEDA6, 0xEDA6, 0xC4C5,   // 0x2960 (10592) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0x6AA2, 0x0000, 0x3A8F, 0x9E3E, 0x6D1D, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2970 (10608) pixels
-  0xEDA6, 0xEDA6, 0xDD46, 0xB4A9, 0x73CD, 0x4B31, 0x4B31, 0x4354, 0x4354, 0x3314, 0x63F4, 0x9CB2, 0xA4D2, 0x9471, 0x8C2E, 0x83EF,   // 0x2980 (10624) pixels
-  0x8C2E, 0xAD33, 0xB575, 0x8472, 0x7C11, 0x7C11, 0x8450, 0x7C11, 0x6B8E, 0x5350, 0x532C, 0x32B1, 0x32B1, 0x32B1, 0x32D2, 0x32B1,   // 0x2990 (10640) pixels
-  0x3B13, 0x4B31, 0x32B1, 0x32B1, 0x32B1, 0x2270, 0x32B1, 0x32B1, 0x4B0F, 0x532C, 0x636E, 0x534E, 0x4354, 0x53B4, 0x534E, 0x530B,   // 0x29A0 (10656) pixels
-  0x530B, 0x6B8D, 0x530B, 0x4289, 0x6B6B, 0x532C, 0x530B, 0x532C, 0x532C, 0x4332, 0x32B1, 0x32D2, 0x32B1, 0x32D2, 0x32D2, 0x32B1,   // 0x29B0 (10672) pixels
-  0x32D2, 0x42F0, 0x32B1, 0x32D2, 0x32B1, 0x42F0, 0x3A8C, 0x4269, 0x4289, 0x530B, 0x530B, 0x532C, 0x6B8E, 0x6B8D, 0x73CF, 0x6B8E,   // 0x29C0 (10688) pixels
-  0x53B4, 0x53D6, 0x53D6, 0x7497, 0xB575, 0xB575, 0xB575, 0xAD33, 0xD616, 0xB575, 0xD616, 0xCE38, 0xB575, 0xB575, 0xD616, 0xCE38,   // 0x29D0 (10704) pixels
-  0xD616, 0xB575, 0xAD33, 0xAD33, 0xB575, 0xA4D2, 0x9CB2, 0x9491, 0x8450, 0x8450, 0x6B8E, 0x7C11, 0x8450, 0x7C11, 0x9CB2, 0x9D15,   // 0x29E0 (10720) pixels
-  0xB575, 0xCDD5, 0xD616, 0xEE2D, 0xF60A, 0xEDC9, 0xD616, 0xB575, 0xCE38, 0xCE38, 0xB5D8, 0xB5D8, 0x9536, 0x84B4, 0x6C13, 0x6415,   // 0x29F0 (10736) pixels
-  0xB52E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x18A0, 0x0000, 0x0000, 0x0000, 0x3121, 0xC4C5, 0x0000, 0x0000,   // 0x2A00 (10752) pixels
-  0x0000, 0x0000, 0x0000, 0x1060, 0xB465, 0xEDA6, 0xEDA6, 0xA3E4, 0xDD46, 0xEDA6, 0xEDA6, 0x8B63, 0x0042, 0x53B4, 0x9E3E, 0x54BE,   // 0x2A10 (10768) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xB4A9,   // 0x2A20 (10784) pixels
-  0x73CF, 0x4B96, 0x7432, 0xA4D2, 0x8450, 0x8450, 0x8450, 0x9CB2, 0xCDD5, 0xB575, 0xD5B2, 0xB575, 0xA4D2, 0x8C2E, 0x9471, 0xA4D2,   // 0x2A30 (10800) pixels
-  0x9CB2, 0x9471, 0x6B8E, 0x534E, 0x42EE, 0x42EE, 0x32B1, 0x3B13, 0x4332, 0x53B4, 0x4354, 0x4332, 0x32B1, 0x32B1, 0x2270, 0x2270,   // 0x2A40 (10816) pixels
-  0x4B31, 0x532C, 0x4B31, 0x5350, 0x4332, 0x4B31, 0x6B8D, 0x530B, 0x6B6B, 0x636D, 0x530B, 0x52EB, 0x4269, 0x532C, 0x532C, 0x532C,   // 0x2A50 (10832) pixels
-  0x4ACC, 0x4332, 0x32B1, 0x32D2, 0x32D2, 0x4B31, 0x32D2, 0x42F0, 0x32D2, 0x32D2, 0x32D2, 0x42F0, 0x3B13, 0x32B1, 0x42F0, 0x4ACC,   // 0x2A60 (10848) pixels
-  0x42AA, 0x532C, 0x636D, 0x530B, 0x636D, 0x636D, 0x6B8D, 0x636D, 0x63D2, 0x53D6, 0x53D6, 0x53B4, 0x9CF4, 0xCDD5, 0xD616, 0xCDD5,   // 0x2A70 (10864) pixels
-  0xB575, 0xCDD5, 0xD658, 0xD658, 0xAD33, 0x9CB2, 0xB575, 0xD616, 0xCDD5, 0xB575, 0xB575, 0xB575, 0xAD33, 0x9CB2, 0x9491, 0x8450,   // 0x2A80 (10880) pixels
-  0x8450, 0x73CF, 0x6B8E, 0x73CF, 0x9CB2, 0x9CB2, 0xB575, 0xB575, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xAD33, 0xB5D8,   // 0x2A90 (10896) pixels
-  0xB575, 0xB575, 0xB575, 0xB575, 0x7C95, 0x7454, 0x7432, 0x6C13, 0xB52E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x2AA0 (10912) pixels
-  0x3121, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A0, 0xDD46, 0xEDA6, 0xEDA6, 0x6AA2,   // 0x2AB0 (10928) pixels
-  0xC4C5, 0xEDA6, 0xEDA6, 0xB465, 0x0883, 0x7497, 0x85BE, 0x5C9D, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2AC0 (10944) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x7454, 0x9CB2, 0x9CB2, 0xA4D2, 0xA4AD, 0xA4AD, 0xA4D2,   // 0x2AD0 (10960) pixels
-  0xAD33, 0xCDD5, 0xD5B2, 0xCDD5, 0xCDD5, 0xD5B2, 0xAD33, 0xCDD5, 0xCDD5, 0xB575, 0xB575, 0x9471, 0x73F0, 0x532C, 0x532C, 0x5372,   // 0x2AE0 (10976) pixels
-  0x5372, 0x53B4, 0x53B4, 0x4332, 0x4332, 0x32B1, 0x32B1, 0x32B1, 0x4332, 0x4ACC, 0x42F0, 0x4B31, 0x5372, 0x4332, 0x636D, 0x530B,   // 0x2AF0 (10992) pixels
-  0x636E, 0x636D, 0x532C, 0x532C, 0x534E, 0x532C, 0x636D, 0x6B8E, 0x534E, 0x4332, 0x4B31, 0x4332, 0x4B31, 0x32B1, 0x42F0, 0x4B31,   // 0x2B00 (11008) pixels
-  0x4B31, 0x4332, 0x3B13, 0x3B13, 0x32D2, 0x32D2, 0x3B13, 0x4332, 0x4ACC, 0x42AA, 0x636D, 0x532C, 0x530B, 0x52EB, 0x530B, 0x636D,   // 0x2B10 (11024) pixels
-  0x63D2, 0x53B4, 0x53D6, 0x53D6, 0x6C56, 0x9558, 0xCDD5, 0xB575, 0xB575, 0xD616, 0xCDD5, 0xB575, 0xB575, 0x9491, 0xD616, 0xD616,   // 0x2B20 (11040) pixels
-  0xCDD5, 0xCDD5, 0xB575, 0xB575, 0xA4D2, 0x9491, 0x8450, 0x8450, 0x8450, 0x8450, 0x8450, 0x73F0, 0x8450, 0x9CB2, 0xB575, 0xB575,   // 0x2B30 (11056) pixels
-  0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xAD33, 0xB575, 0xAD99, 0xB575, 0xB575, 0x84B4, 0x8472, 0x8472, 0x6415, 0x6415,   // 0x2B40 (11072) pixels
-  0xB52E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x6AA2, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000,   // 0x2B50 (11088) pixels
-  0x0000, 0x0000, 0x0000, 0x20E0, 0xEDA6, 0xEDA6, 0xEDA6, 0x49C1, 0xB465, 0xEDA6, 0xEDA6, 0xDD46, 0x31A5, 0x855A, 0x85BE, 0x443D,   // 0x2B60 (11104) pixels
-  0xBD0A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2B70 (11120) pixels
-  0xDD46, 0xB575, 0xA4F4, 0xA4D2, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xD5B2, 0xD5B2, 0xCDD5, 0xAD33, 0xD5B2, 0xD5B2,   // 0x2B80 (11136) pixels
-  0xB575, 0xAD33, 0xCDD5, 0xAD33, 0x9471, 0x8450, 0x63D0, 0x636E, 0x6B8E, 0x5B90, 0x4354, 0x53B4, 0x5350, 0x534E, 0x532C, 0x4B31,   // 0x2B90 (11152) pixels
-  0x42EE, 0x4ACC, 0x3A8F, 0x32B1, 0x4332, 0x4B31, 0x4ACC, 0x530B, 0x636D, 0x534E, 0x4ACC, 0x42F0, 0x4332, 0x4B31, 0x532C, 0x532C,   // 0x2BA0 (11168) pixels
-  0x534E, 0x42EE, 0x4ACC, 0x42EE, 0x42EE, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4ACC, 0x4332, 0x4332, 0x3B13, 0x3B13, 0x3B13, 0x3314,   // 0x2BB0 (11184) pixels
-  0x4B31, 0x532C, 0x42AA, 0x42AA, 0x52EB, 0x52EB, 0x530B, 0x636D, 0x6B8E, 0x53B4, 0x53D6, 0x53B4, 0x53D6, 0x53B4, 0x9D15, 0xB575,   // 0x2BC0 (11200) pixels
-  0xD616, 0xCDD5, 0xCE38, 0x8C92, 0xD616, 0xAD33, 0x8C91, 0xAD33, 0xD58E, 0xEDC9, 0xD58E, 0xB52E, 0x9CB2, 0x73CF, 0x8450, 0x8450,   // 0x2BD0 (11216) pixels
-  0x9491, 0x8450, 0x8450, 0x73F0, 0x9CB2, 0xA4D2, 0xB575, 0xAD33, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xB575,   // 0x2BE0 (11232) pixels
-  0x9536, 0xB575, 0xB575, 0x9CF4, 0x84B4, 0x7432, 0x6415, 0x6C13, 0xB52E, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2BF0 (11248) pixels
-  0xB465, 0x0000, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xEDA6, 0xEDA6, 0xEDA6, 0x3121,   // 0x2C00 (11264) pixels
-  0x6AA2, 0xEDA6, 0xEDA6, 0xDD46, 0x31A5, 0xA5DA, 0x7D9E, 0x3C1C, 0x3378, 0x63D2, 0xB4A9, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2C10 (11280) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xB575, 0xB575, 0xD5B2, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2C20 (11296) pixels
-  0xEDA6, 0xEDA6, 0xC4C5, 0xD5B2, 0xCDD5, 0xCDD5, 0xD5B2, 0xCDD5, 0xCDD5, 0xD616, 0xCDD5, 0xAD33, 0x9491, 0xAD33, 0xA4D2, 0x9491,   // 0x2C30 (11312) pixels
-  0x8450, 0x63D0, 0x53B4, 0x5372, 0x4354, 0x6B8E, 0x534E, 0x42EE, 0x42EE, 0x32B1, 0x32D2, 0x32B1, 0x2270, 0x32D2, 0x532C, 0x52EB,   // 0x2C40 (11328) pixels
-  0x6B8E, 0x4ACC, 0x4332, 0x5374, 0x4332, 0x5372, 0x4ACC, 0x4ACC, 0x534E, 0x4ACC, 0x4ACC, 0x4ACC, 0x42AA, 0x52EB, 0x530B, 0x532C,   // 0x2C50 (11344) pixels
-  0x530B, 0x532C, 0x4ACC, 0x42F0, 0x4B31, 0x4B31, 0x3B13, 0x4332, 0x4B31, 0x42AA, 0x52EB, 0x52EB, 0x530B, 0x530B, 0x530B, 0x636D,   // 0x2C60 (11360) pixels
-  0x532C, 0x5B90, 0x53B4, 0x53B4, 0x53D6, 0x53B4, 0x6C13, 0x63D0, 0xB575, 0xB575, 0xD616, 0x9D15, 0xD616, 0xDE32, 0xEDA6, 0xEDA6,   // 0x2C70 (11376) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0x8C2E, 0x8450, 0x9491, 0x9CB2, 0x8450, 0x8472, 0x9CB2, 0x9CB2, 0x9D15, 0x9D13, 0xAD33,   // 0x2C80 (11392) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xB575, 0xB575, 0xB575, 0xB575, 0x9CF4, 0x8472, 0x7432, 0x7432, 0x6C13,   // 0x2C90 (11408) pixels
-  0x8C2E, 0xEDA6, 0xEDA6, 0xDD46, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x18A0, 0x0000, 0x0000, 0x3121, 0xC4C5, 0x0000, 0x0000,   // 0x2CA0 (11424) pixels
-  0x0000, 0x0000, 0x0000, 0x49C1, 0xEDA6, 0xEDA6, 0xDD46, 0x0000, 0x49C1, 0xEDA6, 0xEDA6, 0xEDA6, 0x62E8, 0xB65C, 0x6D1E, 0x3BDA,   // 0x2CB0 (11440) pixels
-  0x3B99, 0x3356, 0x3356, 0x4354, 0x6B8E, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2CC0 (11456) pixels
-  0xDD46, 0xCDD5, 0xCDD5, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xE5F4, 0xCDD5, 0xE5F4, 0xE5F4,   // 0x2CD0 (11472) pixels
-  0xE676, 0xE676, 0xE676, 0xD658, 0xD616, 0xCDD5, 0xAD33, 0xB575, 0xD5B2, 0xB4A9, 0xB4A9, 0x8C2E, 0x6B8E, 0x73F0, 0x5350, 0x326E,   // 0x2CE0 (11488) pixels
-  0x32B1, 0x32B1, 0x2270, 0x2270, 0x222F, 0x3A8F, 0x32B1, 0x4ACC, 0x52EC, 0x4ACC, 0x32B1, 0x4354, 0x63D2, 0x532C, 0x6B6B, 0x73CD,   // 0x2CF0 (11504) pixels
-  0x530B, 0x636D, 0x636D, 0x6B8E, 0x7C0F, 0x6B8D, 0x83EF, 0x8450, 0x6B8D, 0x6B8E, 0x636D, 0x42AA, 0x4ACC, 0x3A8C, 0x4ACC, 0x3A8C,   // 0x2D00 (11520) pixels
-  0x4ACC, 0x6B6B, 0x83C9, 0xB465, 0xB465, 0xB4A9, 0x9429, 0x6B8D, 0x6B6B, 0x636D, 0x63D2, 0x53D6, 0x53D6, 0x53D6, 0x53B4, 0x5B90,   // 0x2D10 (11536) pixels
-  0x84B4, 0xB575, 0xD616, 0xB575, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C2E, 0x8450,   // 0x2D20 (11552) pixels
-  0x7C0F, 0x7C11, 0x9CF4, 0xB575, 0xB575, 0xB575, 0x9CB2, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xB575,   // 0x2D30 (11568) pixels
-  0xB575, 0xB575, 0x9CF4, 0x84B4, 0x8474, 0x7432, 0x63F4, 0x63F4, 0xA4AD, 0xF607, 0xEDA6, 0xEDA6, 0xB465, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2D40 (11584) pixels
-  0xEDA6, 0x5A22, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xEDA6, 0xB465, 0x0000,   // 0x2D50 (11600) pixels
-  0x18A0, 0xEDA6, 0xEDA6, 0xEDA6, 0x83C9, 0xBE9D, 0x54BE, 0x3BDA, 0x2B78, 0x3356, 0x3356, 0x3356, 0x3314, 0x4332, 0xD549, 0xEDA6,   // 0x2D60 (11616) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xE676, 0xEED8, 0xDE32, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2D70 (11632) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0xE5D2, 0xCDD5, 0xE5F4, 0xCDD5, 0xCDD5, 0xE676, 0xE676, 0xF719, 0xEED8, 0xD616, 0xCDD5, 0xD5B2,   // 0x2D80 (11648) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x73CD, 0x326E, 0x2270, 0x222F, 0x222F, 0x222F, 0x222F, 0x326E, 0x4B0F, 0x4ACC,   // 0x2D90 (11664) pixels
-  0x532C, 0x534E, 0x9429, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xB465, 0x9429, 0x9471, 0x9CB2, 0x9471, 0x8C2E, 0x8450,   // 0x2DA0 (11680) pixels
-  0x83EF, 0x73CF, 0x73CF, 0x73CF, 0x532C, 0x6B8E, 0x73CF, 0x73CF, 0x9429, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x2DB0 (11696) pixels
-  0x9429, 0x6B8E, 0x8450, 0x53B4, 0x53D6, 0x53D6, 0x84B4, 0xB575, 0xB575, 0xD616, 0xB575, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2DC0 (11712) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x8450, 0x8450, 0x73F0, 0x8472, 0x9CB2, 0x8472, 0xB575, 0x9CB2, 0xD549,   // 0x2DD0 (11728) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xAD33, 0xB575, 0xB575, 0xB575, 0x84B4, 0x8472, 0x7432, 0x7454, 0x6C13,   // 0x2DE0 (11744) pixels
-  0xB52E, 0xEDA6, 0xEDA6, 0xDD46, 0x7347, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x8B63, 0x0000, 0x0000, 0x3121, 0xC4C5, 0x0000, 0x0000,   // 0x2DF0 (11760) pixels
-  0x0000, 0x0000, 0x0000, 0x8B63, 0xEDA6, 0xEDA6, 0x8B63, 0x0000, 0x0000, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0xC6BD, 0x54BE, 0x3BDA,   // 0x2E00 (11776) pixels
-  0x3378, 0x3356, 0x3B97, 0x3314, 0x3314, 0x4332, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xD5B2, 0xD549, 0xEDC9, 0xEDA6, 0xEDA6,   // 0x2E10 (11792) pixels
-  0xD549, 0xE676, 0xEED8, 0xEE52, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xE5F4, 0xE5F4, 0xE5F4, 0xE5F4,   // 0x2E20 (11808) pixels
-  0xE676, 0xE676, 0xEED8, 0xF719, 0xEED8, 0xD616, 0xD616, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x222F,   // 0x2E30 (11824) pixels
-  0x222F, 0x222F, 0x222F, 0x326E, 0x2270, 0x222F, 0x42F0, 0x532C, 0x636D, 0xC4E8, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2E40 (11840) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x9491, 0x9491, 0x9491, 0x9471, 0x9491, 0x73CF, 0x8450, 0x8450, 0x8450, 0x73CF, 0x8C2E, 0xA4AD,   // 0x2E50 (11856) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x83EF, 0x7C11, 0x53B4, 0x53D6, 0x53D6, 0x6C56, 0x9536,   // 0x2E60 (11872) pixels
-  0xB575, 0xB575, 0xDE32, 0xEDA6, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x9491,   // 0x2E70 (11888) pixels
-  0x8450, 0x8450, 0x8472, 0xA4D2, 0xB575, 0x9D15, 0x9CB2, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB52E,   // 0x2E80 (11904) pixels
-  0xAD99, 0xB575, 0xB575, 0x7432, 0x7432, 0x8474, 0x7454, 0x5B93, 0xA4AD, 0xEDA6, 0xEDA6, 0xDD46, 0x4227, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2E90 (11920) pixels
-  0xEDA6, 0xB465, 0x0000, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC4C5, 0xEDA6, 0xEDA6, 0x6AA2, 0x0000,   // 0x2EA0 (11936) pixels
-  0x0000, 0xC4C5, 0xEDA6, 0xEDA6, 0xD549, 0xC6BD, 0x443D, 0x3BDA, 0x2B36, 0x3356, 0x3356, 0x3356, 0x3314, 0x4B93, 0xD549, 0xEDA6,   // 0x2EB0 (11952) pixels
-  0xEDA6, 0xEDA6, 0xD549, 0xEED8, 0xEED8, 0xE676, 0xE676, 0xEE52, 0xEE52, 0xE676, 0xD616, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x2EC0 (11968) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xE5F4, 0xE676, 0xE5F4, 0xE676, 0xE676, 0xE676, 0xEED8, 0xEED8, 0xE676, 0xE676, 0xEDC9,   // 0x2ED0 (11984) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x42F0, 0x222F, 0x222F, 0x222F, 0x222F, 0x32B1, 0x222F, 0x2A0C, 0x42EE,   // 0x2EE0 (12000) pixels
-  0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0xA4D2, 0xB575, 0x9491,   // 0x2EF0 (12016) pixels
-  0x9491, 0x9491, 0x9491, 0xA4D2, 0x9491, 0x9471, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2F00 (12032) pixels
-  0xEDA6, 0xC4C5, 0x63D2, 0x53B4, 0x53B4, 0x53D6, 0x53D6, 0x84B4, 0xB575, 0xD616, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2F10 (12048) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x9CB2, 0x9491, 0x9CB2, 0x9CB2, 0x9CB2, 0x9CF4, 0x9CB2, 0xB575, 0xEDC9,   // 0x2F20 (12064) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xB575, 0xB575, 0xB575, 0x8C92, 0x7454, 0x84B4, 0x6C13, 0x5B93,   // 0x2F30 (12080) pixels
-  0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x4269, 0xB465, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x18A0, 0x0000, 0x3121, 0xC4C5, 0x0000, 0x0000,   // 0x2F40 (12096) pixels
-  0x0000, 0x0000, 0x0000, 0xEDA6, 0xEDA6, 0xEDA6, 0x3121, 0x0000, 0x0000, 0xB465, 0xEDA6, 0xEDA6, 0xEDC9, 0xBE1A, 0x4C9E, 0x3B99,   // 0x2F50 (12112) pixels
-  0x3378, 0x2B36, 0x3314, 0x3356, 0x3314, 0x4332, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xDE98, 0xEED8, 0xEED8, 0xF719, 0xEED8,   // 0x2F60 (12128) pixels
-  0xEED8, 0xEED8, 0xD616, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xE676, 0xE676, 0xE676,   // 0x2F70 (12144) pixels
-  0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x32B1,   // 0x2F80 (12160) pixels
-  0x32B1, 0x2270, 0x2270, 0x32B1, 0x2A91, 0x32B1, 0x2A0C, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x2F90 (12176) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0xB575, 0x9491, 0x9491, 0x8450, 0x9491, 0xAD33, 0x9CB2, 0x9491, 0xD549, 0xEDA6,   // 0x2FA0 (12192) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x53B4, 0x53B4, 0x53D6, 0x53B4, 0x53D6, 0x53B4,   // 0x2FB0 (12208) pixels
-  0xB575, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xAD33,   // 0x2FC0 (12224) pixels
-  0x9D13, 0xA4D2, 0x9CB2, 0x9CB2, 0x8472, 0x8450, 0x9491, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549,   // 0x2FD0 (12240) pixels
-  0xB575, 0xB575, 0xB575, 0x7454, 0x63D0, 0x63D0, 0x5350, 0x5B93, 0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x42AA, 0x6AA2, 0xEDA6, 0xEDA6,   // 0x2FE0 (12256) pixels
-  0xEDA6, 0xEDA6, 0x49C1, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDA6, 0xEDA6, 0xDD46, 0x20E0, 0x0000,   // 0x2FF0 (12272) pixels
-  0x0000, 0x8B63, 0xEDA6, 0xEDA6, 0xEDA6, 0xBE38, 0x54BE, 0x3B99, 0x3356, 0x3356, 0x4B96, 0x3314, 0x3314, 0x5B93, 0xD549, 0xEDA6,   // 0x3000 (12288) pixels
-  0xEDA6, 0xEDA6, 0xD58E, 0xD658, 0xEED8, 0xEED8, 0xEED8, 0xEED8, 0xE676, 0xEED8, 0xD658, 0xD5B2, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3010 (12304) pixels
-  0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE5F4, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xEE52, 0xEDA6,   // 0x3020 (12320) pixels
-  0xEDA6, 0xEDA6, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x32B1, 0x3270, 0x32B1, 0x222F, 0x32B1, 0x32B1, 0x2270, 0x6B6B, 0xEDA6,   // 0x3030 (12336) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xAD33, 0x8450,   // 0x3040 (12352) pixels
-  0x73CF, 0x6B8D, 0x73CD, 0x9471, 0x9491, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3050 (12368) pixels
-  0xEDA6, 0xC4C5, 0x5B93, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x6C56, 0xB575, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3060 (12384) pixels
-  0xDD46, 0xD549, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xB575, 0xAD33, 0x9CB2, 0x8C92, 0x8450, 0x8450, 0x6B8E, 0xA4AD, 0xEDA6,   // 0x3070 (12400) pixels
-  0xEDA6, 0xEDA6, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xB575, 0xB575, 0x9CF4, 0x8472, 0x63D0, 0x4B0F, 0x4B0F, 0x5B93,   // 0x3080 (12416) pixels
-  0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x42AA, 0x3121, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x8B63, 0x0000, 0x3121, 0xB465, 0x0000, 0x0000,   // 0x3090 (12432) pixels
-  0x0000, 0x0000, 0x20E0, 0xEDA6, 0xEDA6, 0xC4C5, 0x18A0, 0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xEDA6, 0xEDA6, 0xBE38, 0x54BE, 0x3B99,   // 0x30A0 (12448) pixels
-  0x2B36, 0x3356, 0x3356, 0x3314, 0x3314, 0x4354, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE676, 0xEED8, 0xEED8, 0xEED8, 0xD69B,   // 0x30B0 (12464) pixels
-  0xEED8, 0xD616, 0xCDD5, 0xD5B2, 0xF607, 0xEDA6, 0xEDA6, 0xDD46, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xCDD5, 0xE5F4, 0xE676,   // 0x30C0 (12480) pixels
-  0xE676, 0xE676, 0xE676, 0xEE52, 0xE5F4, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x32D2,   // 0x30D0 (12496) pixels
-  0x32B1, 0x32B1, 0x2270, 0x2270, 0x32B1, 0x42F0, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x30E0 (12512) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x73CF, 0x6B8E, 0x6B8E, 0x6B8E, 0x8C2E, 0x9471, 0xD549, 0xEDA6, 0xEDA6,   // 0x30F0 (12528) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x534E, 0x5B93, 0x53B4, 0x53D6, 0x53D6, 0x53B4,   // 0x3100 (12544) pixels
-  0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xA4AD, 0xAD33, 0xB575, 0xB575, 0xA4AD, 0xD549, 0xEDA6, 0xDD46, 0xB575,   // 0x3110 (12560) pixels
-  0xB575, 0x9CB2, 0x8450, 0x6B8E, 0x6B8E, 0x6B8E, 0x9429, 0xEDA6, 0xEDA6, 0xEDA6, 0xA4AD, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3120 (12576) pixels
-  0xAD33, 0x9CF4, 0x9CF4, 0x8474, 0x63D0, 0x534E, 0x532C, 0x5350, 0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x426A, 0x20E0, 0xDD46, 0xEDA6,   // 0x3130 (12592) pixels
-  0xEDA6, 0xEDA6, 0xC4C5, 0x1060, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xEDA6, 0xEDA6, 0xC4C5, 0x0000, 0x0000,   // 0x3140 (12608) pixels
-  0x0000, 0x5A22, 0xEDA6, 0xEDA6, 0xEDA6, 0xB575, 0x4C9E, 0x3BDA, 0x2B36, 0x3356, 0x3314, 0x3314, 0x3314, 0x5B93, 0xD549, 0xEDA6,   // 0x3150 (12624) pixels
-  0xEDA6, 0xEDA6, 0xB4A9, 0xD616, 0xE676, 0xEED8, 0xE676, 0xCDD5, 0xB575, 0xCDD5, 0xCDD5, 0xD616, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3160 (12640) pixels
-  0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xCDD5, 0xE5F4, 0xE676, 0xE676, 0xE5D2, 0xE5F4, 0xE5D2, 0xE676, 0xF60A, 0xEDA6,   // 0x3170 (12656) pixels
-  0xEDA6, 0xEDA6, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x42F0, 0x32D2, 0x32D2, 0x32B1, 0x222F, 0x32B1, 0x73CF, 0xEDA6, 0xEDA6,   // 0x3180 (12672) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x6B8E,   // 0x3190 (12688) pixels
-  0x5372, 0x534E, 0x8C2E, 0x9491, 0xAD33, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x8C2E, 0x8C2E, 0x8C2E, 0xD549, 0xEDA6,   // 0x31A0 (12704) pixels
-  0xEDA6, 0xC4C5, 0x636D, 0x6B8D, 0x5B90, 0x53B4, 0x5B93, 0x63D0, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C2E, 0xAD33,   // 0x31B0 (12720) pixels
-  0xB575, 0xAD33, 0xA4D2, 0x8450, 0xAD33, 0xEDC9, 0xC4C5, 0xCDD5, 0x9CB2, 0x9CB2, 0x8450, 0x8C2E, 0x6B8E, 0x6B8D, 0xBD0A, 0xEDA6,   // 0x31C0 (12736) pixels
-  0xEDA6, 0xEDA6, 0xA4AD, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xA4D2, 0x9CF4, 0x9CB2, 0x9CF4, 0x7432, 0x4B31, 0x532C, 0x5350,   // 0x31D0 (12752) pixels
-  0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x42AA, 0x0042, 0xB465, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x3121, 0x3121, 0xB465, 0x0000, 0x0000,   // 0x31E0 (12768) pixels
-  0x0000, 0x0000, 0x5A22, 0xEDA6, 0xEDA6, 0xA3E4, 0x0000, 0x0000, 0x0000, 0x49C1, 0xEDA6, 0xEDA6, 0xEDA6, 0xAD33, 0x5C9D, 0x3BFC,   // 0x31F0 (12784) pixels
-  0x2B15, 0x3314, 0x2AF4, 0x3314, 0x3314, 0x4B95, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xD616, 0xE676, 0xEED8, 0xE676, 0xD616,   // 0x3200 (12800) pixels
-  0xE676, 0xCDD5, 0xE676, 0xD5B2, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xE676, 0xE5F4,   // 0x3210 (12816) pixels
-  0xE676, 0xEE52, 0xE676, 0xE5F4, 0xE676, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x4332,   // 0x3220 (12832) pixels
-  0x4332, 0x32D2, 0x3B13, 0x32B1, 0x32B1, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x532C, 0x42EE, 0x32B1, 0x42EE,   // 0x3230 (12848) pixels
-  0x9429, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x73CD, 0x4B31, 0x6B8E, 0x9471, 0xAD33, 0xAD33, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3240 (12864) pixels
-  0xEDA6, 0xDD46, 0xAD33, 0xAD33, 0xA4D2, 0x9491, 0xA4D2, 0xAD33, 0xEDA6, 0xC4C5, 0x9CB2, 0x9491, 0x7C11, 0x6B8E, 0x6B8E, 0x6B6B,   // 0x3250 (12880) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0xB575, 0xAD33, 0xAD33, 0xB575, 0x9491, 0xA4D2, 0xB575, 0xD5B2, 0xB52E, 0xB575,   // 0x3260 (12896) pixels
-  0xAD33, 0xA4D2, 0x9CB2, 0x8450, 0x7C11, 0x7C11, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x9491, 0xAD33, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3270 (12912) pixels
-  0xB4A9, 0x9CB2, 0x9CF4, 0x8472, 0x534E, 0x534E, 0x4B0F, 0x5B90, 0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x426A, 0x0000, 0x6AA2, 0xEDA6,   // 0x3280 (12928) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0x49C1, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A22, 0xEDA6, 0xEDA6, 0x7B03, 0x0000, 0x0000,   // 0x3290 (12944) pixels
-  0x0000, 0x20E0, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0x64FE, 0x3BFC, 0x2B36, 0x3314, 0x2AF4, 0x3314, 0x3314, 0x53B4, 0xEDC9, 0xEDA6,   // 0x32A0 (12960) pixels
-  0xEDA6, 0xEDA6, 0xD58E, 0xEED8, 0xEED8, 0xE676, 0xE5F4, 0xE676, 0xCDD5, 0xE5F4, 0xE5F4, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x32B0 (12976) pixels
-  0xEE52, 0xF60A, 0xEDA6, 0xEDA6, 0xDD46, 0xEE52, 0xE676, 0xE676, 0xE676, 0xE676, 0xE5F4, 0xE676, 0xE676, 0xEE52, 0xEDA6, 0xEDA6,   // 0x32C0 (12992) pixels
-  0xEDA6, 0xDD46, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0x5372, 0x3314, 0x4354, 0x53B4, 0x5B93, 0x6B8E, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x32D0 (13008) pixels
-  0xEDA6, 0xEDA6, 0xB465, 0x42EE, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x6B8E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9,   // 0x32E0 (13024) pixels
-  0x5372, 0x6B8E, 0xAD33, 0xD616, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xCDD5, 0xB575, 0xAD33, 0x9491, 0x9491, 0xA4D2,   // 0x32F0 (13040) pixels
-  0xCDD5, 0xB4A9, 0xB575, 0xAD33, 0xA4D2, 0xA4D2, 0xB575, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xAD33, 0xB575, 0xAD33,   // 0x3300 (13056) pixels
-  0xB575, 0xB575, 0xB575, 0xAD33, 0xAD33, 0xB575, 0xB575, 0xAD33, 0xB575, 0xB575, 0x8450, 0x9491, 0x9CB2, 0x8450, 0xEDA6, 0xEDA6,   // 0x3310 (13072) pixels
-  0xEDA6, 0xDD46, 0x73CF, 0xAD33, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0xB575, 0x9536, 0x7C11, 0x532C, 0x534E, 0x4B31, 0x5350,   // 0x3320 (13088) pixels
-  0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x42AA, 0x0042, 0x18A0, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x7B03, 0x3121, 0xB465, 0x0000, 0x0000,   // 0x3330 (13104) pixels
-  0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xEDA6, 0x5A22, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x5C9D, 0x3C1C,   // 0x3340 (13120) pixels
-  0x3356, 0x2AF4, 0x2AF4, 0x3314, 0x3356, 0x6C56, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xEED8, 0xEED8, 0xE676, 0xE676, 0xE5F4,   // 0x3350 (13136) pixels
-  0xCDD5, 0xD5B2, 0xE676, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xD5B2, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xCDD5, 0xE676,   // 0x3360 (13152) pixels
-  0xE5F4, 0xE5F4, 0xE676, 0xCDD5, 0xCDD5, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x4332,   // 0x3370 (13168) pixels
-  0x4354, 0x53B4, 0x8474, 0xB575, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x532C, 0x32D2, 0x2270, 0x222F, 0x2A91, 0x2270,   // 0x3380 (13184) pixels
-  0x2A91, 0x32B1, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x534E, 0x73CF, 0xCDD5, 0xD616, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3390 (13200) pixels
-  0xEDA6, 0xD5B2, 0xD616, 0xCDD5, 0xAD33, 0xA4D2, 0x9491, 0x9491, 0xAD33, 0xB575, 0xB575, 0xA4D2, 0xB575, 0xB575, 0xCDD5, 0xF60A,   // 0x33A0 (13216) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0xB575, 0xB575, 0xB575, 0xB575, 0xCDD5, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xAD33,   // 0x33B0 (13232) pixels
-  0xB575, 0xCDD5, 0x8450, 0x9CB2, 0x8450, 0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x4B0D, 0x73CF, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x33C0 (13248) pixels
-  0xC4C5, 0x9CB2, 0x73F0, 0x534E, 0x5B90, 0x532C, 0x5350, 0x5350, 0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x4269, 0x0000, 0x0000, 0xB465,   // 0x33D0 (13264) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x3121, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xEDA6, 0x3121, 0x0000, 0x0000,   // 0x33E0 (13280) pixels
-  0x0000, 0x0000, 0xC4C5, 0xEDA6, 0xEDA6, 0xDD46, 0x74FA, 0x443D, 0x3378, 0x2B15, 0x2AF4, 0x2AF4, 0x4B96, 0x8CF6, 0xEDC9, 0xEDA6,   // 0x33F0 (13296) pixels
-  0xEDA6, 0xEDA6, 0xD549, 0xEED8, 0xEED8, 0xE676, 0xE676, 0xE5F4, 0xE5D2, 0xD5B2, 0xCDD5, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x3400 (13312) pixels
-  0xD5B2, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xAD33, 0xE5F4, 0xCDD5, 0xE676, 0xCDD5, 0xE5D2, 0xE5F4, 0xEE2D, 0xEDA6, 0xEDA6,   // 0x3410 (13328) pixels
-  0xEDA6, 0xD549, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x9CF4, 0x5B93, 0x53B4, 0xB575, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3420 (13344) pixels
-  0xEDA6, 0x9429, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32D2, 0x5350, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3430 (13360) pixels
-  0x8C2E, 0xCDD5, 0xD616, 0xD616, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xAD33, 0xD616, 0xCDD5, 0xCDD5, 0xB575, 0xA4D2, 0xA4D2,   // 0x3440 (13376) pixels
-  0x9491, 0x9491, 0xAD33, 0xAD33, 0xAD33, 0xB575, 0xCDD5, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xAD33, 0xB575, 0xB575, 0xB575,   // 0x3450 (13392) pixels
-  0xCDD5, 0xCDD5, 0xB575, 0xAD33, 0xB575, 0xAD33, 0xB575, 0xB575, 0xD616, 0xCDD5, 0x9CB2, 0x9CB2, 0x9CB2, 0xB52E, 0xEDA6, 0xEDA6,   // 0x3460 (13408) pixels
-  0xEDA6, 0x9429, 0x532C, 0x532C, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x636D, 0x532C, 0x532C, 0x534E, 0x534E, 0x5350, 0x5B90,   // 0x3470 (13424) pixels
-  0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x4269, 0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x3121, 0xB465, 0x0000, 0x0000,   // 0x3480 (13440) pixels
-  0x0000, 0x0000, 0x8B63, 0xEDA6, 0xEDA6, 0x8B63, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B63, 0xEDA6, 0xEDA6, 0xEDA6, 0x7497, 0x4C7E,   // 0x3490 (13456) pixels
-  0x3356, 0x2B15, 0x2AF4, 0x2AF4, 0x4B96, 0x9CF4, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xEED8, 0xE676, 0xEED8, 0xEED8, 0xE676,   // 0x34A0 (13472) pixels
-  0xE5F4, 0xCDD5, 0xD5B2, 0xE5D2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0xAD33, 0xAD33,   // 0x34B0 (13488) pixels
-  0xD5B2, 0xD5B2, 0xCDD5, 0xD5B2, 0xE5D2, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDC9, 0xD616,   // 0x34C0 (13504) pixels
-  0x9CF4, 0x8474, 0xD616, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x73CD, 0x4332, 0x32B1, 0x32B1, 0x32B1, 0x32D2, 0x3B13,   // 0x34D0 (13520) pixels
-  0x4332, 0x4332, 0x4332, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0xCDD5, 0xCDD5, 0xD616, 0xE5CE, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x34E0 (13536) pixels
-  0xDD46, 0xD5B2, 0xAD33, 0xB575, 0xAD33, 0xB575, 0xAD33, 0xA4D2, 0x9491, 0x9CB2, 0xA4D2, 0xB575, 0xAD33, 0xAD33, 0xAD33, 0xEDA6,   // 0x34F0 (13552) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xCDD5, 0xB575, 0xB575, 0xCDD5, 0xB575, 0xB575, 0xB575, 0xB575, 0xAD33, 0xCDD5, 0xB575, 0xB575,   // 0x3500 (13568) pixels
-  0xB575, 0xB575, 0x9CB2, 0x9CB2, 0x9CB2, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0x6B6B, 0x6B8D, 0x6B8D, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3510 (13584) pixels
-  0xEDA6, 0x6B6B, 0x6B8E, 0x534E, 0x63D0, 0x534E, 0x5350, 0x6C13, 0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x3A69, 0x0000, 0x0000, 0x3121,   // 0x3520 (13600) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x5A22, 0xA403, 0x1060, 0x0000, 0x0000, 0x0000, 0x8B63, 0xEDA6, 0xEDA6, 0xEDA6, 0x8B63, 0x20E0,   // 0x3530 (13616) pixels
-  0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C92, 0x443D, 0x3B99, 0x2B36, 0x2AF4, 0x3314, 0x53F8, 0x8C92, 0xEDC9, 0xEDA6,   // 0x3540 (13632) pixels
-  0xEDA6, 0xEDA6, 0xD549, 0xEED8, 0xEED8, 0xEED8, 0xEED8, 0xEED8, 0xEED8, 0xE676, 0xE676, 0xEE52, 0xF60A, 0xEDA6, 0xEDA6, 0xDD46,   // 0x3550 (13648) pixels
-  0xD616, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xA4D2, 0xA4D2, 0xCDD5, 0xCDD5, 0xD5B2, 0xE5F4, 0xEDC9, 0xEDA6, 0xEDA6,   // 0x3560 (13664) pixels
-  0xEDA6, 0xD58E, 0xE5D2, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE676, 0xEED8, 0xEED8, 0xEED8, 0xE676, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3570 (13680) pixels
-  0xEDA6, 0xD5B2, 0xB575, 0x7454, 0x4B31, 0x32D2, 0x3B13, 0x4354, 0x4B95, 0x4B95, 0x4B96, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3580 (13696) pixels
-  0xB465, 0x9471, 0xA4D2, 0xCDD5, 0xE5CE, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xCDD5, 0xB575, 0xB575, 0xD616, 0xCDD5, 0xAD33,   // 0x3590 (13712) pixels
-  0xAD33, 0xA4D2, 0x9CB2, 0xAD33, 0xB575, 0xAD33, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xB575, 0xB575, 0xB575, 0xB575,   // 0x35A0 (13728) pixels
-  0xB575, 0xB575, 0xCDD5, 0xD616, 0xCDD5, 0xD616, 0xCDD5, 0xD616, 0xB575, 0xB575, 0xB575, 0x9CB2, 0x8C91, 0xD549, 0xEDA6, 0xEDA6,   // 0x35B0 (13744) pixels
-  0xEDA6, 0x73CD, 0x6B8E, 0x6B8E, 0x9429, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x534E, 0x6B8E, 0x5B90, 0x534E, 0x5350, 0x6C13,   // 0x35C0 (13760) pixels
-  0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x4227, 0x0000, 0x0000, 0x18A0, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0x6AA2, 0xB465, 0x0000, 0x0000,   // 0x35D0 (13776) pixels
-  0x0000, 0x0000, 0xB465, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x3121, 0x0000, 0x5A22, 0xEDA6, 0xEDA6, 0xEDA6, 0xA4AD, 0x4C9E,   // 0x35E0 (13792) pixels
-  0x3BDA, 0x3356, 0x2AF4, 0x3314, 0x53D6, 0x7C11, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xEED8, 0xEED8, 0xEED8, 0xEED8, 0xEED8,   // 0x35F0 (13808) pixels
-  0xEED8, 0xEED8, 0xEED8, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xCDD5, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xCDD5,   // 0x3600 (13824) pixels
-  0xA4D2, 0xA4D2, 0xD5B2, 0xCDD5, 0xE5D2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xE676,   // 0x3610 (13840) pixels
-  0xF719, 0xEED8, 0xEED8, 0xE676, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xD616, 0xEED8, 0xEED8, 0xB575, 0x7456, 0x53B4, 0x5B93,   // 0x3620 (13856) pixels
-  0x5350, 0x5B90, 0x53B4, 0x7C11, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xAD33, 0xA4D2, 0xCDD5, 0xE5CE, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3630 (13872) pixels
-  0xEDA6, 0xD549, 0xD616, 0xCDD5, 0x9491, 0xB575, 0xB575, 0xCDD5, 0xB575, 0xAD33, 0x9CB2, 0xAD33, 0xAD33, 0xB575, 0xE5CE, 0xEDA6,   // 0x3640 (13888) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xBD0A, 0xCDD5, 0xB575, 0xB575, 0xB575, 0xB575, 0xCDD5, 0xCE38, 0xD616, 0xD658, 0xD616, 0xB575, 0xCE38,   // 0x3650 (13904) pixels
-  0xB575, 0xB575, 0xB575, 0xAD33, 0x8450, 0xD549, 0xEDA6, 0xEDA6, 0xDD46, 0x8C2E, 0x7C0F, 0x6B8E, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3660 (13920) pixels
-  0xEDA6, 0xB4A9, 0x6B8E, 0x63D0, 0x73F0, 0x534E, 0x5B90, 0x6415, 0xA4AD, 0xF607, 0xEDA6, 0xEDA6, 0x31A5, 0x0000, 0x0000, 0x0000,   // 0x3670 (13936) pixels
-  0xB465, 0xEDA6, 0xEDA6, 0xEDA6, 0xA403, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0xA3E3, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3680 (13952) pixels
-  0xDD46, 0x8B63, 0x49C1, 0xEDA6, 0xEDA6, 0xEDA6, 0xBD0A, 0x443D, 0x3BDA, 0x3356, 0x3356, 0x3314, 0x5C18, 0x73CF, 0xEDC9, 0xEDA6,   // 0x3690 (13968) pixels
-  0xEDA6, 0xEDA6, 0xB4A9, 0xE676, 0xEED8, 0xEED8, 0xF719, 0xEED8, 0xF719, 0xF719, 0xE676, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x36A0 (13984) pixels
-  0xD5B2, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xCDD5, 0xB575, 0xA4D2, 0xCDD5, 0xD5B2, 0xE5CE, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x36B0 (14000) pixels
-  0xDD46, 0xD616, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xEED8, 0xEED8, 0xEED8, 0xF719, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x36C0 (14016) pixels
-  0xD549, 0xD616, 0xEED8, 0xEED8, 0xEED8, 0xEED8, 0xB575, 0x9CB2, 0x6B8D, 0x532C, 0x532C, 0x9491, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x36D0 (14032) pixels
-  0xD549, 0xD5B2, 0xCDD5, 0xCDD5, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD616, 0xD616, 0xA4D2, 0xAD33, 0xAD33, 0xCDD5,   // 0x36E0 (14048) pixels
-  0xB575, 0xA4D2, 0xAD33, 0xAD33, 0xB575, 0xCDD5, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB52E, 0xB575, 0xB575, 0xB575, 0xB575,   // 0x36F0 (14064) pixels
-  0xB575, 0xD616, 0xD658, 0xD616, 0xCDD5, 0xD616, 0xCDD5, 0xD616, 0xB575, 0xB575, 0xB575, 0xB575, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3700 (14080) pixels
-  0xD549, 0x8450, 0x7C11, 0x7C11, 0x7C0F, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x7C11, 0x63D0, 0x5B8F, 0x63D2, 0x5B8F, 0x7432,   // 0x3710 (14096) pixels
-  0xA4AD, 0xEDA6, 0xEDA6, 0xDD46, 0x31A5, 0x0000, 0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xB465, 0x0000, 0x0000,   // 0x3720 (14112) pixels
-  0x0000, 0x0000, 0xB465, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0x5C9D,   // 0x3730 (14128) pixels
-  0x43FA, 0x3356, 0x3314, 0x3B97, 0x5C18, 0x7C11, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xA4AD, 0xCDD5, 0xCDD5, 0xE676, 0xF719, 0xF719,   // 0x3740 (14144) pixels
-  0xEED8, 0xF719, 0xF719, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xD616, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xCDD5,   // 0x3750 (14160) pixels
-  0xE676, 0xCDD5, 0xCDD5, 0xD5B2, 0xE5CE, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE676, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEED8,   // 0x3760 (14176) pixels
-  0xF719, 0xEED8, 0xE676, 0xEE52, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xEED8, 0xEED8, 0xD616, 0xD616, 0xE676, 0xE676, 0xD616,   // 0x3770 (14192) pixels
-  0x9CB2, 0x73CF, 0xAD33, 0xE676, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xAD33, 0xCDD5, 0xCDD5, 0xD5B2, 0xF607, 0xEDA6, 0xEDA6,   // 0x3780 (14208) pixels
-  0xEDA6, 0xEDA6, 0xD549, 0xE676, 0xCDD5, 0xB575, 0xAD33, 0xA4D2, 0x9CB2, 0xAD33, 0xB575, 0xB575, 0xAD33, 0xAD33, 0xEDC9, 0xEDA6,   // 0x3790 (14224) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xA4D2, 0xB575, 0xCDD5, 0xB575, 0xB575, 0xB575, 0xCE38, 0xD616, 0xD616, 0xB575, 0xCDD5, 0xD616, 0xD616,   // 0x37A0 (14240) pixels
-  0xB575, 0xD616, 0xCE38, 0xB575, 0xA4D2, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x9491, 0x8C2E, 0x7C11, 0x7C11, 0xD549, 0xEDA6, 0xEDA6,   // 0x37B0 (14256) pixels
-  0xEDA6, 0xDD46, 0x7C11, 0x73F0, 0x5B90, 0x5C15, 0x63D0, 0x5B93, 0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x31A5, 0x0000, 0x0000, 0x0000,   // 0x37C0 (14272) pixels
-  0x18A0, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xA403, 0x0000, 0x0000, 0x0000, 0x0000, 0xB465, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x37D0 (14288) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0x5C9B, 0x3BFC, 0x3356, 0x3314, 0x4376, 0x545A, 0x63D2, 0xDD46, 0xEDA6,   // 0x37E0 (14304) pixels
-  0xEDA6, 0xEDA6, 0xB4A9, 0xB575, 0xCDD5, 0xE676, 0xEED8, 0xEED8, 0xEED8, 0xF719, 0xE676, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x37F0 (14320) pixels
-  0xE676, 0xE676, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xCDD5, 0xE676, 0xE676, 0xB575, 0xD5B2, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3800 (14336) pixels
-  0xD58E, 0xE676, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE676, 0xF719, 0xEED8, 0xD616, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3810 (14352) pixels
-  0xDE32, 0xE676, 0xEED8, 0xEED8, 0xE676, 0xD616, 0xD616, 0xD616, 0xCDD5, 0xCDD5, 0xCDD5, 0xD616, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3820 (14368) pixels
-  0xEDA6, 0xD5B2, 0xCDD5, 0xD616, 0xDE32, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE676, 0xD616, 0xCDD5, 0x9491,   // 0x3830 (14384) pixels
-  0xB575, 0xAD33, 0xCDD5, 0xB575, 0xB575, 0xB575, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xA4AD, 0xB575, 0xB575, 0xCDD5, 0xA4D2,   // 0x3840 (14400) pixels
-  0xB575, 0xB575, 0xCDD5, 0xCE38, 0xB575, 0xB575, 0xCDD5, 0xCDD5, 0xB575, 0xCDD5, 0xAD33, 0x9CB2, 0xD58E, 0xF607, 0xEDA6, 0xEDA6,   // 0x3850 (14416) pixels
-  0xB4A9, 0x9CB2, 0x8C92, 0x7C11, 0x7C11, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x73CD, 0x63D0, 0x5C15, 0x6C99, 0x5C15, 0x6C13,   // 0x3860 (14432) pixels
-  0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0x3121, 0x0000, 0x0000, 0x0000, 0x0000, 0xB465, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x0000, 0x0000,   // 0x3870 (14448) pixels
-  0x0000, 0x0000, 0xB465, 0xEDA6, 0x6AA2, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x6C99,   // 0x3880 (14464) pixels
-  0x3BDA, 0x3B99, 0x3356, 0x3314, 0x545A, 0x6415, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0xB575, 0xB575, 0xCDD5, 0xE676, 0xEED8,   // 0x3890 (14480) pixels
-  0xE676, 0xE676, 0xE676, 0xEE52, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xD616, 0xE676, 0xE676, 0xF607, 0xEDA6, 0xEDA6, 0xDD46, 0xCDD5,   // 0x38A0 (14496) pixels
-  0xE676, 0xEED8, 0xD616, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xE676,   // 0x38B0 (14512) pixels
-  0xF719, 0xEED8, 0xDE98, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDE32, 0xEED8, 0xEED8, 0xF719, 0xE676, 0xE676, 0xD616, 0xEED8,   // 0x38C0 (14528) pixels
-  0xA4D2, 0xD616, 0xB575, 0xB575, 0xF60A, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xD5B2, 0xAD33, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x38D0 (14544) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xEE52, 0xEED8, 0xDE98, 0xCDD5, 0xB575, 0x9D15, 0xB575, 0xAD33, 0xAD33, 0xEDC9, 0xEDA6,   // 0x38E0 (14560) pixels
-  0xEDA6, 0xEDA6, 0xDD46, 0xA4AD, 0xA4F4, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575,   // 0x38F0 (14576) pixels
-  0xB575, 0xB575, 0x7C0F, 0xAD33, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xA4AD, 0x9CB2, 0x8450, 0x73CF, 0x7C11, 0x8C2E, 0xEDA6, 0xEDA6,   // 0x3900 (14592) pixels
-  0xEDA6, 0xEDA6, 0x9429, 0x63D2, 0x5C18, 0x5C18, 0x5C18, 0x6C97, 0xB52E, 0xEDA6, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000,   // 0x3910 (14608) pixels
-  0x0000, 0x8B63, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x0000, 0x0000, 0x0000, 0x1060, 0xB465, 0xEDA6, 0x3121, 0x20E0, 0xB465, 0xEDA6,   // 0x3920 (14624) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x7C95, 0x443D, 0x43D9, 0x3314, 0x2AF4, 0x3314, 0x7497, 0xD549, 0xEDA6,   // 0x3930 (14640) pixels
-  0xEDA6, 0xEDA6, 0xB4A9, 0x9CB2, 0xB575, 0xB575, 0xCDD5, 0xD616, 0xE676, 0xEED8, 0xE676, 0xEE52, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3940 (14656) pixels
-  0xD5B2, 0xE676, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xE676, 0xE676, 0xE676, 0xE5D2, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x3950 (14672) pixels
-  0xE676, 0xD5B2, 0xE5D2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDC9, 0xE676, 0xEED8, 0xEED8, 0xEED8, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x3960 (14688) pixels
-  0xE676, 0xE676, 0xF719, 0xE676, 0xF719, 0xD616, 0xE676, 0xD616, 0xD616, 0xDE98, 0xD616, 0x9CB2, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3970 (14704) pixels
-  0xDD46, 0xD58E, 0xD5B2, 0xD5B2, 0xCDD5, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDE32, 0xEED8,   // 0x3980 (14720) pixels
-  0xD616, 0x7454, 0x53B4, 0x5B93, 0x9CF4, 0xAD33, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xAD33, 0xB575, 0x9CB2, 0xA4D2, 0xB575,   // 0x3990 (14736) pixels
-  0xB575, 0xB575, 0xB575, 0xCE38, 0xCE38, 0xCE38, 0xD616, 0xB575, 0xB575, 0x9CB2, 0x9CB2, 0xCDD5, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x39A0 (14752) pixels
-  0x8C2E, 0x8472, 0x7C11, 0x63D0, 0x73CF, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x9429, 0x5C17, 0x5C18, 0x4C1B, 0x5C18, 0x7D19,   // 0x39B0 (14768) pixels
-  0xAD33, 0xEDA6, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000, 0x0000, 0x49C1, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x0000, 0x0000,   // 0x39C0 (14784) pixels
-  0x0000, 0x0000, 0xC4C5, 0xDD46, 0x20E0, 0x0000, 0x1060, 0x8B63, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C2E,   // 0x39D0 (14800) pixels
-  0x3C1C, 0x3B99, 0x3356, 0x3314, 0x32F4, 0x5C17, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x8472, 0x9CB2, 0xB575, 0xCDD5, 0xCDD5,   // 0x39E0 (14816) pixels
-  0xD616, 0xE676, 0xE676, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xE676, 0xE676, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xE5D2,   // 0x39F0 (14832) pixels
-  0xE676, 0xE676, 0xE676, 0xE5CE, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xD5B2, 0xE676, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEED8,   // 0x3A00 (14848) pixels
-  0xF719, 0xF719, 0xF719, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xE676, 0xEED8, 0xE676, 0xF719, 0xE676, 0xE676, 0xEED8, 0xD616,   // 0x3A10 (14864) pixels
-  0xD616, 0xDE98, 0xB575, 0xB575, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xCDD5, 0xCDD5, 0xE676, 0xE5D2, 0xEDA6, 0xEDA6,   // 0x3A20 (14880) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xD616, 0x6415, 0x53D6, 0x53D6, 0x7456, 0xAD33, 0xF60A, 0xEDA6,   // 0x3A30 (14896) pixels
-  0xEDA6, 0xEDA6, 0xDD46, 0xAD33, 0xA4D2, 0xA4D2, 0xB575, 0xA4F4, 0xB575, 0xB575, 0xB575, 0xB575, 0xCE38, 0xB575, 0xB575, 0xB575,   // 0x3A40 (14912) pixels
-  0xAD33, 0xAD33, 0xB575, 0xB575, 0xF607, 0xEDA6, 0xEDA6, 0xDD46, 0x8C2E, 0x7C11, 0x7C11, 0x6B8E, 0x6B8E, 0x73CD, 0xEDA6, 0xEDA6,   // 0x3A50 (14928) pixels
-  0xEDA6, 0xEDA6, 0xB465, 0x5C17, 0x53D6, 0x43D9, 0x545A, 0x6D1D, 0xAD33, 0xF607, 0xEDA6, 0xEDA6, 0x3121, 0x0000, 0x0000, 0x0000,   // 0x3A60 (14944) pixels
-  0x0000, 0x20E0, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000, 0xC4C5, 0xC4C5, 0x18A0, 0x0000, 0x0000, 0x0000,   // 0x3A70 (14960) pixels
-  0x49C1, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x443D, 0x3356, 0x2B15, 0x2AF4, 0x32F4, 0x5C15, 0xEDC9, 0xEDA6,   // 0x3A80 (14976) pixels
-  0xEDA6, 0xEDA6, 0xB4A9, 0x8472, 0x9CB2, 0xB575, 0x9CB2, 0xB575, 0xCDD5, 0xCDD5, 0xCDD5, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x3A90 (14992) pixels
-  0xEE52, 0xE676, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE676, 0xE676, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549,   // 0x3AA0 (15008) pixels
-  0xD616, 0xEED8, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xEED8, 0xF719, 0xE676, 0xF719, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x3AB0 (15024) pixels
-  0xE676, 0xF719, 0xE676, 0xE676, 0xF719, 0xF719, 0xEED8, 0xE676, 0xD616, 0xD658, 0xD658, 0x9CB2, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3AC0 (15040) pixels
-  0xEDA6, 0xAD33, 0xCDD5, 0xD5B2, 0xE676, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3AD0 (15056) pixels
-  0xD58E, 0x9CF4, 0x53B4, 0x53D6, 0x6C56, 0xB575, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xB575, 0xB575, 0x9CB2, 0xCDD5, 0xB575,   // 0x3AE0 (15072) pixels
-  0xCDD5, 0xB575, 0x9536, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0xB575, 0x8C91, 0xAD33, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5,   // 0x3AF0 (15088) pixels
-  0x7C11, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x73F0, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x53D6, 0x4B96, 0x43D9, 0x5C18, 0x6D1D,   // 0x3B00 (15104) pixels
-  0xAD33, 0xEDA6, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC4C5, 0xEDA6, 0xEDA6, 0xB465, 0x0000, 0x0000,   // 0x3B10 (15120) pixels
-  0x0000, 0x0000, 0xC4C5, 0xA403, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A0, 0x8B63, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5,   // 0x3B20 (15136) pixels
-  0x443D, 0x3B99, 0x3356, 0x2AF4, 0x2AF4, 0x4B95, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0x9429, 0x73F0, 0x8C92, 0xB575, 0xA4D2, 0xB575,   // 0x3B30 (15152) pixels
-  0xB575, 0xCDD5, 0xCDD5, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD616, 0xE676, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x3B40 (15168) pixels
-  0xEED8, 0xE676, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xD616, 0xEED8, 0xEE52, 0xF607, 0xEDA6, 0xEDA6, 0xDD46, 0xE676,   // 0x3B50 (15184) pixels
-  0xE676, 0xE676, 0xF719, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xE676, 0xE676, 0xE676, 0xEED8, 0xE676, 0xEED8, 0xEED8, 0xD616,   // 0x3B60 (15200) pixels
-  0xD616, 0xD616, 0xD616, 0xB575, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xA4AD, 0xCDD5, 0xE676, 0xE676, 0xEE52, 0xEE52, 0xEDA6,   // 0x3B70 (15216) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD616, 0x63D2, 0x53D6, 0x53B4, 0x7432, 0xEDA6, 0xEDA6,   // 0x3B80 (15232) pixels
-  0xEDA6, 0xEDA6, 0xDD46, 0xB575, 0x9CF4, 0x9CB2, 0xB575, 0xB575, 0xB575, 0x9CB2, 0x9CB2, 0x9CB2, 0xB575, 0xB575, 0xB575, 0xB575,   // 0x3B90 (15248) pixels
-  0xB575, 0xB575, 0x9CB2, 0xB52E, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x7C0F, 0x73F0, 0x8C2E, 0x9429, 0xC4E8, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3BA0 (15264) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0x5B93, 0x4B96, 0x43D9, 0x54BE, 0x755E, 0xAD33, 0xF607, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000,   // 0x3BB0 (15280) pixels
-  0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xEDA6, 0xA403, 0x0000, 0x0000, 0x0000, 0x1060, 0xA403, 0xB465, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BC0 (15296) pixels
-  0x0000, 0x0000, 0x0000, 0x3121, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x5C18, 0x3B99, 0x3356, 0x2AF4, 0x2B15, 0x4332, 0xD549, 0xEDA6,   // 0x3BD0 (15312) pixels
-  0xEDA6, 0xEDA6, 0x9429, 0x7C11, 0x8450, 0x9CB2, 0xA4D2, 0xB575, 0xB575, 0xCDD5, 0xCDD5, 0xDE32, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3BE0 (15328) pixels
-  0xE676, 0xE676, 0xE676, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xE676, 0xEED8, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E,   // 0x3BF0 (15344) pixels
-  0xE676, 0xE676, 0xEE52, 0xF607, 0xEDA6, 0xEDA6, 0xDD46, 0xD5B2, 0xE676, 0xE676, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3C00 (15360) pixels
-  0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xEED8, 0xEED8, 0xEED8, 0xEED8, 0xAD33, 0xCDD5, 0xB575, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3C10 (15376) pixels
-  0xEDA6, 0xA4AD, 0xCDD5, 0xE676, 0xE676, 0xCDD5, 0xCDD5, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3C20 (15392) pixels
-  0xEDA6, 0xD549, 0xB575, 0x4B31, 0x53B4, 0x63F4, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x7432, 0x6415, 0x9536, 0xAD33, 0x9D15,   // 0x3C30 (15408) pixels
-  0xB575, 0xB575, 0xB575, 0xB5D8, 0xB575, 0x9536, 0x8CF6, 0x6415, 0x7454, 0x9D15, 0x7C11, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5,   // 0x3C40 (15424) pixels
-  0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x7C0F, 0x4B96, 0x43D9, 0x5C9D, 0x6D1E,   // 0x3C50 (15440) pixels
-  0xAD33, 0xEDA6, 0xEDA6, 0xEDA6, 0x3121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xEDA6, 0xEDA6, 0xB465, 0x0000, 0x0000,   // 0x3C60 (15456) pixels
-  0x0000, 0x0000, 0x8B63, 0x8B63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3C70 (15472) pixels
-  0x6415, 0x3BDA, 0x3356, 0x2B15, 0x2AF4, 0x3B13, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0x9429, 0x73CD, 0x7C11, 0x7C11, 0x8C92, 0x9CB2,   // 0x3C80 (15488) pixels
-  0xAD33, 0xCDD5, 0xCDD5, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xDE32, 0xE676, 0xD616, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3C90 (15504) pixels
-  0xEE52, 0xE676, 0xEE52, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xD658, 0xCDD5, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xE676,   // 0x3CA0 (15520) pixels
-  0xE5F4, 0xD5B2, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xE676, 0xE676, 0xE676, 0xE676, 0xD616, 0xE676, 0xD616, 0xF719,   // 0x3CB0 (15536) pixels
-  0xEED8, 0xD616, 0xCE38, 0xB575, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C2E, 0xAD33, 0xAD33, 0xAD33, 0xA4D2, 0xCDD5, 0xCDD5,   // 0x3CC0 (15552) pixels
-  0xE5CE, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD616, 0x9CF4, 0x5B93, 0x6C13, 0xEDA6, 0xEDA6,   // 0x3CD0 (15568) pixels
-  0xEDA6, 0xEDA6, 0xDD46, 0x63D0, 0x53B4, 0x8CF6, 0x9536, 0xB575, 0x9536, 0x9536, 0xBE38, 0x7454, 0x63F4, 0x4332, 0x32D2, 0x4354,   // 0x3CE0 (15584) pixels
-  0x53D6, 0x7C11, 0x9CF4, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3CF0 (15600) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0x8C2E, 0x4B96, 0x4C1B, 0x5C9D, 0x6D1E, 0xAD33, 0xF607, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000,   // 0x3D00 (15616) pixels
-  0x0000, 0x0000, 0x18A0, 0xDD46, 0xEDA6, 0x6AA2, 0x0000, 0x0000, 0x0000, 0x0000, 0x49C1, 0x5A22, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D10 (15632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C91, 0x3BDA, 0x3356, 0x3356, 0x2AF4, 0x4332, 0xDD46, 0xEDA6,   // 0x3D20 (15648) pixels
-  0xEDA6, 0xEDA6, 0x9429, 0x6B8E, 0x6B8E, 0x7C11, 0x8450, 0x8472, 0x9CB2, 0xB575, 0xCDD5, 0xD616, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3D30 (15664) pixels
-  0xD5B2, 0xD616, 0xD616, 0xCDD5, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xEE2D, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xE676,   // 0x3D40 (15680) pixels
-  0xCDD5, 0xB575, 0xD58E, 0xF607, 0xEDA6, 0xEDA6, 0xDD46, 0xE676, 0xE5F4, 0xE5F4, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x3D50 (15696) pixels
-  0xE5D2, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xEED8, 0xE676, 0xCDD5, 0xB575, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3D60 (15712) pixels
-  0xEDA6, 0xA4D2, 0xB575, 0x9CB2, 0x9471, 0x9CB2, 0xB575, 0xCDD5, 0xD616, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3D70 (15728) pixels
-  0xEDA6, 0xEDA6, 0xEDC9, 0x9D15, 0x7432, 0xB575, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x9CB2, 0x53B4, 0x4332, 0x4332, 0x4354,   // 0x3D80 (15744) pixels
-  0x4332, 0x4332, 0x4B31, 0x32B1, 0x32B1, 0x32B1, 0x32D2, 0x4354, 0x53D6, 0x53B4, 0x7C11, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3D90 (15760) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x4B96, 0x43D9, 0x5C9D, 0x6D1E,   // 0x3DA0 (15776) pixels
-  0xAD33, 0xEDA6, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA3E3, 0xDD46, 0x3121, 0x0000, 0x0000,   // 0x3DB0 (15792) pixels
-  0x0000, 0x0000, 0x0000, 0x18A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA403, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3DC0 (15808) pixels
-  0x8C2E, 0x3C1C, 0x3356, 0x3314, 0x2B15, 0x3B13, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0x9429, 0x532C, 0x73CF, 0x7C0F, 0x7C11, 0x7C11,   // 0x3DD0 (15824) pixels
-  0x9CB2, 0xAD33, 0xB575, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xD5B2, 0xD616, 0xD616, 0xCDD5, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3DE0 (15840) pixels
-  0xD58E, 0xF719, 0xEE2D, 0xF607, 0xEDA6, 0xEDA6, 0xD549, 0xE676, 0xD616, 0xAD33, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xE5F4,   // 0x3DF0 (15856) pixels
-  0xE5D2, 0xE676, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xD5B2, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xEED8,   // 0x3E00 (15872) pixels
-  0xF719, 0xEED8, 0xB575, 0xCDD5, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C2E, 0xA4D2, 0x9471, 0x9471, 0xA4D2, 0xCDD5, 0xCDD5,   // 0x3E10 (15888) pixels
-  0xCDD5, 0xD616, 0xEE52, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDC9, 0xDE98, 0xB575, 0xB575, 0xD549, 0xEDA6,   // 0x3E20 (15904) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0x9491, 0x63D2, 0x4332, 0x32D2, 0x32B1, 0x32B1, 0x2AB2, 0x32B1, 0x2A91, 0x32D2, 0x32B1, 0x32D2, 0x4332,   // 0x3E30 (15920) pixels
-  0x4354, 0x53D6, 0x6415, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3E40 (15936) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x4B96, 0x4C1B, 0x545A, 0x6D1E, 0xB575, 0xF607, 0xF607, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000,   // 0x3E50 (15952) pixels
-  0x0000, 0x0000, 0x0000, 0x5A22, 0x6AA2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E60 (15968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x6AA2, 0xEDA6, 0xEDA6, 0xEDA6, 0xB52E, 0x3C1C, 0x3BDA, 0x3314, 0x2B15, 0x4332, 0xD549, 0xEDA6,   // 0x3E70 (15984) pixels
-  0xEDA6, 0xEDA6, 0x9429, 0x636D, 0x6B8E, 0x73CF, 0x6B8E, 0x7C11, 0x7C11, 0x9CB2, 0xAD33, 0xAD33, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x3E80 (16000) pixels
-  0xD5B2, 0xCDD5, 0xD616, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xE5CE, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xE676,   // 0x3E90 (16016) pixels
-  0xE676, 0xCDD5, 0xB52E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xE5F4, 0xE5D2, 0xE676, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3EA0 (16032) pixels
-  0xEE52, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xEED8, 0xEED8, 0xCDD5, 0xCDD5, 0xCDD5, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3EB0 (16048) pixels
-  0xEDA6, 0xA4D2, 0xB575, 0xA4D2, 0x9CB2, 0xB575, 0xCDD5, 0xCDD5, 0xCDD5, 0xD616, 0xE676, 0xE676, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3EC0 (16064) pixels
-  0xEDA6, 0xEDA6, 0xEDC9, 0xEED8, 0xF719, 0x8450, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xA4AD, 0x84B4, 0x63F4, 0x5B93, 0x32B1,   // 0x3ED0 (16080) pixels
-  0x2A91, 0x32B1, 0x32B1, 0x32D2, 0x32B1, 0x32B1, 0x32D2, 0x3B13, 0x4354, 0x4354, 0x6C13, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3EE0 (16096) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x4B95, 0x4C1B, 0x5C9D, 0x7D9E,   // 0x3EF0 (16112) pixels
-  0xDE32, 0xEDA6, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F00 (16128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x49C1, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3F10 (16144) pixels
-  0xD549, 0x5C9D, 0x3BDA, 0x3356, 0x2AF4, 0x3314, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0x9429, 0x6B8D, 0x532C, 0x7C0F, 0x6B8E, 0x7C0F,   // 0x3F20 (16160) pixels
-  0x73CF, 0x8450, 0x8C92, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xD5B2, 0xAD33, 0xCDD5, 0xD616, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3F30 (16176) pixels
-  0xD549, 0xE676, 0xF607, 0xF607, 0xEDA6, 0xEDA6, 0xEE52, 0xEED8, 0xE676, 0xE676, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE676,   // 0x3F40 (16192) pixels
-  0xE5F4, 0xE5D2, 0xE5F4, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xE676, 0xE676, 0xF719, 0xE676, 0xE676, 0xE676, 0xD616,   // 0x3F50 (16208) pixels
-  0xD616, 0xAD33, 0xB575, 0xCDD5, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x5350, 0x8C92, 0xA4D2, 0x9CB2, 0xA4F4, 0xCDD5, 0xCDD5,   // 0x3F60 (16224) pixels
-  0xD658, 0xCDD5, 0xD616, 0xD658, 0xDE32, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xE676, 0xF719, 0xDE98, 0xF60A, 0xEDA6,   // 0x3F70 (16240) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xA4F4, 0x9CB2, 0x8472, 0x6C13, 0x32B1, 0x32B1, 0x32D2, 0x32B1, 0x2A91, 0x32B1, 0x32B1, 0x32D2,   // 0x3F80 (16256) pixels
-  0x4354, 0x3B13, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xB4A9, 0x8C2E, 0xB465,   // 0x3F90 (16272) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x63D2, 0x4C1B, 0x5C9D, 0x8E1F, 0xDE32, 0xEDA6, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000,   // 0x3FA0 (16288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3FB0 (16304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x6D1D, 0x3C1C, 0x3BDA, 0x3356, 0x4B95, 0xDD46, 0xEDA6,   // 0x3FC0 (16320) pixels
-  0xEDA6, 0xEDA6, 0x9429, 0x636D, 0x534E, 0x532C, 0x532C, 0x63D0, 0x73CF, 0x7C11, 0x8C91, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3FD0 (16336) pixels
-  0xAD33, 0xB575, 0xCDD5, 0xD616, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xE676, 0xEED8,   // 0x3FE0 (16352) pixels
-  0xF719, 0xE676, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xE676, 0xE5F4, 0xE5F4, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x3FF0 (16368) pixels
-  0xEE2D, 0xE676, 0xEED8, 0xE676, 0xE676, 0xE676, 0xE676, 0xCDD5, 0xAD33, 0xCDD5, 0xCDD5, 0xCDD5, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4000 (16384) pixels
-  0xD549, 0x5350, 0x63F4, 0xA4D2, 0x9471, 0xA4F4, 0xB575, 0xCDD5, 0xD658, 0xD616, 0xCDD5, 0xCE38, 0xCDD5, 0xEE52, 0xEDA6, 0xEDA6,   // 0x4010 (16400) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xE676, 0xF719, 0xF719, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xCDD5, 0xB575, 0xAD33, 0xB575,   // 0x4020 (16416) pixels
-  0x5350, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32B1, 0x32D2, 0x32D2, 0x2AB2, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4030 (16432) pixels
-  0xDD46, 0xB4A9, 0xB4A9, 0x8C2E, 0x73F0, 0x7C11, 0x6B8E, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C2E, 0x4C1B, 0x6D1E, 0xAE9F,   // 0x4040 (16448) pixels
-  0xEE52, 0xF607, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4050 (16464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E0, 0xDD46, 0xEDA6, 0xEDA6,   // 0x4060 (16480) pixels
-  0xDD46, 0x7D1B, 0x4C9E, 0x3BDA, 0x3356, 0x3314, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0x9429, 0x532C, 0x532C, 0x532C, 0x534E, 0x6B8D,   // 0x4070 (16496) pixels
-  0x6B8E, 0x73CF, 0x7C0F, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xAD33, 0xCDD5, 0xCDD5, 0xD616, 0xD616, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4080 (16512) pixels
-  0xEDA6, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDC9, 0xE676, 0xEED8, 0xEED8, 0xE676, 0xEE52, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2,   // 0x4090 (16528) pixels
-  0xE5D2, 0xE5F4, 0xE5F4, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676,   // 0x40A0 (16544) pixels
-  0xE676, 0xCDD5, 0xCDD5, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x5B93, 0x5B93, 0xB575, 0x9471, 0xB575, 0xCDD5, 0xD616,   // 0x40B0 (16560) pixels
-  0xD616, 0xDE98, 0xE676, 0xCE38, 0xCDD5, 0xDE98, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD616, 0xEED8, 0xF719, 0xEE2D, 0xF607,   // 0x40C0 (16576) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xCE38, 0xD658, 0xD658, 0xB5D8, 0x42F0, 0x32B1, 0x32D2, 0x2A91, 0x32B1, 0x32B1, 0x32D2, 0x32D2,   // 0x40D0 (16592) pixels
-  0x32D2, 0x32B1, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0x9429, 0x63D0, 0x73CF, 0x8450, 0x6B8E, 0x7C11, 0x7C11, 0x63D0, 0x5B93, 0x63D0,   // 0x40E0 (16608) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x443D, 0x85BE, 0xB6BE, 0xDE32, 0xF607, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000,   // 0x40F0 (16624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4100 (16640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xB575, 0x54BE, 0x443D, 0x3B99, 0x4B95, 0xD549, 0xEDA6,   // 0x4110 (16656) pixels
-  0xEDA6, 0xEDA6, 0x9429, 0x532C, 0x5B8F, 0x532C, 0x532C, 0x532C, 0x6B8E, 0x7C0F, 0x6B8E, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x4120 (16672) pixels
-  0xA4D2, 0xAD33, 0xB575, 0xCDD5, 0xD616, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xF719, 0xF719,   // 0x4130 (16688) pixels
-  0xF719, 0xF719, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE5D2, 0xD5B2, 0xE5D2, 0xE5F4, 0xE5CE, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4140 (16704) pixels
-  0xD549, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676, 0xCDD5, 0xE676, 0xE676, 0xCDD5, 0xCDD5, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4150 (16720) pixels
-  0xB4A9, 0x4332, 0x5B93, 0xB575, 0x9CB2, 0xCDD5, 0xCE38, 0xCE38, 0xD658, 0xD616, 0xDE98, 0xD616, 0xD616, 0xE676, 0xEE2D, 0xEDA6,   // 0x4160 (16736) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xE676, 0xF719, 0xF719, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD616, 0xD616, 0xCE38, 0x7432,   // 0x4170 (16752) pixels
-  0x2270, 0x32B1, 0x2A91, 0x2A91, 0x2A91, 0x32D2, 0x534E, 0x32D2, 0x32D2, 0x4B31, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0x7C11, 0x5B93,   // 0x4180 (16768) pixels
-  0x6B8E, 0x7C11, 0x7C11, 0x8472, 0x73F0, 0x7432, 0x4332, 0x5B93, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0x64DD, 0x8E1F, 0xD73F,   // 0x4190 (16784) pixels
-  0xB52E, 0xEDA6, 0xEDA6, 0xDD46, 0x3121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x41A0 (16800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB465, 0xEDA6, 0xEDA6,   // 0x41B0 (16816) pixels
-  0xEDA6, 0xAD33, 0x6D1E, 0x4C7E, 0x3BDA, 0x4B96, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0x83C9, 0x4332, 0x5350, 0x532C, 0x532C, 0x532C,   // 0x41C0 (16832) pixels
-  0x73CF, 0x5B8F, 0x6B8D, 0x6B8D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C2E, 0x9491, 0x9CB2, 0xB575, 0xB575, 0xF60A, 0xEDA6, 0xEDA6,   // 0x41D0 (16848) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xF719, 0xFF7C, 0xFF7C, 0xFF7C, 0xE676, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2,   // 0x41E0 (16864) pixels
-  0xE5F4, 0xE5F4, 0xD5B2, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE676, 0xE676, 0xE676, 0xE676, 0xD616, 0xEED8, 0xEED8,   // 0x41F0 (16880) pixels
-  0xE676, 0xD616, 0xE676, 0xD5B2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x9429, 0x3B13, 0x5B93, 0xB575, 0xB575, 0xCDD5, 0xB575, 0xA4D2,   // 0x4200 (16896) pixels
-  0xCDD5, 0xD616, 0xCE38, 0xEED8, 0xD616, 0xEED8, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xE676, 0xEED8, 0xF719, 0xEE52, 0xF607,   // 0x4210 (16912) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xD658, 0x9536, 0x42F0, 0x2A91, 0x32B1, 0x2A91, 0x32B1, 0x32B1, 0x534E, 0xB465, 0x32D2,   // 0x4220 (16928) pixels
-  0x32B1, 0x5350, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x63D2, 0x53D6, 0x6B8E, 0x63D0, 0x8450, 0x8450, 0x7C11, 0x63D0, 0x4354, 0x4332,   // 0x4230 (16944) pixels
-  0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x74D8, 0x8E1F, 0xA63D, 0x9429, 0xF607, 0xEDA6, 0xDD46, 0x20E0, 0x0000, 0x0000, 0x0000,   // 0x4240 (16960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4250 (16976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x93A4, 0xEDA6, 0xEDA6, 0xEDA6, 0xB52E, 0x85BE, 0x54BE, 0x443D, 0x5C18, 0xDD46, 0xEDA6,   // 0x4260 (16992) pixels
-  0xEDA6, 0xEDA6, 0x83C9, 0x32D2, 0x3B13, 0x5350, 0x532C, 0x532C, 0x532C, 0x636D, 0x636E, 0x6B6B, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x4270 (17008) pixels
-  0x73CD, 0x8C2E, 0x9CB2, 0xAD33, 0xAD33, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDE32, 0xF719, 0xF719,   // 0x4280 (17024) pixels
-  0xF719, 0xF719, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xD5B2, 0xCDD5, 0xD5B2, 0xE5F4, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4290 (17040) pixels
-  0xEDA6, 0xEE52, 0xE676, 0xE676, 0xE676, 0xD616, 0xE676, 0xEED8, 0xE676, 0xE676, 0xD616, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x42A0 (17056) pixels
-  0x73CD, 0x4332, 0x5374, 0x8CF6, 0xB575, 0xA4D2, 0xA4D2, 0xB575, 0xD658, 0xD658, 0xD616, 0xEED8, 0xD616, 0xEED8, 0xEE2D, 0xEDA6,   // 0x42B0 (17072) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xE676, 0xF719, 0xE676, 0xE676, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0x9CF4, 0x4332, 0x32B1,   // 0x42C0 (17088) pixels
-  0x2A91, 0x2270, 0x32B1, 0x2A91, 0x4B0F, 0xD549, 0xDD46, 0x32B1, 0x2A91, 0x5B8F, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x53B4, 0x53D6,   // 0x42D0 (17104) pixels
-  0x534E, 0x63D0, 0x8472, 0x9CB2, 0x8472, 0x63D0, 0x4354, 0x4354, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x9558, 0x9E3E, 0x6C99,   // 0x42E0 (17120) pixels
-  0x7347, 0xEDA6, 0xEDA6, 0x6AA2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x42F0 (17136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x8B63, 0xEDA6,   // 0x4300 (17152) pixels
-  0xEDA6, 0xB4A9, 0x9E3E, 0x6D1E, 0x4C7E, 0x4C19, 0xD549, 0xF607, 0xEDA6, 0xEDA6, 0x6B6B, 0x2A91, 0x2AB2, 0x3B13, 0x4B31, 0x532C,   // 0x4310 (17168) pixels
-  0x532C, 0x532C, 0x532C, 0x6B8D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x73CD, 0x6B8E, 0x8450, 0x8C91, 0x9D13, 0xD58E, 0xEDA6, 0xEDA6,   // 0x4320 (17184) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xD5B2, 0xE676, 0xF719, 0xF719, 0xF719, 0xEE52, 0xF607, 0xF607, 0xEDA6, 0xDD46, 0xCDD5,   // 0x4330 (17200) pixels
-  0xD5B2, 0xCDD5, 0xCDD5, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xE676, 0xE676, 0xE676, 0xCDD5, 0xE676, 0xE676,   // 0x4340 (17216) pixels
-  0xD616, 0xCDD5, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x5350, 0x4332, 0x4354, 0x5372, 0x6C13, 0xAD33, 0xB575, 0xCDD5,   // 0x4350 (17232) pixels
-  0xCE38, 0xD616, 0xD616, 0xCDD5, 0xEED8, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xE676, 0xEED8, 0xE676, 0xE676, 0xF607,   // 0x4360 (17248) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0x32B1, 0x2A91, 0x32B1, 0x2A91, 0x2A91, 0x4B0F, 0xD549, 0xEDA6, 0xDD46, 0x32B1,   // 0x4370 (17264) pixels
-  0x32B1, 0x73CD, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x4B96, 0x5C17, 0x5350, 0x63D0, 0x7C11, 0x8472, 0x7432, 0x63D2, 0x3314, 0x3314,   // 0x4380 (17280) pixels
-  0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB575, 0x9E3E, 0x3A8F, 0x49C1, 0x93A4, 0x3121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4390 (17296) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x43A0 (17312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3121, 0x6AA2, 0x7347, 0x855A, 0x6D1E, 0x54BE, 0x5C9B, 0xD549, 0xEDA6,   // 0x43B0 (17328) pixels
-  0xEDA6, 0xEDA6, 0x83C9, 0x2AB2, 0x2AB2, 0x2AB2, 0x4354, 0x5372, 0x534E, 0x5B8F, 0x636E, 0x6B6B, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x43C0 (17344) pixels
-  0x73CD, 0x73CF, 0x6B8E, 0x7C0F, 0x73CF, 0xA4D2, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0xD616, 0xD658, 0xE676,   // 0x43D0 (17360) pixels
-  0xEED8, 0xF719, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xD616, 0xE5F4, 0xCDD5, 0xE676, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x43E0 (17376) pixels
-  0xEDA6, 0xD549, 0xE676, 0xE676, 0xE676, 0xCDD5, 0xCDD5, 0xCDD5, 0xCDD5, 0xD616, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x43F0 (17392) pixels
-  0x5B93, 0x5374, 0x4332, 0x5B93, 0x8C2E, 0xAD33, 0xA4D2, 0xB575, 0xCDD5, 0xB575, 0xCDD5, 0xD616, 0xE676, 0xE676, 0xF60A, 0xEDA6,   // 0x4400 (17408) pixels
-  0xEDA6, 0xEDA6, 0xEDC9, 0xE676, 0xE676, 0xE676, 0xD616, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x83C9, 0x42EE,   // 0x4410 (17424) pixels
-  0x2A91, 0x3A8F, 0x73CD, 0xDD46, 0xEDA6, 0xEDA6, 0xDD46, 0x3A8F, 0x32B1, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0x9429, 0x4354, 0x53F8,   // 0x4420 (17440) pixels
-  0x53B4, 0x534E, 0x73F0, 0x7C11, 0x73F0, 0x5B93, 0x3314, 0x3314, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB575, 0x9DDC, 0x1948,   // 0x4430 (17456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4440 (17472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4450 (17488) pixels
-  0x0000, 0x0042, 0x53B4, 0x9E3E, 0x6D1E, 0x5C9D, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0x83C9, 0x2A91, 0x2AB2, 0x2A91, 0x2AB2, 0x3B13,   // 0x4460 (17504) pixels
-  0x4332, 0x4332, 0x5B90, 0x6B8E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x73CF, 0x6B8E, 0x6B8E, 0x73CF, 0x7C0F, 0x8C2E, 0xEDA6, 0xEDA6,   // 0x4470 (17520) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0xB575, 0xCDD5, 0xD616, 0xD616, 0xD616, 0xDE32, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xCDD5,   // 0x4480 (17536) pixels
-  0xE676, 0xE676, 0xE676, 0xE676, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xE676, 0xE5F4, 0xD5B2, 0xE676, 0xD5B2,   // 0x4490 (17552) pixels
-  0xD5B2, 0xD5B2, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0x7454, 0x5372, 0x4354, 0x4354, 0xD549, 0xDD46, 0xAD33, 0xAD33,   // 0x44A0 (17568) pixels
-  0xCDD5, 0xB575, 0xD616, 0xE676, 0xE676, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE676, 0xE676, 0xE676, 0xE676, 0xE676,   // 0x44B0 (17584) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x32B1,   // 0x44C0 (17600) pixels
-  0x2A91, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C2E, 0x4354, 0x53D6, 0x53D6, 0x532C, 0x6B8E, 0x6B8E, 0x63D0, 0x53B4, 0x3314, 0x3314,   // 0x44D0 (17616) pixels
-  0x5B93, 0xF607, 0xEDA6, 0xD549, 0xB52E, 0xB65C, 0x5C15, 0x0883, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x44E0 (17632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x44F0 (17648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A0A, 0x9E3E, 0x7D9E, 0x54BE, 0x7497, 0xD549,   // 0x4500 (17664) pixels
-  0xEDA6, 0xEDA6, 0x6B6B, 0x2AB2, 0x2AB2, 0x2A91, 0x2270, 0x2A91, 0x2A91, 0x2A91, 0x32D2, 0x4B31, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46,   // 0x4510 (17680) pixels
-  0x6B6B, 0x636D, 0x6B8D, 0x6B8E, 0x7C0F, 0x7C0F, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x8C2E, 0xAD33, 0xAD33, 0xB575,   // 0x4520 (17696) pixels
-  0xAD33, 0xB575, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xCDD5, 0xD616, 0xCDD5, 0xE676, 0xE5F4, 0xEE52, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4530 (17712) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xE5D2, 0xE5D2, 0xD5B2, 0xE5D2, 0xCDD5, 0xD5B2, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xA4AD,   // 0x4540 (17728) pixels
-  0xAD33, 0x84B4, 0x53B4, 0x4332, 0xDD46, 0xEDA6, 0xDD46, 0xA4AD, 0xB575, 0xB575, 0xCDD5, 0xE676, 0xE676, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4550 (17744) pixels
-  0xEDA6, 0xEDA6, 0xD549, 0xEED8, 0xEED8, 0xEED8, 0xEED8, 0xD616, 0xF60A, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4560 (17760) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x2A91, 0x2A91, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x73CF, 0x4354, 0x4376,   // 0x4570 (17776) pixels
-  0x53D6, 0x534E, 0x6B8E, 0x63D0, 0x73F0, 0x53D6, 0x3314, 0x3314, 0x3356, 0x8450, 0x6C13, 0x5C9B, 0x7D9E, 0x9DDC, 0x21CA, 0x0000,   // 0x4580 (17792) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4590 (17808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x45A0 (17824) pixels
-  0x0000, 0x0000, 0x08A4, 0x6C56, 0x9E3E, 0x54BE, 0x4C9E, 0x5C18, 0x73F0, 0x8C2E, 0x4B31, 0x2AB2, 0x2AB2, 0x2AB2, 0x2A91, 0x2A91,   // 0x45B0 (17840) pixels
-  0x2270, 0x2A91, 0x2AB2, 0x5350, 0xDD46, 0xEDA6, 0xEDA6, 0xDD46, 0x6B8D, 0x6B8E, 0x532C, 0x7C0F, 0x6B8E, 0x7C11, 0xB4A9, 0xEDA6,   // 0x45C0 (17856) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x83C9, 0x8450, 0x8C91, 0x9CB2, 0x9491, 0xA4D2, 0xB52E, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xD5B2,   // 0x45D0 (17872) pixels
-  0xD5B2, 0xCDD5, 0xD5B2, 0xCDD5, 0xCDD5, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD549, 0xE5CE, 0xD58E, 0xE5CE,   // 0x45E0 (17888) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xAD33, 0xB575, 0xB575, 0x5372, 0x53B4, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x45F0 (17904) pixels
-  0xD549, 0xD58E, 0xD58E, 0xEE2D, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD5B2, 0xEED8, 0xD658, 0xD658, 0xD616, 0xB575,   // 0x4600 (17920) pixels
-  0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x2A91,   // 0x4610 (17936) pixels
-  0x42F0, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x5B90, 0x4354, 0x4354, 0x53D6, 0x5B93, 0x534E, 0x63D0, 0x63F4, 0x5B93, 0x3314, 0x3356,   // 0x4620 (17952) pixels
-  0x3356, 0x3B99, 0x4C1B, 0x54BE, 0xA65E, 0x6415, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4630 (17968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4640 (17984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1925, 0x10A2, 0x0000, 0x0000, 0x0000, 0x324D, 0xA63D, 0x7D9E, 0x54BE, 0x3C1C,   // 0x4650 (18000) pixels
-  0x43D9, 0x3356, 0x2B36, 0x2AF4, 0x2AB2, 0x2AB2, 0x2A91, 0x2AB2, 0x2270, 0x2A91, 0x2A91, 0x4B31, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4660 (18016) pixels
-  0x530B, 0x532C, 0x532C, 0x73CF, 0x6B8E, 0x6B8E, 0xB4A9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x73CD, 0x7C0F, 0x8C2E, 0x8C91,   // 0x4670 (18032) pixels
-  0x8C2E, 0x9491, 0xA4AD, 0xF607, 0xEDA6, 0xEDA6, 0xDD46, 0xD5B2, 0xAD33, 0xCDD5, 0xA4D2, 0xCDD5, 0xCDD5, 0xE5CE, 0xEDA6, 0xEDA6,   // 0x4680 (18048) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0xAD33,   // 0x4690 (18064) pixels
-  0xB575, 0xB575, 0x63D2, 0x53B4, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x46A0 (18080) pixels
-  0xEDA6, 0xDD46, 0xEED8, 0xEED8, 0xD658, 0xCDD5, 0x63D0, 0x42F0, 0x32D2, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x46B0 (18096) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x636D, 0x2A91, 0x636E, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x5372, 0x4354, 0x3314,   // 0x46C0 (18112) pixels
-  0x4B96, 0x53D6, 0x534E, 0x7C11, 0x53B4, 0x534E, 0x4354, 0x3356, 0x3B99, 0x43FA, 0x4C9E, 0x7D9E, 0xBE9D, 0x2A0C, 0x0000, 0x0000,   // 0x46D0 (18128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x46E0 (18144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x46F0 (18160) pixels
-  0x0000, 0x0000, 0x0000, 0x08A4, 0x6C56, 0xAE9F, 0x6D1E, 0x443D, 0x43FA, 0x3B99, 0x3356, 0x3314, 0x2AB2, 0x2AB2, 0x2A91, 0x2A91,   // 0x4700 (18176) pixels
-  0x2A91, 0x2AB2, 0x2A91, 0x32B1, 0xC4E8, 0xEDA6, 0xEDA6, 0xDD46, 0x530B, 0x532C, 0x6B8E, 0x6B8E, 0x73CF, 0x532C, 0x8C2E, 0xEDA6,   // 0x4710 (18192) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x8C2E, 0x6B8E, 0x73CF, 0x6B8E, 0x73CF, 0x73CF, 0xA4AD, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xA4D2,   // 0x4720 (18208) pixels
-  0x9CB2, 0xAD33, 0x9491, 0xD5B2, 0xCDD5, 0xCDD5, 0xF607, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4730 (18224) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0xAD33, 0xB575, 0xAD33, 0xB575, 0x63D2, 0x5B93, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4740 (18240) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xD58E, 0xCDD5, 0xCDD5, 0xCE38, 0x7432, 0x32B1, 0x32D2,   // 0x4750 (18256) pixels
-  0x32B1, 0x6B8E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x83C9, 0x2270, 0x2A91,   // 0x4760 (18272) pixels
-  0x73CD, 0xEDA6, 0xEDA6, 0xEDA6, 0x9429, 0x4354, 0x3314, 0x4354, 0x4376, 0x5C17, 0x5350, 0x63F4, 0x53B4, 0x4B31, 0x3314, 0x3356,   // 0x4770 (18288) pixels
-  0x3B99, 0x4C1B, 0x54BE, 0xAE9F, 0x6C56, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4780 (18304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4790 (18320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21CA, 0xA65E, 0x85BE, 0x54BE,   // 0x47A0 (18336) pixels
-  0x43FA, 0x3B99, 0x3356, 0x3356, 0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2270, 0x2A91, 0x2AB2, 0x32B1, 0x636D, 0x8C2E, 0x9429,   // 0x47B0 (18352) pixels
-  0x532C, 0x532C, 0x532C, 0x530B, 0x530B, 0x530B, 0x6B6B, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x6B8D, 0x73CF, 0x6B8E, 0x6B8D,   // 0x47C0 (18368) pixels
-  0x6B8D, 0x6B8D, 0x9429, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x9491, 0x9491, 0x9491, 0xA4D2, 0xCDD5, 0xD5B2, 0xCDD5, 0xE5CE, 0xEDA6,   // 0x47D0 (18384) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB4A9, 0xA4D2, 0xA4D2,   // 0x47E0 (18400) pixels
-  0xA4D2, 0x9491, 0x8C92, 0x63D2, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x47F0 (18416) pixels
-  0xD549, 0xCDD5, 0xB575, 0x8CF6, 0x63D2, 0x32B1, 0x32D2, 0x32D2, 0x32B1, 0x32B1, 0x8C2E, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4800 (18432) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0x6B6B, 0x2270, 0x2A91, 0x2A91, 0x42EE, 0x6B6B, 0x6B6B, 0x32B1, 0x2AB2, 0x3314, 0x4354, 0x3314,   // 0x4810 (18448) pixels
-  0x4354, 0x5C17, 0x53D6, 0x4B96, 0x4B95, 0x4B93, 0x3356, 0x3356, 0x3BDA, 0x443D, 0x755E, 0xB65C, 0x2A0C, 0x0000, 0x0000, 0x0000,   // 0x4820 (18464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4830 (18480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4840 (18496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x6415, 0xA65E, 0x6D1E, 0x443D, 0x43FA, 0x3B99, 0x3356, 0x2AF4, 0x2AF4, 0x2AB2, 0x2AB2,   // 0x4850 (18512) pixels
-  0x2AB2, 0x2A91, 0x2A91, 0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x4B95, 0x53B4, 0x5B93, 0x5B8F, 0x4ACC, 0x530B, 0x532C, 0x532C, 0xB4A9,   // 0x4860 (18528) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0x83C9, 0x636D, 0x73CF, 0x6B8E, 0x636D, 0x636D, 0x636D, 0x9429, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x8450,   // 0x4870 (18544) pixels
-  0x9491, 0xA4D2, 0xAD33, 0xAD33, 0xA4D2, 0xAD33, 0xAD33, 0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4880 (18560) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x73CF, 0x73CF, 0x8450, 0x9471, 0x9491, 0x9491, 0xB575, 0xD58E, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x4890 (18576) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x9491, 0x5B93, 0x5372, 0x3B13, 0x32B1, 0x32B1, 0x32D2, 0x32B1,   // 0x48A0 (18592) pixels
-  0x32D2, 0x32B1, 0x2A91, 0x6B8D, 0xDD46, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x532C, 0x222F, 0x32B1, 0x2270, 0x2A91,   // 0x48B0 (18608) pixels
-  0x2270, 0x2A91, 0x2A91, 0x2A91, 0x32D2, 0x4354, 0x4354, 0x3314, 0x4354, 0x43D9, 0x4B96, 0x3314, 0x3314, 0x3314, 0x3356, 0x3B99,   // 0x48C0 (18624) pixels
-  0x443D, 0x54BE, 0xC6DE, 0x6415, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x48D0 (18640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x48E0 (18656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21CA, 0xA5FC, 0x85BE,   // 0x48F0 (18672) pixels
-  0x54BE, 0x4C1B, 0x3B99, 0x3356, 0x3356, 0x2AF4, 0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2270, 0x2AB2, 0x2AB2, 0x32D2, 0x3B13,   // 0x4900 (18688) pixels
-  0x4354, 0x53D6, 0x53B4, 0x534E, 0x42AA, 0x532C, 0x532C, 0x532C, 0x530B, 0x83C9, 0x6B6B, 0x530B, 0x532C, 0x532C, 0x636D, 0x6B8D,   // 0x4910 (18704) pixels
-  0x636D, 0x6B8E, 0x73CD, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x73CF, 0x73CF, 0x9471, 0x9CB2, 0xA4D2, 0xAD33, 0xAD33, 0xB575, 0xAD33,   // 0x4920 (18720) pixels
-  0xEDC9, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xC4C5, 0x73CD, 0x6B8D, 0x6B8E, 0x6B8E,   // 0x4930 (18736) pixels
-  0x8C2E, 0x9CB2, 0x9CB2, 0xA4D2, 0xB575, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xDD46, 0x73CD,   // 0x4940 (18752) pixels
-  0x4B31, 0x32D2, 0x32D2, 0x42F0, 0x32D2, 0x32D2, 0x32B1, 0x32B1, 0x2A91, 0x2270, 0x2270, 0x326E, 0x222F, 0x6B6B, 0x83C9, 0x9429,   // 0x4950 (18768) pixels
-  0x83C9, 0x4B0D, 0x32B1, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2A91, 0x2A91, 0x2A91, 0x2AB2, 0x2AB2, 0x3314, 0x4354, 0x3314,   // 0x4960 (18784) pixels
-  0x4B96, 0x4B96, 0x4376, 0x3314, 0x3314, 0x3356, 0x3378, 0x3BDA, 0x443D, 0x95FE, 0xA63D, 0x21CA, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4970 (18800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4980 (18816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4990 (18832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x4332, 0xA65E, 0x755E, 0x443D, 0x3BDA, 0x3378, 0x2B36, 0x2AF4, 0x2AB2, 0x2AB2,   // 0x49A0 (18848) pixels
-  0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x2AB2, 0x32D2, 0x32D2, 0x32D2, 0x3B13, 0x4354, 0x5B93, 0x534E, 0x42AA, 0x530B, 0x532C,   // 0x49B0 (18864) pixels
-  0x42AA, 0x42AA, 0x532C, 0x530B, 0x532C, 0x532C, 0x530B, 0x532C, 0x530B, 0x532C, 0x530B, 0x6B6B, 0x83C9, 0x83C9, 0x6B6B, 0x636D,   // 0x49C0 (18880) pixels
-  0x6B8E, 0x73CF, 0x73CF, 0x8C2E, 0x9491, 0x9491, 0xA4D2, 0xAD33, 0xA4D2, 0xD549, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6,   // 0x49D0 (18896) pixels
-  0xEDA6, 0xEDA6, 0xB465, 0x6B8D, 0x6B8E, 0x532C, 0x6B8D, 0x6B8E, 0x8450, 0x8450, 0x9CB2, 0x8450, 0x9CB2, 0x8450, 0xA4AD, 0xEDA6,   // 0x49E0 (18912) pixels
-  0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xEDA6, 0xB465, 0x534E, 0x32D2, 0x32B1, 0x32B1, 0x32B1, 0x32D2, 0x4332, 0x4332, 0x4332, 0x63D2,   // 0x49F0 (18928) pixels
-  0x32B1, 0x222F, 0x2270, 0x2270, 0x2270, 0x222F, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,   // 0x4A00 (18944) pixels
-  0x2270, 0x2A91, 0x2A91, 0x2AB2, 0x32D2, 0x4354, 0x4354, 0x3314, 0x4B96, 0x4376, 0x3356, 0x3314, 0x3356, 0x3356, 0x3B99, 0x3C1C,   // 0x4A10 (18960) pixels
-  0x54BE, 0xB6BE, 0x4332, 0x0883, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4A20 (18976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4A30 (18992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x8519,   // 0x4A40 (19008) pixels
-  0xA65E, 0x54BE, 0x3BDA, 0x3B99, 0x3356, 0x3356, 0x2B15, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x2AB2, 0x32D2,   // 0x4A50 (19024) pixels
-  0x3B13, 0x3314, 0x4354, 0x4354, 0x5B93, 0x42AA, 0x530B, 0x42AA, 0x42AA, 0x42AA, 0x532C, 0x530B, 0x532C, 0x530B, 0x530B, 0x530B,   // 0x4A60 (19040) pixels
-  0x532C, 0x530B, 0x532C, 0x532C, 0x530B, 0x530B, 0x530B, 0x530B, 0x532C, 0x6B6B, 0x636D, 0x6B8E, 0x6B8E, 0x6B8E, 0x8C2E, 0x9471,   // 0x4A70 (19056) pixels
-  0x73CF, 0x73CF, 0x73CF, 0xB4A9, 0xD549, 0xD549, 0xDD46, 0xDD46, 0xB4A9, 0x73CD, 0x6B8D, 0x532C, 0x530B, 0x6B8D, 0x7C0F, 0x73CF,   // 0x4A80 (19072) pixels
-  0x73CF, 0x73CF, 0x8450, 0x9CB2, 0x9CB2, 0x9491, 0x9CB2, 0x8472, 0x8C2E, 0x9429, 0xB4A9, 0x8C2E, 0x534E, 0x42F0, 0x32B1, 0x32D2,   // 0x4A90 (19088) pixels
-  0x32B1, 0x32D2, 0x4332, 0x5372, 0x4354, 0x4354, 0x53B4, 0x32B1, 0x32B1, 0x222F, 0x222F, 0x2270, 0x222F, 0x2A91, 0x222F, 0x2270,   // 0x4AA0 (19104) pixels
-  0x2270, 0x2270, 0x2270, 0x2270, 0x2A91, 0x2270, 0x2A91, 0x2270, 0x2A91, 0x2270, 0x2A91, 0x2AB2, 0x32F4, 0x4354, 0x3314, 0x3356,   // 0x4AB0 (19120) pixels
-  0x4376, 0x3314, 0x3356, 0x3314, 0x3356, 0x3B99, 0x3BDA, 0x54BE, 0xA65E, 0x957A, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4AC0 (19136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4AD0 (19152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4AE0 (19168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x326E, 0xB67E, 0x85BE, 0x443D, 0x3BDA, 0x3B99, 0x3356, 0x3314, 0x3314,   // 0x4AF0 (19184) pixels
-  0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x3314, 0x3B13, 0x3B13, 0x4354, 0x53B4, 0x4332, 0x42AA, 0x42AA, 0x42AA,   // 0x4B00 (19200) pixels
-  0x42AA, 0x532C, 0x532C, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x532C, 0x530B, 0x530B, 0x42AA, 0x530B,   // 0x4B10 (19216) pixels
-  0x530B, 0x530B, 0x532C, 0x6B6B, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8E, 0x6B8D, 0x73CD, 0x6B8D, 0x6B8D, 0x6B8D, 0x6B8D, 0x6B8E,   // 0x4B20 (19232) pixels
-  0x6B8E, 0x6B8E, 0x530B, 0x530B, 0x530B, 0x6B8D, 0x6B8E, 0x73CF, 0x73CF, 0x73CF, 0x9471, 0x9CB2, 0xA4D2, 0x9471, 0x8450, 0x63D2,   // 0x4B30 (19248) pixels
-  0x4354, 0x4354, 0x4B31, 0x32B1, 0x42F0, 0x4332, 0x4332, 0x5372, 0x53B4, 0x63D2, 0x9536, 0x6415, 0x4332, 0x32D2, 0x2270, 0x222F,   // 0x4B40 (19264) pixels
-  0x2270, 0x222F, 0x222F, 0x2A91, 0x2A91, 0x222F, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,   // 0x4B50 (19280) pixels
-  0x2A91, 0x2A91, 0x2270, 0x2AB2, 0x3314, 0x4354, 0x3314, 0x4376, 0x3314, 0x3356, 0x3314, 0x3356, 0x3356, 0x3BDA, 0x4C7E, 0x7D9E,   // 0x4B60 (19296) pixels
-  0xC6DE, 0x3A8F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4B70 (19312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4B80 (19328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10C5,   // 0x4B90 (19344) pixels
-  0x53B4, 0xA65E, 0x6D1E, 0x443D, 0x3BDA, 0x3356, 0x3356, 0x3314, 0x3314, 0x32D2, 0x2AB2, 0x2A91, 0x2A91, 0x2AB2, 0x2AB2, 0x32D2,   // 0x4BA0 (19360) pixels
-  0x32D2, 0x3314, 0x4376, 0x53B4, 0x4ACC, 0x42AA, 0x42AA, 0x3A8A, 0x3A6A, 0x3A6A, 0x42AA, 0x4B0D, 0x42AA, 0x530B, 0x52EB, 0x530B,   // 0x4BB0 (19376) pixels
-  0x42AA, 0x530B, 0x42AA, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x532C, 0x532C, 0x530B, 0x636D, 0x636D, 0x6B8D, 0x6B8E,   // 0x4BC0 (19392) pixels
-  0x530B, 0x636D, 0x532C, 0x636D, 0x636D, 0x636D, 0x6B8D, 0x636D, 0x636D, 0x6B6B, 0x530B, 0x530B, 0x530B, 0x636D, 0x6B8D, 0x6B8D,   // 0x4BD0 (19408) pixels
-  0x6B8E, 0x6B8E, 0x8C2E, 0xA4D2, 0x9CB2, 0xA4D2, 0xA4F4, 0xB575, 0x63D2, 0x4354, 0x4354, 0x63F4, 0x63F4, 0x8474, 0x9D15, 0xB575,   // 0x4BE0 (19424) pixels
-  0xCDD5, 0xCDD5, 0xCE38, 0x63D2, 0x32B1, 0x222F, 0x2270, 0x2270, 0x222F, 0x222F, 0x222F, 0x222F, 0x2270, 0x32B1, 0x2A91, 0x2A91,   // 0x4BF0 (19440) pixels
-  0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2AB2, 0x2270, 0x2AB2, 0x2AB2, 0x3314, 0x4354, 0x3314, 0x3356,   // 0x4C00 (19456) pixels
-  0x3314, 0x3314, 0x3314, 0x3356, 0x3BDA, 0x4C7E, 0x6D1E, 0xB6BE, 0x6415, 0x10C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4C10 (19472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4C20 (19488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4C30 (19504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1948, 0x855A, 0x9E3E, 0x64FE, 0x443D, 0x3B99, 0x3356, 0x3356,   // 0x4C40 (19520) pixels
-  0x32F4, 0x3314, 0x2AB2, 0x2AB2, 0x2270, 0x2270, 0x2AB2, 0x32D2, 0x32D2, 0x3314, 0x4B96, 0x5372, 0x4B0D, 0x3A8A, 0x42AA, 0x3A8A,   // 0x4C50 (19536) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A8A, 0x530B, 0x530B, 0x42AA, 0x530B, 0x530B, 0x530B, 0x530B, 0x42AA, 0x42AA, 0x530B,   // 0x4C60 (19552) pixels
-  0x530B, 0x532C, 0x530B, 0x530B, 0x530B, 0x532C, 0x532C, 0x73CF, 0x6B8D, 0x636D, 0x532C, 0x530B, 0x636D, 0x532C, 0x6B8D, 0x532C,   // 0x4C70 (19568) pixels
-  0x532C, 0x530B, 0x532C, 0x530B, 0x532C, 0x532C, 0x636D, 0x6B8E, 0x8C2E, 0x73CF, 0x73CF, 0x9CB2, 0xB575, 0xB575, 0xB575, 0xCDD5,   // 0x4C80 (19584) pixels
-  0xB575, 0x84B4, 0xB575, 0xCDD5, 0xCDD5, 0xCDD5, 0xE676, 0xD616, 0xD616, 0xD616, 0xB575, 0x4332, 0x222F, 0x222F, 0x222F, 0x222F,   // 0x4C90 (19600) pixels
-  0x222F, 0x222F, 0x2270, 0x2270, 0x32B1, 0x32B1, 0x32B1, 0x2A91, 0x2A91, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2A91,   // 0x4CA0 (19616) pixels
-  0x2270, 0x2AB2, 0x2AB2, 0x32D2, 0x3314, 0x3314, 0x4B96, 0x3314, 0x3314, 0x2B15, 0x3356, 0x3B99, 0x3C1C, 0x54BE, 0x9E3E, 0x855A,   // 0x4CB0 (19632) pixels
-  0x21CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4CC0 (19648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4CD0 (19664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4CE0 (19680) pixels
-  0x0000, 0x3A8F, 0xB6BE, 0x85BE, 0x54BE, 0x443D, 0x3356, 0x2B15, 0x2AF4, 0x2AB2, 0x2AB2, 0x2A91, 0x2AB2, 0x2A91, 0x2270, 0x2AB2,   // 0x4CF0 (19696) pixels
-  0x2AB2, 0x32D2, 0x4B95, 0x5B90, 0x42AA, 0x4ACC, 0x42AA, 0x3A6A, 0x42AA, 0x42AA, 0x3A8A, 0x42AA, 0x42AA, 0x3A8A, 0x42AA, 0x42AA,   // 0x4D00 (19712) pixels
-  0x530B, 0x532C, 0x530B, 0x530B, 0x532C, 0x42AA, 0x530B, 0x42AA, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x532C,   // 0x4D10 (19728) pixels
-  0x532C, 0x6B6B, 0x530B, 0x530B, 0x636D, 0x6B8D, 0x636D, 0x532C, 0x532C, 0x530B, 0x530B, 0x530B, 0x532C, 0x532C, 0x6B8D, 0x6B8E,   // 0x4D20 (19744) pixels
-  0x6B8E, 0x73CF, 0x8450, 0x73F0, 0x8C2E, 0x8450, 0x9491, 0xA4F4, 0xCDD5, 0xCDD5, 0xCDD5, 0xCDD5, 0xCDD5, 0xD616, 0xD616, 0xCDD5,   // 0x4D30 (19760) pixels
-  0xCDD5, 0xCE38, 0x63D0, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x2270, 0x222F, 0x2A91, 0x32B1, 0x32B1, 0x2A91, 0x32B1,   // 0x4D40 (19776) pixels
-  0x32D2, 0x2A91, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x2AB2, 0x32D2, 0x2AB2, 0x2AB2, 0x32D2, 0x3314, 0x4354, 0x3356, 0x3314,   // 0x4D50 (19792) pixels
-  0x2AF4, 0x3356, 0x3378, 0x3BFC, 0x54BE, 0x7D9E, 0xA65E, 0x326E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4D60 (19808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4D70 (19824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4D80 (19840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x53B4, 0x9E3E, 0x755E, 0x4C9E, 0x43FA, 0x3356,   // 0x4D90 (19856) pixels
-  0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2, 0x2A91, 0x2A91, 0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x3314, 0x4B95, 0x42AA, 0x3A8A, 0x4ACC, 0x42AA,   // 0x4DA0 (19872) pixels
-  0x3A69, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x532C, 0x530B, 0x532C, 0x530B, 0x42AA, 0x42AA, 0x42AA,   // 0x4DB0 (19888) pixels
-  0x42AA, 0x530B, 0x530B, 0x530B, 0x530B, 0x530B, 0x6B6B, 0x532C, 0x6B6B, 0x532C, 0x532C, 0x6B6B, 0x532C, 0x532C, 0x532C, 0x532C,   // 0x4DC0 (19904) pixels
-  0x532C, 0x530B, 0x42AA, 0x42AA, 0x532C, 0x532C, 0x6B8E, 0x73CF, 0x7C11, 0x7C0F, 0x6B8E, 0x6B8E, 0x73CF, 0x8C2E, 0xA4D2, 0xA4D2,   // 0x4DD0 (19920) pixels
-  0xAD33, 0xA4D2, 0xA4D2, 0xC4F2, 0xCDD5, 0xE676, 0xD616, 0xD616, 0xCDD5, 0x8472, 0x222F, 0x222F, 0x222F, 0x2A0C, 0x222F, 0x222F,   // 0x4DE0 (19936) pixels
-  0x222F, 0x222F, 0x2270, 0x2270, 0x2A91, 0x2AB2, 0x32D2, 0x32D2, 0x2A91, 0x2A91, 0x2A91, 0x2A91, 0x2270, 0x2AB2, 0x32D2, 0x32D2,   // 0x4DF0 (19952) pixels
-  0x2AB2, 0x2AB2, 0x2AB2, 0x32F4, 0x3314, 0x3356, 0x3314, 0x3314, 0x2B36, 0x3356, 0x3BDA, 0x4C7E, 0x6D1E, 0x9E3E, 0x53B4, 0x0042,   // 0x4E00 (19968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4E10 (19984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A5, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4E20 (20000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4E30 (20016) pixels
-  0x0000, 0x0000, 0x1107, 0x7497, 0x9E3E, 0x755E, 0x4C9E, 0x3BDA, 0x3356, 0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2, 0x2A91, 0x2AB2, 0x2AB2,   // 0x4E40 (20032) pixels
-  0x2AB2, 0x32D2, 0x32D2, 0x4B96, 0x4B31, 0x3A6A, 0x42AA, 0x3A8A, 0x3A6A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A8A, 0x42AA, 0x42AA,   // 0x4E50 (20048) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A8A, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x530B, 0x42AA, 0x530B, 0x530B, 0x532C,   // 0x4E60 (20064) pixels
-  0x532C, 0x532C, 0x6B6B, 0x530B, 0x6B6B, 0x532C, 0x6B8D, 0x532C, 0x530B, 0x530B, 0x42AA, 0x52EB, 0x530B, 0x532C, 0x6B8E, 0x7C0F,   // 0x4E70 (20080) pixels
-  0x6B8E, 0x6B8E, 0x73CF, 0x6B8E, 0x83EF, 0xA4D2, 0xA4D2, 0xB575, 0xA4D2, 0xC4F2, 0xA4D2, 0xA4AD, 0xA4D2, 0xA4D2, 0xD5B2, 0xCDD5,   // 0x4E80 (20096) pixels
-  0x84B4, 0x42EE, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x2A0C, 0x222F, 0x2270, 0x2270, 0x2A91, 0x32D2, 0x32B1, 0x32D2,   // 0x4E90 (20112) pixels
-  0x2AB2, 0x32D2, 0x2A91, 0x2A91, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x2AB2, 0x32F4, 0x4B96, 0x3314, 0x3314, 0x2B36,   // 0x4EA0 (20128) pixels
-  0x3356, 0x3BDA, 0x443D, 0x6D1E, 0x9E3E, 0x74D8, 0x1107, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4EB0 (20144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4EC0 (20160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4ED0 (20176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21CA, 0x857C, 0x85BE, 0x6D1E, 0x3C1C,   // 0x4EE0 (20192) pixels
-  0x3B99, 0x2B15, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x32D2, 0x53B4, 0x4ACC, 0x42AA, 0x42AA,   // 0x4EF0 (20208) pixels
-  0x42AA, 0x42AA, 0x532C, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A6A, 0x3A8A, 0x4289,   // 0x4F00 (20224) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x530B, 0x42AA, 0x530B, 0x52EB, 0x530B, 0x530B, 0x532C, 0x532C, 0x532C, 0x532C, 0x6B8E, 0x73CF, 0x532C,   // 0x4F10 (20240) pixels
-  0x6B8D, 0x530B, 0x530B, 0x530B, 0x532C, 0x6B8D, 0x6B8E, 0x636D, 0x532C, 0x636D, 0x6B8E, 0x73CF, 0xA4D2, 0xA4D2, 0xA4D2, 0xA4D2,   // 0x4F20 (20256) pixels
-  0xA4D2, 0x9471, 0xA4D2, 0xA4D2, 0xC4F2, 0xD5B2, 0xB575, 0xB575, 0x4332, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F,   // 0x4F30 (20272) pixels
-  0x222F, 0x222F, 0x222F, 0x2270, 0x2A91, 0x2270, 0x2A91, 0x32B1, 0x32D2, 0x32D2, 0x32D2, 0x32B1, 0x32D2, 0x3314, 0x32D2, 0x32D2,   // 0x4F40 (20288) pixels
-  0x2AB2, 0x2AB2, 0x32F4, 0x3314, 0x3314, 0x3314, 0x3356, 0x3356, 0x3B99, 0x3C1C, 0x54BE, 0x85BE, 0x855A, 0x19AA, 0x0000, 0x0000,   // 0x4F50 (20304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4F60 (20320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4F70 (20336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4F80 (20352) pixels
-  0x0000, 0x0000, 0x0000, 0x0042, 0x326E, 0x9DDC, 0x85BE, 0x54BE, 0x3C1C, 0x3378, 0x2B15, 0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2,   // 0x4F90 (20368) pixels
-  0x2AB2, 0x2AF4, 0x32D2, 0x3314, 0x3314, 0x4B95, 0x532C, 0x42AA, 0x3A8A, 0x532C, 0x6B8E, 0x532C, 0x530B, 0x42AA, 0x42AA, 0x42AA,   // 0x4FA0 (20384) pixels
-  0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A69, 0x3A6A, 0x3A8A, 0x42AA, 0x42AA, 0x530B, 0x42AA, 0x530B,   // 0x4FB0 (20400) pixels
-  0x530B, 0x530B, 0x530B, 0x532C, 0x636D, 0x6B8E, 0x6B8D, 0x6B8E, 0x73CF, 0x6B8D, 0x6B8E, 0x6B6B, 0x532C, 0x6B8D, 0x532C, 0x530B,   // 0x4FC0 (20416) pixels
-  0x532C, 0x636E, 0x6B8E, 0x73CF, 0xA4D2, 0xCDD5, 0xCDD5, 0xA4D2, 0xA4D2, 0xA4AD, 0xA4D2, 0xC4F2, 0xCDD5, 0xCDD5, 0xB575, 0x5372,   // 0x4FD0 (20432) pixels
-  0x222F, 0x21EC, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2A91, 0x2A91,   // 0x4FE0 (20448) pixels
-  0x2AB2, 0x2AB2, 0x2A91, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x2AB2, 0x2AF4, 0x32D2, 0x32F4, 0x3356, 0x32F4, 0x2B36, 0x2B36, 0x2B78,   // 0x4FF0 (20464) pixels
-  0x3C1C, 0x54BE, 0x85BE, 0xA63D, 0x326E, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5000 (20480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5010 (20496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5020 (20512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x32B1, 0x9E3E, 0x7D9E,   // 0x5030 (20528) pixels
-  0x54BE, 0x3BDA, 0x3378, 0x2AF4, 0x2AF4, 0x2AF4, 0x2AF4, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x32F4, 0x3314, 0x4B96, 0x53B4, 0x4B0D,   // 0x5040 (20544) pixels
-  0x4ACC, 0x532C, 0x532C, 0x532C, 0x532C, 0x530B, 0x42AA, 0x42AA, 0x3A8A, 0x3A6A, 0x42AA, 0x3A69, 0x3A6A, 0x3A8A, 0x42AA, 0x42AA,   // 0x5050 (20560) pixels
-  0x3A69, 0x3A89, 0x3A6A, 0x3A69, 0x42AA, 0x3A69, 0x42AA, 0x530B, 0x530B, 0x530B, 0x530B, 0x532C, 0x532C, 0x530B, 0x6B8E, 0x73CF,   // 0x5060 (20576) pixels
-  0x73CF, 0x7C0F, 0x8450, 0x7C11, 0x73CF, 0x6B8E, 0x6B8E, 0x636D, 0x6B8E, 0x73CF, 0x73CF, 0x8450, 0x9471, 0xA4D2, 0xAD33, 0xB575,   // 0x5070 (20592) pixels
-  0xA4D2, 0xA4D2, 0xC4F2, 0xA4D2, 0xCDD5, 0xB575, 0x63D2, 0x32B1, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F,   // 0x5080 (20608) pixels
-  0x2270, 0x222F, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2AB2, 0x32B1, 0x2270, 0x32D2, 0x32D2, 0x32D2, 0x3314, 0x32D2, 0x32D2,   // 0x5090 (20624) pixels
-  0x32F4, 0x32F4, 0x3356, 0x3356, 0x3356, 0x3356, 0x3356, 0x3BDA, 0x4C7E, 0x7D9E, 0xA65E, 0x4B31, 0x0883, 0x0000, 0x0000, 0x0000,   // 0x50A0 (20640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x50B0 (20656) pixels
-  0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x50C0 (20672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x50D0 (20688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x5372, 0xAE9F, 0x755E, 0x4C9E, 0x3BDA, 0x2B78, 0x2B15, 0x2AF4, 0x2AF4, 0x2AF4,   // 0x50E0 (20704) pixels
-  0x2AB2, 0x2AB2, 0x2AF4, 0x32D2, 0x32D2, 0x4B96, 0x53D6, 0x534E, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x42AA,   // 0x50F0 (20720) pixels
-  0x42AA, 0x42AA, 0x3A6A, 0x3A8A, 0x42AA, 0x3A6A, 0x3A69, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A8A, 0x3A6A, 0x42AA, 0x42AA, 0x42AA,   // 0x5100 (20736) pixels
-  0x42AA, 0x530B, 0x532C, 0x532C, 0x636D, 0x532C, 0x532C, 0x6B8E, 0x8450, 0x9CB2, 0x8450, 0x9491, 0x8450, 0x73CF, 0x8450, 0x6B8E,   // 0x5110 (20752) pixels
-  0x73CD, 0x63D0, 0x8C2E, 0xA4D2, 0xA4D2, 0xA4D2, 0xD5B2, 0xA4D2, 0xA4D2, 0xA4D2, 0xA4D2, 0xA4D2, 0xA4F4, 0x63D2, 0x32D2, 0x32B1,   // 0x5120 (20768) pixels
-  0x222F, 0x222F, 0x1A0E, 0x222F, 0x1A0E, 0x222F, 0x222F, 0x2270, 0x222F, 0x2270, 0x222F, 0x2270, 0x2270, 0x2270, 0x2A91, 0x2A91,   // 0x5130 (20784) pixels
-  0x2270, 0x32D2, 0x32D2, 0x32D2, 0x32F4, 0x32D2, 0x3314, 0x3314, 0x32F4, 0x3314, 0x3356, 0x3314, 0x3356, 0x3378, 0x3BDA, 0x4C7E,   // 0x5140 (20800) pixels
-  0x85BE, 0xC6DE, 0x5B93, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5150 (20816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5160 (20832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5170 (20848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x63F4,   // 0x5180 (20864) pixels
-  0xB6BE, 0x6D1E, 0x4C9E, 0x3BDA, 0x2B78, 0x2B36, 0x2AF4, 0x2AF4, 0x2AB2, 0x2AF4, 0x2AB2, 0x2AB2, 0x32F4, 0x3314, 0x53F8, 0x53B4,   // 0x5190 (20880) pixels
-  0x534E, 0x532C, 0x6B8E, 0x532C, 0x534E, 0x532C, 0x532C, 0x4ACC, 0x42AA, 0x3A69, 0x42AA, 0x3A8A, 0x3A69, 0x42AA, 0x3A8A, 0x3A69,   // 0x51A0 (20896) pixels
-  0x3A6A, 0x42AA, 0x3A69, 0x3A6A, 0x3A6A, 0x3A6A, 0x3A69, 0x3A6A, 0x3A8A, 0x530B, 0x530B, 0x532C, 0x532C, 0x532C, 0x636D, 0x73CF,   // 0x51B0 (20912) pixels
-  0x7C0F, 0xB575, 0x9CB2, 0x8450, 0xA4D2, 0x8450, 0x83EF, 0x83EF, 0x73F0, 0x83EF, 0x9471, 0xA4D2, 0xA4D2, 0x9471, 0x83EF, 0x73F0,   // 0x51C0 (20928) pixels
-  0xA4D2, 0xA4D2, 0xA4D2, 0x9CB2, 0x4B31, 0x32B1, 0x32B1, 0x2270, 0x2270, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F, 0x222F,   // 0x51D0 (20944) pixels
-  0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2A91, 0x2AB2, 0x2AB2, 0x32D2, 0x3314, 0x3314, 0x3314, 0x2AF4,   // 0x51E0 (20960) pixels
-  0x3314, 0x4B96, 0x3356, 0x3356, 0x3378, 0x3BDA, 0x443D, 0x6D1E, 0xB6BE, 0x6C56, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x51F0 (20976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5200 (20992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5210 (21008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5220 (21024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x6C56, 0xB6BE, 0x6D1E, 0x443D, 0x3B99, 0x3378, 0x2B36, 0x2AF4,   // 0x5230 (21040) pixels
-  0x2AF4, 0x2AB2, 0x2AF4, 0x2AF4, 0x2AB2, 0x3314, 0x4B96, 0x5C18, 0x5B90, 0x532C, 0x532C, 0x532C, 0x6B8D, 0x532C, 0x532C, 0x532C,   // 0x5240 (21056) pixels
-  0x530B, 0x42AA, 0x42AA, 0x3A6A, 0x42AA, 0x3A8A, 0x3A6A, 0x3A6A, 0x42AA, 0x3A8A, 0x3A6A, 0x3A8A, 0x3A6A, 0x4289, 0x4289, 0x42AA,   // 0x5250 (21072) pixels
-  0x42AA, 0x530B, 0x532C, 0x530B, 0x532C, 0x532C, 0x532C, 0x6B8D, 0x6B8E, 0x9CB2, 0xA4D2, 0x73CF, 0xB575, 0x9491, 0x8450, 0x9471,   // 0x5260 (21088) pixels
-  0x9471, 0x9471, 0x9471, 0x83EF, 0x9491, 0x8C2E, 0x83EF, 0x73CF, 0x9471, 0x8472, 0x63D2, 0x32B1, 0x32B1, 0x2270, 0x2270, 0x2270,   // 0x5270 (21104) pixels
-  0x222F, 0x222F, 0x2270, 0x222F, 0x2270, 0x222F, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2A91, 0x2270, 0x2270, 0x2270,   // 0x5280 (21120) pixels
-  0x2AB2, 0x2A91, 0x2AB2, 0x2AB2, 0x3314, 0x3314, 0x3314, 0x3314, 0x3B97, 0x3B99, 0x3356, 0x3378, 0x3BDA, 0x3C1C, 0x755E, 0xB6BE,   // 0x5290 (21136) pixels
-  0x6C56, 0x1107, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x52A0 (21152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x52B0 (21168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x52C0 (21184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x52D0 (21200) pixels
-  0x1948, 0x6C56, 0xB6BE, 0x6D1E, 0x3C1C, 0x3BDA, 0x3378, 0x2B78, 0x2B36, 0x2AF4, 0x2AF4, 0x2AF4, 0x2AF4, 0x3314, 0x4376, 0x4B96,   // 0x52E0 (21216) pixels
-  0x5C15, 0x532C, 0x534E, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x4ACC, 0x42AA, 0x3A8A, 0x42AA, 0x3A6A, 0x3A8A,   // 0x52F0 (21232) pixels
-  0x42AA, 0x3A6A, 0x3A6A, 0x3A6A, 0x3A6A, 0x3A6A, 0x3A6A, 0x42AA, 0x530B, 0x532C, 0x530B, 0x532C, 0x530B, 0x532C, 0x636D, 0x532C,   // 0x5300 (21248) pixels
-  0x636D, 0x6B8E, 0x73CF, 0x8450, 0x9491, 0xA4D2, 0xB575, 0xA4D2, 0xA4D2, 0xA4D2, 0x83F0, 0x8450, 0x83F0, 0x73CF, 0x73CF, 0x73F0,   // 0x5310 (21264) pixels
-  0x63D2, 0x42F0, 0x32B1, 0x2270, 0x2270, 0x2270, 0x2270, 0x222F, 0x222F, 0x1A0E, 0x2270, 0x2270, 0x222F, 0x2270, 0x2270, 0x2270,   // 0x5320 (21280) pixels
-  0x2270, 0x2270, 0x2AB2, 0x2A91, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AF4, 0x3314, 0x3314, 0x3356, 0x3314, 0x3356,   // 0x5330 (21296) pixels
-  0x4B96, 0x3356, 0x3B99, 0x3BDA, 0x3C1C, 0x6D1E, 0xB6BE, 0x7497, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5340 (21312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5350 (21328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5360 (21344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5370 (21360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x74D8, 0xC6DE, 0x6D1E, 0x3C1C, 0x3BDA, 0x3378,   // 0x5380 (21376) pixels
-  0x2B36, 0x2B36, 0x2AF4, 0x2B15, 0x3314, 0x3314, 0x3356, 0x43D9, 0x5C18, 0x6B8E, 0x532C, 0x532C, 0x534E, 0x532C, 0x532C, 0x532C,   // 0x5390 (21392) pixels
-  0x532C, 0x532C, 0x42AA, 0x530B, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x42AA, 0x3A6A, 0x3A6A, 0x42AA, 0x532C,   // 0x53A0 (21408) pixels
-  0x532C, 0x532C, 0x532C, 0x4ACC, 0x42AA, 0x42AA, 0x42AA, 0x6B8E, 0x636D, 0x636D, 0x6B8E, 0x73F0, 0x8450, 0x9471, 0xAD33, 0xB575,   // 0x53B0 (21424) pixels
-  0xA4D2, 0x9491, 0x8450, 0x8450, 0x6B8E, 0x6B8E, 0x5350, 0x3B13, 0x32B1, 0x32B1, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x222F,   // 0x53C0 (21440) pixels
-  0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2AB2, 0x2A91, 0x2AB2, 0x2A91, 0x2AB2, 0x2AB2, 0x2AB2,   // 0x53D0 (21456) pixels
-  0x2AB2, 0x32F4, 0x3314, 0x3314, 0x3314, 0x3314, 0x43D9, 0x43D9, 0x3378, 0x3B99, 0x3BDA, 0x3C1C, 0x755E, 0xB6BE, 0x6C56, 0x1948,   // 0x53E0 (21472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x53F0 (21488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5400 (21504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5410 (21520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5420 (21536) pixels
-  0x0000, 0x0000, 0x1948, 0x6415, 0xC6DE, 0x6D1E, 0x3C1C, 0x3C1C, 0x3BDA, 0x3378, 0x2B36, 0x2B15, 0x3314, 0x3314, 0x3314, 0x4B96,   // 0x5430 (21552) pixels
-  0x5C18, 0x63D0, 0x532C, 0x534E, 0x534E, 0x532C, 0x6B8E, 0x532C, 0x532C, 0x6B8E, 0x532C, 0x42AA, 0x42AA, 0x42AA, 0x3A8A, 0x42AA,   // 0x5440 (21568) pixels
-  0x532C, 0x532C, 0x42AA, 0x3A8A, 0x42AA, 0x3A6A, 0x532C, 0x532C, 0x6B8D, 0x636E, 0x532C, 0x42AA, 0x3A6A, 0x3A6A, 0x4ACC, 0x532C,   // 0x5450 (21584) pixels
-  0x532C, 0x532C, 0x636D, 0x636D, 0x6B8E, 0x7C11, 0xA4D2, 0xA4D2, 0x9CB2, 0x8450, 0x73F0, 0x63D0, 0x5B90, 0x42F0, 0x32D2, 0x32B1,   // 0x5460 (21600) pixels
-  0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x222F, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2A91,   // 0x5470 (21616) pixels
-  0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x2AB2, 0x2AB2, 0x2AB2, 0x32F4, 0x3314, 0x3314, 0x3314, 0x3356, 0x3356, 0x43FA, 0x43D9,   // 0x5480 (21632) pixels
-  0x3B99, 0x3BDA, 0x4C7E, 0x755E, 0xC6DE, 0x6C56, 0x10E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5490 (21648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x54A0 (21664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x54B0 (21680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x54C0 (21696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x63F4, 0xA65E, 0x755E, 0x4C7E,   // 0x54D0 (21712) pixels
-  0x3BFC, 0x3BDA, 0x3378, 0x3356, 0x3356, 0x3356, 0x3356, 0x43D9, 0x53F8, 0x6415, 0x5B90, 0x6B8E, 0x534E, 0x5B8F, 0x6B8E, 0x532C,   // 0x54E0 (21728) pixels
-  0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x42AA, 0x532C, 0x42AA, 0x4B0D, 0x532C,   // 0x54F0 (21744) pixels
-  0x534E, 0x532C, 0x532C, 0x532C, 0x42EE, 0x4B0D, 0x636E, 0x6B8E, 0x73CF, 0x73F0, 0x73F0, 0x6B8E, 0x83EF, 0x73CF, 0x9CB2, 0x9CB2,   // 0x5500 (21760) pixels
-  0x73CF, 0x636E, 0x5350, 0x4332, 0x32D2, 0x32D2, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,   // 0x5510 (21776) pixels
-  0x2270, 0x2270, 0x2270, 0x2A91, 0x2A91, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x32D2, 0x32F4, 0x2AF4, 0x32F4,   // 0x5520 (21792) pixels
-  0x32F4, 0x3314, 0x3314, 0x3356, 0x3356, 0x43FA, 0x43D9, 0x3B99, 0x3BFC, 0x4C7E, 0x85BE, 0xB6BE, 0x53B4, 0x1107, 0x0000, 0x0000,   // 0x5530 (21808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5540 (21824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5550 (21840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000,   // 0x5560 (21856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5570 (21872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x4332, 0xBE9D, 0x85BE, 0x54BE, 0x3C1C, 0x3BDA, 0x3B99, 0x2B78, 0x3356, 0x3356, 0x43D9,   // 0x5580 (21888) pixels
-  0x6C99, 0x7C95, 0x63D0, 0x5B90, 0x534E, 0x532C, 0x532C, 0x532C, 0x534E, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x636E, 0x532C,   // 0x5590 (21904) pixels
-  0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x4ACC, 0x532C, 0x532C, 0x532C, 0x6B8E, 0x7C11, 0x7C11, 0x73F0, 0x6B8E,   // 0x55A0 (21920) pixels
-  0x7C11, 0x7C11, 0x8450, 0x8450, 0x73CF, 0x7C11, 0x9CB2, 0x73F0, 0x5372, 0x4B31, 0x32D2, 0x32D2, 0x32B1, 0x32B1, 0x2A91, 0x2A91,   // 0x55B0 (21936) pixels
-  0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2AB2, 0x2A91, 0x32D2, 0x3314, 0x4354, 0x3314, 0x32D2,   // 0x55C0 (21952) pixels
-  0x32D2, 0x2AB2, 0x32D2, 0x32F4, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3356, 0x3356, 0x3356, 0x3B99, 0x43FA, 0x3BDA, 0x443D,   // 0x55D0 (21968) pixels
-  0x54BE, 0x95FE, 0xB6BE, 0x4B31, 0x10C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x55E0 (21984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x55F0 (22000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5600 (22016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5610 (22032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A4, 0x3A8F, 0x9DDC,   // 0x5620 (22048) pixels
-  0x9E3E, 0x6D1E, 0x4C9E, 0x443D, 0x3BDA, 0x3B99, 0x3B99, 0x6458, 0x9DBB, 0x7C95, 0x7432, 0x73F0, 0x7C11, 0x63D0, 0x5B8F, 0x534E,   // 0x5630 (22064) pixels
-  0x532C, 0x534E, 0x6B8E, 0x534E, 0x532C, 0x532C, 0x532C, 0x6B8E, 0x6B8D, 0x636E, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x3A8C,   // 0x5640 (22080) pixels
-  0x534E, 0x532C, 0x532C, 0x6B8E, 0x73CF, 0x7C11, 0x8450, 0x7C11, 0x6B8E, 0x6B8E, 0x73CF, 0x73F0, 0x73F0, 0x8450, 0x7C11, 0x53B4,   // 0x5650 (22096) pixels
-  0x53B4, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x2A91, 0x2A91, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,   // 0x5660 (22112) pixels
-  0x2A91, 0x2AB2, 0x32D2, 0x3314, 0x53D6, 0x53D6, 0x53D6, 0x4376, 0x3314, 0x32F4, 0x32F4, 0x3314, 0x3314, 0x32F4, 0x3356, 0x3314,   // 0x5670 (22128) pixels
-  0x3356, 0x3314, 0x3356, 0x43D9, 0x3BDA, 0x443D, 0x443D, 0x6D1E, 0x9E3E, 0xA63D, 0x3A8F, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5680 (22144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5690 (22160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x56A0 (22176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x56B0 (22192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x56C0 (22208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x21CA, 0x7D1B, 0xA65E, 0x85BE, 0x64FE, 0x4C9E, 0x443D, 0x4C1B, 0x64BA,   // 0x56D0 (22224) pixels
-  0xB5FB, 0x9558, 0x7432, 0x7C95, 0x63D0, 0x63D0, 0x534E, 0x5B8F, 0x532C, 0x534E, 0x534E, 0x532C, 0x532C, 0x532C, 0x534E, 0x6B8E,   // 0x56E0 (22240) pixels
-  0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x3A8C, 0x4B0D, 0x532C, 0x532C, 0x534E, 0x6B8E, 0x6B8E, 0x6B8E, 0x73CF,   // 0x56F0 (22256) pixels
-  0x7C11, 0x8450, 0x6B8E, 0x6B8E, 0x6B8E, 0x63D0, 0x4332, 0x4354, 0x4354, 0x32D2, 0x32D2, 0x32B1, 0x2270, 0x2A91, 0x2A91, 0x2A91,   // 0x5700 (22272) pixels
-  0x2A91, 0x2A91, 0x2270, 0x2AB2, 0x2270, 0x2270, 0x2270, 0x2AB2, 0x2AB2, 0x3314, 0x32D2, 0x32D2, 0x32D2, 0x3314, 0x4354, 0x4B96,   // 0x5710 (22288) pixels
-  0x4B96, 0x3356, 0x3314, 0x3356, 0x3356, 0x3356, 0x3314, 0x3356, 0x3356, 0x3B99, 0x3B99, 0x43FA, 0x443D, 0x54BE, 0x755E, 0x9E3E,   // 0x5720 (22304) pixels
-  0x7D1B, 0x21EC, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5730 (22320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5740 (22336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5750 (22352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5760 (22368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042,   // 0x5770 (22384) pixels
-  0x1948, 0x6C56, 0x95FE, 0x95FE, 0x6D1E, 0x4C7E, 0x443D, 0x54BE, 0x857C, 0xA5DA, 0x9536, 0x84B4, 0x7454, 0x73F0, 0x63D0, 0x5B90,   // 0x5780 (22400) pixels
-  0x5B90, 0x534E, 0x534E, 0x534E, 0x5B8F, 0x532C, 0x532C, 0x532C, 0x534E, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C,   // 0x5790 (22416) pixels
-  0x42EE, 0x6B8E, 0x532C, 0x532C, 0x532C, 0x636D, 0x6B8E, 0x7C11, 0x8472, 0x8450, 0x6B8E, 0x532C, 0x534E, 0x5350, 0x4354, 0x4354,   // 0x57A0 (22432) pixels
-  0x3314, 0x32D2, 0x32D2, 0x2AB2, 0x2A91, 0x2A91, 0x2AB2, 0x2270, 0x2270, 0x2AB2, 0x2A91, 0x2270, 0x2AB2, 0x2AB2, 0x2A91, 0x2A91,   // 0x57B0 (22448) pixels
-  0x2AB2, 0x32D2, 0x32D2, 0x32F4, 0x3B13, 0x3314, 0x3314, 0x3314, 0x4B96, 0x5C18, 0x43D9, 0x43D9, 0x43D9, 0x3356, 0x3356, 0x3356,   // 0x57C0 (22464) pixels
-  0x3B99, 0x43D9, 0x443D, 0x4C7E, 0x6D1E, 0x85BE, 0x9E3E, 0x6C56, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x57D0 (22480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x57E0 (22496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x57F0 (22512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5800 (22528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5810 (22544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10E6, 0x42F0, 0x8D9D, 0x95FE, 0x6D1E, 0x54BE, 0x4C7E,   // 0x5820 (22560) pixels
-  0x64FE, 0x857E, 0xA5DA, 0xA5DA, 0xAD99, 0x9536, 0x7432, 0x7432, 0x63D0, 0x5B90, 0x534E, 0x6B8E, 0x5B8F, 0x534E, 0x532C, 0x534E,   // 0x5830 (22576) pixels
-  0x532C, 0x532C, 0x532C, 0x5B8F, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x7C11, 0x7C11, 0x532C, 0x532C, 0x6B8E, 0x6B8E,   // 0x5840 (22592) pixels
-  0x73F0, 0x534E, 0x532C, 0x6B8E, 0x532C, 0x5350, 0x53B4, 0x4354, 0x3314, 0x32D2, 0x32D2, 0x2AB2, 0x2AB2, 0x2A91, 0x2AB2, 0x2AB2,   // 0x5850 (22608) pixels
-  0x2AB2, 0x2A91, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2, 0x32D2, 0x32F4, 0x32D2, 0x3314, 0x3314, 0x3314, 0x3356,   // 0x5860 (22624) pixels
-  0x53F8, 0x545A, 0x647A, 0x5C18, 0x4B96, 0x3356, 0x43D9, 0x43D9, 0x4C1B, 0x443D, 0x54BE, 0x755E, 0x95FE, 0x857C, 0x42F0, 0x10C5,   // 0x5870 (22640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5880 (22656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5890 (22672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x58A0 (22688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x58B0 (22704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x58C0 (22720) pixels
-  0x0000, 0x0000, 0x0883, 0x3A6A, 0x74D8, 0xA65E, 0x755E, 0x54BE, 0x54BE, 0x64FE, 0x85BE, 0xB5FB, 0xAD99, 0xBE1A, 0x9536, 0x84B4,   // 0x58D0 (22736) pixels
-  0x84B4, 0x7432, 0x63D0, 0x63D0, 0x63D0, 0x63D0, 0x534E, 0x534E, 0x532C, 0x5B90, 0x534E, 0x534E, 0x534E, 0x532C, 0x534E, 0x534E,   // 0x58E0 (22752) pixels
-  0x532C, 0x534E, 0x532C, 0x6B8E, 0x6B8E, 0x6B8E, 0x7C11, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x532C, 0x534E, 0x4332, 0x3314,   // 0x58F0 (22768) pixels
-  0x3B13, 0x32D2, 0x32D2, 0x32D2, 0x32D2, 0x2AB2, 0x2AB2, 0x32D2, 0x3314, 0x2AB2, 0x2AB2, 0x2A91, 0x2AB2, 0x3314, 0x32D2, 0x2AB2,   // 0x5900 (22784) pixels
-  0x2A91, 0x2AB2, 0x32D2, 0x32F4, 0x3314, 0x32F4, 0x3314, 0x3356, 0x3356, 0x5C18, 0x43FA, 0x3B97, 0x3B99, 0x43D9, 0x4C1B, 0x443D,   // 0x5910 (22800) pixels
-  0x4C9E, 0x6D1E, 0x85BE, 0xB6BE, 0x74D8, 0x2A0C, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5920 (22816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5930 (22832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5940 (22848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5950 (22864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5960 (22880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x4332, 0x957A, 0x95FE,   // 0x5970 (22896) pixels
-  0x755E, 0x54BE, 0x6D1E, 0x95FE, 0xD6FE, 0xA5DA, 0x9536, 0x8CF6, 0x84B4, 0x84B4, 0x7432, 0x7432, 0x63D0, 0x63D0, 0x63D0, 0x534E,   // 0x5980 (22912) pixels
-  0x5B90, 0x534E, 0x534E, 0x532C, 0x5B8F, 0x534E, 0x534E, 0x534E, 0x532C, 0x6B8E, 0x534E, 0x5B8F, 0x534E, 0x4B0D, 0x4B0F, 0x534E,   // 0x5990 (22928) pixels
-  0x532C, 0x534E, 0x532C, 0x534E, 0x532C, 0x534E, 0x4332, 0x3314, 0x3314, 0x3B13, 0x2AB2, 0x32D2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AB2,   // 0x59A0 (22944) pixels
-  0x32D2, 0x2AB2, 0x2AB2, 0x2AB2, 0x4376, 0x3314, 0x32D2, 0x2AB2, 0x2AB2, 0x2AB2, 0x2AF4, 0x32D2, 0x2AF4, 0x32F4, 0x3314, 0x3356,   // 0x59B0 (22960) pixels
-  0x43D9, 0x43D9, 0x3B99, 0x3BDA, 0x4C1B, 0x443D, 0x4C9E, 0x6D1E, 0x7D9E, 0xAE9F, 0xA63D, 0x4332, 0x1107, 0x0000, 0x0000, 0x0000,   // 0x59C0 (22976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x59D0 (22992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x59E0 (23008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x59F0 (23024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A00 (23040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A10 (23056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x21CA, 0x7456, 0x95FE, 0x85BE, 0x6D1E, 0x755E, 0xA65E, 0xC6DE, 0xA5DA, 0x957A,   // 0x5A20 (23072) pixels
-  0xAD99, 0x9558, 0x8CF6, 0x84B4, 0x7432, 0x7432, 0x7432, 0x7C11, 0x63D0, 0x63D0, 0x5B90, 0x534E, 0x63D0, 0x5B8F, 0x534E, 0x5B8F,   // 0x5A30 (23088) pixels
-  0x63D0, 0x532C, 0x6B8E, 0x6B8E, 0x63D0, 0x4B0D, 0x4B0F, 0x5B90, 0x532C, 0x534E, 0x534E, 0x5B8F, 0x534E, 0x5350, 0x4332, 0x3314,   // 0x5A40 (23104) pixels
-  0x4354, 0x3314, 0x3314, 0x32D2, 0x32F4, 0x32F4, 0x32D2, 0x32D2, 0x2AB2, 0x2AB2, 0x32D2, 0x32D2, 0x3314, 0x2AB2, 0x32D2, 0x2AF4,   // 0x5A50 (23120) pixels
-  0x2AB2, 0x2AF4, 0x32F4, 0x2AF4, 0x3314, 0x3356, 0x43D9, 0x545C, 0x4C1B, 0x43D9, 0x4C1B, 0x443D, 0x443D, 0x54BE, 0x755E, 0xA65E,   // 0x5A60 (23136) pixels
-  0xB6BE, 0x6C97, 0x21CA, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A70 (23152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A80 (23168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A90 (23184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5AA0 (23200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5AB0 (23216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10E6,   // 0x5AC0 (23232) pixels
-  0x326E, 0x74D8, 0x95FE, 0x85BE, 0x85BE, 0xA65E, 0xC6DE, 0xB65C, 0xA5DA, 0xA5DA, 0xAD99, 0xA578, 0x8CF6, 0x84B4, 0x7C95, 0x7432,   // 0x5AD0 (23248) pixels
-  0x7432, 0x7C11, 0x7432, 0x7C11, 0x63D0, 0x63D0, 0x63D0, 0x63D0, 0x5B8F, 0x63D0, 0x63D0, 0x6B8E, 0x63D0, 0x4B0D, 0x4B0F, 0x532C,   // 0x5AE0 (23264) pixels
-  0x534E, 0x5B8F, 0x5B8F, 0x6B8E, 0x532C, 0x534E, 0x4332, 0x4354, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314,   // 0x5AF0 (23280) pixels
-  0x4B96, 0x4B96, 0x53B4, 0x3314, 0x32F4, 0x2AF4, 0x2AF4, 0x2AF4, 0x2B15, 0x2B15, 0x3314, 0x3356, 0x3356, 0x43FA, 0x545A, 0x443D,   // 0x5B00 (23296) pixels
-  0x443D, 0x443D, 0x4C9E, 0x54BE, 0x6D1E, 0xAE9F, 0xB6BE, 0x84F9, 0x326E, 0x10C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B10 (23312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B20 (23328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B30 (23344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B40 (23360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B50 (23376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B60 (23392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x32B1, 0x855A, 0x9E3E, 0x9E3E, 0xA65E, 0xD6FE,   // 0x5B70 (23408) pixels
-  0xB67E, 0xC65C, 0xB65C, 0xB5FB, 0xA5DA, 0x9536, 0x8CF6, 0x8CF6, 0x8CF6, 0x7C95, 0x7432, 0x6415, 0x7432, 0x7432, 0x7C11, 0x7C11,   // 0x5B80 (23424) pixels
-  0x73F0, 0x63D0, 0x63D0, 0x6B8E, 0x63D0, 0x63D0, 0x63D0, 0x5B90, 0x5B8F, 0x5B8F, 0x5B90, 0x6B8E, 0x5B90, 0x5B8F, 0x4332, 0x4354,   // 0x5B90 (23440) pixels
-  0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3314, 0x3356, 0x4B96, 0x5B93, 0x5350, 0x5B90, 0x3314, 0x3314, 0x3314, 0x3314, 0x3356,   // 0x5BA0 (23456) pixels
-  0x3314, 0x3356, 0x3356, 0x3378, 0x4C1B, 0x443D, 0x443D, 0x4C7E, 0x54BE, 0x54BE, 0x755E, 0x85BE, 0xC6DE, 0x9DBB, 0x4B31, 0x1948,   // 0x5BB0 (23472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BC0 (23488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BD0 (23504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BE0 (23520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BF0 (23536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C00 (23552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C10 (23568) pixels
-  0x0000, 0x0000, 0x0042, 0x1948, 0x42F0, 0x855A, 0xAE9F, 0xB6BE, 0xC6DE, 0xD73F, 0xD6FE, 0xD6FE, 0xB65C, 0xB65C, 0xA5DA, 0xAD99,   // 0x5C20 (23584) pixels
-  0xAD99, 0x9558, 0x8CF6, 0x84B4, 0x84B4, 0x7454, 0x7454, 0x7454, 0x6C13, 0x7432, 0x7432, 0x7432, 0x63D0, 0x7C11, 0x63D0, 0x5B90,   // 0x5C30 (23600) pixels
-  0x5B8F, 0x63D0, 0x5B8F, 0x5B90, 0x63D0, 0x5B93, 0x4B95, 0x4376, 0x3356, 0x3356, 0x4376, 0x4376, 0x4B96, 0x53D6, 0x6415, 0x7432,   // 0x5C40 (23616) pixels
-  0x63D2, 0x5350, 0x4354, 0x3314, 0x3314, 0x3356, 0x3356, 0x3356, 0x3356, 0x3378, 0x43FA, 0x4C1B, 0x443D, 0x443D, 0x443D, 0x54BE,   // 0x5C50 (23632) pixels
-  0x6D1E, 0xA65E, 0xB6BE, 0x855A, 0x4B31, 0x1948, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C60 (23648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C70 (23664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C80 (23680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C90 (23696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5CA0 (23712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5CB0 (23728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x1948, 0x42F0, 0x7D1B,   // 0x5CC0 (23744) pixels
-  0xB6BE, 0xCF1F, 0xEF9F, 0xE75E, 0xE75E, 0xC6DE, 0xC6DE, 0xB65C, 0xA63D, 0xA5DA, 0x9558, 0x9536, 0x8CF6, 0x8CF6, 0x8CF6, 0x84B4,   // 0x5CD0 (23760) pixels
-  0x84B4, 0x84B4, 0x7454, 0x63D0, 0x63D0, 0x63D0, 0x63D0, 0x5B90, 0x6415, 0x5B93, 0x5C17, 0x53B4, 0x4B96, 0x43D9, 0x4B96, 0x43D9,   // 0x5CE0 (23776) pixels
-  0x53F8, 0x545A, 0x6458, 0x6C56, 0x7454, 0x8474, 0x7432, 0x6C13, 0x53B4, 0x4B96, 0x3356, 0x2B36, 0x3356, 0x3356, 0x2B78, 0x3378,   // 0x5CF0 (23792) pixels
-  0x3BDA, 0x3BDA, 0x443D, 0x443D, 0x4C7E, 0x54BE, 0x755E, 0x9E3E, 0xB67E, 0x855A, 0x4332, 0x1107, 0x0042, 0x0000, 0x0000, 0x0000,   // 0x5D00 (23808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D10 (23824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D20 (23840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D30 (23856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D40 (23872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D50 (23888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D60 (23904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1107, 0x324D, 0x6C56, 0xB67E, 0xD73F, 0xEF9F, 0xEF9F, 0xC6DE, 0xB67E,   // 0x5D70 (23920) pixels
-  0xB67E, 0xA5FC, 0x957A, 0x855A, 0x9558, 0x9558, 0x9558, 0x8CF6, 0x84B4, 0x7497, 0x7454, 0x63D2, 0x63D2, 0x6C56, 0x64BA, 0x545A,   // 0x5D80 (23936) pixels
-  0x5C18, 0x4C19, 0x43D9, 0x43D9, 0x43D9, 0x43D9, 0x43D9, 0x43D9, 0x4C1B, 0x64BA, 0x7432, 0x7454, 0x7454, 0x84B4, 0x6C13, 0x53B4,   // 0x5D90 (23952) pixels
-  0x4376, 0x3356, 0x3B99, 0x3B99, 0x3B99, 0x3BDA, 0x443D, 0x443D, 0x443D, 0x443D, 0x54BE, 0x6D1E, 0x85BE, 0xA65E, 0x9DDC, 0x6C56,   // 0x5DA0 (23968) pixels
-  0x324D, 0x1925, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DB0 (23984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DC0 (24000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DD0 (24016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DE0 (24032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DF0 (24048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E00 (24064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E10 (24080) pixels
-  0x0000, 0x08A4, 0x21CA, 0x4332, 0x855A, 0xB67E, 0xD73F, 0xD73F, 0xC6DE, 0xB6BE, 0xB6BE, 0xA65E, 0x95FE, 0x9DDC, 0x855A, 0x74FA,   // 0x5E20 (24096) pixels
-  0x8CF6, 0x8CF6, 0x7497, 0x7C95, 0x6415, 0x6458, 0x5C9B, 0x4C1B, 0x43FA, 0x43D9, 0x43FA, 0x43D9, 0x43D9, 0x43D9, 0x4C1B, 0x545C,   // 0x5E30 (24112) pixels
-  0x5C9B, 0x64BA, 0x84B4, 0x94F6, 0x8CF6, 0x6415, 0x53D6, 0x3B99, 0x3B99, 0x3BDA, 0x3BDA, 0x3BDA, 0x3C1C, 0x4C7E, 0x443D, 0x54BE,   // 0x5E40 (24128) pixels
-  0x6D1E, 0x85BE, 0x9E3E, 0x9DDC, 0x74D8, 0x4332, 0x21CA, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E50 (24144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E60 (24160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E70 (24176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E80 (24192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E90 (24208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5EA0 (24224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5EB0 (24240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10C5, 0x21CA, 0x4332, 0x8519,   // 0x5EC0 (24256) pixels
-  0xB67E, 0xCF1F, 0xCF1F, 0xC6DE, 0xB6BE, 0xA65E, 0x9E3E, 0x85BE, 0x857C, 0x7D3C, 0x64DD, 0x7D1B, 0x74FA, 0x64DD, 0x5C9D, 0x443D,   // 0x5ED0 (24272) pixels
-  0x443D, 0x443D, 0x4C1B, 0x443D, 0x443D, 0x4C1B, 0x4C1B, 0x5C9B, 0x74D8, 0x9558, 0x9558, 0x84F9, 0x6C99, 0x4C1B, 0x443D, 0x4C7E,   // 0x5EE0 (24288) pixels
-  0x4C7E, 0x4C7E, 0x54BE, 0x54BE, 0x6D1E, 0x755E, 0x85BE, 0xA65E, 0xA63D, 0x74FA, 0x5372, 0x21CA, 0x10E6, 0x0000, 0x0000, 0x0000,   // 0x5EF0 (24304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F00 (24320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F10 (24336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F20 (24352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F30 (24368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F40 (24384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F50 (24400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F60 (24416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x08A4, 0x21CA, 0x42F0, 0x6C56, 0x957A, 0xA65E, 0xB6BE, 0xAE9F, 0x9E3E,   // 0x5F70 (24432) pixels
-  0x85BE, 0x7D9E, 0x7D9E, 0x6D1E, 0x755E, 0x755E, 0x54BE, 0x54BE, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x54BE,   // 0x5F80 (24448) pixels
-  0x755E, 0x7D3C, 0x755E, 0x755E, 0x6D1E, 0x6D1E, 0x6D1E, 0x755E, 0x755E, 0x85BE, 0x85BE, 0x95FE, 0x85BE, 0x7D19, 0x6C56, 0x42F0,   // 0x5F90 (24464) pixels
-  0x2189, 0x10C5, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FA0 (24480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FB0 (24496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FC0 (24512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FD0 (24528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FE0 (24544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FF0 (24560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6000 (24576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6010 (24592) pixels
-  0x0000, 0x0042, 0x0883, 0x1107, 0x21CA, 0x3A8F, 0x5C15, 0x74D8, 0x9DDC, 0x9E1D, 0x9E1D, 0x9E3E, 0x9E3E, 0x9E3E, 0x85BE, 0x85BE,   // 0x6020 (24608) pixels
-  0x7D9E, 0x7D9E, 0x7D9E, 0x7D9E, 0x7D9E, 0x85BE, 0x85BE, 0x85BE, 0x8E1F, 0x9E3E, 0x85BE, 0x85BE, 0x95FE, 0x9E3E, 0x9DDC, 0x9DDC,   // 0x6030 (24624) pixels
-  0x855A, 0x74D8, 0x53B4, 0x3A8F, 0x21CA, 0x1107, 0x0883, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6040 (24640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6050 (24656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6060 (24672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6070 (24688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6080 (24704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6090 (24720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60A0 (24736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60B0 (24752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x08A4,   // 0x60C0 (24768) pixels
-  0x1107, 0x2189, 0x2A0C, 0x3A8F, 0x4B93, 0x53B4, 0x6C56, 0x74D8, 0x74D8, 0x855A, 0x855A, 0x8D9D, 0x8D9D, 0x855A, 0x855A, 0x855A,   // 0x60D0 (24784) pixels
-  0x74FA, 0x6C99, 0x6C56, 0x63F4, 0x4332, 0x42F0, 0x2A0C, 0x21CA, 0x1107, 0x08A4, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60E0 (24800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60F0 (24816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6100 (24832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6110 (24848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6120 (24864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6130 (24880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6140 (24896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6150 (24912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6160 (24928) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x0883, 0x10C5,   // 0x6170 (24944) pixels
-  0x10C5, 0x10C5, 0x1107, 0x1107, 0x1107, 0x1107, 0x1107, 0x08A4, 0x10C5, 0x10C5, 0x0883, 0x0042, 0x0042, 0x0000, 0x0000, 0x0000,   // 0x6180 (24960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6190 (24976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61A0 (24992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61B0 (25008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61C0 (25024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61D0 (25040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61E0 (25056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61F0 (25072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6200 (25088) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6210 (25104) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6220 (25120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6230 (25136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6240 (25152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6250 (25168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6260 (25184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6270 (25200) pixels
+// Packed by      : _TOOLS/bitmap_converter.py (palette + RLE, see GfxUi::drawPackedBitmap)
+// Packed size    : 168x150 pixels, 8 bits per pixel, 247 colours, 16593 bytes (was 50400)
+
+const uint8_t Splash_Screen[16593] PROGMEM = {
+  0xA8, 0x00, 0x96, 0x00, 0x08, 0xF6, 0x00, 0x00, 0xA6, 0xED, 0xAA, 0x42, 0x2C, 0x53, 0x75, 0xB5,
+  0x14, 0x33, 0xD2, 0x32, 0x70, 0x22, 0xD6, 0x53, 0x0B, 0x53, 0x76, 0xE6, 0x8E, 0x6B, 0xB2, 0x2A,
+  0xD5, 0xCD, 0xB1, 0x32, 0x54, 0x43, 0xCC, 0x4A, 0x56, 0x33, 0x2F, 0x22, 0x4E, 0x53, 0x46, 0xDD,
+  0x91, 0x2A, 0xB4, 0x53, 0x50, 0x84, 0x33, 0xAD, 0xB2, 0x9C, 0x16, 0xD6, 0xCF, 0x73, 0xD0, 0x63,
+  0x32, 0x43, 0xD2, 0xA4, 0xD8, 0xEE, 0x49, 0xD5, 0x6D, 0x63, 0x96, 0x4B, 0xEB, 0x52, 0xB2, 0xD5,
+  0x6A, 0x3A, 0xF4, 0x2A, 0x18, 0x5C, 0xFF, 0xFF, 0x11, 0x7C, 0x50, 0x53, 0x93, 0x5B, 0x31, 0x4B,
+  0x3D, 0x44, 0xBE, 0x85, 0x2E, 0x8C, 0xBE, 0xB6, 0x8D, 0x6B, 0x91, 0x94, 0x65, 0xB4, 0x3E, 0x9E,
+  0x5E, 0xA6, 0xBE, 0x54, 0xD9, 0x43, 0xF4, 0x32, 0x1E, 0x6D, 0x21, 0x31, 0x99, 0x3B, 0xDA, 0x3B,
+  0x52, 0xEE, 0xA9, 0xB4, 0x90, 0x5B, 0xF0, 0x73, 0x56, 0x6C, 0x5E, 0x75, 0x13, 0x3B, 0x19, 0xF7,
+  0x32, 0x74, 0x15, 0x64, 0x38, 0xCE, 0x72, 0x53, 0xD2, 0x63, 0x71, 0x94, 0xA4, 0x08, 0xC5, 0xC4,
+  0x8E, 0xD5, 0x07, 0xF6, 0x72, 0x84, 0x07, 0x11, 0x42, 0x00, 0xF0, 0x42, 0xC9, 0xED, 0xF4, 0xE5,
+  0xEE, 0x42, 0x6A, 0x42, 0x0A, 0xF6, 0x5A, 0x85, 0xAD, 0xA4, 0x6B, 0x6B, 0xF8, 0x53, 0x1B, 0x4C,
+  0x6E, 0x63, 0x69, 0x3A, 0x2D, 0xEE, 0xF4, 0x9C, 0xB4, 0x84, 0x76, 0x43, 0x58, 0x64, 0xD8, 0x74,
+  0x0D, 0x4B, 0xCA, 0x21, 0x29, 0x94, 0xEC, 0x52, 0x8A, 0x3A, 0x89, 0x42, 0x78, 0x33, 0x8F, 0x5B,
+  0xDD, 0x64, 0x0F, 0x4B, 0x9E, 0x7D, 0xDE, 0xC6, 0x8F, 0x3A, 0x0F, 0x7C, 0x7E, 0x4C, 0x9E, 0x4C,
+  0xA2, 0x6A, 0xCD, 0x73, 0x58, 0xD6, 0x9F, 0xAE, 0x13, 0x6C, 0x1C, 0x3C, 0x36, 0x2B, 0xFA, 0x43,
+  0xF6, 0x8C, 0x15, 0x2B, 0x48, 0x19, 0xDC, 0x9D, 0x3D, 0xA6, 0x54, 0x74, 0x36, 0x95, 0x95, 0x4B,
+  0xD2, 0xE5, 0xDA, 0xA5, 0xF4, 0x63, 0xFE, 0x95, 0x17, 0x5C, 0x5A, 0x54, 0x5C, 0xB6, 0x83, 0x08,
+  0x9D, 0x5C, 0x63, 0x8B, 0xBA, 0x64, 0xC5, 0x10, 0xFE, 0x64, 0x99, 0xAD, 0x92, 0x8C, 0xD8, 0xB5,
+  0x6E, 0x32, 0x58, 0x95, 0xEF, 0x83, 0xFA, 0x74, 0x2E, 0xB5, 0x0C, 0x2A, 0x5A, 0xC6, 0xA0, 0x18,
+  0x15, 0x9D, 0xC9, 0x83, 0x32, 0xDE, 0xBB, 0x9D, 0x69, 0x42, 0x97, 0x74, 0xE0, 0x20, 0x1F, 0xCF,
+  0x3C, 0x7D, 0xCE, 0xE5, 0x0E, 0x1A, 0x5C, 0x54, 0x7E, 0xB6, 0xBC, 0xD6, 0x19, 0x85, 0xC1, 0x49,
+  0x22, 0x5A, 0x98, 0xDE, 0x1B, 0x7D, 0x9D, 0x8D, 0x15, 0x5C, 0x60, 0x10, 0x99, 0x6C, 0xE6, 0x10,
+  0x7A, 0x95, 0x7C, 0x85, 0xFB, 0xB5, 0x1D, 0x9E, 0x97, 0x6C, 0xA2, 0x10, 0x74, 0x84, 0x8C, 0x3A,
+  0x9D, 0xBE, 0xBD, 0xC6, 0xF4, 0xA4, 0x3F, 0xD7, 0x74, 0x53, 0xF0, 0x83, 0x4D, 0x32, 0x91, 0x8C,
+  0x95, 0x7C, 0x9B, 0xD6, 0xFC, 0x3B, 0x03, 0xA4, 0x1A, 0xBE, 0x89, 0x3A, 0xFE, 0xD6, 0x1D, 0x6D,
+  0x5E, 0xE7, 0x78, 0x2B, 0x97, 0x3B, 0x9F, 0xEF, 0x56, 0x74, 0x7A, 0x64, 0xA5, 0x31, 0x9B, 0x5C,
+  0xFC, 0xA5, 0x1F, 0x8E, 0x38, 0xBE, 0x5C, 0xC6, 0xF2, 0xC4, 0xF9, 0x84, 0x13, 0x9D, 0x19, 0x7D,
+  0x89, 0x21, 0xFC, 0x74, 0x0A, 0xBD, 0xA4, 0x93, 0xE8, 0xC4, 0x47, 0x73, 0x7C, 0xFF, 0x89, 0x19,
+  0x93, 0x4B, 0xEC, 0x21, 0xF6, 0x63, 0x0A, 0x2A, 0x19, 0x4C, 0x27, 0x42, 0x70, 0x32, 0x03, 0x7B,
+  0x25, 0x19, 0x78, 0xA5, 0x7E, 0x85, 0xE3, 0xA3, 0xE4, 0xA3, 0x9B, 0xCE, 0xE8, 0x62, 0xF6, 0x94,
+  0x1D, 0xDF, 0xAA, 0x19, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xC3, 0x00, 0x05, 0x51,
+  0x00, 0x8C, 0x4B, 0x90, 0x90, 0x84, 0x50, 0x04, 0x90, 0x4B, 0x4B, 0x8C, 0x51, 0xFF, 0x00, 0x91,
+  0x00, 0x1C, 0x51, 0x8C, 0xB4, 0x7F, 0xE6, 0x0E, 0x1D, 0x16, 0x41, 0x41, 0xDA, 0xAB, 0x58, 0xAB,
+  0x58, 0xB5, 0xAB, 0xAB, 0x64, 0xA2, 0x41, 0x2B, 0x1D, 0x0E, 0x9A, 0x7F, 0xB4, 0x8C, 0x51, 0xFF,
+  0x00, 0x86, 0x00, 0x16, 0x8C, 0x50, 0x66, 0x95, 0x2B, 0x64, 0x58, 0xB8, 0x30, 0x70, 0x30, 0x30,
+  0x70, 0x30, 0xA4, 0x30, 0x30, 0xA4, 0x70, 0x30, 0x30, 0x35, 0x35, 0x82, 0x34, 0x82, 0x35, 0x07,
+  0xB8, 0x58, 0xB3, 0x16, 0x71, 0x66, 0xB4, 0x4B, 0xFE, 0x00, 0x2B, 0x51, 0x4B, 0x7F, 0x95, 0x08,
+  0xB5, 0x8B, 0x30, 0x30, 0x78, 0x35, 0x78, 0x30, 0x35, 0x34, 0x35, 0x34, 0x34, 0x2E, 0x34, 0x35,
+  0x78, 0x35, 0x2E, 0x6F, 0x39, 0x91, 0x36, 0x74, 0x36, 0x74, 0x36, 0x36, 0x39, 0x42, 0x2E, 0x34,
+  0x81, 0x81, 0x58, 0x16, 0x71, 0x7F, 0x4B, 0xF9, 0x00, 0x1B, 0x4B, 0x66, 0x2C, 0x64, 0x81, 0x70,
+  0xA4, 0x35, 0x2E, 0x2E, 0x6F, 0x2E, 0x88, 0x2E, 0x6F, 0x6F, 0x34, 0x2E, 0x35, 0x30, 0x8B, 0x30,
+  0x81, 0x80, 0x35, 0x35, 0x91, 0x8D, 0x86, 0x2D, 0x82, 0x73, 0x0A, 0x36, 0x39, 0x42, 0x34, 0x30,
+  0x30, 0x80, 0x64, 0x1D, 0x66, 0xB4, 0x86, 0x00, 0x01, 0xBA, 0xBA, 0xEA, 0x00, 0x1D, 0x4B, 0xE4,
+  0x0E, 0x64, 0x81, 0xA4, 0x30, 0x35, 0x2E, 0xB0, 0xA5, 0x35, 0x34, 0x42, 0x39, 0x91, 0x6D, 0x91,
+  0x88, 0x70, 0xA4, 0xD0, 0xC0, 0x81, 0x81, 0x80, 0x81, 0x30, 0xB8, 0xDE, 0x84, 0x8A, 0x13, 0x5C,
+  0x8A, 0x5C, 0x5C, 0xA8, 0xA8, 0x2D, 0x2D, 0x36, 0x36, 0x39, 0x39, 0x34, 0x35, 0x30, 0x81, 0x64,
+  0x0E, 0xE4, 0x4B, 0xEE, 0x00, 0x06, 0x50, 0x9A, 0x46, 0x80, 0x30, 0x30, 0x35, 0x82, 0x2E, 0x09,
+  0xB6, 0x6D, 0x42, 0x6D, 0x8D, 0xA8, 0x8D, 0x8D, 0xDE, 0x34, 0x85, 0x28, 0x08, 0xD0, 0x70, 0x88,
+  0x98, 0x8F, 0x27, 0x27, 0x5C, 0x5C, 0x83, 0x37, 0x06, 0x11, 0x6B, 0x11, 0x6B, 0x37, 0x7C, 0x7C,
+  0x82, 0x2D, 0x0A, 0x36, 0x39, 0x2E, 0x34, 0x30, 0x30, 0x80, 0x46, 0xC3, 0x90, 0x51, 0xE9, 0x00,
+  0x13, 0x50, 0x71, 0x64, 0x35, 0x78, 0x35, 0x2E, 0x2E, 0xCC, 0xA5, 0xA5, 0x6D, 0xA8, 0x8D, 0x6D,
+  0x6D, 0xDE, 0xB6, 0xD5, 0x70, 0x89, 0x28, 0x07, 0xC0, 0xA9, 0xA0, 0x41, 0x5B, 0x22, 0x11, 0x11,
+  0x84, 0x05, 0x01, 0x62, 0x22, 0x83, 0x37, 0x82, 0x5C, 0x0A, 0x36, 0x91, 0x42, 0x2E, 0x34, 0x78,
+  0x30, 0xA9, 0x64, 0x71, 0x50, 0xE5, 0x00, 0x07, 0x51, 0x7F, 0x52, 0x58, 0x35, 0x35, 0x88, 0x2E,
+  0x82, 0x42, 0x08, 0x6D, 0x91, 0x6D, 0x6D, 0x8F, 0xAF, 0x98, 0x8B, 0xCD, 0x8C, 0x28, 0x05, 0xBE,
+  0xB5, 0x58, 0x63, 0x0F, 0x62, 0x82, 0x05, 0x01, 0x38, 0x38, 0x85, 0x05, 0x12, 0x11, 0x05, 0x11,
+  0xCF, 0x37, 0x7C, 0xA8, 0x8D, 0x39, 0x42, 0x6F, 0xD6, 0x34, 0x30, 0x35, 0x58, 0x1D, 0x50, 0x51,
+  0xE1, 0x00, 0x10, 0x50, 0x0E, 0xDC, 0x35, 0x34, 0x2E, 0x6F, 0x42, 0x39, 0x91, 0x91, 0x6D, 0x6D,
+  0x98, 0x58, 0x86, 0xBE, 0x8E, 0x28, 0x0F, 0xD0, 0xBE, 0x8B, 0xBD, 0x58, 0x22, 0x05, 0x38, 0x05,
+  0x0C, 0x38, 0x0C, 0x05, 0x26, 0x38, 0x26, 0x84, 0x05, 0x83, 0x11, 0x0E, 0x6B, 0x37, 0x5C, 0x6D,
+  0x39, 0x42, 0x6F, 0x2E, 0x34, 0x78, 0x35, 0xDC, 0x71, 0x50, 0x51, 0xDD, 0x00, 0x0F, 0x4B, 0x95,
+  0xAB, 0xBD, 0x34, 0x2E, 0x42, 0x42, 0x6D, 0x8D, 0xA8, 0x8D, 0x6D, 0x35, 0x70, 0xCD, 0x8F, 0x28,
+  0x06, 0xCD, 0x70, 0xA0, 0x98, 0x64, 0x98, 0x63, 0x84, 0x05, 0x83, 0x06, 0x82, 0x38, 0x83, 0x05,
+  0x02, 0x11, 0x11, 0x05, 0x82, 0x11, 0x0D, 0xCF, 0x37, 0xA8, 0x91, 0x6D, 0xB6, 0x6F, 0x2E, 0x2E,
+  0x35, 0x81, 0xDA, 0xC3, 0x4B, 0xDA, 0x00, 0x0E, 0x51, 0x66, 0x46, 0x81, 0x35, 0xEF, 0x42, 0x39,
+  0x36, 0x2D, 0x5C, 0x5C, 0x8A, 0x58, 0x8B, 0x90, 0x28, 0x10, 0xBD, 0x80, 0x58, 0x63, 0x27, 0x27,
+  0x5B, 0x08, 0x05, 0x05, 0x08, 0x08, 0x22, 0x62, 0x05, 0x38, 0x38, 0x83, 0x05, 0x07, 0x62, 0x11,
+  0x22, 0x62, 0x22, 0x08, 0x37, 0x08, 0x82, 0x22, 0x0E, 0x37, 0x37, 0xA8, 0x91, 0x91, 0xA5, 0x42,
+  0x42, 0x2E, 0x2E, 0x78, 0x35, 0x46, 0x66, 0x51, 0xD7, 0x00, 0x0D, 0xB4, 0x2C, 0xA0, 0xA9, 0x2E,
+  0x42, 0x36, 0xA8, 0x7C, 0x7C, 0x37, 0x37, 0x58, 0xC0, 0x8B, 0x28, 0x07, 0xAA, 0xCD, 0x8B, 0x92,
+  0xA0, 0x92, 0xA0, 0x63, 0x83, 0x27, 0x0D, 0x5B, 0x05, 0x05, 0x0F, 0x0F, 0x5B, 0x63, 0x08, 0x89,
+  0x5B, 0x08, 0x08, 0x5B, 0x5B, 0x87, 0x27, 0x06, 0x8A, 0x98, 0x35, 0xB6, 0x8F, 0x8F, 0xD2, 0x82,
+  0x6D, 0x0A, 0x91, 0x39, 0x6D, 0xA5, 0x98, 0xB6, 0x2E, 0x30, 0xD5, 0x2C, 0x50, 0xD4, 0x00, 0x0D,
+  0x51, 0x66, 0x41, 0x30, 0x35, 0x42, 0xCC, 0xA8, 0x5C, 0x37, 0x3B, 0x37, 0xD2, 0x8B, 0x82, 0x28,
+  0x21, 0xCD, 0xBE, 0xBE, 0xAA, 0xC0, 0xCB, 0xD0, 0x28, 0x28, 0xC9, 0x96, 0x7D, 0x83, 0xDC, 0x63,
+  0x41, 0x08, 0x08, 0x22, 0x0F, 0x0F, 0x05, 0x0F, 0x06, 0x05, 0x06, 0x05, 0x0F, 0x63, 0x96, 0x86,
+  0xA0, 0x86, 0x63, 0x83, 0x27, 0x1D, 0x63, 0x63, 0xAF, 0x98, 0x27, 0x27, 0x8A, 0x27, 0x63, 0x27,
+  0x58, 0xB0, 0x58, 0x41, 0x41, 0xD2, 0x8F, 0x8F, 0x6D, 0x8F, 0x8F, 0x98, 0x64, 0xAF, 0xA5, 0x78,
+  0x30, 0x41, 0x66, 0x51, 0xD1, 0x00, 0x11, 0x90, 0x0E, 0x80, 0x35, 0x6F, 0x42, 0x6D, 0x5C, 0x7C,
+  0x37, 0x3B, 0x22, 0x63, 0x8B, 0x28, 0xBE, 0x86, 0x58, 0x85, 0x63, 0x0C, 0x41, 0x64, 0x96, 0x96,
+  0x46, 0x41, 0x08, 0x08, 0x22, 0x22, 0x05, 0x05, 0x43, 0x82, 0x06, 0x12, 0x0C, 0x05, 0x06, 0x05,
+  0x0F, 0x08, 0x41, 0xA2, 0xA2, 0x41, 0x41, 0x08, 0x27, 0x27, 0x89, 0x27, 0x5B, 0x08, 0x63, 0x83,
+  0x27, 0x17, 0x63, 0x63, 0x8A, 0x27, 0xD2, 0xD2, 0x63, 0x49, 0x45, 0x49, 0x41, 0x8F, 0x8F, 0x41,
+  0xD1, 0xD1, 0x64, 0x64, 0xAF, 0x34, 0x30, 0xA0, 0x0E, 0x90, 0xCF, 0x00, 0x10, 0x7F, 0x46, 0x35,
+  0x34, 0x6F, 0x6D, 0x6D, 0x2D, 0x37, 0x11, 0x22, 0x22, 0x5B, 0x58, 0x58, 0x63, 0x08, 0x84, 0x22,
+  0x0F, 0x5B, 0x27, 0x08, 0x5B, 0x08, 0x08, 0x22, 0x08, 0x22, 0x22, 0x62, 0x22, 0x0F, 0x0F, 0x05,
+  0x05, 0x84, 0x06, 0x08, 0x43, 0x0F, 0x05, 0x22, 0x63, 0x64, 0x16, 0x64, 0x5B, 0x84, 0x27, 0x00,
+  0x5B, 0x82, 0x27, 0x00, 0x08, 0x83, 0x27, 0x08, 0x63, 0x27, 0x8A, 0x63, 0x08, 0x87, 0x1C, 0x49,
+  0x1C, 0x82, 0x49, 0x0A, 0x45, 0x82, 0x46, 0x46, 0xA2, 0x64, 0x2E, 0x30, 0x30, 0x87, 0x7F, 0xCC,
+  0x00, 0x09, 0x8C, 0x66, 0x64, 0x35, 0x34, 0x6F, 0x8F, 0x8F, 0x5C, 0x3B, 0x82, 0x11, 0x83, 0x22,
+  0x01, 0x11, 0x11, 0x82, 0x05, 0x06, 0x0F, 0x22, 0x08, 0x27, 0x89, 0x27, 0x5B, 0x84, 0x22, 0x06,
+  0x62, 0x08, 0x0F, 0x05, 0x1D, 0x06, 0x38, 0x83, 0x06, 0x17, 0x05, 0x05, 0x0F, 0x08, 0x08, 0x5B,
+  0x5B, 0x08, 0x08, 0x5B, 0x27, 0x89, 0x27, 0x08, 0x27, 0x08, 0x5B, 0x89, 0x27, 0x08, 0x08, 0x63,
+  0x27, 0x27, 0x82, 0x63, 0x01, 0x41, 0x2B, 0x82, 0x1C, 0x0F, 0x49, 0x1C, 0x49, 0x1C, 0x1C, 0x49,
+  0x1C, 0x46, 0xD1, 0x64, 0xB0, 0x35, 0x30, 0x64, 0x9A, 0x51, 0xC9, 0x00, 0x0D, 0x8C, 0x95, 0x80,
+  0x35, 0x34, 0x6F, 0x39, 0x8D, 0x7C, 0x22, 0x62, 0x11, 0x05, 0x11, 0x84, 0x05, 0x08, 0x0F, 0x0F,
+  0x05, 0x0F, 0x22, 0x27, 0x08, 0x2A, 0x2B, 0x82, 0x08, 0x00, 0x22, 0x84, 0x0F, 0x04, 0x05, 0x06,
+  0x06, 0x05, 0x43, 0x82, 0x06, 0x09, 0x43, 0x05, 0x0F, 0x0F, 0x5B, 0x89, 0x08, 0x27, 0x08, 0x5B,
+  0x82, 0x08, 0x0F, 0x5B, 0x08, 0x27, 0x5B, 0x89, 0x27, 0x27, 0x41, 0x96, 0x86, 0x89, 0x27, 0x63,
+  0x27, 0x27, 0x08, 0x86, 0x1C, 0x0D, 0x45, 0x1C, 0x49, 0x1C, 0x1C, 0x2B, 0x46, 0x64, 0xA5, 0x34,
+  0x30, 0xA0, 0x95, 0x4B, 0xC7, 0x00, 0x04, 0x4B, 0x52, 0xB8, 0x34, 0x2E, 0x82, 0x6D, 0x00, 0x7C,
+  0x83, 0x11, 0x04, 0x05, 0x05, 0x0F, 0x0F, 0x05, 0x84, 0x0F, 0x09, 0x22, 0x5B, 0x08, 0x2A, 0x1C,
+  0x3F, 0x3F, 0x16, 0x89, 0x22, 0x82, 0x0F, 0x00, 0x05, 0x87, 0x06, 0x06, 0x43, 0x0F, 0x0F, 0x22,
+  0x08, 0x08, 0x5B, 0x84, 0x08, 0x0B, 0x27, 0x27, 0x08, 0x27, 0x08, 0x5B, 0x5B, 0x27, 0x08, 0x8B,
+  0x8B, 0x41, 0x84, 0x27, 0x06, 0x89, 0x48, 0x1C, 0x0B, 0x0B, 0x1C, 0x0B, 0x84, 0x1C, 0x0A, 0x49,
+  0x1C, 0x49, 0x87, 0x41, 0x98, 0x2E, 0x78, 0x81, 0x2C, 0x4B, 0xC5, 0x00, 0x08, 0xB4, 0x16, 0xBD,
+  0x34, 0x6F, 0x8F, 0x8F, 0x8A, 0x3B, 0x82, 0x11, 0x01, 0x0F, 0x11, 0x83, 0x62, 0x84, 0x22, 0x0D,
+  0x0F, 0x84, 0x08, 0x16, 0x6C, 0x4F, 0x61, 0x0B, 0x2B, 0x08, 0x22, 0x0F, 0x0F, 0x06, 0x82, 0x0E,
+  0x85, 0x06, 0x02, 0x05, 0x43, 0x0F, 0x8A, 0x08, 0x16, 0x5B, 0x08, 0x5B, 0x27, 0x08, 0x5B, 0xE7,
+  0x86, 0x08, 0x89, 0x27, 0x63, 0x27, 0x27, 0x08, 0x08, 0x2B, 0x0B, 0x40, 0x0B, 0x1C, 0x13, 0x13,
+  0x82, 0x1C, 0x00, 0x2A, 0x82, 0x1C, 0x08, 0x2B, 0x79, 0xB1, 0xB3, 0xA5, 0x34, 0x78, 0x0F, 0x90,
+  0xC3, 0x00, 0x12, 0x50, 0x16, 0x30, 0x34, 0x2E, 0x6D, 0x8F, 0x8A, 0x37, 0x11, 0x05, 0x0F, 0x11,
+  0x0F, 0x22, 0x62, 0x05, 0x0F, 0x05, 0x84, 0x0F, 0x07, 0x22, 0x0F, 0x0F, 0x1D, 0x2B, 0x46, 0x7D,
+  0x2B, 0x82, 0x08, 0x05, 0x0F, 0x06, 0x0E, 0x15, 0x15, 0x0C, 0x87, 0x06, 0x01, 0x0F, 0x0F, 0x85,
+  0x08, 0x00, 0x5B, 0x88, 0x08, 0x0B, 0x46, 0xBB, 0x16, 0x5B, 0x27, 0x27, 0x87, 0x87, 0x16, 0x16,
+  0x2A, 0x1C, 0x83, 0x5D, 0x05, 0x13, 0x0B, 0x1C, 0x1C, 0x13, 0x2A, 0x82, 0x1C, 0x08, 0x2B, 0x87,
+  0x41, 0xB3, 0xA5, 0x34, 0x30, 0x16, 0x50, 0x88, 0x00, 0x00, 0xBA, 0xB7, 0x00, 0x11, 0x50, 0x41,
+  0x30, 0x2E, 0x2E, 0x39, 0x39, 0x5C, 0x3B, 0x05, 0x05, 0x11, 0x05, 0x62, 0x0F, 0x0F, 0x62, 0x05,
+  0x83, 0x0F, 0x03, 0x05, 0x0F, 0x05, 0x43, 0x84, 0x0F, 0x0D, 0x08, 0x08, 0x22, 0x0F, 0x0F, 0x06,
+  0x0E, 0x0E, 0x06, 0x06, 0x43, 0x22, 0x0F, 0x0F, 0x83, 0x06, 0x07, 0x0F, 0x0F, 0x16, 0x16, 0x08,
+  0x1D, 0x48, 0x16, 0x85, 0x08, 0x00, 0x5B, 0x83, 0x08, 0x02, 0x87, 0x49, 0x08, 0x82, 0x89, 0x09,
+  0x08, 0x1C, 0x1C, 0x49, 0x1C, 0x13, 0x13, 0x5D, 0x5D, 0x0B, 0x82, 0x1C, 0x03, 0x0B, 0x1C, 0x03,
+  0x2A, 0x82, 0x1C, 0x09, 0x3F, 0x2B, 0x46, 0x41, 0xCC, 0x6F, 0x78, 0x41, 0x50, 0x4B, 0xBE, 0x00,
+  0x02, 0x50, 0x46, 0xA9, 0x82, 0x42, 0x02, 0x39, 0xA8, 0x22, 0x83, 0x05, 0x82, 0x0F, 0x83, 0x05,
+  0x03, 0x0F, 0x05, 0x05, 0x43, 0x82, 0x05, 0x03, 0x43, 0x05, 0x0F, 0x0F, 0x82, 0x08, 0x1C, 0x16,
+  0x43, 0x0E, 0x0E, 0x15, 0x06, 0x06, 0x43, 0x0F, 0x0F, 0x22, 0x16, 0x62, 0x08, 0x08, 0x0F, 0x2C,
+  0x52, 0x6E, 0x10, 0x68, 0x03, 0x6E, 0x13, 0x2A, 0x08, 0x5B, 0x08, 0x5B, 0x82, 0x08, 0x0F, 0x27,
+  0x08, 0x08, 0x2B, 0x5D, 0x16, 0x08, 0x5B, 0x27, 0x08, 0x2B, 0x5D, 0x1C, 0x1C, 0x5D, 0x0B, 0x82,
+  0x03, 0x13, 0x5D, 0x13, 0x0B, 0x1C, 0x1C, 0x2A, 0x5D, 0x3F, 0x3F, 0x49, 0x3F, 0x3F, 0x79, 0x46,
+  0x41, 0x8F, 0x2E, 0x78, 0x46, 0x50, 0xBD, 0x00, 0x0D, 0x50, 0x41, 0x30, 0x42, 0x39, 0x42, 0x39,
+  0x6D, 0x37, 0x05, 0x05, 0x38, 0x05, 0x06, 0x84, 0x05, 0x05, 0x43, 0x06, 0x05, 0x06, 0x43, 0x05,
+  0x85, 0x0F, 0x00, 0x84, 0x82, 0x08, 0x01, 0x84, 0x05, 0x84, 0x06, 0x01, 0x0F, 0x0F, 0x84, 0x08,
+  0x04, 0x1D, 0x55, 0x10, 0x65, 0x03, 0x84, 0x10, 0x02, 0x02, 0x2C, 0x16, 0x88, 0x08, 0x01, 0x48,
+  0x48, 0x82, 0x08, 0x1E, 0x27, 0x16, 0x0B, 0x03, 0x3F, 0x5D, 0x13, 0x13, 0x0B, 0x5D, 0x5D, 0x10,
+  0x1C, 0x13, 0x13, 0x31, 0x13, 0x0B, 0x3F, 0x13, 0x3F, 0x3F, 0x2B, 0x3F, 0x16, 0x41, 0x98, 0x2E,
+  0x30, 0x46, 0x50, 0xBB, 0x00, 0x0F, 0x4B, 0x2B, 0xA9, 0x42, 0x91, 0x8D, 0x5C, 0x8A, 0x37, 0x05,
+  0x38, 0x38, 0x06, 0x38, 0x06, 0x06, 0x82, 0x05, 0x04, 0x06, 0x43, 0x05, 0x0F, 0x0F, 0x84, 0x22,
+  0x02, 0x0F, 0x08, 0x22, 0x82, 0x08, 0x04, 0x16, 0x08, 0x0F, 0x0F, 0x43, 0x82, 0x1D, 0x00, 0x0F,
+  0x83, 0x08, 0x05, 0x16, 0x0E, 0x13, 0x03, 0x03, 0x68, 0x86, 0x02, 0x03, 0x10, 0x13, 0x1D, 0x16,
+  0x89, 0x08, 0x0A, 0x16, 0x2B, 0x2A, 0x16, 0x2B, 0x13, 0x03, 0x2A, 0x2A, 0x1C, 0x13, 0x82, 0x03,
+  0x03, 0x68, 0x03, 0x13, 0x5D, 0x82, 0x13, 0x0C, 0x3F, 0x13, 0x3F, 0x6C, 0x3F, 0x3F, 0xB1, 0x41,
+  0x98, 0x2E, 0x30, 0x16, 0x90, 0xB9, 0x00, 0x0F, 0x4B, 0x48, 0x35, 0x42, 0x74, 0x2D, 0x6B, 0x11,
+  0x05, 0x05, 0x26, 0x38, 0x26, 0x06, 0x06, 0x38, 0x83, 0x06, 0x09, 0x43, 0x06, 0x0F, 0x0F, 0x22,
+  0x84, 0x22, 0x08, 0x84, 0x22, 0x82, 0x0F, 0x04, 0x22, 0x08, 0x16, 0x08, 0x62, 0x82, 0x0F, 0x03,
+  0x62, 0x0F, 0x1D, 0x0F, 0x82, 0x08, 0x01, 0x1D, 0x71, 0x82, 0x10, 0x86, 0x02, 0x00, 0x10, 0x83,
+  0x02, 0x03, 0x13, 0x2B, 0x08, 0x08, 0x82, 0x16, 0x01, 0x2B, 0x2B, 0x82, 0x2A, 0x16, 0x13, 0x03,
+  0x21, 0x21, 0x1C, 0x03, 0x13, 0x1C, 0x5D, 0x68, 0x03, 0x03, 0x13, 0x68, 0x10, 0x03, 0x13, 0x03,
+  0x13, 0x03, 0x13, 0x13, 0x03, 0x83, 0x3F, 0x06, 0x2B, 0x41, 0x98, 0x88, 0x70, 0x48, 0x4B, 0xB7,
+  0x00, 0x10, 0x51, 0x71, 0x35, 0x42, 0x36, 0x2D, 0x6B, 0x11, 0x11, 0x05, 0x26, 0x38, 0x0C, 0x26,
+  0x0C, 0x06, 0x05, 0x85, 0x06, 0x02, 0x05, 0x0F, 0x22, 0x83, 0x08, 0x83, 0x0F, 0x03, 0x84, 0x08,
+  0x0F, 0x22, 0x87, 0x08, 0x05, 0x16, 0x2C, 0x52, 0x02, 0x02, 0x10, 0x82, 0x02, 0x01, 0x56, 0x56,
+  0x82, 0x02, 0x1B, 0x56, 0x02, 0x02, 0x56, 0x02, 0x02, 0x68, 0x10, 0x2A, 0x08, 0x13, 0x2A, 0x16,
+  0x48, 0x13, 0x68, 0x03, 0x03, 0x65, 0x03, 0x03, 0x10, 0x03, 0x5D, 0x5D, 0x13, 0x49, 0x13, 0x82,
+  0x03, 0x02, 0x13, 0x10, 0x10, 0x83, 0x03, 0x0E, 0x13, 0x03, 0x6C, 0x13, 0x13, 0x3F, 0x3F, 0x49,
+  0x46, 0x41, 0x8F, 0x34, 0xBD, 0x71, 0x8C, 0xB6, 0x00, 0x07, 0x95, 0xB8, 0x2E, 0x36, 0x2D, 0x3B,
+  0x7B, 0x05, 0x82, 0x26, 0x04, 0x0C, 0x38, 0x06, 0x38, 0x05, 0x83, 0x06, 0x08, 0x0C, 0x06, 0x43,
+  0x0F, 0x22, 0x08, 0x08, 0x22, 0x84, 0x82, 0x0F, 0x00, 0x22, 0x84, 0x08, 0x00, 0x16, 0x82, 0x08,
+  0x08, 0x16, 0x16, 0x55, 0x55, 0x02, 0x10, 0x02, 0x02, 0x10, 0x82, 0x02, 0x1C, 0x56, 0x02, 0x55,
+  0x52, 0x10, 0x02, 0x56, 0x02, 0x56, 0x56, 0x10, 0x55, 0x10, 0x10, 0x2C, 0x16, 0x2A, 0x6E, 0x2A,
+  0x03, 0x10, 0x10, 0x23, 0x23, 0x03, 0x23, 0x03, 0x21, 0x5D, 0x82, 0x10, 0x1A, 0x55, 0x03, 0x5D,
+  0x03, 0x03, 0x10, 0x03, 0x03, 0x10, 0x03, 0x13, 0x03, 0x03, 0x13, 0x6E, 0x13, 0x6C, 0x13, 0x13,
+  0x2B, 0x79, 0x46, 0xB9, 0xAF, 0x34, 0x81, 0x95, 0xB5, 0x00, 0x0F, 0xDD, 0x58, 0x2E, 0x36, 0x7A,
+  0x3B, 0x11, 0x7E, 0x05, 0x05, 0x26, 0x38, 0x06, 0x0C, 0x38, 0x05, 0x83, 0x06, 0x05, 0x0C, 0x06,
+  0x06, 0x0F, 0x1D, 0x0F, 0x83, 0x06, 0x09, 0x1D, 0x0F, 0x08, 0x08, 0x0F, 0x16, 0x08, 0x16, 0x08,
+  0x16, 0x82, 0x08, 0x1A, 0x1D, 0x10, 0x1C, 0x0B, 0x03, 0x10, 0x10, 0x02, 0x02, 0x56, 0x02, 0x56,
+  0x02, 0x55, 0x16, 0x2C, 0x02, 0x56, 0x02, 0x02, 0x56, 0x56, 0x55, 0x16, 0x1D, 0x48, 0x13, 0x83,
+  0x10, 0x87, 0x02, 0x04, 0x10, 0x68, 0x23, 0x03, 0x68, 0x82, 0x03, 0x18, 0x13, 0x10, 0x03, 0x10,
+  0x03, 0x03, 0x10, 0x03, 0x03, 0x65, 0x03, 0x6E, 0x13, 0x03, 0x6E, 0x2A, 0x13, 0x2A, 0x79, 0x46,
+  0xB9, 0xA5, 0x78, 0xB5, 0xE4, 0xB3, 0x00, 0x09, 0x50, 0xB9, 0x2E, 0x39, 0x7A, 0x3C, 0x11, 0x7B,
+  0x05, 0x05, 0x82, 0x26, 0x82, 0x38, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x06, 0x15, 0x0E, 0x83, 0x06,
+  0x0B, 0x43, 0x06, 0x06, 0x1D, 0x0F, 0x08, 0x08, 0x2C, 0x6E, 0x13, 0x1D, 0x16, 0x83, 0x08, 0x13,
+  0x16, 0xBC, 0x03, 0x03, 0x68, 0x02, 0x09, 0x02, 0x02, 0x56, 0x56, 0xBC, 0x2C, 0x52, 0x52, 0x10,
+  0x02, 0x02, 0x56, 0x56, 0x82, 0x02, 0x04, 0x10, 0x1D, 0x2C, 0x48, 0x10, 0x82, 0x02, 0x00, 0x23,
+  0x87, 0x02, 0x08, 0x03, 0x02, 0x68, 0x02, 0x68, 0x09, 0x03, 0x03, 0x10, 0x82, 0x03, 0x85, 0x10,
+  0x0F, 0x65, 0x13, 0x65, 0x03, 0x13, 0x13, 0x2C, 0x6C, 0x49, 0x49, 0xB1, 0xB3, 0xB0, 0x78, 0x41,
+  0x50, 0xB1, 0x00, 0x12, 0x4B, 0x1D, 0x34, 0x39, 0x2D, 0x3C, 0x6B, 0x11, 0x7E, 0x7E, 0x05, 0x05,
+  0x06, 0x05, 0x38, 0x06, 0x05, 0x05, 0x0C, 0x82, 0x06, 0x04, 0x0C, 0x07, 0x07, 0x06, 0x43, 0x82,
+  0x0F, 0x08, 0x05, 0x22, 0x08, 0x08, 0x1D, 0x03, 0x10, 0x10, 0x16, 0x84, 0x08, 0x14, 0x2C, 0x10,
+  0x5D, 0x10, 0x02, 0x02, 0x56, 0x02, 0x02, 0x56, 0xBC, 0x16, 0x08, 0x6E, 0x02, 0x56, 0x25, 0x5E,
+  0x02, 0x56, 0x56, 0x82, 0x02, 0x01, 0x10, 0x10, 0x84, 0x02, 0x03, 0xA1, 0x02, 0x02, 0x56, 0x86,
+  0x02, 0x06, 0x23, 0x68, 0x23, 0x10, 0x68, 0x10, 0x03, 0x83, 0x10, 0x00, 0x03, 0x85, 0x10, 0x0E,
+  0x13, 0x03, 0x6E, 0x03, 0x03, 0x13, 0x2B, 0x1C, 0xB1, 0x46, 0xB3, 0x34, 0x30, 0x48, 0x4B, 0xAF,
+  0x00, 0x07, 0x51, 0xC3, 0xB8, 0x39, 0x2D, 0x3C, 0x6B, 0x11, 0x86, 0x05, 0x05, 0x38, 0x05, 0x06,
+  0x06, 0x0C, 0x15, 0x83, 0x07, 0x01, 0x0C, 0x0F, 0x83, 0x08, 0x07, 0x16, 0x48, 0x2A, 0x48, 0x55,
+  0x10, 0x10, 0x2A, 0x85, 0x08, 0x03, 0x55, 0x10, 0x02, 0x02, 0x83, 0x56, 0x0B, 0x5E, 0x25, 0x48,
+  0x08, 0x08, 0x55, 0x02, 0x5E, 0x25, 0x25, 0x5E, 0x25, 0x83, 0x56, 0x01, 0x02, 0x10, 0x82, 0x02,
+  0x04, 0x5E, 0x56, 0x02, 0x5E, 0x56, 0x8A, 0x02, 0x1D, 0x23, 0x02, 0x03, 0x23, 0x68, 0x68, 0x03,
+  0x10, 0x68, 0x10, 0x03, 0x10, 0x65, 0x10, 0x65, 0x10, 0x10, 0x65, 0x65, 0x6E, 0x13, 0x13, 0x2B,
+  0x49, 0x16, 0x41, 0xDE, 0x34, 0xB8, 0x9A, 0xAF, 0x00, 0x09, 0x50, 0x58, 0x2E, 0x74, 0xC7, 0x6B,
+  0x11, 0x11, 0x7E, 0x7E, 0x86, 0x05, 0x04, 0x06, 0x0C, 0x0C, 0x15, 0x15, 0x82, 0x07, 0x00, 0x06,
+  0x83, 0x08, 0x07, 0x2C, 0x03, 0x10, 0x10, 0x2C, 0x03, 0x02, 0x2A, 0x86, 0x08, 0x0E, 0x6E, 0x02,
+  0x02, 0xBC, 0x25, 0x25, 0x5E, 0x25, 0x56, 0x02, 0x52, 0x48, 0x2C, 0x02, 0x02, 0x85, 0x25, 0x0D,
+  0x02, 0x25, 0x25, 0x56, 0x02, 0x02, 0x56, 0x02, 0x02, 0xA1, 0x5E, 0x25, 0x02, 0x56, 0x87, 0x02,
+  0x02, 0x10, 0x02, 0x02, 0x84, 0x10, 0x00, 0x23, 0x89, 0x10, 0x0D, 0x65, 0x10, 0x6E, 0x03, 0x2C,
+  0x3F, 0x2B, 0x79, 0x46, 0xB9, 0xA5, 0x78, 0x58, 0x7F, 0xAD, 0x00, 0x0A, 0x4B, 0x16, 0x35, 0x36,
+  0x7A, 0x3B, 0x11, 0x11, 0x26, 0x38, 0x38, 0x83, 0x05, 0x83, 0x06, 0x02, 0x07, 0x07, 0x15, 0x82,
+  0x07, 0x0D, 0x0C, 0x0F, 0x0F, 0x84, 0x08, 0x2B, 0x10, 0x02, 0x03, 0x2A, 0x2B, 0x13, 0x10, 0x2B,
+  0x86, 0x08, 0x06, 0x16, 0x1D, 0x16, 0xC1, 0x02, 0x25, 0x25, 0x82, 0x02, 0x02, 0x25, 0x0E, 0x69,
+  0x83, 0x02, 0x82, 0x25, 0x00, 0xE8, 0x84, 0x25, 0x08, 0x02, 0x02, 0xA1, 0x02, 0x02, 0xA1, 0xA1,
+  0x02, 0x25, 0x84, 0x02, 0x00, 0x25, 0x84, 0x02, 0x00, 0x23, 0x83, 0x10, 0x06, 0x68, 0x68, 0x03,
+  0x10, 0x23, 0x10, 0x65, 0x84, 0x10, 0x0D, 0x65, 0x10, 0x03, 0x6E, 0x13, 0x16, 0x49, 0x49, 0xB9,
+  0xAF, 0x2E, 0x78, 0x16, 0x4B, 0xAC, 0x00, 0x08, 0xC3, 0x30, 0x42, 0x2D, 0x3C, 0x6B, 0x11, 0x05,
+  0x26, 0x83, 0x05, 0x06, 0x0F, 0x43, 0x05, 0x06, 0x06, 0x07, 0x15, 0x85, 0x07, 0x0C, 0x06, 0x0F,
+  0x08, 0x1D, 0x03, 0x03, 0x65, 0x48, 0x16, 0x16, 0x03, 0x03, 0x16, 0x86, 0x08, 0x00, 0x16, 0x82,
+  0x2C, 0x0E, 0x25, 0x56, 0x25, 0x25, 0x02, 0x71, 0x52, 0xC1, 0x1D, 0x52, 0x55, 0x71, 0x71, 0x55,
+  0x10, 0x82, 0x25, 0x08, 0x5E, 0x25, 0x25, 0x56, 0x02, 0x5E, 0x02, 0x25, 0x5E, 0x82, 0x02, 0x06,
+  0x5E, 0x25, 0x5E, 0x25, 0x02, 0x02, 0x25, 0x83, 0x02, 0x05, 0x68, 0x02, 0x23, 0x02, 0x23, 0x23,
+  0x82, 0x02, 0x05, 0x03, 0x10, 0x03, 0x03, 0x65, 0x02, 0x82, 0x10, 0x0D, 0x03, 0x03, 0x55, 0x03,
+  0x03, 0x2A, 0x2B, 0x45, 0x46, 0xAB, 0xA5, 0x34, 0x30, 0x71, 0xAB, 0x00, 0x12, 0x50, 0xDA, 0x88,
+  0x73, 0x3C, 0x3B, 0x6B, 0x11, 0x26, 0x05, 0x05, 0x11, 0x0F, 0x05, 0x05, 0x43, 0x06, 0x06, 0x0C,
+  0x84, 0x07, 0x06, 0x12, 0x07, 0x06, 0x0F, 0x84, 0x08, 0x16, 0x82, 0x2B, 0x04, 0x16, 0x65, 0x03,
+  0x10, 0x03, 0x83, 0x08, 0x07, 0x16, 0x08, 0x16, 0x2B, 0x03, 0x03, 0x48, 0x2C, 0x82, 0x25, 0x31,
+  0x02, 0xC1, 0x16, 0x16, 0x08, 0x2C, 0x55, 0x10, 0x10, 0x55, 0x52, 0x02, 0x10, 0x25, 0x02, 0xA1,
+  0x02, 0x02, 0x56, 0x02, 0x02, 0x5E, 0x02, 0xCA, 0x5E, 0x25, 0x5E, 0x25, 0x5E, 0x25, 0x02, 0x25,
+  0x5E, 0xA1, 0x25, 0x02, 0x02, 0x23, 0x23, 0x10, 0x68, 0x02, 0x10, 0x02, 0x10, 0x23, 0x10, 0x10,
+  0x23, 0x10, 0x83, 0x02, 0x84, 0x10, 0x0B, 0x03, 0x13, 0x13, 0x2B, 0x1C, 0x79, 0xAB, 0xA0, 0xB0,
+  0x30, 0xAB, 0x7F, 0xA9, 0x00, 0x07, 0x51, 0x1D, 0x35, 0x39, 0x2D, 0x3B, 0x3B, 0x11, 0x82, 0x05,
+  0x03, 0x62, 0x11, 0x0F, 0x05, 0x82, 0x06, 0x00, 0x0C, 0x84, 0x07, 0x03, 0x12, 0x07, 0x07, 0x05,
+  0x85, 0x08, 0x1C, 0xC1, 0x03, 0x03, 0x09, 0x03, 0x13, 0x16, 0x08, 0x08, 0xE7, 0x08, 0x16, 0x16,
+  0x13, 0x10, 0x55, 0x2C, 0x6E, 0x02, 0x25, 0x25, 0x55, 0x1D, 0x2C, 0x08, 0x16, 0x52, 0x2C, 0x10,
+  0x83, 0x02, 0x03, 0x56, 0x02, 0x02, 0x56, 0x85, 0x02, 0x01, 0x25, 0xCA, 0x82, 0x02, 0x01, 0x6A,
+  0x69, 0x83, 0x02, 0x00, 0x25, 0x84, 0x02, 0x05, 0x23, 0x23, 0x02, 0x23, 0x02, 0x23, 0x85, 0x02,
+  0x14, 0x10, 0x03, 0x02, 0x65, 0x6E, 0x10, 0x65, 0x10, 0x03, 0x13, 0x13, 0x3F, 0x2B, 0x3F, 0x46,
+  0xB5, 0xB6, 0x34, 0x30, 0x1D, 0x8C, 0xA8, 0x00, 0x05, 0x66, 0x80, 0x2E, 0x73, 0x3C, 0x3B, 0x83,
+  0x11, 0x0B, 0x22, 0x22, 0x0F, 0x0F, 0x05, 0x06, 0x06, 0x0C, 0x15, 0x07, 0x07, 0x15, 0x84, 0x07,
+  0x01, 0x0E, 0x16, 0x83, 0x08, 0x0F, 0x16, 0x2A, 0x03, 0x09, 0x09, 0x23, 0x13, 0x16, 0x08, 0x08,
+  0xE7, 0x16, 0x08, 0x16, 0x03, 0x02, 0x83, 0x10, 0x01, 0x55, 0x55, 0x83, 0x16, 0x02, 0x55, 0x6E,
+  0x48, 0x83, 0x02, 0x02, 0x25, 0x02, 0x56, 0x86, 0x02, 0x02, 0x25, 0x6A, 0x25, 0x82, 0x5E, 0x08,
+  0xCA, 0x5E, 0x25, 0x02, 0x25, 0x5E, 0x02, 0x5E, 0x25, 0x83, 0x02, 0x04, 0x10, 0x23, 0x02, 0x02,
+  0x23, 0x84, 0x02, 0x07, 0x10, 0x65, 0x10, 0x03, 0x65, 0x03, 0x10, 0x10, 0x82, 0x13, 0x0A, 0x2A,
+  0x13, 0x2B, 0x1C, 0x3F, 0x7D, 0x86, 0x2E, 0x70, 0x81, 0xDD, 0xA7, 0x00, 0x07, 0x4B, 0x16, 0x35,
+  0x91, 0x2D, 0x37, 0x3B, 0xCF, 0x82, 0x22, 0x03, 0x37, 0x62, 0x05, 0x05, 0x82, 0x06, 0x02, 0x15,
+  0x15, 0x12, 0x85, 0x07, 0x02, 0x12, 0x12, 0x0F, 0x82, 0x08, 0x16, 0x16, 0x48, 0x2C, 0x03, 0x03,
+  0x02, 0x03, 0x2A, 0x08, 0x08, 0x2B, 0x13, 0x13, 0x2A, 0x13, 0x10, 0x10, 0x52, 0x2C, 0x16, 0x1D,
+  0x08, 0x16, 0x82, 0x08, 0x00, 0x55, 0x89, 0x02, 0x00, 0x25, 0x83, 0x02, 0x05, 0xA1, 0x6A, 0x02,
+  0x25, 0x5E, 0xCA, 0x84, 0x02, 0x05, 0x6A, 0x02, 0x02, 0xCA, 0x25, 0x25, 0x85, 0x02, 0x01, 0x68,
+  0x68, 0x82, 0x02, 0x19, 0x23, 0x65, 0x02, 0x10, 0x09, 0x10, 0x03, 0x02, 0x10, 0x03, 0x03, 0x10,
+  0x03, 0x6C, 0x1C, 0x1C, 0x3F, 0x79, 0x2B, 0x82, 0x96, 0x80, 0x35, 0xA4, 0x87, 0x4B, 0xA1, 0x00,
+  0x00, 0xBA, 0x83, 0x00, 0x06, 0x66, 0x80, 0x42, 0x36, 0x7C, 0x37, 0x37, 0x85, 0x22, 0x04, 0x0F,
+  0x38, 0x06, 0x06, 0x15, 0x85, 0x07, 0x00, 0x12, 0x83, 0x07, 0x00, 0x06, 0x84, 0x08, 0x1A, 0x16,
+  0x08, 0x2A, 0x03, 0x2A, 0x16, 0x16, 0x2A, 0x03, 0x02, 0x23, 0x02, 0x02, 0x65, 0x10, 0x03, 0x10,
+  0x1D, 0x16, 0x16, 0x2B, 0x16, 0x08, 0x48, 0x03, 0x02, 0x03, 0x86, 0x02, 0x02, 0x25, 0x6A, 0x6A,
+  0x86, 0x02, 0x03, 0x25, 0x25, 0x02, 0x5E, 0x87, 0x02, 0x00, 0x69, 0x87, 0x02, 0x03, 0x03, 0x09,
+  0x03, 0x02, 0x83, 0x03, 0x14, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x10, 0x10, 0x03, 0x1C, 0x2A,
+  0x6C, 0x1C, 0x1C, 0x45, 0x96, 0xB5, 0x35, 0x30, 0x8B, 0x9A, 0xA5, 0x00, 0x18, 0x4B, 0x89, 0x88,
+  0x91, 0x2D, 0x37, 0x11, 0x05, 0x62, 0x05, 0x05, 0x22, 0x62, 0x0F, 0x05, 0x06, 0x0C, 0x06, 0x07,
+  0x07, 0x15, 0x15, 0x12, 0x12, 0x07, 0x84, 0x12, 0x09, 0xEB, 0x16, 0x08, 0x48, 0x48, 0x16, 0x48,
+  0x16, 0x16, 0x2B, 0x82, 0x13, 0x08, 0x23, 0x02, 0x09, 0x09, 0x10, 0x02, 0x03, 0x02, 0x02, 0x82,
+  0x10, 0x07, 0x55, 0x10, 0x6E, 0x6E, 0x65, 0x02, 0x10, 0x09, 0x83, 0x02, 0x03, 0x25, 0x02, 0x6A,
+  0xCA, 0x8C, 0x02, 0x00, 0x03, 0x8A, 0x02, 0x06, 0x23, 0x02, 0x03, 0x09, 0x09, 0x03, 0x09, 0x88,
+  0x03, 0x06, 0x02, 0x10, 0x10, 0x02, 0x03, 0x03, 0x13, 0x82, 0x1C, 0x08, 0x45, 0x61, 0xEE, 0xB7,
+  0xD5, 0x30, 0xA4, 0x41, 0x4B, 0xA4, 0x00, 0x0A, 0x9A, 0x80, 0x42, 0x36, 0x7C, 0x3B, 0x11, 0x11,
+  0x0F, 0x0F, 0x05, 0x82, 0x0F, 0x06, 0x06, 0x06, 0x07, 0x0E, 0x15, 0x12, 0x07, 0x83, 0x12, 0x83,
+  0x07, 0x08, 0x12, 0x12, 0x1D, 0x08, 0x2A, 0x03, 0x2C, 0x03, 0x2C, 0x83, 0x03, 0x02, 0x09, 0x09,
+  0x03, 0x83, 0x02, 0x00, 0x23, 0x86, 0x02, 0x06, 0x10, 0x02, 0x02, 0x09, 0x02, 0x02, 0x23, 0x84,
+  0x02, 0x02, 0x69, 0x02, 0x69, 0x8C, 0x02, 0x03, 0x03, 0x02, 0x02, 0x23, 0x83, 0x02, 0x06, 0x69,
+  0x02, 0x03, 0x03, 0x23, 0x03, 0x65, 0x84, 0x03, 0x03, 0x0B, 0x0B, 0x5D, 0x0B, 0x83, 0x03, 0x11,
+  0x02, 0x02, 0x10, 0x13, 0x0B, 0x13, 0x1C, 0x4F, 0x45, 0x4F, 0x83, 0x92, 0xB7, 0xD8, 0x35, 0x30,
+  0x8B, 0x66, 0xA3, 0x00, 0x0F, 0x4B, 0x46, 0x88, 0x91, 0x2D, 0x37, 0x11, 0x0F, 0x05, 0x11, 0x05,
+  0x05, 0x06, 0x05, 0x05, 0x0C, 0x82, 0x07, 0x8B, 0x12, 0x04, 0x07, 0x0E, 0x08, 0x2B, 0x10, 0x82,
+  0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x85, 0x02, 0x02, 0x03, 0x03, 0x09, 0x83, 0x02, 0x05, 0x03,
+  0x03, 0x09, 0x02, 0x02, 0x09, 0x93, 0x02, 0x09, 0x03, 0x02, 0x03, 0x23, 0x03, 0x03, 0x09, 0x03,
+  0x09, 0x03, 0x83, 0x02, 0x85, 0x03, 0x00, 0x21, 0x82, 0x0B, 0x00, 0x31, 0x83, 0x0B, 0x15, 0x03,
+  0x13, 0x03, 0x03, 0x02, 0x13, 0x0B, 0x29, 0x4F, 0x40, 0x45, 0x45, 0x4F, 0x9D, 0x92, 0x9B, 0xAA,
+  0x70, 0x34, 0xA4, 0x46, 0x4B, 0xA2, 0x00, 0x06, 0x66, 0xB8, 0x42, 0x74, 0x3C, 0x3B, 0x11, 0x84,
+  0x05, 0x04, 0x06, 0x0F, 0x06, 0x0C, 0x07, 0x82, 0x12, 0x04, 0xA7, 0x12, 0x9A, 0xA7, 0x07, 0x86,
+  0x12, 0x03, 0x15, 0x08, 0x22, 0x13, 0x86, 0x03, 0x03, 0x02, 0x02, 0x23, 0x23, 0x82, 0x02, 0x00,
+  0x03, 0x82, 0x02, 0x00, 0x09, 0x82, 0x03, 0x05, 0x09, 0x09, 0x03, 0x09, 0x02, 0x23, 0x84, 0x02,
+  0x03, 0x09, 0x02, 0x02, 0x6A, 0x82, 0x02, 0x00, 0x09, 0x84, 0x02, 0x02, 0x09, 0x09, 0x02, 0x83,
+  0x09, 0x02, 0x03, 0x09, 0x03, 0x83, 0x02, 0x82, 0x03, 0x04, 0x21, 0x03, 0x0B, 0x0B, 0x03, 0x85,
+  0x0B, 0x16, 0x1B, 0x0B, 0x0B, 0x03, 0x03, 0x02, 0x03, 0x0B, 0x4F, 0x60, 0x19, 0x4F, 0x29, 0x45,
+  0x60, 0x94, 0x9B, 0xAA, 0xCB, 0x35, 0x78, 0x81, 0x66, 0xA1, 0x00, 0x06, 0x8C, 0x2B, 0x30, 0x36,
+  0x73, 0x7C, 0x11, 0x84, 0x05, 0x05, 0x06, 0x0C, 0x06, 0x06, 0x07, 0x07, 0x83, 0x12, 0x02, 0xA7,
+  0x12, 0x12, 0x82, 0x06, 0x01, 0x16, 0x06, 0x83, 0x12, 0x0F, 0x08, 0x16, 0x13, 0x03, 0x03, 0x09,
+  0x09, 0x03, 0x03, 0x09, 0x03, 0x09, 0x02, 0x09, 0x03, 0x09, 0x84, 0x02, 0x07, 0x09, 0x23, 0x09,
+  0x09, 0x03, 0x23, 0x03, 0x23, 0x82, 0x02, 0x00, 0x03, 0x83, 0x02, 0x00, 0x09, 0x83, 0x02, 0x03,
+  0x09, 0x02, 0x03, 0x23, 0x82, 0x02, 0x07, 0x03, 0x03, 0x02, 0x09, 0x02, 0x02, 0x23, 0x23, 0x82,
+  0x03, 0x0F, 0x6A, 0x6A, 0x09, 0x03, 0x21, 0x0B, 0x21, 0x0B, 0x0B, 0x03, 0x0B, 0x31, 0x1B, 0x1B,
+  0x40, 0x40, 0x82, 0x0B, 0x01, 0x31, 0x13, 0x82, 0x03, 0x10, 0x40, 0x93, 0x60, 0x04, 0x60, 0x4F,
+  0x61, 0x4F, 0x04, 0x77, 0xAA, 0xCB, 0x35, 0x34, 0x70, 0x16, 0x51, 0xA0, 0x00, 0x05, 0x7F, 0xA0,
+  0x2E, 0x73, 0x3C, 0x11, 0x84, 0x05, 0x01, 0x15, 0x0C, 0x82, 0x15, 0x00, 0x07, 0x85, 0x12, 0x14,
+  0xA7, 0x12, 0x06, 0x1D, 0x1D, 0x6E, 0x2C, 0x06, 0x07, 0x07, 0x0E, 0x08, 0x16, 0x21, 0x21, 0x09,
+  0x03, 0x09, 0x02, 0x09, 0x09, 0x83, 0x02, 0x00, 0x09, 0x82, 0x02, 0x0C, 0x09, 0x09, 0x02, 0x03,
+  0x02, 0x09, 0x03, 0x02, 0x09, 0x03, 0x02, 0x02, 0x23, 0x89, 0x02, 0x83, 0x09, 0x08, 0x23, 0x02,
+  0x23, 0x09, 0x23, 0x02, 0x02, 0x68, 0x23, 0x83, 0x03, 0x0C, 0x09, 0x03, 0x6A, 0x02, 0x03, 0x03,
+  0x5D, 0x31, 0x0B, 0x0B, 0x31, 0x0B, 0x21, 0x82, 0x0B, 0x0E, 0x40, 0x40, 0xC2, 0x40, 0x1C, 0x1C,
+  0x21, 0x02, 0x03, 0x5D, 0x29, 0x60, 0x04, 0x0D, 0x94, 0x82, 0x04, 0x08, 0xC9, 0x9B, 0xF2, 0xAA,
+  0xD8, 0x88, 0x70, 0xA0, 0x7F, 0x8C, 0x00, 0x00, 0xA3, 0x92, 0x00, 0x0B, 0x2C, 0x78, 0x36, 0x2D,
+  0x6B, 0x11, 0x38, 0x38, 0x06, 0x05, 0x0C, 0x15, 0x83, 0x07, 0x1B, 0x12, 0x12, 0xA7, 0x12, 0xA7,
+  0xA7, 0x12, 0x12, 0x15, 0x06, 0x1D, 0x10, 0x02, 0x02, 0x2A, 0x1D, 0x15, 0x43, 0x0F, 0x13, 0x21,
+  0x03, 0x02, 0x09, 0x09, 0x02, 0x03, 0x23, 0x82, 0x02, 0x10, 0x09, 0x23, 0x09, 0x23, 0x02, 0x02,
+  0x23, 0x02, 0x02, 0x23, 0x23, 0x09, 0x03, 0x09, 0x03, 0x09, 0x23, 0x84, 0x02, 0x82, 0x09, 0x17,
+  0x02, 0x02, 0x03, 0x23, 0x09, 0x23, 0x09, 0x09, 0x02, 0x23, 0x23, 0x03, 0x02, 0x02, 0x09, 0x23,
+  0x23, 0x03, 0x23, 0x03, 0x21, 0x03, 0x02, 0x02, 0x8A, 0x0B, 0x02, 0x1B, 0x40, 0x40, 0x82, 0x17,
+  0x0B, 0x40, 0x1B, 0x13, 0x03, 0x21, 0x1C, 0x17, 0x61, 0x04, 0x04, 0x92, 0x04, 0x82, 0x47, 0x07,
+  0xB7, 0xBE, 0xC9, 0x80, 0x78, 0x30, 0x52, 0x51, 0x8B, 0x00, 0x00, 0x75, 0x91, 0x00, 0x0B, 0x4B,
+  0x64, 0x35, 0x73, 0x3C, 0x11, 0x26, 0x0C, 0x26, 0x05, 0x05, 0x15, 0x82, 0x07, 0x82, 0x12, 0x04,
+  0x07, 0xA7, 0x12, 0x12, 0x07, 0x82, 0x12, 0x0D, 0x06, 0x2A, 0x10, 0x10, 0x03, 0x03, 0x6E, 0x1D,
+  0x16, 0x2C, 0x03, 0x03, 0x02, 0x02, 0x82, 0x09, 0x02, 0x02, 0x02, 0x09, 0x87, 0x02, 0x08, 0x09,
+  0x03, 0x23, 0x02, 0x02, 0x23, 0x09, 0x02, 0x02, 0x82, 0x09, 0x83, 0x02, 0x00, 0x23, 0x83, 0x09,
+  0x07, 0x03, 0x09, 0x09, 0x23, 0x02, 0x68, 0x23, 0x68, 0x82, 0x23, 0x0B, 0x09, 0x03, 0x09, 0x68,
+  0x21, 0x21, 0x03, 0x0B, 0x03, 0x03, 0x02, 0x31, 0x82, 0x0B, 0x06, 0x1B, 0x0B, 0x17, 0x1B, 0x40,
+  0x1B, 0x2F, 0x83, 0x1B, 0x00, 0xC2, 0x82, 0x17, 0x82, 0x0B, 0x11, 0x1B, 0x29, 0x1B, 0x60, 0x04,
+  0x92, 0x04, 0x04, 0x94, 0x47, 0x92, 0xAA, 0xB7, 0x80, 0x34, 0xA4, 0xB9, 0x4B, 0x8A, 0x00, 0x01,
+  0x9C, 0xE0, 0x91, 0x00, 0x0D, 0x66, 0x30, 0x39, 0x2D, 0x6B, 0x7B, 0x05, 0x0C, 0x26, 0x05, 0x06,
+  0x07, 0x12, 0x07, 0x82, 0x12, 0x1F, 0xA7, 0x12, 0x07, 0xA7, 0x12, 0x07, 0x12, 0x12, 0x06, 0x2B,
+  0x10, 0x21, 0x03, 0x1B, 0x1B, 0x03, 0x10, 0x2A, 0x10, 0x09, 0x21, 0x09, 0x09, 0x02, 0x65, 0x09,
+  0x02, 0x09, 0x21, 0x03, 0x03, 0x23, 0x84, 0x02, 0x04, 0x03, 0x03, 0x02, 0x02, 0x6A, 0x82, 0x02,
+  0x0B, 0x09, 0x09, 0x03, 0x09, 0x09, 0x23, 0x09, 0x02, 0x02, 0x09, 0x09, 0x03, 0x82, 0x09, 0x08,
+  0x03, 0x03, 0x09, 0x68, 0x23, 0x23, 0x02, 0x03, 0x09, 0x82, 0x21, 0x22, 0x31, 0x0B, 0x0B, 0x21,
+  0x31, 0x31, 0x0B, 0x03, 0x0B, 0x1B, 0x1B, 0xC2, 0x2F, 0x1B, 0x40, 0x17, 0xC2, 0x40, 0xC2, 0x40,
+  0x1C, 0x40, 0x1B, 0x1B, 0x29, 0x17, 0x17, 0x40, 0x29, 0x4F, 0x60, 0x04, 0x04, 0x19, 0x60, 0x82,
+  0x04, 0x82, 0x94, 0x06, 0xD8, 0xB7, 0x86, 0xB0, 0x30, 0x35, 0x66, 0x8A, 0x00, 0x01, 0x3A, 0x33,
+  0x90, 0x00, 0x05, 0x51, 0x2C, 0x70, 0x36, 0x3C, 0x11, 0x83, 0x26, 0x07, 0x0C, 0x15, 0x12, 0x07,
+  0x07, 0x12, 0x07, 0x12, 0x82, 0x07, 0x21, 0x0E, 0x07, 0x12, 0x07, 0x06, 0x48, 0x55, 0x68, 0x0B,
+  0x72, 0x2F, 0x1B, 0x21, 0x5D, 0x02, 0x09, 0x31, 0x0B, 0x09, 0x02, 0x23, 0x23, 0x09, 0x21, 0x03,
+  0x02, 0x02, 0x03, 0x03, 0x09, 0x03, 0x02, 0x6A, 0x6A, 0x82, 0x03, 0x83, 0x02, 0x01, 0x6A, 0x02,
+  0x88, 0x09, 0x07, 0x03, 0x09, 0x02, 0x09, 0x09, 0x03, 0x03, 0x09, 0x82, 0x03, 0x04, 0x5A, 0x03,
+  0x03, 0x21, 0x03, 0x88, 0x0B, 0x06, 0x1B, 0x1B, 0x97, 0x17, 0x2F, 0x17, 0xC2, 0x84, 0x17, 0x0B,
+  0x1B, 0x0B, 0x1B, 0x40, 0x40, 0x17, 0x29, 0x17, 0x17, 0x4F, 0x1B, 0x93, 0x83, 0x04, 0x0B, 0x7D,
+  0x83, 0x04, 0x04, 0x92, 0xC6, 0x9B, 0x86, 0xB6, 0x35, 0xA4, 0x1D, 0x8A, 0x00, 0x01, 0x3A, 0x33,
+  0x90, 0x00, 0x0A, 0x90, 0xAB, 0x34, 0x2D, 0x7B, 0x05, 0x26, 0x26, 0x0C, 0x38, 0x0C, 0x85, 0x07,
+  0x82, 0x15, 0x1C, 0x06, 0x0E, 0x12, 0x12, 0x07, 0x48, 0x13, 0x09, 0x03, 0x21, 0x40, 0x0B, 0x1B,
+  0x21, 0x17, 0x31, 0x09, 0x02, 0x03, 0x09, 0x03, 0x21, 0x03, 0x21, 0x03, 0x03, 0x21, 0x09, 0x23,
+  0x82, 0x02, 0x05, 0x6A, 0x6A, 0x02, 0x03, 0x09, 0x03, 0x82, 0x09, 0x06, 0x03, 0x02, 0x6A, 0x02,
+  0x03, 0x09, 0x09, 0x82, 0x03, 0x0F, 0x23, 0x23, 0x09, 0x03, 0x09, 0x03, 0x23, 0x09, 0x23, 0x03,
+  0x23, 0x23, 0x68, 0x03, 0x21, 0x21, 0x83, 0x0B, 0x00, 0x31, 0x83, 0x1B, 0x05, 0x76, 0x1B, 0x1B,
+  0x0B, 0x17, 0x1B, 0x88, 0x17, 0x00, 0x40, 0x82, 0x17, 0x17, 0x4F, 0x17, 0x17, 0x40, 0x1B, 0x40,
+  0x60, 0x47, 0x47, 0x04, 0x60, 0x61, 0x04, 0x04, 0x92, 0x9B, 0xC6, 0xAA, 0x8B, 0xA0, 0x2E, 0x30,
+  0x58, 0xB4, 0x89, 0x00, 0x01, 0x3A, 0x4C, 0x86, 0x00, 0x02, 0x3A, 0x33, 0xA3, 0x86, 0x00, 0x08,
+  0x66, 0x81, 0x42, 0xC7, 0x7B, 0x26, 0x26, 0x0C, 0x26, 0x82, 0x0C, 0x82, 0x07, 0x01, 0x15, 0x07,
+  0x82, 0x06, 0x83, 0x12, 0x1A, 0x0E, 0x1D, 0x03, 0x0B, 0x0B, 0x03, 0x76, 0x1B, 0x0B, 0x1B, 0x32,
+  0x1B, 0x21, 0x23, 0x03, 0x2A, 0x2A, 0x03, 0x03, 0x21, 0x10, 0x02, 0x23, 0x0B, 0x5A, 0x03, 0x2A,
+  0x82, 0x02, 0x00, 0x23, 0x83, 0x03, 0x0E, 0x5A, 0x03, 0x09, 0x09, 0x6A, 0x6A, 0x02, 0x03, 0x5A,
+  0x03, 0x09, 0x03, 0x03, 0x09, 0x02, 0x82, 0x09, 0x00, 0x03, 0x82, 0x09, 0x82, 0x03, 0x82, 0x0B,
+  0x02, 0x1B, 0x1B, 0x97, 0x83, 0x1B, 0x03, 0x97, 0x17, 0xC2, 0x1B, 0x83, 0x17, 0x03, 0x19, 0x4A,
+  0x4A, 0x19, 0x82, 0x17, 0x1D, 0x4A, 0x17, 0x4A, 0x17, 0x4F, 0x19, 0x4F, 0x4A, 0x19, 0x17, 0x29,
+  0x19, 0x19, 0x04, 0x1A, 0x04, 0x04, 0x83, 0x60, 0x92, 0x9B, 0x47, 0xC6, 0xC6, 0xB7, 0x86, 0x58,
+  0x34, 0xBD, 0x66, 0x89, 0x00, 0x01, 0x3A, 0x33, 0x86, 0x00, 0x03, 0x75, 0x01, 0x14, 0xAD, 0x85,
+  0x00, 0x05, 0x1D, 0x30, 0x36, 0x3B, 0x7E, 0x26, 0x82, 0x0C, 0x01, 0x15, 0x15, 0x82, 0x07, 0x2B,
+  0x0C, 0x06, 0x0C, 0x15, 0x0E, 0x07, 0x12, 0x12, 0x0E, 0x15, 0x1D, 0x13, 0x31, 0x0B, 0x31, 0x21,
+  0x17, 0x4A, 0x1B, 0x1B, 0x17, 0x1B, 0x21, 0x68, 0x10, 0x43, 0x1D, 0x0E, 0x10, 0x71, 0x55, 0x0E,
+  0x10, 0x23, 0x21, 0x3F, 0x2B, 0x10, 0x6A, 0x02, 0x02, 0x09, 0x03, 0x21, 0x82, 0x03, 0x21, 0x23,
+  0x09, 0x02, 0xA1, 0x02, 0x03, 0x03, 0x09, 0x10, 0x09, 0x23, 0x03, 0x03, 0x09, 0x03, 0x02, 0x23,
+  0x09, 0x09, 0x03, 0x09, 0x21, 0x21, 0x31, 0x0B, 0x31, 0x1B, 0x1B, 0x2F, 0x97, 0x1B, 0x2F, 0x72,
+  0x97, 0x83, 0x17, 0x03, 0x2F, 0x17, 0x32, 0x32, 0x82, 0x19, 0x21, 0x4A, 0x4F, 0x32, 0x19, 0x4A,
+  0x19, 0x4F, 0x19, 0x19, 0x93, 0x4F, 0x45, 0x45, 0x0B, 0x29, 0x93, 0x60, 0x9D, 0x9D, 0x60, 0x04,
+  0x94, 0x94, 0x47, 0x9B, 0x47, 0xC6, 0xC9, 0xA0, 0xAF, 0x2E, 0xA4, 0x2C, 0x51, 0x88, 0x00, 0x01,
+  0x3A, 0x4C, 0x86, 0x00, 0x00, 0x8E, 0x82, 0x01, 0x01, 0x8E, 0xB2, 0x82, 0x00, 0x06, 0x4B, 0x64,
+  0x30, 0x74, 0x7B, 0x26, 0x26, 0x83, 0x0C, 0x00, 0x15, 0x83, 0x07, 0x01, 0x0C, 0x06, 0x82, 0x15,
+  0x0F, 0x0E, 0x07, 0x12, 0x07, 0x1D, 0x13, 0x13, 0x21, 0x0B, 0x0B, 0x4A, 0x4A, 0x21, 0x5D, 0x0B,
+  0x2A, 0x82, 0x52, 0x84, 0x0E, 0x0B, 0x06, 0x0F, 0x2A, 0x02, 0x03, 0x2A, 0x16, 0x95, 0x02, 0x6A,
+  0x02, 0x09, 0x83, 0x03, 0x02, 0x09, 0x6A, 0x09, 0x82, 0x02, 0x19, 0x03, 0x09, 0x03, 0x09, 0x21,
+  0x23, 0x09, 0x03, 0x23, 0x03, 0x03, 0x5A, 0x03, 0x03, 0x21, 0x03, 0x21, 0x31, 0x0B, 0x1B, 0x0B,
+  0x1B, 0x17, 0x17, 0x4A, 0x2F, 0x82, 0x17, 0x0C, 0x4A, 0x17, 0x17, 0x32, 0x17, 0x32, 0x19, 0x19,
+  0x18, 0x04, 0x19, 0x19, 0x4A, 0x83, 0x19, 0x1B, 0x32, 0x19, 0x60, 0x04, 0x04, 0x19, 0x72, 0x1B,
+  0x93, 0x04, 0x4F, 0x93, 0x4F, 0x19, 0x04, 0xB7, 0x47, 0x94, 0x9B, 0x47, 0xAA, 0xC6, 0x86, 0xA2,
+  0xB0, 0x30, 0xB9, 0x4B, 0x88, 0x00, 0x01, 0x3A, 0x33, 0x86, 0x00, 0x00, 0x4C, 0x83, 0x01, 0x00,
+  0x75, 0x82, 0x00, 0x05, 0x7F, 0x8B, 0x2E, 0x7A, 0x7B, 0x26, 0x83, 0x0C, 0x02, 0x15, 0x0C, 0x07,
+  0x82, 0x15, 0x12, 0x07, 0x15, 0x15, 0x07, 0x07, 0x12, 0x07, 0x07, 0x0E, 0x1D, 0x48, 0x0B, 0x76,
+  0x0B, 0x21, 0x1B, 0x4A, 0x1B, 0x3F, 0x82, 0x1D, 0x82, 0x06, 0x82, 0x0E, 0x1D, 0x06, 0x55, 0x1D,
+  0x6E, 0x09, 0x23, 0x0B, 0x16, 0x2C, 0x09, 0x02, 0x6A, 0x23, 0x23, 0x21, 0x09, 0x03, 0x6A, 0x02,
+  0x09, 0x09, 0x02, 0x02, 0x09, 0x21, 0x09, 0x09, 0x03, 0x21, 0x21, 0x83, 0x03, 0x07, 0x68, 0x03,
+  0x03, 0x09, 0x03, 0x5A, 0x21, 0x0B, 0x82, 0x1B, 0x07, 0x17, 0x17, 0x4A, 0x4A, 0x32, 0x4A, 0x32,
+  0x32, 0x85, 0x19, 0x82, 0x04, 0x01, 0x18, 0x1E, 0x82, 0x19, 0x00, 0x1E, 0x82, 0x19, 0x04, 0x93,
+  0x04, 0x04, 0x19, 0x1B, 0x83, 0x29, 0x14, 0x17, 0x4F, 0x04, 0x04, 0x94, 0x94, 0x47, 0xB7, 0x04,
+  0x92, 0x94, 0x86, 0xAB, 0x58, 0x35, 0xD5, 0xDD, 0x00, 0x75, 0x8E, 0x9C, 0x84, 0x00, 0x01, 0x3A,
+  0x4C, 0x86, 0x00, 0x84, 0x01, 0x00, 0x33, 0x82, 0x00, 0x13, 0xC3, 0x30, 0x42, 0x3C, 0x7E, 0x26,
+  0x0C, 0x0C, 0x15, 0x15, 0x0C, 0x15, 0x15, 0x0C, 0x07, 0x07, 0x15, 0x15, 0x07, 0x15, 0x83, 0x07,
+  0x26, 0x06, 0x0F, 0x16, 0x1C, 0x29, 0x17, 0x2F, 0x0B, 0x17, 0x1B, 0x48, 0x0F, 0x0F, 0x1D, 0x0F,
+  0x0E, 0x0E, 0x06, 0x0E, 0x0E, 0x06, 0x55, 0x0F, 0x2A, 0x03, 0x09, 0x13, 0x16, 0x0F, 0x03, 0x03,
+  0x02, 0x6A, 0x02, 0x03, 0x03, 0x02, 0x02, 0x6A, 0x83, 0x02, 0x1D, 0x31, 0x31, 0x03, 0x03, 0x2A,
+  0x68, 0x5D, 0x03, 0x21, 0x03, 0x13, 0x2A, 0x1C, 0x03, 0x03, 0x21, 0x21, 0x5D, 0x1B, 0x76, 0x1B,
+  0x97, 0x1B, 0x17, 0x17, 0x32, 0x1E, 0x19, 0x19, 0x1E, 0x82, 0x19, 0x0A, 0x1E, 0x1E, 0x19, 0x04,
+  0x04, 0x18, 0x18, 0x04, 0x04, 0x1E, 0x04, 0x82, 0x1E, 0x1E, 0x60, 0x19, 0x32, 0x19, 0x4F, 0x1B,
+  0x19, 0x17, 0x72, 0x1B, 0x45, 0x19, 0x94, 0x9B, 0x9B, 0x47, 0x9B, 0x94, 0x83, 0xBB, 0x61, 0x92,
+  0xAB, 0x64, 0x80, 0xAA, 0x67, 0x14, 0x01, 0x01, 0xAD, 0x84, 0x00, 0x01, 0x3A, 0x33, 0x85, 0x00,
+  0x00, 0x9C, 0x84, 0x01, 0x12, 0x4C, 0xB2, 0x00, 0x51, 0x2C, 0x34, 0x6D, 0x3B, 0x11, 0x26, 0x0C,
+  0x26, 0x0C, 0x07, 0x0C, 0x0C, 0x07, 0x15, 0x15, 0x82, 0x07, 0x01, 0x15, 0x15, 0x82, 0x07, 0x0F,
+  0x15, 0x06, 0x0F, 0x16, 0x10, 0x13, 0x1C, 0x1C, 0x17, 0x17, 0x2B, 0xC1, 0x1D, 0x0F, 0x2C, 0x2C,
+  0x83, 0x0E, 0x01, 0x06, 0x2C, 0x82, 0x1D, 0x1F, 0x13, 0x23, 0x21, 0x2B, 0x16, 0x2C, 0x02, 0x03,
+  0x6A, 0x02, 0x09, 0x09, 0x02, 0x21, 0x09, 0x09, 0x03, 0x09, 0x21, 0x5A, 0x31, 0x03, 0x2B, 0x16,
+  0x48, 0x13, 0x0B, 0x03, 0x48, 0x16, 0x16, 0x3F, 0x82, 0x03, 0x83, 0x0B, 0x09, 0x1B, 0x2F, 0x17,
+  0x1B, 0x17, 0x17, 0x46, 0x1C, 0x29, 0x04, 0x84, 0x18, 0x25, 0xDB, 0x17, 0x04, 0x0D, 0x04, 0x0D,
+  0x04, 0x04, 0x18, 0x18, 0x04, 0x19, 0x19, 0x1E, 0x19, 0x19, 0x17, 0x4F, 0x19, 0x1B, 0x0B, 0x17,
+  0x4F, 0x04, 0x9D, 0x47, 0xD8, 0x47, 0x47, 0xC9, 0x04, 0x4F, 0x82, 0x96, 0x7D, 0xB9, 0xB0, 0x5F,
+  0x83, 0x01, 0x00, 0x33, 0x84, 0x00, 0x01, 0x3A, 0x4C, 0x85, 0x00, 0x00, 0xAC, 0x84, 0x01, 0x09,
+  0x14, 0xA3, 0x00, 0x4B, 0x41, 0x88, 0x20, 0x3E, 0x72, 0x2C, 0x82, 0x0C, 0x01, 0x15, 0x07, 0x84,
+  0x0C, 0x0F, 0x06, 0x0C, 0x0C, 0x06, 0x06, 0x15, 0x06, 0x1D, 0x84, 0x08, 0x1C, 0x2A, 0x0F, 0x1D,
+  0x2A, 0x2C, 0x82, 0x0E, 0x3E, 0x1D, 0x0E, 0x0E, 0x06, 0x0E, 0x0E, 0x06, 0x43, 0x2A, 0x10, 0x52,
+  0x0E, 0x1D, 0x2A, 0x03, 0x09, 0x2A, 0x16, 0x16, 0x55, 0x03, 0x23, 0x02, 0x02, 0x09, 0x23, 0x03,
+  0x21, 0x03, 0x21, 0x09, 0x21, 0x0B, 0x03, 0x2A, 0x08, 0x08, 0x16, 0x2A, 0x0B, 0x21, 0x2A, 0x48,
+  0x2A, 0x03, 0x09, 0x09, 0x03, 0x03, 0x31, 0x0B, 0x0B, 0x1B, 0x97, 0x2F, 0x0B, 0x03, 0x48, 0x08,
+  0x08, 0x46, 0x19, 0x04, 0x82, 0x18, 0x85, 0x04, 0x00, 0x18, 0x82, 0x04, 0x01, 0x1E, 0x1E, 0x82,
+  0x19, 0x08, 0x4A, 0x17, 0x40, 0x0B, 0x40, 0x40, 0x93, 0x04, 0x04, 0x82, 0x47, 0x0A, 0xAA, 0x77,
+  0x9B, 0x47, 0x92, 0x04, 0x7D, 0x61, 0x61, 0x41, 0x9D, 0x85, 0x01, 0x00, 0x9C, 0x83, 0x00, 0x01,
+  0x3A, 0x33, 0x85, 0x00, 0x00, 0x75, 0x85, 0x01, 0x04, 0x3A, 0x00, 0x50, 0x58, 0x2E, 0x82, 0x01,
+  0x04, 0x14, 0x3E, 0x21, 0x0E, 0x15, 0x82, 0x0C, 0x02, 0x06, 0x06, 0x0C, 0x84, 0x06, 0x00, 0x43,
+  0x82, 0x16, 0x05, 0x1C, 0x0B, 0x2A, 0x49, 0x0F, 0x1D, 0x83, 0x0E, 0x00, 0x06, 0x84, 0x0E, 0x36,
+  0x06, 0x1D, 0x13, 0x10, 0x0E, 0x0E, 0x71, 0x0E, 0x2A, 0x03, 0x03, 0x2A, 0x16, 0x1D, 0x2C, 0x09,
+  0x23, 0x09, 0x09, 0x02, 0x09, 0x03, 0x21, 0x5A, 0x09, 0x09, 0x03, 0x2B, 0x16, 0x16, 0x0F, 0x1D,
+  0x1D, 0x03, 0x10, 0x2C, 0x2C, 0x03, 0x09, 0x03, 0x03, 0x09, 0x03, 0x5A, 0x0B, 0x31, 0x1B, 0x2F,
+  0x0B, 0x03, 0x2B, 0x08, 0x08, 0x46, 0x93, 0x85, 0x04, 0x02, 0x47, 0xD7, 0x47, 0x83, 0x04, 0x1D,
+  0x1E, 0x19, 0x18, 0x04, 0x19, 0x19, 0x32, 0x17, 0x40, 0x29, 0x13, 0x0B, 0x04, 0x83, 0x04, 0x04,
+  0x47, 0x47, 0xAE, 0xC6, 0x47, 0xF5, 0xAA, 0x9B, 0x9B, 0x04, 0x61, 0x45, 0x41, 0xDB, 0x85, 0x01,
+  0x00, 0x75, 0x83, 0x00, 0x01, 0x3A, 0x4C, 0x85, 0x00, 0x00, 0x8E, 0x85, 0x01, 0x04, 0xAD, 0x00,
+  0x9A, 0xB0, 0x42, 0x85, 0x01, 0x05, 0x14, 0x3E, 0x9E, 0x13, 0x06, 0x43, 0x82, 0x06, 0x12, 0x05,
+  0x43, 0x0F, 0x0F, 0x16, 0x40, 0x40, 0x0B, 0x0B, 0x1B, 0x29, 0x19, 0x2B, 0xC1, 0x1D, 0x48, 0x48,
+  0x1D, 0x0E, 0x84, 0x06, 0x0E, 0x0E, 0x1D, 0x6E, 0x71, 0x0E, 0x07, 0x07, 0x0E, 0x2C, 0x13, 0x21,
+  0x0B, 0x1D, 0x1D, 0x16, 0x82, 0x03, 0x08, 0x09, 0x02, 0x23, 0x02, 0x02, 0x23, 0x03, 0x03, 0x13,
+  0x82, 0x1D, 0x17, 0x06, 0x06, 0x55, 0x71, 0x0E, 0x06, 0x1D, 0x0E, 0x10, 0x02, 0x02, 0x23, 0x09,
+  0x03, 0x21, 0x0B, 0x1B, 0x1B, 0x1C, 0x16, 0x08, 0x16, 0x87, 0x9D, 0x84, 0x04, 0x26, 0x0D, 0x04,
+  0xD7, 0x04, 0x47, 0x1A, 0x1A, 0x0D, 0x04, 0x18, 0x1E, 0x19, 0x19, 0x4A, 0x17, 0x17, 0x29, 0x1B,
+  0x29, 0x0B, 0x60, 0x60, 0x04, 0x04, 0x47, 0xAE, 0x77, 0x1F, 0x9B, 0x9B, 0xAA, 0x77, 0x9B, 0x94,
+  0x04, 0x82, 0x79, 0x46, 0x18, 0x85, 0x01, 0x00, 0xE0, 0x83, 0x00, 0x01, 0x3A, 0x33, 0x85, 0x00,
+  0x03, 0x33, 0x01, 0x01, 0x4C, 0x82, 0x01, 0x05, 0x75, 0x00, 0x71, 0x34, 0xCC, 0x4E, 0x88, 0x01,
+  0x18, 0x14, 0x3E, 0x76, 0x2C, 0x2C, 0x0F, 0x0F, 0x05, 0x87, 0x19, 0x1E, 0x4A, 0x2F, 0x97, 0x2F,
+  0x18, 0x04, 0x4F, 0x29, 0x29, 0x17, 0x29, 0x0B, 0x2A, 0x03, 0x82, 0x0E, 0x03, 0x06, 0x0E, 0x43,
+  0x2C, 0x82, 0x0E, 0x2E, 0x07, 0x0E, 0x0E, 0x6E, 0x03, 0x5D, 0x13, 0x0F, 0x16, 0x13, 0x09, 0x09,
+  0x31, 0x09, 0x6A, 0x5A, 0x03, 0x09, 0x03, 0x03, 0x1D, 0x0E, 0x06, 0x0E, 0x06, 0x06, 0x0E, 0x06,
+  0x52, 0x0E, 0x06, 0x0E, 0x52, 0xBC, 0xA1, 0x6A, 0x09, 0x09, 0x03, 0x0B, 0x31, 0x1B, 0x0B, 0x16,
+  0x08, 0x08, 0xA2, 0x82, 0x04, 0x29, 0x18, 0x1A, 0x04, 0x1A, 0x47, 0x04, 0x04, 0x1A, 0x47, 0x1A,
+  0x04, 0x18, 0x18, 0x04, 0x1E, 0x19, 0x32, 0x17, 0x17, 0x0B, 0x29, 0x17, 0x29, 0x19, 0x9D, 0x04,
+  0x0D, 0x1A, 0x5F, 0x57, 0x53, 0x1A, 0x04, 0x47, 0x47, 0x94, 0x94, 0x83, 0x61, 0x79, 0x46, 0x99,
+  0x85, 0x01, 0x01, 0x4C, 0x9C, 0x82, 0x00, 0x01, 0x3A, 0x4C, 0x84, 0x00, 0x0C, 0xB2, 0x33, 0x01,
+  0x01, 0xF1, 0x14, 0x01, 0x01, 0x8E, 0x51, 0x16, 0x34, 0x36, 0x8D, 0x01, 0x05, 0x20, 0x3E, 0x1B,
+  0x22, 0x45, 0x1E, 0x82, 0x17, 0x25, 0x19, 0x0D, 0x04, 0x24, 0x04, 0x1E, 0x2F, 0x4A, 0x1E, 0x19,
+  0x4A, 0x0B, 0x13, 0x55, 0x55, 0x0E, 0x43, 0x1D, 0x16, 0x0F, 0x1D, 0x0E, 0x0E, 0x07, 0x07, 0x2C,
+  0x03, 0x2C, 0x2A, 0x1D, 0x2C, 0x31, 0x09, 0x5A, 0x21, 0x09, 0x23, 0xA1, 0x82, 0x03, 0x07, 0x10,
+  0x1D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x52, 0x82, 0x06, 0x1D, 0x52, 0x43, 0x0E, 0x52, 0x10, 0x02,
+  0x03, 0x21, 0x09, 0x21, 0x21, 0x31, 0x21, 0x49, 0x08, 0x08, 0x16, 0x60, 0x0D, 0x1A, 0x0D, 0x04,
+  0x0D, 0x77, 0x77, 0x18, 0x19, 0x04, 0x1A, 0x0D, 0x82, 0x04, 0x0C, 0x18, 0x19, 0x32, 0x17, 0x17,
+  0x1B, 0x0B, 0x1B, 0x19, 0x19, 0x04, 0x04, 0x24, 0x84, 0x01, 0x01, 0x18, 0x94, 0x83, 0x04, 0x04,
+  0xC5, 0x82, 0x45, 0x79, 0x99, 0x85, 0x01, 0x01, 0x14, 0x3A, 0x82, 0x00, 0x01, 0x3A, 0x33, 0x84,
+  0x00, 0x0D, 0x9C, 0x14, 0x01, 0x01, 0x75, 0x4C, 0x01, 0x01, 0x33, 0x8C, 0xA2, 0x2E, 0x8D, 0x20,
+  0x8E, 0x01, 0x1C, 0x3E, 0x82, 0x19, 0x19, 0x1E, 0x59, 0x59, 0x1E, 0x18, 0x0D, 0x24, 0x0D, 0x0D,
+  0x24, 0x18, 0x0D, 0x0D, 0x04, 0x04, 0x4A, 0x40, 0x03, 0x03, 0x48, 0x48, 0x16, 0x16, 0x1D, 0x1D,
+  0x82, 0x0E, 0x3D, 0x1D, 0x10, 0x52, 0x2C, 0x48, 0x1D, 0x21, 0x09, 0x5D, 0x21, 0x03, 0x03, 0x13,
+  0x03, 0x21, 0x0B, 0x13, 0x1D, 0x2C, 0x1D, 0x2C, 0x0E, 0x52, 0x2C, 0x2C, 0x1D, 0x43, 0x43, 0x06,
+  0x06, 0x43, 0x1D, 0x10, 0x02, 0x21, 0x03, 0x09, 0x23, 0x09, 0x21, 0x49, 0x16, 0x08, 0x08, 0x41,
+  0x96, 0x0D, 0x04, 0x04, 0x1A, 0x0D, 0x04, 0x04, 0x32, 0x1A, 0x1A, 0x0D, 0x0D, 0x04, 0x04, 0x1E,
+  0x32, 0x84, 0x17, 0x05, 0x40, 0x17, 0x19, 0x04, 0x04, 0x57, 0x84, 0x01, 0x0A, 0x18, 0x04, 0x92,
+  0x04, 0x04, 0x61, 0x4F, 0x4F, 0x46, 0x46, 0x99, 0x86, 0x01, 0x00, 0x75, 0x82, 0x00, 0x01, 0x3A,
+  0x33, 0x84, 0x00, 0x00, 0xA3, 0x82, 0x01, 0x09, 0xAC, 0x33, 0x01, 0x01, 0x14, 0xD3, 0x58, 0x2E,
+  0x2D, 0xDF, 0x8E, 0x01, 0x04, 0x14, 0x04, 0xBF, 0x1E, 0x20, 0x83, 0x01, 0x2B, 0x20, 0x24, 0x24,
+  0x0D, 0x18, 0x24, 0x24, 0x04, 0x18, 0x0D, 0x18, 0x4A, 0x17, 0x1C, 0x5D, 0x0B, 0x3F, 0x0F, 0x16,
+  0x2A, 0x13, 0x03, 0x2C, 0x55, 0x10, 0x71, 0x0E, 0x1D, 0x2C, 0x10, 0x09, 0x21, 0x13, 0x10, 0x52,
+  0x1D, 0x2C, 0x03, 0x03, 0x13, 0x55, 0x10, 0x55, 0x55, 0x84, 0x10, 0x01, 0x1D, 0x1D, 0x82, 0x43,
+  0x28, 0x05, 0x2C, 0x03, 0x02, 0x02, 0x23, 0x23, 0x09, 0x21, 0x0B, 0x16, 0x08, 0x16, 0x08, 0x16,
+  0x9D, 0x04, 0x1A, 0x0D, 0x47, 0x93, 0x1A, 0x18, 0xC4, 0x18, 0x4D, 0x53, 0x4D, 0x99, 0x19, 0x1B,
+  0x17, 0x17, 0x32, 0x17, 0x17, 0x40, 0x19, 0x1E, 0x04, 0x18, 0x85, 0x01, 0x0A, 0x20, 0x04, 0x83,
+  0x04, 0x04, 0x60, 0x61, 0x45, 0x46, 0x79, 0x99, 0x82, 0x01, 0x00, 0x14, 0x82, 0x01, 0x00, 0x33,
+  0x82, 0x00, 0x01, 0x3A, 0x33, 0x84, 0x00, 0x00, 0x3A, 0x82, 0x01, 0x0C, 0x3A, 0x75, 0x01, 0x01,
+  0x14, 0xD3, 0x86, 0x6F, 0x7A, 0x6B, 0x49, 0x3E, 0x20, 0x8B, 0x01, 0x04, 0x14, 0x04, 0x04, 0x24,
+  0x53, 0x84, 0x01, 0x26, 0x4C, 0x24, 0x0D, 0x0D, 0x24, 0x0D, 0x0D, 0x1A, 0x0D, 0x18, 0x32, 0x18,
+  0x1E, 0x32, 0x17, 0x1C, 0x16, 0x48, 0x0F, 0x0B, 0x13, 0x55, 0x55, 0x0E, 0x06, 0x0E, 0x07, 0x06,
+  0x03, 0x23, 0x0B, 0x10, 0x1D, 0xC1, 0x1D, 0x48, 0x10, 0x10, 0x13, 0x82, 0x10, 0x0F, 0x02, 0x23,
+  0x09, 0x03, 0x09, 0x03, 0x10, 0x52, 0x2C, 0x2C, 0x43, 0x1D, 0x2C, 0x02, 0x23, 0x23, 0x82, 0x09,
+  0x0E, 0x21, 0x03, 0x3F, 0x16, 0x16, 0x08, 0x16, 0x79, 0x1C, 0x04, 0x04, 0x1A, 0x9D, 0x1A, 0x9F,
+  0x85, 0x01, 0x0B, 0x20, 0x2F, 0x17, 0x32, 0x19, 0x17, 0x4F, 0x19, 0x19, 0x9D, 0xDB, 0x18, 0x85,
+  0x01, 0x00, 0x20, 0x83, 0x04, 0x09, 0x60, 0x4F, 0x45, 0x45, 0x79, 0x2F, 0x01, 0x01, 0x14, 0x14,
+  0x82, 0x01, 0x05, 0x14, 0x9C, 0x00, 0x00, 0x3A, 0x4C, 0x84, 0x00, 0x05, 0xAC, 0x01, 0x01, 0x14,
+  0x00, 0xAC, 0x82, 0x01, 0x09, 0xF3, 0x8B, 0x39, 0x3C, 0x3B, 0x11, 0x11, 0x0F, 0x0B, 0x3E, 0x89,
+  0x01, 0x03, 0x14, 0x0D, 0x0D, 0x24, 0x86, 0x01, 0x04, 0x4D, 0x54, 0x0D, 0x54, 0x54, 0x82, 0x0A,
+  0x37, 0x77, 0x1A, 0x0D, 0x18, 0x04, 0x24, 0x3E, 0x3E, 0x2F, 0x0B, 0x40, 0x2A, 0x95, 0x0E, 0x0E,
+  0x07, 0x07, 0x12, 0x71, 0x0E, 0x10, 0x68, 0x10, 0x0E, 0x0F, 0x49, 0x03, 0x5A, 0x76, 0x09, 0x21,
+  0x21, 0x0B, 0x72, 0x31, 0x97, 0x17, 0x31, 0x0B, 0x21, 0x02, 0x10, 0xBC, 0x10, 0xBC, 0x10, 0x5A,
+  0x9E, 0x33, 0x33, 0x3E, 0x67, 0x31, 0x5A, 0x21, 0x49, 0x82, 0x08, 0x06, 0x16, 0x3F, 0x61, 0x04,
+  0x1A, 0x04, 0x5F, 0x88, 0x01, 0x04, 0x2F, 0x17, 0x72, 0x29, 0x60, 0x82, 0x04, 0x01, 0x19, 0x24,
+  0x85, 0x01, 0x00, 0x14, 0x82, 0x04, 0x0A, 0x60, 0x61, 0xBB, 0x45, 0x87, 0x87, 0x59, 0x4E, 0x01,
+  0x01, 0x33, 0x83, 0x01, 0x04, 0xAD, 0x00, 0x00, 0x3A, 0x33, 0x84, 0x00, 0x05, 0x75, 0x01, 0x01,
+  0x33, 0x00, 0x9C, 0x82, 0x01, 0x04, 0x9E, 0xBD, 0x36, 0x3C, 0xCE, 0x82, 0x11, 0x02, 0x05, 0x1D,
+  0x20, 0x88, 0x01, 0x03, 0x14, 0x0A, 0x1F, 0x9F, 0x86, 0x01, 0x0C, 0x4C, 0x85, 0x0D, 0x54, 0x0D,
+  0x0D, 0x0A, 0x0A, 0x44, 0x1F, 0x1A, 0x0D, 0x24, 0x85, 0x01, 0x02, 0x76, 0x95, 0x07, 0x83, 0x12,
+  0x06, 0x95, 0x6E, 0x10, 0x03, 0x13, 0x67, 0x3E, 0x83, 0x01, 0x08, 0x14, 0x33, 0x67, 0x4A, 0x19,
+  0x4A, 0x2F, 0x17, 0x97, 0x82, 0x1B, 0x05, 0x03, 0x0B, 0x1B, 0x1B, 0x67, 0x20, 0x84, 0x01, 0x0C,
+  0x14, 0x67, 0x0B, 0x17, 0x16, 0x08, 0x08, 0x61, 0x04, 0x04, 0x1A, 0x04, 0x4D, 0x89, 0x01, 0x09,
+  0x3E, 0x17, 0x17, 0x40, 0x4F, 0x19, 0x4F, 0x04, 0x19, 0x20, 0x86, 0x01, 0x00, 0x18, 0x82, 0x04,
+  0x09, 0x61, 0x4F, 0x45, 0x82, 0x79, 0x99, 0x01, 0x01, 0x14, 0xE2, 0x83, 0x01, 0x04, 0x8E, 0x00,
+  0x00, 0x3A, 0x4C, 0x84, 0x00, 0x05, 0x8E, 0x01, 0x01, 0x8E, 0x00, 0x00, 0x82, 0x01, 0x0A, 0x3E,
+  0xBE, 0x36, 0x3C, 0x6B, 0x11, 0xCF, 0x05, 0x05, 0x1D, 0x20, 0x82, 0x01, 0x0A, 0x20, 0x24, 0x20,
+  0x53, 0x01, 0x01, 0x20, 0x0A, 0x1F, 0x3D, 0x53, 0x85, 0x01, 0x00, 0x14, 0x83, 0x54, 0x07, 0x0A,
+  0x0A, 0x1F, 0x44, 0x1F, 0x1A, 0x1A, 0x5F, 0x85, 0x01, 0x00, 0x3E, 0x83, 0x12, 0x06, 0x95, 0x07,
+  0x12, 0x52, 0x03, 0x21, 0xE1, 0x88, 0x01, 0x00, 0x3E, 0x82, 0x32, 0x02, 0x4A, 0x32, 0x1B, 0x82,
+  0x17, 0x02, 0x1B, 0x2F, 0x59, 0x88, 0x01, 0x0B, 0x97, 0x29, 0x16, 0x08, 0x08, 0x41, 0x83, 0x04,
+  0x04, 0x9F, 0x01, 0x4E, 0x88, 0x01, 0x09, 0x4C, 0x32, 0x17, 0x17, 0x4F, 0x1E, 0x04, 0x9D, 0x19,
+  0x53, 0x86, 0x01, 0x0D, 0x99, 0x92, 0x04, 0x04, 0x45, 0x45, 0xBB, 0x82, 0x2B, 0x59, 0x01, 0x01,
+  0x14, 0xEA, 0x83, 0x01, 0x04, 0x33, 0x00, 0x00, 0x3A, 0x33, 0x84, 0x00, 0x0D, 0x4C, 0x01, 0x01,
+  0x75, 0x00, 0x00, 0x4C, 0x01, 0x01, 0x20, 0xBE, 0x2D, 0x3C, 0x7B, 0x82, 0x11, 0x02, 0x05, 0xE5,
+  0x20, 0x82, 0x01, 0x09, 0x20, 0x1F, 0x1F, 0x0A, 0x0A, 0x3D, 0x3D, 0x0A, 0x1A, 0x0A, 0x82, 0x01,
+  0x00, 0x14, 0x83, 0x01, 0x03, 0x24, 0x54, 0x0A, 0x54, 0x82, 0x0A, 0x04, 0x1F, 0x1F, 0x0A, 0x0A,
+  0x53, 0x85, 0x01, 0x01, 0x33, 0x52, 0x83, 0x12, 0x04, 0x0E, 0x12, 0x9A, 0x55, 0x14, 0x8A, 0x01,
+  0x02, 0x4C, 0x1E, 0x04, 0x83, 0x32, 0x03, 0x1E, 0x32, 0x4A, 0x2F, 0x89, 0x01, 0x08, 0x4C, 0x49,
+  0x16, 0x16, 0x08, 0x08, 0x61, 0x04, 0x1A, 0x8B, 0x01, 0x02, 0x14, 0x19, 0x32, 0x82, 0x19, 0x03,
+  0x60, 0x19, 0x04, 0x53, 0x86, 0x01, 0x00, 0x20, 0x82, 0x04, 0x05, 0x93, 0x82, 0x61, 0x79, 0x2B,
+  0x59, 0x82, 0x01, 0x01, 0xA1, 0x33, 0x82, 0x01, 0x04, 0x14, 0x9C, 0x00, 0x3A, 0x4C, 0x84, 0x00,
+  0x82, 0x01, 0x10, 0x3A, 0x00, 0x00, 0x33, 0x01, 0x01, 0x53, 0xC9, 0x74, 0x3B, 0x6B, 0x7B, 0x05,
+  0x11, 0x05, 0x1D, 0x20, 0x82, 0x01, 0x04, 0x4D, 0xAE, 0x1F, 0x1F, 0x44, 0x82, 0x1F, 0x01, 0x1A,
+  0x24, 0x82, 0x01, 0x01, 0x14, 0x57, 0x82, 0x01, 0x00, 0x4D, 0x89, 0x0A, 0x00, 0x4E, 0x85, 0x01,
+  0x09, 0x4C, 0x0E, 0x0E, 0x07, 0x07, 0x0E, 0x15, 0x0E, 0x9A, 0x3E, 0x8C, 0x01, 0x09, 0x3E, 0x04,
+  0x32, 0x32, 0x17, 0x32, 0x18, 0x19, 0x32, 0x20, 0x89, 0x01, 0x08, 0x4C, 0x16, 0x16, 0x08, 0x16,
+  0x08, 0x16, 0x04, 0x5F, 0x8B, 0x01, 0x08, 0x14, 0x18, 0xDB, 0x1E, 0x19, 0x19, 0x4F, 0x17, 0x32,
+  0x82, 0x01, 0x00, 0x20, 0x83, 0x01, 0x00, 0x20, 0x82, 0x04, 0x05, 0x82, 0x1C, 0x1C, 0x2A, 0x2B,
+  0x59, 0x82, 0x01, 0x01, 0x02, 0x75, 0x83, 0x01, 0x03, 0xAC, 0x00, 0x3A, 0x33, 0x84, 0x00, 0x06,
+  0x01, 0x01, 0x14, 0xA3, 0x00, 0x00, 0x8E, 0x82, 0x01, 0x09, 0xD7, 0x36, 0x3B, 0x11, 0x11, 0x22,
+  0x05, 0x05, 0x2B, 0x20, 0x82, 0x01, 0x01, 0x4D, 0x77, 0x83, 0x1F, 0x04, 0x0A, 0x1F, 0x77, 0x24,
+  0x53, 0x82, 0x01, 0x00, 0x57, 0x82, 0x01, 0x01, 0x20, 0x54, 0x87, 0x0A, 0x00, 0x3D, 0x82, 0x01,
+  0x00, 0x14, 0x82, 0x01, 0x08, 0x14, 0x0E, 0xEB, 0x0E, 0x12, 0x0E, 0x0E, 0x07, 0x5A, 0x8D, 0x01,
+  0x08, 0x14, 0x18, 0x17, 0x1B, 0x31, 0x76, 0x4A, 0x32, 0x2F, 0x8A, 0x01, 0x01, 0x4C, 0x2B, 0x83,
+  0x08, 0x02, 0x41, 0x04, 0x4E, 0x85, 0x01, 0x02, 0x14, 0x20, 0x14, 0x82, 0x01, 0x08, 0x14, 0x04,
+  0x18, 0x19, 0x93, 0x17, 0x17, 0x0B, 0x59, 0x82, 0x01, 0x00, 0x3E, 0x83, 0x01, 0x09, 0x14, 0x04,
+  0x04, 0x60, 0x4F, 0x1C, 0x6E, 0x6E, 0x2B, 0x59, 0x82, 0x01, 0x01, 0x02, 0x3A, 0x83, 0x01, 0x03,
+  0x8E, 0x00, 0x3A, 0x33, 0x83, 0x00, 0x07, 0xA3, 0x01, 0x01, 0x4C, 0x9C, 0x00, 0x00, 0x75, 0x82,
+  0x01, 0x09, 0xD7, 0x36, 0x3B, 0x7B, 0x11, 0x11, 0x05, 0x05, 0x0F, 0x20, 0x82, 0x01, 0x01, 0x20,
+  0x0A, 0x82, 0x1F, 0x09, 0xC6, 0x1F, 0x1A, 0x0D, 0x24, 0x4E, 0x01, 0x01, 0x14, 0x4D, 0x82, 0x01,
+  0x02, 0x20, 0x0D, 0x54, 0x83, 0x0A, 0x03, 0x3D, 0x54, 0x0A, 0x5F, 0x82, 0x01, 0x00, 0x14, 0x82,
+  0x01, 0x08, 0x4C, 0x06, 0x0E, 0x0E, 0x07, 0x07, 0x0E, 0x52, 0x14, 0x8E, 0x01, 0x01, 0x3E, 0x1B,
+  0x82, 0x0B, 0x02, 0x2F, 0x4A, 0x20, 0x8A, 0x01, 0x07, 0x4C, 0x13, 0x2B, 0x16, 0x08, 0x08, 0x16,
+  0x4D, 0x84, 0x01, 0x0C, 0x14, 0x59, 0x18, 0x04, 0x04, 0x59, 0x20, 0x01, 0x14, 0x04, 0x04, 0x19,
+  0x17, 0x82, 0x0B, 0x00, 0x67, 0x82, 0x01, 0x01, 0x59, 0x4D, 0x83, 0x01, 0x08, 0x18, 0x60, 0x60,
+  0xBB, 0x1C, 0x13, 0x03, 0x2A, 0x59, 0x82, 0x01, 0x02, 0x56, 0xA3, 0x14, 0x82, 0x01, 0x03, 0x4C,
+  0xB2, 0x3A, 0x33, 0x83, 0x00, 0x03, 0x3A, 0x01, 0x01, 0x4C, 0x82, 0x00, 0x00, 0xAD, 0x82, 0x01,
+  0x04, 0x04, 0x74, 0x3C, 0x7B, 0x11, 0x82, 0x05, 0x01, 0x2B, 0x20, 0x82, 0x01, 0x09, 0x3E, 0x1A,
+  0x0A, 0x1F, 0x0A, 0x0D, 0x04, 0x0D, 0x0D, 0x1A, 0x83, 0x01, 0x00, 0x24, 0x83, 0x01, 0x09, 0x24,
+  0x0D, 0x54, 0x0A, 0x0A, 0x85, 0x54, 0x85, 0x0A, 0x57, 0x82, 0x01, 0x00, 0x20, 0x82, 0x01, 0x07,
+  0x4C, 0x52, 0x06, 0x06, 0x0E, 0x12, 0x0E, 0x1B, 0x86, 0x01, 0x01, 0x14, 0x14, 0x86, 0x01, 0x06,
+  0x14, 0x0B, 0x48, 0x13, 0x2F, 0x32, 0x18, 0x84, 0x01, 0x00, 0x14, 0x82, 0x2F, 0x0A, 0x20, 0x01,
+  0x01, 0x4C, 0x21, 0x31, 0x3F, 0x16, 0x2B, 0x1C, 0x14, 0x84, 0x01, 0x10, 0x2F, 0x18, 0x04, 0x18,
+  0x1E, 0x17, 0x18, 0x53, 0x4C, 0x0D, 0x19, 0x19, 0x17, 0x2F, 0x0B, 0x31, 0xDF, 0x82, 0x01, 0x01,
+  0x59, 0x24, 0x83, 0x01, 0x08, 0x1E, 0x60, 0x19, 0x60, 0x45, 0x2C, 0x03, 0x2A, 0x59, 0x82, 0x01,
+  0x02, 0x02, 0x51, 0x33, 0x83, 0x01, 0x02, 0x3A, 0x3A, 0x33, 0x83, 0x00, 0x03, 0xAD, 0x01, 0x01,
+  0xF1, 0x82, 0x00, 0x00, 0xAC, 0x82, 0x01, 0x09, 0x18, 0x8D, 0xC7, 0x7E, 0x05, 0x26, 0x05, 0x05,
+  0x84, 0x20, 0x82, 0x01, 0x0A, 0x4D, 0x1A, 0x0A, 0x1F, 0x0A, 0x1A, 0x0A, 0x0D, 0x0A, 0x24, 0x4E,
+  0x82, 0x01, 0x01, 0x24, 0x57, 0x82, 0x01, 0x08, 0x24, 0x0A, 0x54, 0x0A, 0x3D, 0x0A, 0x54, 0x0A,
+  0x0A, 0x83, 0x01, 0x00, 0x4D, 0x82, 0x01, 0x07, 0x4C, 0x1D, 0x1D, 0x06, 0x43, 0x0E, 0x0E, 0x3E,
+  0x84, 0x01, 0x05, 0x4C, 0x03, 0x55, 0x0E, 0x55, 0x67, 0x85, 0x01, 0x05, 0x76, 0x2C, 0x0B, 0x4A,
+  0x18, 0x18, 0x83, 0x01, 0x0E, 0x14, 0x18, 0x18, 0x1E, 0x32, 0x1E, 0x18, 0x01, 0x4C, 0x19, 0x32,
+  0x29, 0x0B, 0x0B, 0x5A, 0x84, 0x01, 0x10, 0x3E, 0x04, 0x18, 0x18, 0x04, 0x32, 0x1E, 0x04, 0x24,
+  0x99, 0x04, 0x18, 0x1E, 0x19, 0x17, 0x29, 0x29, 0x82, 0x01, 0x03, 0x14, 0x32, 0x18, 0x4E, 0x82,
+  0x01, 0x08, 0x3E, 0x19, 0x60, 0x4F, 0x13, 0x13, 0x6E, 0x3F, 0x59, 0x82, 0x01, 0x02, 0x56, 0x00,
+  0x75, 0x83, 0x01, 0x02, 0xAC, 0x3A, 0x33, 0x83, 0x00, 0x03, 0xAD, 0x01, 0x01, 0xEC, 0x82, 0x00,
+  0x00, 0xA3, 0x82, 0x01, 0x09, 0x20, 0x91, 0xC7, 0x7B, 0x05, 0x26, 0x05, 0x05, 0x16, 0x53, 0x82,
+  0x01, 0x09, 0x4D, 0x1F, 0x1F, 0x0A, 0x54, 0x0A, 0x0D, 0x54, 0x54, 0x0A, 0x82, 0x01, 0x06, 0x14,
+  0x3D, 0x57, 0x01, 0x01, 0x14, 0x3D, 0x83, 0x0A, 0x03, 0x54, 0x0A, 0x0A, 0x3D, 0x82, 0x01, 0x01,
+  0x14, 0x5F, 0x82, 0x01, 0x06, 0x20, 0x48, 0x05, 0x0F, 0x16, 0x2B, 0x0B, 0x84, 0x01, 0x01, 0x33,
+  0x55, 0x84, 0x0E, 0x00, 0x0B, 0x84, 0x01, 0x05, 0x3E, 0x48, 0x0B, 0x18, 0x1A, 0x3D, 0x83, 0x01,
+  0x0E, 0x20, 0x0D, 0x04, 0x18, 0x32, 0x32, 0x1E, 0x0D, 0x3E, 0x04, 0x18, 0x1E, 0x1E, 0x04, 0x4D,
+  0x83, 0x01, 0x03, 0x14, 0x18, 0x04, 0x18, 0x82, 0x04, 0x0A, 0x18, 0x18, 0x04, 0x04, 0x18, 0x04,
+  0x04, 0x17, 0x32, 0x19, 0x17, 0x82, 0x01, 0x02, 0x14, 0x1B, 0x18, 0x83, 0x01, 0x08, 0x3E, 0x04,
+  0x83, 0x29, 0x03, 0x13, 0x2C, 0x2A, 0x59, 0x82, 0x01, 0x02, 0x02, 0x51, 0x9C, 0x83, 0x01, 0x02,
+  0xEC, 0x3A, 0x33, 0x83, 0x00, 0x03, 0x75, 0x01, 0x01, 0xAD, 0x83, 0x00, 0x82, 0x01, 0x09, 0x14,
+  0x8D, 0x7A, 0x11, 0x26, 0x26, 0x05, 0x11, 0x41, 0x53, 0x82, 0x01, 0x09, 0x20, 0x1F, 0x1F, 0x0A,
+  0x0A, 0x54, 0x0D, 0x24, 0x0A, 0x0A, 0x82, 0x01, 0x02, 0x14, 0x24, 0x53, 0x82, 0x01, 0x08, 0x4D,
+  0x0D, 0x0A, 0x54, 0x54, 0x0A, 0x0D, 0x0D, 0x3D, 0x82, 0x01, 0x01, 0x20, 0x3D, 0x82, 0x01, 0x06,
+  0x14, 0x1D, 0x0F, 0x16, 0xBB, 0x04, 0x4D, 0x84, 0x01, 0x08, 0x03, 0x06, 0x07, 0x12, 0x15, 0x07,
+  0x15, 0x0E, 0x3E, 0x83, 0x01, 0x05, 0x14, 0x13, 0x1B, 0x0D, 0x1A, 0x3D, 0x83, 0x01, 0x0E, 0x24,
+  0x1A, 0x0D, 0x18, 0x1E, 0x32, 0x32, 0x18, 0x04, 0x04, 0x1E, 0x04, 0x04, 0x0D, 0x57, 0x83, 0x01,
+  0x00, 0x3E, 0x83, 0x04, 0x00, 0x0D, 0x84, 0x04, 0x06, 0x18, 0x04, 0x0D, 0x17, 0x19, 0x17, 0x59,
+  0x82, 0x01, 0x03, 0x33, 0x65, 0x1B, 0x14, 0x82, 0x01, 0x08, 0x4C, 0x19, 0x40, 0x13, 0x3F, 0x03,
+  0x2A, 0x2A, 0x59, 0x82, 0x01, 0x03, 0xA1, 0x00, 0x00, 0x33, 0x82, 0x01, 0x02, 0x33, 0x3A, 0x33,
+  0x83, 0x00, 0x03, 0x75, 0x01, 0x01, 0x3A, 0x83, 0x00, 0x0C, 0x4C, 0x01, 0x01, 0x14, 0x98, 0x2D,
+  0x6B, 0x7E, 0x26, 0x26, 0x22, 0x7D, 0x53, 0x82, 0x01, 0x09, 0x20, 0x1F, 0x1F, 0x0A, 0x0A, 0x54,
+  0x85, 0x24, 0x0D, 0x3D, 0x82, 0x01, 0x02, 0x14, 0x24, 0x4D, 0x82, 0x01, 0x08, 0x20, 0x18, 0x54,
+  0x0D, 0x0A, 0x0D, 0x85, 0x54, 0x5F, 0x82, 0x01, 0x01, 0x20, 0x3D, 0x82, 0x01, 0x06, 0x14, 0x60,
+  0x2B, 0x16, 0x04, 0x0A, 0x5F, 0x83, 0x01, 0x00, 0x67, 0x86, 0x0E, 0x01, 0x06, 0x2A, 0x84, 0x01,
+  0x04, 0x2F, 0x0D, 0x1A, 0x1A, 0x5F, 0x83, 0x01, 0x08, 0x18, 0x1A, 0x0D, 0x0D, 0x04, 0x1E, 0x1E,
+  0x32, 0x32, 0x82, 0x18, 0x02, 0x04, 0x0D, 0x4E, 0x83, 0x01, 0x00, 0x18, 0x82, 0x04, 0x09, 0x0D,
+  0x0D, 0x04, 0x18, 0x04, 0x18, 0x04, 0x04, 0x1A, 0x0D, 0x82, 0x19, 0x00, 0x99, 0x82, 0x01, 0x03,
+  0x67, 0x03, 0x03, 0x3E, 0x83, 0x01, 0x07, 0x21, 0x03, 0x03, 0x13, 0x13, 0x2A, 0x3F, 0x59, 0x82,
+  0x01, 0x03, 0xA1, 0x00, 0x00, 0x75, 0x82, 0x01, 0x02, 0x4C, 0x3A, 0x33, 0x83, 0x00, 0x03, 0x8E,
+  0x01, 0x01, 0x8E, 0x83, 0x00, 0x00, 0x8E, 0x82, 0x01, 0x08, 0xA2, 0x73, 0x11, 0x7E, 0x26, 0x26,
+  0x22, 0x60, 0x53, 0x82, 0x01, 0x09, 0x4D, 0x1F, 0x0A, 0x1F, 0x1F, 0x0A, 0x54, 0x0D, 0x24, 0x85,
+  0x83, 0x01, 0x01, 0x24, 0x24, 0x82, 0x01, 0x08, 0x4C, 0x18, 0x18, 0x24, 0x24, 0x0D, 0x24, 0x85,
+  0x53, 0x82, 0x01, 0x01, 0x4D, 0x3D, 0x82, 0x01, 0x06, 0x53, 0x1A, 0x60, 0xBB, 0x1A, 0x0A, 0x57,
+  0x83, 0x01, 0x01, 0x76, 0x1D, 0x82, 0x0E, 0x01, 0x06, 0x43, 0x82, 0x1D, 0x00, 0x3E, 0x83, 0x01,
+  0x04, 0x3E, 0x0D, 0x0D, 0x1A, 0xA6, 0x82, 0x01, 0x0B, 0x14, 0x24, 0x18, 0x04, 0x18, 0x04, 0x18,
+  0x1E, 0x32, 0x19, 0x1E, 0x04, 0x82, 0x18, 0x83, 0x01, 0x04, 0x20, 0x0D, 0x04, 0x04, 0x0D, 0x83,
+  0x04, 0x01, 0x18, 0x0D, 0x83, 0x04, 0x82, 0x19, 0x00, 0x20, 0x82, 0x01, 0x03, 0x5A, 0x31, 0x31,
+  0x3E, 0x83, 0x01, 0x07, 0x5A, 0x0B, 0x13, 0x1C, 0x13, 0x2A, 0x79, 0x59, 0x82, 0x01, 0x03, 0x5E,
+  0x00, 0x00, 0x3A, 0x83, 0x01, 0x02, 0xAD, 0xC8, 0xB2, 0x82, 0x00, 0x00, 0x8E, 0x82, 0x01, 0x04,
+  0x8E, 0xA3, 0x00, 0x00, 0x75, 0x82, 0x01, 0x08, 0x93, 0x2D, 0x3B, 0x7B, 0x26, 0x05, 0x5B, 0x93,
+  0x53, 0x82, 0x01, 0x00, 0x20, 0x85, 0x1F, 0x08, 0x0A, 0x0A, 0x3D, 0x57, 0x01, 0x01, 0x14, 0x1A,
+  0x3D, 0x83, 0x01, 0x07, 0x24, 0x1E, 0x1E, 0x0D, 0x0D, 0x24, 0x54, 0x53, 0x82, 0x01, 0x01, 0x4D,
+  0x85, 0x82, 0x01, 0x01, 0x20, 0x0A, 0x82, 0x1F, 0x01, 0x0A, 0x4E, 0x83, 0x01, 0x0A, 0x24, 0x04,
+  0x82, 0x2C, 0x06, 0x43, 0x0F, 0x84, 0x84, 0x22, 0x2F, 0x83, 0x01, 0x04, 0x33, 0x4A, 0x1E, 0x0D,
+  0xA6, 0x83, 0x01, 0x0D, 0x24, 0x0D, 0x04, 0x04, 0x1A, 0x0D, 0x18, 0x18, 0x1E, 0x19, 0x18, 0x04,
+  0x18, 0x4D, 0x83, 0x01, 0x00, 0x20, 0x85, 0x04, 0x05, 0x0D, 0x1A, 0x0D, 0x1A, 0x0D, 0x1A, 0x82,
+  0x04, 0x02, 0x19, 0xC4, 0x20, 0x82, 0x01, 0x03, 0x76, 0x0B, 0x0B, 0x67, 0x83, 0x01, 0x07, 0x3E,
+  0x13, 0x0B, 0x3F, 0x13, 0x2A, 0x79, 0x59, 0x82, 0x01, 0x04, 0xEA, 0x00, 0x00, 0x9C, 0x14, 0x82,
+  0x01, 0x01, 0x75, 0x33, 0x83, 0x00, 0x00, 0x33, 0x83, 0x01, 0x03, 0x4C, 0x3A, 0x00, 0xAD, 0x82,
+  0x01, 0x07, 0x59, 0x74, 0x3C, 0x11, 0x26, 0x05, 0x08, 0x29, 0x83, 0x01, 0x00, 0x20, 0x87, 0x1F,
+  0x00, 0x0A, 0x83, 0x01, 0x02, 0x24, 0x0D, 0x4E, 0x82, 0x01, 0x06, 0x4D, 0x0D, 0x1E, 0x1E, 0x24,
+  0x0D, 0x85, 0x83, 0x01, 0x01, 0x24, 0x3D, 0x83, 0x01, 0x05, 0x0A, 0x44, 0x1F, 0x1F, 0x0A, 0x4E,
+  0x82, 0x01, 0x0B, 0x20, 0x1A, 0x1F, 0x1F, 0x04, 0xD1, 0x16, 0x2B, 0x2A, 0x3F, 0x16, 0x29, 0x83,
+  0x01, 0x04, 0x20, 0x18, 0x1E, 0x0D, 0xA6, 0x83, 0x01, 0x0D, 0x20, 0x1A, 0x0D, 0x32, 0x04, 0x04,
+  0x0D, 0x04, 0x18, 0x19, 0x18, 0x18, 0x04, 0xA6, 0x83, 0x01, 0x01, 0xDF, 0x0D, 0x83, 0x04, 0x06,
+  0x0D, 0x47, 0x1A, 0x77, 0x1A, 0x04, 0x47, 0x82, 0x04, 0x09, 0x18, 0x17, 0x20, 0x01, 0x01, 0x14,
+  0x2F, 0x72, 0x0B, 0x2F, 0x83, 0x01, 0x0B, 0x3E, 0x0B, 0x1C, 0x40, 0x13, 0x3F, 0x46, 0x59, 0x4E,
+  0x01, 0x01, 0xD3, 0x82, 0x00, 0x00, 0x33, 0x82, 0x01, 0x01, 0xC8, 0x33, 0x83, 0x00, 0x00, 0xF0,
+  0x84, 0x01, 0x02, 0x14, 0x8E, 0xAC, 0x82, 0x01, 0x08, 0xDF, 0x2D, 0x3C, 0x11, 0x11, 0x05, 0x27,
+  0x1B, 0x53, 0x82, 0x01, 0x0A, 0x3E, 0x0A, 0x1F, 0x1F, 0x44, 0x1F, 0x44, 0x44, 0x0A, 0x0A, 0x57,
+  0x82, 0x01, 0x02, 0x24, 0x0A, 0x57, 0x82, 0x01, 0x06, 0x4D, 0x0D, 0x04, 0x1E, 0x0D, 0x24, 0xA6,
+  0x82, 0x01, 0x02, 0x14, 0x1A, 0x3D, 0x82, 0x01, 0x00, 0x20, 0x82, 0x1F, 0x01, 0x44, 0x3D, 0x83,
+  0x01, 0x01, 0x20, 0x1A, 0x83, 0x1F, 0x05, 0x04, 0x19, 0x31, 0x03, 0x03, 0x32, 0x83, 0x01, 0x04,
+  0x20, 0x24, 0x0D, 0x0D, 0x4D, 0x84, 0x01, 0x0C, 0x1A, 0x1A, 0x1E, 0x18, 0x18, 0x0D, 0x04, 0x1E,
+  0x18, 0x18, 0x04, 0x0D, 0x20, 0x83, 0x01, 0x00, 0x99, 0x84, 0x04, 0x06, 0x1A, 0x77, 0x1A, 0x0D,
+  0x1A, 0x0D, 0x1A, 0x83, 0x04, 0x00, 0x2F, 0x82, 0x01, 0x04, 0x20, 0x17, 0x29, 0x29, 0x72, 0x83,
+  0x01, 0x0B, 0x14, 0x29, 0x1C, 0x6C, 0x49, 0x6C, 0x45, 0x59, 0x01, 0x01, 0x14, 0xD3, 0x82, 0x00,
+  0x00, 0x75, 0x82, 0x01, 0x01, 0x14, 0x33, 0x83, 0x00, 0x00, 0x33, 0x8A, 0x01, 0x07, 0x20, 0x8D,
+  0x7C, 0x11, 0x05, 0xCF, 0x27, 0x29, 0x83, 0x01, 0x09, 0x59, 0x0D, 0x0D, 0x0A, 0x44, 0x44, 0x1F,
+  0x44, 0x44, 0x0A, 0x82, 0x01, 0x03, 0x14, 0x1A, 0x0A, 0x5F, 0x82, 0x01, 0x06, 0x20, 0x0D, 0x0A,
+  0x0D, 0x0D, 0x24, 0xA6, 0x82, 0x01, 0x02, 0x20, 0x0A, 0x3D, 0x83, 0x01, 0x05, 0x1F, 0x44, 0x1F,
+  0x0A, 0x3D, 0x4E, 0x82, 0x01, 0x0C, 0x4D, 0x1F, 0x1F, 0x1A, 0x1A, 0x0A, 0x0A, 0x1A, 0x19, 0x1B,
+  0x18, 0x0A, 0x53, 0x83, 0x01, 0x04, 0x18, 0x0D, 0x0D, 0x24, 0x4E, 0x83, 0x01, 0x0C, 0x20, 0x0A,
+  0x0D, 0x04, 0x18, 0x1E, 0x19, 0x18, 0x04, 0x04, 0x18, 0x18, 0x53, 0x83, 0x01, 0x02, 0x1E, 0x04,
+  0x0D, 0x82, 0x04, 0x0B, 0x47, 0x1A, 0x1A, 0x04, 0x0D, 0x1A, 0x1A, 0x04, 0x1A, 0x47, 0x04, 0x1E,
+  0x82, 0x01, 0x05, 0x3E, 0x32, 0x2F, 0x29, 0x29, 0x20, 0x82, 0x01, 0x07, 0x14, 0x29, 0x40, 0x3F,
+  0xB1, 0x1C, 0x2B, 0x59, 0x82, 0x01, 0x00, 0xD3, 0x82, 0x00, 0x00, 0x9C, 0x82, 0x01, 0x01, 0x14,
+  0xC8, 0x83, 0x00, 0x00, 0x33, 0x8A, 0x01, 0x08, 0x20, 0xD4, 0xC7, 0x11, 0x05, 0x62, 0x8A, 0x49,
+  0x14, 0x82, 0x01, 0x03, 0x3E, 0x04, 0x0D, 0x0A, 0x82, 0x1F, 0x02, 0x44, 0x0A, 0x3D, 0x82, 0x01,
+  0x03, 0x14, 0x0A, 0x0A, 0x3D, 0x82, 0x01, 0x06, 0x20, 0x0D, 0x0A, 0x0A, 0x04, 0x24, 0x57, 0x82,
+  0x01, 0x02, 0x4D, 0x0A, 0x3D, 0x82, 0x01, 0x05, 0x20, 0x0A, 0x44, 0x1F, 0x1A, 0x5F, 0x83, 0x01,
+  0x04, 0x9F, 0x0A, 0x1F, 0x1F, 0x0A, 0x82, 0x1A, 0x82, 0x0D, 0x01, 0x1A, 0x57, 0x83, 0x01, 0x03,
+  0x24, 0x0D, 0x1A, 0x9F, 0x85, 0x01, 0x07, 0x20, 0x0A, 0x1A, 0x0D, 0x32, 0x04, 0x18, 0x0D, 0x82,
+  0x04, 0x00, 0x53, 0x83, 0x01, 0x1A, 0x59, 0x04, 0x04, 0x0D, 0x1E, 0x04, 0x04, 0x0D, 0x47, 0x04,
+  0x04, 0x0D, 0x0D, 0x04, 0x0D, 0x18, 0x19, 0x4D, 0x4E, 0x01, 0x01, 0x3E, 0x19, 0x93, 0x29, 0x29,
+  0x20, 0x83, 0x01, 0x06, 0x76, 0x1C, 0xB1, 0xB3, 0xB1, 0x79, 0x59, 0x82, 0x01, 0x00, 0x3A, 0x83,
+  0x00, 0x00, 0x33, 0x82, 0x01, 0x00, 0x33, 0x83, 0x00, 0x03, 0x33, 0x01, 0x75, 0x14, 0x88, 0x01,
+  0x06, 0xB3, 0x3C, 0x3B, 0x11, 0x05, 0x8A, 0x46, 0x83, 0x01, 0x05, 0x3E, 0x04, 0x04, 0x0D, 0x0A,
+  0x1F, 0x82, 0x0A, 0x01, 0x3D, 0x57, 0x82, 0x01, 0x0B, 0x1A, 0x0A, 0x0A, 0x4E, 0x01, 0x01, 0x14,
+  0x0D, 0x0A, 0x1F, 0x1A, 0x24, 0x83, 0x01, 0x02, 0x24, 0x0A, 0x5F, 0x82, 0x01, 0x05, 0x14, 0x0A,
+  0x44, 0x1F, 0xAE, 0x5F, 0x83, 0x01, 0x0D, 0x9F, 0x1F, 0x1F, 0x44, 0x0A, 0x0A, 0x1A, 0x1F, 0x1E,
+  0x1A, 0x04, 0x04, 0x57, 0x4E, 0x82, 0x01, 0x03, 0x24, 0x24, 0x18, 0x0A, 0x86, 0x01, 0x0A, 0x14,
+  0x3D, 0x1F, 0xAE, 0x0D, 0x04, 0x9D, 0x04, 0x18, 0x18, 0x53, 0x82, 0x01, 0x02, 0x14, 0x59, 0xBF,
+  0x8C, 0x04, 0x02, 0x72, 0x18, 0x5F, 0x82, 0x01, 0x05, 0x59, 0x19, 0x17, 0x1B, 0x29, 0x2F, 0x83,
+  0x01, 0x01, 0x67, 0x49, 0x82, 0x27, 0x05, 0xB9, 0x99, 0x01, 0x01, 0x14, 0x3A, 0x83, 0x00, 0x00,
+  0x8E, 0x82, 0x01, 0x00, 0x33, 0x82, 0x00, 0x05, 0xB2, 0x33, 0x01, 0x3A, 0xA3, 0x33, 0x87, 0x01,
+  0x07, 0xC5, 0x2D, 0x37, 0x05, 0x26, 0x05, 0xA2, 0x20, 0x82, 0x01, 0x0A, 0x3E, 0x19, 0x04, 0x04,
+  0x0D, 0x1A, 0x0A, 0x1F, 0x0A, 0x3D, 0x4E, 0x82, 0x01, 0x03, 0x24, 0x0A, 0x0A, 0x57, 0x82, 0x01,
+  0x00, 0x24, 0x82, 0x0A, 0x00, 0x85, 0x82, 0x01, 0x03, 0x14, 0x0A, 0x24, 0x85, 0x82, 0x01, 0x01,
+  0x53, 0x0A, 0x82, 0x1F, 0x00, 0x57, 0x82, 0x01, 0x0D, 0x14, 0x0A, 0x0A, 0x44, 0x0A, 0x44, 0x1A,
+  0x0A, 0x1A, 0x1A, 0xAE, 0x1A, 0x19, 0x57, 0x82, 0x01, 0x05, 0x14, 0x4D, 0x24, 0x24, 0x0D, 0x57,
+  0x87, 0x01, 0x07, 0x9F, 0x1F, 0x1A, 0x82, 0x16, 0x2B, 0x60, 0x18, 0x83, 0x01, 0x04, 0x14, 0x18,
+  0x04, 0x19, 0x1E, 0x83, 0x04, 0x82, 0x47, 0x06, 0x1A, 0x04, 0x04, 0x19, 0x19, 0x0D, 0x57, 0x82,
+  0x01, 0x05, 0x2F, 0x4F, 0x29, 0x1C, 0x1B, 0x2F, 0x83, 0x01, 0x0A, 0x67, 0x89, 0x27, 0x5C, 0x27,
+  0xDC, 0x18, 0x01, 0x01, 0x14, 0x3A, 0x83, 0x00, 0x00, 0xAC, 0x82, 0x01, 0x00, 0x33, 0x83, 0x00,
+  0x05, 0x4C, 0x14, 0xA3, 0x00, 0xB2, 0x8E, 0x86, 0x01, 0x07, 0x2F, 0x7A, 0x3B, 0x11, 0x05, 0x38,
+  0x89, 0x20, 0x82, 0x01, 0x09, 0x33, 0x4F, 0x19, 0x04, 0x0D, 0x0D, 0x1A, 0x0A, 0x0A, 0x3D, 0x83,
+  0x01, 0x82, 0x0A, 0x83, 0x01, 0x00, 0x85, 0x82, 0x0A, 0x00, 0xA6, 0x82, 0x01, 0x03, 0x20, 0x24,
+  0x0A, 0x3D, 0x83, 0x01, 0x00, 0x1F, 0x82, 0x44, 0x00, 0x5F, 0x83, 0x01, 0x0C, 0x0A, 0x1F, 0x0A,
+  0x44, 0x0A, 0x0A, 0x1F, 0x1A, 0x1A, 0xAE, 0x04, 0x04, 0x4D, 0x83, 0x01, 0x04, 0x24, 0x0D, 0x0D,
+  0x0A, 0x85, 0x88, 0x01, 0x07, 0x4D, 0x1A, 0x46, 0x08, 0x08, 0xD1, 0x18, 0x57, 0x82, 0x01, 0x05,
+  0x14, 0x18, 0x1E, 0x1E, 0x04, 0xBF, 0x83, 0x04, 0x00, 0x47, 0x82, 0x04, 0x0D, 0x18, 0x18, 0x04,
+  0x04, 0x4E, 0x01, 0x01, 0x14, 0x2F, 0x29, 0x29, 0x0B, 0x0B, 0x76, 0x83, 0x01, 0x0A, 0x33, 0x89,
+  0x08, 0x37, 0x8A, 0xCC, 0x18, 0x4E, 0x01, 0x01, 0x3A, 0x83, 0x00, 0x00, 0xA3, 0x82, 0x01, 0x00,
+  0x33, 0x83, 0x00, 0x02, 0x4C, 0x4C, 0x9C, 0x82, 0x00, 0x01, 0xAC, 0x14, 0x84, 0x01, 0x07, 0x3E,
+  0x2D, 0x11, 0x7E, 0x26, 0x38, 0xB1, 0x53, 0x82, 0x01, 0x05, 0x3E, 0x4F, 0x19, 0x04, 0x19, 0x04,
+  0x82, 0x0D, 0x00, 0x0A, 0x82, 0x01, 0x04, 0x14, 0x3D, 0x0A, 0x0A, 0x57, 0x82, 0x01, 0x00, 0x20,
+  0x82, 0x0A, 0x00, 0x5F, 0x82, 0x01, 0x03, 0x20, 0x1A, 0x1F, 0x3D, 0x82, 0x01, 0x05, 0x14, 0x1F,
+  0x44, 0x0A, 0x44, 0x57, 0x82, 0x01, 0x0D, 0x14, 0x0A, 0x44, 0x0A, 0x0A, 0x44, 0x44, 0x1F, 0x0A,
+  0x1A, 0x77, 0x77, 0x19, 0x20, 0x83, 0x01, 0x05, 0x18, 0x0D, 0x24, 0x0A, 0x0A, 0x57, 0x88, 0x01,
+  0x06, 0x4D, 0x60, 0x16, 0x08, 0x41, 0x04, 0x53, 0x82, 0x01, 0x08, 0x14, 0x04, 0x04, 0x19, 0x0D,
+  0x04, 0x0D, 0x04, 0x83, 0x86, 0x04, 0x01, 0xC4, 0x18, 0x82, 0x01, 0x01, 0x4C, 0x29, 0x83, 0x0B,
+  0x01, 0x40, 0x14, 0x82, 0x01, 0x0A, 0x14, 0x08, 0x22, 0x37, 0x27, 0xCC, 0x18, 0x01, 0x01, 0x14,
+  0x3A, 0x84, 0x00, 0x03, 0x4C, 0x01, 0x01, 0x33, 0x83, 0x00, 0x02, 0x4C, 0xC8, 0xB2, 0x83, 0x00,
+  0x02, 0x9C, 0x8E, 0x14, 0x82, 0x01, 0x07, 0x4C, 0x2D, 0x3B, 0x11, 0x26, 0x26, 0x84, 0x20, 0x82,
+  0x01, 0x09, 0x67, 0x40, 0x93, 0x04, 0x1E, 0x04, 0x04, 0x0D, 0x0D, 0x24, 0x83, 0x01, 0x03, 0x1A,
+  0x0A, 0x0A, 0x5F, 0x82, 0x01, 0x04, 0x14, 0x1F, 0x0A, 0x0A, 0x57, 0x82, 0x01, 0x07, 0x4D, 0x1A,
+  0x1F, 0x3D, 0x4E, 0x01, 0x01, 0x14, 0x82, 0x0A, 0x01, 0x44, 0x57, 0x82, 0x01, 0x00, 0x14, 0x82,
+  0x0A, 0x03, 0x1F, 0x0A, 0x1F, 0x1F, 0x83, 0x1A, 0x01, 0x04, 0x4D, 0x83, 0x01, 0x05, 0x59, 0x0D,
+  0x0A, 0x0A, 0x3D, 0x3D, 0x89, 0x01, 0x04, 0x1A, 0x49, 0x08, 0x16, 0x45, 0x83, 0x01, 0x03, 0x14,
+  0x04, 0x60, 0x19, 0x82, 0x04, 0x82, 0x19, 0x85, 0x04, 0x01, 0x19, 0x99, 0x82, 0x01, 0x05, 0x3E,
+  0x72, 0x40, 0x2F, 0x67, 0xE1, 0x85, 0x01, 0x09, 0x2B, 0x22, 0x37, 0x36, 0x42, 0x18, 0x4E, 0x01,
+  0x14, 0x3A, 0x84, 0x00, 0x03, 0x75, 0x01, 0x01, 0xC8, 0x82, 0x00, 0x02, 0xB2, 0xC8, 0x33, 0x86,
+  0x00, 0x00, 0x3A, 0x82, 0x01, 0x07, 0x14, 0x27, 0x3B, 0x11, 0x26, 0x7E, 0x1D, 0x20, 0x82, 0x01,
+  0x09, 0x67, 0x29, 0x17, 0x19, 0x1E, 0x04, 0x04, 0x0D, 0x0D, 0x9F, 0x83, 0x01, 0x82, 0x0A, 0x00,
+  0x3D, 0x82, 0x01, 0x03, 0x14, 0x0A, 0x1F, 0x0A, 0x83, 0x01, 0x08, 0x4D, 0x0A, 0x0A, 0x3D, 0x4E,
+  0x01, 0x01, 0x14, 0x24, 0x82, 0x0A, 0x00, 0x57, 0x83, 0x01, 0x84, 0x0A, 0x83, 0x1F, 0x03, 0x18,
+  0x0D, 0x04, 0x20, 0x83, 0x01, 0x06, 0x59, 0x0D, 0x0A, 0x0A, 0x0D, 0x0D, 0x4D, 0x88, 0x01, 0x05,
+  0x20, 0x04, 0x2C, 0x16, 0x87, 0x53, 0x82, 0x01, 0x05, 0x14, 0x45, 0x46, 0x83, 0x18, 0x9D, 0x82,
+  0x04, 0x08, 0x94, 0x04, 0x83, 0x7D, 0x46, 0x82, 0x9D, 0x29, 0x4D, 0x82, 0x01, 0x01, 0x4C, 0x14,
+  0x89, 0x01, 0x05, 0x72, 0x22, 0x37, 0x8D, 0x39, 0x18, 0x82, 0x01, 0x00, 0x3A, 0x84, 0x00, 0x03,
+  0x3A, 0x01, 0x01, 0x33, 0x83, 0x00, 0x01, 0x8E, 0x8E, 0x87, 0x00, 0x83, 0x01, 0x06, 0x46, 0x3C,
+  0x11, 0x7E, 0x26, 0x43, 0x20, 0x82, 0x01, 0x09, 0x67, 0x76, 0x29, 0x29, 0x93, 0x19, 0x18, 0x0D,
+  0x0D, 0x24, 0x82, 0x01, 0x04, 0x14, 0x9F, 0x0A, 0x1A, 0x3D, 0x83, 0x01, 0x03, 0x3D, 0x0A, 0x3D,
+  0x4E, 0x82, 0x01, 0x03, 0x24, 0x77, 0x0D, 0x3D, 0x82, 0x01, 0x05, 0x14, 0x0A, 0x54, 0x24, 0x0A,
+  0x57, 0x82, 0x01, 0x00, 0x14, 0x83, 0x0A, 0x08, 0x1A, 0x0A, 0x1A, 0x44, 0x1F, 0x1A, 0x47, 0x04,
+  0x53, 0x83, 0x01, 0x00, 0x2F, 0x82, 0x18, 0x03, 0x1E, 0x0D, 0x0D, 0xA6, 0x88, 0x01, 0x03, 0x1A,
+  0x60, 0x2B, 0x79, 0x83, 0x01, 0x11, 0x14, 0x1C, 0x16, 0x7D, 0x83, 0x04, 0x83, 0x83, 0xD7, 0x82,
+  0x87, 0x1D, 0x06, 0x0F, 0x08, 0x29, 0x60, 0x4D, 0x8E, 0x01, 0x09, 0x2F, 0x22, 0x5C, 0x8D, 0x39,
+  0x18, 0x4E, 0x01, 0x14, 0x3A, 0x84, 0x00, 0x03, 0x9C, 0x14, 0x01, 0x75, 0x83, 0x00, 0x01, 0xAC,
+  0xAD, 0x87, 0x00, 0x00, 0x14, 0x82, 0x01, 0x06, 0xC4, 0x3C, 0x11, 0x11, 0x26, 0x1D, 0x14, 0x82,
+  0x01, 0x09, 0x67, 0x0B, 0x0B, 0x29, 0x17, 0x4F, 0x19, 0x04, 0x0D, 0x1A, 0x83, 0x01, 0x04, 0x24,
+  0x1A, 0x1A, 0x0D, 0x4E, 0x82, 0x01, 0x02, 0x5F, 0x0A, 0x5F, 0x82, 0x01, 0x0D, 0x14, 0x0A, 0x0D,
+  0x04, 0x4D, 0x4E, 0x01, 0x01, 0x14, 0x0A, 0x54, 0x54, 0x0A, 0x57, 0x82, 0x01, 0x01, 0x14, 0x85,
+  0x86, 0x0A, 0x04, 0x1F, 0x0A, 0x0D, 0x04, 0x5F, 0x83, 0x01, 0x08, 0x1E, 0x04, 0x19, 0x4A, 0x19,
+  0x04, 0x0D, 0x1A, 0x24, 0x87, 0x01, 0x04, 0x53, 0x9D, 0x45, 0x04, 0x20, 0x82, 0x01, 0x08, 0x14,
+  0x19, 0x16, 0x1D, 0x1D, 0x0F, 0x1D, 0x1D, 0x2C, 0x82, 0x0E, 0x05, 0x06, 0x0F, 0x08, 0x16, 0x29,
+  0x20, 0x8E, 0x01, 0x09, 0x3E, 0x22, 0x37, 0x8D, 0x39, 0x18, 0x01, 0x01, 0x14, 0x3A, 0x85, 0x00,
+  0x02, 0xF0, 0x14, 0x3A, 0x84, 0x00, 0x00, 0x9C, 0x87, 0x00, 0x00, 0xC8, 0x82, 0x01, 0x06, 0x2F,
+  0x7A, 0x11, 0x05, 0x7E, 0x43, 0x20, 0x82, 0x01, 0x09, 0x67, 0x03, 0x1B, 0x72, 0x29, 0x29, 0x19,
+  0x18, 0x04, 0x24, 0x82, 0x01, 0x05, 0x14, 0x24, 0x1A, 0x1A, 0x0D, 0x53, 0x82, 0x01, 0x0A, 0x4D,
+  0x44, 0x5F, 0x4E, 0x01, 0x01, 0x20, 0x0A, 0x1A, 0x18, 0x24, 0x82, 0x01, 0x05, 0x14, 0x54, 0x85,
+  0x0A, 0x0A, 0x57, 0x82, 0x01, 0x01, 0x14, 0x24, 0x85, 0x0A, 0x05, 0x1F, 0x44, 0x1F, 0x04, 0x0D,
+  0x53, 0x83, 0x01, 0x04, 0x2F, 0x1E, 0x4A, 0x4A, 0x1E, 0x82, 0x0D, 0x02, 0x1A, 0x3D, 0x53, 0x85,
+  0x01, 0x04, 0x53, 0xAE, 0x04, 0x04, 0x20, 0x83, 0x01, 0x10, 0x32, 0x49, 0x1D, 0x06, 0x0E, 0x0E,
+  0x0C, 0x0E, 0x15, 0x06, 0x0E, 0x06, 0x1D, 0x0F, 0x08, 0x46, 0x53, 0x8E, 0x01, 0x09, 0x14, 0x22,
+  0x5C, 0x8A, 0x39, 0x04, 0x4E, 0x4E, 0x14, 0x3A, 0x85, 0x00, 0x01, 0xAD, 0x75, 0x8E, 0x00, 0x00,
+  0x75, 0x82, 0x01, 0x06, 0x99, 0x7A, 0x3C, 0x05, 0x7E, 0x1D, 0x20, 0x82, 0x01, 0x09, 0x67, 0x21,
+  0x0B, 0x1B, 0x0B, 0x29, 0x29, 0x19, 0x18, 0x18, 0x82, 0x01, 0x05, 0x14, 0x24, 0x0D, 0x1A, 0x0A,
+  0x5F, 0x82, 0x01, 0x02, 0xA6, 0x0A, 0x57, 0x82, 0x01, 0x04, 0x4D, 0x0A, 0x0A, 0x0D, 0x99, 0x83,
+  0x01, 0x04, 0x24, 0x54, 0x85, 0x0A, 0x57, 0x83, 0x01, 0x00, 0x3D, 0x85, 0x0A, 0x01, 0x1F, 0x1F,
+  0x82, 0x0D, 0x00, 0x53, 0x83, 0x01, 0x04, 0x1E, 0x04, 0x1E, 0x19, 0x04, 0x82, 0x0D, 0x03, 0x1A,
+  0x0A, 0x0A, 0x53, 0x84, 0x01, 0x04, 0x53, 0x1F, 0x44, 0x17, 0x20, 0x83, 0x01, 0x0F, 0x59, 0x61,
+  0x87, 0x2B, 0x0E, 0x15, 0x0E, 0x0E, 0x06, 0x0E, 0x0E, 0x06, 0x43, 0x0F, 0x0F, 0x79, 0x8F, 0x01,
+  0x09, 0x14, 0x84, 0x5C, 0x8D, 0x6F, 0x9F, 0x01, 0x01, 0x14, 0x3A, 0x96, 0x00, 0x00, 0xAC, 0x82,
+  0x01, 0x06, 0x20, 0x8D, 0x3C, 0x11, 0x26, 0x05, 0x20, 0x82, 0x01, 0x09, 0x67, 0x31, 0x03, 0x72,
+  0x0B, 0x72, 0x1B, 0x17, 0x93, 0x2F, 0x82, 0x01, 0x05, 0x14, 0x24, 0x18, 0x0D, 0x1A, 0x3D, 0x82,
+  0x01, 0x0A, 0x20, 0x0A, 0x4E, 0x4E, 0x01, 0x01, 0x3D, 0x1F, 0x0A, 0x0A, 0x24, 0x82, 0x01, 0x05,
+  0x20, 0x0A, 0x54, 0x85, 0x54, 0x57, 0x83, 0x01, 0x03, 0x24, 0x0A, 0x0A, 0x44, 0x82, 0x0A, 0x05,
+  0x1A, 0x1A, 0x18, 0x04, 0x0D, 0x53, 0x82, 0x01, 0x0D, 0x14, 0x2A, 0x93, 0x1E, 0x19, 0xBF, 0x0D,
+  0x0D, 0x77, 0x0D, 0x1A, 0x77, 0x9F, 0x57, 0x84, 0x01, 0x03, 0x0A, 0x44, 0xAE, 0x57, 0x83, 0x01,
+  0x0F, 0x4D, 0xBF, 0x19, 0x4F, 0x79, 0x0E, 0x0E, 0x06, 0x0E, 0x15, 0x0E, 0x0E, 0x06, 0x0F, 0x43,
+  0x2F, 0x88, 0x01, 0x03, 0x14, 0x3E, 0x2F, 0x33, 0x83, 0x01, 0x08, 0x49, 0x5C, 0x8D, 0xD6, 0x9F,
+  0x01, 0x01, 0x14, 0x3A, 0x96, 0x00, 0x00, 0x3A, 0x82, 0x01, 0x06, 0x14, 0xCC, 0x7A, 0x3C, 0x11,
+  0x84, 0x14, 0x82, 0x01, 0x09, 0x67, 0x21, 0x13, 0x03, 0x03, 0x1C, 0x1B, 0x29, 0xC4, 0x2F, 0x83,
+  0x01, 0x04, 0x18, 0x04, 0x0D, 0x1A, 0x3D, 0x83, 0x01, 0x00, 0x3D, 0x83, 0x01, 0x04, 0x0A, 0x1F,
+  0x44, 0x0A, 0x3D, 0x82, 0x01, 0x05, 0x14, 0x0A, 0x54, 0x54, 0x0A, 0x5F, 0x83, 0x01, 0x02, 0x5F,
+  0x0A, 0x1F, 0x83, 0x0A, 0x01, 0x0D, 0x18, 0x82, 0x0D, 0x00, 0x57, 0x82, 0x01, 0x0D, 0x20, 0x2A,
+  0x87, 0x1E, 0x4A, 0xBF, 0x04, 0x0D, 0x77, 0x1A, 0x0D, 0x47, 0x0D, 0x3D, 0x84, 0x01, 0x03, 0x0A,
+  0x44, 0x44, 0x5F, 0x83, 0x01, 0x05, 0x20, 0x0D, 0x04, 0x18, 0x04, 0x2A, 0x85, 0x0E, 0x03, 0x06,
+  0x06, 0x0C, 0x3E, 0x84, 0x01, 0x07, 0x14, 0x3E, 0x3E, 0x2F, 0x40, 0x29, 0x0B, 0x2F, 0x83, 0x01,
+  0x08, 0x2F, 0x5C, 0x39, 0x78, 0x3D, 0x4E, 0x01, 0x14, 0x3A, 0x96, 0x00, 0x0A, 0xA3, 0x14, 0x01,
+  0x01, 0x14, 0xAF, 0x74, 0x3C, 0x11, 0x05, 0x20, 0x82, 0x01, 0x00, 0x67, 0x82, 0x03, 0x05, 0x13,
+  0x31, 0x0B, 0x1B, 0x72, 0x2F, 0x82, 0x01, 0x05, 0x14, 0x18, 0x0D, 0x0D, 0x1A, 0x1A, 0x83, 0x01,
+  0x00, 0x53, 0x82, 0x01, 0x06, 0x53, 0x0A, 0x1F, 0x1F, 0x0A, 0x3D, 0x4E, 0x82, 0x01, 0x04, 0x24,
+  0x85, 0x54, 0x54, 0x5F, 0x83, 0x01, 0x00, 0x4D, 0x87, 0x0A, 0x02, 0x0D, 0x0D, 0x24, 0x83, 0x01,
+  0x0E, 0x33, 0x2B, 0x2B, 0x04, 0x4A, 0x04, 0x0D, 0x1A, 0x1A, 0xAE, 0x0A, 0x47, 0x0D, 0xAE, 0x4E,
+  0x83, 0x01, 0x04, 0x1A, 0x1F, 0x44, 0x5F, 0x4E, 0x82, 0x01, 0x0A, 0x20, 0x47, 0x77, 0x77, 0x94,
+  0x52, 0x0E, 0x06, 0x15, 0x0E, 0x0E, 0x82, 0x06, 0x01, 0x0E, 0x20, 0x82, 0x01, 0x09, 0x67, 0x1C,
+  0x1B, 0x17, 0x0B, 0x29, 0x29, 0x1C, 0x2B, 0x1C, 0x83, 0x01, 0x08, 0x3E, 0x2D, 0x2E, 0x30, 0x9F,
+  0x4E, 0x01, 0x14, 0x3A, 0x96, 0x00, 0x01, 0xB2, 0x14, 0x82, 0x01, 0x05, 0x04, 0x36, 0x2D, 0x3B,
+  0x84, 0x20, 0x82, 0x01, 0x02, 0x67, 0x03, 0x6C, 0x82, 0x03, 0x03, 0x0B, 0x72, 0x0B, 0x2F, 0x82,
+  0x01, 0x06, 0x14, 0x1E, 0x18, 0x04, 0x0D, 0x1A, 0x57, 0x86, 0x01, 0x00, 0x20, 0x83, 0x44, 0x00,
+  0x3D, 0x82, 0x01, 0x05, 0x20, 0x85, 0x24, 0x85, 0x54, 0xA6, 0x83, 0x01, 0x00, 0x20, 0x84, 0x0A,
+  0x05, 0x0D, 0x0A, 0x0A, 0x0D, 0x0D, 0x24, 0x83, 0x01, 0x0E, 0x3E, 0x1D, 0x2B, 0x04, 0x19, 0x0D,
+  0x47, 0x47, 0x77, 0x1A, 0xAE, 0x1A, 0x1A, 0x0A, 0x5F, 0x83, 0x01, 0x03, 0x0A, 0x44, 0x44, 0x3D,
+  0x84, 0x01, 0x05, 0x1A, 0x1A, 0x47, 0x45, 0x07, 0x0E, 0x82, 0x15, 0x05, 0x06, 0x13, 0x06, 0x06,
+  0x2C, 0x14, 0x82, 0x01, 0x09, 0x29, 0x2B, 0x0B, 0x29, 0x29, 0x4F, 0x40, 0x45, 0x1D, 0x2B, 0x83,
+  0x01, 0x08, 0x20, 0x6D, 0xD6, 0xC0, 0x99, 0x01, 0x01, 0x14, 0x3A, 0x97, 0x00, 0x00, 0x33, 0x82,
+  0x01, 0x05, 0x18, 0x39, 0x73, 0x3C, 0x22, 0x20, 0x82, 0x01, 0x02, 0x9E, 0x1D, 0x2A, 0x82, 0x03,
+  0x03, 0x1B, 0x6C, 0x31, 0x31, 0x83, 0x01, 0x05, 0x2F, 0x32, 0x19, 0x04, 0x04, 0x57, 0x86, 0x01,
+  0x01, 0x4D, 0x44, 0x82, 0xE3, 0x01, 0x0A, 0x4E, 0x82, 0x01, 0x04, 0x24, 0x54, 0x54, 0x24, 0x3D,
+  0x83, 0x01, 0x00, 0x20, 0x83, 0x0A, 0x06, 0x1A, 0x1F, 0x1F, 0x0A, 0x1A, 0x0A, 0x24, 0x83, 0x01,
+  0x0E, 0x67, 0x43, 0x2B, 0x04, 0x04, 0x0D, 0x04, 0x1E, 0x0D, 0x1A, 0x47, 0x1F, 0x1A, 0x1F, 0x5F,
+  0x83, 0x01, 0x04, 0x0A, 0x1F, 0x44, 0x3D, 0x4E, 0x83, 0x01, 0x0D, 0x24, 0x77, 0x83, 0x52, 0x15,
+  0x0E, 0x15, 0x0E, 0x0E, 0x13, 0x33, 0x06, 0x0E, 0x2A, 0x83, 0x01, 0x0A, 0x49, 0x08, 0x0B, 0x1C,
+  0x17, 0x17, 0x29, 0x1C, 0x0F, 0x1D, 0x20, 0x82, 0x01, 0x08, 0x14, 0x64, 0xD6, 0x81, 0x67, 0x4E,
+  0x01, 0x14, 0xA3, 0x97, 0x00, 0x00, 0xE0, 0x82, 0x01, 0x05, 0x99, 0x2E, 0x36, 0x2D, 0x27, 0x14,
+  0x82, 0x01, 0x03, 0x9E, 0x06, 0x43, 0x2A, 0x82, 0x03, 0x02, 0x21, 0x5D, 0x5A, 0x82, 0x01, 0x06,
+  0x14, 0x76, 0x2F, 0x19, 0x18, 0x18, 0x5F, 0x86, 0x01, 0x00, 0x9F, 0x83, 0x44, 0x00, 0x3D, 0x82,
+  0x01, 0x05, 0x14, 0x24, 0x0D, 0x24, 0x54, 0x0A, 0x84, 0x01, 0x00, 0x3D, 0x82, 0x0A, 0x06, 0x1A,
+  0x0A, 0x1F, 0x0A, 0x0A, 0x1A, 0x5F, 0x83, 0x01, 0x0E, 0x76, 0x1D, 0xC1, 0x7D, 0x04, 0x1E, 0x1E,
+  0x04, 0x77, 0x77, 0x1A, 0x1F, 0x1A, 0x1F, 0x5F, 0x83, 0x01, 0x04, 0x0A, 0x44, 0x0A, 0x0A, 0x4E,
+  0x83, 0x01, 0x0D, 0x20, 0x60, 0x1D, 0x0E, 0x15, 0x07, 0x0E, 0x15, 0x6E, 0x20, 0x14, 0x0E, 0x15,
+  0x6C, 0x82, 0x01, 0x0B, 0x14, 0x16, 0x08, 0x13, 0x1C, 0x4F, 0x19, 0x4F, 0x1C, 0x0F, 0x0F, 0x20,
+  0x83, 0x01, 0x06, 0x96, 0x34, 0xB3, 0xE2, 0x01, 0x01, 0x75, 0x98, 0x00, 0x11, 0xB2, 0x8E, 0x01,
+  0x01, 0x3E, 0x34, 0x39, 0x73, 0xE9, 0x20, 0x4E, 0x01, 0x01, 0x5A, 0x15, 0x0C, 0x43, 0x2C, 0x83,
+  0x03, 0x00, 0x31, 0x83, 0x01, 0x05, 0x76, 0x0B, 0x17, 0xC4, 0xDB, 0x4D, 0x85, 0x01, 0x02, 0x14,
+  0x24, 0x0A, 0x82, 0x44, 0x09, 0x3D, 0x4E, 0x4E, 0x01, 0x14, 0x0D, 0x24, 0x0D, 0x0D, 0x0A, 0x84,
+  0x01, 0x00, 0x4D, 0x82, 0x0A, 0x05, 0x0D, 0x0A, 0x0A, 0x1A, 0x0D, 0x0A, 0x83, 0x01, 0x0F, 0x14,
+  0x2A, 0x1D, 0x0F, 0x48, 0x79, 0x18, 0x04, 0x0D, 0x47, 0x1A, 0x1A, 0x0D, 0x1F, 0x0A, 0x5F, 0x83,
+  0x01, 0x04, 0x0A, 0x1F, 0x0A, 0x0A, 0x4E, 0x84, 0x01, 0x0C, 0x3E, 0x0E, 0x15, 0x0E, 0x15, 0x15,
+  0x6E, 0x20, 0x01, 0x14, 0x0E, 0x0E, 0x76, 0x82, 0x01, 0x0B, 0x33, 0x22, 0x89, 0x2A, 0x1C, 0x29,
+  0x4F, 0x45, 0x49, 0x05, 0x05, 0x59, 0x83, 0x01, 0x05, 0x04, 0x34, 0x71, 0xAC, 0xE0, 0x3A, 0x9B,
+  0x00, 0x07, 0x3A, 0x75, 0xE2, 0x58, 0x39, 0x36, 0xD4, 0x20, 0x82, 0x01, 0x00, 0x9E, 0x82, 0x0C,
+  0x05, 0x0F, 0x48, 0x13, 0x6C, 0x5D, 0x5A, 0x82, 0x01, 0x06, 0x14, 0x76, 0x1B, 0x0B, 0x72, 0x1B,
+  0x1E, 0x85, 0x01, 0x06, 0x4C, 0x1A, 0x77, 0x0A, 0x1F, 0x44, 0x3D, 0x82, 0x01, 0x06, 0x14, 0x1A,
+  0x54, 0x0D, 0x0A, 0x0A, 0x5F, 0x83, 0x01, 0x00, 0x20, 0x82, 0x0A, 0x83, 0x0D, 0x01, 0x1A, 0x5F,
+  0x83, 0x01, 0x0F, 0x14, 0x2B, 0xC1, 0x1D, 0x2B, 0x2F, 0x18, 0x1E, 0x04, 0x0D, 0x04, 0x0D, 0x1A,
+  0x0A, 0x0A, 0x57, 0x82, 0x01, 0x00, 0x53, 0x82, 0x0A, 0x01, 0x1A, 0x57, 0x85, 0x01, 0x0B, 0x9E,
+  0x55, 0x15, 0x71, 0x76, 0x14, 0x01, 0x01, 0x14, 0x71, 0x0E, 0x2F, 0x82, 0x01, 0x0B, 0x67, 0x0F,
+  0x5B, 0x16, 0x13, 0x40, 0x29, 0x40, 0x2B, 0x05, 0x05, 0x2F, 0x83, 0x01, 0x02, 0x04, 0x80, 0x7F,
+  0xA0, 0x00, 0x05, 0x51, 0x16, 0x34, 0x39, 0x8D, 0x20, 0x82, 0x01, 0x09, 0x9E, 0x15, 0x0C, 0x15,
+  0x0C, 0x43, 0x1D, 0x1D, 0x3F, 0x0B, 0x83, 0x01, 0x05, 0x1B, 0x0B, 0x0B, 0x1B, 0x72, 0x2F, 0x85,
+  0x01, 0x02, 0x33, 0x04, 0x0D, 0x82, 0x1A, 0x00, 0x9F, 0x82, 0x01, 0x01, 0x14, 0x0D, 0x83, 0x0A,
+  0x00, 0x5F, 0x84, 0x01, 0x04, 0x24, 0x0A, 0x54, 0x24, 0x0A, 0x82, 0x24, 0x00, 0x53, 0x83, 0x01,
+  0x0E, 0x20, 0x82, 0x48, 0x0F, 0x0F, 0x20, 0x14, 0x18, 0x18, 0x0D, 0x04, 0x1A, 0x0A, 0x0A, 0x3D,
+  0x83, 0x01, 0x00, 0x20, 0x84, 0x0A, 0x86, 0x01, 0x01, 0x14, 0x14, 0x84, 0x01, 0x03, 0x14, 0x0E,
+  0x15, 0x20, 0x82, 0x01, 0x12, 0x2F, 0x0F, 0x08, 0x08, 0x03, 0x0B, 0x0B, 0x1C, 0x16, 0x05, 0x05,
+  0x2B, 0x4E, 0x01, 0x20, 0x99, 0x8B, 0xB1, 0x8C, 0xA1, 0x00, 0x0C, 0xE8, 0x34, 0x6F, 0x36, 0xA2,
+  0x20, 0x01, 0x01, 0x5A, 0x0C, 0x0C, 0x15, 0x07, 0x82, 0x15, 0x01, 0x06, 0x2C, 0x82, 0x01, 0x07,
+  0x14, 0x5A, 0x21, 0x31, 0x0B, 0x72, 0x72, 0x20, 0x84, 0x01, 0x06, 0x2F, 0x18, 0x18, 0x04, 0x18,
+  0x04, 0x4D, 0x82, 0x01, 0x06, 0x14, 0x0D, 0x1A, 0x0D, 0x0A, 0x54, 0x3D, 0x85, 0x01, 0x06, 0x85,
+  0x85, 0x24, 0x85, 0x0D, 0x24, 0x57, 0x84, 0x01, 0x0D, 0x59, 0x18, 0x61, 0x16, 0x1D, 0x14, 0x01,
+  0x14, 0x59, 0x04, 0x04, 0x0D, 0x0A, 0x0A, 0x84, 0x01, 0x00, 0x20, 0x83, 0x1F, 0x01, 0x1A, 0x57,
+  0x8C, 0x01, 0x02, 0x4C, 0x15, 0x15, 0x83, 0x01, 0x11, 0x1B, 0x0F, 0x62, 0x08, 0x13, 0x0B, 0x1C,
+  0x40, 0x08, 0x05, 0x05, 0x11, 0x17, 0x79, 0xD4, 0x6F, 0x80, 0x66, 0xA2, 0x00, 0x08, 0x4B, 0x41,
+  0x34, 0x36, 0x74, 0x27, 0x40, 0x2F, 0x2C, 0x82, 0x0C, 0x10, 0x15, 0x15, 0x07, 0x15, 0x0C, 0x2A,
+  0x14, 0x01, 0x01, 0x14, 0x31, 0x0B, 0x03, 0x72, 0x0B, 0x29, 0x3E, 0x84, 0x01, 0x06, 0x9E, 0x17,
+  0xC4, 0x19, 0x32, 0x1E, 0x99, 0x82, 0x01, 0x07, 0x20, 0x24, 0x24, 0x0D, 0x24, 0x0D, 0x0D, 0x53,
+  0x85, 0x01, 0x03, 0x20, 0xA6, 0x4D, 0xA6, 0x85, 0x01, 0x06, 0x14, 0x18, 0x04, 0x04, 0x48, 0x16,
+  0x20, 0x82, 0x01, 0x03, 0x20, 0x4D, 0x4D, 0x5F, 0x85, 0x01, 0x06, 0x24, 0x1F, 0x77, 0x77, 0x1A,
+  0x04, 0x3E, 0x8C, 0x01, 0x02, 0x33, 0x15, 0x52, 0x83, 0x01, 0x11, 0x3F, 0x0F, 0x0F, 0x08, 0x2B,
+  0x13, 0x1C, 0x87, 0x2B, 0x05, 0x11, 0x11, 0x3B, 0x5C, 0x36, 0x35, 0x46, 0x4B, 0x9E, 0x00, 0x01,
+  0xED, 0xBA, 0x82, 0x00, 0x10, 0xC3, 0x81, 0x6F, 0x36, 0x7A, 0x37, 0x11, 0x7B, 0x26, 0x0C, 0x0C,
+  0x15, 0x0C, 0x07, 0x15, 0x15, 0x2C, 0x83, 0x01, 0x06, 0x09, 0x03, 0x03, 0x1B, 0x0B, 0x0B, 0x3E,
+  0x83, 0x01, 0x12, 0x14, 0x76, 0x72, 0x2F, 0xC4, 0x2F, 0x32, 0x59, 0x4E, 0x01, 0x01, 0x14, 0x24,
+  0x18, 0x0D, 0x1E, 0x0D, 0x0D, 0xA6, 0x8F, 0x01, 0x06, 0x3E, 0x18, 0x04, 0x04, 0x49, 0x16, 0x20,
+  0x8B, 0x01, 0x08, 0x14, 0x1F, 0x1F, 0x77, 0x0D, 0x1C, 0x52, 0x06, 0x14, 0x8B, 0x01, 0x02, 0x21,
+  0x15, 0x5D, 0x82, 0x01, 0x11, 0x14, 0x48, 0x0F, 0x05, 0x22, 0x08, 0x13, 0x29, 0x16, 0x13, 0x0F,
+  0x11, 0x3B, 0x7C, 0x74, 0x6F, 0xBD, 0x9A, 0xA4, 0x00, 0x0A, 0x4B, 0x41, 0x78, 0x39, 0x2D, 0x7C,
+  0x3B, 0x11, 0x05, 0x0C, 0x0C, 0x82, 0x15, 0x0D, 0x0C, 0x15, 0x0E, 0xE1, 0x01, 0x01, 0x14, 0x09,
+  0x03, 0x0B, 0x0B, 0x1B, 0x03, 0x2F, 0x83, 0x01, 0x07, 0x14, 0x2F, 0x0B, 0x1B, 0x0B, 0x1B, 0x1B,
+  0x59, 0x82, 0x01, 0x08, 0x14, 0x1E, 0x19, 0x18, 0x32, 0x24, 0x0D, 0x0D, 0x4E, 0x8D, 0x01, 0x07,
+  0x14, 0x18, 0x04, 0x18, 0x04, 0x49, 0x2B, 0x20, 0x8B, 0x01, 0x08, 0x4D, 0x0D, 0x0D, 0x47, 0x45,
+  0x0E, 0x06, 0x0E, 0x0B, 0x8A, 0x01, 0x03, 0x9E, 0x07, 0x15, 0x76, 0x82, 0x01, 0x11, 0x67, 0x0F,
+  0x05, 0x0F, 0x62, 0x89, 0x2A, 0x87, 0x16, 0x2C, 0x05, 0x11, 0x3B, 0x5C, 0x36, 0x78, 0x41, 0x4B,
+  0xA5, 0x00, 0x08, 0x66, 0x35, 0x2E, 0x36, 0x7C, 0x3B, 0x11, 0x11, 0x26, 0x83, 0x0C, 0x06, 0x07,
+  0x15, 0x0C, 0x0E, 0x21, 0x2F, 0x67, 0x82, 0x03, 0x82, 0x09, 0x00, 0x5A, 0x83, 0x01, 0x03, 0x33,
+  0x31, 0x1B, 0x0B, 0x82, 0x31, 0x00, 0x67, 0x82, 0x01, 0x00, 0x14, 0x82, 0x32, 0x04, 0x1E, 0x0D,
+  0x24, 0x0D, 0xA6, 0x8D, 0x01, 0x00, 0x3E, 0x82, 0x1E, 0x03, 0x32, 0x93, 0x49, 0x20, 0x8A, 0x01,
+  0x0A, 0x20, 0x0D, 0x04, 0x7D, 0x49, 0x0E, 0x06, 0x06, 0x0E, 0x0E, 0x2F, 0x88, 0x01, 0x18, 0x5A,
+  0x07, 0x15, 0x15, 0x55, 0x5A, 0x5A, 0x0E, 0x0C, 0x05, 0x0F, 0x05, 0x0F, 0x89, 0x08, 0x22, 0x84,
+  0xE5, 0x11, 0x11, 0x3C, 0x2D, 0x42, 0x8B, 0x9A, 0xA6, 0x00, 0x09, 0x4B, 0x46, 0x35, 0x39, 0x2D,
+  0x7C, 0x3B, 0x11, 0x26, 0x26, 0x82, 0x0C, 0x01, 0x15, 0x15, 0x82, 0x0C, 0x09, 0x06, 0x84, 0x16,
+  0x2B, 0x6C, 0x10, 0x09, 0x03, 0x03, 0x3E, 0x82, 0x01, 0x03, 0x9E, 0x21, 0x1B, 0x0B, 0x82, 0x21,
+  0x00, 0x67, 0x82, 0x01, 0x09, 0x14, 0x17, 0x32, 0x1E, 0x18, 0x18, 0x1E, 0x18, 0x18, 0x53, 0x8B,
+  0x01, 0x08, 0x33, 0x1B, 0x1B, 0x17, 0x4A, 0x32, 0x32, 0x04, 0x4D, 0x89, 0x01, 0x0D, 0x14, 0x32,
+  0x2B, 0x48, 0x43, 0x0E, 0x0E, 0x06, 0x0E, 0x06, 0x0E, 0x15, 0x31, 0x14, 0x84, 0x01, 0x06, 0x33,
+  0x03, 0x12, 0x0E, 0x07, 0x15, 0x07, 0x82, 0x15, 0x06, 0x06, 0x0F, 0x0F, 0x05, 0x0F, 0x37, 0x22,
+  0x82, 0x05, 0x06, 0x11, 0x3B, 0x2D, 0x36, 0x70, 0x46, 0x4B, 0xA7, 0x00, 0x09, 0x66, 0xD5, 0x2E,
+  0x36, 0x5C, 0x3B, 0x11, 0x11, 0x26, 0x26, 0x83, 0x0C, 0x09, 0x07, 0x0C, 0x0C, 0x06, 0x43, 0x0F,
+  0x08, 0x16, 0x13, 0x02, 0x82, 0x03, 0x0A, 0x09, 0x9E, 0x5A, 0x09, 0x03, 0x03, 0x21, 0x31, 0x21,
+  0x0B, 0x76, 0x82, 0x01, 0x0A, 0x4C, 0x1B, 0x1B, 0x4A, 0x19, 0x1E, 0x18, 0x18, 0x04, 0x18, 0x53,
+  0x89, 0x01, 0x0A, 0x4C, 0x76, 0x31, 0x0B, 0x0B, 0x2F, 0x19, 0x19, 0x1E, 0x04, 0x20, 0x87, 0x01,
+  0x14, 0x14, 0x76, 0x2C, 0x06, 0x06, 0x52, 0x06, 0x06, 0x0E, 0x0E, 0x15, 0x07, 0x07, 0x95, 0x12,
+  0x5A, 0x9E, 0x67, 0x9E, 0x65, 0x0E, 0x84, 0x07, 0x82, 0x15, 0x10, 0x0C, 0x0C, 0x05, 0x0F, 0x05,
+  0x22, 0x22, 0x62, 0x05, 0x05, 0x11, 0x6B, 0x3C, 0x2D, 0x88, 0x81, 0x66, 0xA8, 0x00, 0x08, 0x51,
+  0x1D, 0x35, 0x42, 0x2D, 0x3C, 0x6B, 0x7B, 0x26, 0x85, 0x0C, 0x01, 0x06, 0x0C, 0x82, 0x06, 0x20,
+  0x43, 0x0F, 0x2B, 0x13, 0x02, 0x09, 0x03, 0x02, 0x02, 0x03, 0x09, 0x03, 0x03, 0x09, 0x03, 0x09,
+  0x03, 0x09, 0x5A, 0x9E, 0x9E, 0x5A, 0x21, 0x0B, 0x1B, 0x1B, 0x2F, 0x32, 0x32, 0x1E, 0x18, 0x1E,
+  0x20, 0x87, 0x01, 0x0C, 0x33, 0x31, 0x0B, 0x03, 0x31, 0x0B, 0x17, 0x17, 0x19, 0x17, 0x19, 0x17,
+  0x59, 0x85, 0x01, 0x02, 0x33, 0x13, 0x06, 0x82, 0x0E, 0x00, 0x06, 0x82, 0x1D, 0x02, 0x49, 0x0E,
+  0x12, 0x82, 0x07, 0x00, 0x12, 0x8A, 0x07, 0x12, 0x15, 0x15, 0x0C, 0x06, 0x0F, 0x0F, 0x05, 0x22,
+  0x62, 0x11, 0x05, 0x11, 0x11, 0x3B, 0x7A, 0x36, 0x30, 0x1D, 0x8C, 0xA9, 0x00, 0x08, 0x50, 0xAB,
+  0x35, 0x36, 0x3C, 0x3B, 0x11, 0x11, 0x7E, 0x85, 0x0C, 0x09, 0x06, 0x0C, 0x06, 0x43, 0x05, 0x0F,
+  0x0F, 0x2B, 0x02, 0x09, 0x82, 0x02, 0x02, 0x03, 0x09, 0x03, 0x82, 0x09, 0x03, 0x03, 0x09, 0x03,
+  0x03, 0x83, 0x09, 0x02, 0x03, 0x5A, 0x21, 0x82, 0x0B, 0x01, 0x2F, 0x4A, 0x82, 0x1B, 0x0B, 0x3E,
+  0x20, 0x20, 0x14, 0x14, 0x3E, 0x76, 0x31, 0x03, 0x09, 0x31, 0x72, 0x82, 0x1B, 0x1C, 0x17, 0x19,
+  0x19, 0x32, 0x19, 0x4F, 0x2F, 0x67, 0x3E, 0x2F, 0x13, 0x52, 0x0E, 0x06, 0x0E, 0x06, 0x1D, 0x48,
+  0x0F, 0x0F, 0x16, 0x0E, 0x0E, 0x12, 0x12, 0x07, 0x12, 0x15, 0x12, 0x84, 0x07, 0x16, 0x15, 0x07,
+  0x15, 0x07, 0x15, 0x07, 0x15, 0x0C, 0x38, 0x0F, 0x05, 0x11, 0x62, 0x05, 0x11, 0x05, 0x11, 0x3B,
+  0x3C, 0x36, 0x35, 0xB5, 0x7F, 0xAA, 0x00, 0x0A, 0x51, 0x95, 0xA9, 0x2E, 0x2D, 0x3C, 0x3B, 0x11,
+  0x05, 0x05, 0x26, 0x84, 0x0C, 0x06, 0x06, 0x05, 0x43, 0x43, 0x0F, 0x16, 0x1D, 0x83, 0x02, 0x01,
+  0x03, 0x03, 0x87, 0x09, 0x03, 0x03, 0x09, 0x09, 0x02, 0x82, 0x09, 0x01, 0x03, 0x5A, 0x84, 0x0B,
+  0x01, 0x31, 0x76, 0x83, 0x31, 0x82, 0x0B, 0x82, 0x09, 0x01, 0x31, 0x0B, 0x82, 0x1B, 0x1B, 0x4A,
+  0x19, 0x1E, 0x4A, 0x17, 0x49, 0x0F, 0x0F, 0x2C, 0x0E, 0x52, 0x1D, 0x1D, 0x48, 0x16, 0x49, 0x83,
+  0x46, 0x1D, 0x06, 0x07, 0x12, 0x07, 0x12, 0x12, 0x15, 0x15, 0x12, 0x89, 0x07, 0x11, 0x15, 0x15,
+  0x07, 0x0C, 0x05, 0x0F, 0x05, 0x62, 0x05, 0x11, 0x05, 0x11, 0x11, 0x3C, 0x73, 0x6F, 0x70, 0x71,
+  0xAC, 0x00, 0x23, 0x90, 0x16, 0x35, 0x39, 0x2D, 0x3C, 0x11, 0x11, 0x05, 0x05, 0x06, 0x0C, 0x15,
+  0x15, 0x0C, 0x0C, 0x06, 0x06, 0x05, 0x62, 0x16, 0x10, 0x02, 0x02, 0x69, 0x25, 0x25, 0x02, 0x65,
+  0x02, 0x09, 0x23, 0x09, 0x02, 0x09, 0x02, 0x85, 0x09, 0x09, 0x03, 0x03, 0x09, 0x21, 0x21, 0x31,
+  0x0B, 0x09, 0x21, 0x03, 0x82, 0x21, 0x03, 0x31, 0x21, 0x21, 0x5A, 0x82, 0x09, 0x1A, 0x21, 0x31,
+  0x31, 0x0B, 0x0B, 0x2F, 0x1E, 0x19, 0x1E, 0xBF, 0x04, 0x49, 0x0F, 0x0F, 0x87, 0x87, 0xBB, 0x9D,
+  0x04, 0x0D, 0x0D, 0x47, 0x49, 0x0E, 0x12, 0x07, 0x07, 0x83, 0x12, 0x03, 0x07, 0x0E, 0x15, 0x15,
+  0x87, 0x07, 0x07, 0x0C, 0x07, 0x0C, 0x0C, 0x05, 0x0F, 0x05, 0x11, 0x82, 0x05, 0x06, 0x11, 0x3C,
+  0x73, 0x39, 0x30, 0x46, 0x90, 0xAD, 0x00, 0x17, 0x7F, 0x58, 0x34, 0x91, 0x2D, 0x3B, 0x11, 0x11,
+  0x38, 0x05, 0x0C, 0x0C, 0x07, 0x07, 0x0C, 0x06, 0x06, 0x05, 0x22, 0x48, 0x65, 0x69, 0x02, 0x69,
+  0x84, 0x02, 0x03, 0x69, 0x09, 0x09, 0x02, 0x83, 0x09, 0x04, 0x02, 0x02, 0x09, 0x09, 0x03, 0x82,
+  0x09, 0x16, 0x03, 0x03, 0x1B, 0x31, 0x21, 0x03, 0x09, 0x21, 0x03, 0x31, 0x03, 0x03, 0x09, 0x03,
+  0x09, 0x03, 0x03, 0x21, 0x0B, 0x2F, 0x1B, 0x1B, 0x19, 0x82, 0x04, 0x03, 0x0D, 0x04, 0x61, 0x04,
+  0x82, 0x0D, 0x00, 0x0A, 0x82, 0x1A, 0x01, 0x04, 0x1D, 0x85, 0x12, 0x01, 0x07, 0x07, 0x82, 0x0E,
+  0x82, 0x15, 0x84, 0x07, 0x11, 0x15, 0x07, 0x0C, 0x0C, 0x06, 0x05, 0x05, 0x22, 0x05, 0x05, 0x7E,
+  0x11, 0x3B, 0x7A, 0x36, 0x34, 0x58, 0x66, 0xAF, 0x00, 0x26, 0x71, 0x30, 0x2E, 0x36, 0x2D, 0x11,
+  0x7E, 0x26, 0x0C, 0x0C, 0x15, 0x0C, 0x15, 0x07, 0x0C, 0x0C, 0x06, 0x84, 0x3F, 0x02, 0x10, 0x02,
+  0x25, 0x02, 0x02, 0x69, 0x02, 0x02, 0x69, 0x02, 0x02, 0x09, 0x03, 0x09, 0x09, 0x03, 0x02, 0x09,
+  0x02, 0x86, 0x09, 0x09, 0x03, 0x03, 0x5A, 0x09, 0x09, 0x21, 0x31, 0x21, 0x03, 0x03, 0x82, 0x09,
+  0x0B, 0x03, 0x03, 0x31, 0x0B, 0x0B, 0x1B, 0x17, 0x40, 0x2F, 0x17, 0x32, 0xBF, 0x84, 0x0D, 0x05,
+  0x1A, 0x1A, 0x0D, 0x0D, 0x47, 0x1C, 0x85, 0x12, 0x09, 0x07, 0x12, 0x15, 0x0E, 0x0E, 0x15, 0x0E,
+  0x06, 0x15, 0x15, 0x83, 0x07, 0x10, 0x0C, 0x06, 0x0C, 0x0C, 0x06, 0x05, 0x0F, 0x11, 0x05, 0x26,
+  0x11, 0x6B, 0xC7, 0x36, 0x6F, 0x35, 0x95, 0xB0, 0x00, 0x07, 0x4B, 0x16, 0x34, 0x42, 0x74, 0x7C,
+  0x11, 0x26, 0x82, 0x0C, 0x01, 0x15, 0x15, 0x82, 0x0C, 0x07, 0x06, 0x05, 0x84, 0x02, 0x69, 0x10,
+  0x02, 0x5E, 0x86, 0x02, 0x04, 0x09, 0x03, 0x09, 0x03, 0x09, 0x83, 0x02, 0x84, 0x09, 0x05, 0x5A,
+  0x03, 0x5A, 0x03, 0x03, 0x5A, 0x84, 0x03, 0x18, 0x09, 0x02, 0x02, 0x03, 0x03, 0x0B, 0x1B, 0x29,
+  0x72, 0x0B, 0x0B, 0x1B, 0x2F, 0x1E, 0x1E, 0x18, 0x1E, 0x1E, 0xD9, 0x0D, 0x0A, 0x1A, 0x1A, 0x0D,
+  0x4F, 0x82, 0x12, 0x00, 0x9A, 0x83, 0x12, 0x05, 0x07, 0x07, 0x15, 0x0C, 0x06, 0x06, 0x83, 0x15,
+  0x03, 0x07, 0x0C, 0x06, 0x06, 0x82, 0x0C, 0x0C, 0x38, 0x05, 0x11, 0x05, 0x05, 0x7B, 0x11, 0x3C,
+  0x73, 0x39, 0x34, 0x16, 0x51, 0x9A, 0x00, 0x00, 0xD3, 0x95, 0x00, 0x07, 0x50, 0xA2, 0x34, 0x42,
+  0x74, 0x3C, 0x11, 0x26, 0x82, 0x0C, 0x00, 0x15, 0x82, 0x0C, 0x07, 0x06, 0x06, 0x22, 0x2C, 0x25,
+  0x02, 0x69, 0x25, 0x83, 0x02, 0x00, 0x69, 0x85, 0x02, 0x00, 0x69, 0x85, 0x02, 0x03, 0x09, 0x02,
+  0x09, 0x09, 0x82, 0x03, 0x1F, 0x5A, 0x09, 0x5A, 0x03, 0x31, 0x03, 0x09, 0x09, 0x02, 0x23, 0x09,
+  0x03, 0x0B, 0x72, 0x0B, 0x0B, 0x1B, 0x0B, 0x97, 0x1E, 0x1E, 0x04, 0x1E, 0xD9, 0x1E, 0x59, 0x1E,
+  0x1E, 0x24, 0x0D, 0x61, 0x55, 0x85, 0x12, 0x0B, 0x9A, 0x12, 0x07, 0x07, 0x15, 0x06, 0x0E, 0x06,
+  0x0C, 0x06, 0x15, 0x15, 0x85, 0x06, 0x0C, 0x0C, 0x38, 0x22, 0x05, 0x05, 0x7B, 0x11, 0x3C, 0x2D,
+  0x39, 0x34, 0x64, 0x50, 0xB3, 0x00, 0x06, 0x66, 0xB6, 0x2E, 0x39, 0x7A, 0x3B, 0x7E, 0x87, 0x0C,
+  0x03, 0x06, 0x06, 0x16, 0x10, 0x83, 0x02, 0x00, 0x03, 0x89, 0x02, 0x02, 0x25, 0x69, 0x6A, 0x82,
+  0x02, 0x05, 0x09, 0x02, 0x09, 0x23, 0x09, 0x09, 0x83, 0x03, 0x03, 0x0B, 0x1B, 0x03, 0x31, 0x82,
+  0x09, 0x07, 0x03, 0x31, 0x0B, 0x21, 0x03, 0x21, 0x0B, 0x1B, 0x84, 0x1E, 0x07, 0x4A, 0x1E, 0x1E,
+  0xD9, 0x24, 0x04, 0x04, 0x1D, 0x89, 0x12, 0x04, 0x07, 0x15, 0x07, 0x15, 0x0E, 0x82, 0x06, 0x07,
+  0x0E, 0x06, 0x05, 0x06, 0x06, 0x0C, 0x0C, 0x38, 0x82, 0x05, 0x07, 0x11, 0x11, 0x3B, 0x7A, 0x36,
+  0x2E, 0x58, 0xF6, 0x8A, 0x00, 0x00, 0xBA, 0xA8, 0x00, 0x08, 0x51, 0x95, 0x80, 0x2E, 0x36, 0x7A,
+  0x6B, 0x7E, 0x26, 0x84, 0x0C, 0x0B, 0x26, 0x06, 0x05, 0x05, 0x84, 0x03, 0x02, 0x69, 0x03, 0x0B,
+  0x03, 0x09, 0x8A, 0x02, 0x06, 0x5E, 0x25, 0x69, 0x02, 0x02, 0x09, 0x02, 0x83, 0x09, 0x1E, 0x03,
+  0x21, 0x0B, 0x31, 0x0B, 0x1B, 0x31, 0x0B, 0x5A, 0x03, 0x31, 0x03, 0x09, 0x03, 0x5D, 0x0B, 0x1B,
+  0x1E, 0x0D, 0x0D, 0x1E, 0x1E, 0x59, 0x1E, 0xD9, 0x0D, 0x0D, 0x04, 0x48, 0x12, 0xE6, 0x86, 0x12,
+  0x84, 0x07, 0x04, 0x15, 0x15, 0x0C, 0x0C, 0x15, 0x83, 0x06, 0x0E, 0x0C, 0x26, 0x06, 0x38, 0x11,
+  0x38, 0x7B, 0x7B, 0xCE, 0x7A, 0x36, 0x2E, 0x81, 0x95, 0x51, 0xB5, 0x00, 0x06, 0x8C, 0x0E, 0x34,
+  0x6F, 0x36, 0x3C, 0x6B, 0x83, 0x26, 0x83, 0x0C, 0x05, 0x38, 0x05, 0x22, 0x16, 0x65, 0x10, 0x83,
+  0x03, 0x11, 0x09, 0x02, 0x02, 0x69, 0x25, 0x02, 0x5E, 0x25, 0x69, 0x02, 0x02, 0x5E, 0xCA, 0x25,
+  0x5E, 0x02, 0x5E, 0x02, 0x83, 0x09, 0x1C, 0x03, 0x03, 0x09, 0x0B, 0x1B, 0x1B, 0x72, 0x17, 0x29,
+  0x1B, 0x0B, 0x0B, 0x21, 0x0B, 0x1B, 0x1B, 0x17, 0x4A, 0x1E, 0x18, 0x04, 0x1E, 0x1E, 0xD9, 0x1E,
+  0x0D, 0x04, 0x49, 0x0E, 0x87, 0x12, 0x01, 0x07, 0x12, 0x84, 0x07, 0x02, 0x0C, 0x0E, 0x07, 0x82,
+  0x06, 0x04, 0x05, 0x06, 0x06, 0x38, 0x38, 0x84, 0x11, 0x05, 0x3C, 0x73, 0x6F, 0x35, 0x2C, 0x8C,
+  0x95, 0x00, 0x00, 0xBA, 0xA0, 0x00, 0x07, 0x4B, 0x48, 0x78, 0x42, 0x74, 0x3C, 0xCE, 0x7E, 0x82,
+  0x26, 0x07, 0x0C, 0x0C, 0x26, 0x06, 0x06, 0x22, 0x08, 0x13, 0x86, 0x03, 0x82, 0x02, 0x04, 0x25,
+  0x69, 0x02, 0x25, 0x5E, 0x83, 0x02, 0x01, 0x69, 0x25, 0x83, 0x02, 0x11, 0x09, 0x03, 0x03, 0x21,
+  0x03, 0x03, 0x0B, 0x17, 0x19, 0x17, 0x32, 0x17, 0x1B, 0x17, 0x0B, 0x76, 0x1C, 0x2F, 0x82, 0x1E,
+  0x00, 0x24, 0x84, 0x1E, 0x0E, 0xBF, 0x49, 0x06, 0x0E, 0x12, 0x12, 0xA7, 0x12, 0xA7, 0x12, 0x12,
+  0x07, 0x12, 0x07, 0x12, 0x82, 0x07, 0x02, 0x15, 0x15, 0x07, 0x82, 0x06, 0x0F, 0x38, 0x06, 0x05,
+  0x05, 0x38, 0x05, 0x11, 0x05, 0x11, 0x6B, 0x3C, 0x73, 0x2E, 0x70, 0x2B, 0x4B, 0xB9, 0x00, 0x24,
+  0x50, 0x87, 0x30, 0x39, 0x74, 0x3C, 0xCE, 0x7B, 0x26, 0x26, 0x0C, 0x26, 0x0C, 0x0C, 0x38, 0x05,
+  0x5B, 0x16, 0x13, 0x03, 0x0B, 0x03, 0x13, 0x03, 0x03, 0x10, 0x02, 0x5E, 0x02, 0x69, 0x5E, 0x02,
+  0x69, 0x5E, 0x25, 0x02, 0x5E, 0x82, 0x25, 0x04, 0x5E, 0x25, 0x69, 0x09, 0x09, 0x82, 0x03, 0x11,
+  0x21, 0x1B, 0x72, 0x04, 0x19, 0x17, 0x1E, 0x17, 0x97, 0x97, 0x40, 0x97, 0x4A, 0x1E, 0x1E, 0x4A,
+  0x97, 0x40, 0x82, 0x1E, 0x05, 0x19, 0x2C, 0x0E, 0x0E, 0x07, 0x07, 0x86, 0x12, 0x87, 0x07, 0x03,
+  0x15, 0x0C, 0x0C, 0x06, 0x82, 0x05, 0x0B, 0x26, 0x05, 0x22, 0x11, 0x11, 0x6B, 0x3C, 0x2D, 0x39,
+  0x30, 0x41, 0x4B, 0xBB, 0x00, 0x11, 0x50, 0x41, 0x30, 0x39, 0x2D, 0x3B, 0x6B, 0x7B, 0x26, 0x26,
+  0x0C, 0x26, 0x26, 0x0C, 0x05, 0x22, 0x27, 0x3F, 0x82, 0x03, 0x00, 0x31, 0x82, 0x03, 0x13, 0x09,
+  0x02, 0x02, 0x25, 0x02, 0x69, 0x25, 0x25, 0x02, 0x69, 0x25, 0x69, 0x25, 0x6A, 0x6A, 0x02, 0x02,
+  0x09, 0x03, 0x09, 0x82, 0x03, 0x07, 0x31, 0x0B, 0x19, 0x1E, 0x1B, 0x04, 0x32, 0x17, 0x83, 0x4A,
+  0x09, 0x97, 0x32, 0x2F, 0x97, 0x1B, 0x4A, 0x4F, 0x49, 0x0E, 0x0E, 0x82, 0x07, 0x05, 0x12, 0x12,
+  0x07, 0x12, 0x07, 0x12, 0x85, 0x07, 0x00, 0x15, 0x82, 0x07, 0x03, 0x0C, 0x15, 0x0C, 0x0C, 0x83,
+  0x05, 0x09, 0xCF, 0x3B, 0x11, 0x6B, 0x3C, 0x7A, 0x42, 0x30, 0x41, 0x50, 0xBD, 0x00, 0x08, 0x7F,
+  0x41, 0x30, 0x39, 0x7A, 0x3C, 0x6B, 0xCE, 0x7B, 0x83, 0x26, 0x05, 0x05, 0x62, 0x22, 0xB1, 0x03,
+  0x13, 0x86, 0x03, 0x06, 0x10, 0x02, 0x69, 0x02, 0x25, 0x69, 0x02, 0x85, 0x25, 0x0F, 0x02, 0x09,
+  0x03, 0x09, 0x03, 0x09, 0x03, 0x21, 0x03, 0x21, 0x0B, 0x1B, 0x17, 0x32, 0x1E, 0x04, 0x82, 0x1E,
+  0x08, 0xC2, 0x17, 0xC2, 0x1B, 0x1B, 0x40, 0x49, 0x52, 0x0E, 0x83, 0x07, 0x05, 0x12, 0x12, 0xA7,
+  0x07, 0x07, 0x12, 0x84, 0x07, 0x01, 0x0C, 0x15, 0x85, 0x0C, 0x0E, 0x26, 0x05, 0x05, 0x11, 0x05,
+  0x11, 0x22, 0x11, 0x3B, 0x3C, 0x7A, 0x39, 0x30, 0xA2, 0x7F, 0xBF, 0x00, 0x13, 0x50, 0x64, 0x70,
+  0x39, 0x7A, 0x3C, 0x6B, 0x7B, 0x7B, 0x26, 0x7E, 0x05, 0x05, 0x11, 0x37, 0x27, 0x0B, 0x03, 0x03,
+  0x13, 0x84, 0x03, 0x01, 0x02, 0x09, 0x87, 0x02, 0x02, 0x25, 0x25, 0x02, 0x83, 0x03, 0x00, 0x10,
+  0x82, 0x02, 0x12, 0x0B, 0x21, 0x21, 0x0B, 0x40, 0x17, 0x4A, 0x18, 0x04, 0x1E, 0x32, 0x17, 0x17,
+  0x0B, 0x0B, 0x2A, 0x43, 0x0E, 0x0E, 0x84, 0x07, 0x00, 0x12, 0x88, 0x07, 0x03, 0x0C, 0x15, 0x0C,
+  0x15, 0x83, 0x0C, 0x00, 0x38, 0x83, 0x05, 0x09, 0x37, 0x37, 0x6B, 0x3B, 0x3C, 0x7A, 0x42, 0x30,
+  0x41, 0x7F, 0xC1, 0x00, 0x09, 0x7F, 0x46, 0x70, 0x39, 0x7A, 0x7A, 0x3C, 0x6B, 0x7B, 0x7E, 0x82,
+  0x05, 0x0B, 0x22, 0x27, 0x1C, 0x03, 0x13, 0x13, 0x03, 0x0B, 0x03, 0x03, 0x0B, 0x03, 0x82, 0x02,
+  0x10, 0x69, 0x02, 0x03, 0x03, 0x02, 0x69, 0x02, 0x25, 0x03, 0x03, 0x31, 0x5D, 0x03, 0x02, 0x25,
+  0x25, 0x10, 0x82, 0x03, 0x0E, 0x21, 0x21, 0x0B, 0x29, 0x1E, 0x1E, 0x19, 0x17, 0x40, 0x1C, 0x3F,
+  0x52, 0x06, 0x0E, 0x15, 0x84, 0x07, 0x00, 0x12, 0x87, 0x07, 0x00, 0x15, 0x83, 0x0C, 0x00, 0x06,
+  0x82, 0x0C, 0x00, 0x38, 0x82, 0x05, 0x0A, 0x11, 0x11, 0x7C, 0x37, 0x3B, 0x3C, 0x73, 0x42, 0x70,
+  0x41, 0xB4, 0xC3, 0x00, 0x07, 0x50, 0x87, 0x35, 0x42, 0x73, 0xC7, 0x3C, 0x6B, 0x83, 0x11, 0x07,
+  0x37, 0x5B, 0x46, 0x3F, 0x0B, 0x13, 0x6C, 0x0B, 0x8B, 0x03, 0x05, 0x02, 0x03, 0x02, 0x65, 0x03,
+  0x13, 0x82, 0x03, 0x12, 0x55, 0x65, 0x5D, 0x0B, 0x1B, 0x40, 0x40, 0x0B, 0x97, 0x1B, 0x19, 0x19,
+  0x1B, 0x5D, 0x2A, 0x1D, 0x06, 0x06, 0x15, 0x8B, 0x07, 0x01, 0x15, 0x15, 0x85, 0x0C, 0x12, 0x06,
+  0x06, 0x38, 0x26, 0x38, 0x38, 0x05, 0x05, 0x11, 0x11, 0x7C, 0x37, 0x3B, 0xC7, 0x73, 0x2E, 0x30,
+  0x16, 0x50, 0xAD, 0x00, 0x00, 0xBA, 0x96, 0x00, 0x10, 0x4B, 0x1D, 0xBD, 0x2E, 0x36, 0x7A, 0x3C,
+  0x3B, 0xCE, 0x11, 0x11, 0x37, 0xB3, 0xC5, 0x1C, 0x3F, 0x13, 0x82, 0x03, 0x00, 0x13, 0x84, 0x03,
+  0x00, 0x5D, 0x87, 0x03, 0x00, 0x10, 0x82, 0x03, 0x14, 0x0B, 0x29, 0x29, 0x40, 0x0B, 0x29, 0x29,
+  0x17, 0x17, 0x1B, 0x29, 0x19, 0x40, 0x48, 0x2C, 0x06, 0x06, 0x0E, 0x0E, 0x15, 0x15, 0x88, 0x07,
+  0x0A, 0x0C, 0x15, 0x06, 0x05, 0x0F, 0x05, 0x06, 0x06, 0x0C, 0x06, 0x38, 0x84, 0x05, 0x82, 0x11,
+  0x08, 0x3B, 0x7C, 0x3C, 0x2D, 0x36, 0x88, 0x30, 0x2C, 0x90, 0xAE, 0x00, 0x00, 0xBA, 0x97, 0x00,
+  0x16, 0x4B, 0x71, 0x80, 0x34, 0x39, 0x74, 0x2D, 0x3C, 0x3B, 0x3B, 0x63, 0xA0, 0xC5, 0x45, 0x40,
+  0x29, 0x1C, 0x6C, 0x13, 0x03, 0x13, 0x0B, 0x13, 0x82, 0x03, 0x02, 0x0B, 0x31, 0x5D, 0x84, 0x03,
+  0x11, 0xBC, 0x13, 0x03, 0x03, 0x0B, 0x1B, 0x29, 0x17, 0x29, 0x0B, 0x0B, 0x1B, 0x40, 0x40, 0x17,
+  0x29, 0x16, 0x16, 0x83, 0x06, 0x01, 0x15, 0x15, 0x88, 0x07, 0x03, 0x15, 0x0C, 0x06, 0x05, 0x82,
+  0x08, 0x14, 0x62, 0x05, 0x38, 0x38, 0x05, 0x05, 0x38, 0x11, 0x05, 0x11, 0x05, 0x11, 0x37, 0x3C,
+  0x2D, 0x2D, 0x39, 0x34, 0x81, 0x71, 0x4B, 0xC9, 0x00, 0x14, 0x51, 0x66, 0xAF, 0x35, 0x2E, 0x91,
+  0x74, 0x2D, 0x5C, 0x8F, 0xB7, 0x96, 0x45, 0xC5, 0x1C, 0x1C, 0x13, 0x6C, 0x03, 0x13, 0x13, 0x82,
+  0x03, 0x01, 0x13, 0x0B, 0x86, 0x03, 0x04, 0xBC, 0x65, 0x03, 0x03, 0x13, 0x82, 0x0B, 0x02, 0x1B,
+  0x29, 0x17, 0x82, 0x0B, 0x07, 0x1C, 0x1D, 0x0F, 0x0F, 0x06, 0x06, 0x0E, 0x07, 0x84, 0x15, 0x01,
+  0x07, 0x0C, 0x82, 0x07, 0x02, 0x0C, 0x0C, 0x05, 0x82, 0x06, 0x05, 0x05, 0x0F, 0x22, 0x22, 0x11,
+  0x05, 0x82, 0x11, 0x0C, 0x05, 0x11, 0x11, 0x3B, 0x3B, 0x7C, 0x2D, 0x36, 0x42, 0x34, 0xAF, 0xE6,
+  0x51, 0xCB, 0x00, 0x11, 0x51, 0x7F, 0x41, 0x88, 0x88, 0x39, 0x73, 0x2D, 0x36, 0xB6, 0x86, 0x83,
+  0x61, 0x82, 0x40, 0x1C, 0x3F, 0x3F, 0x82, 0x13, 0x00, 0x6C, 0x82, 0x03, 0x00, 0x13, 0x86, 0x03,
+  0x01, 0x55, 0x0B, 0x82, 0x03, 0x1F, 0x21, 0x0B, 0x29, 0x4F, 0x17, 0x0B, 0x03, 0x13, 0x2A, 0x0F,
+  0x0F, 0x05, 0x06, 0x06, 0x0C, 0x15, 0x15, 0x0C, 0x07, 0x07, 0x0C, 0x15, 0x07, 0x0C, 0x0C, 0x15,
+  0x15, 0x0C, 0x06, 0x06, 0x38, 0x43, 0x82, 0x05, 0x01, 0x22, 0x27, 0x82, 0x37, 0x82, 0x11, 0x08,
+  0x3B, 0x37, 0x2D, 0x73, 0x39, 0x2E, 0x34, 0x41, 0x7F, 0xCF, 0x00, 0x16, 0xB4, 0x52, 0xB0, 0x88,
+  0x39, 0x36, 0x73, 0x91, 0xEF, 0x86, 0x86, 0x92, 0x83, 0x45, 0x45, 0x1C, 0x3F, 0x13, 0x0B, 0x6C,
+  0x13, 0x03, 0x13, 0x82, 0x03, 0x00, 0x6C, 0x85, 0x03, 0x13, 0x29, 0x29, 0x03, 0x03, 0x0B, 0x0B,
+  0x40, 0x13, 0x03, 0x0B, 0x03, 0x2A, 0x16, 0x0F, 0x05, 0x06, 0x06, 0x0C, 0x0C, 0x15, 0x82, 0x0C,
+  0x00, 0x15, 0x86, 0x0C, 0x02, 0x06, 0x38, 0x06, 0x82, 0x05, 0x10, 0x11, 0x5B, 0x8A, 0xD2, 0x27,
+  0x22, 0x11, 0x37, 0x37, 0x5C, 0x2D, 0x36, 0x42, 0x88, 0xB6, 0x52, 0x90, 0xD1, 0x00, 0x0F, 0x8C,
+  0x25, 0x64, 0x35, 0x42, 0x36, 0x36, 0x91, 0x2E, 0xB7, 0x92, 0xC9, 0x83, 0x61, 0x61, 0x45, 0x83,
+  0x1C, 0x03, 0x13, 0x13, 0x03, 0x3F, 0x82, 0x13, 0x05, 0x03, 0x13, 0x13, 0x03, 0x13, 0x03, 0x82,
+  0x0B, 0x00, 0x29, 0x85, 0x03, 0x03, 0x13, 0x1D, 0x05, 0x43, 0x83, 0x06, 0x21, 0x0C, 0x0C, 0x06,
+  0x05, 0x0C, 0x0C, 0x15, 0x0C, 0x05, 0x06, 0x0C, 0x15, 0x0C, 0x06, 0x38, 0x05, 0x38, 0x05, 0x11,
+  0x11, 0x27, 0x7C, 0xCF, 0x3B, 0x37, 0x5C, 0x2D, 0x74, 0x39, 0x2E, 0x30, 0x64, 0x9A, 0x51, 0xD4,
+  0x00, 0x0F, 0x50, 0x1D, 0xB5, 0x88, 0x42, 0x36, 0x39, 0x88, 0xCB, 0x86, 0x83, 0x7D, 0x61, 0x61,
+  0x45, 0x45, 0x82, 0x1C, 0x05, 0x13, 0x3F, 0x13, 0x13, 0x03, 0x6C, 0x82, 0x13, 0x13, 0x03, 0x0B,
+  0x13, 0x6C, 0x13, 0x65, 0x6E, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x1D, 0x05, 0x05, 0x43,
+  0x0C, 0x06, 0x83, 0x0C, 0x00, 0x06, 0x82, 0x0C, 0x02, 0x62, 0x05, 0x06, 0x82, 0x0C, 0x12, 0x26,
+  0x06, 0x26, 0x38, 0x05, 0x11, 0x37, 0x37, 0x3B, 0x3C, 0x5C, 0x2D, 0x74, 0x39, 0x6F, 0x78, 0x81,
+  0x1D, 0x50, 0xD7, 0x00, 0x0E, 0x8C, 0x66, 0xD1, 0x88, 0x2E, 0x39, 0x42, 0x35, 0x70, 0x86, 0xB5,
+  0x92, 0x96, 0x7D, 0x61, 0x82, 0x45, 0x3C, 0x29, 0x1C, 0x1C, 0x3F, 0x13, 0x1C, 0x6C, 0x13, 0x6C,
+  0x1C, 0x03, 0x0B, 0x0B, 0x1C, 0x65, 0x6E, 0x3F, 0x03, 0x13, 0x13, 0x6C, 0x13, 0x2A, 0x1D, 0x05,
+  0x0F, 0x05, 0x05, 0x06, 0x38, 0x38, 0x06, 0x06, 0x0C, 0x0C, 0x06, 0x06, 0x05, 0x0C, 0x06, 0x26,
+  0x0C, 0x26, 0x38, 0x26, 0x05, 0x11, 0x37, 0xA8, 0x5C, 0x37, 0x5C, 0x2D, 0x2D, 0x36, 0x42, 0x35,
+  0x30, 0xB9, 0x66, 0x51, 0xDA, 0x00, 0x14, 0xB4, 0x95, 0x64, 0x88, 0x2E, 0x2E, 0x35, 0x70, 0x8B,
+  0x86, 0x86, 0x92, 0xEE, 0x7D, 0x61, 0xC5, 0x45, 0x45, 0x29, 0x45, 0x29, 0x83, 0x1C, 0x0F, 0x6C,
+  0x1C, 0x1C, 0x0B, 0x1C, 0x65, 0x6E, 0x03, 0x13, 0x6C, 0x6C, 0x0B, 0x03, 0x13, 0x1D, 0x0F, 0x87,
+  0x05, 0x04, 0x22, 0x22, 0x16, 0x05, 0x38, 0x82, 0x26, 0x06, 0x7E, 0x7E, 0x05, 0x11, 0x11, 0x7C,
+  0x8A, 0x82, 0x2D, 0x07, 0x74, 0x36, 0x39, 0x78, 0x30, 0xDA, 0x95, 0x90, 0xDE, 0x00, 0x0C, 0x50,
+  0x0E, 0x58, 0x34, 0x34, 0x35, 0xCB, 0xA9, 0xD8, 0x8B, 0xB7, 0x86, 0x83, 0x82, 0x7D, 0x0A, 0xC5,
+  0x45, 0x46, 0x45, 0x45, 0x29, 0x29, 0x40, 0x1C, 0x1C, 0x0B, 0x82, 0x1C, 0x08, 0x3F, 0x6C, 0x6C,
+  0x3F, 0x0B, 0x3F, 0x6C, 0x1D, 0x0F, 0x85, 0x05, 0x04, 0x11, 0x22, 0x2B, 0x2A, 0x3F, 0x83, 0x05,
+  0x10, 0x11, 0x05, 0x11, 0x11, 0x6B, 0x5C, 0x2D, 0x2D, 0x73, 0x36, 0x36, 0x42, 0x2E, 0x70, 0xA0,
+  0x2C, 0x7F, 0xE1, 0x00, 0x12, 0x51, 0x7F, 0x52, 0x58, 0x78, 0x30, 0x70, 0xC0, 0xCB, 0xCB, 0x8B,
+  0x8B, 0x86, 0x92, 0x92, 0x96, 0x7D, 0x61, 0x61, 0x82, 0x82, 0x00, 0x79, 0x82, 0x45, 0x18, 0x1C,
+  0x29, 0x1C, 0x3F, 0x6C, 0x1C, 0x6C, 0x3F, 0x1C, 0x2B, 0x84, 0x62, 0x11, 0x11, 0x62, 0x62, 0x22,
+  0x08, 0x46, 0x45, 0x49, 0x2A, 0x0F, 0x05, 0x05, 0x83, 0x11, 0x02, 0x6B, 0x7C, 0x5C, 0x82, 0x2D,
+  0x07, 0x36, 0x39, 0x35, 0x30, 0x58, 0x2C, 0x7F, 0x51, 0xE4, 0x00, 0x0F, 0x51, 0x7F, 0x52, 0xAF,
+  0x30, 0xA4, 0xD0, 0xCD, 0xCD, 0x70, 0x70, 0x8B, 0x81, 0x86, 0x96, 0x83, 0x82, 0x7D, 0x82, 0x61,
+  0x00, 0x82, 0x83, 0x1C, 0x25, 0x3F, 0x46, 0x2B, 0x89, 0x16, 0x22, 0x37, 0x22, 0x37, 0x5B, 0x8A,
+  0x63, 0x41, 0x82, 0xBB, 0x45, 0x79, 0x16, 0x22, 0x11, 0x7B, 0x11, 0x11, 0xCE, 0x6B, 0x3C, 0x3C,
+  0x2D, 0x2D, 0x73, 0x36, 0x42, 0x34, 0xA9, 0x58, 0x1D, 0x50, 0x51, 0xE9, 0x00, 0x0C, 0x50, 0xC3,
+  0x41, 0xA9, 0xC0, 0xD0, 0xD0, 0x70, 0xA9, 0xA9, 0xD5, 0xB5, 0x58, 0x82, 0x96, 0x0A, 0x7D, 0x61,
+  0xA2, 0x82, 0x49, 0x49, 0x41, 0x8F, 0x8A, 0x27, 0xE9, 0x85, 0x37, 0x09, 0x5C, 0x8F, 0x45, 0x82,
+  0x82, 0x61, 0x79, 0x16, 0x62, 0x11, 0x82, 0x3B, 0x00, 0x3C, 0x83, 0x2D, 0x07, 0x36, 0x39, 0x2E,
+  0x35, 0x80, 0x41, 0xC3, 0xED, 0xEE, 0x00, 0x19, 0x4B, 0x66, 0x1D, 0x58, 0xA9, 0xC0, 0xC0, 0x70,
+  0x30, 0x30, 0x35, 0x88, 0x80, 0x58, 0x98, 0x7D, 0x7D, 0xA2, 0xC5, 0x46, 0x63, 0xD4, 0x5C, 0x7C,
+  0x37, 0x7C, 0x82, 0x37, 0x0A, 0x5C, 0xA8, 0xD4, 0x8F, 0x61, 0xF4, 0x7D, 0x46, 0x08, 0x3B, 0x3B,
+  0x82, 0x3C, 0x0B, 0x7A, 0x73, 0x2D, 0x36, 0x39, 0x2E, 0x34, 0x80, 0x64, 0x1D, 0x66, 0x4B, 0xF3,
+  0x00, 0x12, 0x90, 0x66, 0x1D, 0xAB, 0xA9, 0xA4, 0xA4, 0x70, 0x30, 0x35, 0x34, 0x2E, 0xB6, 0xA5,
+  0x6D, 0xAF, 0x98, 0x6D, 0x8D, 0x82, 0x2D, 0x0C, 0x5C, 0x2D, 0x2D, 0x5C, 0x5C, 0xD4, 0x64, 0x96,
+  0x96, 0xDA, 0xB3, 0x5C, 0x2D, 0x82, 0x73, 0x0A, 0x36, 0x36, 0x39, 0x42, 0x2E, 0x35, 0x81, 0x98,
+  0x48, 0x66, 0xB4, 0xF8, 0x00, 0x11, 0x51, 0x4B, 0x66, 0x52, 0x41, 0xB5, 0x35, 0x30, 0x78, 0x34,
+  0x2E, 0x6F, 0x6F, 0x39, 0x42, 0x42, 0x36, 0x36, 0x86, 0x74, 0x04, 0x36, 0x42, 0xA5, 0x42, 0x42,
+  0x82, 0x39, 0x0B, 0x42, 0x42, 0x2E, 0x2E, 0x88, 0x2E, 0xDC, 0x41, 0x52, 0xDD, 0x90, 0x51, 0xE0,
+  0x00, 0x00, 0xBA, 0x9B, 0x00, 0x09, 0x51, 0x8C, 0x50, 0x66, 0x71, 0xB1, 0x64, 0x80, 0xB8, 0xB8,
+  0x82, 0x34, 0x01, 0x2E, 0x2E, 0x84, 0x6F, 0x82, 0x2E, 0x0E, 0xD6, 0x34, 0x2E, 0x2E, 0x88, 0x34,
+  0x80, 0x80, 0x58, 0x64, 0x16, 0x71, 0x66, 0x50, 0x8C, 0xFF, 0x00, 0x86, 0x00, 0x0E, 0x51, 0x4B,
+  0x50, 0xDD, 0x9A, 0x71, 0xE5, 0x16, 0x41, 0x64, 0x64, 0x58, 0x58, 0xB0, 0xB0, 0x82, 0x58, 0x0A,
+  0x98, 0xB3, 0x41, 0x87, 0x1D, 0x52, 0x9A, 0x66, 0x50, 0x4B, 0x51, 0xFF, 0x00, 0x91, 0x00, 0x01,
+  0x8C, 0x8C, 0x82, 0x90, 0x84, 0x50, 0x05, 0x4B, 0x90, 0x90, 0x8C, 0x51, 0x51, 0xFF, 0x00, 0xF2,
+  0x00,
 };
 
 
@@ -1609,27 +1075,30 @@ const unsigned short Splash_Screen[25200] PROGMEM = {
 const uint16_t arrowsIOWidth = 19;
 const uint16_t arrowsIOHeight = 19;
 
-const unsigned short arrowsIO[361] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x1841, 0x0800, 0x0000,   // 0x0010 (16) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1800, 0x2800,   // 0x0020 (32) pixels
-  0x2800, 0x2000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800,   // 0x0030 (48) pixels
-  0x1800, 0x3800, 0xB8C3, 0xB8E3, 0x3800, 0x1800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0040 (64) pixels
-  0x0000, 0x0800, 0x1800, 0x3800, 0xB104, 0xE041, 0xE041, 0xB103, 0x3800, 0x1800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0050 (80) pixels
-  0x0000, 0x0000, 0x0000, 0x0800, 0x1800, 0x4000, 0xC0C3, 0xE041, 0xF020, 0xF020, 0xE041, 0xC0C3, 0x3800, 0x1800, 0x0800, 0x0000,   // 0x0060 (96) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x3020, 0x9165, 0xC8A2, 0xE820, 0xF800, 0xF800, 0xE820, 0xC8A2, 0x8986,   // 0x0070 (112) pixels
-  0x1800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0800, 0x1000, 0x2800, 0x5800, 0xC8A2, 0xE820, 0xE820,   // 0x0080 (128) pixels
-  0xC8A2, 0x5000, 0x2000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x3800, 0x4800, 0x4800, 0x3800, 0x1800, 0x1800, 0x4000,   // 0x0090 (144) pixels
-  0xB8E3, 0xE841, 0xE841, 0xB8E3, 0x4000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0xB104, 0xD882, 0xD082, 0xB104,   // 0x00A0 (160) pixels
-  0x2000, 0x1800, 0x4000, 0xB8E3, 0xE841, 0xE841, 0xB8E3, 0x4000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2800, 0xD082,   // 0x00B0 (176) pixels
-  0xF800, 0xF800, 0xD082, 0x2800, 0x1000, 0x3800, 0xA904, 0xD082, 0xD082, 0xA904, 0x3800, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00C0 (192) pixels
-  0x0000, 0x2800, 0xD082, 0xF800, 0xF800, 0xD082, 0x2800, 0x0800, 0x2800, 0x9165, 0xA904, 0xA904, 0x9165, 0x2800, 0x0800, 0x0000,   // 0x00D0 (208) pixels
-  0x0000, 0x0000, 0x0000, 0x1000, 0x3800, 0xD082, 0xF800, 0xF800, 0xD082, 0x3800, 0x1800, 0x1800, 0x2800, 0x3800, 0x3800, 0x2800,   // 0x00E0 (224) pixels
-  0x1800, 0x0800, 0x0000, 0x0000, 0x0000, 0x1000, 0x3000, 0x5800, 0xE061, 0xF800, 0xF800, 0xE061, 0x5800, 0x3000, 0x1800, 0x1000,   // 0x00F0 (240) pixels
-  0x1000, 0x1000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x8186, 0xB104, 0xE061, 0xF800, 0xF800, 0xE041, 0xB104,   // 0x0100 (256) pixels
-  0x8186, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x2800, 0xA124, 0xD861, 0xF800,   // 0x0110 (272) pixels
-  0xF800, 0xD861, 0xA124, 0x2800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1800,   // 0x0120 (288) pixels
-  0x3800, 0xC0C3, 0xD861, 0xD861, 0xC0C3, 0x3800, 0x1800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0130 (304) pixels
-  0x0000, 0x0000, 0x0800, 0x1800, 0x3800, 0x9945, 0x9945, 0x4000, 0x2000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0140 (320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1800, 0x2000, 0x2800, 0x3000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0150 (336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1000, 0x3041, 0x1800, 0x0800, 0x0000,   // 0x0160 (352) pixels
+// Packed by      : _TOOLS/bitmap_converter.py (palette + RLE, see GfxUi::drawPackedBitmap)
+// Packed size    : 19x19 pixels, 8 bits per pixel, 37 colours, 337 bytes (was 722)
+
+const uint8_t arrowsIO[337] PROGMEM = {
+  0x13, 0x00, 0x13, 0x00, 0x08, 0x24, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x38, 0x00, 0x28,
+  0x00, 0xF8, 0x00, 0x10, 0x82, 0xD0, 0x00, 0x20, 0x00, 0x40, 0x04, 0xB1, 0x41, 0xE0, 0xE3, 0xB8,
+  0x04, 0xA9, 0xA2, 0xC8, 0x20, 0xE8, 0xC3, 0xC0, 0x41, 0xE8, 0x61, 0xD8, 0x00, 0x30, 0x00, 0x58,
+  0x61, 0xE0, 0x65, 0x91, 0x86, 0x81, 0x20, 0xF0, 0x24, 0xA1, 0x00, 0x48, 0x45, 0x99, 0x03, 0xB1,
+  0x86, 0x89, 0x00, 0x50, 0x20, 0x10, 0x20, 0x30, 0x41, 0x18, 0xC3, 0xB8, 0x41, 0x30, 0x82, 0xD8,
+  0x8B, 0x00, 0x02, 0x1F, 0x21, 0x01, 0x8D, 0x00, 0x05, 0x01, 0x02, 0x04, 0x04, 0x08, 0x01, 0x8B,
+  0x00, 0x07, 0x01, 0x02, 0x03, 0x22, 0x0C, 0x03, 0x02, 0x01, 0x89, 0x00, 0x09, 0x01, 0x02, 0x03,
+  0x0A, 0x0B, 0x0B, 0x1C, 0x03, 0x02, 0x01, 0x87, 0x00, 0x0B, 0x01, 0x02, 0x09, 0x10, 0x0B, 0x18,
+  0x18, 0x0B, 0x10, 0x03, 0x02, 0x01, 0x86, 0x00, 0x0B, 0x01, 0x20, 0x16, 0x0E, 0x0F, 0x05, 0x05,
+  0x0F, 0x0E, 0x1D, 0x02, 0x01, 0x83, 0x00, 0x83, 0x01, 0x09, 0x06, 0x04, 0x14, 0x0E, 0x0F, 0x0F,
+  0x0E, 0x1E, 0x08, 0x01, 0x83, 0x00, 0x0D, 0x06, 0x03, 0x1A, 0x1A, 0x03, 0x02, 0x02, 0x09, 0x0C,
+  0x11, 0x11, 0x0C, 0x09, 0x06, 0x84, 0x00, 0x0D, 0x08, 0x0A, 0x24, 0x07, 0x0A, 0x08, 0x02, 0x09,
+  0x0C, 0x11, 0x11, 0x0C, 0x09, 0x06, 0x84, 0x00, 0x0D, 0x04, 0x07, 0x05, 0x05, 0x07, 0x04, 0x06,
+  0x03, 0x0D, 0x07, 0x07, 0x0D, 0x03, 0x06, 0x84, 0x00, 0x0D, 0x04, 0x07, 0x05, 0x05, 0x07, 0x04,
+  0x01, 0x04, 0x16, 0x0D, 0x0D, 0x16, 0x04, 0x01, 0x83, 0x00, 0x0E, 0x06, 0x03, 0x07, 0x05, 0x05,
+  0x07, 0x03, 0x02, 0x02, 0x04, 0x03, 0x03, 0x04, 0x02, 0x01, 0x82, 0x00, 0x09, 0x06, 0x13, 0x14,
+  0x15, 0x05, 0x05, 0x15, 0x14, 0x13, 0x02, 0x82, 0x06, 0x01, 0x01, 0x01, 0x83, 0x00, 0x09, 0x06,
+  0x17, 0x0A, 0x15, 0x05, 0x05, 0x0B, 0x0A, 0x17, 0x06, 0x88, 0x00, 0x09, 0x01, 0x04, 0x19, 0x12,
+  0x05, 0x05, 0x12, 0x19, 0x04, 0x01, 0x88, 0x00, 0x09, 0x01, 0x02, 0x03, 0x10, 0x12, 0x12, 0x10,
+  0x03, 0x02, 0x01, 0x89, 0x00, 0x07, 0x01, 0x02, 0x03, 0x1B, 0x1B, 0x09, 0x08, 0x01, 0x8B, 0x00,
+  0x05, 0x01, 0x02, 0x08, 0x04, 0x13, 0x01, 0x8D, 0x00, 0x04, 0x01, 0x06, 0x23, 0x02, 0x01, 0x89,
+  0x00,
 };
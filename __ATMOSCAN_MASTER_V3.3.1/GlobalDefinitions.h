@@ -16,6 +16,9 @@
 #include "P_MQTT.h"
 #include "P_AirSensors.h"
 #include "P_GeoLocation.h"
+#include "P_Boot.h"
+#include "P_PowerManager.h"
+#include "P_HistoryStore.h"
 #include "WundergroundClient.h"
 
 // -------------------------------------------------------
@@ -32,8 +35,13 @@
 // Used to test board without sensor processes running
 #define ENABLE_SENSORS
 
+// BuienRadar frames are decoded once after download and played back from a palette indexed copy
+#define BUIENRADAR_FRAME_CACHE
+
 // Enables the ability to turn itself off. NOTE: requires PCB 2.0 -OR- the appropriate modification
+#ifndef HOST_SIMULATION
 NOTE: COMPILATION ERROR INTENTIONAL... PLEASE COMMENT OUT THE FOLLOWING LINE IF HARDWARE MOD NOT PRESENT!!!
+#endif
 #define KILL_INSTALLED
 
 // Firmware revision
@@ -68,12 +76,32 @@ NOTE: COMPILATION ERROR INTENTIONAL... PLEASE COMMENT OUT THE FOLLOWING LINE IF
 #define VOLT_LOW 3.3
 #define VOLT_HIGH 4.15
 
-#define AVERAGING_WINDOW 12         // NOTE: 12 * 5 sec sensor sampling rate = 1 minute
-
 #define FAST_SAMPLE_PERIOD 2500     // (ms) Used for Geiger sensor 
 #define SLOW_SAMPLE_PERIOD 5000     // (ms) Used for other sensors 
 #define MQTT_UPDATE_PERIOD 60000    // (ms)
+#define MQTT_DRAIN_PERIOD 15000     // (ms) Forwarding stored samples. NOTE: ThingSpeak takes one update per channel every 15 sec
+#define MQTT_PUBLISH_PERIOD 50      // (ms) Between queued publishes, so that the UI is serviced in between
+#define MQTT_BACKOFF_MIN 2000       // (ms) First reconnect delay, doubled on each failure
+#define MQTT_BACKOFF_MAX 300000     // (ms)
 #define GEOLOC_RETRY_PERIOD 60000   // (ms)
+#define BOOT_STEP_PERIOD 100        // (ms) While the boot completes
+#define POWER_CHECK_PERIOD 500      // (ms) Radio duty cycling, display off
+
+// Particle sensor duty cycle: woken once per cycle, read in a burst once the fan is stable, then asleep
+#define PMS7003_CYCLE_PERIOD 120000     // (ms) 0 = always on, read every SLOW_SAMPLE_PERIOD
+#define PMS7003_BURST_READS 6           // Readings per cycle
+#define PMS7003_BURST_PERIOD 1000       // (ms) Between readings of a burst
+
+// WiFi fast reconnect: the access point of the last connection is kept in RTC memory across restarts
+#define WIFI_RTC_OFFSET 32              // 4 byte blocks: the first 128 bytes of RTC user memory are used by OTA
+#define WIFI_RTC_MAGIC 0x31465257       // "WRF1"
+#define WIFI_FAST_CONNECT_TIMEOUT 3000  // (ms) Before falling back to a full scan
+
+// The address of the last connection is reused (skipping DHCP) if obtained from DHCP since boot, no longer than this ago
+#define WIFI_LEASE_REUSE_PERIOD 1800000 // (ms) Well within the lease time of most DHCP servers
+
+// Also reuse it after a restart (only with a DHCP reservation for this device: the time of the lease is not known at boot)
+// #define WIFI_REUSE_LEASE
 
 // -------------------------------------------------------
 //  Global constants
@@ -104,9 +132,38 @@ struct ProcessContainer
   Proc_UIManager UIManager;
   Proc_MQTTUpdate MQTTUpdate;
   Proc_GeoLocation GeoLocation;
+  Proc_Boot Boot;
+  Proc_PowerManager PowerManager;
+  Proc_HistoryStore HistoryStore;
 
 };
 
+// Last access point and address lease, in RTC memory (survives restarts, not power cycles)
+struct WifiRtcCache
+{
+  uint32_t magic;
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint8_t reserved;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+};
+
+// WiFi connections, timed from WiFi.begin() or from the disconnection
+struct WifiStats
+{
+  bool fastPath = false;              // Current attempt goes straight to the cached access point
+  unsigned long connectStart = 0;     // (ms) Current attempt started
+  uint32_t connects = 0;
+  uint32_t lastConnectTime = 0;       // (ms)
+  bool lastFastPath = false;
+  bool staticLease = false;           // Current attempt reuses the last address, DHCP once connected
+  bool leaseValid = false;            // An address was obtained from DHCP since boot...
+  unsigned long leaseTime = 0;        // (ms) ...at this time
+};
+
 // Holds various items related to the current configuration
 struct Configuration
 {
@@ -116,6 +173,7 @@ struct Configuration
   char mqtt_topic1[64];
   char mqtt_topic2[64];
   char mqtt_topic3[64];
+  char mqtt_systopic[64];     // Process statistics, optional
   char mqtt_server[40];
   char syslog_server[20];
 
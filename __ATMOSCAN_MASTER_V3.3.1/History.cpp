@@ -0,0 +1,486 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
+
+#include "History.h"
+
+// External variables
+extern Syslog syslog;
+
+// Prototypes
+void errLog(String msg);
+time_t utcNow();
+
+#define HISTORY_FILE "/history"
+#define HISTORY_TEMP_FILE "/history.tmp"
+#define HISTORY_MAGIC 0x48495332          // "HIS2", periods in UTC
+
+// Quantisation: value = offset + step * stored
+struct MetricScale
+{
+  float offset;
+  float step;
+};
+
+static const MetricScale metricScales[HISTORY_METRICS] PROGMEM =
+{
+  {0, 0.01},          // Temperature, C
+  {0, 0.01},          // Humidity, %
+  {1000, 0.02},       // Pressure, hPa
+  {0, 0.1},           // PM01, ug/m3
+  {0, 0.1},           // PM2.5, ug/m3
+  {0, 0.1},           // PM10, ug/m3
+  {0, 0.1},           // CPM
+  {0, 0.001},         // Radiation, uSv/h
+  {0, 0.05},          // CO, ppm
+  {0, 1},             // CO2, ppm
+  {0, 0.001},         // NO2, ppm
+  {0, 0.1},           // VOC
+};
+
+// Rotate and add bytes (snapshot integrity)
+static uint32_t checksum(uint32_t sum, const void *data, size_t size)
+{
+  const uint8_t *bytes = (const uint8_t *)data;
+
+  for (size_t i = 0; i < size; i++)
+    sum = ((sum << 5) | (sum >> 27)) + bytes[i];
+
+  return sum;
+}
+
+History::History()
+{
+  tiers[TIER_MINUTE].values = minuteValues;
+  tiers[TIER_MINUTE].depth = HISTORY_MINUTES;
+  tiers[TIER_MINUTE].period = 1;
+
+  tiers[TIER_QUARTER].values = quarterValues;
+  tiers[TIER_QUARTER].depth = HISTORY_QUARTERS;
+  tiers[TIER_QUARTER].period = 15;
+
+  tiers[TIER_HOUR].values = hourValues;
+  tiers[TIER_HOUR].depth = HISTORY_HOURS;
+  tiers[TIER_HOUR].period = 60;
+
+  for (int t = 0; t < HISTORY_TIERS; t++)
+  {
+    clear(t);
+    tiers[t].updates = 0;
+  }
+}
+
+// Restores the history saved before last reboot, if any
+bool History::begin()
+{
+  if (!SPIFFS.begin())
+  {
+    errLog(F("History - no file system"));
+    return false;
+  }
+
+  if (!SPIFFS.exists(F(HISTORY_FILE)))
+    return false;
+
+  if (!restore())
+  {
+    errLog(F("History - bad snapshot"));
+    for (int t = 0; t < HISTORY_TIERS; t++)
+      clear(t);
+    return false;
+  }
+
+  syslog.log(LOG_INFO, String(F("History - ")) + String(tiers[TIER_HOUR].count) + F(" hours restored"));
+  return true;
+}
+
+void History::add(SampleMetric metric, float value)
+{
+  if (metric >= HISTORY_METRICS || isnan(value))
+    return;
+
+  // Periods follow the clock in UTC (timezone and summer time changes don't move them): nothing to do until it is set
+  time_t utc = utcNow();
+  if (utc == 0)
+    return;
+
+  // Close the periods that ended, finest first as it feeds the next tier
+  uint32_t minute = utc / 60;
+  for (int t = 0; t < HISTORY_TIERS; t++)
+    advance(t, minute / tiers[t].period);
+
+  accumulate(TIER_MINUTE, metric, value);
+}
+
+uint16_t History::getCount(HistoryTier tier)
+{
+  return tiers[tier].count;
+}
+
+uint16_t History::getDepth(HistoryTier tier)
+{
+  return tiers[tier].depth;
+}
+
+uint16_t History::getPeriod(HistoryTier tier)
+{
+  return tiers[tier].period;
+}
+
+float History::getValue(HistoryTier tier, SampleMetric metric, uint16_t age)
+{
+  if (age >= tiers[tier].count || metric >= HISTORY_METRICS)
+    return NAN;
+
+  return dequantise(metric, slot(tier, age)[metric]);
+}
+
+time_t History::getTime(HistoryTier tier, uint16_t age)
+{
+  return (time_t)(tiers[tier].bucket - 1 - age) * tiers[tier].period * 60;
+}
+
+// Range of the last points of a metric, false if none has data
+bool History::getRange(HistoryTier tier, SampleMetric metric, uint16_t points, float &minimum, float &maximum)
+{
+  float mean;
+
+  return getSummary(tier, metric, points, minimum, mean, maximum);
+}
+
+// Range and mean of the last points of a metric (periods without data left out), false if none has data
+bool History::getSummary(HistoryTier tier, SampleMetric metric, uint16_t points, float &minimum, float &mean, float &maximum)
+{
+  int16_t low = INT16_MAX;
+  int16_t high = HISTORY_NO_DATA;
+  float sum = 0;
+  uint16_t count = 0;
+
+  if (metric >= HISTORY_METRICS)
+    return false;
+
+  for (uint16_t age = 0; age < points && age < tiers[tier].count; age++)
+  {
+    int16_t value = slot(tier, age)[metric];
+    if (value == HISTORY_NO_DATA)
+      continue;
+
+    if (value < low)
+      low = value;
+    if (value > high)
+      high = value;
+    sum += dequantise(metric, value);
+    count++;
+  }
+
+  if (count == 0)
+    return false;
+
+  minimum = dequantise(metric, low);
+  maximum = dequantise(metric, high);
+  mean = sum / count;
+  return true;
+}
+
+uint32_t History::getUpdates(HistoryTier tier)
+{
+  return tiers[tier].updates;
+}
+
+// Moves a tier to the given period, closing the current one
+void History::advance(int t, uint32_t bucket)
+{
+  Tier &tier = tiers[t];
+
+  // Same period, or clock set back by less than one (NTP correction): keep accumulating
+  if (bucket == tier.bucket || bucket + 1 == tier.bucket)
+    return;
+
+  // First period, or clock set back further: start over
+  if (tier.bucket == 0 || bucket < tier.bucket)
+  {
+    if (tier.bucket != 0)
+      clear(t);
+
+    tier.bucket = bucket;
+    return;
+  }
+
+  // Close the current period, feeding its averages to the next tier
+  append(t, true);
+
+  if (t + 1 < HISTORY_TIERS)
+  {
+    advance(t + 1, tier.bucket * tier.period / tiers[t + 1].period);
+
+    for (int m = 0; m < HISTORY_METRICS; m++)
+    {
+      if (tier.samples[m] > 0)
+        accumulate(t + 1, m, tier.sum[m] / tier.samples[m]);
+    }
+  }
+
+  // Periods without samples (beyond the depth, there is nothing left to keep)
+  uint32_t gap = bucket - tier.bucket - 1;
+  for (uint32_t i = 0; i < gap && i < tier.depth; i++)
+    append(t, false);
+
+  for (int m = 0; m < HISTORY_METRICS; m++)
+  {
+    tier.sum[m] = 0;
+    tier.samples[m] = 0;
+  }
+  tier.bucket = bucket;
+
+  // Snapshot every quarter of an hour
+  if (t == TIER_QUARTER)
+    saveDue = true;
+}
+
+void History::accumulate(int t, int metric, float value)
+{
+  tiers[t].sum[metric] += value;
+  tiers[t].samples[metric]++;
+}
+
+// Adds a period to the ring, with the current averages or as no data
+void History::append(int t, bool withData)
+{
+  Tier &tier = tiers[t];
+
+  tier.newest = tier.count == 0 ? 0 : (tier.newest + 1) % tier.depth;
+  if (tier.count < tier.depth)
+    tier.count++;
+  tier.updates++;
+
+  int16_t *values = &tier.values[tier.newest * HISTORY_METRICS];
+  for (int m = 0; m < HISTORY_METRICS; m++)
+    values[m] = withData && tier.samples[m] > 0 ? quantise(m, tier.sum[m] / tier.samples[m]) : HISTORY_NO_DATA;
+}
+
+void History::clear(int t)
+{
+  Tier &tier = tiers[t];
+
+  tier.newest = 0;
+  tier.count = 0;
+  tier.bucket = 0;
+  for (int m = 0; m < HISTORY_METRICS; m++)
+  {
+    tier.sum[m] = 0;
+    tier.samples[m] = 0;
+  }
+}
+
+// Writes the next chunk of the snapshot, then replaces the previous one (never left half written)
+// NOTE: the writes are spread over several runs, sensors keep adding meanwhile
+void History::saveStep()
+{
+  if (!saving)
+  {
+    if (!saveDue)
+      return;
+    saveDue = false;
+
+    saveFile = SPIFFS.open(F(HISTORY_TEMP_FILE), "w");
+    if (!saveFile)
+    {
+      errLog(F("History - write error"));
+      return;
+    }
+
+    saving = true;
+    savePart = 0;
+    saveOffset = 0;
+    saveSum = 0;
+    saveUpdates = closedPeriods();
+  }
+
+  // A period closed since the start: the rings already written are stale, start over
+  if (closedPeriods() != saveUpdates)
+  {
+    abortSave();
+    saveDue = true;
+    return;
+  }
+
+  size_t budget = HISTORY_SAVE_CHUNK;
+  const void *data;
+  size_t size;
+
+  while (budget > 0 && (size = savedPart(savePart, data)) > 0)
+  {
+    const uint8_t *bytes = (const uint8_t *)data + saveOffset;
+    size_t length = min(size - saveOffset, budget);
+
+    // The checksum is the last part, over all the others
+    if (data != &saveSum)
+      saveSum = checksum(saveSum, bytes, length);
+
+    if (saveFile.write(bytes, length) != length)
+    {
+      errLog(F("History - write error"));
+      abortSave();
+      return;
+    }
+
+    budget -= length;
+    saveOffset += length;
+    if (saveOffset == size)
+    {
+      savePart++;
+      saveOffset = 0;
+    }
+  }
+
+  if (size > 0)
+    return;
+
+  // All written
+  saveFile.close();
+  saving = false;
+
+  SPIFFS.remove(F(HISTORY_FILE));
+  if (!SPIFFS.rename(F(HISTORY_TEMP_FILE), F(HISTORY_FILE)))
+    errLog(F("History - write error"));
+}
+
+bool History::isSaving()
+{
+  return saving || saveDue;
+}
+
+// Parts of the snapshot, in file order: size, 0 past the last one
+// Magic, then each tier (everything but the pointer and the session counter), then the checksum
+size_t History::savedPart(uint16_t part, const void *&data)
+{
+  static const uint32_t magic = HISTORY_MAGIC;
+  const uint16_t tierParts = 8;
+
+  if (part == 0)
+  {
+    data = &magic;
+    return sizeof(magic);
+  }
+
+  part--;
+  if (part < HISTORY_TIERS * tierParts)
+  {
+    Tier &tier = tiers[part / tierParts];
+
+    const void *parts[] = {&tier.depth, &tier.period, &tier.newest, &tier.count, &tier.bucket, tier.sum, tier.samples, tier.values};
+    size_t sizes[] = {sizeof(tier.depth), sizeof(tier.period), sizeof(tier.newest), sizeof(tier.count), sizeof(tier.bucket),
+                      sizeof(tier.sum), sizeof(tier.samples), tier.depth * HISTORY_METRICS * sizeof(int16_t)
+                     };
+
+    data = parts[part % tierParts];
+    return sizes[part % tierParts];
+  }
+
+  if (part == HISTORY_TIERS * tierParts)
+  {
+    data = &saveSum;
+    return sizeof(saveSum);
+  }
+
+  return 0;
+}
+
+uint32_t History::closedPeriods()
+{
+  uint32_t closed = 0;
+
+  for (int t = 0; t < HISTORY_TIERS; t++)
+    closed += tiers[t].updates;
+
+  return closed;
+}
+
+void History::abortSave()
+{
+  saveFile.close();
+  saving = false;
+  SPIFFS.remove(F(HISTORY_TEMP_FILE));
+}
+
+bool History::restore()
+{
+  fs::File file = SPIFFS.open(F(HISTORY_FILE), "r");
+  if (!file)
+    return false;
+
+  uint32_t magic = 0;
+  bool valid = file.read((uint8_t *)&magic, sizeof(magic)) == sizeof(magic) && magic == HISTORY_MAGIC;
+  uint32_t sum = checksum(0, &magic, sizeof(magic));
+
+  for (int t = 0; t < HISTORY_TIERS && valid; t++)
+  {
+    Tier &tier = tiers[t];
+    uint16_t depth = 0;
+    uint16_t period = 0;
+
+    // Layout must match this build
+    valid = file.read((uint8_t *)&depth, sizeof(depth)) == sizeof(depth) && depth == tier.depth &&
+            file.read((uint8_t *)&period, sizeof(period)) == sizeof(period) && period == tier.period;
+    if (!valid)
+      break;
+
+    sum = checksum(sum, &depth, sizeof(depth));
+    sum = checksum(sum, &period, sizeof(period));
+
+    void *parts[] = {&tier.newest, &tier.count, &tier.bucket, tier.sum, tier.samples, tier.values};
+    size_t sizes[] = {sizeof(tier.newest), sizeof(tier.count), sizeof(tier.bucket),
+                      sizeof(tier.sum), sizeof(tier.samples), tier.depth * HISTORY_METRICS * sizeof(int16_t)
+                     };
+
+    for (size_t p = 0; p < sizeof(sizes) / sizeof(size_t) && valid; p++)
+    {
+      valid = file.read((uint8_t *)parts[p], sizes[p]) == sizes[p];
+      sum = checksum(sum, parts[p], sizes[p]);
+    }
+
+    valid = valid && tier.count <= tier.depth && tier.newest < tier.depth;
+  }
+
+  uint32_t saved = 0;
+  valid = valid && file.read((uint8_t *)&saved, sizeof(saved)) == sizeof(saved) && saved == sum;
+  file.close();
+
+  return valid;
+}
+
+// Values of a period, by age (0 = last completed)
+int16_t *History::slot(int t, uint16_t age)
+{
+  Tier &tier = tiers[t];
+  return &tier.values[((tier.newest + tier.depth - age) % tier.depth) * HISTORY_METRICS];
+}
+
+int16_t History::quantise(int metric, float value)
+{
+  MetricScale scale;
+  memcpy_P(&scale, &metricScales[metric], sizeof(MetricScale));
+
+  // Clipped to the range, never to the no data marker
+  float stored = roundf((value - scale.offset) / scale.step);
+  if (stored > INT16_MAX)
+    return INT16_MAX;
+  if (stored <= HISTORY_NO_DATA)
+    return HISTORY_NO_DATA + 1;
+  return (int16_t)stored;
+}
+
+float History::dequantise(int metric, int16_t value)
+{
+  if (value == HISTORY_NO_DATA)
+    return NAN;
+
+  MetricScale scale;
+  memcpy_P(&scale, &metricScales[metric], sizeof(MetricScale));
+  return scale.offset + scale.step * value;
+}
@@ -0,0 +1,106 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <FS.h>
+#include <TimeLib.h>              // https://github.com/PaulStoffregen/Time
+
+#include "SampleLog.h"
+
+// Averaged metrics (window maxima are not kept)
+#define HISTORY_METRICS (METRIC_VOC + 1)
+
+// Tier depths: 1 hour of minutes, 24 hours of quarters, 7 days of hours
+// NOTE: RAM is HISTORY_METRICS * (60 + 96 + 168) * 2 bytes, ~7.8KB
+#define HISTORY_MINUTES 60
+#define HISTORY_QUARTERS 96
+#define HISTORY_HOURS 168
+
+#define HISTORY_NO_DATA INT16_MIN
+
+#define HISTORY_SAVE_CHUNK 256            // Bytes of the snapshot written per step (~4ms of flash writes)
+
+enum HistoryTier
+{
+  TIER_MINUTE,
+  TIER_QUARTER,
+  TIER_HOUR,
+  HISTORY_TIERS
+};
+
+// Time series of the sensor metrics, downsampled into per minute, per quarter of an hour
+// and per hour averages. Values are quantised to 16 bits (step and offset per metric).
+// Each tier is a ring of periods aligned to the UTC clock; a period closes when a sample of
+// the next one arrives, periods without samples are kept as "no data".
+// All tiers are saved to SPIFFS every quarter of an hour, a chunk per step of the history
+// process (see P_HistoryStore.h), and restored at boot.
+class History
+{
+  public:
+    History();
+    bool begin();
+
+    // Fed by the sensor processes
+    void add(SampleMetric metric, float value);
+
+    // Snapshot, driven by the history process
+    void saveStep();
+    bool isSaving();
+
+    // Queries, age 0 is the last completed period
+    uint16_t getCount(HistoryTier tier);
+    uint16_t getDepth(HistoryTier tier);
+    uint16_t getPeriod(HistoryTier tier);                       // Minutes
+    float getValue(HistoryTier tier, SampleMetric metric, uint16_t age);   // NAN if no data
+    time_t getTime(HistoryTier tier, uint16_t age);             // Start of the period, UTC
+    bool getRange(HistoryTier tier, SampleMetric metric, uint16_t points, float &minimum, float &maximum);
+    bool getSummary(HistoryTier tier, SampleMetric metric, uint16_t points, float &minimum, float &mean, float &maximum);
+    uint32_t getUpdates(HistoryTier tier);                      // Periods closed since boot
+
+  private:
+    struct Tier
+    {
+      int16_t *values;                // [depth][HISTORY_METRICS]
+      uint16_t depth;
+      uint16_t period;                // Minutes
+      uint16_t newest;                // Slot of the last completed period
+      uint16_t count;
+      uint32_t bucket;                // Period being accumulated (minutes / period), 0 if none
+      uint32_t updates;
+      float sum[HISTORY_METRICS];
+      uint16_t samples[HISTORY_METRICS];
+    };
+
+    Tier tiers[HISTORY_TIERS];
+    int16_t minuteValues[HISTORY_MINUTES * HISTORY_METRICS];
+    int16_t quarterValues[HISTORY_QUARTERS * HISTORY_METRICS];
+    int16_t hourValues[HISTORY_HOURS * HISTORY_METRICS];
+    bool saveDue = false;
+
+    // Snapshot being written: next part and offset in it, checksum so far
+    fs::File saveFile;
+    bool saving = false;
+    uint16_t savePart;
+    size_t saveOffset;
+    uint32_t saveSum;
+    uint32_t saveUpdates;             // Periods closed when it started
+
+    void advance(int tier, uint32_t bucket);
+    void accumulate(int tier, int metric, float value);
+    void append(int tier, bool withData);
+    void clear(int tier);
+    size_t savedPart(uint16_t part, const void *&data);
+    uint32_t closedPeriods();
+    void abortSave();
+    bool restore();
+    int16_t *slot(int tier, uint16_t age);
+    static int16_t quantise(int metric, float value);
+    static float dequantise(int metric, int16_t value);
+};
+
+extern History history;
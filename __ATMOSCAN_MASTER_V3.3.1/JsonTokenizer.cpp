@@ -0,0 +1,291 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#include "JsonTokenizer.h"
+
+// Lexer states
+#define LEX_NONE 0
+#define LEX_STRING 1
+#define LEX_ESCAPE 2
+#define LEX_UNICODE 3
+#define LEX_LITERAL 4
+
+// What the structure allows next
+#define EXPECT_VALUE 0
+#define EXPECT_KEY 1
+#define EXPECT_COLON 2
+#define EXPECT_NEXT 3
+
+#define FNV_OFFSET 2166136261UL
+#define FNV_PRIME 16777619UL
+
+JsonTokenizer::JsonTokenizer(JsonHandler *handler)
+  : handler(handler)
+{
+  reset();
+}
+
+void JsonTokenizer::reset()
+{
+  length = 0;
+  hash = FNV_OFFSET;
+  lexer = LEX_NONE;
+  expect = EXPECT_VALUE;
+  inKey = false;
+  started = false;
+  finished = false;
+  containers = 0;
+  depth = 0;
+  unicode = 0;
+  highSurrogate = 0;
+  hexDigits = 0;
+}
+
+bool JsonTokenizer::done()
+{
+  return finished;
+}
+
+void JsonTokenizer::parse(const char *data, size_t count)
+{
+  while (count--)
+    parse(*data++);
+}
+
+void JsonTokenizer::parse(char c)
+{
+  // ********* Inside a token
+
+  switch (lexer)
+  {
+    case LEX_STRING:
+      if (c == '"')
+      {
+        endToken();
+        return;
+      }
+      if (c == '\\')
+        lexer = LEX_ESCAPE;
+      else
+        append(c);
+      return;
+
+    case LEX_ESCAPE:
+      lexer = LEX_STRING;
+      switch (c)
+      {
+        case 'b':
+          append('\b');
+          break;
+        case 'f':
+          append('\f');
+          break;
+        case 'n':
+          append('\n');
+          break;
+        case 'r':
+          append('\r');
+          break;
+        case 't':
+          append('\t');
+          break;
+        case 'u':
+          lexer = LEX_UNICODE;
+          unicode = 0;
+          hexDigits = 0;
+          break;
+        default:
+          // \" \\ \/
+          append(c);
+      }
+      return;
+
+    case LEX_UNICODE:
+      unicode <<= 4;
+      if (c >= '0' && c <= '9')
+        unicode |= c - '0';
+      else if (c >= 'a' && c <= 'f')
+        unicode |= c - 'a' + 10;
+      else if (c >= 'A' && c <= 'F')
+        unicode |= c - 'A' + 10;
+
+      if (++hexDigits == 4)
+      {
+        lexer = LEX_STRING;
+
+        // Surrogate pairs make one code point
+        if (unicode >= 0xD800 && unicode < 0xDC00)
+          highSurrogate = unicode;
+        else if (unicode >= 0xDC00 && unicode < 0xE000 && highSurrogate)
+        {
+          appendCodepoint(0x10000 + ((uint32_t)(highSurrogate - 0xD800) << 10) + (unicode - 0xDC00));
+          highSurrogate = 0;
+        }
+        else
+          appendCodepoint(unicode);
+      }
+      return;
+
+    case LEX_LITERAL:
+      // Numbers, true, false and null end at the next delimiter, handled below
+      if (c != ',' && c != '}' && c != ']' && c != ' ' && c != '\t' && c != '\r' && c != '\n')
+      {
+        append(c);
+        return;
+      }
+      endToken();
+      break;
+  }
+
+  // ********* Structure
+
+  // Whatever precedes the document is skipped
+  if (!started && c != '{' && c != '[')
+    return;
+
+  switch (c)
+  {
+    case ' ':
+    case '\t':
+    case '\r':
+    case '\n':
+      break;
+
+    case '{':
+    case '[':
+      if (!started)
+      {
+        started = true;
+        handler->startDocument();
+      }
+      push(c == '{');
+      if (c == '{')
+      {
+        handler->startObject();
+        expect = EXPECT_KEY;
+      }
+      else
+      {
+        handler->startArray();
+        expect = EXPECT_VALUE;
+      }
+      break;
+
+    case '}':
+    case ']':
+      pop();
+      if (c == '}')
+        handler->endObject();
+      else
+        handler->endArray();
+      expect = EXPECT_NEXT;
+
+      if (depth == 0 && started && !finished)
+      {
+        finished = true;
+        handler->endDocument();
+      }
+      break;
+
+    case ':':
+      expect = EXPECT_VALUE;
+      break;
+
+    case ',':
+      expect = depth > 0 && depth <= JSON_MAX_DEPTH && (containers & (1UL << (depth - 1))) ? EXPECT_KEY : EXPECT_VALUE;
+      break;
+
+    case '"':
+      inKey = expect == EXPECT_KEY;
+      startToken();
+      lexer = LEX_STRING;
+      break;
+
+    default:
+      if (expect == EXPECT_VALUE)
+      {
+        inKey = false;
+        startToken();
+        lexer = LEX_LITERAL;
+        append(c);
+      }
+  }
+}
+
+void JsonTokenizer::startToken()
+{
+  length = 0;
+  hash = FNV_OFFSET;
+  highSurrogate = 0;
+}
+
+void JsonTokenizer::append(char c)
+{
+  hash = (hash ^ (uint8_t)c) * FNV_PRIME;
+  if (length < JSON_TOKEN_SIZE - 1)
+    buffer[length++] = c;
+}
+
+void JsonTokenizer::appendCodepoint(uint32_t codepoint)
+{
+  // UTF-8
+  if (codepoint < 0x80)
+    append(codepoint);
+  else if (codepoint < 0x800)
+  {
+    append(0xC0 | (codepoint >> 6));
+    append(0x80 | (codepoint & 0x3F));
+  }
+  else if (codepoint < 0x10000)
+  {
+    append(0xE0 | (codepoint >> 12));
+    append(0x80 | ((codepoint >> 6) & 0x3F));
+    append(0x80 | (codepoint & 0x3F));
+  }
+  else
+  {
+    append(0xF0 | (codepoint >> 18));
+    append(0x80 | ((codepoint >> 12) & 0x3F));
+    append(0x80 | ((codepoint >> 6) & 0x3F));
+    append(0x80 | (codepoint & 0x3F));
+  }
+}
+
+void JsonTokenizer::endToken()
+{
+  lexer = LEX_NONE;
+  buffer[length] = '\0';
+
+  if (inKey)
+  {
+    handler->key(hash, buffer, length);
+    expect = EXPECT_COLON;
+  }
+  else
+  {
+    handler->value(buffer, length);
+    expect = EXPECT_NEXT;
+  }
+}
+
+void JsonTokenizer::push(bool object)
+{
+  if (depth < JSON_MAX_DEPTH)
+  {
+    if (object)
+      containers |= 1UL << depth;
+    else
+      containers &= ~(1UL << depth);
+  }
+  depth++;
+}
+
+void JsonTokenizer::pop()
+{
+  if (depth > 0)
+    depth--;
+}
@@ -0,0 +1,85 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <Arduino.h>
+
+// Longest key or value passed to the handler, longer ones are truncated
+// NOTE: key IDs are computed on the whole key, truncated or not
+#define JSON_TOKEN_SIZE 128
+#define JSON_MAX_DEPTH 32
+
+// Key ID: FNV-1a hash of the key, computed at compile time for the keys a handler
+// looks for, so that they can be compared as integers or used as case labels:
+//   switch (keyId) { case jsonKey("lat"): ... }
+constexpr uint32_t jsonKey(const char *key, uint32_t hash = 2166136261UL)
+{
+  return *key ? jsonKey(key + 1, (hash ^ (uint8_t)*key) * 16777619UL) : hash;
+}
+
+// Receives the tokens of a JSON document
+// Keys and values are slices of the tokenizer's buffer, zero terminated and valid
+// only for the duration of the call: copy what has to be kept.
+// Values are strings, numbers, true, false and null, as text.
+class JsonHandler
+{
+  public:
+    virtual ~JsonHandler() {}
+
+    virtual void startDocument() {}
+    virtual void key(uint32_t keyId, const char *key, uint16_t length) = 0;
+    virtual void value(char *value, uint16_t length) = 0;
+    virtual void startObject() {}
+    virtual void endObject() {}
+    virtual void startArray() {}
+    virtual void endArray() {}
+    virtual void endDocument() {}
+};
+
+// Streaming JSON tokenizer, fed a character at a time
+// Works in its own fixed buffer: no heap allocation at all while parsing.
+// Lenient: malformed input does not stop it, it just produces odd tokens.
+class JsonTokenizer
+{
+  public:
+    JsonTokenizer(JsonHandler *handler);
+
+    void parse(char c);
+    void parse(const char *data, size_t count);
+    void reset();
+
+    // The whole document was parsed
+    bool done();
+
+  private:
+    JsonHandler *handler;
+
+    char buffer[JSON_TOKEN_SIZE];
+    uint16_t length;
+    uint32_t hash;                    // Key ID of the token so far
+
+    uint8_t lexer;                    // Inside a string, an escape, a literal...
+    uint8_t expect;                   // Next token, in the structure
+    bool inKey;
+    bool started;
+    bool finished;
+
+    uint32_t containers;              // One bit per level: 1 = object, 0 = array
+    uint8_t depth;
+
+    uint16_t unicode;                 // \uXXXX being read
+    uint16_t highSurrogate;
+    uint8_t hexDigits;
+
+    void append(char c);
+    void appendCodepoint(uint32_t codepoint);
+    void startToken();
+    void endToken();
+    void push(bool object);
+    void pop();
+};
@@ -0,0 +1,167 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
+
+#include "MemoryMonitor.h"
+
+// External variables
+extern Syslog syslog;
+
+// Low watermark of the free heap, kept by umm_malloc (UMM_STATS)
+extern "C" size_t umm_free_heap_size_min();
+extern "C" size_t umm_free_heap_size_min_reset();
+
+// -------------------------------------------------------
+// Scope
+// -------------------------------------------------------
+
+MemoryMonitor::Scope::Scope(MemoryStats *stats, const __FlashStringHelper *name)
+  : stats(stats), name(name)
+{
+  // Lows so far belong to the enclosing scopes
+  memoryMonitor.checkpoint();
+
+  parent = memoryMonitor.innermost;
+  memoryMonitor.innermost = this;
+
+  startFree = lowFree = ESP.getFreeHeap();
+}
+
+MemoryMonitor::Scope::~Scope()
+{
+  memoryMonitor.checkpoint();
+  memoryMonitor.innermost = parent;
+
+  if (stats != NULL)
+    memoryMonitor.record(*stats, name, -1, startFree - lowFree);
+
+  // Walking the heap for the largest block is not free: outermost scopes only, and not too often
+  if (parent == NULL)
+    memoryMonitor.sample();
+}
+
+// -------------------------------------------------------
+// Monitor
+// -------------------------------------------------------
+
+MemoryMonitor::MemoryMonitor()
+{
+  memset(screens, 0, sizeof(screens));
+}
+
+void MemoryMonitor::screenActivated(int newScreenID)
+{
+  checkpoint();
+
+  if (screenID >= 0 && screenID < MEMORY_MAX_SCREENS)
+    record(screens[screenID], NULL, screenID, screenStartFree - screenLowFree);
+
+  screenID = newScreenID;
+  screenStartFree = screenLowFree = ESP.getFreeHeap();
+}
+
+MemoryStats &MemoryMonitor::getScreen(int id)
+{
+  return screens[id];
+}
+
+uint32_t MemoryMonitor::getFreeHeap()
+{
+  return ESP.getFreeHeap();
+}
+
+uint32_t MemoryMonitor::getMaxBlock()
+{
+  return maxBlock;
+}
+
+uint8_t MemoryMonitor::getFragmentation()
+{
+  return fragmentation;
+}
+
+uint32_t MemoryMonitor::getMinFreeHeap()
+{
+  checkpoint();
+  return minFreeHeap;
+}
+
+uint32_t MemoryMonitor::getMinMaxBlock()
+{
+  return sampled ? minMaxBlock : 0;
+}
+
+uint8_t MemoryMonitor::getMaxFragmentation()
+{
+  return maxFragmentation;
+}
+
+// Hands the allocator's low watermark to every open scope, then restarts it
+void MemoryMonitor::checkpoint()
+{
+  uint32_t low = umm_free_heap_size_min();
+
+  for (Scope *scope = innermost; scope != NULL; scope = scope->parent)
+  {
+    if (low < scope->lowFree)
+      scope->lowFree = low;
+  }
+
+  if (low < screenLowFree)
+    screenLowFree = low;
+  if (low < minFreeHeap)
+    minFreeHeap = low;
+
+  umm_free_heap_size_min_reset();
+}
+
+// Largest free block and fragmentation (the allocator has no watermark for these)
+// NOTE: both calls need the ESP8266 core 2.5.0 or later
+void MemoryMonitor::sample()
+{
+  if (sampled && millis() - lastSample < MEMORY_SAMPLE_PERIOD)
+    return;
+  lastSample = millis();
+
+  maxBlock = ESP.getMaxFreeBlockSize();
+  fragmentation = ESP.getHeapFragmentation();
+
+  if (!sampled)
+    reportedMaxBlock = maxBlock;
+  sampled = true;
+
+  if (maxBlock < minMaxBlock)
+    minMaxBlock = maxBlock;
+  if (fragmentation > maxFragmentation)
+    maxFragmentation = fragmentation;
+
+  // Regression: largest block well below what was last reported
+  if (maxBlock + MEMORY_REGRESSION_MARGIN < reportedMaxBlock)
+  {
+    syslog.log(LOG_WARNING, String(F("HEAP: largest free block down to ")) + String(maxBlock) +
+               F(" bytes, fragmentation ") + String(fragmentation) + F("%"));
+    reportedMaxBlock = maxBlock;
+  }
+}
+
+void MemoryMonitor::record(MemoryStats &stats, const __FlashStringHelper *name, int id, uint32_t peak)
+{
+  stats.lastPeak = peak;
+  if (peak > stats.peak)
+    stats.peak = peak;
+
+  // The first run sets the reference, regressions are logged against it
+  if (stats.runs++ == 0)
+    stats.reportedPeak = peak;
+  else if (peak > stats.reportedPeak + MEMORY_REGRESSION_MARGIN)
+  {
+    syslog.log(LOG_WARNING, String(F("HEAP: ")) + (name != NULL ? String(name) : String(F("Screen ")) + String(id)) +
+               F(" high-water mark ") + String(stats.reportedPeak) + F(" -> ") + String(peak) + F(" bytes"));
+    stats.reportedPeak = peak;
+  }
+}
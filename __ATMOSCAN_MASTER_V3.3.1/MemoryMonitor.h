@@ -0,0 +1,88 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <Arduino.h>
+
+#define MEMORY_MAX_SCREENS 12
+#define MEMORY_SAMPLE_PERIOD 1000         // ms between samples of the largest block and fragmentation
+#define MEMORY_REGRESSION_MARGIN 512      // Bytes a figure must worsen by before it is logged again
+
+// Heap taken by a process service() or a screen, over what was free when it started
+struct MemoryStats
+{
+  uint32_t runs;
+  uint32_t lastPeak;                  // Bytes, latest run
+  uint32_t peak;                      // Bytes, high-water mark
+  uint32_t reportedPeak;              // Last one logged (or the first one)
+};
+
+// Tracks free heap, largest free block and fragmentation, and the high-water mark
+// of the heap taken by each process service() and by each screen while it is shown.
+// High-water marks come from the allocator's low watermark of the free heap, so
+// what is allocated and freed again within a run still counts.
+class MemoryMonitor
+{
+  public:
+    // Watches the heap taken until it goes out of scope (scopes nest)
+    class Scope
+    {
+      public:
+        Scope(MemoryStats *stats, const __FlashStringHelper *name);
+        ~Scope();
+
+      private:
+        MemoryStats *stats;
+        const __FlashStringHelper *name;
+        Scope *parent;
+        uint32_t startFree;
+        uint32_t lowFree;
+
+        friend class MemoryMonitor;
+    };
+
+    MemoryMonitor();
+
+    // A new screen is about to be created: closes the window of the previous one
+    void screenActivated(int screenID);
+    MemoryStats &getScreen(int screenID);
+
+    // Current figures (largest block and fragmentation as of the last sample)
+    uint32_t getFreeHeap();
+    uint32_t getMaxBlock();
+    uint8_t getFragmentation();
+
+    // Worst figures since boot
+    uint32_t getMinFreeHeap();
+    uint32_t getMinMaxBlock();
+    uint8_t getMaxFragmentation();
+
+  private:
+    Scope *innermost = NULL;
+
+    // Window of the screen being shown
+    int screenID = -1;
+    uint32_t screenStartFree = 0;
+    uint32_t screenLowFree = 0;
+    MemoryStats screens[MEMORY_MAX_SCREENS];
+
+    bool sampled = false;
+    unsigned long lastSample = 0;
+    uint32_t maxBlock = 0;
+    uint8_t fragmentation = 0;
+    uint32_t minFreeHeap = 0xFFFFFFFF;
+    uint32_t minMaxBlock = 0xFFFFFFFF;
+    uint32_t reportedMaxBlock = 0;
+    uint8_t maxFragmentation = 0;
+
+    void checkpoint();
+    void sample();
+    void record(MemoryStats &stats, const __FlashStringHelper *name, int screenID, uint32_t peak);
+};
+
+extern MemoryMonitor memoryMonitor;
@@ -0,0 +1,170 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#include <TimeLib.h>              // https://github.com/PaulStoffregen/Time
+
+#include "MqttPayload.h"
+
+// Powers of ten for fixed point formatting (up to 9 decimals)
+static const uint32_t powersOf10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+PayloadWriter::PayloadWriter(char *buffer, size_t size)
+  : buffer(buffer), size(size)
+{
+  overflow = size == 0;
+  terminate();
+}
+
+void PayloadWriter::add(const PayloadField *table, size_t count, uint8_t topic, const SampleRecord *sample)
+{
+  PayloadField entry;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    memcpy_P(&entry, &table[i], sizeof(PayloadField));
+    if (entry.topic != topic)
+      continue;
+
+    // No data yet (sensor warming up): the field is left out
+    float value = entry.getter(sample);
+    if (!isnan(value))
+      add(entry.field, value, entry.precision);
+  }
+}
+
+void PayloadWriter::add(uint8_t field, float value, uint8_t precision)
+{
+  addKey('0' + field);
+
+  if (precision > 9)
+    precision = 9;
+
+  // Fixed point, when it fits 32 bits (same rounding as dtostrf)
+  float scaled = (value < 0 ? -value : value) * powersOf10[precision] + 0.5f;
+  if (scaled < 4294967040.0f)
+  {
+    uint32_t fixed = (uint32_t)scaled;
+
+    if (value < 0 && fixed != 0)
+      addChar('-');
+
+    addUnsigned(fixed / powersOf10[precision], 1);
+    if (precision > 0)
+    {
+      addChar('.');
+      addUnsigned(fixed % powersOf10[precision], precision);
+    }
+  }
+  else
+  {
+    // Huge or not a number, rare: let dtostrf deal with it
+    char number[48];
+    dtostrf(value, 1, precision, number);
+
+    for (char *c = number; *c != '\0'; c++)
+      addChar(*c);
+  }
+
+  terminate();
+}
+
+void PayloadWriter::add(uint8_t field, uint32_t value)
+{
+  addKey('0' + field);
+  addUnsigned(value, 1);
+  terminate();
+}
+
+// ISO 8601, as ThingSpeak takes it: "created_at=2018-10-15T00:00:00Z"
+void PayloadWriter::addTimestamp(uint32_t timestamp)
+{
+  if (len > 0)
+    addChar('&');
+  for (PGM_P c = PSTR("created_at="); pgm_read_byte(c) != '\0'; c++)
+    addChar(pgm_read_byte(c));
+
+  addUnsigned(year(timestamp), 4);
+  addChar('-');
+  addUnsigned(month(timestamp), 2);
+  addChar('-');
+  addUnsigned(day(timestamp), 2);
+  addChar('T');
+  addUnsigned(hour(timestamp), 2);
+  addChar(':');
+  addUnsigned(minute(timestamp), 2);
+  addChar(':');
+  addUnsigned(second(timestamp), 2);
+  addChar('Z');
+  terminate();
+}
+
+bool PayloadWriter::isOverflow()
+{
+  return overflow;
+}
+
+size_t PayloadWriter::length()
+{
+  return overflow ? 0 : len;
+}
+
+char *PayloadWriter::c_str()
+{
+  return buffer;
+}
+
+// "<key>=", preceded by '&' but for the first field
+void PayloadWriter::addKey(char key)
+{
+  if (len > 0)
+    addChar('&');
+
+  addChar(key);
+  addChar('=');
+}
+
+// Keeps room for the terminator
+void PayloadWriter::addChar(char c)
+{
+  if (overflow)
+    return;
+
+  if (len + 1 >= size)
+  {
+    overflow = true;
+    return;
+  }
+
+  buffer[len++] = c;
+}
+
+// NOTE: an overflowed payload is left empty
+void PayloadWriter::terminate()
+{
+  if (size > 0)
+    buffer[overflow ? 0 : len] = '\0';
+}
+
+// Decimal digits, zero padded to minDigits
+void PayloadWriter::addUnsigned(uint32_t value, uint8_t minDigits)
+{
+  char digits[10];
+  uint8_t count = 0;
+
+  do
+  {
+    digits[count++] = '0' + value % 10;
+    value /= 10;
+  }
+  while (value > 0);
+
+  while (count < minDigits && count < sizeof(digits))
+    digits[count++] = '0';
+
+  while (count > 0)
+    addChar(digits[--count]);
+}
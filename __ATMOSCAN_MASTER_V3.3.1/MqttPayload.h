@@ -0,0 +1,61 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <Arduino.h>
+
+#define MQTT_PAYLOAD_SIZE 128       // Bytes, including terminator
+#define MQTT_PAYLOAD_FIELDS 8       // ThingSpeak channel fields
+
+struct SampleRecord;
+
+// One field of an MQTT topic payload ("<field>=<value>")
+// NOTE: getters are given the sample being published (NULL for live-only topics)
+struct PayloadField
+{
+  uint8_t topic;                      // 1..3, as in the configuration
+  uint8_t field;                      // 1..MQTT_PAYLOAD_FIELDS
+  float (*getter)(const SampleRecord *sample);
+  uint8_t precision;                  // Decimals
+};
+
+// Number of fields of a topic in a schema table (compile time)
+constexpr int payloadFieldCount(const PayloadField *table, int size, uint8_t topic)
+{
+  return size == 0 ? 0 : (table->topic == topic ? 1 : 0) + payloadFieldCount(table + 1, size - 1, topic);
+}
+
+// Serializes "1=..&2=..&created_at=.." into a caller's buffer, in a single pass.
+// Anything that does not fit marks the payload as overflowed: it must then not be sent.
+class PayloadWriter
+{
+  public:
+    PayloadWriter(char *buffer, size_t size);
+
+    // All fields of a topic, from a schema table in PROGMEM
+    void add(const PayloadField *table, size_t count, uint8_t topic, const SampleRecord *sample);
+
+    void add(uint8_t field, float value, uint8_t precision);
+    void add(uint8_t field, uint32_t value);
+    void addTimestamp(uint32_t timestamp);      // UTC
+
+    bool isOverflow();
+    size_t length();
+    char *c_str();
+
+  private:
+    char *buffer;
+    size_t size;
+    size_t len = 0;
+    bool overflow = false;
+
+    void addKey(char key);
+    void addChar(char c);
+    void addUnsigned(uint32_t value, uint8_t minDigits);
+    void terminate();
+};
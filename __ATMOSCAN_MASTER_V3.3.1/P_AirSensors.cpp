@@ -12,6 +12,8 @@
 
 #include "P_AirSensors.h"
 #include "GlobalDefinitions.h"
+#include "ProcessProfiler.h"
+#include "History.h"
 
 // External variables
 extern Syslog syslog;
@@ -30,10 +32,19 @@ void errLog(String msg);
 // Particle sensor PMS7003 definitions
 #define PMS7003_COMMAND_SIZE 7
 #define PMS7003_RESPONSE_SIZE 32
+#define PMS7003_TIMEOUT 2000        // (ms)
+#define PMS7003_MODE_DELAY 1000     // (ms) For a mode command to take effect
+#define PMS7003_INIT_ATTEMPTS 3
+#define PMS7003_WARMUP 30000        // (ms) For the fan to stabilise after power up or wake up (datasheet: at least 30 sec)
 
 // CO2 Sensor MH-Z19 definitions
 #define MHZ19_COMMAND_SIZE 9
 #define MHZ19_RESPONSE_SIZE 9
+#define MHZ19_TIMEOUT 1000          // (ms)
+#define MHZ19_INIT_ATTEMPTS 5
+
+// MultiGas sensor MiCS6814 definitions
+#define MULTIGAS_POWERUP_DELAY 1000 // (ms)
 
 // Temperature sensor definitions
 #define TEMPERATURE_ADJUSTMENT_FACTOR -0.4 // NOTE: empirical correction based on observations, TBC
@@ -54,9 +65,7 @@ static const byte MHZ19_cmdRead[9] = {0xFF, 0x01, 0x86, 0x00, 0x00, 0x00, 0x00,
 // -------------------------------------------------------
 
 Proc_ComboTemperatureHumiditySensor::Proc_ComboTemperatureHumiditySensor(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations)
-  :  Process(manager, pr, period, iterations),
-     avgTemperature(AVERAGING_WINDOW),
-     avgHumidity(AVERAGING_WINDOW) {}
+  :  Process(manager, pr, period, iterations) {}
 
 void Proc_ComboTemperatureHumiditySensor::setup()
 {
@@ -102,10 +111,14 @@ void Proc_ComboTemperatureHumiditySensor::setup()
   // initialize average
   avgHumidity.push(hum);
 
+  initialised = true;
 }
 
 void Proc_ComboTemperatureHumiditySensor::service()
 {
+  // Profile this run
+  ProcessProfiler::Run profile(this);
+
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, "Proc_ComboTemperatureHumiditySensor::service()");
 #endif
@@ -153,6 +166,10 @@ void Proc_ComboTemperatureHumiditySensor::service()
   avgTemperature.push(temp + TEMPERATURE_ADJUSTMENT_FACTOR);
   avgHumidity.push(humidity);
 
+  // History
+  history.add(METRIC_TEMPERATURE, temp + TEMPERATURE_ADJUSTMENT_FACTOR);
+  history.add(METRIC_HUMIDITY, humidity);
+
 }
 
 float Proc_ComboTemperatureHumiditySensor::getTemperature()
@@ -160,10 +177,20 @@ float Proc_ComboTemperatureHumiditySensor::getTemperature()
   return avgTemperature.mean();
 }
 
+SensorStats &Proc_ComboTemperatureHumiditySensor::getTemperatureStats()
+{
+  return avgTemperature;
+}
+
 float Proc_ComboTemperatureHumiditySensor::getHumidity()
 {
   return avgHumidity.mean();
 }
+
+SensorStats &Proc_ComboTemperatureHumiditySensor::getHumidityStats()
+{
+  return avgHumidity;
+}
 // END Combo Temperature & Umidity Sensor wrapper (HDC1080)
 
 
@@ -172,10 +199,7 @@ float Proc_ComboTemperatureHumiditySensor::getHumidity()
 // -------------------------------------------------------
 
 Proc_ComboPressureHumiditySensor::Proc_ComboPressureHumiditySensor(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations)
-  :  Process(manager, pr, period, iterations),
-     avgPressure(AVERAGING_WINDOW),
-     avgHumidity(AVERAGING_WINDOW),
-     avgTemperature(AVERAGING_WINDOW)
+  :  Process(manager, pr, period, iterations)
 {
 }
 
@@ -199,10 +223,22 @@ void Proc_ComboPressureHumiditySensor::setup()
     // Disable process
     this->disable();
   }
+  else
+  {
+    // first reading, to initialise averages
+    avgPressure.push(bme.readPressure() / 100.0F);
+    avgHumidity.push(bme.readHumidity());
+    avgTemperature.push(bme.readTemperature());
+  }
+
+  initialised = true;
 }
 
 void Proc_ComboPressureHumiditySensor::service()
 {
+  // Profile this run
+  ProcessProfiler::Run profile(this);
+
   // syslog.log(LOG_DEBUG, "2 - BME280");
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, "Proc_ComboPressureHumiditySensor::service()");
@@ -217,6 +253,9 @@ void Proc_ComboPressureHumiditySensor::service()
   avgHumidity.push(humidity);
   avgTemperature.push(temperature);
 
+  // History (temperature and humidity come from the HDC1080)
+  history.add(METRIC_PRESSURE, pressure);
+
 }
 
 
@@ -225,15 +264,30 @@ float Proc_ComboPressureHumiditySensor::getPressure()
   return avgPressure.mean();
 }
 
+SensorStats &Proc_ComboPressureHumiditySensor::getPressureStats()
+{
+  return avgPressure;
+}
+
 float Proc_ComboPressureHumiditySensor::getHumidity()
 {
   return avgHumidity.mean();
 }
 
+SensorStats &Proc_ComboPressureHumiditySensor::getHumidityStats()
+{
+  return avgHumidity;
+}
+
 float Proc_ComboPressureHumiditySensor::getTemperature()
 {
   return avgTemperature.mean();
 }
+
+SensorStats &Proc_ComboPressureHumiditySensor::getTemperatureStats()
+{
+  return avgTemperature;
+}
 // END Pressure Sensor process (BME280)
 
 
@@ -243,8 +297,9 @@ float Proc_ComboPressureHumiditySensor::getTemperature()
 
 Proc_CO2Sensor::Proc_CO2Sensor(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations)
   :  Process(manager, pr, period, iterations),
-     avgCO2(AVERAGING_WINDOW),
-     co2Serial(CO2_RX_PIN, CO2_TX_PIN, false, 256)
+     co2Serial(CO2_RX_PIN, CO2_TX_PIN, false, 256),
+     co2Reader(co2Serial, 0xFF, 0x86, MHZ19_RESPONSE_SIZE),
+     samplePeriod(period)
 {
 }
 
@@ -255,94 +310,79 @@ void Proc_CO2Sensor::setup()
 #endif
 
 
-  // Test whether sensor is readable
-  for (int attempts = 0; attempts < 5; attempts++)
-  {
-
-    // Initialise SoftwareSerial for CO2 sensor MH-Z19
-    co2Serial.begin(9600);
-    co2Serial.enableIntTx(false);
-
-    // Wait a bit to make SURE a sampling cycle (5s) elapses
-    // delay (6000);
-
-    // Discard spurious data
-    co2Serial.flush();
-
-    // Test sensor functionality
-    service();
-
-    // If data is read correctly, we are done
-    if (!readError)
-      return;
-
-    errLog(F("Init err CO2 sensor, retrying"));
-
-    // Wait a bit and retry
-    delay(1000 + 2000 * attempts);
-  }
+  // Initialise SoftwareSerial for CO2 sensor MH-Z19
+  co2Serial.begin(9600);
+  co2Serial.enableIntTx(false);
 
-  // Attempts exausted without a successful read
-  // There was a problem detecting the sensor
-  errLog(F("Err MH-Z19 - disabled"));
-
-  // Set invalid reading
-  avgCO2.push(0);
-
-  // Disable process
-  this->disable();
+  // Whether the sensor is readable is tested by the first runs, the boot does not wait for it
+  initAttempts = 0;
+  this->setPeriod(SENSOR_POLL_PERIOD);
 }
 
 void Proc_CO2Sensor::service()
 {
+  // Profile this run
+  ProcessProfiler::Run profile(this);
+
 
   // syslog.log(LOG_DEBUG, "3 - MH-Z19");
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, "Proc_CO2Sensor::service()");
 #endif
 
-  unsigned char Buffer[MHZ19_RESPONSE_SIZE];
+  FrameStatus status = co2Reader.poll();
 
-  // Reset error conditions
-  readError = false;
-
-  // Clear buffer for any spurious data received since last reading
-  co2Serial.flush();
+  // Response still incoming, check again at next poll
+  if (status == FRAME_PENDING)
+    return;
 
-  //request PPM CO2
-  co2Serial.write(MHZ19_cmdRead, MHZ19_COMMAND_SIZE);
+  // Response complete (or given up): process it and go back to the sampling period
+  if (status != FRAME_IDLE)
+  {
+    readResponse(status);
+    this->setPeriod(samplePeriod);
 
-  // Read response
-  co2Serial.readBytes(Buffer, MHZ19_RESPONSE_SIZE);
+    // Still testing whether the sensor is readable
+    if (!initialised)
+      checkInit();
+    return;
+  }
 
-  //  PRINT BUFFER
-#ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, "CO2 sensor response - " + bytes2hex(Buffer, MHZ19_RESPONSE_SIZE));
-#endif
+  // Time to sample: request PPM CO2 and poll for the response
+  co2Reader.request(MHZ19_cmdRead, MHZ19_COMMAND_SIZE, MHZ19_TIMEOUT);
+  this->setPeriod(SENSOR_POLL_PERIOD);
+}
 
-  if (Buffer[0] != 0xFF)
-  {
-    errLog(F("CO2 Sensor - Wrong starting byte"));
+void Proc_CO2Sensor::readResponse(FrameStatus status)
+{
+  unsigned char *Buffer = co2Reader.getFrame();
 
-    // empty buffer
-    //co2Serial.readBytes(Buffer, MHZ19_RESPONSE_SIZE * 2);
+  // Ready for next request
+  co2Reader.reset();
 
+  if (status != FRAME_READY)
+  {
+    errLog(F("CO2 Sensor - timeout"));
     readError = true;
-
-    return ;
+    return;
   }
 
-  if (Buffer[1] != 0x86)
-  {
-    delay(1000);
-    errLog(F("CO2 Sensor - Wrong command"));
+  //  PRINT BUFFER
+#ifdef DEBUG_SYSLOG
+  syslog.log(LOG_DEBUG, "CO2 sensor response - " + bytes2hex(Buffer, MHZ19_RESPONSE_SIZE));
+#endif
 
-    // empty buffer
-    // co2Serial.readBytes(Buffer, MHZ19_RESPONSE_SIZE * 2);
+  // Checksum is the two's complement of the sum of bytes 1 to 7
+  byte checksum = 0;
+  for (int i = 1; i < MHZ19_RESPONSE_SIZE - 1; i++)
+    checksum += Buffer[i];
+  checksum = 0xFF - checksum + 1;
 
+  if (Buffer[MHZ19_RESPONSE_SIZE - 1] != checksum)
+  {
+    errLog(F("CO2 Sensor - Checksum wrong"));
     readError = true;
-
-    return ;
+    return;
   }
 
 #ifdef DEBUG_SYSLOG
@@ -356,14 +396,51 @@ void Proc_CO2Sensor::service()
 
   // UpdateAverage
   avgCO2.push(co2);
+  history.add(METRIC_CO2, co2);
 
   readError = false;
 }
 
+// Outcome of a reading taken to test the sensor
+void Proc_CO2Sensor::checkInit()
+{
+  // If data is read correctly, we are done
+  if (!readError)
+  {
+    initialised = true;
+    return;
+  }
+
+  if (++initAttempts < MHZ19_INIT_ATTEMPTS)
+  {
+    errLog(F("Init err CO2 sensor, retrying"));
+
+    // Wait a bit and retry
+    this->setPeriod(1000 + 2000 * (initAttempts - 1));
+    return;
+  }
+
+  // Attempts exausted without a successful read
+  // There was a problem detecting the sensor
+  errLog(F("Err MH-Z19 - disabled"));
+
+  // Set invalid reading
+  avgCO2.push(0);
+  initialised = true;
+
+  // Disable process
+  this->disable();
+}
+
 float Proc_CO2Sensor::getCO2()
 {
   return avgCO2.mean();
 }
+
+SensorStats &Proc_CO2Sensor::getCO2Stats()
+{
+  return avgCO2;
+}
 // END CO2 Sensor process (MH-Z19)
 
 
@@ -374,9 +451,8 @@ float Proc_CO2Sensor::getCO2()
 
 Proc_ParticleSensor::Proc_ParticleSensor(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations)
   :  Process(manager, pr, period, iterations),
-     avgPM01(AVERAGING_WINDOW),
-     avgPM2_5(AVERAGING_WINDOW),
-     avgPM10(AVERAGING_WINDOW)
+     pmsReader(Serial, 0x42, 0x4d, PMS7003_RESPONSE_SIZE),
+     samplePeriod(period)
 {
 }
 
@@ -386,145 +462,250 @@ void Proc_ParticleSensor::setup()
   syslog.log(LOG_DEBUG, "Proc_ParticleSensor::setup()");
 #endif
 
-  unsigned char Buffer[256];
-
   // Setup HW serial for particle sensor PMS7003
   Serial.begin(9600);
-  Serial.setTimeout(3000);
 
+  // Whether the sensor is readable is tested by the first runs, the boot does not wait for it
+  initAttempts = 0;
+  passiveMode = false;
+  this->setPeriod(SENSOR_POLL_PERIOD);
 
-  // Test whether sensor is readable
-  for (int attempts = 0; attempts < 3; attempts++)
-  {
+  // Fan started at power up
+  asleep = false;
+  wakeTime = millis();
+}
+
+void Proc_ParticleSensor::service()
+{
+  // Profile this run
+  ProcessProfiler::Run profile(this);
 
+  // syslog.log(LOG_DEBUG, "4 - PMS7003");
+#ifdef DEBUG_SYSLOG
+  syslog.log(LOG_DEBUG, F("Proc_ParticleSensor::service()"));
+#endif
+
+  // Set passive mode first, and give the command time to take effect
+  if (!passiveMode)
+  {
 #ifdef DEBUG_SYSLOG
     syslog.log(LOG_DEBUG, "PMS7003 SETTING PASSIVE MODE");
 #endif
 
-    // Set passive mode command
     Serial.write(PMS7003_cmdPassiveEnable, PMS7003_COMMAND_SIZE);
     Serial.flush();
 
-    // Wait for command to take effect
-    delay(1000);
+    passiveMode = true;
+    this->setPeriod(PMS7003_MODE_DELAY);
+    return;
+  }
+
+  // Start of a cycle: wake up, readings are taken once the fan is stable
+  if (asleep)
+  {
+    Serial.write(PMS7003_cmdWakeup, PMS7003_COMMAND_SIZE);
+    Serial.flush();
+
+    asleep = false;
+    wakeTime = millis();
+    burstReads = 0;
+    burstAttempts = 0;
+    this->setPeriod(PMS7003_WARMUP);
+    return;
+  }
+
+  FrameStatus status = pmsReader.poll();
 
-    // Test sensor functionality
-    service();
+  // Response still incoming, check again at next poll
+  if (status == FRAME_PENDING)
+    return;
+
+  // Response complete (or given up): process it, then on to the next reading
+  if (status != FRAME_IDLE)
+  {
+    readResponse(status);
 
-    // If data is read correctly, we are done
-    if (!readError)
+    // Still testing whether the sensor is readable (retried, or given up on, if not)
+    if (!initialised)
     {
-      return;
+      checkInit();
+      if (readError)
+        return;
     }
 
-    errLog(F("Init err PMS7003 sensor, retrying"));
+    // Only valid frames complete the burst
+    if (millis() - wakeTime >= PMS7003_WARMUP)
+    {
+      burstAttempts++;
+      if (!readError)
+        burstReads++;
+    }
 
-    // Wait a bit and retry
-    delay(1000 + 1000 * attempts);
+    scheduleNext();
+    return;
   }
 
-  // Attempts exausted without a successful read
-  // There was a problem detecting the sensor
-  errLog(F("Err PMS7003 - disabled"));
-
-  // Set invalid reading
-  avgPM01.push(0);
-  avgPM2_5.push(0);
-  avgPM10.push(0);
-
-  // Disable process
-  this->disable();
+  // Run a bit early (the scheduler counts periods from when runs were due): the fan is not stable yet
+  if (initialised && millis() - wakeTime < PMS7003_WARMUP)
+  {
+    scheduleNext();
+    return;
+  }
 
+  // Time to sample: send READ command and poll for the response
+  pmsReader.request(PMS7003_cmdPassiveRead, PMS7003_COMMAND_SIZE, PMS7003_TIMEOUT);
+  this->setPeriod(SENSOR_POLL_PERIOD);
 }
 
-void Proc_ParticleSensor::service()
+void Proc_ParticleSensor::readResponse(FrameStatus status)
 {
-  // syslog.log(LOG_DEBUG, "4 - PMS7003");
-#ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, F("Proc_ParticleSensor::service()"));
-#endif
+  unsigned char *Buffer = pmsReader.getFrame();
 
-  unsigned char Buffer[PMS7003_RESPONSE_SIZE];
-
-  // Reset error conditions
-  readError = false;
+  // Ready for next request
+  pmsReader.reset();
 
-  // Clear serial input buffer from spurious characters
-  while (Serial.available() > 0)
+  if (status != FRAME_READY)
   {
-
-#ifdef DEBUG_SYSLOG
-    syslog.log(LOG_DEBUG, F("Clearing PMS serial buffer"));
-#endif
-
-    Serial.read();
+    errLog(F("Particle sensor -  timeout"));
+    readError = true;
+    return;
   }
 
-  // Send READ command
-  Serial.write(PMS7003_cmdPassiveRead, PMS7003_COMMAND_SIZE);
-  Serial.flush();
-
-  // Receive response
-  Serial.readBytes(Buffer, PMS7003_RESPONSE_SIZE);
-
   // PRINT BUFFER
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, "Particle sensor response - " + bytes2hex(Buffer, PMS7003_RESPONSE_SIZE));
 #endif
 
-  //start to read when detect 0x42 0x4d
-  if (Buffer[0] == 0x42 && Buffer[1] == 0x4d)
+  // Is checksum ok?
+  if (verifyChecksum(Buffer, PMS7003_RESPONSE_SIZE))
   {
 #ifdef DEBUG_SYSLOG
-    syslog.log(LOG_DEBUG, F("Particle sensor - header OK"));
+    syslog.log(LOG_DEBUG, F("Buffer valid"));
 #endif
+    readError = false;
 
-    // Is checksum ok?
-    if (verifyChecksum(Buffer, PMS7003_RESPONSE_SIZE))
-    {
-#ifdef DEBUG_SYSLOG
-      syslog.log(LOG_DEBUG, F("Buffer valid"));
-#endif
-      // Get values
-      int PM01 = extractPM01(Buffer);
-      int PM2_5 = extractPM2_5(Buffer);
-      int PM10 = extractPM10(Buffer);
+    // Low and noisy until the fan is stable: the frame only tells the sensor is there
+    if (millis() - wakeTime < PMS7003_WARMUP)
+      return;
 
-      // Average
-      avgPM01.push(PM01);    //count PM1.0 value of the air detector module
-      avgPM2_5.push(PM2_5);  //count PM2.5 value of the air detector module
-      avgPM10.push(PM10);    //count PM10 value of the air detector module
+    // Get values
+    int PM01 = extractPM01(Buffer);
+    int PM2_5 = extractPM2_5(Buffer);
+    int PM10 = extractPM10(Buffer);
 
-      readError = false;
+    // Average
+    avgPM01.push(PM01);    //count PM1.0 value of the air detector module
+    avgPM2_5.push(PM2_5);  //count PM2.5 value of the air detector module
+    avgPM10.push(PM10);    //count PM10 value of the air detector module
 
-    }
-    else
-    {
-      errLog(F("Particle sensor - Checksum wrong"));
-      readError = true;
-    }
+    // History
+    history.add(METRIC_PM01, PM01);
+    history.add(METRIC_PM2_5, PM2_5);
+    history.add(METRIC_PM10, PM10);
   }
   else
   {
-    errLog(F("Particle sensor -  timeout"));
+    errLog(F("Particle sensor - Checksum wrong"));
     readError = true;
   }
 }
 
 
+// After a reading: rest of the warm up, next reading of the burst, or asleep until the next cycle
+void Proc_ParticleSensor::scheduleNext()
+{
+  unsigned long awakeFor = millis() - wakeTime;
+
+  if (awakeFor < PMS7003_WARMUP)
+    this->setPeriod(PMS7003_WARMUP - awakeFor);
+
+  else if (PMS7003_CYCLE_PERIOD == 0)
+    this->setPeriod(samplePeriod);
+
+  // NOTE: a sensor that keeps failing does not keep the fan on
+  else if (burstReads < PMS7003_BURST_READS && burstAttempts < 2 * PMS7003_BURST_READS)
+    this->setPeriod(PMS7003_BURST_PERIOD);
+
+  else
+  {
+    // Fan and laser off
+    Serial.write(PMS7003_cmdSleep, PMS7003_COMMAND_SIZE);
+    Serial.flush();
+
+    // Cycles counted from the wake up
+    asleep = true;
+    this->setPeriod(awakeFor < PMS7003_CYCLE_PERIOD ? PMS7003_CYCLE_PERIOD - awakeFor : PMS7003_BURST_PERIOD);
+  }
+}
+
+// Outcome of a reading taken to test the sensor
+void Proc_ParticleSensor::checkInit()
+{
+  // If data is read correctly, we are done
+  if (!readError)
+  {
+    initialised = true;
+    return;
+  }
+
+  if (++initAttempts < PMS7003_INIT_ATTEMPTS)
+  {
+    errLog(F("Init err PMS7003 sensor, retrying"));
+
+    // Wait a bit and retry, from the passive mode command
+    passiveMode = false;
+    this->setPeriod(1000 + 1000 * (initAttempts - 1));
+    return;
+  }
+
+  // Attempts exausted without a successful read
+  // There was a problem detecting the sensor
+  errLog(F("Err PMS7003 - disabled"));
+
+  // Set invalid reading
+  avgPM01.push(0);
+  avgPM2_5.push(0);
+  avgPM10.push(0);
+  initialised = true;
+
+  // Disable process
+  this->disable();
+}
+
 float Proc_ParticleSensor::getPM01()
 {
-  return avgPM01.mean();
+  return hasData() ? avgPM01.mean() : NAN;
+}
+
+SensorStats &Proc_ParticleSensor::getPM01Stats()
+{
+  return avgPM01;
 }
 
 float Proc_ParticleSensor::getPM2_5()
 {
-  return avgPM2_5.mean();
+  return hasData() ? avgPM2_5.mean() : NAN;
+}
+
+SensorStats &Proc_ParticleSensor::getPM2_5Stats()
+{
+  return avgPM2_5;
 }
 
 float Proc_ParticleSensor::getPM10()
 {
-  return avgPM10.mean();
+  return hasData() ? avgPM10.mean() : NAN;
+}
+
+// Nothing is averaged during the first warm up after boot
+bool Proc_ParticleSensor::hasData()
+{
+  return avgPM2_5.getCount() > 0;
+}
+
+SensorStats &Proc_ParticleSensor::getPM10Stats()
+{
+  return avgPM10;
 }
 
 char Proc_ParticleSensor::verifyChecksum(unsigned char *thebuf, int leng)
@@ -577,9 +758,7 @@ int Proc_ParticleSensor::extractPM10(unsigned char *thebuf)
 // -------------------------------------------------------
 
 Proc_VOCSensor::Proc_VOCSensor(Scheduler & manager, ProcPriority pr, unsigned int period, int iterations)
-  :  Process(manager, pr, period, iterations),
-     //avgVOC(AVERAGING_WINDOW)
-     avgVOC(60)
+  :  Process(manager, pr, period, iterations)
 {
 }
 
@@ -588,10 +767,18 @@ void Proc_VOCSensor::setup()
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, F("Proc_VOCSensor::setup()"));
 #endif
+
+  // first reading, to initialise average
+  avgVOC.push(analogRead(VOC_PIN));
+
+  initialised = true;
 }
 
 void Proc_VOCSensor::service()
 {
+  // Profile this run
+  ProcessProfiler::Run profile(this);
+
   // syslog.log(LOG_DEBUG,F("5 - VOC");
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, F("Proc_VOCSensor::service()"));
@@ -602,12 +789,18 @@ void Proc_VOCSensor::service()
 
   // Average
   avgVOC.push(voc);
+  history.add(METRIC_VOC, voc);
 }
 
 float Proc_VOCSensor::getVOC()
 {
   return avgVOC.mean();
 }
+
+SensorStats &Proc_VOCSensor::getVOCStats()
+{
+  return avgVOC;
+}
 // END VOC Sensor process (Grove - Air quality sensor v1.3)
 
 // -------------------------------------------------------
@@ -617,10 +810,7 @@ float Proc_VOCSensor::getVOC()
 Proc_GeigerSensor *Proc_GeigerSensor::instance = nullptr;
 
 Proc_GeigerSensor::Proc_GeigerSensor(Scheduler & manager, ProcPriority pr, unsigned int period, int iterations)
-  :  Process(manager, pr, period, iterations),
-     avgCPM(AVERAGING_WINDOW * 2),  // moving average over 1 minute
-     avgRAD(15)                     // moving average over 15 minutes
-
+  :  Process(manager, pr, period, iterations)
 {
 }
 
@@ -636,10 +826,16 @@ void Proc_GeigerSensor::setup()
   pinMode(GEIGER_INTERRUPT_PIN, INPUT);
   attachInterrupt(digitalPinToInterrupt(GEIGER_INTERRUPT_PIN), onTubeEventISR, RISING);
   counts = 0;
+
+  // Counting from now on
+  initialised = true;
 }
 
 void Proc_GeigerSensor::service()
 {
+  // Profile this run
+  ProcessProfiler::Run profile(this);
+
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, F("Proc_GeigerSensor::service()"));
 #endif
@@ -677,6 +873,10 @@ void Proc_GeigerSensor::service()
       // Good run, record it
       avgCPM.push(thisCPM);
 
+      // History (radiation from the instant CPM, averaged per minute there)
+      history.add(METRIC_CPM, thisCPM);
+      history.add(METRIC_RADIATION, thisCPM / LND712_CONV_FACTOR);
+
       // Smoothen Radiation measurement
       if (radAvgDelay == 0) // every minute
       {
@@ -703,11 +903,21 @@ float Proc_GeigerSensor::getCPM()
   return avgCPM.mean();
 }
 
+SensorStats &Proc_GeigerSensor::getCPMStats()
+{
+  return avgCPM;
+}
+
 float Proc_GeigerSensor::getRadiation()
 {
   return avgRAD.mean() / LND712_CONV_FACTOR;
 }
 
+SensorStats &Proc_GeigerSensor::getRadiationStats()
+{
+  return avgRAD;
+}
+
 void Proc_GeigerSensor::onTubeEventISR()
 {
   instance->onTubeEvent();
@@ -729,14 +939,7 @@ void Proc_GeigerSensor::onTubeEvent()
 
 Proc_MultiGasSensor::Proc_MultiGasSensor(Scheduler & manager, ProcPriority pr, unsigned int period, int iterations)
   :  Process(manager, pr, period, iterations),
-     avgCO(AVERAGING_WINDOW),
-     avgNO2(AVERAGING_WINDOW)
-     //     avgNH3(AVERAGING_WINDOW),
-     //     avgC3H8(AVERAGING_WINDOW),
-     //     avgC4H10(AVERAGING_WINDOW),
-     //     avgCH4(AVERAGING_WINDOW),
-     //     avgH2(AVERAGING_WINDOW),
-     //     avgC2H5OH(AVERAGING_WINDOW)
+     samplePeriod(period)
 {
 }
 
@@ -758,6 +961,7 @@ void Proc_MultiGasSensor::setup()
     // Set invalid reading
     avgCO.push(0);
     avgNO2.push(0);
+    initialised = true;
 
     // Disable process
     this->disable();
@@ -770,37 +974,51 @@ void Proc_MultiGasSensor::setup()
   gas.begin(0x04); //the default I2C address of the slave is 0x04
 
   gas.powerOn();
-  delay(1000);
-  unsigned char firmwareVersion = gas.getVersion();
 
-#ifdef DEBUG_SYSLOG
-  syslog.log(LOG_INFO, String(F("MultiGas firmware Version = " )) + String(firmwareVersion));
-#endif
-  if (firmwareVersion != 2)
-  {
-    errLog(F("MultiGas firmware mismatch - Sensor disabled"));
-
-    // Set invalid reading
-    //    avgNH3.push(0);
-    avgCO.push(0);
-    avgNO2.push(0);
-    //    avgC3H8.push(0);
-    //    avgC4H10.push(0);
-    //    avgCH4.push(0);
-    //    avgH2.push(0);
-    //    avgC2H5OH.push(0);
-
-    // Disable process
-    this->disable();
-  }
+  // Firmware checked by the first run, once powered up
+  this->setPeriod(MULTIGAS_POWERUP_DELAY);
 }
 
 void Proc_MultiGasSensor::service()
 {
+  // Profile this run
+  ProcessProfiler::Run profile(this);
+
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, F("Proc_MultiGasSensor::service()"));
 #endif
 
+  // First run after power up
+  if (!initialised)
+  {
+    initialised = true;
+    this->setPeriod(samplePeriod);
+
+    unsigned char firmwareVersion = gas.getVersion();
+
+#ifdef DEBUG_SYSLOG
+    syslog.log(LOG_INFO, String(F("MultiGas firmware Version = " )) + String(firmwareVersion));
+#endif
+    if (firmwareVersion != 2)
+    {
+      errLog(F("MultiGas firmware mismatch - Sensor disabled"));
+
+      // Set invalid reading
+      //    avgNH3.push(0);
+      avgCO.push(0);
+      avgNO2.push(0);
+      //    avgC3H8.push(0);
+      //    avgC4H10.push(0);
+      //    avgCH4.push(0);
+      //    avgH2.push(0);
+      //    avgC2H5OH.push(0);
+
+      // Disable process
+      this->disable();
+      return;
+    }
+  }
+
   // float nh3;
   float co;
   float no2;
@@ -822,7 +1040,10 @@ void Proc_MultiGasSensor::service()
 
   // Average
   if (co >= 0)
+  {
     avgCO.push(co);
+    history.add(METRIC_CO, co);
+  }
 
 #ifdef DEBUG_SYSLOG
   else
@@ -830,7 +1051,10 @@ void Proc_MultiGasSensor::service()
 #endif
 
   if (no2 >= 0)
+  {
     avgNO2.push(no2);
+    history.add(METRIC_NO2, no2);
+  }
 
   /*
     #ifdef DEBUG_SYSLOG
@@ -894,11 +1118,21 @@ float Proc_MultiGasSensor::getCO()
   return avgCO.mean();
 }
 
+SensorStats &Proc_MultiGasSensor::getCOStats()
+{
+  return avgCO;
+}
+
 float Proc_MultiGasSensor::getNO2()
 {
   return avgNO2.mean();
 }
 
+SensorStats &Proc_MultiGasSensor::getNO2Stats()
+{
+  return avgNO2;
+}
+
 /*
   float Proc_MultiGasSensor::getNH3()
   {
@@ -940,6 +1174,77 @@ float Proc_MultiGasSensor::getNO2()
 // Shared methods
 // -------------------------------------------------------
 
+// -------------------------------------------------------
+// Serial sensor frame reader
+// -------------------------------------------------------
+
+SensorFrameReader::SensorFrameReader(Stream &port, byte header0, byte header1, int frameSize)
+  : port(port), frameSize(frameSize)
+{
+  header[0] = header0;
+  header[1] = header1;
+}
+
+// Sends a command, the response is then collected by poll()
+void SensorFrameReader::request(const byte *command, int commandSize, unsigned long timeout)
+{
+  // Discard spurious data received since last reading
+  while (port.available() > 0)
+    port.read();
+
+  port.write(command, commandSize);
+
+  this->timeout = timeout;
+  requestTime = millis();
+  received = 0;
+  status = FRAME_PENDING;
+}
+
+FrameStatus SensorFrameReader::poll()
+{
+  if (status != FRAME_PENDING)
+    return status;
+
+  while (port.available() > 0 && received < frameSize)
+  {
+    byte b = port.read();
+
+    // Synchronise on the frame header, skipping any garbage
+    if (received < 2 && b != header[received])
+    {
+      received = (b == header[0]) ? 1 : 0;
+      if (received)
+        frame[0] = b;
+      continue;
+    }
+
+    frame[received++] = b;
+  }
+
+  if (received == frameSize)
+    status = FRAME_READY;
+  else if (millis() - requestTime >= timeout)
+    status = FRAME_TIMEOUT;
+
+  return status;
+}
+
+void SensorFrameReader::reset()
+{
+  received = 0;
+  status = FRAME_IDLE;
+}
+
+unsigned char *SensorFrameReader::getFrame()
+{
+  return frame;
+}
+
+bool BaseSensor::isInitialised()
+{
+  return initialised;
+}
+
 String BaseSensor::bytes2hex(unsigned char buf[], int len)
 {
   char onebyte[2];
@@ -7,24 +7,69 @@
 
 #pragma once
 
-#include <Average.h>                // https://github.com/MajenkoLibraries/Average
 #include <ProcessScheduler.h>       // https://github.com/wizard97/ArduinoProcessScheduler
 #include <ClosedCube_HDC1080.h>     // https://github.com/MarcFinns/ClosedCube_HDC1080_Arduino
 #include <Adafruit_BME280.h>        // https://github.com/adafruit/Adafruit_BME280_Library
 #include <SoftwareSerial.h>         // https://github.com/plerup/espsoftwareserial
 
+#include "RunningStats.h"
+
 // -------------------------------------------------------
 // BASE Sensor
 // -------------------------------------------------------
 
 class BaseSensor
 {
+  public:
+    // First reading taken, or sensor given up on
+    bool isInitialised();
+
   protected:
+    bool initialised = false;
+
     // methods
     String bytes2hex(unsigned char buf[], int len);
 };
 // END BASE Sensor
 
+// -------------------------------------------------------
+// Serial sensor frame reader
+// -------------------------------------------------------
+
+#define SENSOR_FRAME_MAX_SIZE 32
+#define SENSOR_POLL_PERIOD 20       // (ms) Used while waiting for a sensor response
+
+enum FrameStatus
+{
+  FRAME_IDLE,
+  FRAME_PENDING,
+  FRAME_READY,
+  FRAME_TIMEOUT
+};
+
+// Incremental reader of fixed size response frames: consumes whatever bytes
+// are available and never waits for the rest
+class SensorFrameReader
+{
+  public:
+    SensorFrameReader(Stream &port, byte header0, byte header1, int frameSize);
+    void request(const byte *command, int commandSize, unsigned long timeout);
+    FrameStatus poll();
+    void reset();
+    unsigned char *getFrame();
+
+  private:
+    Stream &port;
+    byte header[2];
+    int frameSize;
+    int received = 0;
+    unsigned char frame[SENSOR_FRAME_MAX_SIZE];
+    unsigned long requestTime = 0;
+    unsigned long timeout = 0;
+    FrameStatus status = FRAME_IDLE;
+};
+// END Serial sensor frame reader
+
 // -------------------------------------------------------
 //  Combo Temperature & Umidity Sensor wrapper (HDC1080)
 // -------------------------------------------------------
@@ -36,6 +81,8 @@ class Proc_ComboTemperatureHumiditySensor: public Process, public BaseSensor
     Proc_ComboTemperatureHumiditySensor(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations);
     float getTemperature();
     float getHumidity();
+    SensorStats &getTemperatureStats();
+    SensorStats &getHumidityStats();
 
 
   protected:
@@ -44,8 +91,8 @@ class Proc_ComboTemperatureHumiditySensor: public Process, public BaseSensor
 
   private:
     // Properties
-    Average<float> avgTemperature;
-    Average<float> avgHumidity;
+    RunningStats<float, AVERAGING_WINDOW> avgTemperature;
+    RunningStats<float, AVERAGING_WINDOW> avgHumidity;
     ClosedCube_HDC1080 hdc1080;
 
 
@@ -65,6 +112,9 @@ class Proc_ComboPressureHumiditySensor: public Process, public BaseSensor
     float getPressure();
     float getHumidity();
     float getTemperature();
+    SensorStats &getPressureStats();
+    SensorStats &getHumidityStats();
+    SensorStats &getTemperatureStats();
 
 
   protected:
@@ -73,9 +123,9 @@ class Proc_ComboPressureHumiditySensor: public Process, public BaseSensor
 
   private:
     // Properties
-    Average<float> avgPressure;
-    Average<float> avgHumidity;
-    Average<float> avgTemperature;
+    RunningStats<float, AVERAGING_WINDOW> avgPressure;
+    RunningStats<float, AVERAGING_WINDOW> avgHumidity;
+    RunningStats<float, AVERAGING_WINDOW> avgTemperature;
     Adafruit_BME280 bme;
 
 };
@@ -92,6 +142,7 @@ class Proc_CO2Sensor: public Process, public BaseSensor
   public:
     Proc_CO2Sensor(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations);
     float getCO2();
+    SensorStats &getCO2Stats();
 
 
   protected:
@@ -101,9 +152,16 @@ class Proc_CO2Sensor: public Process, public BaseSensor
 
   private:
     // Properties
-    Average<float> avgCO2;
+    RunningStats<float, AVERAGING_WINDOW> avgCO2;
     SoftwareSerial co2Serial;
+    SensorFrameReader co2Reader;
+    unsigned int samplePeriod;
     bool readError =  false;
+    int initAttempts = 0;
+
+    // methods
+    void readResponse(FrameStatus status);
+    void checkInit();
 
 };
 // END CO2 Sensor wrapper (MH-Z19)
@@ -122,6 +180,10 @@ class Proc_ParticleSensor: public Process, public BaseSensor
     float getPM01();
     float getPM2_5();
     float getPM10();
+    SensorStats &getPM01Stats();
+    SensorStats &getPM2_5Stats();
+    SensorStats &getPM10Stats();
+    bool hasData();                     // False until the first reading with the fan stable (values are NAN)
 
 
   protected:
@@ -130,12 +192,23 @@ class Proc_ParticleSensor: public Process, public BaseSensor
 
   private:
     // Properties
-    Average<float> avgPM01;
-    Average<float> avgPM2_5;
-    Average<float> avgPM10;
+    RunningStats<float, AVERAGING_WINDOW> avgPM01;
+    RunningStats<float, AVERAGING_WINDOW> avgPM2_5;
+    RunningStats<float, AVERAGING_WINDOW> avgPM10;
+    SensorFrameReader pmsReader;
+    unsigned int samplePeriod;
     bool readError =  false;
+    int initAttempts = 0;
+    bool passiveMode = false;           // Passive mode command sent
+    bool asleep = false;
+    unsigned long wakeTime = 0;         // Fan started
+    int burstReads = 0;                 // Valid readings since the fan is stable
+    int burstAttempts = 0;
 
     // methods
+    void readResponse(FrameStatus status);
+    void scheduleNext();
+    void checkInit();
     char verifyChecksum(unsigned char *thebuf, int leng);
     int extractPM01(unsigned char *thebuf);
     int extractPM2_5(unsigned char *thebuf);
@@ -152,6 +225,7 @@ class Proc_VOCSensor : public Process, public BaseSensor
   public:
     Proc_VOCSensor(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations);
     float getVOC();
+    SensorStats &getVOCStats();
 
 
   protected:
@@ -160,7 +234,7 @@ class Proc_VOCSensor : public Process, public BaseSensor
 
   private:
     // Properties
-    Average<float> avgVOC;
+    RunningStats<float, 60> avgVOC;
 };
 // END VOC Sensor wrapper (Grove - Air quality sensor v1.3)
 
@@ -176,6 +250,8 @@ class Proc_GeigerSensor : public Process, public BaseSensor
     // unsigned long getLastCPM();
     float getCPM();
     float getRadiation();
+    SensorStats &getCPMStats();
+    SensorStats &getRadiationStats();     // NOTE: in CPM
     static void onTubeEventISR();
     void onTubeEvent();
 
@@ -189,8 +265,8 @@ class Proc_GeigerSensor : public Process, public BaseSensor
     float radiationValue = 0.0;         // Radiation energy in uSv/h
     unsigned long lastCountReset = 0;
     static Proc_GeigerSensor * instance;
-    Average<float> avgCPM;
-    Average<float> avgRAD;
+    RunningStats<float, AVERAGING_WINDOW * 2> avgCPM;     // 1 minute
+    RunningStats<float, 15> avgRAD;                       // 15 minutes, a sample per minute
     int radAvgDelay = 0;
 };
 // END Geiger Sensor wrapper (LND712)
@@ -207,6 +283,8 @@ class Proc_MultiGasSensor : public Process, public BaseSensor
 
     float getCO();
     float getNO2();
+    SensorStats &getCOStats();
+    SensorStats &getNO2Stats();
     //    float getNH3();
     //    float getC3H8();
     //    float getC4H10();
@@ -221,15 +299,16 @@ class Proc_MultiGasSensor : public Process, public BaseSensor
 
   private:
     // Properties
-
-    Average<float> avgCO;
-    Average<float> avgNO2;
-    //    Average<float> avgNH3;
-    //    Average<float> avgC3H8;
-    //    Average<float> avgC4H10;
-    //    Average<float> avgCH4;
-    //    Average<float> avgH2;
-    //    Average<float> avgC2H5OH;
+    unsigned int samplePeriod;
+
+    RunningStats<float, AVERAGING_WINDOW> avgCO;
+    RunningStats<float, AVERAGING_WINDOW> avgNO2;
+    //    RunningStats<float, AVERAGING_WINDOW> avgNH3;
+    //    RunningStats<float, AVERAGING_WINDOW> avgC3H8;
+    //    RunningStats<float, AVERAGING_WINDOW> avgC4H10;
+    //    RunningStats<float, AVERAGING_WINDOW> avgCH4;
+    //    RunningStats<float, AVERAGING_WINDOW> avgH2;
+    //    RunningStats<float, AVERAGING_WINDOW> avgC2H5OH;
 
 };
 // END MultiGas Sensor wrapper (Grove - MiCS6814)
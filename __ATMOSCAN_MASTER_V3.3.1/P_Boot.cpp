@@ -0,0 +1,204 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#include <ESP8266WiFi.h>
+#include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
+#include <TFT_eSPI.h>             // https://github.com/Bodmer/TFT_eSPI
+
+#include "P_Boot.h"
+#include "GlobalDefinitions.h"
+#include "GfxUi.h"
+#include "Free_Fonts.h"
+#include "Fonts.h"
+
+// External variables
+extern Syslog syslog;
+extern struct Configuration config;
+extern struct ProcessContainer procPtr;
+extern TFT_eSPI LCD;
+extern GfxUi ui;
+extern struct WifiStats wifiStats;
+
+// Prototypes
+void errLog(String msg);
+void wifiCheckFastPath();
+#ifdef DEBUG_SYSLOG
+bool logBootDetails(int step);
+#endif
+
+Proc_Boot::Proc_Boot(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations)
+  :  Process(manager, pr, period, iterations)
+{
+  memset(phaseTimes, 0, sizeof(phaseTimes));
+}
+
+void Proc_Boot::mark(BootPhase phase)
+{
+  if (isDone(phase))
+    return;
+
+  // Still on the splash screen?
+  bool splash = !isDone(BOOT_UI);
+
+  phaseTimes[phase] = millis();
+  phasesDone |= 1 << phase;
+
+  if (splash)
+    drawPhase(phase);
+}
+
+bool Proc_Boot::isDone(BootPhase phase)
+{
+  return phasesDone & (1 << phase);
+}
+
+unsigned long Proc_Boot::getPhaseTime(BootPhase phase)
+{
+  return phaseTimes[phase];
+}
+
+void Proc_Boot::service()
+{
+  unsigned long sinceSetup = millis() - phaseTimes[BOOT_SCHEDULER];
+
+  // Network association, started by setup()
+  if (!networkDone)
+  {
+    // No configuration: the setup screen takes care of the network
+    if (!config.configValid)
+      networkDone = true;
+
+    // Timed by the WiFi event (status() only makes sure it was delivered)
+    else if (WiFi.status() == WL_CONNECTED && isDone(BOOT_NETWORK))
+    {
+      networkDone = true;
+
+      // Start logging
+      String strBuffer = F("******* BOOTING FIRMWARE ") ;
+      syslog.log(LOG_INFO, strBuffer + F(ATMOSCAN_VERSION) + F(", BUILT ") + String(__DATE__ " " __TIME__) + F(" ******* "));
+
+      // Log current configuration
+      strBuffer = F("Connected to network ");
+      syslog.log(LOG_INFO, strBuffer + WiFi.SSID() + F(" with address ") + WiFi.localIP().toString() +
+                 F(" in ") + String(wifiStats.lastConnectTime) + F(" ms") + (wifiStats.lastFastPath ? F(" (fast reconnect)") : F("")));
+    }
+
+    else if (sinceSetup >= BOOT_NETWORK_TIMEOUT)
+    {
+      // The WiFi events will tell if it shows up later
+      errLog(F("No network at boot"));
+      networkDone = true;
+    }
+
+    // Last access point not answering
+    else
+      wifiCheckFastPath();
+  }
+
+  // First readings
+  if (!isDone(BOOT_READINGS) && sensorsReady())
+    mark(BOOT_READINGS);
+
+  // Leave the splash screen once there is something to show (or no later than the timeout)
+  if (!isDone(BOOT_UI) && (isDone(BOOT_READINGS) || sinceSetup >= BOOT_SPLASH_TIMEOUT))
+    startUI();
+
+#ifdef DEBUG_SYSLOG
+  // Boot details, paced
+  if (isDone(BOOT_NETWORK) && logStep >= 0 && millis() - lastLog >= BOOT_LOG_INTERVAL)
+  {
+    lastLog = millis();
+    logStep = logBootDetails(logStep) ? logStep + 1 : -1;
+  }
+#else
+  logStep = -1;
+#endif
+
+  // All over
+  if (networkDone && isDone(BOOT_UI) && (logStep < 0 || !isDone(BOOT_NETWORK)))
+  {
+    syslog.log(LOG_INFO, F("************ BOOT SEQUENCE COMPLETE *************"));
+    logTimings();
+
+    this->disable();
+  }
+}
+
+// Every enabled sensor has a first reading, or was given up on
+bool Proc_Boot::sensorsReady()
+{
+#ifdef ENABLE_SENSORS
+  if (config.configValid)
+    return procPtr.ComboTemperatureHumiditySensor.isInitialised() &&
+           procPtr.ComboPressureHumiditySensor.isInitialised() &&
+           procPtr.CO2Sensor.isInitialised() &&
+           procPtr.ParticleSensor.isInitialised() &&
+           procPtr.VOCSensor.isInitialised() &&
+           procPtr.MultiGasSensor.isInitialised() &&
+           procPtr.GeigerSensor.isInitialised();
+#endif
+
+  return true;
+}
+
+// Draws the first screen over the splash screen
+void Proc_Boot::startUI()
+{
+  mark(BOOT_UI);
+
+  procPtr.UIManager.add();
+  procPtr.UIManager.enable();
+}
+
+// Progress bar and time of the phase, in a 2 x 3 grid below it
+void Proc_Boot::drawPhase(BootPhase phase)
+{
+  int done = 0;
+  for (int i = 0; i < BOOT_PHASES; i++)
+    done += isDone((BootPhase)i);
+
+  ui.drawProgressBar(10, 172, 240 - 20, 10, done * 100 / BOOT_PHASES, TFT_YELLOW, TFT_BLUE);
+
+  LCD.setFreeFont(&Dialog_plain_9);
+  LCD.setTextDatum(BL_DATUM);
+  LCD.setTextColor(TFT_YELLOW, TFT_BLACK);
+  LCD.drawString(String(phaseName(phase)) + F(" ") + String(phaseTimes[phase] / 1000.0, 2) + F("s"),
+                 6 + (phase % 2) * 120, 193 + (phase / 2) * 9, GFXFF);
+}
+
+void Proc_Boot::logTimings()
+{
+  String strBuffer = F("Boot phases (s from power up):");
+  for (int i = 0; i < BOOT_PHASES; i++)
+  {
+    BootPhase phase = (BootPhase)i;
+    strBuffer += F(" ");
+    strBuffer += phaseName(phase);
+    strBuffer += F(" ");
+    strBuffer += isDone(phase) ? String(phaseTimes[phase] / 1000.0, 2) : String(F("-"));
+  }
+  syslog.log(LOG_INFO, strBuffer);
+}
+
+const __FlashStringHelper *Proc_Boot::phaseName(BootPhase phase)
+{
+  switch (phase)
+  {
+    case BOOT_DISPLAY:
+      return F("Display");
+    case BOOT_CONFIG:
+      return F("Config");
+    case BOOT_SCHEDULER:
+      return F("Scheduler");
+    case BOOT_READINGS:
+      return F("Readings");
+    case BOOT_NETWORK:
+      return F("Network");
+    default:
+      return F("UI");
+  }
+}
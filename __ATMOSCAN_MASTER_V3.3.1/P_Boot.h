@@ -0,0 +1,57 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <ProcessScheduler.h>     // https://github.com/wizard97/ArduinoProcessScheduler
+
+#define BOOT_SPLASH_TIMEOUT 5000          // (ms) User interface starts by then, first readings or not
+#define BOOT_NETWORK_TIMEOUT 15000        // (ms) Network association given up at boot
+#define BOOT_LOG_INTERVAL 1000            // (ms) Between boot details, syslog does not like too many messages at a time
+
+// Boot phases, in the order they are shown on the splash screen
+enum BootPhase
+{
+  BOOT_DISPLAY,                     // Splash screen shown
+  BOOT_CONFIG,                      // Configuration retrieved
+  BOOT_SCHEDULER,                   // setup() over, processes running
+  BOOT_READINGS,                    // Every sensor read (or given up on)
+  BOOT_NETWORK,                     // Associated, with an address
+  BOOT_UI,                          // User interface started
+  BOOT_PHASES
+};
+
+// Completes the boot concurrently with the other processes: setup() only starts the
+// network association and the sensors, this waits for them (instead of setup()
+// waiting in turn for each), then replaces the splash screen with the user interface.
+// Times each phase from power up, on the splash screen and in syslog.
+class Proc_Boot : public Process
+{
+  public:
+    Proc_Boot(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations);
+
+    // Phase just over (only the first time counts)
+    void mark(BootPhase phase);
+    bool isDone(BootPhase phase);
+    unsigned long getPhaseTime(BootPhase phase);      // ms from power up
+
+  protected:
+    virtual void service();
+
+  private:
+    unsigned long phaseTimes[BOOT_PHASES];
+    uint8_t phasesDone = 0;
+    bool networkDone = false;
+    int logStep = 0;                        // Next boot detail, -1 when over
+    unsigned long lastLog = 0;
+
+    bool sensorsReady();
+    void startUI();
+    void drawPhase(BootPhase phase);
+    void logTimings();
+    static const __FlashStringHelper *phaseName(BootPhase phase);
+};
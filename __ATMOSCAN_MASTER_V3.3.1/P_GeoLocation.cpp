@@ -7,10 +7,12 @@
 
 #include "P_GeoLocation.h"
 #include "GlobalDefinitions.h"
+#include "ProcessProfiler.h"
 #include "TimeSpace.h"
 
 #include <ESP8266HTTPClient.h>
 #include <ESP8266WebServer.h>
+#include <FS.h>
 
 #include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
 #include <NtpClientLib.h>         // https://github.com/gmag11/NtpClient
@@ -43,6 +45,9 @@ void Proc_GeoLocation::setup()
 
 void Proc_GeoLocation::service()
 {
+  // Profile this run
+  ProcessProfiler::Run profile(this);
+
 
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_INFO, F("Geolocation - Service()"));
@@ -64,15 +69,52 @@ void Proc_GeoLocation::service()
           syslog.log(LOG_INFO, F("Geolocation 1 - Retrieving coordinates..."));
 #endif
 
+          // The access points in sight tell whether the place is already known
+          // NOTE: the scan takes ~2s, in the background: results picked up by a later run
+          int networks = WiFi.scanComplete();
+          if (networks == WIFI_SCAN_RUNNING)
+            break;
+
+          if (networks < 0)
+          {
+            WiFi.scanNetworks(true, true);
+            this->setPeriod(STEP_INTERVAL);
+            break;
+          }
+
+          takeFingerprint(networks);
+
+          if (loadCache(networks))
+          {
+            WiFi.scanDelete();
+
+            // Same place as last time: no web calls
+            reused = true;
+            step = 4;
+
+#ifdef DEBUG_SYSLOG
+            syslog.log(LOG_INFO, F("Geolocation reused for these access points"));
+#endif
+            break;
+          }
+
           Geolocate geolocate;
 
-          // Acquire coordinate
-          if (geolocate.acquire())
+          // Acquire coordinate (a retry scans again)
+          bool acquired = geolocate.acquire(networks);
+          WiFi.scanDelete();
+
+          if (acquired)
           {
             // Save coordinates
             latitude = geolocate.getLatitude();
             longitude = geolocate.getLongitude();
 
+            // New place, all from scratch
+            reused = false;
+            locality = "";
+            countryCode = "";
+
             // Go to next step
             step = 2;
 
@@ -109,11 +151,13 @@ void Proc_GeoLocation::service()
             // Save variables
             utcOffset = timezone.getUtcOffset();
             dst = timezone.isDst();
+            zoneEnd = timezone.getZoneEnd();
             //    timeZoneId = timezone.getTimeZoneId();
             //    timeZoneName = timezone.getTimeZoneName();
 
-            // Go to next step
-            step = 3;
+            // Go to next step (the locality of a reused place is still right)
+            step = reused ? 4 : 3;
+            reused = false;
 
 
             // Quickly go to next step
@@ -165,6 +209,27 @@ void Proc_GeoLocation::service()
           }
         }
         break;
+
+
+      // STEP 5 - Reused timezone: once NTP has the time, check it did not change since (DST)
+      case 5:
+        {
+          if (NTP.getLastNTPSync() > 0)
+          {
+            // Local time, back to UTC
+            if (zoneEnd != 0 && (uint32_t)(now() - utcOffset) >= zoneEnd)
+            {
+#ifdef DEBUG_SYSLOG
+              syslog.log(LOG_INFO, F("Geolocation 5 - Timezone changed, refreshing"));
+#endif
+              step = 2;
+              this->setPeriod(STEP_INTERVAL);
+            }
+            else
+              this->disable();
+          }
+        }
+        break;
     }
 
     // Clear visible communications flag
@@ -178,8 +243,19 @@ void Proc_GeoLocation::service()
       syslog.log(LOG_INFO, F("Geolocation 4 - enabling NTP sync..."));
 #endif
 
-      // Dont retry anymore
-      this->disable();
+      if (reused)
+      {
+        // Timezone from the cache: checked in the background
+        step = 5;
+        this->setPeriod(GEO_ZONE_CHECK_INTERVAL);
+      }
+      else
+      {
+        saveCache();
+
+        // Dont retry anymore
+        this->disable();
+      }
 
       // Notify NTP of new timezone
       // NOTE: UTCOffset already contains DST offset!
@@ -248,3 +324,98 @@ bool Proc_GeoLocation::isValid()
 {
   return valid;
 }
+
+// Strongest access points of the scan
+void Proc_GeoLocation::takeFingerprint(int networks)
+{
+  int32_t lastRssi = INT32_MAX;
+  int lastIndex = -1;
+
+  bssidCount = 0;
+  while (bssidCount < GEO_FINGERPRINT_SIZE)
+  {
+    // Next one in (RSSI descending, index) order
+    int best = -1;
+    for (int i = 0; i < networks; i++)
+    {
+      int32_t rssi = WiFi.RSSI(i);
+      bool after = rssi < lastRssi || (rssi == lastRssi && i > lastIndex);
+      if (after && (best < 0 || rssi > WiFi.RSSI(best)))
+        best = i;
+    }
+
+    if (best < 0)
+      break;
+
+    memcpy(bssids[bssidCount++], WiFi.BSSID(best), 6);
+    lastRssi = WiFi.RSSI(best);
+    lastIndex = best;
+  }
+}
+
+// Last location resolved, if at least half of its access points are in sight
+bool Proc_GeoLocation::loadCache(int networks)
+{
+  GeoCache cache;
+
+  fs::File file = SPIFFS.open(F(GEO_CACHE_FILE), "r");
+  if (!file)
+    return false;
+  bool read = file.read((uint8_t *)&cache, sizeof(cache)) == sizeof(cache);
+  file.close();
+
+  if (!read || cache.magic != GEO_CACHE_MAGIC || cache.bssidCount > GEO_FINGERPRINT_SIZE)
+    return false;
+
+  int common = 0;
+  for (int i = 0; i < cache.bssidCount; i++)
+  {
+    for (int j = 0; j < networks; j++)
+    {
+      if (memcmp(cache.bssids[i], WiFi.BSSID(j), 6) == 0)
+      {
+        common++;
+        break;
+      }
+    }
+  }
+
+  if (common == 0 || 2 * common < cache.bssidCount)
+    return false;
+
+  latitude = cache.latitude;
+  longitude = cache.longitude;
+  utcOffset = cache.utcOffset;
+  dst = cache.dst;
+  zoneEnd = cache.zoneEnd;
+  cache.locality[GEO_LOCALITY_SIZE - 1] = '\0';
+  cache.countryCode[GEO_COUNTRY_CODE_SIZE - 1] = '\0';
+  locality = cache.locality;
+  countryCode = cache.countryCode;
+
+  return true;
+}
+
+void Proc_GeoLocation::saveCache()
+{
+  GeoCache cache;
+
+  memset(&cache, 0, sizeof(cache));
+  cache.magic = GEO_CACHE_MAGIC;
+  memcpy(cache.bssids, bssids, sizeof(cache.bssids));
+  cache.bssidCount = bssidCount;
+  cache.latitude = latitude;
+  cache.longitude = longitude;
+  cache.utcOffset = utcOffset;
+  cache.dst = dst;
+  cache.zoneEnd = zoneEnd;
+  strncpy(cache.locality, locality.c_str(), GEO_LOCALITY_SIZE - 1);
+  strncpy(cache.countryCode, countryCode.c_str(), GEO_COUNTRY_CODE_SIZE - 1);
+
+  fs::File file = SPIFFS.open(F(GEO_CACHE_FILE), "w");
+  if (!file || file.write((uint8_t *)&cache, sizeof(cache)) != sizeof(cache))
+    errLog(F("Geolocation: can't save the location"));
+  if (file)
+    file.close();
+}
+
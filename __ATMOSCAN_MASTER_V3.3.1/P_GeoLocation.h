@@ -12,6 +12,28 @@
 #define RETRY_INTERVAL 15000
 #define STEP_INTERVAL 1000
 
+// Last location resolved, reused when the same access points are in sight
+#define GEO_CACHE_FILE "/geocache.bin"
+#define GEO_CACHE_MAGIC 0x31434547        // "GEC1"
+#define GEO_FINGERPRINT_SIZE 8            // Strongest access points kept
+#define GEO_LOCALITY_SIZE 32
+#define GEO_COUNTRY_CODE_SIZE 4
+#define GEO_ZONE_CHECK_INTERVAL 10000     // Waiting for NTP to check a reused timezone
+
+struct GeoCache
+{
+  uint32_t magic;
+  uint8_t bssids[GEO_FINGERPRINT_SIZE][6];
+  uint8_t bssidCount;
+  bool dst;
+  int32_t utcOffset;
+  uint32_t zoneEnd;                       // UTC, utcOffset and dst hold until then (0: unknown)
+  double latitude;
+  double longitude;
+  char locality[GEO_LOCALITY_SIZE];
+  char countryCode[GEO_COUNTRY_CODE_SIZE];
+};
+
 // Process definition
 class Proc_GeoLocation : public Process
 {
@@ -33,8 +55,18 @@ class Proc_GeoLocation : public Process
     double longitude;
     bool dst = false;
     int utcOffset = 0;
+    uint32_t zoneEnd = 0;
     String locality;
     String countryCode;
     bool valid;
     int step;
+
+    // Access points in sight, strongest first
+    uint8_t bssids[GEO_FINGERPRINT_SIZE][6];
+    uint8_t bssidCount = 0;
+    bool reused = false;
+
+    void takeFingerprint(int networks);
+    bool loadCache(int networks);
+    void saveCache();
 };
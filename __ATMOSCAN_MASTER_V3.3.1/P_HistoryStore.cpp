@@ -0,0 +1,20 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#include "P_HistoryStore.h"
+#include "History.h"
+#include "ProcessProfiler.h"
+
+void Proc_HistoryStore::service()
+{
+  // Profile this run
+  ProcessProfiler::Run profile(this);
+
+  history.saveStep();
+
+  this->setPeriod(history.isSaving() ? HISTORY_STEP_PERIOD : HISTORY_CHECK_PERIOD);
+}
@@ -0,0 +1,25 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <ProcessScheduler.h>     // https://github.com/wizard97/ArduinoProcessScheduler
+
+#define HISTORY_CHECK_PERIOD 1000         // (ms) Waiting for a snapshot to be due
+#define HISTORY_STEP_PERIOD 50            // (ms) Between chunks of a snapshot, so that the UI is serviced in between
+
+// Writes the history snapshot to SPIFFS a chunk at a time, so that the sensor
+// process closing a quarter of an hour is not the one waiting for the flash.
+class Proc_HistoryStore : public Process
+{
+  public:
+    Proc_HistoryStore(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations)
+      :  Process(manager, pr, period, iterations) {}
+
+  protected:
+    virtual void service();
+};
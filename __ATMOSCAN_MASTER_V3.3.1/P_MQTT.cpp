@@ -6,14 +6,6 @@
 /********************************************************/
 
 
-// Override PubSub defaults
-
-// MQTT_KEEPALIVE : keepAlive interval in Seconds
-#define MQTT_KEEPALIVE 5
-
-// MQTT_SOCKET_TIMEOUT: socket timeout interval in Seconds
-#define MQTT_SOCKET_TIMEOUT 7
-
 #include <ESP8266HTTPClient.h>
 #include <ESP8266WebServer.h>
 #include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
@@ -22,8 +14,12 @@
 #include <ArduinoJson.h>          //https://github.com/bblanchon/ArduinoJson
 
 #include "P_MQTT.h"
+#include "MqttPayload.h"
 #include "P_AirSensors.h"
 #include "GlobalDefinitions.h"
+#include "ProcessProfiler.h"
+#include "MemoryMonitor.h"
+#include "History.h"
 
 
 // External variables
@@ -31,20 +27,125 @@ extern struct ProcessContainer procPtr;
 extern struct Configuration config;
 extern Syslog syslog;
 extern String systemID;
-extern WiFiClient wifiClient;
+extern struct WifiStats wifiStats;
 
 // Prototypes
 void errLog(String msg);
+int32_t utcOffset();
+time_t utcNow();
+
+// Keep-alive interval in Seconds
+// NOTE: set on the client, a define here does not reach the library
+#define MQTT_KEEPALIVE_INTERVAL 5
+
+// Broker lookup, TCP connection and CONNACK each give up after this (Seconds)
+#define MQTT_CONNECT_TIMEOUT 1
+
+// Broker polled at half the keep-alive period, so that PINGREQ is never late
+#define MQTT_LOOP_PERIOD (MQTT_KEEPALIVE_INTERVAL * 1000UL / 2)
+
+// Stored samples with their time need more than the library default (128)
+#if MQTT_MAX_PACKET_SIZE < 256
+#error "MQTT_MAX_PACKET_SIZE must be at least 256 (PubSubClient.h)"
+#endif
+
+// PubSubClient refuses packets over MQTT_MAX_PACKET_SIZE (fixed header, topic and payload)
+static bool fitsPacket(const char *topic, PayloadWriter &payload)
+{
+  return !payload.isOverflow() && 5 + 2 + strlen(topic) + payload.length() <= MQTT_MAX_PACKET_SIZE;
+}
+
+// Time left before a period elapses (0 if already elapsed)
+static unsigned long timeLeft(unsigned long since, unsigned long period)
+{
+  unsigned long elapsed = millis() - since;
+  return elapsed < period ? period - elapsed : 0;
+}
+
+// Payload values
+template <SampleMetric metric>
+static float sampleValue(const SampleRecord *sample)
+{
+  return sample->values[metric];
+}
+
+static float systemUptime(const SampleRecord *)
+{
+  return millis() / 60000L;
+}
+
+static float systemFreeHeap(const SampleRecord *)
+{
+  return ESP.getFreeHeap();
+}
+
+static float systemRSSI(const SampleRecord *)
+{
+  return WiFi.RSSI();
+}
+
+static float systemVolt(const SampleRecord *)
+{
+  return procPtr.UIManager.getVolt();
+}
+
+static float systemSoC(const SampleRecord *)
+{
+  return procPtr.UIManager.getSoC();
+}
 
-// Tags
-const char PARAM_1[] PROGMEM = "1=";
-const char PARAM_2[] PROGMEM = "&2=";
-const char PARAM_3[] PROGMEM = "&3=";
-const char PARAM_4[] PROGMEM = "&4=";
-const char PARAM_5[] PROGMEM = "&5=";
-const char PARAM_6[] PROGMEM = "&6=";
-const char PARAM_7[] PROGMEM = "&7=";
-const char PARAM_8[] PROGMEM = "&8=";
+static float systemNativeSoC(const SampleRecord *)
+{
+  return procPtr.UIManager.getNativeSoC();
+}
+
+static float systemTemperature(const SampleRecord *)
+{
+  return procPtr.ComboPressureHumiditySensor.getTemperature();
+}
+
+static float systemHumidity(const SampleRecord *)
+{
+  return procPtr.ComboPressureHumiditySensor.getHumidity();
+}
+
+// Payload schema: topic, field, value, decimals
+// NOTE: topic 1 and 2 are samples (also stored while offline), topic 3 is live system status
+static constexpr PayloadField payloadSchema[] PROGMEM =
+{
+  {1, 1, sampleValue<METRIC_TEMPERATURE>, 2},
+  {1, 2, sampleValue<METRIC_HUMIDITY>, 2},
+  {1, 3, sampleValue<METRIC_PRESSURE>, 2},
+  {1, 4, sampleValue<METRIC_PM01>, 2},
+  {1, 5, sampleValue<METRIC_PM2_5>, 2},
+  {1, 6, sampleValue<METRIC_PM10>, 2},
+  {1, 7, sampleValue<METRIC_CPM>, 2},
+  {1, 8, sampleValue<METRIC_RADIATION>, 2},
+
+  {2, 1, sampleValue<METRIC_CO>, 2},
+  {2, 2, sampleValue<METRIC_CO2>, 2},
+  {2, 3, sampleValue<METRIC_NO2>, 2},
+  {2, 4, sampleValue<METRIC_VOC>, 2},
+  {2, 5, sampleValue<METRIC_PM2_5_MAX>, 0},
+  {2, 6, sampleValue<METRIC_PM10_MAX>, 0},
+  {2, 7, sampleValue<METRIC_CO2_MAX>, 0},
+  {2, 8, sampleValue<METRIC_CPM_MAX>, 0},
+
+  {3, 1, systemUptime, 2},
+  {3, 2, systemFreeHeap, 2},
+  {3, 3, systemRSSI, 2},
+  {3, 4, systemVolt, 2},
+  {3, 5, systemSoC, 2},
+  {3, 6, systemNativeSoC, 2},
+  {3, 7, systemTemperature, 2},
+  {3, 8, systemHumidity, 2},
+};
+
+#define PAYLOAD_SCHEMA_SIZE (sizeof(payloadSchema) / sizeof(PayloadField))
+
+static_assert(payloadFieldCount(payloadSchema, PAYLOAD_SCHEMA_SIZE, 1) <= MQTT_PAYLOAD_FIELDS, "Too many fields in MQTT topic 1");
+static_assert(payloadFieldCount(payloadSchema, PAYLOAD_SCHEMA_SIZE, 2) <= MQTT_PAYLOAD_FIELDS, "Too many fields in MQTT topic 2");
+static_assert(payloadFieldCount(payloadSchema, PAYLOAD_SCHEMA_SIZE, 3) <= MQTT_PAYLOAD_FIELDS, "Too many fields in MQTT topic 3");
 
 
 // Process Setup
@@ -54,210 +155,316 @@ void Proc_MQTTUpdate::setup()
   syslog.log(LOG_INFO, F("Proc_MQTTUpdate::setup()"));
 #endif
 
-  // Set the MQTT broker
-  mqttClient.setServer(config.mqtt_server, 1883);
-
-  mqttClient.loop();
+  // Unreachable broker: fail fast, the link retries with backoff
+  mqttSocket.setTimeout(MQTT_CONNECT_TIMEOUT * 1000UL);
+  mqttClient.setSocketTimeout(MQTT_CONNECT_TIMEOUT);
+  mqttClient.setKeepAlive(MQTT_KEEPALIVE_INTERVAL);
 
+  // Samples not sent before last reboot, if any
+  sampleLog.begin();
 }
 
 // Process Service
+// NOTE: at most one network operation per run, the UI is serviced in between
 void Proc_MQTTUpdate::service()
 {
+  // Profile this run
+  ProcessProfiler::Run profile(this);
+
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_INFO, F("Proc_MQTTUpdate::service()"));
 #endif
 
-  // Update MQTT  only if WiFi is connected
-  if (config.connected)
+  // Sample once per update period, connected or not (some allowance for the Scheduler delay)
+  if (!sampleTaken || millis() - lastSample >= MQTT_UPDATE_PERIOD - 50)
   {
-
-
-#ifdef DEBUG_SYSLOG
-    syslog.log(LOG_DEBUG, F("Connect to MQTT server..."));
-#endif
-
-    // Make ongoing MQTT visible
-    procPtr.UIManager.communicationsFlag(true);
-
-    bool isConnected = mqttReconnect();
-
-    if (isConnected)
+    // Previous one never went out, keep it
+    if (livePending)
+      sampleLog.append(liveSample);
+
+    takeSample(liveSample);
+    lastSample = millis();
+    sampleTaken = true;
+    livePending = true;
+
+    // System status with each sample (and heap, WiFi and process statistics, if a system topic is configured)
+    pendingStatus = 1;
+    if (config.mqtt_systopic[0] != '\0')
     {
+      pendingStatus |= 1 << 1;
+      pendingStatus |= 1 << 2;
+      for (int i = 0; i < profiler.count(); i++)
+        pendingStatus |= 1 << (i + 3);
 
-      // Reusable buffer
-      char mqttData[100];
+      // Summaries of every metric, when an hour of history closed
+      if (history.getUpdates(TIER_HOUR) != lastHistoryHour)
+      {
+        lastHistoryHour = history.getUpdates(TIER_HOUR);
+        pendingHistory = (1 << HISTORY_METRICS) - 1;
+      }
+    }
+  }
 
-      // Create data string - Topic 1
-      strcpy_P(mqttData, PARAM_1);
-      dtostrf(procPtr.ComboTemperatureHumiditySensor.getTemperature(), 2, 2, &mqttData[strlen(mqttData)]);
+  if (mqttLink())
+  {
+    // Keep-alive, also detects a lost connection
+    mqttClient.loop();
 
-      strcat_P(mqttData, PARAM_2);
-      dtostrf(procPtr.ComboTemperatureHumiditySensor.getHumidity(), 2, 2, &mqttData[strlen(mqttData)]);
+    mqttPublishNext();
+  }
+  else if ((linkState == LINK_OFFLINE && !procPtr.PowerManager.isRadioWaking()) || linkState == LINK_BACKOFF)
+  {
+    // Broker not reachable for a while: samples go to flash, status is only meaningful live
+    if (livePending)
+    {
+      sampleLog.append(liveSample);
+      livePending = false;
+    }
+    pendingStatus = 0;
+    pendingHistory = 0;
+  }
 
-      strcat_P(mqttData, PARAM_3);
-      dtostrf(procPtr.ComboPressureHumiditySensor.getPressure(), 2, 2, &mqttData[strlen(mqttData)]);
+  // Next run: next sample, or sooner if there is something to do
+  unsigned long nextRun = timeLeft(lastSample, MQTT_UPDATE_PERIOD);
+  unsigned long stepRun = MQTT_LOOP_PERIOD;
 
-      strcat_P(mqttData, PARAM_4);
-      dtostrf(procPtr.ParticleSensor.getPM01(), 2, 2, &mqttData[strlen(mqttData)]);
+  if (linkState == LINK_RESOLVE || linkState == LINK_CONNECT || livePending || pendingStatus || pendingHistory)
+    stepRun = MQTT_PUBLISH_PERIOD;
+  else if (linkState == LINK_BACKOFF)
+    stepRun = timeLeft(linkSince, retryDelay);
+  else if (linkState == LINK_ONLINE && sampleLog.count() > 0)
+    stepRun = min(stepRun, timeLeft(lastSampleSent, MQTT_DRAIN_PERIOD));
 
-      strcat_P(mqttData, PARAM_5);
-      dtostrf(procPtr.ParticleSensor.getPM2_5(), 2, 2, &mqttData[strlen(mqttData)]);
+  nextRun = min(nextRun, stepRun);
+  this->setPeriod(max(nextRun, (unsigned long)MQTT_PUBLISH_PERIOD));
 
-      strcat_P(mqttData, PARAM_6);
-      dtostrf(procPtr.ParticleSensor.getPM10(), 2, 2, &mqttData[strlen(mqttData)]);
+#ifdef DEBUG_SYSLOG
+  syslog.log(LOG_INFO, F("END Proc_MQTTUpdate::service()"));
+#endif
+}
 
-      strcat_P(mqttData, PARAM_7);
-      dtostrf(procPtr.GeigerSensor.getCPM(), 2, 2, &mqttData[strlen(mqttData)]);
+// Advances the connection to the broker by one step
+// Returns true when online, and no connection work was done in this run
+bool Proc_MQTTUpdate::mqttLink()
+{
+  // No WiFi: look the broker up again once back
+  if (!config.connected)
+  {
+    if (linkState == LINK_ONLINE)
+      mqttClient.disconnect();
 
-      strcat_P(mqttData, PARAM_8);
-      dtostrf(procPtr.GeigerSensor.getRadiation(), 2, 2, &mqttData[strlen(mqttData)]);
+    linkState = LINK_OFFLINE;
+    brokerResolved = false;
+    backoff = 0;
+    return false;
+  }
 
-      // Update topic 1
-      mqttSend(config.mqtt_topic1, mqttData);
+  switch (linkState)
+  {
+    case LINK_ONLINE:
+      if (mqttClient.connected())
+        return true;
 
-#ifdef DEBUG_SYSLOG
-      syslog.log(LOG_DEBUG, String(F("mqttData1 ")) + String(mqttData));
-#endif
+      errLog(String(F("MQTT lost,err ")) + String(mqttClient.state()));
+      mqttBackoff();
+      return false;
 
-      // Create data string - Topic 2
-      strcpy_P(mqttData, PARAM_1);
-      dtostrf(procPtr.MultiGasSensor.getCO(), 2, 2, &mqttData[strlen(mqttData)]);
+    case LINK_BACKOFF:
+      if (timeLeft(linkSince, retryDelay) > 0)
+        return false;
 
-      strcat_P(mqttData, PARAM_2);
-      dtostrf(procPtr.CO2Sensor.getCO2(), 2, 2, &mqttData[strlen(mqttData)]);
+      linkState = brokerResolved ? LINK_CONNECT : LINK_RESOLVE;
+      return false;
 
-      strcat_P(mqttData, PARAM_3);
-      dtostrf(procPtr.MultiGasSensor.getNO2(), 2, 2, &mqttData[strlen(mqttData)]);
+    case LINK_OFFLINE:
+    case LINK_RESOLVE:
+    {
+      // Looked up once, not on every connection
+      IPAddress brokerIP;
+      if (!WiFi.hostByName(config.mqtt_server, brokerIP, MQTT_CONNECT_TIMEOUT * 1000UL))
+      {
+        errLog(F("MQTT server not found"));
+        mqttBackoff();
+        return false;
+      }
 
-      strcat_P(mqttData, PARAM_4);
-      dtostrf(procPtr.VOCSensor.getVOC(), 2, 2, &mqttData[strlen(mqttData)]);
+      mqttClient.setServer(brokerIP, 1883);
+      brokerResolved = true;
+      linkState = LINK_CONNECT;
+      return false;
+    }
 
-      // Update topic 2
-      mqttSend(config.mqtt_topic2, mqttData);
+    case LINK_CONNECT:
+    {
+      // Connecting blocks until the broker answers, not while the user waits
+      if (procPtr.UIManager.eventPending())
+        return false;
 
+      // Make ongoing MQTT visible
+      procPtr.UIManager.communicationsFlag(true);
 
-#ifdef DEBUG_SYSLOG
-      syslog.log(LOG_DEBUG, String(F("mqttData2 ")) + String(mqttData));
-#endif
+      // NOTE: same client ID on every connection, the broker drops a stale session with it
+      bool connected = mqttClient.connect(systemID.c_str(), String(F("username")).c_str(), String(F("password")).c_str());
 
-      // Create data string - Topic 3 (SYSTEM)
-      strcpy_P(mqttData, PARAM_1);
-      dtostrf(millis() / (60000L), 2, 2, &mqttData[strlen(mqttData)]);
+      procPtr.UIManager.communicationsFlag(false);
 
-      strcat_P(mqttData, PARAM_2);
-      dtostrf(ESP.getFreeHeap(), 2, 2, &mqttData[strlen(mqttData)]);
+      if (!connected)
+      {
+        errLog(String(F("MQTT fail,err ")) + String(mqttClient.state()));
+        mqttBackoff();
+        return false;
+      }
 
-      strcat_P(mqttData, PARAM_3);
-      dtostrf(WiFi.RSSI(), 2, 2, &mqttData[strlen(mqttData)]);
+      if (backoff > 0)
+        syslog.log(LOG_INFO, F("MQTT connected"));
 
-      strcat_P(mqttData, PARAM_4);
-      dtostrf(procPtr.UIManager.getVolt(), 2, 2, &mqttData[strlen(mqttData)]);
+      linkState = LINK_ONLINE;
+      backoff = 0;
+      return false;
+    }
+  }
 
-      strcat_P(mqttData, PARAM_5);
-      dtostrf(procPtr.UIManager.getSoC(), 2, 2, &mqttData[strlen(mqttData)]);
+  return false;
+}
 
-      strcat_P(mqttData, PARAM_6);
-      dtostrf(procPtr.UIManager.getNativeSoC(), 2, 2, &mqttData[strlen(mqttData)]);
+// Exponential backoff with jitter: a broker outage must not get a reconnect storm
+void Proc_MQTTUpdate::mqttBackoff()
+{
+  if (backoff == 0)
+    backoff = MQTT_BACKOFF_MIN;
+  else
+    backoff = min(backoff * 2, (unsigned long)MQTT_BACKOFF_MAX);
 
-      strcat_P(mqttData, PARAM_7);
-      dtostrf(procPtr.ComboPressureHumiditySensor.getTemperature(), 2, 2, &mqttData[strlen(mqttData)]);
+  // Anywhere between half and the full backoff
+  retryDelay = backoff / 2 + random(backoff / 2 + 1);
+  linkSince = millis();
+  linkState = LINK_BACKOFF;
+}
 
-      strcat_P(mqttData, PARAM_8);
-      dtostrf(procPtr.ComboPressureHumiditySensor.getHumidity(), 2, 2, &mqttData[strlen(mqttData)]);
+// Publishes one queued message: live sample first, then status, then stored samples
+void Proc_MQTTUpdate::mqttPublishNext()
+{
+  // Send buffer still busy with the previous message, try next run
+  if (mqttSocket.availableForWrite() < 2 * MQTT_MAX_PACKET_SIZE)
+    return;
 
-      // Update topic 3
-      mqttSend(config.mqtt_topic3, mqttData);
+  // Make ongoing MQTT visible
+  procPtr.UIManager.communicationsFlag(true);
 
+  if (livePending)
+  {
+    // Stored samples go first, to keep them in order (one taken before the clock was set can only go live)
+    if ((sampleLog.count() > 0 && liveSample.timestamp != 0) || !mqttSendSample(liveSample, false))
+      sampleLog.append(liveSample);
+    else
+      lastSampleSent = millis();
 
-#ifdef DEBUG_SYSLOG
-      syslog.log(LOG_DEBUG, String(F("mqttData3 ")) + String(mqttData));
-#endif
+    livePending = false;
+  }
+  else if (pendingStatus != 0)
+  {
+    int message = __builtin_ctz(pendingStatus);
+    pendingStatus &= ~(1 << message);
+
+    if (message == 0)
+      mqttSendSystem();
+    else if (message == 1)
+      mqttSendHeap();
+    else if (message == 2)
+      mqttSendWifi();
+    else
+      mqttSendProfile(message - 3);
+  }
+  else if (pendingHistory != 0)
+  {
+    int metric = __builtin_ctz(pendingHistory);
+    pendingHistory &= ~(1 << metric);
 
-      // Remember last update
-      sprintf(lastMqttUpdate, "%d/%d/%d %d:%02d.%02d   ", day(), month(), year(), hour(), minute(), second());
-
-      // Experimental
-      /*
-            if (mqttClient.connected())
-            {
-              // Disconnect from server
-              mqttClient.disconnect();
-            }
-            else
-            {
-              // TEMP log
-              syslog.log(LOG_DEBUG, "MQTT not connected, so no need to disconnect");
-            }
-      */
+    mqttSendHistory((SampleMetric)metric);
+  }
+  else if (sampleLog.count() > 0 && timeLeft(lastSampleSent, MQTT_DRAIN_PERIOD) == 0)
+  {
+    // Forward stored samples, at the pace the broker takes them
+    SampleRecord stored;
+    if (sampleLog.peek(stored) && mqttSendSample(stored, true))
+    {
+      sampleLog.pop();
+      lastSampleSent = millis();
     }
   }
 
   // Reset visual communications flag
   procPtr.UIManager.communicationsFlag(false);
-
-#ifdef DEBUG_SYSLOG
-  syslog.log(LOG_INFO, F("END Proc_MQTTUpdate::service()"));
-#endif
 }
 
+// Current sensor values
+void Proc_MQTTUpdate::takeSample(SampleRecord &sample)
+{
+  sample.timestamp = utcNow();
+  sample.values[METRIC_TEMPERATURE] = procPtr.ComboTemperatureHumiditySensor.getTemperature();
+  sample.values[METRIC_HUMIDITY] = procPtr.ComboTemperatureHumiditySensor.getHumidity();
+  sample.values[METRIC_PRESSURE] = procPtr.ComboPressureHumiditySensor.getPressure();
+  sample.values[METRIC_PM01] = procPtr.ParticleSensor.getPM01();
+  sample.values[METRIC_PM2_5] = procPtr.ParticleSensor.getPM2_5();
+  sample.values[METRIC_PM10] = procPtr.ParticleSensor.getPM10();
+  sample.values[METRIC_CPM] = procPtr.GeigerSensor.getCPM();
+  sample.values[METRIC_RADIATION] = procPtr.GeigerSensor.getRadiation();
+  sample.values[METRIC_CO] = procPtr.MultiGasSensor.getCO();
+  sample.values[METRIC_CO2] = procPtr.CO2Sensor.getCO2();
+  sample.values[METRIC_NO2] = procPtr.MultiGasSensor.getNO2();
+  sample.values[METRIC_VOC] = procPtr.VOCSensor.getVOC();
+  sample.values[METRIC_PM2_5_MAX] = procPtr.ParticleSensor.hasData() ? procPtr.ParticleSensor.getPM2_5Stats().maximum() : NAN;
+  sample.values[METRIC_PM10_MAX] = procPtr.ParticleSensor.hasData() ? procPtr.ParticleSensor.getPM10Stats().maximum() : NAN;
+  sample.values[METRIC_CO2_MAX] = procPtr.CO2Sensor.getCO2Stats().maximum();
+  sample.values[METRIC_CPM_MAX] = procPtr.GeigerSensor.getCPMStats().maximum();
+}
 
-bool Proc_MQTTUpdate::mqttReconnect()
+// Publishes a sample on topic 1 and 2. Stored samples carry the time they were taken (created_at=)
+bool Proc_MQTTUpdate::mqttSendSample(SampleRecord &sample, bool stored)
 {
-  // If already connected, exit
-  if (mqttClient.connected())
-    return true;
-  else
-  {
-    for (int attempt = 1; attempt < 5; attempt++)
-    {
-#ifdef DEBUG_SYSLOG
-      syslog.log(LOG_DEBUG, String(F("MQTT connection, attempt ")) + attempt);
-#endif
+  char mqttData[MQTT_PAYLOAD_SIZE];
 
-      // Note: to avoid thingspeak occasional lockout
-      String randomID = systemID + String(random(999999));
+  for (uint8_t topic = 1; topic <= 2; topic++)
+  {
+    char *mqttTopic = topic == 1 ? config.mqtt_topic1 : config.mqtt_topic2;
 
-      // Connect to the MQTT broker
-      if (mqttClient.connect(randomID.c_str(), String(F("username")).c_str(), String(F("password")).c_str()))
-      {
-        if (attempt > 1)
-          errLog(String(F("MQTT retries:")) + String(attempt));
+    PayloadWriter payload(mqttData, sizeof(mqttData));
+    payload.add(payloadSchema, PAYLOAD_SCHEMA_SIZE, topic, &sample);
 
-        return true;
-      }
-      else
-      {
+    if (stored)
+      payload.addTimestamp(sample.timestamp);
 
-#ifdef DEBUG_SYSLOG
-        errLog(String(F("MQTT fail,err ")) + String(mqttClient.state()));
-#endif
-        // Wait a bit and retry (2000 ms)
-        for (int wait = 1 ; wait < 40; wait++)
-        {
-          // Wait before retrying
-          // unless a userEvent needs to be serviced
-          if (!procPtr.UIManager.eventPending())
-          {
-            delay(50);
-          }
-          else
-          {
-            // Cannot update MQTT as UserEvent is pending...
-            // ...so, force scheduling so to retry asap
-            errLog(F("MQTT connect - giving up as user event pending"));
-
-            this->force();
-            return false;
-          }
-        }
-      }
+    // Would never fit: retrying is pointless, skip it
+    if (!fitsPacket(mqttTopic, payload))
+    {
+      errLog(F("MQTT payload too long"));
+      return true;
     }
 
-    // All attempts were exausted, giving up..
-    errLog(String(F("MQTT giveup,err ")) + String(mqttClient.state()));
-    return false;
+    // NOTE: if topic 2 fails, topic 1 will be sent again with the retry
+    if (!mqttSend(mqttTopic, payload.c_str()))
+      return false;
   }
+
+  // Remember last update (local time)
+  time_t taken = sample.timestamp != 0 ? sample.timestamp + utcOffset() : now();
+  sprintf(lastMqttUpdate, "%d/%d/%d %d:%02d.%02d   ", day(taken), month(taken), year(taken), hour(taken), minute(taken), second(taken));
+
+  return true;
+}
+
+// Publishes system status on topic 3
+void Proc_MQTTUpdate::mqttSendSystem()
+{
+  char mqttData[MQTT_PAYLOAD_SIZE];
+
+  PayloadWriter payload(mqttData, sizeof(mqttData));
+  payload.add(payloadSchema, PAYLOAD_SCHEMA_SIZE, 3, NULL);
+
+  if (!fitsPacket(config.mqtt_topic3, payload))
+    errLog(F("MQTT payload too long"));
+  else
+    mqttSend(config.mqtt_topic3, payload.c_str());
 }
 
 int Proc_MQTTUpdate::mqttSend(char *mqttTopic, char *mqttData)
@@ -272,6 +479,137 @@ int Proc_MQTTUpdate::mqttSend(char *mqttTopic, char *mqttData)
 #ifdef DEBUG_SYSLOG
   syslog.logf(LOG_DEBUG, "MQTT outcome =  % d ", rc);
 #endif
+
+  return rc;
+}
+
+// Publishes heap figures on <system topic>/Heap: now and at their worst since boot
+void Proc_MQTTUpdate::mqttSendHeap()
+{
+  char mqttTopic[80];
+  char mqttData[MQTT_PAYLOAD_SIZE];
+
+  strcpy(mqttTopic, config.mqtt_systopic);
+  strcat(mqttTopic, "/Heap");
+
+  // Bytes, fragmentation in %
+  PayloadWriter payload(mqttData, sizeof(mqttData));
+  payload.add(1, memoryMonitor.getFreeHeap());
+  payload.add(2, memoryMonitor.getMaxBlock());
+  payload.add(3, (uint32_t)memoryMonitor.getFragmentation());
+  payload.add(4, memoryMonitor.getMinFreeHeap());
+  payload.add(5, memoryMonitor.getMinMaxBlock());
+  payload.add(6, (uint32_t)memoryMonitor.getMaxFragmentation());
+
+  if (fitsPacket(mqttTopic, payload))
+    mqttSend(mqttTopic, payload.c_str());
+}
+
+// Publishes the last WiFi connection on <system topic>/WiFi: time to connect, fast reconnect or scan, radio off time
+void Proc_MQTTUpdate::mqttSendWifi()
+{
+  char mqttTopic[80];
+  char mqttData[MQTT_PAYLOAD_SIZE];
+
+  strcpy(mqttTopic, config.mqtt_systopic);
+  strcat(mqttTopic, "/WiFi");
+
+  // ms, 1 if fast reconnect, connections since boot, s of radio sleep since boot
+  PayloadWriter payload(mqttData, sizeof(mqttData));
+  payload.add(1, wifiStats.lastConnectTime);
+  payload.add(2, (uint32_t)wifiStats.lastFastPath);
+  payload.add(3, wifiStats.connects);
+  payload.add(4, procPtr.PowerManager.getRadioOffTime());
+
+  if (fitsPacket(mqttTopic, payload))
+    mqttSend(mqttTopic, payload.c_str());
+}
+
+// Publishes the statistics of a process on <system topic>/<process name>
+void Proc_MQTTUpdate::mqttSendProfile(int process)
+{
+  char mqttTopic[80];
+  char mqttData[MQTT_PAYLOAD_SIZE];
+
+  ServiceStats &stats = profiler.get(process);
+
+  // Never run, nothing to tell
+  if (stats.runs == 0)
+    return;
+
+  strcpy(mqttTopic, config.mqtt_systopic);
+  strcat(mqttTopic, "/");
+  strcat_P(mqttTopic, (PGM_P)stats.name);
+
+  // Times in milliseconds
+  PayloadWriter payload(mqttData, sizeof(mqttData));
+  payload.add(1, profiler.getAvgTime(stats) / 1000.0f, 2);
+  payload.add(2, profiler.getPercentile(stats, 99) / 1000.0f, 2);
+  payload.add(3, stats.maxTime / 1000.0f, 2);
+  payload.add(4, profiler.getAvgLateness(stats) / 1000.0f, 2);
+  payload.add(5, stats.maxLateness / 1000.0f, 2);
+  payload.add(6, stats.missed);
+  payload.add(7, stats.overruns);
+  payload.add(8, stats.runs);
+
+  // Heap high-water mark, bytes
+  payload.add(9, stats.memory.peak);
+
+  if (fitsPacket(mqttTopic, payload))
+    mqttSend(mqttTopic, payload.c_str());
+}
+
+// Publishes a metric's history on <system topic>/History/<metric, in topic 1 and 2 order>:
+// minimum, mean and maximum of the last 24 hours (quarter periods), then of the last 7 days (hour periods)
+void Proc_MQTTUpdate::mqttSendHistory(SampleMetric metric)
+{
+  char mqttTopic[80];
+  char mqttData[MQTT_PAYLOAD_SIZE];
+  float minimum, mean, maximum;
+  bool data = false;
+
+  snprintf(mqttTopic, sizeof(mqttTopic), "%s/History/%d", config.mqtt_systopic, metric + 1);
+
+  PayloadWriter payload(mqttData, sizeof(mqttData));
+
+  if (history.getSummary(TIER_QUARTER, metric, HISTORY_QUARTERS, minimum, mean, maximum))
+  {
+    payload.add(1, minimum, 3);
+    payload.add(2, mean, 3);
+    payload.add(3, maximum, 3);
+    data = true;
+  }
+
+  if (history.getSummary(TIER_HOUR, metric, HISTORY_HOURS, minimum, mean, maximum))
+  {
+    payload.add(4, minimum, 3);
+    payload.add(5, mean, 3);
+    payload.add(6, maximum, 3);
+    data = true;
+  }
+
+  if (data && fitsPacket(mqttTopic, payload))
+    mqttSend(mqttTopic, payload.c_str());
+}
+
+uint32_t Proc_MQTTUpdate::getPendingSamples()
+{
+  return sampleLog.count();
+}
+
+unsigned long Proc_MQTTUpdate::getNextSample()
+{
+  return sampleTaken ? timeLeft(lastSample, MQTT_UPDATE_PERIOD) : 0;
+}
+
+bool Proc_MQTTUpdate::isOnline()
+{
+  return linkState == LINK_ONLINE;
+}
+
+bool Proc_MQTTUpdate::isIdle()
+{
+  return linkState == LINK_ONLINE && !livePending && pendingStatus == 0 && pendingHistory == 0 && sampleLog.count() == 0;
 }
 
 char* Proc_MQTTUpdate::getLastMqttUpdate()
@@ -12,24 +12,67 @@
 #include <ProcessScheduler.h>     // https://github.com/wizard97/ArduinoProcessScheduler
 #include <ESP8266HTTPClient.h>
 
-extern WiFiClient wifiClient;
+#include "SampleLog.h"
+
+// Connection to the broker
+enum MqttLinkState
+{
+  LINK_OFFLINE,                     // No WiFi
+  LINK_RESOLVE,                     // Broker address to be looked up
+  LINK_CONNECT,                     // Ready to connect
+  LINK_ONLINE,
+  LINK_BACKOFF                      // Waiting before the next attempt
+};
 
 // Process definition
 class Proc_MQTTUpdate : public Process
 {
   public:
     Proc_MQTTUpdate(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations)
-      :  mqttClient (wifiClient), Process(manager, pr, period, iterations) {}
+      :  Process(manager, pr, period, iterations), mqttClient(mqttSocket) {}
 
     char* getLastMqttUpdate();
+    uint32_t getPendingSamples();
+    unsigned long getNextSample();    // ms until the next sample is taken
+    bool isOnline();
+    bool isIdle();                    // Online, nothing left to publish
 
   protected:
     virtual void setup();
     virtual void service();
 
   private:
+    WiFiClient mqttSocket;            // NOTE: not shared, other clients would close the session
     PubSubClient mqttClient;
-    bool mqttReconnect();
+    SampleLog sampleLog;
+
+    // Connection
+    MqttLinkState linkState = LINK_OFFLINE;
+    bool brokerResolved = false;
+    unsigned long linkSince = 0;      // Start of the current backoff
+    unsigned long backoff = 0;        // Nominal backoff, doubled on each failure
+    unsigned long retryDelay = 0;     // Actual backoff, with jitter
+
+    // Publish queue
+    SampleRecord liveSample;
+    bool livePending = false;
+    uint16_t pendingStatus = 0;       // Bit 0: system status, bit 1: heap, bit 2: WiFi, bit n + 3: statistics of process n
+    uint16_t pendingHistory = 0;      // Bit n: history of metric n
+    uint32_t lastHistoryHour = 0;     // Hours of history closed when last published
+    unsigned long lastSample = 0;
+    bool sampleTaken = false;
+    unsigned long lastSampleSent = 0;
+
+    bool mqttLink();
+    void mqttBackoff();
+    void mqttPublishNext();
     int mqttSend(char *mqttTopic, char *mqttData);
+    void takeSample(SampleRecord &sample);
+    bool mqttSendSample(SampleRecord &sample, bool stored);
+    void mqttSendSystem();
+    void mqttSendHeap();
+    void mqttSendWifi();
+    void mqttSendProfile(int process);
+    void mqttSendHistory(SampleMetric metric);
     char lastMqttUpdate[25];
 };
@@ -0,0 +1,128 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#include <ESP8266WiFi.h>
+#include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
+
+#include "P_PowerManager.h"
+#include "GlobalDefinitions.h"
+
+// External variables
+extern Syslog syslog;
+extern struct Configuration config;
+extern struct ProcessContainer procPtr;
+
+// Prototypes
+void wifiBegin();
+void wifiCheckFastPath();
+
+void Proc_PowerManager::displayOff()
+{
+  // Nothing to save power for without MQTT updates
+  if (!config.configValid || !procPtr.MQTTUpdate.isEnabled())
+    return;
+
+  if (!isEnabled())
+    fullSleepMode = WiFi.getSleepMode();
+
+  // Modem sleep between beacons (the listen interval applies from the next association)
+  WiFi.setSleepMode(WIFI_MODEM_SLEEP, POWER_LISTEN_INTERVAL);
+
+  syslog.log(LOG_INFO, F("Display off, radio duty cycling"));
+
+  // The current burst, if any, completes first
+  powerSave = true;
+  wakeTime = millis();
+  this->enable();
+}
+
+void Proc_PowerManager::displayOn()
+{
+  if (!powerSave)
+    return;
+
+  powerSave = false;
+  WiFi.setSleepMode(fullSleepMode);
+
+  // Full connectivity back (this process stays on until then, in case the fast reconnect fails)
+  if (radioOff)
+    radioWake();
+}
+
+void Proc_PowerManager::service()
+{
+  // Display on again: reconnecting
+  if (!powerSave)
+  {
+    if (!config.connected && millis() - wakeTime < POWER_WAKE_TIMEOUT)
+      wifiCheckFastPath();
+    else
+      this->disable();
+  }
+
+  // Back on just before the sample that completes the batch
+  else if (radioOff)
+  {
+    if (procPtr.MQTTUpdate.getPendingSamples() + 1 >= POWER_SAVE_BATCH && procPtr.MQTTUpdate.getNextSample() <= POWER_WAKE_LEAD)
+      radioWake();
+  }
+
+  // Not associated yet
+  else if (!config.connected)
+  {
+    wifiCheckFastPath();
+
+    if (millis() - wakeTime >= POWER_WAKE_TIMEOUT)
+      radioSleep();
+  }
+
+  // Burst over: all published (the batch sample included), or broker out of reach (samples stay stored)
+  else if (procPtr.MQTTUpdate.isOnline() ?
+           procPtr.MQTTUpdate.isIdle() && procPtr.MQTTUpdate.getNextSample() > POWER_WAKE_LEAD :
+           millis() - wakeTime >= POWER_WAKE_TIMEOUT)
+    radioSleep();
+}
+
+bool Proc_PowerManager::isRadioOff()
+{
+  return radioOff;
+}
+
+bool Proc_PowerManager::isRadioWaking()
+{
+  return isEnabled() && !radioOff && !config.connected && millis() - wakeTime < POWER_WAKE_TIMEOUT;
+}
+
+uint32_t Proc_PowerManager::getRadioOffTime()
+{
+  return (offTotal + (radioOff ? millis() - offSince : 0)) / 1000;
+}
+
+void Proc_PowerManager::radioSleep()
+{
+  // NOTE: not saved to flash, that would be a write per burst
+  WiFi.persistent(false);
+  WiFi.forceSleepBegin();
+  WiFi.persistent(true);
+
+  radioOff = true;
+  offSince = millis();
+}
+
+void Proc_PowerManager::radioWake()
+{
+  offTotal += millis() - offSince;
+  radioOff = false;
+  wakeTime = millis();
+
+  WiFi.persistent(false);
+  WiFi.forceSleepWake();
+  WiFi.persistent(true);
+
+  // Straight to the last access point, with the last lease
+  wifiBegin();
+}
@@ -0,0 +1,50 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <ESP8266WiFi.h>
+#include <ProcessScheduler.h>     // https://github.com/wizard97/ArduinoProcessScheduler
+
+#define POWER_SAVE_BATCH 1                // MQTT updates per radio wake-up (the ones in between are stored and forwarded)
+// NOTE: stored samples are forwarded every MQTT_DRAIN_PERIOD, with ThingSpeak larger batches keep the radio on longer
+
+#define POWER_WAKE_LEAD 3000              // (ms) Radio woken before the sample that completes a batch
+#define POWER_WAKE_TIMEOUT 15000          // (ms) Broker not reached by then: radio off again, samples stay stored
+#define POWER_LISTEN_INTERVAL 3           // Beacon intervals the modem sleeps through, while associated
+
+// Display-off power mode: between MQTT bursts the radio is off (forced modem sleep),
+// during bursts it is in modem sleep between beacons. Enabled when the display
+// switches off, full connectivity is back as soon as it switches on.
+class Proc_PowerManager : public Process
+{
+  public:
+    Proc_PowerManager(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations)
+      :  Process(manager, pr, period, iterations) {}
+
+    // Called by the UI manager
+    void displayOn();
+    void displayOff();
+
+    bool isRadioOff();
+    bool isRadioWaking();                   // Radio on for a burst, not associated yet
+    uint32_t getRadioOffTime();             // s since boot
+
+  protected:
+    virtual void service();
+
+  private:
+    bool powerSave = false;
+    bool radioOff = false;
+    unsigned long wakeTime = 0;             // Start of the current burst
+    unsigned long offSince = 0;
+    unsigned long offTotal = 0;             // ms, previous sleeps
+    WiFiSleepType_t fullSleepMode = WIFI_NONE_SLEEP;
+
+    void radioSleep();
+    void radioWake();
+};
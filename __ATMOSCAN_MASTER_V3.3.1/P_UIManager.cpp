@@ -13,6 +13,8 @@
 #include "P_UIManager.h"
 #include "ESP8266WiFi.h"
 #include "GlobalDefinitions.h"
+#include "ProcessProfiler.h"
+#include "MemoryMonitor.h"
 #include "Free_Fonts.h"
 #include "GlobalBitmaps.h"
 #include "Fonts.h"
@@ -31,7 +33,7 @@ void errLog(String msg);
 Proc_UIManager * Proc_UIManager::instance = nullptr;
 
 Proc_UIManager::Proc_UIManager(Scheduler &manager, ProcPriority pr, unsigned int period, int iterations)
-  :  Process(manager, pr, period, iterations), avgSOC(AVERAGING_WINDOW), avgVolt(AVERAGING_WINDOW) {}
+  :  Process(manager, pr, period, iterations), barSprite(&LCD) {}
 
 void Proc_UIManager::setup()
 {
@@ -61,8 +63,12 @@ void Proc_UIManager::setup()
   syslog.log(LOG_INFO, F("registering screen"));
 #endif
 
+  // Top bar sprite, before the screens fragment the heap
+  createBarSprite();
+
   // Initialise first screen
   currentScreenID = config.startScreen;
+  memoryMonitor.screenActivated(currentScreenID);
   currentScreen = ScreenFactory::getInstance()->createScreen(currentScreenID);
 
   // Activate screen
@@ -85,6 +91,9 @@ void Proc_UIManager::setup()
 
 void Proc_UIManager::service()
 {
+  // Profile this run
+  ProcessProfiler::Run profile(this);
+
 
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_INFO, F("Proc_DisplayUpdate::service()"));
@@ -136,6 +145,7 @@ void Proc_UIManager::service()
       currentScreenID = LOWBATT_SCREEN;
 
       // Allocate & Activate LOWBATT screen
+      memoryMonitor.screenActivated(currentScreenID);
       currentScreen = new ScreenLowbatt();
       currentScreen->activate();
 
@@ -269,6 +279,7 @@ void Proc_UIManager::service()
             currentScreenID = SETUP_SCREEN;
 
             // Allocate setup screen
+            memoryMonitor.screenActivated(currentScreenID);
             currentScreen = ScreenFactory::getInstance()->createScreen(currentScreenID);
 
             // Activate screen
@@ -360,6 +371,7 @@ void Proc_UIManager::service()
                 delete currentScreen;
 
                 // Allocate & Activate selected screen
+                memoryMonitor.screenActivated(newScreenID);
                 currentScreen = ScreenFactory::getInstance()->createScreen(newScreenID);
                 currentScreen->activate();
 
@@ -552,17 +564,56 @@ int Proc_UIManager::getUserEvent()
    Draw the top information bar
 */
 
+// Top bar sprite palette (4 bit: the colours drawn in the sprite are indexes)
+enum BarColor { BAR_BLACK, BAR_WHITE, BAR_YELLOW, BAR_GREEN, BAR_RED, BAR_GREY, BAR_COLORS };
+static const uint16_t barPalette[BAR_COLORS] = { TFT_BLACK, TFT_WHITE, TFT_YELLOW, TFT_GREEN, TFT_RED, 0xEF5D }; // GREY 90%
+
+// Rectangle each item draws within (x, y, width, height), by BarItem
+static const int16_t barRects[BAR_ITEMS][4] =
+{
+  {  0,  0, 240, 17},   // Date
+  { 25,  7, 190, 44},   // Time
+  {  0, 46, 240, 18},   // Location
+  {220, 17,  20, 45},   // WiFi gauge
+  {  5, 17,  10, 26}    // Battery gauge
+};
+
+// Off-screen copy of the bar, allocated once
+bool Proc_UIManager::createBarSprite()
+{
+  barSprite.setColorDepth(4);
+  if (barSprite.createSprite(LCD.width(), TOP_BAR_HEIGHT) == nullptr)
+    return false;
+
+  barSprite.createPalette(barPalette, BAR_COLORS);
+  return true;
+}
+
+// Where the bar items are drawn: the sprite, or the panel if there was no memory for it
+TFT_eSPI &Proc_UIManager::barCanvas()
+{
+  if (barSprite.created())
+    return barSprite;
+
+  return LCD;
+}
+
+// Colour to draw with on the bar canvas (palette index in the sprite)
+uint16_t Proc_UIManager::barInk(int color)
+{
+  return barSprite.created() ? color : barPalette[color];
+}
+
 void Proc_UIManager::drawBar(bool forceDraw)
 {
+  // No sprite yet: retried at each screen change, straight on the panel meanwhile
+  if (!barSprite.created() && forceDraw && !createBarSprite())
+    errLog(F("Top bar: not enough memory for the sprite"));
 
+  bool changed[BAR_ITEMS] = { forceDraw, forceDraw, forceDraw, forceDraw, forceDraw };
   String lineBuffer;
 
-  // ********* Date display
-
-  // set small font
-  LCD.setFreeFont(&ArialRoundedMTBold_14);
-  LCD.setTextDatum(BC_DATUM);
-  LCD.setTextColor(TFT_WHITE, TFT_BLACK);
+  // ********* Date
 
   if (config.connected && NTP.getLastNTPSync() > 0)
   {
@@ -576,51 +627,28 @@ void Proc_UIManager::drawBar(bool forceDraw)
     lineBuffer += String(year());
   }
   else
-  {
-    // Print BLANK
-    lineBuffer = F("                        ");
-  }
+    lineBuffer = "";
 
-  // Draw it only if it changed
-  if (forceDraw || lineBuffer != topBar.dateLine )
+  if (lineBuffer != topBar.dateLine)
   {
-    // Remember last printed value
     topBar.dateLine = lineBuffer;
-
-    // Erase current line
-    LCD.fillRect(0, 0, LCD.width(), LCD.fontHeight(GFXFF), TFT_BLACK);
-
-    LCD.setTextPadding(LCD.textWidth(F("  Saturday, 44 November 4444  ")));  // String width + margin
-    LCD.drawString(lineBuffer, 120, 14);
+    changed[BAR_DATE] = true;
   }
 
-  // ********* Location display
+  // ********* Location
 
   if (procPtr.GeoLocation.isValid() && config.connected)
-  {
     lineBuffer = procPtr.GeoLocation.getLocality()  + F(" ") + procPtr.GeoLocation.getCountryCode();
-  }
   else
-  {
-    lineBuffer = F("                                  ");
-  }
+    lineBuffer = "";
 
-  // Draw it only if it changed
-  if (forceDraw || lineBuffer != topBar.locationLine )
+  if (lineBuffer != topBar.locationLine)
   {
-    // Remember last printed value
     topBar.locationLine = lineBuffer;
-    LCD.setTextPadding(LCD.textWidth(F("                          ")));  // String width + margin
-    LCD.drawString(lineBuffer, 120, 63); // was 65
+    changed[BAR_LOCATION] = true;
   }
 
-
-  // ********* Time display
-
-  LCD.setFreeFont(&ArialRoundedMTBold_36);
-  LCD.setTextDatum(BC_DATUM);
-  LCD.setTextColor(TFT_YELLOW, TFT_BLACK);
-
+  // ********* Time
 
   if (config.connected && NTP.getLastNTPSync() > 0)
   {
@@ -635,28 +663,98 @@ void Proc_UIManager::drawBar(bool forceDraw)
     lineBuffer = F("AtmoScan");
   }
 
-  // Draw it only if it changed
-  if (forceDraw || lineBuffer != topBar.timeLine )
+  if (lineBuffer != topBar.timeLine)
   {
-    // Remember last printed value
     topBar.timeLine = lineBuffer;
-    LCD.setTextPadding(LCD.textWidth(F("     44:44     ")));  // String width + margin
-    LCD.drawString(lineBuffer, 120, 50);
+    changed[BAR_TIME] = true;
+  }
+
+  // ********* Gauges, compared as drawn (RSSI moves all the time, the bars seldom)
+
+  int bars = wifiBars(WiFi.RSSI());
+  if (bars != topBar.wifiBars)
+  {
+    topBar.wifiBars = bars;
+    changed[BAR_WIFI] = true;
+  }
+
+  int batLevel = getSoC();
+  if (batLevel != topBar.batLevel)
+  {
+    topBar.batLevel = batLevel;
+    changed[BAR_BATTERY] = true;
   }
 
-  // ************ Draw WiFi radio gauge
-  drawWifiGauge(220, 17, WiFi.RSSI(), forceDraw);
+  // ********* Area to rebuild: the rectangles of the items that changed
 
+  int16_t x0 = LCD.width(), y0 = TOP_BAR_HEIGHT, x1 = 0, y1 = 0;
+  for (int i = 0; i < BAR_ITEMS; i++)
+  {
+    if (changed[i])
+    {
+      x0 = min(x0, barRects[i][0]);
+      y0 = min(y0, barRects[i][1]);
+      x1 = max(x1, (int16_t)(barRects[i][0] + barRects[i][2]));
+      y1 = max(y1, (int16_t)(barRects[i][1] + barRects[i][3]));
+    }
+  }
 
-  // ************ Draw battery gauge
-  drawBatteryGauge(5, 17, getSoC(), 30, forceDraw);
+  if (x0 < x1)
+  {
+    // Wipe it, then draw every item reaching into it (an unchanged one draws the same pixels)
+    barCanvas().fillRect(x0, y0, x1 - x0, y1 - y0, barInk(BAR_BLACK));
+    for (int i = 0; i < BAR_ITEMS; i++)
+    {
+      if (barRects[i][0] < x1 && barRects[i][0] + barRects[i][2] > x0 &&
+          barRects[i][1] < y1 && barRects[i][1] + barRects[i][3] > y0)
+        drawBarItem(i);
+    }
 
+    // Send it in one window
+    if (barSprite.created())
+      barSprite.pushSprite(x0, y0, x0, y0, x1 - x0, y1 - y0);
+  }
 
   // Draw separator between upper bar and application screen
-  ui.drawSeparator(64);
+  if (forceDraw)
+    ui.drawSeparator(TOP_BAR_HEIGHT);
+}
+
+void Proc_UIManager::drawBarItem(int item)
+{
+  TFT_eSPI &canvas = barCanvas();
+
+  switch (item)
+  {
+    case BAR_DATE:
+      canvas.setFreeFont(&ArialRoundedMTBold_14);
+      canvas.setTextDatum(BC_DATUM);
+      canvas.setTextColor(barInk(BAR_WHITE));
+      canvas.drawString(topBar.dateLine, 120, 14);
+      break;
+
+    case BAR_TIME:
+      canvas.setFreeFont(&ArialRoundedMTBold_36);
+      canvas.setTextDatum(BC_DATUM);
+      canvas.setTextColor(barInk(BAR_YELLOW));
+      canvas.drawString(topBar.timeLine, 120, 50);
+      break;
 
-  LCD.setTextPadding(0);
+    case BAR_LOCATION:
+      canvas.setFreeFont(&ArialRoundedMTBold_14);
+      canvas.setTextDatum(BC_DATUM);
+      canvas.setTextColor(barInk(BAR_WHITE));
+      canvas.drawString(topBar.locationLine, 120, 63);
+      break;
+
+    case BAR_WIFI:
+      drawWifiGauge(barRects[BAR_WIFI][0], barRects[BAR_WIFI][1], topBar.wifiBars);
+      break;
 
+    case BAR_BATTERY:
+      drawBatteryGauge(barRects[BAR_BATTERY][0], barRects[BAR_BATTERY][1], topBar.batLevel, 30);
+      break;
+  }
 }
 
 /*
@@ -665,120 +763,91 @@ void Proc_UIManager::drawBar(bool forceDraw)
  * *
 */
 
-void Proc_UIManager::drawWifiGauge(int topX, int topY, int dBm, bool forceDraw)
+int Proc_UIManager::wifiBars(int dBm)
 {
-  // Draw it only if it changed
-  if (dBm != topBar.dBm || forceDraw)
-  {
-    // Draw it
-    int spacing = 5;
-    int thick = 4;
-    int radius = 2;
-    int count = 5;
-    int width = 14;
-
-    int quality, bars;
-
-    // dBm to Quality:
-    if (dBm <= -100 || dBm == 31)
-      quality = 0;
-    else if (dBm >= -60)
-      quality = 100;
-    else
-      quality = 3.3 * dBm + 330;
+  int quality;
 
-    // If previous was 31 (disconnected) erase the whole icon and start over
-    if (topBar.dBm == 31)
-    {
-      LCD.fillRect(topX, topY, width + 5, count * (thick + spacing), TFT_BLACK);
-    }
+  // Disconnected
+  if (dBm == 31)
+    return -1;
 
-    if (quality == 0)
-    {
-      bars = 0;
-    }
-    else if (quality < 20)
-    {
-      bars = 1;
-    }
-    else if (quality < 40)
-    {
-      bars = 2;
-    }
-    else if (quality < 60)
-    {
-      bars = 3;
-    }
-    else if (quality < 80)
-    {
-      bars = 4;
-    }
-    else if (quality >= 80)
-    {
-      bars = 5;
-    }
+  // dBm to Quality:
+  if (dBm <= -100)
+    quality = 0;
+  else if (dBm >= -60)
+    quality = 100;
+  else
+    quality = 3.3 * dBm + 330;
 
 #ifdef DEBUG_SYSLOG
-    syslog.log(LOG_INFO, String(F("RSSI = ")) + String(WiFi.RSSI()) + F("dbm"));
-    syslog.log(LOG_INFO, String(F("WiFI quality = ")) + String(quality));
-    syslog.log(LOG_INFO, String(F("WiFI bars = ")) + String(bars));
+  syslog.log(LOG_INFO, String(F("RSSI = ")) + String(dBm) + F("dbm"));
+  syslog.log(LOG_INFO, String(F("WiFI quality = ")) + String(quality));
 #endif
 
-    for (int i = 0; i < count; i++)
-    {
-      int color;
-      if (i  >= (count - bars))
-        color = TFT_GREEN;
-      else
-        color = 0xEF5D; // GREY 90%
-
-      LCD.fillRoundRect(topX + i * 2, topY + i * spacing, width - i * 2, thick, radius, color);
-    }
-
-    // If disconnected, red X over bars
-    if (dBm == 31)
-    {
-      LCD.setFreeFont(FSSB12);
-      LCD.setTextDatum(MC_DATUM);
-      LCD.setTextColor(TFT_RED);
-      LCD.drawString(F("X"), topX + 9, topY + 10);
-    }
-
-    // Remember last displayed value
-    topBar.dBm = dBm;
-
-  }
+  if (quality == 0)
+    return 0;
+  else if (quality < 20)
+    return 1;
+  else if (quality < 40)
+    return 2;
+  else if (quality < 60)
+    return 3;
+  else if (quality < 80)
+    return 4;
+  else
+    return 5;
 }
 
-void Proc_UIManager::drawBatteryGauge(int topX, int topY, int batLevel, int redLevel, bool forceDraw)
+void Proc_UIManager::drawWifiGauge(int topX, int topY, int bars)
 {
-
-  // Draw it only if it changed, unless forced
-  if (batLevel != topBar.batLevel || forceDraw)
+  int spacing = 5;
+  int thick = 4;
+  int radius = 2;
+  int count = 5;
+  int width = 14;
+  TFT_eSPI &canvas = barCanvas();
+
+  for (int i = 0; i < count; i++)
   {
-    // Remember last printed value
-    topBar.batLevel = batLevel;
-
-    // Draw it
-    int batHeight = 24;
-    int batWidth = 10;
-    int tipHeight = 2;
-    int tipWidth = 4;
-
-    // Draw battery outline
-    LCD.fillRect(topX + batWidth / 2 - tipWidth / 2, topY, tipWidth, tipHeight, TFT_WHITE); // tip
-    LCD.drawRect(topX, topY + tipHeight, batWidth, batHeight, TFT_WHITE); // battery body
+    int color;
+    if (i  >= (count - bars))
+      color = BAR_GREEN;
+    else
+      color = BAR_GREY;
 
-    // Decide fill color
-    int batfillColor = batLevel > 30 ? TFT_GREEN : TFT_RED;
-    int batFillHeight = batLevel * (batHeight - 2) / 100;
+    canvas.fillRoundRect(topX + i * 2, topY + i * spacing, width - i * 2, thick, radius, barInk(color));
+  }
 
-    // Fill battery + complement
-    LCD.fillRect(topX + 1, topY + batHeight + tipHeight - batFillHeight - 1, batWidth - 2, batFillHeight , batfillColor); // Fill
-    LCD.fillRect(topX + 1, topY + tipHeight + 1, batWidth - 2, batHeight - batFillHeight - 2, TFT_BLACK);                 // Complement
+  // If disconnected, red X over bars
+  if (bars < 0)
+  {
+    canvas.setFreeFont(FSSB12);
+    canvas.setTextDatum(MC_DATUM);
+    canvas.setTextColor(barInk(BAR_RED));
+    canvas.drawString(F("X"), topX + 9, topY + 10);
   }
 }
 
+void Proc_UIManager::drawBatteryGauge(int topX, int topY, int batLevel, int redLevel)
+{
+  int batHeight = 24;
+  int batWidth = 10;
+  int tipHeight = 2;
+  int tipWidth = 4;
+  TFT_eSPI &canvas = barCanvas();
+
+  // Draw battery outline
+  canvas.fillRect(topX + batWidth / 2 - tipWidth / 2, topY, tipWidth, tipHeight, barInk(BAR_WHITE)); // tip
+  canvas.drawRect(topX, topY + tipHeight, batWidth, batHeight, barInk(BAR_WHITE)); // battery body
+
+  // Decide fill color
+  int batfillColor = batLevel > redLevel ? BAR_GREEN : BAR_RED;
+  int batFillHeight = batLevel * (batHeight - 2) / 100;
+
+  // Fill battery (the rest is black already)
+  canvas.fillRect(topX + 1, topY + batHeight + tipHeight - batFillHeight - 1, batWidth - 2, batFillHeight , barInk(batfillColor));
+}
+
 
 bool Proc_UIManager::eventPending()
 {
@@ -796,6 +865,9 @@ void Proc_UIManager::displayOn()
   initDisplay();
   digitalWrite(BACKLIGHT_PIN, HIGH);
   isDisplayOn = true;
+
+  // Full connectivity
+  procPtr.PowerManager.displayOn();
 }
 
 void Proc_UIManager::displayOff()
@@ -808,6 +880,9 @@ void Proc_UIManager::displayOff()
   initDisplay();
   digitalWrite(BACKLIGHT_PIN, LOW);
   isDisplayOn = false;
+
+  // Radio duty cycling until the display is on again
+  procPtr.PowerManager.displayOff();
 }
 
 bool Proc_UIManager::initDisplay()
@@ -818,6 +893,7 @@ bool Proc_UIManager::initDisplay()
     pinMode(BACKLIGHT_PIN, OUTPUT);
     displayInitialized = true;
   }
+  return displayInitialized;
 }
 
 
@@ -937,7 +1013,7 @@ void Proc_UIManager::communicationsFlag(bool commOngoing)
   if (commOngoing)
   {
     // Show cloud icon
-    ui.drawBitmap(arrowsIO, 220, 45, arrowsIOWidth, arrowsIOHeight);
+    ui.drawPackedBitmap(arrowsIO, 220, 45);
   }
   else
   {
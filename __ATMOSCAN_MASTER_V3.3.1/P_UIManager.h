@@ -10,10 +10,13 @@
 #include <ProcessScheduler.h>
 #include <libpaj7620.h>           // https://github.com/MarcFinns/Gesture_PAJ7620
 #include <MAX17043.h>             // https://github.com/MarcFinns/ArduinoLib_MAX17043
-#include <Average.h>              // https://github.com/MajenkoLibraries/Average
 
 #include "ScreenFactory.h"
 #include "GfxUi.h"      // Additional UI functions
+#include "RunningStats.h"
+
+// Items of the top bar, each rebuilt within its own rectangle of the bar sprite
+enum BarItem { BAR_DATE, BAR_TIME, BAR_LOCATION, BAR_WIFI, BAR_BATTERY, BAR_ITEMS };
 
 struct TopBar
 {
@@ -21,7 +24,7 @@ struct TopBar
   String timeLine;
   String locationLine;
   int batLevel = 0;
-  int dBm = 0;
+  int wifiBars = 0;                 // -1 = disconnected
 };
 
 
@@ -61,22 +64,28 @@ class Proc_UIManager : public Process
     Screen * currentScreen;
     PAJ7620U gestureSensor;
     MAX17043 batteryMonitor;
-    Average<float> avgSOC;
-    Average<float> avgVolt;
+    RunningStats<float, AVERAGING_WINDOW> avgSOC;
+    RunningStats<float, AVERAGING_WINDOW> avgVolt;
     long lastBatteryAveraging = 0;
 
     bool displayInitialized;
     static Proc_UIManager * instance;
     TopBar topBar;
+    TFT_eSprite barSprite;            // Off-screen copy of the top bar, 4 bit palette (none if out of memory)
     bool initSuccess = false;
 
     // methods
     int getUserEvent();
     int handleSwipe(int evt, int curScrn);
     void initScreen();
+    bool createBarSprite();
+    TFT_eSPI &barCanvas();
+    uint16_t barInk(int color);
     void drawBar(bool forceDraw = false);
-    void drawBatteryGauge(int topX, int topY, int level, int redLevel, bool forceDraw);
-    void drawWifiGauge(int topX, int topY, int rssi, bool forceDraw);
+    void drawBarItem(int item);
+    void drawBatteryGauge(int topX, int topY, int level, int redLevel);
+    void drawWifiGauge(int topX, int topY, int bars);
+    int wifiBars(int dBm);
     bool initGesture();
     void batterySetup();
     String printDigits(int digits);
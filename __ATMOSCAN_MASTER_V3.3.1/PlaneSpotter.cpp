@@ -25,6 +25,7 @@
 
 */
 
+#include <algorithm>
 #include <SPI.h>
 
 // Go to settings to change important parameters
@@ -32,10 +33,12 @@
 #include "PlaneSpotter.h"
 #include "Fonts.h"
 #include "GlobalDefinitions.h"
+#include "GfxUi.h"
 #include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
 
 // External variables
 extern Syslog syslog;
+extern GfxUi ui;
 
 PlaneSpotter::PlaneSpotter(TFT_eSPI* tft, GeoMap* geoMap) {
   tft_ = tft;
@@ -44,7 +47,7 @@ PlaneSpotter::PlaneSpotter(TFT_eSPI* tft, GeoMap* geoMap) {
 }
 
 
-void PlaneSpotter::drawAircraftHistory(Aircraft aircraft, AircraftHistory history)
+void PlaneSpotter::drawAircraftHistory(const Aircraft &aircraft, const AircraftHistory &history)
 {
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_INFO, F("PlaneSpotter::drawAircraftHistory"));
@@ -56,8 +59,8 @@ void PlaneSpotter::drawAircraftHistory(Aircraft aircraft, AircraftHistory histor
   for (int j = 0; j < min(history.counter, MAX_HISTORY); j++)
   {
 
-    AircraftPosition position = history.positions[j];
-    Coordinates coordinates = position.coordinates;
+    const AircraftPosition &position = history.positions[j];
+    const Coordinates &coordinates = position.coordinates;
     CoordinatesPixel p1 = geoMap_->convertToPixel(coordinates);
 
     CoordinatesPixel p2 = geoMap_->convertToPixel(lastCoordinates);
@@ -73,7 +76,7 @@ void PlaneSpotter::drawAircraftHistory(Aircraft aircraft, AircraftHistory histor
 
 }
 
-void PlaneSpotter::drawPlane(Aircraft aircraft, bool isSpecial)
+void PlaneSpotter::drawPlane(const Aircraft &aircraft, bool isSpecial)
 {
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_INFO, F("PlaneSpotter::drawPlane"));
@@ -116,7 +119,7 @@ void PlaneSpotter::drawPlane(Aircraft aircraft, bool isSpecial)
 #endif
 }
 
-void PlaneSpotter::drawInfoBox(Aircraft closestAircraft)
+void PlaneSpotter::drawInfoBox(const Aircraft &closestAircraft)
 {
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_INFO, F("PlaneSpotter::drawInfoBox"));
@@ -130,7 +133,7 @@ void PlaneSpotter::drawInfoBox(Aircraft closestAircraft)
   // Clean infobox's lower lines
   tft_->fillRect(0, geoMap_->getMapHeight() + TOP_BAR_HEIGHT, tft_->width(), tft_->height() - (geoMap_->getMapHeight() + TOP_BAR_HEIGHT), TFT_BLACK);
 
-  if (closestAircraft.call != "")
+  if (closestAircraft.call[0] != '\0')
   {
     tft_->setFreeFont(&Dialog_plain_9);
 
@@ -174,7 +177,7 @@ void PlaneSpotter::drawInfoBox(Aircraft closestAircraft)
         tft_->setTextPadding(xwidth);
         tft_->drawString("Hdg: " + String(closestAircraft.heading, 0), right - xwidth, line2, GFXFONT );
     */
-    if (closestAircraft.fromShort != F("") && closestAircraft.toShort != F(""))
+    if (closestAircraft.fromShort[0] != '\0' && closestAircraft.toShort[0] != '\0')
     {
       // Use print stream so the line wraps (tft_->print does not work, kludge is to get the String returned so we can use the print class!)
       tft_->setFreeFont(&Dialog_plain_9);
@@ -191,3 +194,181 @@ void PlaneSpotter::drawInfoBox(Aircraft closestAircraft)
   syslog.log(LOG_INFO, F("END PlaneSpotter::drawInfoBox"));
 #endif
 }
+
+bool PlaneSpotter::setBackground()
+{
+  footprintCount_ = 0;
+
+  // Next to the map, so that removing the maps removes it too
+  backgroundName_ = geoMap_->getMapName();
+  backgroundName_.replace(F(".jpg"), F(".raw"));
+
+  if (!SPIFFS.exists(backgroundName_) && !ui.jpegToRaw(geoMap_->getMapName(), backgroundName_))
+  {
+#ifdef DEBUG_SYSLOG
+    syslog.log(LOG_DEBUG, F("PlaneSpotter: no room for the map copy, full redraws"));
+#endif
+    backgroundName_ = "";
+    return false;
+  }
+
+  return true;
+}
+
+bool PlaneSpotter::drawAircrafts(AdsbExchangeClient &adsbClient, const Aircraft &closestAircraft)
+{
+  int count = adsbClient.getNumberOfAircrafts();
+  fs::File background;
+  if (backgroundName_ != "")
+    background = SPIFFS.open(backgroundName_, "r");
+
+  if (background)
+  {
+    // Footprints still matching an aircraft are left alone, the others erased
+    bool kept[MAX_AIRCRAFTS] = {false};
+    bool matched[MAX_AIRCRAFTS] = {false};
+    int keptCount = 0;
+    AircraftFootprint footprint;
+
+    for (int f = 0; f < footprintCount_; f++)
+    {
+      for (int i = 0; i < count; i++)
+      {
+        const Aircraft &aircraft = adsbClient.getAircraft(i);
+        if (!matched[i] && strcmp(aircraft.call, footprints_[f].call) == 0)
+        {
+          matched[i] = true;
+          getFootprint(aircraft, adsbClient.getAircraftHistory(i), &aircraft == &closestAircraft, footprint);
+          kept[f] = memcmp(&footprint, &footprints_[f], sizeof(footprint)) == 0;
+          keptCount += kept[f];
+          break;
+        }
+      }
+    }
+
+    // Same aircrafts, none moved
+    if (keptCount == count && keptCount == footprintCount_)
+    {
+      background.close();
+      return false;
+    }
+
+    for (int f = 0; f < footprintCount_; f++)
+    {
+      if (!kept[f])
+        erase(background, footprints_[f]);
+    }
+    background.close();
+  }
+  else
+  {
+    // Nothing to erase from: whole map
+    ui.drawJpeg(geoMap_->getMapName(), 0, TOP_BAR_HEIGHT);
+  }
+
+  // All drawn again, the erased parts may have overlapped the others
+  for (int i = 0; i < count; i++)
+  {
+    const Aircraft &aircraft = adsbClient.getAircraft(i);
+    const AircraftHistory &history = adsbClient.getAircraftHistory(i);
+    bool isSpecial = &aircraft == &closestAircraft;
+
+    drawAircraftHistory(aircraft, history);
+    drawPlane(aircraft, isSpecial);
+    getFootprint(aircraft, history, isSpecial, footprints_[i]);
+  }
+  footprintCount_ = count;
+
+  return true;
+}
+
+void PlaneSpotter::getFootprint(const Aircraft &aircraft, const AircraftHistory &history, bool isSpecial, AircraftFootprint &footprint)
+{
+  // Compared as a whole: no padding left uninitialised
+  memset(&footprint, 0, sizeof(footprint));
+  strcpy(footprint.call, aircraft.call);
+  footprint.heading = aircraft.heading * 10;
+  footprint.isSpecial = isSpecial;
+
+  Coordinates coordinates;
+  coordinates.lat = aircraft.lat;
+  coordinates.lon = aircraft.lon;
+  CoordinatesPixel p = geoMap_->convertToPixel(coordinates);
+  footprint.x[0] = p.x;
+  footprint.y[0] = p.y;
+
+  int positions = min(history.counter, MAX_HISTORY);
+  for (int j = 0; j < positions; j++)
+  {
+    p = geoMap_->convertToPixel(history.positions[j].coordinates);
+    footprint.x[j + 1] = p.x;
+    footprint.y[j + 1] = p.y;
+    footprint.colors[j] = min(history.positions[j].altitude / 4000, 9);
+  }
+  footprint.points = positions + 1;
+}
+
+// Same extents as drawAircraftHistory() and drawPlane()
+void PlaneSpotter::erase(fs::File &background, const AircraftFootprint &footprint)
+{
+  for (int j = 1; j < footprint.points; j++)
+    eraseLine(background, footprint.x[j], footprint.y[j], footprint.x[j - 1], footprint.y[j - 1]);
+
+  int32_t x = footprint.x[0];
+  int32_t y = footprint.y[0];
+
+  // Plane: within its radius
+  eraseRect(background, x - 11, y - 11, 23, 23);
+
+  // Call sign, bottom centered below the plane (with a margin for the glyphs overhang)
+  tft_->setFreeFont(&Dialog_plain_9);
+  int32_t w = tft_->textWidth(footprint.call, GFXFONT);
+  int32_t h = tft_->fontHeight(GFXFONT);
+  eraseRect(background, x + 8 - w / 2 - 2, y + 15 - h - 2, w + 4, h + 4);
+}
+
+// Walks the line as TFT_eSPI::drawLine() does and erases it run by run, together
+// with the copy drawn one pixel down and right
+void PlaneSpotter::eraseLine(fs::File &background, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep)
+  {
+    std::swap(x0, y0);
+    std::swap(x1, y1);
+  }
+  if (x0 > x1)
+  {
+    std::swap(x0, x1);
+    std::swap(y0, y1);
+  }
+
+  int32_t dx = x1 - x0, dy = abs(y1 - y0);
+  int32_t err = dx >> 1, ystep = (y0 < y1) ? 1 : -1;
+
+  int32_t runStart = x0;
+  for (int32_t x = x0; x <= x1; x++)
+  {
+    err -= dy;
+    if (err < 0 || x == x1)
+    {
+      int32_t length = x - runStart + 1;
+      if (steep)
+        eraseRect(background, y0, runStart, 2, length + 1);
+      else
+        eraseRect(background, runStart, y0, length + 1, 2);
+      if (err < 0)
+      {
+        y0 += ystep;
+        err += dx;
+      }
+      runStart = x + 1;
+    }
+  }
+}
+
+void PlaneSpotter::eraseRect(fs::File &background, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  ui.drawRaw(background, 0, TOP_BAR_HEIGHT, x, y, w, h);
+}
+
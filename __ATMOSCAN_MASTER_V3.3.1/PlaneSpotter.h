@@ -42,16 +42,40 @@ enum TextAlignment {
   LEFT, CENTER, RIGHT
 };
 
+// What an aircraft left on the map, in pixels, to erase it once it has moved
+struct AircraftFootprint {
+  char call[AIRCRAFT_CALL_SIZE];
+  int16_t x[MAX_HISTORY + 1];                 // The plane, then its trail
+  int16_t y[MAX_HISTORY + 1];
+  uint8_t colors[MAX_HISTORY];                // Height palette index of each trail segment
+  uint8_t points;
+  int16_t heading;                            // Tenths of degree
+  bool isSpecial;
+};
+
 class PlaneSpotter {
   public:
     PlaneSpotter(TFT_eSPI* tft, GeoMap* geoMap);
-    void drawPlane(Aircraft aircraft, bool isSpecial);
-    void drawInfoBox(Aircraft closestAircraft);
-    void drawAircraftHistory(Aircraft aircraft, AircraftHistory history);
+    void drawPlane(const Aircraft &aircraft, bool isSpecial);
+    void drawInfoBox(const Aircraft &closestAircraft);
+    void drawAircraftHistory(const Aircraft &aircraft, const AircraftHistory &history);
+
+    // Raw copy of the current map, to erase from. Without it the whole map is redrawn
+    bool setBackground();
+
+    // Erases the aircrafts that moved and draws them all again, false if none moved
+    bool drawAircrafts(AdsbExchangeClient &adsbClient, const Aircraft &closestAircraft);
 
   private:
     TFT_eSPI* tft_;
     GeoMap* geoMap_;
+    String backgroundName_;
+    AircraftFootprint footprints_[MAX_AIRCRAFTS];
+    int footprintCount_ = 0;
+    void getFootprint(const Aircraft &aircraft, const AircraftHistory &history, bool isSpecial, AircraftFootprint &footprint);
+    void erase(fs::File &background, const AircraftFootprint &footprint);
+    void eraseLine(fs::File &background, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+    void eraseRect(fs::File &background, int32_t x, int32_t y, int32_t w, int32_t h);
     // Shape of the plane
     // The points are defined as degree on a circle, the first array are the degrees,
     // the second the radius of the circle
@@ -0,0 +1,211 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#include "ProcessProfiler.h"
+
+// -------------------------------------------------------
+// Single service() run
+// -------------------------------------------------------
+
+ProcessProfiler::Run::Run(Process *process)
+  : stats(profiler.find(process)),
+    memory(stats != NULL ? &stats->memory : NULL, stats != NULL ? stats->name : NULL)
+{
+  // Period the run was scheduled with (service() may change it)
+  period = process->getPeriod() * 1000UL;
+  start = micros();
+}
+
+ProcessProfiler::Run::~Run()
+{
+  if (stats != NULL)
+    profiler.record(*stats, start, micros() - start, period);
+}
+
+// -------------------------------------------------------
+// Profiler
+// -------------------------------------------------------
+
+ProcessProfiler::ProcessProfiler()
+{
+  reset();
+}
+
+bool ProcessProfiler::add(Process &process, const __FlashStringHelper *name)
+{
+  if (numProcesses >= PROFILER_MAX_PROCESSES || find(&process) != NULL)
+    return false;
+
+  stats[numProcesses].process = &process;
+  stats[numProcesses].name = name;
+  numProcesses++;
+  return true;
+}
+
+int ProcessProfiler::count()
+{
+  return numProcesses;
+}
+
+ServiceStats &ProcessProfiler::get(int index)
+{
+  return stats[index];
+}
+
+ServiceStats *ProcessProfiler::find(Process *process)
+{
+  for (int i = 0; i < numProcesses; i++)
+    if (stats[i].process == process)
+      return &stats[i];
+
+  return NULL;
+}
+
+// Clear statistics, keeping registered processes
+void ProcessProfiler::reset()
+{
+  for (int i = 0; i < PROFILER_MAX_PROCESSES; i++)
+  {
+    Process *process = stats[i].process;
+    const __FlashStringHelper *name = stats[i].name;
+
+    memset(&stats[i], 0, sizeof(ServiceStats));
+
+    if (i < numProcesses)
+    {
+      stats[i].process = process;
+      stats[i].name = name;
+    }
+  }
+
+  busyTime = 0;
+  sinceMillis = millis();
+}
+
+void ProcessProfiler::record(ServiceStats &s, uint32_t start, uint32_t duration, uint32_t period)
+{
+  // Jitter: how late this run started, compared to the previous one plus a period
+  // NOTE: forced runs start early, they count as on time
+  if (s.runs > 0)
+  {
+    int32_t lateness = (int32_t)(start - s.lastStart - period);
+    if (lateness > 0)
+    {
+      s.totalLateness += lateness;
+      if ((uint32_t)lateness > s.maxLateness)
+        s.maxLateness = lateness;
+
+      // A whole activation was lost
+      if (period > 0 && (uint32_t)lateness >= period)
+        s.missed++;
+    }
+  }
+  s.lastStart = start;
+
+  // Execution time
+  if (s.runs == 0 || duration < s.minTime)
+    s.minTime = duration;
+  if (duration > s.maxTime)
+    s.maxTime = duration;
+  s.totalTime += duration;
+  s.runs++;
+
+  if (period > 0 && duration > period)
+    s.overruns++;
+
+  // Histogram, halved when a bucket saturates so it keeps following recent behaviour
+  int bucket = bucketOf(duration);
+  if (s.histogram[bucket] == 0xFFFF)
+  {
+    for (int i = 0; i < PROFILER_BUCKETS; i++)
+      s.histogram[i] >>= 1;
+  }
+  s.histogram[bucket]++;
+
+  busyTime += duration;
+}
+
+uint32_t ProcessProfiler::getAvgTime(ServiceStats &s)
+{
+  return s.runs ? s.totalTime / s.runs : 0;
+}
+
+uint32_t ProcessProfiler::getAvgLateness(ServiceStats &s)
+{
+  return s.runs > 1 ? s.totalLateness / (s.runs - 1) : 0;
+}
+
+// Upper bound of the bucket holding the given percentile (half-octave resolution)
+uint32_t ProcessProfiler::getPercentile(ServiceStats &s, int percent)
+{
+  uint32_t total = 0;
+  for (int i = 0; i < PROFILER_BUCKETS; i++)
+    total += s.histogram[i];
+
+  if (total == 0)
+    return 0;
+
+  uint32_t target = (total * percent + 99) / 100;
+  uint32_t cumulated = 0;
+  for (int i = 0; i < PROFILER_BUCKETS; i++)
+  {
+    cumulated += s.histogram[i];
+    if (cumulated >= target)
+      return bucketLimit(i) < s.maxTime ? bucketLimit(i) : s.maxTime;
+  }
+
+  return s.maxTime;
+}
+
+// Fraction of time spent in service() since reset
+float ProcessProfiler::getLoad()
+{
+  unsigned long elapsed = millis() - sinceMillis;
+  return elapsed ? (float)(busyTime / 1000) / elapsed : 0;
+}
+
+uint32_t ProcessProfiler::getTotalMissed()
+{
+  uint32_t missed = 0;
+  for (int i = 0; i < numProcesses; i++)
+    missed += stats[i].missed;
+  return missed;
+}
+
+String ProcessProfiler::formatTime(uint32_t us)
+{
+  if (us < 10000)
+    return String(us / 1000.0, 1);
+  else if (us < 1000000)
+    return String(us / 1000);
+  else
+    return String(us / 1000000.0, 1) + F("s");
+}
+
+// Bucket 2n covers [2^n, 1.5 * 2^n), bucket 2n+1 covers [1.5 * 2^n, 2^(n+1))
+int ProcessProfiler::bucketOf(uint32_t us)
+{
+  if (us < 2)
+    return 0;
+
+  int msb = 31 - __builtin_clz(us);
+  int bucket = 2 * msb + ((us >> (msb - 1)) & 1);
+
+  return bucket < PROFILER_BUCKETS ? bucket : PROFILER_BUCKETS - 1;
+}
+
+uint32_t ProcessProfiler::bucketLimit(int bucket)
+{
+  int msb = bucket / 2;
+
+  if (bucket < 2)
+    return 2;
+  else if (bucket & 1)
+    return 1UL << (msb + 1);
+  else
+    return (1UL << msb) + (1UL << (msb - 1));
+}
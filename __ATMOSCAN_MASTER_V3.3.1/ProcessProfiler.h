@@ -0,0 +1,81 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <ProcessScheduler.h>     // https://github.com/wizard97/ArduinoProcessScheduler
+
+#include "MemoryMonitor.h"
+
+#define PROFILER_MAX_PROCESSES 12
+#define PROFILER_BUCKETS 44           // Half-octave histogram buckets, 1us to ~4s
+
+// Execution statistics of a process service() (times in microseconds)
+struct ServiceStats
+{
+  Process *process;
+  const __FlashStringHelper *name;
+  uint32_t runs;
+  uint32_t minTime;
+  uint32_t maxTime;
+  uint64_t totalTime;
+  uint32_t maxLateness;               // Start time vs. previous start + period
+  uint64_t totalLateness;
+  uint32_t missed;                    // Started one full period (or more) late
+  uint32_t overruns;                  // service() took longer than the period
+  uint32_t lastStart;
+  uint16_t histogram[PROFILER_BUCKETS];
+  MemoryStats memory;                 // Heap taken by service()
+};
+
+// Collects service() execution time, scheduling jitter and missed deadlines
+class ProcessProfiler
+{
+  public:
+    // Times a single service() execution, and watches its heap: declare it at the top of service()
+    class Run
+    {
+      public:
+        Run(Process *process);
+        ~Run();
+
+      private:
+        ServiceStats *stats;
+        uint32_t start;
+        uint32_t period;
+        MemoryMonitor::Scope memory;
+    };
+
+    ProcessProfiler();
+    bool add(Process &process, const __FlashStringHelper *name);
+    int count();
+    ServiceStats &get(int index);
+    ServiceStats *find(Process *process);
+    void reset();
+
+    // Derived figures
+    uint32_t getAvgTime(ServiceStats &stats);
+    uint32_t getAvgLateness(ServiceStats &stats);
+    uint32_t getPercentile(ServiceStats &stats, int percent);
+    float getLoad();
+    uint32_t getTotalMissed();
+
+    // Human readable time in milliseconds, seconds above 1000 (up to 4 characters)
+    static String formatTime(uint32_t us);
+
+  private:
+    ServiceStats stats[PROFILER_MAX_PROCESSES];
+    int numProcesses = 0;
+    uint64_t busyTime = 0;
+    unsigned long sinceMillis = 0;
+
+    void record(ServiceStats &stats, uint32_t start, uint32_t duration, uint32_t period);
+    static int bucketOf(uint32_t us);
+    static uint32_t bucketLimit(int bucket);
+};
+
+extern ProcessProfiler profiler;
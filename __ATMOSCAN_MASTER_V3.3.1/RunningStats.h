@@ -0,0 +1,209 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <Arduino.h>
+
+// Default window of sensor statistics
+#define AVERAGING_WINDOW 12         // NOTE: 12 * 5 sec sensor sampling rate = 1 minute
+
+// Statistics over a sliding window of the last samples, all O(1) per push and per query.
+// Running sums give mean, variance and trend; monotonic queues of window slots give
+// minimum and maximum (each slot enters and leaves a queue once).
+// NOTE: the logic lives here, independent of the window size, so that it is
+// instantiated once per type; RunningStats<T, N> below provides the storage
+template <class T>
+class RunningStatsBase
+{
+  public:
+    void push(T value);
+    void clear();
+    uint8_t getCount();
+    T last();
+    float mean();
+    float variance();
+    float stddev();
+    T minimum();
+    T maximum();
+    float trend();                    // Least squares slope, per sample
+
+  protected:
+    RunningStatsBase(T *window, uint8_t *minQueue, uint8_t *maxQueue, uint8_t capacity)
+      : window(window), minQueue(minQueue), maxQueue(maxQueue), capacity(capacity) {}
+
+  private:
+    T *window;
+    uint8_t *minQueue;                // Slots of increasing values, oldest first
+    uint8_t *maxQueue;                // Slots of decreasing values, oldest first
+    uint8_t capacity;
+    uint8_t oldest = 0;
+    uint8_t count = 0;
+    uint8_t minFront = 0;
+    uint8_t minCount = 0;
+    uint8_t maxFront = 0;
+    uint8_t maxCount = 0;
+
+    // NOTE: double, so that adding and removing samples does not drift
+    double sum = 0;
+    double sumSquares = 0;
+    double sumWeighted = 0;           // Sum of age rank * value (rank 0 = oldest)
+
+    uint8_t slot(uint8_t front, uint8_t index);
+};
+
+// Fixed capacity window (no heap), up to 255 samples
+template <class T, uint8_t N>
+class RunningStats : public RunningStatsBase<T>
+{
+  public:
+    RunningStats() : RunningStatsBase<T>(store, minQueue, maxQueue, N) {}
+
+    // The base points into this object
+    RunningStats(const RunningStats &) = delete;
+    RunningStats &operator=(const RunningStats &) = delete;
+
+  private:
+    T store[N];
+    uint8_t minQueue[N];
+    uint8_t maxQueue[N];
+};
+
+// What sensors expose to screens and MQTT
+typedef RunningStatsBase<float> SensorStats;
+
+
+// -------------------------------------------------------
+// Implementation
+// -------------------------------------------------------
+
+template <class T>
+void RunningStatsBase<T>::push(T value)
+{
+  uint8_t newest;
+
+  if (count == capacity)
+  {
+    // Oldest sample leaves the window...
+    T old = window[oldest];
+    sum -= old;
+    sumSquares -= (double)old * old;
+
+    // ...and all the others get one rank older
+    sumWeighted -= sum;
+
+    if (minCount > 0 && minQueue[minFront] == oldest)
+    {
+      minFront = slot(minFront, 1);
+      minCount--;
+    }
+    if (maxCount > 0 && maxQueue[maxFront] == oldest)
+    {
+      maxFront = slot(maxFront, 1);
+      maxCount--;
+    }
+
+    newest = oldest;
+    oldest = slot(oldest, 1);
+  }
+  else
+  {
+    newest = slot(oldest, count);
+    count++;
+  }
+
+  window[newest] = value;
+  sum += value;
+  sumSquares += (double)value * value;
+  sumWeighted += (double)(count - 1) * value;
+
+  // Queued slots that can no longer be the minimum (maximum) are dropped
+  while (minCount > 0 && window[minQueue[slot(minFront, minCount - 1)]] >= value)
+    minCount--;
+  minQueue[slot(minFront, minCount++)] = newest;
+
+  while (maxCount > 0 && window[maxQueue[slot(maxFront, maxCount - 1)]] <= value)
+    maxCount--;
+  maxQueue[slot(maxFront, maxCount++)] = newest;
+}
+
+template <class T>
+void RunningStatsBase<T>::clear()
+{
+  oldest = count = 0;
+  minFront = minCount = maxFront = maxCount = 0;
+  sum = sumSquares = sumWeighted = 0;
+}
+
+template <class T>
+uint8_t RunningStatsBase<T>::getCount()
+{
+  return count;
+}
+
+template <class T>
+T RunningStatsBase<T>::last()
+{
+  return count ? window[slot(oldest, count - 1)] : 0;
+}
+
+template <class T>
+float RunningStatsBase<T>::mean()
+{
+  return count ? sum / count : 0;
+}
+
+// Population variance, as Average::stddev() squared
+template <class T>
+float RunningStatsBase<T>::variance()
+{
+  if (count == 0)
+    return 0;
+
+  double average = sum / count;
+  double result = sumSquares / count - average * average;
+  return result > 0 ? result : 0;
+}
+
+template <class T>
+float RunningStatsBase<T>::stddev()
+{
+  return sqrt(variance());
+}
+
+template <class T>
+T RunningStatsBase<T>::minimum()
+{
+  return minCount ? window[minQueue[minFront]] : 0;
+}
+
+template <class T>
+T RunningStatsBase<T>::maximum()
+{
+  return maxCount ? window[maxQueue[maxFront]] : 0;
+}
+
+template <class T>
+float RunningStatsBase<T>::trend()
+{
+  if (count < 2)
+    return 0;
+
+  // Sums of the ranks 0..n-1 and of their squares
+  double n = count;
+  double sumRanks = n * (n - 1) / 2;
+  double sumRanks2 = (n - 1) * n * (2 * n - 1) / 6;
+
+  return (n * sumWeighted - sumRanks * sum) / (n * sumRanks2 - sumRanks * sumRanks);
+}
+
+template <class T>
+uint8_t RunningStatsBase<T>::slot(uint8_t front, uint8_t index)
+{
+  uint16_t position = front + index;
+  return position < capacity ? position : position - capacity;
+}
@@ -0,0 +1,254 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
+
+#include "SampleLog.h"
+
+// External variables
+extern Syslog syslog;
+
+// Prototypes
+void errLog(String msg);
+
+#define SAMPLELOG_PREFIX "/slog_"
+#define SAMPLELOG_ACK "/slog.ack"
+
+// Scans SPIFFS for segments left by a previous run
+bool SampleLog::begin()
+{
+  if (!SPIFFS.begin())
+  {
+    errLog(F("Sample log - no file system"));
+    return false;
+  }
+
+  bool found = false;
+  size_t tailSize = 0;
+  size_t headSize = 0;
+
+  fs::Dir dir = SPIFFS.openDir(F(SAMPLELOG_PREFIX));
+  while (dir.next())
+  {
+    uint32_t segment = dir.fileName().substring(strlen(SAMPLELOG_PREFIX)).toInt();
+
+    if (!found || segment < tailSegment)
+    {
+      tailSegment = segment;
+      tailSize = dir.fileSize();
+    }
+    if (!found || segment > headSegment)
+    {
+      headSegment = segment;
+      headSize = dir.fileSize();
+    }
+    found = true;
+  }
+
+  if (found)
+  {
+    // NOTE: a partial record means power was lost while writing: keep the
+    // whole records, but never append after the broken one
+    tailRecords = tailSize / sizeof(SampleRecord);
+    headRecords = headSize / sizeof(SampleRecord);
+    headClosed = (headSize % sizeof(SampleRecord)) != 0;
+
+    // Position in the oldest segment
+    if (SPIFFS.exists(F(SAMPLELOG_ACK)))
+    {
+      fs::File ack = SPIFFS.open(F(SAMPLELOG_ACK), "r");
+      tailSent = ack.size() < tailRecords ? ack.size() : tailRecords;
+      ack.close();
+    }
+
+    syslog.log(LOG_INFO, String(F("Sample log - ")) + String(count()) + F(" samples pending"));
+  }
+
+  initialised = true;
+  return true;
+}
+
+bool SampleLog::append(SampleRecord &record)
+{
+  if (!initialised)
+    return false;
+
+  // Taken before the clock was set: its time would be made up
+  if (record.timestamp == 0)
+  {
+    dropped++;
+    return false;
+  }
+
+  record.checksum = computeChecksum(record);
+
+  // Head segment full (or closed after a failed write), start next one
+  if (headRecords >= SAMPLELOG_SEGMENT_RECORDS || headClosed)
+  {
+    headClosed = false;
+
+    if (count() == 0)
+    {
+      // Nothing pending, just start over
+      dropTail();
+    }
+    else
+    {
+      headSegment++;
+      headRecords = 0;
+
+      // Bounded flash usage: drop the oldest segment
+      if (headSegment - tailSegment >= SAMPLELOG_SEGMENTS)
+      {
+        dropped += tailRecords - tailSent;
+        errLog(F("Sample log full, oldest dropped"));
+        dropTail();
+      }
+    }
+  }
+
+  fs::File segment = SPIFFS.open(segmentName(headSegment), "a");
+  if (!segment)
+  {
+    errLog(F("Sample log - write error"));
+    return false;
+  }
+
+  size_t written = segment.write((uint8_t *)&record, sizeof(SampleRecord));
+  segment.close();
+
+  if (written != sizeof(SampleRecord))
+  {
+    // Do not append after a partial record
+    errLog(F("Sample log - write error"));
+    headClosed = true;
+    return false;
+  }
+
+  headRecords++;
+  if (tailSegment == headSegment)
+    tailRecords = headRecords;
+
+  return true;
+}
+
+// Oldest pending record, without removing it
+bool SampleLog::peek(SampleRecord &record)
+{
+  while (count() > 0)
+  {
+    // Tail segment exhausted (can only be shorter than expected), move on
+    if (tailSent >= tailRecords)
+    {
+      dropTail();
+      continue;
+    }
+
+    fs::File segment = SPIFFS.open(segmentName(tailSegment), "r");
+    if (!segment)
+    {
+      errLog(F("Sample log - segment lost"));
+      dropped += tailRecords - tailSent;
+      dropTail();
+      continue;
+    }
+
+    bool valid = segment.seek(tailSent * sizeof(SampleRecord), SeekSet) &&
+                 segment.read((uint8_t *)&record, sizeof(SampleRecord)) == sizeof(SampleRecord) &&
+                 record.checksum == computeChecksum(record);
+    segment.close();
+
+    if (valid)
+      return true;
+
+    // Corrupted record, skip it
+    errLog(F("Sample log - bad record"));
+    dropped++;
+    pop();
+  }
+
+  return false;
+}
+
+// Removes the oldest pending record (once sent)
+void SampleLog::pop()
+{
+  if (count() == 0)
+    return;
+
+  // One byte per sent record: appending never rewrites a flash page already written
+  fs::File ack = SPIFFS.open(F(SAMPLELOG_ACK), "a");
+  ack.write((uint8_t)0);
+  ack.close();
+
+  tailSent++;
+
+  // Oldest segment completely sent
+  if (tailSent >= tailRecords)
+    dropTail();
+}
+
+uint32_t SampleLog::count()
+{
+  if (tailSegment == headSegment)
+    return headRecords - tailSent;
+
+  // NOTE: segments in between are assumed full
+  return (tailRecords - tailSent) + (headSegment - tailSegment - 1) * SAMPLELOG_SEGMENT_RECORDS + headRecords;
+}
+
+uint32_t SampleLog::getDropped()
+{
+  return dropped;
+}
+
+String SampleLog::segmentName(uint32_t segment)
+{
+  return String(F(SAMPLELOG_PREFIX)) + String(segment);
+}
+
+// Deletes the oldest segment and its sent marks
+void SampleLog::dropTail()
+{
+  SPIFFS.remove(segmentName(tailSegment));
+  SPIFFS.remove(F(SAMPLELOG_ACK));
+  tailSent = 0;
+
+  // Log now empty
+  if (tailSegment == headSegment)
+  {
+    headSegment++;
+    tailSegment = headSegment;
+    headRecords = 0;
+    tailRecords = 0;
+    headClosed = false;
+    return;
+  }
+
+  tailSegment++;
+
+  if (tailSegment == headSegment)
+    tailRecords = headRecords;
+  else
+  {
+    fs::File segment = SPIFFS.open(segmentName(tailSegment), "r");
+    tailRecords = segment ? segment.size() / sizeof(SampleRecord) : 0;
+    segment.close();
+  }
+}
+
+// Rotate and add 32 bit words; seeded so that erased or zeroed flash never validates
+uint32_t SampleLog::computeChecksum(SampleRecord &record)
+{
+  const uint32_t *words = (const uint32_t *)&record;
+  uint32_t sum = 0x5A17C0DE;
+
+  for (size_t i = 0; i < offsetof(SampleRecord, checksum) / sizeof(uint32_t); i++)
+    sum = ((sum << 5) | (sum >> 27)) + words[i];
+
+  return sum;
+}
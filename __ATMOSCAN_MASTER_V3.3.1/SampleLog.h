@@ -0,0 +1,77 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <FS.h>
+
+// Flash budget: SAMPLELOG_SEGMENTS * SAMPLELOG_SEGMENT_RECORDS * sizeof(SampleRecord)
+// NOTE: 8 * 90 records of 72 bytes = 12 hours of samples at one per minute, 51840 bytes (~52KB)
+//       or ~55KB of SPIFFS pages (page headers and an index page per segment)
+#define SAMPLELOG_SEGMENTS 8
+#define SAMPLELOG_SEGMENT_RECORDS 90
+
+// Metrics carried by MQTT topic 1 and 2, in payload order
+enum SampleMetric
+{
+  METRIC_TEMPERATURE,
+  METRIC_HUMIDITY,
+  METRIC_PRESSURE,
+  METRIC_PM01,
+  METRIC_PM2_5,
+  METRIC_PM10,
+  METRIC_CPM,
+  METRIC_RADIATION,
+  METRIC_CO,
+  METRIC_CO2,
+  METRIC_NO2,
+  METRIC_VOC,
+  METRIC_PM2_5_MAX,                 // Peaks over the averaging window
+  METRIC_PM10_MAX,
+  METRIC_CO2_MAX,
+  METRIC_CPM_MAX,
+  SAMPLE_METRICS
+};
+
+// Fixed size record, as stored in flash
+struct SampleRecord
+{
+  uint32_t timestamp;               // UTC, seconds (0: clock not set)
+  float values[SAMPLE_METRICS];
+  uint32_t checksum;
+};
+static_assert(sizeof(SampleRecord) == 72, "SampleRecord size changed: update the flash budget above");
+
+// Append-only log of samples in SPIFFS, used while MQTT is unreachable.
+// Records are appended to numbered segment files ("/slog_<n>"); the oldest
+// segment is deleted once fully sent, or dropped when the log is full.
+// Sent records of the oldest segment are counted in "/slog.ack", one byte each,
+// so that no file is ever rewritten and the position survives a reboot.
+class SampleLog
+{
+  public:
+    bool begin();
+    bool append(SampleRecord &record);
+    bool peek(SampleRecord &record);
+    void pop();
+    uint32_t count();
+    uint32_t getDropped();
+
+  private:
+    uint32_t tailSegment = 0;       // Oldest segment
+    uint32_t headSegment = 0;       // Segment being appended to
+    uint16_t tailRecords = 0;       // Records in tail segment
+    uint16_t tailSent = 0;          // Records of tail segment already sent
+    uint16_t headRecords = 0;       // Records in head segment
+    bool headClosed = false;        // Head segment ends with a partial record
+    uint32_t dropped = 0;
+    bool initialised = false;
+
+    String segmentName(uint32_t segment);
+    void dropTail();
+    static uint32_t computeChecksum(SampleRecord &record);
+};
@@ -60,10 +60,8 @@ void ScreenBuienRadar::activate()
   if (lastImageDownloaded > 0 && lastImageDownloaded < 23)
   {
     // For the time being, display the last downloaded image
-    if (SPIFFS.exists(String(F("/forecast")) + String(lastImageDownloaded) + F(".jpg")) == true)
+    if (drawForecast(lastImageDownloaded))
     {
-      ui.drawJpeg(String(F("/forecast")) + String(lastImageDownloaded) + F(".jpg"), 0,  1 + TOP_BAR_HEIGHT);
-
       // Draw play status
       LCD.fillCircle(lastImageDownloaded  * 10 + 5, 253, 3, TFT_RED);
     }
@@ -83,7 +81,7 @@ void ScreenBuienRadar::activate()
     {
       // Display logo
       LCD.fillRect(0, 1 + TOP_BAR_HEIGHT, 240, 255, TFT_WHITE);
-      ui.drawBitmap(BuienLogo, 0, 160, 240, 44);
+      ui.drawPackedBitmap(BuienLogo, 0, 160);
     }
   }
 
@@ -145,6 +143,14 @@ void ScreenBuienRadar::update()
 
         syslog.log(LOG_DEBUG, "DOWNLOAD SIZE = " + String(len));
 
+#ifdef BUIENRADAR_FRAME_CACHE
+        // Decode once, playback is then a copy to the display (the JPEG stays if it can't)
+        if (ui.jpegToFrame(filename, String(F("/forecast")) + String(currentImage) + F(".frm")))
+          SPIFFS.remove(filename);
+        else
+          syslog.log(LOG_INFO, F("BuienRadar - no room to cache frame, playing JPEG"));
+#endif
+
         // Downloaded finished
         if (currentImage == MAX_IMAGES)
         {
@@ -161,10 +167,8 @@ void ScreenBuienRadar::update()
       }
 
       // Display current image from SPIFFS
-      if (SPIFFS.exists(String(F("/forecast")) + String(currentImage) + F(".jpg")) == true)
+      if (drawForecast(currentImage))
       {
-        ui.drawJpeg(String(F("/forecast")) + String(currentImage) + F(".jpg"), 0,  1 + TOP_BAR_HEIGHT);
-
         // Draw play status
         LCD.fillCircle(currentImage  * 10 + 5, 253, 3, TFT_RED);
       }
@@ -508,6 +512,23 @@ int ScreenBuienRadar::getLocalForecast( double latitude, double longitude, Strin
   return dataPoints;
 }
 
+// Draws a forecast image from its frame copy, or from the JPEG
+bool ScreenBuienRadar::drawForecast(int image)
+{
+  String name = String(F("/forecast")) + String(image);
+
+#ifdef BUIENRADAR_FRAME_CACHE
+  if (ui.drawFrame(name + F(".frm"), 0, 1 + TOP_BAR_HEIGHT))
+    return true;
+#endif
+
+  if (!SPIFFS.exists(name + F(".jpg")))
+    return false;
+
+  ui.drawJpeg(name + F(".jpg"), 0,  1 + TOP_BAR_HEIGHT);
+  return true;
+}
+
 void ScreenBuienRadar::removeAllMaps()
 {
   syslog.log(LOG_DEBUG, "REMOVING ALL MAPS");
@@ -28,6 +28,7 @@ class ScreenBuienRadar: public Screen
     int getForecastImage(String host, String resource, String filename);
     int getLocalForecast( double latitude, double longitude, String (&hours)[24], int (&forecasts)[24]);
     void removeAllMaps();
+    bool drawForecast(int image);
 
     bool isInitialised;
     static long lastImageRefreshTime;
@@ -44,665 +45,295 @@ class ScreenBuienRadar: public Screen
 // Image Size     : 240x44 pixels
 // Memory usage   : 21120 bytes
 
-const unsigned short BuienLogo[10560] PROGMEM = {
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0010 (16) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0020 (32) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0030 (48) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0040 (64) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0050 (80) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0060 (96) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0070 (112) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0080 (128) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0090 (144) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00A0 (160) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00B0 (176) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00C0 (192) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00D0 (208) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00E0 (224) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x00F0 (240) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0100 (256) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0110 (272) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0120 (288) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0130 (304) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0140 (320) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0150 (336) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0160 (352) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0170 (368) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0180 (384) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0190 (400) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x01A0 (416) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x01B0 (432) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x01C0 (448) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x01D0 (464) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x01E0 (480) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x01F0 (496) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0200 (512) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0210 (528) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0220 (544) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0230 (560) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0240 (576) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0250 (592) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0260 (608) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0270 (624) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0280 (640) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0290 (656) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02A0 (672) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02B0 (688) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02C0 (704) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x02D0 (720) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02E0 (736) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02F0 (752) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0300 (768) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0310 (784) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0320 (800) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0330 (816) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0340 (832) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0350 (848) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0360 (864) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0370 (880) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0380 (896) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0390 (912) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03A0 (928) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03B0 (944) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x03C0 (960) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03D0 (976) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03E0 (992) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03F0 (1008) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0400 (1024) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0410 (1040) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0420 (1056) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0430 (1072) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0440 (1088) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0450 (1104) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0460 (1120) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0470 (1136) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0480 (1152) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0490 (1168) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04A0 (1184) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x04B0 (1200) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04C0 (1216) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04D0 (1232) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04E0 (1248) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04F0 (1264) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0500 (1280) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0510 (1296) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0520 (1312) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0530 (1328) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0540 (1344) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0550 (1360) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0560 (1376) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0570 (1392) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0580 (1408) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0590 (1424) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x05A0 (1440) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05B0 (1456) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05C0 (1472) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05D0 (1488) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05E0 (1504) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05F0 (1520) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0600 (1536) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0610 (1552) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0620 (1568) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0630 (1584) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0640 (1600) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0650 (1616) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0660 (1632) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0670 (1648) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0680 (1664) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0690 (1680) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06A0 (1696) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06B0 (1712) pixels
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06C0 (1728) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06D0 (1744) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06E0 (1760) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06F0 (1776) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0700 (1792) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0710 (1808) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0720 (1824) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0730 (1840) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0740 (1856) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0750 (1872) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0760 (1888) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0770 (1904) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0780 (1920) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0790 (1936) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07A0 (1952) pixels
-  0xFFFF, 0xE77E, 0xEF7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07B0 (1968) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07C0 (1984) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07D0 (2000) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07E0 (2016) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07F0 (2032) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0800 (2048) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0810 (2064) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0820 (2080) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0830 (2096) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0840 (2112) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0850 (2128) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0860 (2144) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0870 (2160) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0880 (2176) pixels
-  0xFFFF, 0xDF1F, 0x9D58, 0x73F4, 0x5B11, 0x4AD0, 0x5B11, 0x73F4, 0xA579, 0xDF3F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0890 (2192) pixels
-  0xD6FD, 0xD6DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08A0 (2208) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08B0 (2224) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08C0 (2240) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08D0 (2256) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08E0 (2272) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08F0 (2288) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0900 (2304) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0910 (2320) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0920 (2336) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0930 (2352) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0940 (2368) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0950 (2384) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0960 (2400) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC67E,   // 0x0970 (2416) pixels
-  0x5B53, 0x21AD, 0x196D, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196D, 0x29AD, 0x6392, 0xD6DE, 0xFFFF, 0xFFFF, 0xF7FF, 0xC67B,   // 0x0980 (2432) pixels
-  0xBE3A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7BF, 0xF7DF,   // 0x0990 (2448) pixels
-  0xF7DF, 0xF7DF, 0xF7DF, 0xF7BF, 0xF7DF, 0xF7DF, 0xF7BF, 0xF7DF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09A0 (2464) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09B0 (2480) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09C0 (2496) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09D0 (2512) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09E0 (2528) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09F0 (2544) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A00 (2560) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A10 (2576) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xEFFF, 0xEFFF, 0xEFFF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A20 (2592) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A30 (2608) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A40 (2624) pixels
-  0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0A50 (2640) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0x8455, 0x218C,   // 0x0A60 (2656) pixels
-  0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x196D, 0x3A4E, 0xD6DE, 0xFFFF, 0xF7FF, 0xB61A, 0xA5B8,   // 0x0A70 (2672) pixels
-  0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1E, 0x3A2C, 0x320D, 0x320E, 0x320E, 0x320E,   // 0x0A80 (2688) pixels
-  0x320E, 0x320E, 0x320E, 0x320E, 0x320E, 0x320E, 0x320E, 0x320E, 0x428F, 0x6B93, 0xA579, 0xEF9F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A90 (2704) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AA0 (2720) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CB6, 0x320D, 0x320D, 0x320E, 0x320E, 0x320D, 0x7C13, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AB0 (2736) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AC0 (2752) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AD0 (2768) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AE0 (2784) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AF0 (2800) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B00 (2816) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD71E, 0x8D17, 0x8518, 0x8518, 0x8518, 0x8D17, 0x9D57, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B10 (2832) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B20 (2848) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B30 (2864) pixels
-  0xF7DF, 0xBE5B, 0xB63A, 0xB61A, 0xCEDC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0B40 (2880) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9F, 0x5B32, 0x196D, 0x196E,   // 0x0B50 (2896) pixels
-  0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x196D, 0x52F1, 0xE75F, 0xF7FF, 0xE7DF, 0xA5B9, 0x9D57, 0xF7DF,   // 0x0B60 (2912) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFF, 0x218C, 0x196D, 0x196E, 0x196E, 0x196E,   // 0x0B70 (2928) pixels
-  0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196D, 0x196D, 0x3A2F, 0xBE1C, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B80 (2944) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B90 (2960) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C56, 0x196C, 0x196D, 0x196E, 0x196E, 0x196C, 0x6BB3, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BA0 (2976) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BB0 (2992) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BC0 (3008) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BD0 (3024) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BE0 (3040) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BF0 (3056) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCEFE, 0x74D7, 0x74D8, 0x6CD9, 0x6CD9, 0x74D8, 0x8D37, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C00 (3072) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C10 (3088) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C20 (3104) pixels
-  0xB63A, 0xBEBD, 0xB65C, 0xBEBD, 0xC6BD, 0xCEDC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0C30 (3120) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0x5B52, 0x196D, 0x196E, 0x196F,   // 0x0C40 (3136) pixels
-  0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x196D, 0x6393, 0xEFBF, 0xF7FF, 0xE79F, 0x9558, 0x8D17, 0xE79F, 0xFFFF,   // 0x0C50 (3152) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x0C60 (3168) pixels
-  0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x29CD, 0xCE9E, 0xFFFF, 0xFFFF,   // 0x0C70 (3184) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C80 (3200) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C56, 0x196D, 0x196E, 0x196E, 0x196F, 0x196D, 0x6BB3, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C90 (3216) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CA0 (3232) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CB0 (3248) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CC0 (3264) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CD0 (3280) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CE0 (3296) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCF1F, 0x74D7, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CF0 (3312) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D00 (3328) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBF,   // 0x0D10 (3344) pixels
-  0xBE7C, 0xBE9D, 0xAE5C, 0x9DBA, 0xD75F, 0xB63A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0D20 (3360) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C96, 0x196D, 0x196E, 0x196F, 0x116F,   // 0x0D30 (3376) pixels
-  0x196F, 0x196F, 0x196F, 0x116F, 0x196F, 0x196E, 0x218D, 0x7C56, 0xF7DF, 0xF7FF, 0xD75F, 0x8518, 0x84F6, 0xD75F, 0xFFFF, 0xFFFF,   // 0x0D40 (3392) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x0D50 (3408) pixels
-  0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x196E, 0x5B32, 0xFFFF, 0xFFFF,   // 0x0D60 (3424) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D70 (3440) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8456, 0x196C, 0x196D, 0x196D, 0x196E, 0x196C, 0x6BB2, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D80 (3456) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D90 (3472) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DA0 (3488) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DB0 (3504) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DC0 (3520) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DD0 (3536) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCF1F, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DE0 (3552) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DF0 (3568) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9F,   // 0x0E00 (3584) pixels
-  0xC6BD, 0xBE9D, 0x9579, 0x8D59, 0xE7DF, 0xB63A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0E10 (3600) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6DF, 0x29AD, 0x196E, 0x196F, 0x116F, 0x116F,   // 0x0E20 (3616) pixels
-  0x116F, 0x196F, 0x196F, 0x196F, 0x196E, 0x218D, 0x9D39, 0xF7FF, 0xF7FF, 0xC6FE, 0x84F7, 0x7CD7, 0xCEFE, 0xF7FF, 0xFFFF, 0xEF7F,   // 0x0E30 (3632) pixels
-  0xEF5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x0E40 (3648) pixels
-  0x196F, 0x196E, 0x196E, 0x196D, 0x196D, 0x196D, 0x196E, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x21AD, 0xEF7F, 0xFFFF,   // 0x0E50 (3664) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E60 (3680) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB61B, 0x8477, 0x8478, 0x8478, 0x8478, 0x8477, 0xADB9, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E70 (3696) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E80 (3712) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E90 (3728) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0EA0 (3744) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0EB0 (3760) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0EC0 (3776) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xC71F, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0ED0 (3792) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0EE0 (3808) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF,   // 0x0EF0 (3824) pixels
-  0xB61A, 0xBEBD, 0xBEBE, 0xAE3C, 0xCEFE, 0xBE3A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0F00 (3840) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6BB4, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F,   // 0x0F10 (3856) pixels
-  0x196F, 0x196F, 0x196F, 0x196E, 0x29EE, 0xB5FC, 0xF7FF, 0xF7FF, 0xB67D, 0x7CD7, 0x7CD7, 0xB67D, 0xF7FF, 0xFFFF, 0xEFBF, 0x6331,   // 0x0F20 (3872) pixels
-  0x7C13, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x0F30 (3888) pixels
-  0x196F, 0x3230, 0x8477, 0x8476, 0x8496, 0x8476, 0x6373, 0x21AD, 0x196E, 0x196F, 0x116F, 0x116F, 0x196F, 0x196D, 0xD6DE, 0xFFFF,   // 0x0F40 (3904) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0F50 (3920) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0F60 (3936) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xE77F, 0xDF3F, 0xDF3F, 0xEF7F, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0F70 (3952) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9F, 0xDF3F, 0xDF3F,   // 0x0F80 (3968) pixels
-  0xEFBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF,   // 0x0F90 (3984) pixels
-  0xF7FF, 0xEFDF, 0xE7BF, 0xE7BF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xEFDF, 0xE7BF, 0xE7BF, 0xE7BF,   // 0x0FA0 (4000) pixels
-  0xE7BF, 0xEFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xEFFF, 0xE7BF,   // 0x0FB0 (4016) pixels
-  0xE7BF, 0xEFFF, 0xF7FF, 0xF7FF, 0xCF1F, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0FC0 (4032) pixels
-  0xFFFF, 0xFFFF, 0xF7FF, 0xEFFF, 0xEFDF, 0xE7BF, 0xE7BF, 0xE7BF, 0xE7DF, 0xEFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0FD0 (4048) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xF7FF, 0xEFDF, 0xE7BF, 0xEFDF, 0xFFFF, 0xFFFF,   // 0x0FE0 (4064) pixels
-  0xDF5E, 0xB61A, 0xD71E, 0xCEDD, 0xB619, 0xEFBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x0FF0 (4080) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75F, 0x29AE, 0x196F, 0x196F, 0x116F, 0x196F, 0x196F,   // 0x1000 (4096) pixels
-  0x196F, 0x196E, 0x196E, 0x3A2F, 0xCE9E, 0xF7FF, 0xEFFF, 0xAE1B, 0x74D7, 0x74D8, 0xA61B, 0xF7FF, 0xFFFF, 0xF7DF, 0x6BD4, 0x216C,   // 0x1010 (4112) pixels
-  0x31ED, 0xEF9F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x1020 (4128) pixels
-  0x196E, 0x5313, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0x8CD9, 0x196E, 0x196F, 0x116F, 0x196F, 0x196F, 0x218D, 0xDEFE, 0xFFFF,   // 0x1030 (4144) pixels
-  0xFFFF, 0xF7BF, 0x6B91, 0x6372, 0x6372, 0x6372, 0x6372, 0x6371, 0xE75E, 0xFFFF, 0xFFFF, 0xFFFF, 0xC63B, 0x6371, 0x6372, 0x6372,   // 0x1040 (4160) pixels
-  0x6372, 0x6351, 0x8433, 0xFFFF, 0xFFFF, 0xFFFF, 0xA578, 0x6351, 0x6352, 0x6372, 0x6352, 0x6371, 0x9CF6, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1050 (4176) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xE75F, 0x94D7, 0x4AB0, 0x29AD, 0x218C, 0x218C, 0x29AC, 0x424F, 0x7414, 0xC67D, 0xF7FF, 0xFFFF, 0xFFFF,   // 0x1060 (4192) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xDEFD, 0x6371, 0x6372, 0x6372, 0x6372, 0x6372, 0x8496, 0xF7FF, 0xC65C, 0x6352, 0x29ED, 0x218C, 0x218C,   // 0x1070 (4208) pixels
-  0x31ED, 0x73D3, 0xDEFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB63A, 0x9DBA, 0x9DBA, 0x9DBA, 0x9DDA, 0xA5D9, 0xEFBF, 0xEFBF,   // 0x1080 (4224) pixels
-  0xADFB, 0x84F7, 0x7CD7, 0x7CD7, 0xBE5B, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xDF5F, 0xAE3B, 0x8D59, 0x7CF7, 0x7CD7, 0x7CD7, 0x7CD7,   // 0x1090 (4240) pixels
-  0x7CD8, 0x84F8, 0x9579, 0xB65C, 0xE7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE79F, 0xADFA, 0x8518, 0x7CD7,   // 0x10A0 (4256) pixels
-  0x7CD7, 0x8517, 0xA5FA, 0xDF9F, 0xC71F, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x10B0 (4272) pixels
-  0xF7FF, 0xCEFE, 0xA5DA, 0x8518, 0x7CD7, 0x7CD7, 0x7CD8, 0x7CD7, 0x7CD7, 0x8518, 0x9DBA, 0xCEDD, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x10C0 (4288) pixels
-  0xFFFF, 0xF7DF, 0xADD9, 0x9DBA, 0x9DDA, 0x9DDA, 0x9DDA, 0xA5FA, 0xF7FF, 0xE79F, 0x9DBA, 0x7CF7, 0x7CD7, 0x84D7, 0xD6FD, 0xFFFF,   // 0x10D0 (4304) pixels
-  0xFFFF, 0xF7DF, 0xDF3E, 0xE75E, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x10E0 (4320) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xADBA, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F,   // 0x10F0 (4336) pixels
-  0x196F, 0x196D, 0x4AB0, 0xDF1F, 0xF7FF, 0xE7DF, 0x95BB, 0x74D8, 0x74D8, 0x959A, 0xEFFF, 0xFFFF, 0xF7FF, 0x8476, 0x196D, 0x196E,   // 0x1100 (4352) pixels
-  0x196C, 0xB61C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x1110 (4368) pixels
-  0x196E, 0x5312, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xA59B, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x320F, 0xF7BF, 0xFFFF,   // 0x1120 (4384) pixels
-  0xFFFF, 0xEF7F, 0x29AC, 0x196D, 0x196E, 0x196E, 0x196E, 0x218C, 0xDEFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xA57A, 0x216C, 0x196D, 0x196E,   // 0x1130 (4400) pixels
-  0x196E, 0x196C, 0x4A8E, 0xFFFF, 0xFFFF, 0xFFFF, 0x8456, 0x196C, 0x196D, 0x196E, 0x196E, 0x196C, 0x6BB2, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1140 (4416) pixels
-  0xFFFF, 0xFFFF, 0xADBB, 0x320E, 0x196D, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196D, 0x218D, 0x6BB4, 0xEF7F, 0xFFFF,   // 0x1150 (4432) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xCE9D, 0x216C, 0x196E, 0x196E, 0x196D, 0x196D, 0x4AF3, 0x951B, 0x218D, 0x196D, 0x196E, 0x196E, 0x196E,   // 0x1160 (4448) pixels
-  0x196E, 0x196D, 0x31EE, 0xC67E, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0x9579, 0x74D8, 0x74D8, 0x74D8, 0x74D8, 0x74D8, 0xCF7F, 0x8D79,   // 0x1170 (4464) pixels
-  0x74D8, 0x74D9, 0x6CD9, 0x74D8, 0xB63B, 0xF7FF, 0xFFFF, 0xF7FF, 0xAE3C, 0x74D8, 0x74D8, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9,   // 0x1180 (4480) pixels
-  0x6CD9, 0x6CD9, 0x6CD9, 0x74D8, 0x7CF8, 0xCEFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xCF1E, 0x7CF8, 0x74D8, 0x6CD9, 0x6CD9,   // 0x1190 (4496) pixels
-  0x6CD9, 0x6CD9, 0x74D8, 0x7D19, 0xA67F, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF7F,   // 0x11A0 (4512) pixels
-  0x8D59, 0x74D8, 0x74D8, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x74D8, 0x74D8, 0x9579, 0xE7BF, 0xFFFF, 0xFFFF,   // 0x11B0 (4528) pixels
-  0xFFFF, 0xF7DF, 0x7CD7, 0x74D8, 0x74D8, 0x74D8, 0x74D8, 0x7D19, 0xD77F, 0x8518, 0x74D8, 0x6CD9, 0x6CD9, 0x74D7, 0xCEDD, 0xFFFF,   // 0x11C0 (4544) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x11D0 (4560) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C55, 0x196D, 0x116F, 0x196F, 0x196F, 0x196F, 0x196E,   // 0x11E0 (4576) pixels
-  0x196D, 0x5B73, 0xE79F, 0xF7FF, 0xDF9F, 0x8D58, 0x74D8, 0x74D8, 0x8D59, 0xE7DF, 0xFFFF, 0xFFFF, 0x9D19, 0x218D, 0x196E, 0x196E,   // 0x11F0 (4592) pixels
-  0x196D, 0x84B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x1200 (4608) pixels
-  0x196E, 0x4AF2, 0xE75F, 0xE77F, 0xE75F, 0xE75F, 0xC69E, 0x42B0, 0x196E, 0x196F, 0x196F, 0x196E, 0x196D, 0x94F8, 0xFFFF, 0xFFFF,   // 0x1210 (4624) pixels
-  0xFFFF, 0xEF9F, 0x21AE, 0x196F, 0x196F, 0x116F, 0x196F, 0x216D, 0xDEFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xA57A, 0x196D, 0x196E, 0x196F,   // 0x1220 (4640) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1230 (4656) pixels
-  0xFFFF, 0x9D58, 0x218D, 0x196E, 0x196F, 0x196F, 0x196E, 0x196E, 0x196E, 0x196E, 0x196F, 0x196F, 0x196F, 0x196D, 0x52F0, 0xEF9F,   // 0x1240 (4672) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xCE9D, 0x196D, 0x196F, 0x196F, 0x116F, 0x196F, 0x21D0, 0x198F, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F,   // 0x1250 (4688) pixels
-  0x196F, 0x196F, 0x196E, 0x3A4F, 0xEF9F, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CFA, 0x8DBC, 0x74D8,   // 0x1260 (4704) pixels
-  0x6CD9, 0x6CDA, 0x6CDA, 0x74D8, 0xAE3B, 0xF7FF, 0xF7FF, 0xB63B, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9,   // 0x1270 (4720) pixels
-  0x6CD9, 0x6CFA, 0x6CDA, 0x6CDA, 0x6CD9, 0x7CF8, 0xEFBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF7F, 0x7CF7, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA,   // 0x1280 (4736) pixels
-  0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0x6CF9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xF7FF, 0xFFFF, 0xFFFF, 0xEFDF, 0x8D38,   // 0x1290 (4752) pixels
-  0x74D8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x74D8, 0xA5FB, 0xF7FF, 0xFFFF,   // 0x12A0 (4768) pixels
-  0xFFFF, 0xEFDF, 0x7CD8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x751A, 0x859B, 0x74D9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xCEFE, 0xFFFF,   // 0x12B0 (4784) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x12C0 (4800) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6372, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x218D,   // 0x12D0 (4816) pixels
-  0x7C35, 0xEFDF, 0xF7FF, 0xD73F, 0x8519, 0x74D8, 0x74D8, 0x7CF8, 0xDF7F, 0xFFFF, 0xFFFF, 0xADBB, 0x218D, 0x196E, 0x196F, 0x196F,   // 0x12E0 (4832) pixels
-  0x196E, 0x6BD4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x12F0 (4848) pixels
-  0x196F, 0x196E, 0x21AE, 0x21AE, 0x21AE, 0x21AE, 0x198E, 0x196E, 0x196F, 0x196F, 0x196F, 0x218E, 0x8476, 0xF7DF, 0xFFFF, 0xFFFF,   // 0x1300 (4864) pixels
-  0xFFFF, 0xEF9F, 0x21AE, 0x196F, 0x196F, 0x196F, 0x196F, 0x216D, 0xDEFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xA57A, 0x196D, 0x196E, 0x196F,   // 0x1310 (4880) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1320 (4896) pixels
-  0xC67E, 0x29AD, 0x196E, 0x196F, 0x196F, 0x196F, 0x196D, 0x21AD, 0x29EE, 0x218D, 0x196E, 0x196F, 0x196F, 0x196E, 0x196D, 0x7C36,   // 0x1330 (4912) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xCE9D, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F,   // 0x1340 (4928) pixels
-  0x196F, 0x196F, 0x196F, 0x196D, 0xADBA, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9,   // 0x1350 (4944) pixels
-  0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xAE3B, 0xF7FF, 0xE7BF, 0x7CD7, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CD9, 0x74D8, 0x8D5A, 0x9DFB, 0x957A,   // 0x1360 (4960) pixels
-  0x74D9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xC6BD, 0xFFFF, 0xFFFF, 0xF7FF, 0x9DDB, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9,   // 0x1370 (4976) pixels
-  0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x8518, 0xF7FF, 0xFFFF, 0xFFFF, 0xBEBE, 0x74D8,   // 0x1380 (4992) pixels
-  0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x7CF8, 0x95BA, 0x9DDB, 0x8539, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x7CF8, 0xEFDF, 0xFFFF,   // 0x1390 (5008) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CFA, 0x6CDA, 0x74D8, 0xCEDE, 0xFFFF,   // 0x13A0 (5024) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x13B0 (5040) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5311, 0x196E, 0x196F, 0x196F, 0x196E, 0x218D, 0x94F9,   // 0x13C0 (5056) pixels
-  0xF7FF, 0xF7FF, 0xC6DE, 0x7CD8, 0x6CD9, 0x6CD9, 0x7CF8, 0xCF3F, 0xF7FF, 0xFFFF, 0xBE3D, 0x29AD, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x13D0 (5072) pixels
-  0x196E, 0x5B73, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x13E0 (5088) pixels
-  0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x3251, 0xBE3D, 0xF7FF, 0xFFFF, 0xFFFF,   // 0x13F0 (5104) pixels
-  0xFFFF, 0xEF9F, 0x21AD, 0x196F, 0x196F, 0x196F, 0x196F, 0x216D, 0xDEFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xA57A, 0x196D, 0x196E, 0x196F,   // 0x1400 (5120) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xFFFF, 0xFFFF, 0xF7DF,   // 0x1410 (5136) pixels
-  0x52F1, 0x196E, 0x196E, 0x196F, 0x196F, 0x198E, 0x84B8, 0xDF5F, 0xEFBF, 0xC69F, 0x4291, 0x196E, 0x196F, 0x196F, 0x196E, 0x21AD,   // 0x1420 (5152) pixels
-  0xDF1F, 0xFFFF, 0xFFFF, 0xCE9D, 0x218D, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x218E, 0x29EF, 0x196D, 0x196E, 0x196F,   // 0x1430 (5168) pixels
-  0x196F, 0x196F, 0x116F, 0x196E, 0x7C35, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9,   // 0x1440 (5184) pixels
-  0x6CD9, 0x74D8, 0x74D8, 0x74B7, 0xB63B, 0xF7FF, 0xCEFE, 0x7CB6, 0x74D8, 0x74D8, 0x74D8, 0x74D8, 0xA5FB, 0xEFFF, 0xF7FF, 0xEFFF,   // 0x1450 (5200) pixels
-  0xA65E, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xAE3B, 0xF7FF, 0xFFFF, 0xE7BF, 0x7CD8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9,   // 0x1460 (5216) pixels
-  0x7CF8, 0xA61C, 0xAE5D, 0x8D5A, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xF7FF, 0xFFFF, 0xFFFF, 0xA5BA, 0x74B7,   // 0x1470 (5232) pixels
-  0x74D8, 0x74D8, 0x74D8, 0x74D7, 0xCF1F, 0xEFFF, 0xEFFF, 0xE7FF, 0x855A, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xDF7F, 0xFFFF,   // 0x1480 (5248) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD8, 0x74D8, 0x74D8, 0x74D7, 0xCEDD, 0xFFFF,   // 0x1490 (5264) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x14A0 (5280) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B51, 0x196D, 0x196F, 0x196E, 0x29CE, 0xADBB, 0xF7FF,   // 0x14B0 (5296) pixels
-  0xEFFF, 0xAE7D, 0x74D8, 0x6CD9, 0x6CD9, 0x74D8, 0xBEBD, 0xF7FF, 0xFFFF, 0xD6BE, 0x31EE, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F,   // 0x14C0 (5312) pixels
-  0x196E, 0x6394, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x14D0 (5328) pixels
-  0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x116F, 0x196F, 0x196F, 0x196F, 0x196E, 0x218D, 0x8477, 0xF7DF, 0xFFFF,   // 0x14E0 (5344) pixels
-  0xFFFF, 0xEF9F, 0x21AE, 0x196F, 0x196F, 0x196F, 0x196F, 0x216D, 0xDEFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA57A, 0x196D, 0x196E, 0x196F,   // 0x14F0 (5360) pixels
-  0x116F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xFFFF, 0xFFFF, 0xCE9D,   // 0x1500 (5376) pixels
-  0x218D, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BD6, 0xF7FF, 0xFFFF, 0xFFFF, 0xF7FF, 0xC6BF, 0x218D, 0x196E, 0x196F, 0x196F, 0x196D,   // 0x1510 (5392) pixels
-  0x94F7, 0xFFFF, 0xFFFF, 0xCE9D, 0x218D, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x4AD1, 0xD6DF, 0xEFBF, 0xBE3D, 0x21AE, 0x196F,   // 0x1520 (5408) pixels
-  0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x74D8,   // 0x1530 (5424) pixels
-  0xA5FB, 0xC6DE, 0xCEFE, 0xC69C, 0xCEDC, 0xFFFF, 0xEFBF, 0xD6FD, 0xCEFE, 0xCEFE, 0xCEFE, 0xCEFE, 0xE79F, 0xF7FF, 0xF7FF, 0xEFFF,   // 0x1540 (5440) pixels
-  0xB6DF, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xA5FB, 0xF7FF, 0xF7FF, 0xCEDD, 0x74D8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8,   // 0x1550 (5456) pixels
-  0xCF3F, 0xF7FF, 0xF7FF, 0xEFFF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x8D38, 0xF7FF, 0xFFFF, 0xFFFF, 0xDF3E, 0xCEFD,   // 0x1560 (5472) pixels
-  0xCEFE, 0xCF1E, 0xCEFE, 0xCF1E, 0xF7FF, 0xF7FF, 0xF7FF, 0xEFFF, 0x8D9B, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xD75F, 0xFFFF,   // 0x1570 (5488) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0x7CF8, 0xAE3C, 0xC6FE, 0xC6FE, 0xBE7B, 0xDF3E, 0xFFFF,   // 0x1580 (5504) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1590 (5520) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x73F3, 0x196D, 0x196E, 0x320F, 0xC67E, 0xF7FF, 0xEFDF,   // 0x15A0 (5536) pixels
-  0xA5FB, 0x74D8, 0x6CD9, 0x6CD9, 0x74D8, 0xAE3D, 0xF7FF, 0xFFFF, 0xDF1F, 0x3A2E, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E,   // 0x15B0 (5552) pixels
-  0x196E, 0x7C36, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x15C0 (5568) pixels
-  0x196F, 0x196E, 0x196E, 0x196D, 0x196D, 0x196D, 0x196D, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x196D, 0xA538, 0xFFFF,   // 0x15D0 (5584) pixels
-  0xFFFF, 0xEF9F, 0x21AE, 0x196F, 0x196F, 0x116F, 0x196F, 0x216D, 0xDEFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA57A, 0x196D, 0x196E, 0x196F,   // 0x15E0 (5600) pixels
-  0x116F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xFFFF, 0xFFFF, 0x94D7,   // 0x15F0 (5616) pixels
-  0x196D, 0x196F, 0x196F, 0x196F, 0x196E, 0x8499, 0xB61C, 0xBE1B, 0xBE1B, 0xB61C, 0xADDD, 0x29CE, 0x196E, 0x196F, 0x196F, 0x196E,   // 0x1600 (5632) pixels
-  0x5B52, 0xFFFF, 0xFFFF, 0xCE9D, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x196D, 0xC67D, 0xFFFF, 0xFFFF, 0xFFFF, 0x6374, 0x196E,   // 0x1610 (5648) pixels
-  0x196F, 0x196F, 0x196F, 0x196E, 0x6BD3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x74D8, 0xBEDF,   // 0x1620 (5664) pixels
-  0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xE7DF, 0xDF7F, 0xCF1E, 0xB65C,   // 0x1630 (5680) pixels
-  0x7CF9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xA5FB, 0xF7FF, 0xF7FF, 0xB63B, 0x74D8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x8D9A,   // 0x1640 (5696) pixels
-  0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC6FF, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1650 (5712) pixels
-  0xF7FF, 0xF7FF, 0xF7FF, 0xEFFF, 0xE7BF, 0xD75F, 0xC6DE, 0x9DDB, 0x74D9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xD73F, 0xFFFF,   // 0x1660 (5728) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x7CF8, 0xD75F, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1670 (5744) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1680 (5760) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D17, 0x216B, 0x4290, 0xDEFF, 0xF7FF, 0xE7BF, 0x959A,   // 0x1690 (5776) pixels
-  0x74D8, 0x6CD9, 0x6CD9, 0x74D8, 0x9DDA, 0xF7FF, 0xFFFF, 0xE77F, 0x4AB0, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E,   // 0x16A0 (5792) pixels
-  0x196D, 0xA55A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x16B0 (5808) pixels
-  0x196E, 0x42B2, 0xCE9F, 0xCEBD, 0xCE9D, 0xCE9D, 0xC67D, 0x8476, 0x218E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x3A4E, 0xF7BF,   // 0x16C0 (5824) pixels
-  0xFFFF, 0xEF9F, 0x21AE, 0x196F, 0x196F, 0x196F, 0x196F, 0x216D, 0xDEFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xA57A, 0x196D, 0x196E, 0x196F,   // 0x16D0 (5840) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xF7FF, 0xFFFF, 0x6BB3,   // 0x16E0 (5856) pixels
-  0x196E, 0x116F, 0x196F, 0x196F, 0x196F, 0x196E, 0x196E, 0x196D, 0x196D, 0x196D, 0x196E, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E,   // 0x16F0 (5872) pixels
-  0x3A4E, 0xF7DF, 0xFFFF, 0xCE9D, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x29CE, 0xEF9F, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C36, 0x196E,   // 0x1700 (5888) pixels
-  0x196F, 0x196F, 0x196F, 0x196E, 0x6BD3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x8D79, 0xEFFF,   // 0x1710 (5904) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xE7DF, 0xBEDE, 0x9DDC, 0x8539, 0x7CF8, 0x74D8, 0x74D8, 0x74D8,   // 0x1720 (5920) pixels
-  0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xA5FB, 0xF7FF, 0xF7FF, 0xA5DA, 0x6CD8, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0xA63C,   // 0x1730 (5936) pixels
-  0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF9F, 0x74D7, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD8, 0x8D18, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF,   // 0x1740 (5952) pixels
-  0xDF7F, 0xAE7D, 0x959A, 0x7D19, 0x74D8, 0x74D8, 0x74D8, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xD73F, 0xFFFF,   // 0x1750 (5968) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xA61B, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1760 (5984) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1770 (6000) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6DD, 0x5B51, 0xE77F, 0xF7FF, 0xDF7F, 0x8D39, 0x74D8,   // 0x1780 (6016) pixels
-  0x6CD9, 0x6CD9, 0x6CD8, 0x8D7A, 0xEFDF, 0xFFFF, 0xEFBF, 0x5311, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E,   // 0x1790 (6032) pixels
-  0x218C, 0xDEFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x17A0 (6048) pixels
-  0x196E, 0x5312, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0x5B54, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x218C, 0xCEDF,   // 0x17B0 (6064) pixels
-  0xFFFF, 0xEF9F, 0x21AE, 0x196F, 0x196F, 0x196F, 0x196F, 0x218D, 0xDEFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xA57A, 0x196D, 0x196E, 0x196F,   // 0x17C0 (6080) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xF7FF, 0xF7FF, 0x5B52,   // 0x17D0 (6096) pixels
-  0x196E, 0x196F, 0x116F, 0x196F, 0x196F, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196D,   // 0x17E0 (6112) pixels
-  0x29CC, 0xEF9F, 0xFFFF, 0xCE9D, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x29EF, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C36, 0x196E,   // 0x17F0 (6128) pixels
-  0x196F, 0x196F, 0x196F, 0x196E, 0x6BD3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xB63C, 0xF7FF,   // 0x1800 (6144) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xC6BD, 0x8518, 0x74D8, 0x74D9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9,   // 0x1810 (6160) pixels
-  0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xA5FB, 0xF7FF, 0xF7FF, 0x9DDA, 0x6CD8, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD8, 0xAE7D,   // 0x1820 (6176) pixels
-  0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7BF, 0x7CD7, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD8, 0x8D18, 0xF7FF, 0xFFFF, 0xFFFF, 0xEFDF, 0xADFB,   // 0x1830 (6192) pixels
-  0x7CD7, 0x74D8, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xD73F, 0xFFFF,   // 0x1840 (6208) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xCEFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1850 (6224) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1860 (6240) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xF7FF, 0xCF1F, 0x7D18, 0x74D9, 0x6CD9,   // 0x1870 (6256) pixels
-  0x6CD9, 0x6CD9, 0x8538, 0xE7BF, 0xFFFF, 0xF7DF, 0x6BD4, 0x196D, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x116F, 0x196E,   // 0x1880 (6272) pixels
-  0x5311, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x1890 (6288) pixels
-  0x196E, 0x5312, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7416, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x196C, 0xB61C,   // 0x18A0 (6304) pixels
-  0xFFFF, 0xEF9F, 0x21AE, 0x196F, 0x196F, 0x196F, 0x196F, 0x218D, 0xD6DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xA57A, 0x196D, 0x196E, 0x196F,   // 0x18B0 (6320) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xF7FF, 0xF7FF, 0x6393,   // 0x18C0 (6336) pixels
-  0x196E, 0x196F, 0x116F, 0x196F, 0x196E, 0x21CE, 0x29CE, 0x29CD, 0x29ED, 0x29ED, 0x29CD, 0x29CD, 0x29ED, 0x29ED, 0x29CD, 0x31EC,   // 0x18D0 (6352) pixels
-  0x3A2C, 0xEF7F, 0xFFFF, 0xCE9D, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x320F, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C36, 0x196E,   // 0x18E0 (6368) pixels
-  0x196F, 0x196F, 0x116F, 0x196E, 0x6BD3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xBE9D, 0xFFFF,   // 0x18F0 (6384) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC6DE, 0x7CD8, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x74D8, 0x7CD8, 0x8539,   // 0x1900 (6400) pixels
-  0x8DBC, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x74D8, 0xA5FB, 0xF7FF, 0xF7FF, 0xA5FA, 0x74D8, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0xAE3D,   // 0x1910 (6416) pixels
-  0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF9F, 0x74D7, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xF7FF, 0xFFFF, 0xF7FF, 0x9DDA, 0x74D8,   // 0x1920 (6432) pixels
-  0x6CD9, 0x6CD9, 0x6CDA, 0x6CD9, 0x6CD9, 0x74D8, 0x7CF8, 0x959B, 0x7D5A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xD73F, 0xFFFF,   // 0x1930 (6448) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xDF5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1940 (6464) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1950 (6480) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xC6BD, 0x7CD8, 0x6CD9, 0x6CD9, 0x6CDA,   // 0x1960 (6496) pixels
-  0x6CD9, 0x7CF8, 0xD75F, 0xF7FF, 0xF7FF, 0x8456, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x218D,   // 0x1970 (6512) pixels
-  0xBDFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x1980 (6528) pixels
-  0x196E, 0x5313, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75F, 0x3A50, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x196C, 0xBE1C,   // 0x1990 (6544) pixels
-  0xFFFF, 0xEF9F, 0x21AE, 0x196F, 0x196F, 0x196F, 0x116F, 0x196D, 0xBE3D, 0xFFFF, 0xFFFF, 0xFFFF, 0x7436, 0x196E, 0x196F, 0x196F,   // 0x19A0 (6560) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xF7FF, 0xFFFF, 0x8476,   // 0x19B0 (6576) pixels
-  0x196D, 0x196F, 0x196F, 0x196F, 0x196E, 0xADDE, 0xEF9F, 0xEF9F, 0xEF9F, 0xEF9F, 0xEF9F, 0xEF9F, 0xE79F, 0xE79F, 0xEF9F, 0xEF9F,   // 0x19C0 (6592) pixels
-  0xEFBF, 0xFFFF, 0xFFFF, 0xCE9D, 0x196D, 0x196F, 0x116F, 0x196F, 0x196F, 0x31EF, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C36, 0x196E,   // 0x19D0 (6608) pixels
-  0x196F, 0x196F, 0x116F, 0x196E, 0x6BD3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xC6DE, 0xFFFF,   // 0x19E0 (6624) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0x8559, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x7D39, 0xB6BE, 0xDF7F, 0xEFFF,   // 0x19F0 (6640) pixels
-  0xC71F, 0x6CD8, 0x6CD9, 0x6CDA, 0x6CDA, 0x74D8, 0xA5FB, 0xF7FF, 0xF7FF, 0xB65C, 0x74D8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x95BB,   // 0x1A00 (6656) pixels
-  0xF7FF, 0xFFFF, 0xFFFF, 0xF7FF, 0xC71F, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xEFFF, 0xF7FF, 0xD73E, 0x74D8, 0x6CD9,   // 0x1A10 (6672) pixels
-  0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x95BB, 0xC6FF, 0xE7BF, 0xEFFF, 0x95DC, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xD73F, 0xFFFF,   // 0x1A20 (6688) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xDF5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1A30 (6704) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1A40 (6720) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xAE3C, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9,   // 0x1A50 (6736) pixels
-  0x7CD8, 0xC6FE, 0xF7FF, 0xF7FF, 0x94F9, 0x218D, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x196D, 0x5B53,   // 0x1A60 (6752) pixels
-  0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x116F, 0x116F,   // 0x1A70 (6768) pixels
-  0x116F, 0x2A10, 0x7417, 0x7416, 0x7416, 0x7416, 0x6BB5, 0x320F, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x218C, 0xD6FF,   // 0x1A80 (6784) pixels
-  0xFFFF, 0xEF9F, 0x21AE, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB5, 0xEFBF, 0xF7DF, 0xC67E, 0x29CE, 0x196E, 0x196F, 0x196F,   // 0x1A90 (6800) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xFFFF, 0xFFFF, 0xB5FB,   // 0x1AA0 (6816) pixels
-  0x196D, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BF6, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xEF9F, 0xEF9F, 0xE7BF, 0xEFBF, 0xEF9F,   // 0x1AB0 (6832) pixels
-  0xF7BF, 0xFFFF, 0xFFFF, 0xCE9D, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x31EF, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C36, 0x196E,   // 0x1AC0 (6848) pixels
-  0x196F, 0x196F, 0x196F, 0x196E, 0x6BD3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xC6DD, 0xFFFF,   // 0x1AD0 (6864) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7BF, 0x74D8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xCF3F, 0xF7FF, 0xFFFF, 0xF7FF,   // 0x1AE0 (6880) pixels
-  0xB6BF, 0x6CD8, 0x6CD9, 0x6CDA, 0x6CDA, 0x74D8, 0xA5FB, 0xF7FF, 0xF7FF, 0xCF1E, 0x74D8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74F9,   // 0x1AF0 (6896) pixels
-  0xD77F, 0xF7FF, 0xF7FF, 0xEFFF, 0x95BB, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xEFFF, 0xF7FF, 0xBE7C, 0x74D8, 0x6CDA,   // 0x1B00 (6912) pixels
-  0x6CDA, 0x6CDA, 0x6CDA, 0x7D3A, 0xEFFF, 0xF7FF, 0xFFFF, 0xEFFF, 0x8D7B, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xD73F, 0xFFFF,   // 0x1B10 (6928) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xDF5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1B20 (6944) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1B30 (6960) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD71E, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD9, 0x74D8,   // 0x1B40 (6976) pixels
-  0xB69D, 0xF7FF, 0xFFFF, 0xAD9A, 0x218D, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x3A2E, 0xDF3F,   // 0x1B50 (6992) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x116F, 0x116F,   // 0x1B60 (7008) pixels
-  0x116F, 0x196F, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196D, 0x4AAF, 0xF7DF,   // 0x1B70 (7024) pixels
-  0xFFFF, 0xEFBF, 0x29CE, 0x196F, 0x196F, 0x196F, 0x116F, 0x196E, 0x196D, 0x322F, 0x4270, 0x218D, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x1B80 (7040) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xF7FF, 0xFFFF, 0xEFBF,   // 0x1B90 (7056) pixels
-  0x322F, 0x196E, 0x196F, 0x196F, 0x196F, 0x218E, 0x9D59, 0xF7DF, 0xF7FF, 0xEF9F, 0x8476, 0x31CD, 0x29CD, 0x29CD, 0x29CC, 0x31CB,   // 0x1BA0 (7072) pixels
-  0x94D5, 0xFFFF, 0xFFFF, 0xCE9D, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x31EF, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C36, 0x196E,   // 0x1BB0 (7088) pixels
-  0x196F, 0x196F, 0x196F, 0x196E, 0x6BD3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xC6DD, 0xFFFF,   // 0x1BC0 (7104) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE79F, 0x74D8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xC6FF, 0xF7FF, 0xF7FF, 0xEFDF,   // 0x1BD0 (7120) pixels
-  0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xA5FB, 0xF7FF, 0xFFFF, 0xEFDF, 0x7D18, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9,   // 0x1BE0 (7136) pixels
-  0x8519, 0xB69D, 0xC6DE, 0x9DBA, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xEFFF, 0xF7FF, 0xB65C, 0x74D8, 0x6CDA,   // 0x1BF0 (7152) pixels
-  0x6CDA, 0x6CDA, 0x6CDA, 0x7D19, 0xE7DF, 0xF7FF, 0xF7FF, 0xD75F, 0x74D8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xD73F, 0xFFFF,   // 0x1C00 (7168) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xDF5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1C10 (7184) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1C20 (7200) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE7C, 0x74D8, 0x6CDA, 0x6CDA, 0x6CD9, 0x74D8, 0xA61B,   // 0x1C30 (7216) pixels
-  0xF7FF, 0xF7FF, 0xBE3D, 0x29AD, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x320E, 0xCE9D, 0xFFFF,   // 0x1C40 (7232) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x1C50 (7248) pixels
-  0x196F, 0x196F, 0x196F, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x218D, 0xB5DA, 0xFFFF,   // 0x1C60 (7264) pixels
-  0xFFFF, 0xF7FF, 0x4AD1, 0x196E, 0x196F, 0x116F, 0x196F, 0x116F, 0x196E, 0x196E, 0x196E, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F,   // 0x1C70 (7280) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1C80 (7296) pixels
-  0xA55A, 0x216D, 0x196E, 0x196F, 0x116F, 0x196E, 0x196D, 0x322F, 0x42B1, 0x29CE, 0x196D, 0x196E, 0x196E, 0x196E, 0x196D, 0x320D,   // 0x1C90 (7312) pixels
-  0xE75F, 0xFFFF, 0xFFFF, 0xCE9D, 0x196D, 0x116F, 0x196F, 0x196F, 0x196F, 0x31EF, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C36, 0x196E,   // 0x1CA0 (7328) pixels
-  0x196F, 0x196F, 0x196F, 0x196E, 0x6BD3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xC6DD, 0xFFFF,   // 0x1CB0 (7344) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFDF, 0x7CF8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x74F9, 0xA63D, 0xAE5D, 0x855A,   // 0x1CC0 (7360) pixels
-  0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD8, 0xA5FB, 0xF7FF, 0xFFFF, 0xF7FF, 0xAE5C, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA,   // 0x1CD0 (7376) pixels
-  0x6CD9, 0x6CD8, 0x74D8, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x8538, 0xEFFF, 0xF7FF, 0xC6DD, 0x74D8, 0x6CDA,   // 0x1CE0 (7392) pixels
-  0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x855A, 0xAE7E, 0xA61C, 0x7CF9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xD73F, 0xFFFF,   // 0x1CF0 (7408) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xDF5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1D00 (7424) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1D10 (7440) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCEFE, 0x74D7, 0x6CD9, 0x6CD9, 0x74D8, 0x959A, 0xEFFF,   // 0x1D20 (7456) pixels
-  0xFFFF, 0xCEBD, 0x31EE, 0x196E, 0x196F, 0x196F, 0x116F, 0x196F, 0x196F, 0x196E, 0x196E, 0x196D, 0x4270, 0xCEBF, 0xFFFF, 0xFFFF,   // 0x1D30 (7472) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x1D40 (7488) pixels
-  0x196F, 0x116F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x196E, 0x218D, 0x8497, 0xFFFF, 0xFFFF,   // 0x1D50 (7504) pixels
-  0xFFFF, 0xFFFF, 0xA55A, 0x196C, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x21AF, 0x196E, 0x196F, 0x196F,   // 0x1D60 (7520) pixels
-  0x196F, 0x196E, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C57, 0x196D, 0x196E, 0x196F, 0x196F, 0x196E, 0x6BB3, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1D70 (7536) pixels
-  0xF7DF, 0x73F4, 0x196D, 0x196E, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x196E, 0x29AD, 0xB5FC,   // 0x1D80 (7552) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xCE9D, 0x196D, 0x196F, 0x196F, 0x196F, 0x196F, 0x31EF, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C36, 0x196E,   // 0x1D90 (7568) pixels
-  0x196E, 0x196F, 0x196F, 0x196D, 0x6BB3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x74D8, 0xC6DD, 0xFFFF,   // 0x1DA0 (7584) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0x9DDB, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD8,   // 0x1DB0 (7600) pixels
-  0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0x9DDA, 0xF7FF, 0xFFFF, 0xFFFF, 0xEFDF, 0x8538, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA,   // 0x1DC0 (7616) pixels
-  0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CD8, 0x8538, 0xF7FF, 0xFFFF, 0xEFBF, 0x7CF8, 0x6CD9,   // 0x1DD0 (7632) pixels
-  0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD8, 0x74D9, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xCF1E, 0xFFFF,   // 0x1DE0 (7648) pixels
-  0xFFFF, 0xEFDF, 0x7CF8, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CDA, 0x74D8, 0xDF5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1DF0 (7664) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1E00 (7680) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xA5FA, 0x7CD7, 0x7CD7, 0x9579, 0xE7BF, 0xFFFF,   // 0x1E10 (7696) pixels
-  0xDF1F, 0x3A4D, 0x196D, 0x196E, 0x196F, 0x196F, 0x116F, 0x196F, 0x196E, 0x196D, 0x29CD, 0x8455, 0xEF9F, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1E20 (7712) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x218C, 0x196E, 0x196F, 0x196F, 0x196F,   // 0x1E30 (7728) pixels
-  0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196E, 0x196F, 0x196E, 0x196E, 0x196E, 0x196D, 0x322E, 0xA579, 0xF7FF, 0xFFFF, 0xFFFF,   // 0x1E40 (7744) pixels
-  0xFFFF, 0xFFFF, 0xF7DF, 0x6372, 0x196D, 0x196E, 0x196F, 0x196F, 0x196F, 0x196E, 0x196E, 0x29EE, 0x9D5C, 0x218D, 0x196E, 0x196F,   // 0x1E50 (7760) pixels
-  0x196E, 0x196D, 0x428F, 0xF7FF, 0xFFFF, 0xFFFF, 0x7C56, 0x196D, 0x196E, 0x196E, 0x196F, 0x196D, 0x6BB3, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1E60 (7776) pixels
-  0xFFFF, 0xF7DF, 0x8CB7, 0x21AD, 0x196D, 0x196E, 0x196F, 0x196F, 0x196F, 0x196F, 0x196F, 0x196E, 0x196D, 0x3A4E, 0xBE1C, 0xFFFF,   // 0x1E70 (7792) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xCE9D, 0x216D, 0x196E, 0x196F, 0x196E, 0x196E, 0x31EE, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C36, 0x196D,   // 0x1E80 (7808) pixels
-  0x196E, 0x196E, 0x196F, 0x196D, 0x6BD3, 0xFFFF, 0xFFFF, 0xF7FF, 0x8D7A, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x74D8, 0xC6DD, 0xFFFF,   // 0x1E90 (7824) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE79F, 0x8D18, 0x74D8, 0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0x74D8,   // 0x1EA0 (7840) pixels
-  0x95BC, 0x74F8, 0x6CD9, 0x6CD9, 0x6CD9, 0x74D8, 0x8D59, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF5F, 0x8518, 0x6CD8, 0x6CD9, 0x6CDA,   // 0x1EB0 (7856) pixels
-  0x6CDA, 0x6CDA, 0x6CD9, 0x74D9, 0x9E1D, 0x74D8, 0x6CD9, 0x6CD9, 0x6CD9, 0x74D8, 0x8D38, 0xF7FF, 0xFFFF, 0xFFFF, 0xC6BD, 0x7CD8,   // 0x1EC0 (7872) pixels
-  0x6CD9, 0x6CDA, 0x6CDA, 0x6CDA, 0x6CD9, 0x6CD9, 0x74D8, 0x7CF9, 0x8D9B, 0x6CD8, 0x6CD9, 0x6CD9, 0x6CD9, 0x74D8, 0xBE7C, 0xFFFF,   // 0x1ED0 (7888) pixels
-  0xFFFF, 0xEFDF, 0x7CD8, 0x6CD9, 0x6CD9, 0x6CD9, 0x6CD9, 0x74D8, 0xDF5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1EE0 (7904) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1EF0 (7920) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xDF9F, 0xDF7F, 0xF7FF, 0xFFFF, 0xFFFF,   // 0x1F00 (7936) pixels
-  0xE75F, 0x8CB6, 0x4AD1, 0x29CE, 0x218D, 0x196D, 0x218D, 0x29CE, 0x4AD1, 0x8CD8, 0xDF3F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F10 (7952) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF3F, 0x428E, 0x4290, 0x4270, 0x4270, 0x4270,   // 0x1F20 (7968) pixels
-  0x4270, 0x4270, 0x4270, 0x4270, 0x4270, 0x4290, 0x4270, 0x4270, 0x4AD1, 0x6BD4, 0xA59B, 0xEF9F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F30 (7984) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0x8CD8, 0x320E, 0x196D, 0x196D, 0x196D, 0x29AD, 0x6373, 0xD6DF, 0xDF1F, 0x428F, 0x4270, 0x4270,   // 0x1F40 (8000) pixels
-  0x4270, 0x428F, 0x6B71, 0xFFFF, 0xFFFF, 0xFFFF, 0x94F7, 0x426F, 0x4270, 0x4270, 0x4271, 0x428F, 0x8455, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F50 (8016) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x7436, 0x322F, 0x218D, 0x196D, 0x196D, 0x196D, 0x21AD, 0x42B1, 0x94F8, 0xEF9F, 0xFFFF, 0xFFFF,   // 0x1F60 (8032) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xD6DD, 0x428F, 0x4290, 0x4270, 0x4270, 0x4270, 0x52F0, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94D7, 0x428F,   // 0x1F70 (8048) pixels
-  0x4270, 0x4290, 0x4270, 0x426F, 0x8475, 0xFFFF, 0xFFFF, 0xF7FF, 0xA5DA, 0x8D59, 0x8D59, 0x8D5A, 0x8D5A, 0x8D58, 0xD6FD, 0xFFFF,   // 0x1F80 (8064) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7BF, 0xA5FB, 0x7CF8, 0x74D8, 0x74D8, 0x74D8, 0x7CD8, 0x8D7A, 0xC6FF,   // 0x1F90 (8080) pixels
-  0xDFDF, 0x9559, 0x8D59, 0x8D5A, 0x8D59, 0x8D59, 0x9558, 0xE79F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFBF, 0x9DDB, 0x7CF8, 0x74D8,   // 0x1FA0 (8096) pixels
-  0x74D8, 0x74D8, 0x8519, 0xBEBE, 0xDFDF, 0x9558, 0x8D59, 0x8D59, 0x8559, 0x8D59, 0x9D98, 0xF7FF, 0xFFFF, 0xFFFF, 0xF7FF, 0xCF1F,   // 0x1FB0 (8112) pixels
-  0x957A, 0x7CD8, 0x74D8, 0x74D8, 0x74D8, 0x7CF8, 0x9DDB, 0xD79F, 0xC6FF, 0x8D59, 0x8D59, 0x8D5A, 0x8D59, 0x8D58, 0xADD9, 0xF7FF,   // 0x1FC0 (8128) pixels
-  0xFFFF, 0xF7DF, 0x9559, 0x8D5A, 0x8D5A, 0x8D5A, 0x8D5A, 0x8D58, 0xE77F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1FD0 (8144) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x1FE0 (8160) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1FF0 (8176) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xEF9F, 0xDEFE, 0xD6DE, 0xDF1F, 0xEF9F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2000 (8192) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF,   // 0x2010 (8208) pixels
-  0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2020 (8224) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xD6BD, 0xC65C, 0xCE9D, 0xEF7F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF,   // 0x2030 (8240) pixels
-  0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2040 (8256) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xDF1F, 0xC67C, 0xC65C, 0xCE9D, 0xE75F, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2050 (8272) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFDF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2060 (8288) pixels
-  0xF7FF, 0xF7DF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF,   // 0x2070 (8304) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xEFDF, 0xDF7F, 0xD73F, 0xDF5F, 0xE7BF, 0xF7FF, 0xF7FF,   // 0x2080 (8320) pixels
-  0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xEFBF, 0xDF5F,   // 0x2090 (8336) pixels
-  0xD73F, 0xDF7F, 0xF7FF, 0xF7FF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x20A0 (8352) pixels
-  0xF7FF, 0xE7BF, 0xDF3F, 0xD73F, 0xDF7F, 0xEFDF, 0xF7FF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF,   // 0x20B0 (8368) pixels
-  0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x20C0 (8384) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x20D0 (8400) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x20E0 (8416) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x20F0 (8432) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2100 (8448) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2110 (8464) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2120 (8480) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2130 (8496) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2140 (8512) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2150 (8528) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2160 (8544) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2170 (8560) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2180 (8576) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2190 (8592) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x21A0 (8608) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x21B0 (8624) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x21C0 (8640) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x21D0 (8656) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x21E0 (8672) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x21F0 (8688) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2200 (8704) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2210 (8720) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2220 (8736) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2230 (8752) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2240 (8768) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2250 (8784) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2260 (8800) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2270 (8816) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2280 (8832) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2290 (8848) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x22A0 (8864) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x22B0 (8880) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x22C0 (8896) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x22D0 (8912) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x22E0 (8928) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x22F0 (8944) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2300 (8960) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2310 (8976) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2320 (8992) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2330 (9008) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2340 (9024) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2350 (9040) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2360 (9056) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2370 (9072) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2380 (9088) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2390 (9104) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x23A0 (9120) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x23B0 (9136) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x23C0 (9152) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x23D0 (9168) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x23E0 (9184) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x23F0 (9200) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2400 (9216) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2410 (9232) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2420 (9248) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2430 (9264) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2440 (9280) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2450 (9296) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2460 (9312) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2470 (9328) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2480 (9344) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x2490 (9360) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x24A0 (9376) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x24B0 (9392) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x24C0 (9408) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x24D0 (9424) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x24E0 (9440) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x24F0 (9456) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2500 (9472) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2510 (9488) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2520 (9504) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2530 (9520) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2540 (9536) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2550 (9552) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2560 (9568) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2570 (9584) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x2580 (9600) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2590 (9616) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x25A0 (9632) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x25B0 (9648) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x25C0 (9664) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x25D0 (9680) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x25E0 (9696) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x25F0 (9712) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2600 (9728) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2610 (9744) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2620 (9760) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2630 (9776) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2640 (9792) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2650 (9808) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2660 (9824) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x2670 (9840) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2680 (9856) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2690 (9872) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x26A0 (9888) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x26B0 (9904) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x26C0 (9920) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x26D0 (9936) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x26E0 (9952) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x26F0 (9968) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2700 (9984) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2710 (10000) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2720 (10016) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2730 (10032) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2740 (10048) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2750 (10064) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x2760 (10080) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2770 (10096) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2780 (10112) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2790 (10128) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x27A0 (10144) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x27B0 (10160) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x27C0 (10176) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x27D0 (10192) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x27E0 (10208) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x27F0 (10224) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2800 (10240) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2810 (10256) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2820 (10272) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2830 (10288) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2840 (10304) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x2850 (10320) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2860 (10336) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2870 (10352) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2880 (10368) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2890 (10384) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x28A0 (10400) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x28B0 (10416) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x28C0 (10432) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x28D0 (10448) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x28E0 (10464) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x28F0 (10480) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2900 (10496) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2910 (10512) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2920 (10528) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2930 (10544) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x2940 (10560) pixels
+// Packed by      : _TOOLS/bitmap_converter.py (palette + RLE, see GfxUi::drawPackedBitmap)
+// Packed size    : 240x44 pixels, 8 bits per pixel, 256 colours, 4592 bytes (was 21120)
+
+const uint8_t BuienLogo[4592] PROGMEM = {
+  0xF0, 0x00, 0x2C, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x6F, 0x19, 0xDA, 0x6C, 0x6E, 0x19, 0xFF, 0xF7,
+  0xD9, 0x6C, 0xD8, 0x74, 0x6D, 0x19, 0x9E, 0xF7, 0xDF, 0xF7, 0x6F, 0x11, 0x9F, 0xEF, 0xF8, 0x7C,
+  0xDF, 0xEF, 0x8C, 0x21, 0xFF, 0xEF, 0x8D, 0x21, 0xBF, 0xE7, 0x70, 0x42, 0xFF, 0xD6, 0xD7, 0x7C,
+  0x9D, 0xCE, 0x8F, 0x42, 0xB3, 0x6B, 0x59, 0x8D, 0x7A, 0x8D, 0xBF, 0xF7, 0xBF, 0xEF, 0x38, 0x85,
+  0x0E, 0x32, 0xD8, 0x6C, 0xAE, 0x21, 0xFE, 0xCE, 0x72, 0x63, 0xFB, 0xA5, 0x57, 0x7C, 0xD8, 0x7C,
+  0x18, 0x85, 0x3F, 0xD7, 0x5F, 0xDF, 0x7F, 0xDF, 0x36, 0x7C, 0xD7, 0x74, 0x6C, 0x19, 0x9F, 0xE7,
+  0xD9, 0x74, 0x5A, 0x8D, 0xCE, 0x29, 0xFE, 0xDE, 0x5F, 0xE7, 0x76, 0x84, 0x7A, 0xA5, 0x3F, 0xDF,
+  0xD3, 0x6B, 0xDF, 0xE7, 0x6D, 0x21, 0xAD, 0x21, 0xAD, 0x29, 0xBA, 0x9D, 0xCD, 0x29, 0xDA, 0x9D,
+  0xDB, 0x9D, 0x1F, 0xDF, 0x5F, 0xD7, 0x16, 0x74, 0x9A, 0x95, 0x1C, 0xB6, 0x1F, 0xCF, 0x7F, 0xEF,
+  0xDD, 0xC6, 0x3B, 0xB6, 0x4E, 0x3A, 0x7E, 0xC6, 0x90, 0x42, 0xBD, 0xC6, 0xDE, 0xD6, 0xDD, 0xCE,
+  0xDE, 0xC6, 0x1E, 0xCF, 0x9F, 0xDF, 0x77, 0x84, 0xD7, 0x94, 0xF7, 0x84, 0x19, 0x7D, 0x39, 0x85,
+  0x79, 0x95, 0xBB, 0x95, 0xED, 0x29, 0xEF, 0x31, 0x0D, 0x32, 0x1A, 0xB6, 0x2F, 0x32, 0x3A, 0xB6,
+  0x3D, 0xBE, 0x5C, 0xB6, 0xD1, 0x4A, 0xFF, 0xDE, 0xFF, 0xC6, 0x7F, 0xE7, 0x55, 0x84, 0x56, 0x7C,
+  0xB6, 0x8C, 0x17, 0x8D, 0x58, 0x8D, 0x6C, 0x21, 0x79, 0xA5, 0x8E, 0x21, 0xCC, 0x29, 0xDA, 0xA5,
+  0xED, 0x31, 0xEE, 0x31, 0xFB, 0xAD, 0xFA, 0xA5, 0x0F, 0x32, 0x3C, 0xAE, 0x3B, 0xAE, 0x5C, 0xC6,
+  0x5D, 0xAE, 0x7C, 0xBE, 0xB0, 0x4A, 0xBD, 0xBE, 0xBE, 0xBE, 0xFD, 0xD6, 0xFE, 0xC6, 0x1E, 0xD7,
+  0x1F, 0xC7, 0x3E, 0xDF, 0x71, 0x63, 0xD4, 0x6B, 0xF4, 0x73, 0x35, 0x7C, 0x56, 0x84, 0x78, 0x84,
+  0xD8, 0x8C, 0xF7, 0x7C, 0xFA, 0x6C, 0xF9, 0x7C, 0x19, 0x85, 0x18, 0x8D, 0x39, 0x9D, 0x38, 0x8D,
+  0x58, 0x95, 0x5A, 0x85, 0x5A, 0xA5, 0x9B, 0x8D, 0xBA, 0xAD, 0xBB, 0xAD, 0xD9, 0xAD, 0xEE, 0x29,
+  0x1C, 0xBE, 0x1B, 0xA6, 0x1C, 0xA6, 0x1B, 0xBE, 0x2F, 0x3A, 0x5B, 0xBE, 0x6F, 0x42, 0x7D, 0xC6,
+  0x7D, 0xAE, 0x9D, 0xBE, 0xBF, 0xCE, 0xDC, 0xCE, 0xDF, 0xD6, 0xDD, 0xD6, 0x12, 0x53, 0x11, 0x53,
+  0x3F, 0xCF, 0x51, 0x63, 0x52, 0x5B, 0x52, 0x63, 0x5E, 0xE7, 0x7F, 0xD7, 0xDF, 0xFF, 0x13, 0x7C,
+  0xB8, 0x84, 0xF8, 0x94, 0xF9, 0x94, 0x57, 0x9D, 0x58, 0x9D, 0x5A, 0x7D, 0x9B, 0xA5, 0xBC, 0x8D,
+  0xD9, 0xA5, 0xDE, 0xAD, 0xDC, 0x95, 0xEF, 0x29, 0x2C, 0x3A, 0x3A, 0xBE, 0x5C, 0xAE, 0x7D, 0xB6,
+  0x91, 0x42, 0x9E, 0xCE, 0x9D, 0xB6, 0xB1, 0x42, 0xBF, 0xC6, 0xBD, 0xCE, 0xDF, 0xB6, 0xF0, 0x52,
+  0xF1, 0x52, 0x11, 0x5B, 0x13, 0x53, 0x32, 0x5B, 0x53, 0x5B, 0x51, 0x5B, 0x59, 0x95, 0x73, 0x63,
+  0x73, 0x5B, 0x7E, 0xEF, 0x91, 0x6B, 0x93, 0x63, 0x94, 0x63, 0xB2, 0x6B, 0xB4, 0x6B, 0xB5, 0x6B,
+  0xDF, 0xDF, 0xF3, 0x73, 0xF6, 0x6B, 0x33, 0x84, 0x99, 0x84, 0xB6, 0x7C, 0xD5, 0x94, 0xF6, 0x9C,
+  0x1B, 0x95, 0x1A, 0x75, 0x17, 0x9D, 0x38, 0xA5, 0x5C, 0x9D, 0x98, 0x9D, 0x9B, 0x85, 0xB8, 0xA5,
+  0xCB, 0x31, 0xD0, 0x21, 0xDA, 0xB5, 0x10, 0x2A, 0x1D, 0x9E, 0x3B, 0xC6, 0x3D, 0xA6, 0x4D, 0x3A,
+  0x51, 0x32, 0x50, 0x3A, 0x5E, 0xA6, 0x7B, 0xC6, 0x7F, 0xA6, 0x7E, 0xAE, 0x8E, 0x4A, 0x8E, 0x42,
+  0x9C, 0xC6, 0xAF, 0x4A, 0xB2, 0x42, 0xBE, 0xB6, 0xDC, 0xD6, 0xDF, 0xBE, 0xF2, 0x4A, 0xF3, 0x4A,
+  0xFD, 0xDE, 0x54, 0x5B, 0x7F, 0xCF, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00,
+  0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00,
+  0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08,
+  0xA1, 0x00, 0x00, 0xAB, 0xFF, 0x00, 0xCB, 0x00, 0x00, 0x08, 0x94, 0x00, 0x00, 0x04, 0x8A, 0x00,
+  0x01, 0xA9, 0xCE, 0xFF, 0x00, 0xCB, 0x00, 0x00, 0x08, 0x90, 0x00, 0x08, 0x3E, 0xB1, 0x81, 0xC6,
+  0x77, 0xC6, 0x81, 0x69, 0x34, 0x85, 0x00, 0x01, 0x7A, 0xF9, 0xFF, 0x00, 0xCC, 0x00, 0x00, 0x08,
+  0x8E, 0x00, 0x03, 0x48, 0xC9, 0x38, 0x07, 0x84, 0x03, 0x08, 0x07, 0x39, 0x21, 0x4B, 0x00, 0x00,
+  0x04, 0xF0, 0xBA, 0x89, 0x00, 0x82, 0x09, 0x00, 0x1A, 0x83, 0x09, 0x05, 0x1A, 0x09, 0x09, 0x1A,
+  0x09, 0x04, 0x9C, 0x00, 0x00, 0xAB, 0x85, 0x09, 0xD6, 0x00, 0x01, 0x04, 0x04, 0x82, 0x0F, 0x01,
+  0x04, 0x04, 0xA6, 0x00, 0x01, 0x04, 0x04, 0x8A, 0x00, 0x00, 0x08, 0x8C, 0x00, 0x03, 0x1A, 0x63,
+  0x0E, 0x03, 0x86, 0x01, 0x08, 0x03, 0x07, 0x47, 0x4B, 0x00, 0x04, 0x5A, 0xE4, 0x04, 0x88, 0x00,
+  0x02, 0x30, 0xB9, 0x59, 0x8A, 0x1D, 0x03, 0x16, 0x17, 0x69, 0x0B, 0x99, 0x00, 0x06, 0x65, 0x59,
+  0x59, 0x1D, 0x1D, 0x59, 0xAC, 0xD6, 0x00, 0x01, 0x7C, 0x66, 0x82, 0x25, 0x02, 0x66, 0xB0, 0x04,
+  0xA3, 0x00, 0x04, 0x09, 0x9A, 0x5C, 0x5A, 0xA0, 0x89, 0x00, 0x00, 0x08, 0x8B, 0x00, 0x03, 0x0B,
+  0xC8, 0x07, 0x03, 0x86, 0x01, 0x08, 0x03, 0x07, 0xC5, 0x31, 0x04, 0x36, 0xB5, 0xB0, 0x09, 0x89,
+  0x00, 0x02, 0x60, 0x0E, 0x07, 0x8B, 0x03, 0x03, 0x07, 0x07, 0x99, 0x95, 0x98, 0x00, 0x06, 0x64,
+  0x2B, 0x07, 0x03, 0x03, 0x2B, 0x17, 0xD6, 0x00, 0x07, 0x20, 0x2A, 0x06, 0x05, 0x05, 0x06, 0x66,
+  0x04, 0xA3, 0x00, 0x05, 0x5C, 0x78, 0x5E, 0x78, 0x4A, 0xA0, 0x88, 0x00, 0x00, 0x08, 0x8A, 0x00,
+  0x03, 0x1A, 0xA7, 0x07, 0x03, 0x86, 0x01, 0x08, 0x03, 0x07, 0xD0, 0x1B, 0x04, 0x2C, 0x8D, 0x66,
+  0x2C, 0x8A, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x8D, 0x01, 0x02, 0x03, 0x3B, 0xBE, 0x97, 0x00, 0x06,
+  0x64, 0x07, 0x03, 0x03, 0x01, 0x07, 0x17, 0xD6, 0x00, 0x07, 0x43, 0x2A, 0x05, 0x02, 0x02, 0x05,
+  0x1C, 0x04, 0xA2, 0x00, 0x06, 0x1B, 0x76, 0x9E, 0xBB, 0x3A, 0x3F, 0x5C, 0x88, 0x00, 0x00, 0x08,
+  0x8A, 0x00, 0x04, 0x65, 0x07, 0x03, 0x01, 0x0A, 0x82, 0x01, 0x0A, 0x0A, 0x01, 0x03, 0x10, 0x64,
+  0x09, 0x04, 0x3F, 0x25, 0x52, 0x3F, 0x8B, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x8D, 0x01, 0x02, 0x03,
+  0x03, 0xC8, 0x97, 0x00, 0x06, 0x83, 0x2B, 0x07, 0x07, 0x03, 0x2B, 0xD2, 0xD6, 0x00, 0x07, 0x43,
+  0x06, 0x05, 0x02, 0x02, 0x05, 0x1C, 0x04, 0xA2, 0x00, 0x06, 0x0B, 0x4A, 0x9E, 0x55, 0x18, 0x36,
+  0x5C, 0x88, 0x00, 0x00, 0x08, 0x89, 0x00, 0x03, 0xA1, 0x39, 0x03, 0x01, 0x82, 0x0A, 0x82, 0x01,
+  0x0C, 0x03, 0x10, 0x8B, 0x04, 0x04, 0x7B, 0x52, 0x14, 0x20, 0x04, 0x00, 0x44, 0xCE, 0x88, 0x00,
+  0x02, 0x13, 0x0E, 0x03, 0x83, 0x01, 0x01, 0x03, 0x03, 0x82, 0x07, 0x01, 0x03, 0x03, 0x84, 0x01,
+  0x01, 0x38, 0x44, 0x96, 0x00, 0x01, 0x46, 0x50, 0x82, 0x84, 0x01, 0x50, 0x93, 0xD5, 0x00, 0x08,
+  0x04, 0x7D, 0x06, 0x05, 0x02, 0x02, 0x05, 0x1C, 0x04, 0xA2, 0x00, 0x06, 0x09, 0x5A, 0x78, 0x79,
+  0x72, 0x20, 0xBA, 0x88, 0x00, 0x00, 0x08, 0x89, 0x00, 0x01, 0xD3, 0x03, 0x86, 0x01, 0x0D, 0x03,
+  0x94, 0x42, 0x04, 0x04, 0xBC, 0x14, 0x14, 0xBC, 0x04, 0x00, 0x1B, 0xA6, 0xAC, 0x88, 0x00, 0x02,
+  0x13, 0x0E, 0x03, 0x83, 0x01, 0x01, 0x5B, 0x50, 0x82, 0x32, 0x08, 0xCC, 0x38, 0x03, 0x01, 0x0A,
+  0x0A, 0x01, 0x07, 0x4B, 0x97, 0x00, 0x84, 0x04, 0x88, 0x00, 0x05, 0x09, 0x62, 0x34, 0x34, 0x44,
+  0x09, 0x91, 0x00, 0x03, 0x0B, 0x34, 0x34, 0x1B, 0x86, 0x00, 0x85, 0x04, 0x06, 0x00, 0x00, 0x04,
+  0x0D, 0x11, 0x11, 0x04, 0x84, 0x00, 0x02, 0x04, 0x04, 0x0D, 0x83, 0x11, 0x01, 0x0F, 0x04, 0x89,
+  0x00, 0x0E, 0x04, 0x0F, 0x11, 0x11, 0x0F, 0x04, 0x04, 0x43, 0x06, 0x05, 0x02, 0x02, 0x05, 0x1C,
+  0x04, 0x85, 0x00, 0x02, 0x04, 0x0F, 0x0D, 0x82, 0x11, 0x02, 0x36, 0x0F, 0x04, 0x87, 0x00, 0x84,
+  0x04, 0x0D, 0x00, 0x00, 0x04, 0x0D, 0x11, 0x0D, 0x00, 0x00, 0x7E, 0x5A, 0x7C, 0x4C, 0x5A, 0x1B,
+  0x88, 0x00, 0x00, 0x08, 0x88, 0x00, 0x04, 0x31, 0x2F, 0x01, 0x01, 0x0A, 0x82, 0x01, 0x10, 0x03,
+  0x03, 0x99, 0xBE, 0x04, 0x0F, 0x6F, 0x2A, 0x06, 0x96, 0x04, 0x00, 0x09, 0x80, 0x68, 0x6D, 0x0B,
+  0x87, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x82, 0x01, 0x02, 0x03, 0xC7, 0x04, 0x82, 0x00, 0x0C, 0x04,
+  0x85, 0x03, 0x01, 0x0A, 0x01, 0x01, 0x10, 0x30, 0x00, 0x00, 0x1A, 0xCF, 0x83, 0x21, 0x01, 0x7F,
+  0xA9, 0x82, 0x00, 0x01, 0xEA, 0x7F, 0x82, 0x21, 0x01, 0xA6, 0xD8, 0x82, 0x00, 0x06, 0x69, 0xA6,
+  0xA8, 0x21, 0xA8, 0x7F, 0xDC, 0x85, 0x00, 0x0A, 0x31, 0x51, 0x77, 0x39, 0x0E, 0x0E, 0x6B, 0x9B,
+  0x81, 0x9C, 0x04, 0x84, 0x00, 0x01, 0xFD, 0x7F, 0x83, 0x21, 0x09, 0x32, 0x04, 0x74, 0xA8, 0x57,
+  0x0E, 0x0E, 0x6D, 0xD6, 0x30, 0x84, 0x00, 0x00, 0x5C, 0x82, 0x3A, 0x08, 0x3C, 0xB5, 0x1B, 0x1B,
+  0x6F, 0x52, 0x14, 0x14, 0x9A, 0x82, 0x00, 0x04, 0x04, 0x27, 0x73, 0x18, 0x86, 0x82, 0x14, 0x04,
+  0x24, 0x25, 0x55, 0x5E, 0x11, 0x86, 0x00, 0x0F, 0x2C, 0x6F, 0x25, 0x14, 0x14, 0x52, 0x70, 0x4F,
+  0x7D, 0x06, 0x05, 0x02, 0x02, 0x05, 0x1C, 0x04, 0x83, 0x00, 0x0C, 0x04, 0x20, 0x6C, 0x25, 0x14,
+  0x14, 0x24, 0x14, 0x14, 0x25, 0x3A, 0x4C, 0x04, 0x83, 0x00, 0x02, 0x09, 0x93, 0x3A, 0x82, 0x3C,
+  0x0D, 0x70, 0x04, 0x2C, 0x3A, 0x86, 0x14, 0x52, 0x7A, 0x00, 0x00, 0x09, 0x7E, 0xA9, 0x04, 0x89,
+  0x00, 0x00, 0x08, 0x88, 0x00, 0x01, 0x91, 0x07, 0x85, 0x01, 0x10, 0x07, 0x77, 0x3E, 0x04, 0x36,
+  0x56, 0x06, 0x06, 0x41, 0x0F, 0x00, 0x04, 0x32, 0x07, 0x03, 0x2B, 0x42, 0x87, 0x00, 0x02, 0x13,
+  0x0E, 0x03, 0x82, 0x01, 0x02, 0x03, 0xA3, 0x04, 0x82, 0x00, 0x02, 0x04, 0xB3, 0x03, 0x82, 0x01,
+  0x07, 0x03, 0x71, 0x1A, 0x00, 0x00, 0x44, 0x6B, 0x07, 0x82, 0x03, 0x01, 0x0E, 0x30, 0x82, 0x00,
+  0x06, 0x33, 0x68, 0x07, 0x03, 0x03, 0x2B, 0xF3, 0x82, 0x00, 0x06, 0x83, 0x2B, 0x07, 0x03, 0x03,
+  0x2B, 0xD2, 0x84, 0x00, 0x02, 0x92, 0x1D, 0x07, 0x85, 0x03, 0x03, 0x07, 0x10, 0xD3, 0x44, 0x83,
+  0x00, 0x09, 0x15, 0x68, 0x03, 0x03, 0x07, 0x07, 0xFC, 0xDD, 0x10, 0x07, 0x83, 0x03, 0x02, 0x07,
+  0x6E, 0x48, 0x82, 0x00, 0x01, 0x04, 0x55, 0x84, 0x06, 0x0C, 0xFF, 0x18, 0x06, 0x2D, 0x05, 0x06,
+  0x46, 0x04, 0x00, 0x04, 0x72, 0x06, 0x06, 0x87, 0x05, 0x02, 0x06, 0x0C, 0x43, 0x83, 0x00, 0x03,
+  0x04, 0x4E, 0x0C, 0x06, 0x83, 0x05, 0x09, 0x06, 0x53, 0xF1, 0x05, 0x05, 0x02, 0x02, 0x05, 0x1C,
+  0x04, 0x82, 0x00, 0x03, 0x28, 0x18, 0x06, 0x06, 0x86, 0x05, 0x03, 0x06, 0x06, 0x55, 0x11, 0x82,
+  0x00, 0x01, 0x09, 0x14, 0x83, 0x06, 0x07, 0x53, 0xAA, 0x25, 0x06, 0x05, 0x05, 0x2A, 0x4C, 0x8F,
+  0x00, 0x00, 0x08, 0x88, 0x00, 0x02, 0x82, 0x07, 0x0A, 0x82, 0x01, 0x12, 0x03, 0x07, 0xCD, 0x2C,
+  0x04, 0x4F, 0x67, 0x06, 0x06, 0x18, 0x36, 0x00, 0x00, 0x8B, 0x10, 0x03, 0x03, 0x07, 0xAD, 0x87,
+  0x00, 0x02, 0x13, 0x0E, 0x03, 0x82, 0x01, 0x0D, 0x03, 0xFB, 0x31, 0x62, 0x31, 0x31, 0x48, 0x49,
+  0x03, 0x01, 0x01, 0x03, 0x07, 0xAE, 0x82, 0x00, 0x07, 0x0B, 0x1F, 0x01, 0x01, 0x0A, 0x01, 0x37,
+  0x30, 0x82, 0x00, 0x0B, 0x33, 0x07, 0x03, 0x01, 0x01, 0x03, 0x16, 0x04, 0x00, 0x00, 0x23, 0x03,
+  0x82, 0x01, 0x01, 0x03, 0x17, 0x83, 0x00, 0x04, 0xB1, 0x10, 0x03, 0x01, 0x01, 0x83, 0x03, 0x82,
+  0x01, 0x02, 0x07, 0xC4, 0x0B, 0x82, 0x00, 0x08, 0x15, 0x07, 0x01, 0x01, 0x0A, 0x01, 0xE6, 0x01,
+  0x03, 0x85, 0x01, 0x07, 0x03, 0x99, 0x0B, 0x00, 0x00, 0x04, 0x19, 0x05, 0x82, 0x02, 0x0E, 0x87,
+  0xB4, 0x06, 0x05, 0x02, 0x02, 0x06, 0x73, 0x04, 0x04, 0x46, 0x06, 0x05, 0x02, 0x02, 0x84, 0x05,
+  0x05, 0x87, 0x02, 0x02, 0x05, 0x0C, 0x1B, 0x82, 0x00, 0x02, 0x28, 0x86, 0x05, 0x84, 0x02, 0x83,
+  0x05, 0x82, 0x02, 0x07, 0x05, 0x1C, 0x04, 0x00, 0x00, 0x0D, 0x8C, 0x06, 0x82, 0x02, 0x83, 0x05,
+  0x82, 0x02, 0x07, 0x05, 0x06, 0x22, 0x04, 0x00, 0x00, 0x0D, 0x24, 0x83, 0x02, 0x02, 0xDE, 0xE3,
+  0x2D, 0x82, 0x02, 0x01, 0x06, 0x20, 0x8F, 0x00, 0x00, 0x08, 0x88, 0x00, 0x01, 0x21, 0x03, 0x82,
+  0x01, 0x13, 0x03, 0x10, 0x82, 0x0D, 0x04, 0x26, 0x89, 0x06, 0x06, 0x0C, 0x28, 0x00, 0x00, 0x92,
+  0x10, 0x03, 0x01, 0x01, 0x03, 0x80, 0x87, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x83, 0x01, 0x00, 0x03,
+  0x83, 0x1F, 0x01, 0x03, 0x03, 0x82, 0x01, 0x02, 0x6A, 0x32, 0x09, 0x82, 0x00, 0x01, 0x0B, 0x1F,
+  0x83, 0x01, 0x01, 0x37, 0x30, 0x82, 0x00, 0x0B, 0x33, 0x07, 0x03, 0x01, 0x01, 0x03, 0x16, 0x04,
+  0x00, 0x00, 0x23, 0x03, 0x82, 0x01, 0x01, 0x03, 0x17, 0x82, 0x00, 0x02, 0x48, 0x39, 0x03, 0x82,
+  0x01, 0x09, 0x07, 0x38, 0x94, 0x10, 0x03, 0x01, 0x01, 0x03, 0x07, 0x29, 0x82, 0x00, 0x01, 0x15,
+  0x07, 0x8D, 0x01, 0x06, 0x07, 0x91, 0x00, 0x00, 0x04, 0x19, 0x05, 0x83, 0x02, 0x01, 0x05, 0x05,
+  0x82, 0x02, 0x0E, 0x06, 0x73, 0x04, 0x11, 0x14, 0x05, 0x05, 0x02, 0x05, 0x06, 0x2E, 0x3D, 0x41,
+  0x2D, 0x05, 0x82, 0x02, 0x09, 0x06, 0x4A, 0x00, 0x00, 0x04, 0x3D, 0x06, 0x05, 0x02, 0x02, 0x85,
+  0x05, 0x83, 0x02, 0x0F, 0x05, 0x25, 0x04, 0x00, 0x00, 0x79, 0x06, 0x05, 0x02, 0x02, 0x05, 0x0C,
+  0x41, 0x3D, 0x54, 0x05, 0x82, 0x02, 0x06, 0x05, 0x0C, 0x0D, 0x00, 0x00, 0x0D, 0x0C, 0x84, 0x02,
+  0x06, 0x05, 0x05, 0x02, 0x87, 0x02, 0x06, 0x20, 0x8F, 0x00, 0x00, 0x08, 0x88, 0x00, 0x13, 0xA4,
+  0x03, 0x01, 0x01, 0x03, 0x10, 0xAF, 0x04, 0x04, 0x4D, 0x24, 0x05, 0x05, 0x0C, 0xA5, 0x04, 0x00,
+  0x5D, 0x39, 0x03, 0x82, 0x01, 0x01, 0x03, 0xCD, 0x87, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x8D, 0x01,
+  0x02, 0xED, 0x5D, 0x04, 0x82, 0x00, 0x01, 0x0B, 0x38, 0x83, 0x01, 0x01, 0x37, 0x30, 0x82, 0x00,
+  0x0B, 0x33, 0x07, 0x03, 0x01, 0x01, 0x03, 0x16, 0x04, 0x00, 0x00, 0x23, 0x03, 0x82, 0x01, 0x19,
+  0x03, 0x17, 0x00, 0x00, 0x09, 0xC5, 0x03, 0x03, 0x01, 0x01, 0x03, 0xAD, 0x27, 0x1B, 0xC1, 0xBD,
+  0x03, 0x01, 0x01, 0x03, 0x38, 0x3E, 0x00, 0x00, 0x15, 0x10, 0x84, 0x01, 0x04, 0x03, 0x6A, 0xB8,
+  0x07, 0x03, 0x82, 0x01, 0x07, 0x0A, 0x03, 0x82, 0x00, 0x00, 0x04, 0x19, 0x05, 0x84, 0x02, 0x08,
+  0x05, 0x05, 0x06, 0x06, 0x2A, 0x46, 0x04, 0x20, 0xDA, 0x83, 0x06, 0x05, 0x22, 0x0F, 0x04, 0x0F,
+  0xEF, 0x05, 0x82, 0x02, 0x06, 0x06, 0x73, 0x04, 0x00, 0x11, 0x24, 0x05, 0x82, 0x02, 0x06, 0x05,
+  0x0C, 0x97, 0x75, 0x2E, 0x05, 0x05, 0x82, 0x02, 0x06, 0x05, 0x1C, 0x04, 0x00, 0x00, 0x6C, 0x2A,
+  0x82, 0x06, 0x05, 0x2A, 0x43, 0x0F, 0x0F, 0x36, 0x8E, 0x83, 0x02, 0x05, 0x06, 0x28, 0x00, 0x00,
+  0x0D, 0x0C, 0x85, 0x02, 0x05, 0x05, 0x1E, 0x06, 0x06, 0x2A, 0x4C, 0x8F, 0x00, 0x00, 0x08, 0x88,
+  0x00, 0x12, 0xCA, 0x07, 0x01, 0x03, 0x2F, 0x92, 0x04, 0x0F, 0x9D, 0x06, 0x05, 0x05, 0x06, 0x78,
+  0x04, 0x00, 0x4B, 0x6E, 0x03, 0x83, 0x01, 0x01, 0x03, 0xD1, 0x87, 0x00, 0x02, 0x13, 0x0E, 0x03,
+  0x89, 0x01, 0x00, 0x0A, 0x82, 0x01, 0x07, 0x03, 0x10, 0x50, 0x09, 0x00, 0x00, 0x0B, 0x1F, 0x83,
+  0x01, 0x01, 0x37, 0x60, 0x82, 0x00, 0x0B, 0x33, 0x07, 0x03, 0x01, 0x0A, 0x03, 0x16, 0x04, 0x00,
+  0x00, 0x23, 0x03, 0x82, 0x01, 0x05, 0x03, 0x17, 0x00, 0x00, 0x15, 0x10, 0x82, 0x01, 0x10, 0x03,
+  0xD7, 0x04, 0x00, 0x00, 0x04, 0xC1, 0x10, 0x03, 0x01, 0x01, 0x07, 0x51, 0x00, 0x00, 0x15, 0x10,
+  0x83, 0x01, 0x05, 0x03, 0x5F, 0xA1, 0x1B, 0x5D, 0x1F, 0x83, 0x01, 0x06, 0x03, 0x17, 0x00, 0x00,
+  0x04, 0x19, 0x05, 0x83, 0x02, 0x09, 0x05, 0x06, 0x22, 0x4D, 0x20, 0xF5, 0xA0, 0x00, 0x1B, 0x7A,
+  0x83, 0x20, 0x05, 0x2C, 0x04, 0x04, 0x0F, 0xC3, 0x05, 0x82, 0x02, 0x05, 0x06, 0x22, 0x04, 0x04,
+  0x4C, 0x06, 0x83, 0x02, 0x06, 0x06, 0xA5, 0x04, 0x04, 0x0F, 0x19, 0x05, 0x82, 0x02, 0x0A, 0x05,
+  0x8C, 0x04, 0x00, 0x00, 0x7E, 0x4C, 0x20, 0x4E, 0x20, 0x4E, 0x82, 0x04, 0x01, 0x0F, 0x90, 0x83,
+  0x02, 0x05, 0x06, 0x3F, 0x00, 0x00, 0x0D, 0x0C, 0x83, 0x02, 0x07, 0x05, 0x05, 0x0C, 0x72, 0x7B,
+  0x7B, 0x9A, 0x7E, 0x8F, 0x00, 0x00, 0x08, 0x88, 0x00, 0x11, 0xD6, 0x07, 0x03, 0x71, 0x48, 0x04,
+  0x0D, 0x22, 0x06, 0x05, 0x05, 0x06, 0x75, 0x04, 0x00, 0x3E, 0x47, 0x03, 0x83, 0x01, 0x02, 0x03,
+  0x03, 0x29, 0x87, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x83, 0x01, 0x01, 0x03, 0x03, 0x83, 0x07, 0x00,
+  0x03, 0x83, 0x01, 0x0C, 0x03, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0x1F, 0x01, 0x01, 0x0A, 0x01, 0x37,
+  0x60, 0x82, 0x00, 0x0B, 0x33, 0x07, 0x03, 0x01, 0x0A, 0x03, 0x16, 0x04, 0x00, 0x00, 0x23, 0x03,
+  0x82, 0x01, 0x05, 0x03, 0x17, 0x00, 0x00, 0x51, 0x07, 0x82, 0x01, 0x10, 0x03, 0xD9, 0x42, 0x98,
+  0x98, 0x42, 0xB6, 0x2F, 0x03, 0x01, 0x01, 0x03, 0xA7, 0x00, 0x00, 0x15, 0x07, 0x83, 0x01, 0x01,
+  0x07, 0x9C, 0x82, 0x00, 0x01, 0xD1, 0x03, 0x82, 0x01, 0x06, 0x03, 0x35, 0x00, 0x00, 0x04, 0x19,
+  0x05, 0x82, 0x02, 0x02, 0x05, 0x06, 0xFA, 0x82, 0x04, 0x84, 0x00, 0x83, 0x04, 0x05, 0x36, 0x28,
+  0x4E, 0x5E, 0x88, 0x05, 0x82, 0x02, 0x05, 0x06, 0x22, 0x04, 0x04, 0x46, 0x06, 0x82, 0x02, 0x02,
+  0x05, 0x19, 0x04, 0x82, 0x00, 0x07, 0x61, 0x06, 0x05, 0x02, 0x02, 0x05, 0x1C, 0x04, 0x83, 0x00,
+  0x82, 0x04, 0x05, 0x0F, 0x11, 0x3F, 0x4D, 0x3D, 0x2D, 0x83, 0x02, 0x05, 0x06, 0x26, 0x00, 0x00,
+  0x0D, 0x0C, 0x83, 0x02, 0x03, 0x05, 0x0C, 0x3F, 0x04, 0x93, 0x00, 0x00, 0x08, 0x88, 0x00, 0x10,
+  0xDF, 0x68, 0x49, 0x60, 0x04, 0x11, 0x41, 0x06, 0x05, 0x05, 0x06, 0x3C, 0x04, 0x00, 0x62, 0x77,
+  0x03, 0x84, 0x01, 0x02, 0x03, 0x07, 0x8F, 0x87, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x82, 0x01, 0x08,
+  0x03, 0xF7, 0x9F, 0xC2, 0x15, 0x15, 0x9C, 0x32, 0x6A, 0x83, 0x01, 0x05, 0x03, 0x47, 0x1A, 0x00,
+  0x0B, 0x1F, 0x83, 0x01, 0x01, 0x37, 0x30, 0x82, 0x00, 0x0B, 0x33, 0x07, 0x03, 0x01, 0x01, 0x03,
+  0x16, 0x04, 0x00, 0x00, 0x23, 0x03, 0x82, 0x01, 0x06, 0x03, 0x17, 0x04, 0x00, 0x17, 0x03, 0x0A,
+  0x82, 0x01, 0x01, 0x03, 0x03, 0x82, 0x07, 0x01, 0x03, 0x03, 0x82, 0x01, 0x05, 0x03, 0x47, 0x09,
+  0x00, 0x15, 0x07, 0x83, 0x01, 0x01, 0x2F, 0x0B, 0x82, 0x00, 0x01, 0x29, 0x03, 0x82, 0x01, 0x06,
+  0x03, 0x35, 0x00, 0x00, 0x04, 0x19, 0x05, 0x82, 0x02, 0x02, 0x05, 0x18, 0x0F, 0x86, 0x00, 0x05,
+  0x04, 0x36, 0x79, 0x3D, 0x54, 0x0C, 0x82, 0x06, 0x00, 0x05, 0x83, 0x02, 0x0B, 0x06, 0x22, 0x04,
+  0x04, 0x6C, 0x1E, 0x02, 0x02, 0x05, 0x05, 0x97, 0x04, 0x82, 0x00, 0x07, 0x4F, 0x2A, 0x05, 0x02,
+  0x02, 0x1E, 0x8A, 0x04, 0x82, 0x00, 0x04, 0x04, 0x28, 0x9D, 0x41, 0x53, 0x82, 0x06, 0x01, 0x05,
+  0x05, 0x83, 0x02, 0x05, 0x06, 0x26, 0x00, 0x00, 0x0D, 0x0C, 0x83, 0x02, 0x02, 0x06, 0x96, 0x04,
+  0x94, 0x00, 0x00, 0x08, 0x88, 0x00, 0x0F, 0xA2, 0xCA, 0x62, 0x04, 0x28, 0x18, 0x06, 0x05, 0x05,
+  0x1E, 0x19, 0x0D, 0x00, 0x1B, 0xA4, 0x07, 0x85, 0x01, 0x02, 0x03, 0x0E, 0x60, 0x87, 0x00, 0x02,
+  0x13, 0x0E, 0x03, 0x82, 0x01, 0x01, 0x03, 0xA3, 0x84, 0x00, 0x02, 0x04, 0xFE, 0x03, 0x82, 0x01,
+  0x05, 0x03, 0x0E, 0x9F, 0x00, 0x0B, 0x1F, 0x83, 0x01, 0x01, 0x10, 0x30, 0x82, 0x00, 0x0B, 0x33,
+  0x07, 0x03, 0x01, 0x01, 0x03, 0x16, 0x04, 0x00, 0x00, 0x23, 0x03, 0x82, 0x01, 0x09, 0x03, 0x17,
+  0x04, 0x04, 0xA7, 0x03, 0x01, 0x0A, 0x01, 0x01, 0x89, 0x03, 0x05, 0x07, 0x6B, 0x0B, 0x00, 0x15,
+  0x07, 0x83, 0x01, 0x01, 0xB8, 0x1A, 0x82, 0x00, 0x01, 0x29, 0x03, 0x82, 0x01, 0x06, 0x03, 0x35,
+  0x00, 0x00, 0x04, 0x19, 0x05, 0x82, 0x02, 0x02, 0x06, 0x42, 0x04, 0x85, 0x00, 0x04, 0x04, 0x4A,
+  0x25, 0x06, 0x2D, 0x86, 0x05, 0x82, 0x02, 0x0B, 0x06, 0x22, 0x04, 0x04, 0x3C, 0x1E, 0x02, 0x02,
+  0x05, 0x1E, 0x9D, 0x04, 0x82, 0x00, 0x0D, 0x11, 0x14, 0x05, 0x02, 0x02, 0x1E, 0x8A, 0x04, 0x00,
+  0x00, 0x0D, 0x6F, 0x14, 0x06, 0x86, 0x05, 0x83, 0x02, 0x05, 0x06, 0x26, 0x00, 0x00, 0x0D, 0x0C,
+  0x83, 0x02, 0x01, 0x06, 0x20, 0x95, 0x00, 0x00, 0x08, 0x89, 0x00, 0x04, 0x09, 0x04, 0x43, 0x0C,
+  0x2D, 0x82, 0x05, 0x06, 0x1C, 0x11, 0x00, 0x09, 0x80, 0x07, 0x03, 0x84, 0x01, 0x03, 0x0A, 0x03,
+  0xA4, 0x04, 0x87, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x82, 0x01, 0x01, 0x03, 0xA3, 0x85, 0x00, 0x01,
+  0x40, 0x03, 0x82, 0x01, 0x05, 0x03, 0x2B, 0x42, 0x00, 0x0B, 0x1F, 0x83, 0x01, 0x01, 0x10, 0x4B,
+  0x82, 0x00, 0x0B, 0x33, 0x07, 0x03, 0x01, 0x01, 0x03, 0x16, 0x04, 0x00, 0x00, 0x23, 0x03, 0x82,
+  0x01, 0x19, 0x03, 0x17, 0x04, 0x04, 0xD0, 0x03, 0x01, 0x0A, 0x01, 0x03, 0x1F, 0x2F, 0x3B, 0x57,
+  0x57, 0x3B, 0x3B, 0x57, 0x57, 0x3B, 0x6D, 0xB9, 0x44, 0x00, 0x15, 0x07, 0x83, 0x01, 0x01, 0x71,
+  0x1A, 0x82, 0x00, 0x0B, 0x29, 0x03, 0x01, 0x01, 0x0A, 0x03, 0x35, 0x00, 0x00, 0x04, 0x19, 0x05,
+  0x82, 0x02, 0x01, 0x06, 0x9E, 0x86, 0x00, 0x1A, 0x4D, 0x24, 0x06, 0x05, 0x02, 0x02, 0x05, 0x06,
+  0x24, 0x54, 0xB4, 0x05, 0x05, 0x02, 0x02, 0x06, 0x22, 0x04, 0x04, 0x70, 0x06, 0x02, 0x02, 0x05,
+  0x05, 0x75, 0x04, 0x82, 0x00, 0x15, 0x4F, 0x2A, 0x05, 0x02, 0x02, 0x05, 0x1C, 0x04, 0x00, 0x04,
+  0x3C, 0x06, 0x05, 0x05, 0x02, 0x05, 0x05, 0x06, 0x0C, 0x56, 0xB2, 0x05, 0x82, 0x02, 0x05, 0x06,
+  0x26, 0x00, 0x00, 0x0D, 0x0C, 0x83, 0x02, 0x01, 0x06, 0x27, 0x95, 0x00, 0x00, 0x08, 0x89, 0x00,
+  0x0C, 0x04, 0x4A, 0x24, 0x05, 0x05, 0x02, 0x05, 0x0C, 0x3F, 0x04, 0x04, 0x83, 0x07, 0x86, 0x01,
+  0x02, 0x03, 0x10, 0x98, 0x88, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x82, 0x01, 0x02, 0x03, 0xC7, 0x04,
+  0x83, 0x00, 0x02, 0x31, 0xEE, 0x03, 0x82, 0x01, 0x05, 0x03, 0x2B, 0x95, 0x00, 0x0B, 0x1F, 0x82,
+  0x01, 0x02, 0x0A, 0x07, 0x5D, 0x82, 0x00, 0x01, 0x40, 0x03, 0x82, 0x01, 0x06, 0x03, 0x16, 0x04,
+  0x00, 0x00, 0x23, 0x03, 0x82, 0x01, 0x05, 0x03, 0x17, 0x04, 0x00, 0x32, 0x07, 0x82, 0x01, 0x01,
+  0x03, 0xB6, 0x85, 0x0B, 0x0E, 0x2C, 0x2C, 0x0B, 0x0B, 0x1B, 0x00, 0x00, 0x15, 0x07, 0x01, 0x0A,
+  0x01, 0x01, 0x58, 0x1A, 0x82, 0x00, 0x0B, 0x29, 0x03, 0x01, 0x01, 0x0A, 0x03, 0x35, 0x00, 0x00,
+  0x04, 0x19, 0x05, 0x82, 0x02, 0x01, 0x06, 0x4D, 0x85, 0x00, 0x02, 0x04, 0x54, 0x05, 0x82, 0x02,
+  0x0F, 0x05, 0x53, 0xF8, 0x28, 0x0F, 0x7D, 0x1E, 0x05, 0x02, 0x02, 0x06, 0x22, 0x04, 0x04, 0x5E,
+  0x06, 0x82, 0x02, 0x11, 0x05, 0x56, 0x04, 0x00, 0x00, 0x04, 0x7D, 0x06, 0x05, 0x02, 0x02, 0x05,
+  0x1C, 0x0F, 0x04, 0x7C, 0x06, 0x05, 0x82, 0x02, 0x06, 0x05, 0x56, 0x61, 0x11, 0x0F, 0xB7, 0x05,
+  0x82, 0x02, 0x05, 0x06, 0x26, 0x00, 0x00, 0x0D, 0x0C, 0x83, 0x02, 0x01, 0x06, 0x27, 0x95, 0x00,
+  0x00, 0x08, 0x88, 0x00, 0x0D, 0x04, 0x72, 0x06, 0x05, 0x02, 0x02, 0x05, 0x24, 0x7B, 0x04, 0x04,
+  0xAF, 0x10, 0x03, 0x85, 0x01, 0x03, 0x03, 0x07, 0xC9, 0x09, 0x88, 0x00, 0x03, 0x13, 0x0E, 0x03,
+  0x01, 0x82, 0x0A, 0x00, 0xE8, 0x83, 0x40, 0x02, 0xD4, 0x71, 0x03, 0x83, 0x01, 0x05, 0x03, 0x0E,
+  0x13, 0x00, 0x0B, 0x1F, 0x83, 0x01, 0x06, 0x03, 0xD4, 0x1B, 0x09, 0x48, 0x2F, 0x03, 0x82, 0x01,
+  0x06, 0x03, 0x16, 0x04, 0x00, 0x00, 0x23, 0x03, 0x82, 0x01, 0x05, 0x03, 0x17, 0x00, 0x00, 0x46,
+  0x07, 0x82, 0x01, 0x02, 0x03, 0xD7, 0x04, 0x82, 0x00, 0x0A, 0x09, 0x0B, 0x0B, 0x11, 0x1B, 0x0B,
+  0x1A, 0x00, 0x00, 0x15, 0x07, 0x83, 0x01, 0x01, 0x58, 0x1A, 0x82, 0x00, 0x01, 0x29, 0x03, 0x82,
+  0x01, 0x06, 0x03, 0x35, 0x00, 0x00, 0x04, 0x19, 0x05, 0x82, 0x02, 0x01, 0x06, 0x45, 0x85, 0x00,
+  0x01, 0x11, 0x06, 0x83, 0x02, 0x0F, 0x06, 0xA5, 0x04, 0x00, 0x04, 0xC3, 0x1E, 0x05, 0x02, 0x02,
+  0x06, 0x22, 0x04, 0x04, 0x4E, 0x06, 0x83, 0x02, 0x06, 0x2D, 0xAA, 0x04, 0x04, 0x0F, 0x56, 0x05,
+  0x82, 0x02, 0x05, 0x05, 0x1C, 0x0F, 0x04, 0x76, 0x06, 0x83, 0x02, 0x06, 0xB2, 0x0F, 0x04, 0x00,
+  0x0F, 0x90, 0x05, 0x82, 0x02, 0x05, 0x06, 0x26, 0x00, 0x00, 0x0D, 0x0C, 0x83, 0x02, 0x01, 0x06,
+  0x27, 0x95, 0x00, 0x00, 0x08, 0x88, 0x00, 0x0C, 0x7C, 0x06, 0x05, 0x02, 0x02, 0x05, 0x06, 0xBF,
+  0x04, 0x00, 0x91, 0x10, 0x03, 0x86, 0x01, 0x02, 0x03, 0x47, 0x34, 0x89, 0x00, 0x03, 0x13, 0x0E,
+  0x03, 0x01, 0x82, 0x0A, 0x00, 0x01, 0x85, 0x03, 0x84, 0x01, 0x05, 0x07, 0xF6, 0x09, 0x00, 0x1B,
+  0x2F, 0x82, 0x01, 0x06, 0x0A, 0x03, 0x07, 0x5B, 0x12, 0x10, 0x03, 0x83, 0x01, 0x06, 0x03, 0x16,
+  0x04, 0x00, 0x00, 0x23, 0x03, 0x82, 0x01, 0x06, 0x03, 0x17, 0x04, 0x00, 0x1B, 0x5B, 0x03, 0x82,
+  0x01, 0x0F, 0x6A, 0x8B, 0x09, 0x04, 0x0B, 0x32, 0x6D, 0x3B, 0x3B, 0x6B, 0xE5, 0xDB, 0x00, 0x00,
+  0x15, 0x07, 0x83, 0x01, 0x01, 0x58, 0x1A, 0x82, 0x00, 0x01, 0x29, 0x03, 0x82, 0x01, 0x06, 0x03,
+  0x35, 0x00, 0x00, 0x04, 0x19, 0x05, 0x82, 0x02, 0x01, 0x06, 0x45, 0x85, 0x00, 0x01, 0x2C, 0x06,
+  0x83, 0x02, 0x06, 0x06, 0x61, 0x04, 0x04, 0x0D, 0x19, 0x05, 0x82, 0x02, 0x06, 0x06, 0x22, 0x04,
+  0x00, 0x0D, 0x0C, 0x05, 0x82, 0x02, 0x06, 0x05, 0x89, 0xBF, 0x4D, 0x3A, 0x06, 0x05, 0x82, 0x02,
+  0x05, 0x05, 0x1C, 0x0F, 0x04, 0x5E, 0x06, 0x83, 0x02, 0x05, 0x53, 0x36, 0x04, 0x04, 0x3F, 0x06,
+  0x83, 0x02, 0x05, 0x06, 0x26, 0x00, 0x00, 0x0D, 0x0C, 0x83, 0x02, 0x01, 0x06, 0x27, 0x95, 0x00,
+  0x00, 0x08, 0x88, 0x00, 0x0B, 0x76, 0x06, 0x02, 0x02, 0x05, 0x06, 0x96, 0x04, 0x04, 0x5D, 0x39,
+  0x03, 0x86, 0x01, 0x02, 0x03, 0x1D, 0x15, 0x8A, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x85, 0x01, 0x00,
+  0x03, 0x87, 0x01, 0x0B, 0x03, 0x10, 0xE7, 0x00, 0x00, 0x04, 0x5F, 0x03, 0x01, 0x0A, 0x01, 0x0A,
+  0x83, 0x03, 0x84, 0x01, 0x06, 0x03, 0x16, 0x04, 0x00, 0x00, 0x23, 0x03, 0x82, 0x01, 0x01, 0x03,
+  0x17, 0x82, 0x00, 0x0A, 0x8F, 0x37, 0x03, 0x01, 0x0A, 0x03, 0x07, 0x5B, 0xC0, 0x2F, 0x07, 0x82,
+  0x03, 0x07, 0x07, 0x59, 0x31, 0x00, 0x00, 0x15, 0x07, 0x0A, 0x82, 0x01, 0x01, 0x58, 0x1A, 0x82,
+  0x00, 0x01, 0x29, 0x03, 0x82, 0x01, 0x06, 0x03, 0x35, 0x00, 0x00, 0x04, 0x19, 0x05, 0x82, 0x02,
+  0x01, 0x06, 0x45, 0x85, 0x00, 0x02, 0x0D, 0x0C, 0x05, 0x82, 0x02, 0x05, 0x05, 0x2D, 0xEB, 0x75,
+  0x8E, 0x05, 0x83, 0x02, 0x07, 0x1E, 0x22, 0x04, 0x00, 0x04, 0xBB, 0x06, 0x05, 0x82, 0x02, 0x04,
+  0x05, 0x1E, 0x06, 0x05, 0x05, 0x83, 0x02, 0x05, 0x05, 0x1C, 0x0F, 0x04, 0x45, 0x06, 0x83, 0x02,
+  0x05, 0x05, 0x8E, 0xF2, 0x97, 0x88, 0x05, 0x83, 0x02, 0x05, 0x06, 0x26, 0x00, 0x00, 0x0D, 0x0C,
+  0x83, 0x02, 0x01, 0x06, 0x27, 0x95, 0x00, 0x00, 0x08, 0x88, 0x00, 0x14, 0x20, 0x2A, 0x05, 0x05,
+  0x06, 0x41, 0x0F, 0x00, 0xC2, 0x6E, 0x03, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x03, 0x03, 0x07, 0x12,
+  0x9F, 0x8B, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x83, 0x01, 0x00, 0x0A, 0x87, 0x01, 0x03, 0x03, 0x03,
+  0x10, 0x50, 0x83, 0x00, 0x02, 0x8F, 0x2B, 0x03, 0x85, 0x01, 0x02, 0x03, 0x1F, 0x03, 0x82, 0x01,
+  0x0B, 0x03, 0x16, 0x04, 0x00, 0x00, 0x23, 0x07, 0x03, 0x01, 0x01, 0x03, 0x17, 0x82, 0x00, 0x04,
+  0x09, 0x81, 0x07, 0x03, 0x03, 0x86, 0x01, 0x03, 0x03, 0x03, 0x39, 0x42, 0x82, 0x00, 0x01, 0x15,
+  0x07, 0x83, 0x01, 0x01, 0x58, 0x1A, 0x82, 0x00, 0x10, 0x29, 0x03, 0x03, 0x01, 0x01, 0x07, 0x17,
+  0x00, 0x00, 0x04, 0x19, 0x05, 0x05, 0x02, 0x02, 0x06, 0x45, 0x85, 0x00, 0x03, 0x04, 0x3D, 0x06,
+  0x05, 0x82, 0x02, 0x82, 0x05, 0x02, 0x1E, 0x05, 0x05, 0x82, 0x02, 0x08, 0x06, 0x3C, 0x04, 0x00,
+  0x00, 0x0D, 0x1C, 0x06, 0x05, 0x84, 0x02, 0x83, 0x05, 0x09, 0x02, 0x02, 0x1E, 0x1C, 0x04, 0x00,
+  0x1B, 0x0C, 0x05, 0x05, 0x82, 0x02, 0x02, 0x05, 0x1E, 0x2D, 0x82, 0x05, 0x82, 0x02, 0x05, 0x06,
+  0x4E, 0x00, 0x00, 0x0D, 0x0C, 0x83, 0x02, 0x01, 0x06, 0x27, 0x95, 0x00, 0x00, 0x08, 0x88, 0x00,
+  0x13, 0x04, 0x70, 0x14, 0x14, 0x55, 0x11, 0x00, 0x3E, 0xEC, 0x07, 0x03, 0x01, 0x01, 0x0A, 0x01,
+  0x03, 0x07, 0x3B, 0x63, 0x0B, 0x8C, 0x00, 0x02, 0x13, 0x0E, 0x03, 0x82, 0x01, 0x85, 0x03, 0x00,
+  0x01, 0x82, 0x03, 0x03, 0x07, 0x1D, 0x69, 0x04, 0x83, 0x00, 0x03, 0x09, 0x21, 0x07, 0x03, 0x82,
+  0x01, 0x13, 0x03, 0x03, 0x94, 0xE1, 0x10, 0x03, 0x01, 0x03, 0x07, 0x16, 0x04, 0x00, 0x00, 0x64,
+  0x07, 0x03, 0x03, 0x01, 0x07, 0x17, 0x83, 0x00, 0x04, 0x09, 0x65, 0x38, 0x07, 0x03, 0x84, 0x01,
+  0x03, 0x03, 0x07, 0x47, 0x95, 0x83, 0x00, 0x07, 0x15, 0x37, 0x03, 0x01, 0x03, 0x03, 0x6E, 0x1A,
+  0x82, 0x00, 0x0A, 0x29, 0x07, 0x03, 0x03, 0x01, 0x07, 0x35, 0x00, 0x00, 0x04, 0x19, 0x83, 0x05,
+  0x01, 0x06, 0x45, 0x86, 0x00, 0x03, 0x2C, 0x8A, 0x06, 0x05, 0x82, 0x02, 0x04, 0x05, 0x05, 0x06,
+  0xB7, 0x06, 0x82, 0x05, 0x02, 0x06, 0x18, 0x04, 0x82, 0x00, 0x03, 0x27, 0x25, 0x1E, 0x05, 0x82,
+  0x02, 0x03, 0x05, 0x2D, 0xE9, 0x06, 0x82, 0x05, 0x07, 0x06, 0x8C, 0x04, 0x00, 0x00, 0x4A, 0x24,
+  0x05, 0x82, 0x02, 0x05, 0x05, 0x05, 0x06, 0x88, 0x90, 0x1E, 0x82, 0x05, 0x05, 0x06, 0x76, 0x00,
+  0x00, 0x0D, 0x24, 0x83, 0x05, 0x01, 0x06, 0x27, 0x95, 0x00, 0x00, 0x08, 0x89, 0x00, 0x10, 0x04,
+  0x4F, 0x28, 0x04, 0x00, 0x00, 0x31, 0x65, 0x5F, 0x2F, 0x10, 0x07, 0x10, 0x2F, 0x5F, 0x85, 0x34,
+  0x8E, 0x00, 0x02, 0x34, 0xF4, 0x49, 0x87, 0x12, 0x06, 0x49, 0x12, 0x12, 0x5F, 0x80, 0xB3, 0x0B,
+  0x86, 0x00, 0x02, 0x1A, 0x85, 0x1D, 0x82, 0x07, 0x04, 0x39, 0xCC, 0xA1, 0x3E, 0x16, 0x82, 0x12,
+  0x01, 0x16, 0xCF, 0x82, 0x00, 0x06, 0x51, 0x9B, 0x12, 0x12, 0xBD, 0x16, 0x63, 0x85, 0x00, 0x03,
+  0x13, 0x40, 0x5B, 0x10, 0x82, 0x07, 0x03, 0x38, 0xC0, 0xAE, 0x0B, 0x84, 0x00, 0x02, 0xA2, 0x16,
+  0x49, 0x82, 0x12, 0x01, 0xC4, 0x09, 0x82, 0x00, 0x10, 0x51, 0x16, 0x12, 0x49, 0x12, 0x9B, 0x63,
+  0x00, 0x00, 0x04, 0x6C, 0x18, 0x18, 0x2E, 0x2E, 0x67, 0x7A, 0x87, 0x00, 0x02, 0x11, 0x22, 0x0C,
+  0x82, 0x06, 0x0A, 0x24, 0x19, 0x61, 0xD5, 0xCB, 0x18, 0x2E, 0x18, 0x18, 0x8D, 0x2C, 0x83, 0x00,
+  0x02, 0x4F, 0x3D, 0x0C, 0x82, 0x06, 0x0F, 0x89, 0x79, 0xD5, 0x8D, 0x18, 0x18, 0x54, 0x18, 0xE2,
+  0x04, 0x00, 0x00, 0x04, 0x43, 0x41, 0x24, 0x82, 0x06, 0x0D, 0x0C, 0x3D, 0xAA, 0x61, 0x18, 0x18,
+  0x2E, 0x18, 0x67, 0x93, 0x04, 0x00, 0x09, 0xCB, 0x83, 0x2E, 0x01, 0x67, 0x62, 0x95, 0x00, 0x00,
+  0x08, 0x92, 0x00, 0x04, 0x0B, 0x30, 0x4B, 0x3E, 0x0B, 0x93, 0x00, 0x8B, 0x04, 0x8C, 0x00, 0x04,
+  0x1A, 0xA2, 0x74, 0x15, 0x44, 0x84, 0x00, 0x01, 0x04, 0x04, 0x86, 0x00, 0x82, 0x04, 0x89, 0x00,
+  0x06, 0x09, 0x3E, 0x74, 0x74, 0x15, 0x31, 0x04, 0x88, 0x00, 0x03, 0x04, 0xAB, 0x00, 0x04, 0x86,
+  0x00, 0x02, 0x04, 0x09, 0x04, 0x84, 0x00, 0x85, 0x04, 0x89, 0x00, 0x08, 0x04, 0x0D, 0x28, 0x26,
+  0x27, 0x11, 0x04, 0x04, 0x00, 0x84, 0x04, 0x86, 0x00, 0x07, 0x04, 0x1B, 0x27, 0x26, 0x28, 0x04,
+  0x04, 0x00, 0x84, 0x04, 0x85, 0x00, 0x08, 0x04, 0x11, 0x34, 0x26, 0x28, 0x0D, 0x04, 0x00, 0x00,
+  0x84, 0x04, 0x83, 0x00, 0x85, 0x04, 0x96, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08,
+  0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00,
+  0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00,
+  0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x08,
 };
@@ -0,0 +1,375 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+
+#include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
+#include <TFT_eSPI.h>             // https://github.com/Bodmer/TFT_eSPI
+
+#include "ScreenHistory.h"
+#include "GlobalDefinitions.h"
+#include "Free_Fonts.h"
+#include "Fonts.h"
+
+// External variables
+extern Syslog syslog;
+extern TFT_eSPI LCD;
+
+// How each metric is shown
+struct ChartMetric
+{
+  uint8_t metric;
+  char name[12];
+  char unit[7];
+  uint8_t decimals;
+  uint16_t color;
+  float minimumSpan;                  // Smallest vertical scale, so that noise is not magnified
+};
+
+static const ChartMetric chartMetrics[] PROGMEM =
+{
+  {METRIC_TEMPERATURE, "Temperature", " C", 1, TFT_ORANGE, 2},
+  {METRIC_HUMIDITY, "Humidity", " %", 1, TFT_CYAN, 5},
+  {METRIC_PRESSURE, "Pressure", " hPa", 1, TFT_GREENYELLOW, 4},
+  {METRIC_CO2, "CO2", " ppm", 0, TFT_YELLOW, 100},
+  {METRIC_CO, "CO", " ppm", 2, TFT_PINK, 1},
+  {METRIC_NO2, "NO2", " ppm", 3, TFT_MAGENTA, 0.1},
+  {METRIC_VOC, "VOC", "", 0, TFT_GREEN, 20},
+  {METRIC_PM01, "PM01", " ug/m3", 0, TFT_LIGHTGREY, 10},
+  {METRIC_PM2_5, "PM2.5", " ug/m3", 0, TFT_LIGHTGREY, 10},
+  {METRIC_PM10, "PM10", " ug/m3", 0, TFT_LIGHTGREY, 10},
+  {METRIC_CPM, "CPM", "", 1, TFT_RED, 10},
+  {METRIC_RADIATION, "Radiation", " uSv/h", 3, TFT_RED, 0.05},
+};
+
+#define CHART_METRICS (sizeof(chartMetrics) / sizeof(ChartMetric))
+
+static ChartMetric getChartMetric(uint8_t index)
+{
+  ChartMetric chartMetric;
+  memcpy_P(&chartMetric, &chartMetrics[index], sizeof(ChartMetric));
+  return chartMetric;
+}
+
+void ScreenHistory::activate()
+{
+#ifdef DEBUG_SYSLOG
+  syslog.log(LOG_INFO, F("ScreenHistory::activate()"));
+#endif
+
+  LCD.fillScreen(TFT_BLACK);
+
+  // Nothing drawn yet
+  memset(heights, 0, sizeof(heights));
+  metric = nextMetric;
+  tier = nextTier;
+  scaleValid = false;
+  refreshDue = true;
+
+  drawTitle();
+  drawGrid();
+  drawTimeAxis();
+}
+
+void ScreenHistory::update()
+{
+#ifdef DEBUG_SYSLOG
+  syslog.log(LOG_INFO, F("ScreenHistory::update()"));
+#endif
+
+  unsigned long start = millis();
+
+  // New period closed (or new selection): bring all columns up to date
+  if (refreshDue || history.getUpdates(tier) != shownUpdates)
+    refresh();
+
+  // Only the columns that changed are painted, until the budget is used
+  uint16_t columns = history.getDepth(tier);
+  while (cursor < columns)
+  {
+    drawColumn(cursor++);
+
+    if (millis() - start >= HISTORY_DRAW_BUDGET)
+      return;
+  }
+
+  // Chart erased: switch to the selection, drawn from the next update
+  if (metric != nextMetric || tier != nextTier)
+  {
+    metric = nextMetric;
+    tier = nextTier;
+    scaleValid = false;
+    refreshDue = true;
+
+    drawScale();
+    drawTimeAxis();
+  }
+}
+
+void ScreenHistory::deactivate()
+{
+#ifdef DEBUG_SYSLOG
+  syslog.log(LOG_INFO, F("ScreenHistory::deactivate()"));
+#endif
+}
+
+bool ScreenHistory::onUserEvent(int event)
+{
+  if (event == GES_UP || event == GES_DOWN)
+  {
+    nextMetric = (nextMetric + (event == GES_UP ? 1 : CHART_METRICS - 1)) % CHART_METRICS;
+  }
+  else if (event == GES_BACKWARD)
+  {
+    nextTier = (HistoryTier)((nextTier + 1) % HISTORY_TIERS);
+  }
+  else
+  {
+    // Bubble event
+    return false;
+  }
+
+  // Show the selection now, the chart follows within the drawing budget
+  drawTitle();
+  refreshDue = true;
+  update();
+
+  // Event consumed
+  return true;
+}
+
+long ScreenHistory::getRefreshPeriod()
+{
+  return 500;
+}
+
+String ScreenHistory::getScreenName()
+{
+  return F("HISTORY");
+}
+
+bool ScreenHistory::isFullScreen()
+{
+  return false;
+}
+
+bool ScreenHistory::getRefreshWithScreenOff()
+{
+  return false;
+}
+
+void ScreenHistory::refresh()
+{
+  refreshDue = false;
+  shownUpdates = history.getUpdates(tier);
+
+  // Restart from the leftmost column (unchanged ones cost no drawing)
+  cursor = 0;
+
+  // While erasing, scale and value are those of the current chart
+  if (metric == nextMetric && tier == nextTier)
+  {
+    rescale();
+    drawValue();
+  }
+}
+
+// Adjusts the vertical scale to the data, keeping it unless values leave it or use too little of it
+void ScreenHistory::rescale()
+{
+  ChartMetric chartMetric = getChartMetric(metric);
+  float minimum, maximum;
+
+  if (!history.getRange(tier, (SampleMetric)chartMetric.metric, history.getDepth(tier), minimum, maximum))
+  {
+    if (scaleValid)
+    {
+      scaleValid = false;
+      drawScale();
+    }
+    return;
+  }
+
+  // 10% margin above and below
+  float span = max(maximum - minimum, chartMetric.minimumSpan) * 1.2;
+
+  if (scaleValid && minimum >= scaleMin && maximum <= scaleMax && scaleMax - scaleMin <= span * 2)
+    return;
+
+  scaleMin = (minimum + maximum - span) / 2;
+  scaleMax = scaleMin + span;
+
+  // No negative values for metrics that have none
+  if (scaleMin < 0 && minimum >= 0)
+  {
+    scaleMax -= scaleMin;
+    scaleMin = 0;
+  }
+
+  scaleValid = true;
+  drawScale();
+}
+
+// Paints the difference between the drawn column and its current value
+void ScreenHistory::drawColumn(uint16_t column)
+{
+  uint8_t height = columnHeight(column);
+  uint8_t drawn = heights[column];
+
+  if (height == drawn)
+    return;
+
+  uint8_t width = columnWidth();
+  int xpos = HISTORY_CHART_LEFT + HISTORY_CHART_WIDTH - (history.getDepth(tier) - column) * width;
+
+  if (height > drawn)
+  {
+    LCD.fillRect(xpos, HISTORY_CHART_BOTTOM - height, width, height - drawn, getChartMetric(metric).color);
+  }
+  else
+  {
+    LCD.fillRect(xpos, HISTORY_CHART_BOTTOM - drawn, width, drawn - height, TFT_BLACK);
+
+    // Restore the grid lines that were under the column
+    for (int line = 0; line < 4; line++)
+    {
+      int ypos = HISTORY_CHART_TOP + line * HISTORY_CHART_HEIGHT / 4;
+      if (ypos >= HISTORY_CHART_BOTTOM - drawn && ypos < HISTORY_CHART_BOTTOM - height)
+        LCD.drawFastHLine(xpos, ypos, width, HISTORY_GRID_COLOR);
+    }
+  }
+
+  heights[column] = height;
+}
+
+// Pixels for the value of a column, 0 if none (or while erasing the chart)
+uint8_t ScreenHistory::columnHeight(uint16_t column)
+{
+  if (metric != nextMetric || tier != nextTier || !scaleValid)
+    return 0;
+
+  uint16_t age = history.getDepth(tier) - 1 - column;
+  float value = history.getValue(tier, (SampleMetric)getChartMetric(metric).metric, age);
+  if (isnan(value))
+    return 0;
+
+  int height = 1 + round((value - scaleMin) * (HISTORY_CHART_HEIGHT - 1) / (scaleMax - scaleMin));
+  return constrain(height, 1, HISTORY_CHART_HEIGHT);
+}
+
+uint8_t ScreenHistory::columnWidth()
+{
+  return HISTORY_CHART_WIDTH / history.getDepth(tier);
+}
+
+void ScreenHistory::drawTitle()
+{
+  ChartMetric chartMetric = getChartMetric(nextMetric);
+
+  LCD.setFreeFont(&Dialog_plain_15);
+  LCD.setTextColor(TFT_YELLOW, TFT_BLACK);
+  LCD.setTextDatum(TL_DATUM);
+  LCD.setTextPadding(120);
+  LCD.drawString(chartMetric.name, 5, TOP_BAR_HEIGHT + 6, GFXFF);
+
+  LCD.setTextColor(TFT_WHITE, TFT_BLACK);
+  LCD.setTextDatum(TR_DATUM);
+  LCD.setTextPadding(110);
+  switch (nextTier)
+  {
+    case TIER_MINUTE:
+      LCD.drawString(F("Last hour"), 235, TOP_BAR_HEIGHT + 6, GFXFF);
+      break;
+
+    case TIER_QUARTER:
+      LCD.drawString(F("Last day"), 235, TOP_BAR_HEIGHT + 6, GFXFF);
+      break;
+
+    default:
+      LCD.drawString(F("Last week"), 235, TOP_BAR_HEIGHT + 6, GFXFF);
+      break;
+  }
+  LCD.setTextPadding(0);
+}
+
+// Last completed period
+void ScreenHistory::drawValue()
+{
+  ChartMetric chartMetric = getChartMetric(metric);
+  float value = history.getValue(tier, (SampleMetric)chartMetric.metric, 0);
+
+  LCD.setFreeFont(&Dialog_plain_15);
+  LCD.setTextColor(chartMetric.color, TFT_BLACK);
+  LCD.setTextDatum(TL_DATUM);
+  LCD.setTextPadding(230);
+
+  if (isnan(value))
+    LCD.drawString(F("No data yet"), 5, TOP_BAR_HEIGHT + 26, GFXFF);
+  else
+    LCD.drawString(String(value, chartMetric.decimals) + chartMetric.unit, 5, TOP_BAR_HEIGHT + 26, GFXFF);
+
+  LCD.setTextPadding(0);
+}
+
+// Values of the grid lines
+void ScreenHistory::drawScale()
+{
+  ChartMetric chartMetric = getChartMetric(metric);
+
+  LCD.setFreeFont(&Dialog_plain_9);
+  LCD.setTextColor(TFT_WHITE, TFT_BLACK);
+  LCD.setTextDatum(MR_DATUM);
+  LCD.setTextPadding(HISTORY_CHART_LEFT - 4);
+
+  for (int line = 0; line <= 4; line++)
+  {
+    int ypos = HISTORY_CHART_TOP + line * HISTORY_CHART_HEIGHT / 4;
+    float value = scaleMax - line * (scaleMax - scaleMin) / 4;
+
+    if (scaleValid)
+      LCD.drawString(String(value, chartMetric.decimals), HISTORY_CHART_LEFT - 3, ypos);
+    else
+      LCD.drawString(F(" "), HISTORY_CHART_LEFT - 3, ypos);
+  }
+  LCD.setTextPadding(0);
+}
+
+void ScreenHistory::drawTimeAxis()
+{
+  int ypos = HISTORY_CHART_BOTTOM + 4;
+  int xpos = HISTORY_CHART_LEFT + HISTORY_CHART_WIDTH - history.getDepth(tier) * columnWidth();
+
+  LCD.fillRect(0, ypos, LCD.width(), 12, TFT_BLACK);
+
+  LCD.setFreeFont(&Dialog_plain_9);
+  LCD.setTextColor(TFT_WHITE, TFT_BLACK);
+  LCD.setTextDatum(TL_DATUM);
+  switch (tier)
+  {
+    case TIER_MINUTE:
+      LCD.drawString(F("-60 min"), xpos, ypos);
+      break;
+
+    case TIER_QUARTER:
+      LCD.drawString(F("-24 h"), xpos, ypos);
+      break;
+
+    default:
+      LCD.drawString(F("-7 days"), xpos, ypos);
+      break;
+  }
+
+  LCD.setTextDatum(TR_DATUM);
+  LCD.drawString(F("now"), HISTORY_CHART_LEFT + HISTORY_CHART_WIDTH, ypos);
+}
+
+void ScreenHistory::drawGrid()
+{
+  for (int line = 0; line < 4; line++)
+    LCD.drawFastHLine(HISTORY_CHART_LEFT, HISTORY_CHART_TOP + line * HISTORY_CHART_HEIGHT / 4, HISTORY_CHART_WIDTH, HISTORY_GRID_COLOR);
+
+  LCD.drawFastHLine(HISTORY_CHART_LEFT, HISTORY_CHART_BOTTOM, HISTORY_CHART_WIDTH, TFT_RED);
+}
@@ -0,0 +1,69 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Screen.h"
+#include "History.h"
+
+// Chart area (pixels)
+#define HISTORY_CHART_LEFT 44
+#define HISTORY_CHART_WIDTH 192       // NOTE: 3, 2 and 1 pixels per minute, quarter and hour
+#define HISTORY_CHART_TOP 120
+#define HISTORY_CHART_HEIGHT 168
+#define HISTORY_CHART_BOTTOM (HISTORY_CHART_TOP + HISTORY_CHART_HEIGHT)
+#define HISTORY_GRID_COLOR 0x5AEB
+
+// Drawing time per update (ms), the rest continues on the next one
+#define HISTORY_DRAW_BUDGET 20
+
+// History graph of one sensor metric, as an area chart with the newest period on the right.
+// UP / DOWN cycle the metrics, BACKWARD cycles the tiers (last hour, day, week).
+// Each column remembers its drawn height: new periods, rescaling and metric changes only
+// paint the difference, a few columns at a time within the drawing budget.
+class ScreenHistory: public Screen
+{
+  public:
+    ScreenHistory() {}
+    virtual ~ScreenHistory() {}
+    virtual void activate();
+    virtual void update();
+    virtual void deactivate();
+    virtual bool onUserEvent(int event);
+    virtual long getRefreshPeriod();
+    virtual String getScreenName();
+    virtual bool isFullScreen();
+    virtual bool getRefreshWithScreenOff();
+
+  private:
+    uint8_t metric = 0;               // Into the metrics table
+    HistoryTier tier = TIER_MINUTE;
+
+    // Selection from the gestures: columns are erased first, then the chart switches to it
+    uint8_t nextMetric = 0;
+    HistoryTier nextTier = TIER_MINUTE;
+
+    uint8_t heights[HISTORY_HOURS];   // Drawn, per column (0 = empty)
+    uint16_t cursor = 0;              // Next column to bring up to date
+    uint32_t shownUpdates = 0;        // Periods of the tier when last refreshed
+    bool refreshDue = true;
+
+    float scaleMin = 0;
+    float scaleMax = 0;
+    bool scaleValid = false;
+
+    void refresh();
+    void rescale();
+    void drawColumn(uint16_t column);
+    uint8_t columnHeight(uint16_t column);
+    uint8_t columnWidth();
+    void drawTitle();
+    void drawValue();
+    void drawScale();
+    void drawTimeAxis();
+    void drawGrid();
+};
@@ -45,7 +45,7 @@ void ScreenLowbatt::activate()
   LCD.drawString(String(F("Shutdown at ")) + String(timeNow), 120, 280, GFXFF);
 
   // Show low battery graphics
-  ui.drawBitmap(batteryLowIcon, (LCD.width() - batteryLowWidth) / 2, 60, batteryLowWidth, batteryLowHeight);
+  ui.drawPackedBitmap(batteryLowIcon, (LCD.width() - batteryLowWidth) / 2, 60);
 
   syslog.log(LOG_CRIT, F("***** LOW BATTERY - SYSTEM HALTED"));
 
@@ -38,1704 +38,575 @@ class ScreenLowbatt: public Screen
 const uint16_t batteryLowWidth = 185;
 const uint16_t batteryLowHeight = 147;
 
-const unsigned short batteryLowIcon[27195] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x0010 (16) pixels
-  0x0841, 0x0841, 0x0020, 0x0020, 0x0820, 0x0020, 0x0020, 0x0020, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0030 (48) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0040 (64) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0050 (80) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0060 (96) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0070 (112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0080 (128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0090 (144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841,   // 0x00A0 (160) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x00B0 (176) pixels
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x00C0 (192) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0821, 0x0820,   // 0x00D0 (208) pixels
-  0x0820, 0x0800, 0x0800, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00E0 (224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00F0 (240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0100 (256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0110 (272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0120 (288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0130 (304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0140 (320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,   // 0x0150 (336) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861,   // 0x0160 (352) pixels
-  0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0170 (368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x0180 (384) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820,   // 0x0190 (400) pixels
-  0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01A0 (416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01B0 (432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01C0 (448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01D0 (464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01E0 (480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01F0 (496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0200 (512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861,   // 0x0210 (528) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x0861, 0x1082, 0x1082, 0x0862, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841,   // 0x0220 (544) pixels
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x0230 (560) pixels
-  0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061,   // 0x0240 (576) pixels
-  0x1041, 0x1041, 0x1041, 0x1041, 0x1020, 0x0820, 0x0820, 0x0820, 0x0820, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000,   // 0x0250 (592) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0260 (608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0270 (624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0280 (640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0290 (656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02A0 (672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02B0 (688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x02C0 (704) pixels
-  0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x02D0 (720) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1062, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000,   // 0x02E0 (736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082,   // 0x02F0 (752) pixels
-  0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x18A2, 0x1882, 0x1862, 0x1861, 0x1041, 0x1841, 0x1841, 0x1841, 0x1020, 0x1020,   // 0x0300 (768) pixels
-  0x1020, 0x1020, 0x1000, 0x1000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0310 (784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0320 (800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0330 (816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0340 (832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0350 (848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0360 (864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0370 (880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0021, 0x0021, 0x0021, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,   // 0x0380 (896) pixels
-  0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082,   // 0x0390 (912) pixels
-  0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841,   // 0x03A0 (928) pixels
-  0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18A2,   // 0x03B0 (944) pixels
-  0x20A2, 0x2082, 0x2062, 0x2061, 0x2061, 0x2041, 0x2040, 0x2040, 0x1820, 0x1820, 0x1800, 0x1800, 0x1800, 0x1000, 0x1000, 0x0800,   // 0x03C0 (960) pixels
-  0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03D0 (976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03E0 (992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03F0 (1008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0400 (1024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0410 (1040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0420 (1056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0430 (1072) pixels
-  0x0020, 0x0020, 0x0021, 0x0841, 0x0841, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A3, 0x18C3, 0x18E3, 0x10A2,   // 0x0440 (1088) pixels
-  0x18C3, 0x10A2, 0x10A2, 0x10A3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841,   // 0x0450 (1104) pixels
-  0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x10A2,   // 0x0460 (1120) pixels
-  0x10A2, 0x18C3, 0x18E3, 0x2945, 0x39E7, 0x4208, 0x4208, 0x4208, 0x49C7, 0x4165, 0x30C2, 0x3082, 0x3061, 0x3061, 0x3060, 0x3040,   // 0x0470 (1136) pixels
-  0x3040, 0x3020, 0x2820, 0x2820, 0x2820, 0x2800, 0x2020, 0x1820, 0x1820, 0x1020, 0x0841, 0x0841, 0x0821, 0x0841, 0x0841, 0x0021,   // 0x0480 (1152) pixels
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,   // 0x0490 (1168) pixels
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,   // 0x04A0 (1184) pixels
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,   // 0x04B0 (1200) pixels
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,   // 0x04C0 (1216) pixels
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,   // 0x04D0 (1232) pixels
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,   // 0x04E0 (1248) pixels
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0841, 0x0841, 0x0841, 0x0862, 0x0882, 0x1082,   // 0x04F0 (1264) pixels
-  0x10A2, 0x10A3, 0x10C3, 0x18C3, 0x18C3, 0x18E4, 0x18E4, 0x2104, 0x31A7, 0x39C7, 0x31C7, 0x31A7, 0x2986, 0x2125, 0x18E3, 0x18C3,   // 0x0500 (1280) pixels
-  0x18C3, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020,   // 0x0510 (1296) pixels
-  0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2104, 0x31A6, 0x738E, 0x9CD3, 0xA514, 0x9CF4,   // 0x0520 (1312) pixels
-  0xA4F3, 0xA450, 0x7AAA, 0x7A48, 0x7A07, 0x79E7, 0x79E6, 0x79C6, 0x79C6, 0x79C6, 0x71C6, 0x71C6, 0x71A6, 0x71A6, 0x71C6, 0x69C6,   // 0x0530 (1328) pixels
-  0x61C6, 0x51C7, 0x41C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x0540 (1344) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x0550 (1360) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x0560 (1376) pixels
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7,   // 0x0570 (1392) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,   // 0x0580 (1408) pixels
-  0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x0590 (1424) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,   // 0x05A0 (1440) pixels
-  0x39E7, 0x39E8, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4229, 0x4A49, 0x4A49, 0x4A69, 0x4A6A, 0x528A, 0x528A, 0x52AA, 0x52AB,   // 0x05B0 (1456) pixels
-  0x4A6A, 0x6B6E, 0x7C10, 0x7BF0, 0x7BF0, 0x738F, 0x5ACB, 0x2945, 0x18E3, 0x18E3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x0861,   // 0x05C0 (1472) pixels
-  0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x05D0 (1488) pixels
-  0x18C3, 0x18E3, 0x2104, 0x2945, 0x5ACB, 0x9492, 0x9CF3, 0x9CF3, 0xA514, 0xACF3, 0xB3EF, 0x9269, 0xA268, 0x99E7, 0x91C6, 0x91C6,   // 0x05E0 (1504) pixels
-  0x91C6, 0x91C6, 0x91A6, 0x91A5, 0x91A5, 0x91A5, 0x91A5, 0x89A6, 0x89C6, 0x71A5, 0x51A6, 0x3986, 0x3186, 0x31A6, 0x31A6, 0x31A6,   // 0x05F0 (1520) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x0600 (1536) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x0610 (1552) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x0620 (1568) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x0630 (1584) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x0640 (1600) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x0650 (1616) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A7, 0x31A7, 0x31A7, 0x31C7, 0x39C7, 0x39C7, 0x39E7, 0x39E8, 0x39E8,   // 0x0660 (1632) pixels
-  0x4208, 0x4208, 0x4229, 0x4249, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x5AEC, 0x5AEB, 0x5AEC, 0x6B8E, 0x636E, 0x636E, 0x632D, 0x632D,   // 0x0670 (1648) pixels
-  0x4249, 0x2124, 0x2104, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x0680 (1664) pixels
-  0x0000, 0x0841, 0x0841, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x2104, 0x2945, 0x31A6, 0x6B6D, 0x8410, 0x8430,   // 0x0690 (1680) pixels
-  0x8C51, 0x8C51, 0x9C0F, 0xAB0B, 0xAA48, 0xB227, 0xB206, 0xB206, 0xB206, 0xB1E6, 0xB1E6, 0xB1E6, 0xB1E6, 0xB1E6, 0xB1E6, 0xB1E6,   // 0x06A0 (1696) pixels
-  0xA9E6, 0xA9E6, 0x9206, 0x4924, 0x28E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x06B0 (1712) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x06C0 (1728) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x06D0 (1744) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x06E0 (1760) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x06F0 (1776) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x0700 (1792) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2104, 0x2104, 0x2124,   // 0x0710 (1808) pixels
-  0x2124, 0x2124, 0x2125, 0x2125, 0x2945, 0x2945, 0x2945, 0x2966, 0x2986, 0x3186, 0x31A6, 0x39C7, 0x39E7, 0x39E8, 0x4208, 0x4228,   // 0x0720 (1824) pixels
-  0x528A, 0x5AEC, 0x632C, 0x5B0C, 0x634D, 0x5B0C, 0x52EC, 0x52CB, 0x52EC, 0x5AEC, 0x2965, 0x2125, 0x2104, 0x18E4, 0x18C3, 0x18C3,   // 0x0730 (1840) pixels
-  0x10A2, 0x1082, 0x1082, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0841, 0x0841, 0x0861, 0x1082, 0x10A2, 0x18C3,   // 0x0740 (1856) pixels
-  0x18E3, 0x2104, 0x2124, 0x2945, 0x2966, 0x4228, 0x6B4D, 0x5AEB, 0x52AA, 0x52AA, 0x5ACB, 0x72AA, 0x9A68, 0xB227, 0xB9E6, 0xB9A5,   // 0x0750 (1872) pixels
-  0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB1A5, 0x99C5, 0x50C2, 0x1800, 0x1020, 0x0821,   // 0x0760 (1888) pixels
-  0x0820, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x0770 (1904) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x0780 (1920) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x0790 (1936) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x07A0 (1952) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x07B0 (1968) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x07C0 (1984) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082,   // 0x07D0 (2000) pixels
-  0x10A2, 0x10C2, 0x18C3, 0x18E3, 0x2104, 0x2125, 0x2945, 0x2965, 0x31A6, 0x4228, 0x5AEB, 0x630C, 0x5B0C, 0x4A6A, 0x29A7, 0x2986,   // 0x07E0 (2016) pixels
-  0x2166, 0x2966, 0x4A8A, 0x39E7, 0x2945, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841,   // 0x07F0 (2032) pixels
-  0x0020, 0x0020, 0x0000, 0x0841, 0x0861, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2124, 0x2945, 0x3186, 0x39C7, 0x528A, 0x630C,   // 0x0800 (2048) pixels
-  0x4A69, 0x4A69, 0x4A69, 0x526A, 0x6A69, 0xA248, 0xBA06, 0xB9C5, 0xB9A4, 0xB984, 0xB983, 0xB983, 0xB983, 0xB984, 0xB984, 0xB984,   // 0x0810 (2064) pixels
-  0xB984, 0xB984, 0xB184, 0xB164, 0x9143, 0x60E3, 0x2000, 0x1000, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0820 (2080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0830 (2096) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0840 (2112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0850 (2128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0860 (2144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0870 (2160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020,   // 0x0880 (2176) pixels
-  0x0020, 0x0020, 0x0020, 0x0821, 0x0841, 0x0841, 0x0861, 0x0861, 0x1081, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x2104, 0x2125, 0x2965,   // 0x0890 (2192) pixels
-  0x2965, 0x39C7, 0x4A49, 0x6B6D, 0x73AE, 0x6B6E, 0x52CB, 0x39E8, 0x31C7, 0x2987, 0x2966, 0x3A28, 0x4229, 0x2986, 0x2965, 0x2945,   // 0x08A0 (2208) pixels
-  0x2124, 0x2104, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082, 0x10A2,   // 0x08B0 (2224) pixels
-  0x18C3, 0x18E3, 0x2104, 0x2945, 0x3186, 0x39C7, 0x4208, 0x632C, 0x630C, 0x528A, 0x5ACB, 0x52AA, 0x5AAA, 0x72AA, 0xAA48, 0xC206,   // 0x08C0 (2240) pixels
-  0xC1C5, 0xB984, 0xB163, 0xB163, 0xB163, 0xB163, 0xB163, 0xB184, 0xB184, 0xB163, 0xB163, 0xB164, 0xA963, 0x9164, 0x6903, 0x2800,   // 0x08D0 (2256) pixels
-  0x1820, 0x0820, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08E0 (2272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08F0 (2288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0900 (2304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0910 (2320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0920 (2336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0930 (2352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841,   // 0x0940 (2368) pixels
-  0x0861, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2124, 0x2945, 0x2965, 0x3186, 0x4208, 0x4A69, 0x73AE, 0x8430, 0x73AF, 0x632D,   // 0x0950 (2384) pixels
-  0x4249, 0x3A29, 0x39E8, 0x31E8, 0x3A08, 0x4A8A, 0x31A7, 0x3186, 0x2965, 0x2124, 0x2104, 0x18E3, 0x10A2, 0x10A2, 0x1082, 0x0861,   // 0x0960 (2400) pixels
-  0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2124, 0x2965, 0x31A6, 0x39E8, 0x4A69,   // 0x0970 (2416) pixels
-  0x738E, 0x632C, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x82EB, 0xB268, 0xCA06, 0xC1C5, 0xB984, 0xB163, 0xB184, 0xB183, 0xB183, 0xB183,   // 0x0980 (2432) pixels
-  0xB183, 0xB184, 0xB164, 0xB164, 0xA963, 0xA963, 0x9163, 0x7123, 0x3820, 0x1820, 0x1020, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000,   // 0x0990 (2448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09A0 (2464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09B0 (2480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09C0 (2496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09D0 (2512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09E0 (2528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09F0 (2544) pixels
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2104, 0x2124,   // 0x0A00 (2560) pixels
-  0x2945, 0x3186, 0x39C7, 0x4228, 0x528A, 0x7BCF, 0x8C51, 0x8410, 0x6B8E, 0x52AB, 0x4A8A, 0x4249, 0x4249, 0x3A28, 0x52AA, 0x39E7,   // 0x0A10 (2576) pixels
-  0x31A6, 0x2965, 0x2945, 0x2104, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0861, 0x0861,   // 0x0A20 (2592) pixels
-  0x1082, 0x10A3, 0x18C3, 0x2104, 0x2124, 0x2965, 0x39C7, 0x4229, 0x52AB, 0x7BCF, 0x6B6D, 0x6B4D, 0x6B6D, 0x738D, 0x736D, 0x936D,   // 0x0A30 (2608) pixels
-  0xBA88, 0xCA07, 0xC9E5, 0xC1A4, 0xB963, 0xB164, 0xB163, 0xB164, 0xB164, 0xB163, 0xB183, 0xB163, 0xB164, 0xA964, 0xA984, 0x9963,   // 0x0A40 (2624) pixels
-  0x7943, 0x4040, 0x2020, 0x1020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A50 (2640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A60 (2656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A70 (2672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A80 (2688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A90 (2704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AA0 (2720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0021,   // 0x0AB0 (2736) pixels
-  0x0041, 0x0841, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2104, 0x2945, 0x2965, 0x31A7, 0x39E7, 0x4A49, 0x52AA, 0x7C0F, 0x8C72,   // 0x0AC0 (2752) pixels
-  0x8431, 0x7BF0, 0x5B0D, 0x5B0C, 0x52EC, 0x52CB, 0x4269, 0x5AEB, 0x4208, 0x39C7, 0x3186, 0x2965, 0x2124, 0x2104, 0x18C3, 0x10A2,   // 0x0AD0 (2768) pixels
-  0x10A2, 0x1082, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A3, 0x18E3, 0x2104, 0x2945, 0x3186, 0x39E8,   // 0x0AE0 (2784) pixels
-  0x4A69, 0x630C, 0x8410, 0x7BEF, 0x8430, 0x8C71, 0x9491, 0x9471, 0xA3EE, 0xBACA, 0xD268, 0xD226, 0xC1C5, 0xB984, 0xB984, 0xB984,   // 0x0AF0 (2800) pixels
-  0xB984, 0xB984, 0xB984, 0xB984, 0xB984, 0xB984, 0xB184, 0xB184, 0xA164, 0x8984, 0x6964, 0x51A6, 0x41A6, 0x39A6, 0x39C6, 0x39A7,   // 0x0B00 (2816) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A7, 0x31A7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x0B10 (2832) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A7,   // 0x0B20 (2848) pixels
-  0x31A6, 0x31A7, 0x31A7, 0x31A7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A7, 0x31A7, 0x31A7, 0x31A6, 0x31A7, 0x31A6, 0x31A6,   // 0x0B30 (2864) pixels
-  0x31A6, 0x31A7, 0x31A7, 0x31A7, 0x31A6, 0x31A7, 0x31A7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A7, 0x31A6, 0x31A7, 0x31A7, 0x31A7,   // 0x0B40 (2880) pixels
-  0x31A6, 0x31A7, 0x31A7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A7, 0x31A7,   // 0x0B50 (2896) pixels
-  0x31A6, 0x31A7, 0x31A7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x0B60 (2912) pixels
-  0x31A6, 0x31A7, 0x31A7, 0x31A6, 0x31A6, 0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x39E7, 0x39E8, 0x4208, 0x4208, 0x4229, 0x4A49, 0x4A6A,   // 0x0B70 (2928) pixels
-  0x528A, 0x52AB, 0x5AEB, 0x630C, 0x6B4D, 0x738E, 0x7BCF, 0x9492, 0x9CD3, 0x9492, 0x94B2, 0xAD96, 0xB5B7, 0xAD96, 0x9D35, 0x73AF,   // 0x0B80 (2944) pixels
-  0x632D, 0x4A49, 0x39E7, 0x31A6, 0x2965, 0x2945, 0x2104, 0x18E3, 0x18C3, 0x1082, 0x1082, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020,   // 0x0B90 (2960) pixels
-  0x0861, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2124, 0x2945, 0x31A6, 0x4208, 0x52AA, 0x6B4D, 0x8C71, 0xBDD7, 0xEF7D, 0xF79E, 0xF77D,   // 0x0BA0 (2976) pixels
-  0xF75D, 0xC513, 0xCBAE, 0xEB8D, 0xE30A, 0xDA68, 0xD227, 0xDA26, 0xDA26, 0xDA26, 0xD206, 0xDA26, 0xD206, 0xD206, 0xD1E6, 0xD1E6,   // 0x0BB0 (2992) pixels
-  0xC9E5, 0xB1C4, 0x99A5, 0x8A07, 0x7249, 0x628A, 0x5A8A, 0x528A, 0x528A, 0x528A, 0x528A, 0x4A8A, 0x528A, 0x528A, 0x528A, 0x528A,   // 0x0BC0 (3008) pixels
-  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A,   // 0x0BD0 (3024) pixels
-  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A,   // 0x0BE0 (3040) pixels
-  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A,   // 0x0BF0 (3056) pixels
-  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A,   // 0x0C00 (3072) pixels
-  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A,   // 0x0C10 (3088) pixels
-  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AB, 0x52AB,   // 0x0C20 (3104) pixels
-  0x52AB, 0x52AB, 0x5ACB, 0x5ACB, 0x5AEC, 0x5AEC, 0x630C, 0x632D, 0x6B4D, 0x6B6D, 0x738E, 0x73AF, 0x7BCF, 0x8410, 0x8431, 0x8C72,   // 0x0C30 (3120) pixels
-  0x9CF3, 0xA514, 0x9CD3, 0xA514, 0xE75D, 0xF7DF, 0xF7DF, 0xF7BF, 0xD69A, 0x73AF, 0x4A69, 0x39E8, 0x31A6, 0x2965, 0x2945, 0x2124,   // 0x0C40 (3136) pixels
-  0x18E3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2124, 0x2965,   // 0x0C50 (3152) pixels
-  0x39C7, 0x4228, 0x52AA, 0x738E, 0x9CF3, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xC4D3, 0xDC30, 0xF40F, 0xE34C, 0xE2A9, 0xDA68,   // 0x0C60 (3168) pixels
-  0xE247, 0xE247, 0xE247, 0xE247, 0xE227, 0xDA27, 0xDA06, 0xD9E6, 0xD1E6, 0xD1E5, 0xC1C5, 0xA9C5, 0x91E6, 0x7228, 0x6269, 0x5A69,   // 0x0C70 (3184) pixels
-  0x5269, 0x5269, 0x4A69, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A,   // 0x0C80 (3200) pixels
-  0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A,   // 0x0C90 (3216) pixels
-  0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A,   // 0x0CA0 (3232) pixels
-  0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A,   // 0x0CB0 (3248) pixels
-  0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A,   // 0x0CC0 (3264) pixels
-  0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A6A,   // 0x0CD0 (3280) pixels
-  0x4A6A, 0x4A69, 0x4A6A, 0x4A8A, 0x4A6A, 0x4A6A, 0x4A8A, 0x4A8A, 0x528A, 0x4A8A, 0x528A, 0x52AB, 0x52AB, 0x5ACB, 0x5AEC, 0x5AEC,   // 0x0CE0 (3296) pixels
-  0x630C, 0x632C, 0x6B4D, 0x6B6E, 0x738E, 0x7BCF, 0x8410, 0x8431, 0x8C72, 0x9CD3, 0xA514, 0x9CF4, 0xA534, 0xE71C, 0xF7DF, 0xF7BF,   // 0x0CF0 (3312) pixels
-  0xF7BF, 0xEF7E, 0x8C72, 0x4A6A, 0x4208, 0x39C7, 0x3186, 0x2945, 0x2104, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841,   // 0x0D00 (3328) pixels
-  0x0020, 0x0020, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2124, 0x2965, 0x31A6, 0x4228, 0x52AA, 0x738E, 0xAD55, 0xEF7D, 0xFFFF,   // 0x0D10 (3344) pixels
-  0xFFFF, 0xFFFF, 0xFF9E, 0xBCB2, 0xD430, 0xEC0F, 0xE34C, 0xE2EA, 0xE2A9, 0xE289, 0xE289, 0xE288, 0xE268, 0xE268, 0xE267, 0xE227,   // 0x0D20 (3360) pixels
-  0xDA06, 0xDA06, 0xDA06, 0xC9C5, 0xB1A5, 0x91C6, 0x7228, 0x6269, 0x5A69, 0x5269, 0x5269, 0x4A69, 0x4A49, 0x4A49, 0x4A69, 0x4A69,   // 0x0D30 (3376) pixels
-  0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69,   // 0x0D40 (3392) pixels
-  0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69,   // 0x0D50 (3408) pixels
-  0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69,   // 0x0D60 (3424) pixels
-  0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69,   // 0x0D70 (3440) pixels
-  0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69,   // 0x0D80 (3456) pixels
-  0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A, 0x4A69, 0x4A69, 0x4A6A,   // 0x0D90 (3472) pixels
-  0x4A6A, 0x4A8A, 0x4A8A, 0x4A8A, 0x528A, 0x52AB, 0x52CB, 0x5ACB, 0x5AEC, 0x5B0C, 0x632C, 0x634D, 0x6B6E, 0x738E, 0x73CF, 0x7C10,   // 0x0DA0 (3488) pixels
-  0x8430, 0x8C71, 0x9CD3, 0x9CF4, 0x9CF3, 0xA534, 0xE71C, 0xFFDF, 0xF7BF, 0xF7BF, 0xF79E, 0x94B2, 0x4A6A, 0x4208, 0x39C7, 0x3186,   // 0x0DB0 (3504) pixels
-  0x2965, 0x2124, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18E3,   // 0x0DC0 (3520) pixels
-  0x2124, 0x2945, 0x31A6, 0x4208, 0x528A, 0x738E, 0xAD75, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xBC92, 0xDC30, 0xEBEF, 0xE32C,   // 0x0DD0 (3536) pixels
-  0xE2EA, 0xE2A9, 0xE2A9, 0xE289, 0xE288, 0xE268, 0xE268, 0xE267, 0xE227, 0xDA06, 0xDA06, 0xDA06, 0xC9C5, 0xB1A5, 0x99C6, 0x7207,   // 0x0DE0 (3552) pixels
-  0x5A49, 0x5249, 0x5249, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249,   // 0x0DF0 (3568) pixels
-  0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249,   // 0x0E00 (3584) pixels
-  0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249,   // 0x0E10 (3600) pixels
-  0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249,   // 0x0E20 (3616) pixels
-  0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249,   // 0x0E30 (3632) pixels
-  0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A49, 0x4A49, 0x4A49,   // 0x0E40 (3648) pixels
-  0x4A49, 0x4A49, 0x4A49, 0x4249, 0x4249, 0x4A69, 0x4A69, 0x4249, 0x4A69, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A8A, 0x528A, 0x52AB, 0x52AA,   // 0x0E50 (3664) pixels
-  0x52CB, 0x5ACB, 0x5AEC, 0x630C, 0x632D, 0x6B4D, 0x6B6E, 0x73AF, 0x7BF0, 0x7C10, 0x8C51, 0x94B2, 0x94B3, 0x94B3, 0x9CF4, 0xDEFB,   // 0x0E60 (3680) pixels
-  0xF7DF, 0xF7BF, 0xF7BF, 0xEF9E, 0x9CD3, 0x4A69, 0x3A08, 0x39C7, 0x3186, 0x2965, 0x2124, 0x2104, 0x18C3, 0x10A2, 0x1082, 0x0861,   // 0x0E70 (3696) pixels
-  0x0861, 0x0841, 0x0020, 0x0020, 0x0861, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x2104, 0x2945, 0x3186, 0x39E7, 0x528A, 0x73AE, 0xB5B6,   // 0x0E80 (3712) pixels
-  0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF73C, 0xB430, 0xDC10, 0xF3CE, 0xE30B, 0xE2CA, 0xE2A9, 0xE288, 0xE288, 0xE288, 0xE268, 0xE268,   // 0x0E90 (3728) pixels
-  0xE247, 0xDA26, 0xD9E6, 0xDA06, 0xDA26, 0xC9E5, 0xB9A5, 0xA1C6, 0x7207, 0x6249, 0x5249, 0x4A49, 0x4A49, 0x4A49, 0x4249, 0x4249,   // 0x0EA0 (3744) pixels
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249,   // 0x0EB0 (3760) pixels
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249,   // 0x0EC0 (3776) pixels
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249,   // 0x0ED0 (3792) pixels
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249,   // 0x0EE0 (3808) pixels
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249,   // 0x0EF0 (3824) pixels
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4A49, 0x4249, 0x4249, 0x4249,   // 0x0F00 (3840) pixels
-  0x4249, 0x4A49, 0x4A49, 0x4A49, 0x4A6A, 0x4A6A, 0x4A6A, 0x4A8A, 0x528A, 0x52AB, 0x52CB, 0x5ACB, 0x5AEC, 0x630C, 0x632D, 0x6B6E,   // 0x0F10 (3856) pixels
-  0x73AF, 0x7BCF, 0x7BEF, 0x8431, 0x8C71, 0x8C72, 0x8C72, 0x94B2, 0xDEDB, 0xF79E, 0xF79E, 0xF79E, 0xEF7E, 0xA534, 0x4A6A, 0x39E8,   // 0x0F20 (3872) pixels
-  0x31A6, 0x3186, 0x2945, 0x2124, 0x2104, 0x18C3, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0841, 0x0020, 0x0020, 0x0861, 0x0861, 0x1082,   // 0x0F30 (3888) pixels
-  0x10A2, 0x18C3, 0x2104, 0x2124, 0x2965, 0x39E7, 0x4A49, 0x73AE, 0xBDD7, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFBE, 0xF6FB, 0xABEF, 0xD3AE,   // 0x0F40 (3904) pixels
-  0xE34C, 0xE2EA, 0xE2A9, 0xE268, 0xE268, 0xE268, 0xE247, 0xE247, 0xE247, 0xDA27, 0xDA06, 0xD9E6, 0xDA06, 0xE227, 0xD1E5, 0xB9A5,   // 0x0F50 (3920) pixels
-  0xA1C5, 0x7207, 0x6228, 0x5228, 0x4A28, 0x4A28, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229,   // 0x0F60 (3936) pixels
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229,   // 0x0F70 (3952) pixels
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229,   // 0x0F80 (3968) pixels
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229,   // 0x0F90 (3984) pixels
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229,   // 0x0FA0 (4000) pixels
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4228, 0x4228, 0x4229,   // 0x0FB0 (4016) pixels
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4228, 0x4228, 0x4229, 0x4229, 0x4228, 0x4229, 0x4229, 0x4249, 0x4A49, 0x4A49, 0x4A6A,   // 0x0FC0 (4032) pixels
-  0x4A6A, 0x4A6A, 0x528A, 0x52AB, 0x5ACB, 0x5AEC, 0x5B0C, 0x632D, 0x6B4D, 0x6B8E, 0x73AF, 0x73AF, 0x8410, 0x8430, 0x8430, 0x8410,   // 0x0FD0 (4048) pixels
-  0x8430, 0xD6BA, 0xEF9E, 0xEF7E, 0xEF7E, 0xEF5D, 0xAD55, 0x4A69, 0x39E7, 0x31A6, 0x2965, 0x2945, 0x2124, 0x18E3, 0x18C3, 0x10A2,   // 0x0FE0 (4064) pixels
-  0x1082, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2124, 0x2965, 0x31A6, 0x4228,   // 0x0FF0 (4080) pixels
-  0x6B4D, 0xBDD7, 0xF7BE, 0xF7BE, 0xF7BE, 0xFF9E, 0xEEBA, 0xABAE, 0xD36D, 0xE30B, 0xE289, 0xE289, 0xE268, 0xE247, 0xE247, 0xDA27,   // 0x1000 (4096) pixels
-  0xDA27, 0xE247, 0xDA26, 0xDA06, 0xD1E5, 0xDA26, 0xE227, 0xD1E6, 0xC1C5, 0xA1C5, 0x79E7, 0x6228, 0x5228, 0x4A28, 0x4228, 0x4228,   // 0x1010 (4112) pixels
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4208, 0x4208, 0x4228, 0x4228,   // 0x1020 (4128) pixels
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4208, 0x4208, 0x4228, 0x4228,   // 0x1030 (4144) pixels
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4208, 0x4208, 0x4228, 0x4228,   // 0x1040 (4160) pixels
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4208, 0x4208, 0x4228, 0x4228,   // 0x1050 (4176) pixels
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4208, 0x4208, 0x4228, 0x4228,   // 0x1060 (4192) pixels
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4208, 0x4208, 0x4228, 0x4228, 0x4208, 0x4208, 0x4228, 0x4229,   // 0x1070 (4208) pixels
-  0x4208, 0x4208, 0x4228, 0x4229, 0x4229, 0x4229, 0x4229, 0x4249, 0x4A49, 0x4A49, 0x4A6A, 0x4A8A, 0x528A, 0x52AB, 0x5ACB, 0x5AEB,   // 0x1080 (4224) pixels
-  0x630C, 0x632C, 0x6B6D, 0x738E, 0x738E, 0x7BF0, 0x8410, 0x7C10, 0x7BCF, 0x7BEF, 0xCE7A, 0xEF7D, 0xEF5D, 0xEF5D, 0xE73C, 0xA535,   // 0x1090 (4240) pixels
-  0x4A49, 0x39C7, 0x3186, 0x2965, 0x2124, 0x2104, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0841,   // 0x10A0 (4256) pixels
-  0x0861, 0x0861, 0x1082, 0x10A2, 0x18E3, 0x2104, 0x2945, 0x3186, 0x39E7, 0x632C, 0xB5B6, 0xEF7D, 0xF79E, 0xF79E, 0xF77D, 0xE679,   // 0x10B0 (4272) pixels
-  0xAB6D, 0xD32B, 0xE2C9, 0xDA68, 0xE268, 0xDA47, 0xDA27, 0xDA27, 0xDA26, 0xDA26, 0xDA26, 0xDA26, 0xD9E5, 0xD1E5, 0xDA06, 0xE227,   // 0x10C0 (4288) pixels
-  0xD1E5, 0xC1C5, 0xA1C5, 0x79E6, 0x6207, 0x5208, 0x4A08, 0x4208, 0x4208, 0x3A08, 0x4208, 0x3A08, 0x3A08, 0x3A08, 0x4208, 0x3A08,   // 0x10D0 (4304) pixels
-  0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08,   // 0x10E0 (4320) pixels
-  0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08,   // 0x10F0 (4336) pixels
-  0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08,   // 0x1100 (4352) pixels
-  0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08,   // 0x1110 (4368) pixels
-  0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08,   // 0x1120 (4384) pixels
-  0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x4229,   // 0x1130 (4400) pixels
-  0x4229, 0x4229, 0x4249, 0x4A49, 0x4A6A, 0x4A6A, 0x528A, 0x52AA, 0x52CB, 0x5AEB, 0x630C, 0x632D, 0x6B6D, 0x6B6D, 0x7BEF, 0x7C10,   // 0x1140 (4416) pixels
-  0x7BEF, 0x7BCF, 0x738E, 0xC638, 0xE73C, 0xE71C, 0xDF1C, 0xDEFB, 0xA514, 0x4228, 0x31A6, 0x3186, 0x2965, 0x2124, 0x2104, 0x18E3,   // 0x1150 (4432) pixels
-  0x18C3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0841, 0x0841, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2104,   // 0x1160 (4448) pixels
-  0x2945, 0x39C7, 0x630C, 0xB596, 0xE73C, 0xEF5D, 0xEF5D, 0xF75C, 0xDE38, 0xA32C, 0xD2EA, 0xE288, 0xDA47, 0xE247, 0xDA27, 0xDA26,   // 0x1170 (4464) pixels
-  0xDA26, 0xDA26, 0xDA06, 0xDA06, 0xDA06, 0xD1E5, 0xD1C5, 0xDA26, 0xDA26, 0xD1E5, 0xC1C5, 0xA9C5, 0x79C6, 0x61E7, 0x51E7, 0x49E8,   // 0x1180 (4480) pixels
-  0x41E7, 0x39E7, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8,   // 0x1190 (4496) pixels
-  0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8,   // 0x11A0 (4512) pixels
-  0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8,   // 0x11B0 (4528) pixels
-  0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E7, 0x39E7,   // 0x11C0 (4544) pixels
-  0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8,   // 0x11D0 (4560) pixels
-  0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8,   // 0x11E0 (4576) pixels
-  0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x39E8, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x4208, 0x4229, 0x4229, 0x4229, 0x4A49, 0x4A49, 0x4A6A,   // 0x11F0 (4592) pixels
-  0x528A, 0x52AA, 0x52CB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x7BCF, 0x73AF, 0x73AE, 0x6B6E, 0x632C, 0xB5D7, 0xD6DB, 0xD6BB, 0xD6BB,   // 0x1200 (4608) pixels
-  0xCE9A, 0x9CF3, 0x4208, 0x31A6, 0x2965, 0x2945, 0x2124, 0x2104, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0841, 0x0841,   // 0x1210 (4624) pixels
-  0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x2124, 0x3186, 0x5ACB, 0xAD75, 0xDEFB, 0xE71C, 0xE71C,   // 0x1220 (4640) pixels
-  0xE6FB, 0xD5D6, 0x9AEB, 0xD2A9, 0xE268, 0xDA27, 0xE247, 0xDA26, 0xDA06, 0xDA06, 0xDA06, 0xDA06, 0xDA06, 0xDA06, 0xD1E5, 0xD1C5,   // 0x1230 (4656) pixels
-  0xDA26, 0xDA26, 0xD1E5, 0xC1A4, 0xA9C5, 0x79C6, 0x61C7, 0x51E7, 0x41E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E8, 0x39C7,   // 0x1240 (4672) pixels
-  0x39C7, 0x39C7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7,   // 0x1250 (4688) pixels
-  0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7,   // 0x1260 (4704) pixels
-  0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7,   // 0x1270 (4720) pixels
-  0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7,   // 0x1280 (4736) pixels
-  0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7,   // 0x1290 (4752) pixels
-  0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39C7, 0x39E8, 0x39E8, 0x39E8, 0x39E8,   // 0x12A0 (4768) pixels
-  0x39E8, 0x39E8, 0x39E8, 0x4208, 0x4208, 0x4229, 0x4229, 0x4249, 0x4A49, 0x4A6A, 0x4A8A, 0x52AA, 0x52AB, 0x5AEB, 0x5AEC, 0x5AEC,   // 0x12B0 (4784) pixels
-  0x738E, 0x6B6E, 0x6B6E, 0x632D, 0x5ACB, 0xAD96, 0xCE79, 0xC659, 0xC659, 0xBE18, 0x94B3, 0x39E8, 0x3186, 0x2965, 0x2945, 0x2124,   // 0x12C0 (4800) pixels
-  0x2104, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082,   // 0x12D0 (4816) pixels
-  0x10A2, 0x18C3, 0x2104, 0x2965, 0x528A, 0xAD55, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEBA, 0xCD55, 0x9AAA, 0xD289, 0xE227, 0xDA06, 0xDA26,   // 0x12E0 (4832) pixels
-  0xDA06, 0xD9E6, 0xD9E5, 0xD9E6, 0xDA06, 0xD9E5, 0xD1E5, 0xD1E5, 0xD1C5, 0xDA06, 0xDA26, 0xD1E5, 0xC1A5, 0xA9C5, 0x79C6, 0x61C6,   // 0x12F0 (4848) pixels
-  0x51C7, 0x41C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x1300 (4864) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x1310 (4880) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x1320 (4896) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x1330 (4912) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x1340 (4928) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x1350 (4944) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31C7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E8, 0x39E8, 0x39E8, 0x4208, 0x4208,   // 0x1360 (4960) pixels
-  0x4228, 0x4229, 0x4A49, 0x4A69, 0x4A8A, 0x528A, 0x52CB, 0x52CB, 0x5ACB, 0x6B6D, 0x632C, 0x634D, 0x5AEC, 0x528A, 0x9D14, 0xC638,   // 0x1370 (4976) pixels
-  0xBE18, 0xBDF8, 0xB5D7, 0x8C92, 0x39E8, 0x2986, 0x2945, 0x2945, 0x2124, 0x2104, 0x18E3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x0861,   // 0x1380 (4992) pixels
-  0x0861, 0x0841, 0x0841, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x1082, 0x1082, 0x10A2, 0x18E3, 0x2945, 0x4A49, 0xA514, 0xCE59,   // 0x1390 (5008) pixels
-  0xCE79, 0xCE79, 0xD659, 0xC514, 0x9A89, 0xCA68, 0xDA06, 0xDA06, 0xDA06, 0xD9E6, 0xD9E6, 0xD9E5, 0xD9E5, 0xD1E5, 0xD1E5, 0xD1E5,   // 0x13A0 (5024) pixels
-  0xD1C5, 0xC9A5, 0xDA06, 0xDA26, 0xC9E5, 0xC1A5, 0xA9C5, 0x79A6, 0x59A6, 0x49C7, 0x41C7, 0x39C7, 0x39A7, 0x31A7, 0x31A7, 0x31A7,   // 0x13B0 (5040) pixels
-  0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7,   // 0x13C0 (5056) pixels
-  0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7,   // 0x13D0 (5072) pixels
-  0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7,   // 0x13E0 (5088) pixels
-  0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7,   // 0x13F0 (5104) pixels
-  0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7,   // 0x1400 (5120) pixels
-  0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31C7, 0x31C7, 0x31A7,   // 0x1410 (5136) pixels
-  0x31C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x3A08, 0x4208, 0x4208, 0x4229, 0x4249, 0x4A69, 0x4A6A, 0x528A,   // 0x1420 (5152) pixels
-  0x528A, 0x528A, 0x632D, 0x5AEB, 0x5B0C, 0x52CB, 0x4A49, 0x94D3, 0xB5B7, 0xB597, 0xAD96, 0xAD76, 0x8451, 0x39C7, 0x2966, 0x2965,   // 0x1430 (5168) pixels
-  0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841,   // 0x1440 (5184) pixels
-  0x0841, 0x0861, 0x0861, 0x10A2, 0x18C3, 0x2124, 0x4208, 0x9CF3, 0xC618, 0xC618, 0xC638, 0xCE18, 0xBCB2, 0x9268, 0xCA48, 0xDA06,   // 0x1450 (5200) pixels
-  0xD1E5, 0xDA06, 0xD9E5, 0xD9E5, 0xD1C5, 0xD9E5, 0xD1E5, 0xD1E5, 0xD1C5, 0xD1C5, 0xC9A5, 0xDA06, 0xDA06, 0xC9E5, 0xC1A4, 0xA9A5,   // 0x1460 (5216) pixels
-  0x79A5, 0x59A6, 0x49A6, 0x41A6, 0x39A7, 0x31A6, 0x3187, 0x3187, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x1470 (5232) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x1480 (5248) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x1490 (5264) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x14A0 (5280) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x14B0 (5296) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x14C0 (5312) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31C7, 0x39C7,   // 0x14D0 (5328) pixels
-  0x39E7, 0x39E7, 0x39E7, 0x39E8, 0x4208, 0x4228, 0x4229, 0x4A49, 0x4A6A, 0x4A69, 0x4A6A, 0x5B0C, 0x52AA, 0x5ACB, 0x4A6A, 0x4208,   // 0x14E0 (5344) pixels
-  0x8C92, 0xA555, 0xA535, 0xA535, 0x9D14, 0x8451, 0x52AB, 0x52AB, 0x4A8A, 0x528A, 0x4229, 0x2966, 0x2104, 0x2104, 0x18E3, 0x18C3,   // 0x14F0 (5360) pixels
-  0x10A2, 0x1082, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x10A2, 0x2104, 0x4208,   // 0x1500 (5376) pixels
-  0x9CD3, 0xBDD7, 0xBDD7, 0xBDD7, 0xC5B6, 0xAC30, 0x9248, 0xCA47, 0xD9E5, 0xD1E5, 0xD9E5, 0xD1E5, 0xD1E5, 0xD1C5, 0xD1E5, 0xD1C5,   // 0x1510 (5392) pixels
-  0xD1E5, 0xD1C5, 0xC9A5, 0xC9A4, 0xD206, 0xDA06, 0xC9C5, 0xC1A4, 0xA9A5, 0x79A5, 0x5986, 0x49A6, 0x3986, 0x39A6, 0x3186, 0x3186,   // 0x1520 (5408) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x1530 (5424) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x1540 (5440) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x1550 (5456) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x1560 (5472) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x1570 (5488) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x1580 (5504) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A7, 0x31A7, 0x31C7, 0x39C7, 0x39C7, 0x39E7, 0x39E8, 0x39E8, 0x4208,   // 0x1590 (5520) pixels
-  0x4228, 0x4249, 0x4229, 0x4229, 0x5ACB, 0x4A6A, 0x52AA, 0x4A49, 0x39E7, 0x8431, 0x9D14, 0x9CF4, 0x9CF4, 0x94D3, 0x7C10, 0x52CB,   // 0x15A0 (5536) pixels
-  0x5AEC, 0x52CB, 0x52CB, 0x52CB, 0x4229, 0x2125, 0x2104, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0841, 0x0020, 0x0020,   // 0x15B0 (5552) pixels
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x10A2, 0x18E3, 0x4208, 0x94B2, 0xAD75, 0xB596, 0xB596, 0xBD75, 0xA3EF, 0x9227,   // 0x15C0 (5568) pixels
-  0xCA47, 0xD9E5, 0xD1C5, 0xD1E5, 0xD1E5, 0xD1C5, 0xD1C5, 0xD1E5, 0xD1C5, 0xD1E5, 0xC9C5, 0xC9A4, 0xC9A4, 0xDA06, 0xD205, 0xC9C5,   // 0x15D0 (5584) pixels
-  0xC1A4, 0xA9A5, 0x81A5, 0x5985, 0x4986, 0x3986, 0x3186, 0x3186, 0x3186, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966,   // 0x15E0 (5600) pixels
-  0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966,   // 0x15F0 (5616) pixels
-  0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966,   // 0x1600 (5632) pixels
-  0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966,   // 0x1610 (5648) pixels
-  0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966,   // 0x1620 (5664) pixels
-  0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966,   // 0x1630 (5680) pixels
-  0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2986, 0x2986, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x1640 (5696) pixels
-  0x3186, 0x31A6, 0x31A6, 0x31A7, 0x31A7, 0x31C7, 0x31C7, 0x39E7, 0x39E7, 0x39E8, 0x4208, 0x4228, 0x4208, 0x52AB, 0x4249, 0x4A6A,   // 0x1650 (5712) pixels
-  0x4208, 0x31A7, 0x6B8E, 0x94B3, 0x94B3, 0x8CB3, 0x8C92, 0x73F0, 0x31E7, 0x2966, 0x2145, 0x2125, 0x1904, 0x2966, 0x3186, 0x2945,   // 0x1660 (5728) pixels
-  0x2104, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082,   // 0x1670 (5744) pixels
-  0x18C3, 0x4208, 0x9492, 0xA534, 0xA534, 0xA534, 0xAD14, 0x9BAD, 0x9227, 0xCA27, 0xD1C5, 0xD1C4, 0xD1E5, 0xD1E5, 0xD1C5, 0xC9C5,   // 0x1680 (5760) pixels
-  0xD1C5, 0xC9C5, 0xC9C5, 0xC9C4, 0xC1A4, 0xC9A4, 0xD206, 0xD1E5, 0xC9C5, 0xC1A4, 0xA9A5, 0x81A5, 0x5965, 0x4986, 0x3965, 0x3165,   // 0x1690 (5776) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x16A0 (5792) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x16B0 (5808) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x16C0 (5824) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x16D0 (5840) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x16E0 (5856) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x16F0 (5872) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2986, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,   // 0x1700 (5888) pixels
-  0x31C7, 0x31C7, 0x39C7, 0x39E7, 0x39E7, 0x39E8, 0x4A6A, 0x39E7, 0x4208, 0x39C7, 0x2986, 0x630D, 0x8C72, 0x8472, 0x8452, 0x8452,   // 0x1710 (5904) pixels
-  0x73AF, 0x31E8, 0x2986, 0x2966, 0x2166, 0x2125, 0x2145, 0x39C7, 0x2965, 0x2124, 0x2104, 0x18E3, 0x10A2, 0x1082, 0x0861, 0x0861,   // 0x1720 (5920) pixels
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x1082, 0x10A2, 0x39E7, 0x8C71, 0x9CD3, 0x9CF3, 0x9CF3, 0xA4D3,   // 0x1730 (5936) pixels
-  0x936C, 0x9227, 0xC226, 0xD1C5, 0xC9A4, 0xD1C5, 0xD1C5, 0xC9C5, 0xC9A4, 0xC9C4, 0xC9A4, 0xC9C5, 0xC9C5, 0xC1A4, 0xC1A4, 0xD1E6,   // 0x1740 (5952) pixels
-  0xD1E5, 0xC9C5, 0xB9A4, 0xA9A5, 0x81A5, 0x5965, 0x4965, 0x3965, 0x3165, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x1750 (5968) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x1760 (5984) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x1770 (6000) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x1780 (6016) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x1790 (6032) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x17A0 (6048) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x17B0 (6064) pixels
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2985, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x31C7, 0x31A7, 0x4208,   // 0x17C0 (6080) pixels
-  0x31A6, 0x39E7, 0x31A6, 0x2965, 0x5AEC, 0x7C31, 0x7C31, 0x7C31, 0x7C31, 0x6BAF, 0x5AEC, 0x6B6E, 0x6B6E, 0x634D, 0x5B0C, 0x4249,   // 0x17D0 (6096) pixels
-  0x4229, 0x3186, 0x2965, 0x2124, 0x18E3, 0x18C3, 0x10A2, 0x0862, 0x0841, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020,   // 0x17E0 (6112) pixels
-  0x0841, 0x0861, 0x1082, 0x39C7, 0x8C51, 0x94B2, 0x9CD3, 0x9CD3, 0xA492, 0x8B0B, 0x9207, 0xC226, 0xC9C4, 0xC9A4, 0xC9C5, 0xC9C5,   // 0x17F0 (6128) pixels
-  0xC9A4, 0xC9C4, 0xC9A4, 0xC9A4, 0xC9C5, 0xC1A4, 0xC1A4, 0xC1A4, 0xD1E5, 0xD1E5, 0xC9C4, 0xB984, 0xA9A4, 0x8185, 0x5944, 0x4165,   // 0x1800 (6144) pixels
-  0x3165, 0x3165, 0x2945, 0x2945, 0x2945, 0x2145, 0x2145, 0x2945, 0x2125, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145,   // 0x1810 (6160) pixels
-  0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145,   // 0x1820 (6176) pixels
-  0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145,   // 0x1830 (6192) pixels
-  0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145,   // 0x1840 (6208) pixels
-  0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145,   // 0x1850 (6224) pixels
-  0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145,   // 0x1860 (6240) pixels
-  0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2145, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2945, 0x2965, 0x2965, 0x2965,   // 0x1870 (6256) pixels
-  0x2966, 0x2965, 0x2985, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x3A08, 0x2966, 0x31A7, 0x2986, 0x2945, 0x52CB, 0x7C10, 0x7BF0,   // 0x1880 (6272) pixels
-  0x7C11, 0x7C11, 0x6BAF, 0x94D3, 0xDF3D, 0xDF3C, 0xE73D, 0xE75D, 0xBDF8, 0x630C, 0x31A7, 0x3186, 0x2945, 0x2104, 0x18C3, 0x10A2,   // 0x1890 (6288) pixels
-  0x0862, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0861, 0x1082, 0x39C7, 0x8410, 0x8C71, 0x8C71,   // 0x18A0 (6304) pixels
-  0x9492, 0x9C71, 0x82CA, 0x9207, 0xC206, 0xC9A4, 0xC9A4, 0xC9C5, 0xC9C5, 0xC9C4, 0xC9A4, 0xC9A4, 0xC9A4, 0xC9A4, 0xC1A4, 0xC184,   // 0x18B0 (6320) pixels
-  0xC184, 0xD1E5, 0xC9E5, 0xC1C4, 0xB984, 0xA184, 0x8185, 0x5944, 0x4145, 0x3145, 0x2945, 0x2124, 0x2125, 0x2125, 0x2124, 0x2124,   // 0x18C0 (6336) pixels
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2125, 0x2125, 0x2125, 0x2125, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x18D0 (6352) pixels
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x18E0 (6368) pixels
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x18F0 (6384) pixels
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x1900 (6400) pixels
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x1910 (6416) pixels
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x1920 (6432) pixels
-  0x2125, 0x2125, 0x2125, 0x2125, 0x2125, 0x2125, 0x2145, 0x2145, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2966, 0x3186, 0x2966,   // 0x1930 (6448) pixels
-  0x2966, 0x39C7, 0x2945, 0x3186, 0x2946, 0x2125, 0x4A8A, 0x73D0, 0x73D0, 0x73F0, 0x73F0, 0x73AF, 0x8CB3, 0xDF1C, 0xDF1C, 0xE73D,   // 0x1940 (6464) pixels
-  0xE73D, 0xD6DB, 0x7C10, 0x39E7, 0x3186, 0x2945, 0x2104, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1950 (6480) pixels
-  0x0000, 0x0020, 0x0020, 0x0841, 0x1082, 0x31A6, 0x7BCF, 0x8430, 0x8C51, 0x8C51, 0x9430, 0x7A89, 0x8A06, 0xC206, 0xC9A4, 0xC1A4,   // 0x1960 (6496) pixels
-  0xC9C4, 0xC9C5, 0xC1A4, 0xC1A4, 0xC1A4, 0xC1A4, 0xC1A4, 0xC1A4, 0xB984, 0xC184, 0xD1E5, 0xC9E5, 0xC1A4, 0xB984, 0xA1A4, 0x8185,   // 0x1970 (6512) pixels
-  0x5924, 0x4144, 0x3144, 0x2924, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x1980 (6528) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x1990 (6544) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x19A0 (6560) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x19B0 (6576) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x19C0 (6592) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x19D0 (6608) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,   // 0x19E0 (6624) pixels
-  0x2124, 0x2124, 0x2125, 0x2125, 0x2125, 0x2945, 0x2945, 0x2966, 0x2965, 0x2946, 0x31A7, 0x2125, 0x2965, 0x2125, 0x2104, 0x4A6A,   // 0x19F0 (6640) pixels
-  0x73AF, 0x6BAF, 0x6BCF, 0x73CF, 0x6BAF, 0x7C31, 0xC659, 0xCE7A, 0xCE9A, 0xCE9A, 0xCE7A, 0x8431, 0x39E7, 0x3186, 0x2945, 0x2104,   // 0x1A00 (6656) pixels
-  0x18C3, 0x10A2, 0x1082, 0x0861, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x3186, 0x73AE,   // 0x1A10 (6672) pixels
-  0x8410, 0x8410, 0x8430, 0x8BEF, 0x7268, 0x8A06, 0xBA06, 0xC9A4, 0xC184, 0xC1A4, 0xC9C5, 0xC1A4, 0xC1A4, 0xC1A4, 0xC1A4, 0xC1A4,   // 0x1A20 (6688) pixels
-  0xC1A4, 0xB983, 0xC184, 0xD1E5, 0xC9C5, 0xC1A4, 0xB984, 0xA184, 0x8185, 0x5924, 0x4124, 0x3124, 0x2924, 0x2104, 0x2104, 0x2104,   // 0x1A30 (6704) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x1A40 (6720) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x1A50 (6736) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x1A60 (6752) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x1A70 (6768) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x1A80 (6784) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x1A90 (6800) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2125,   // 0x1AA0 (6816) pixels
-  0x2945, 0x2945, 0x2945, 0x3186, 0x2104, 0x2945, 0x2104, 0x18E3, 0x4249, 0x6B6E, 0x6B6E, 0x6B8F, 0x6B8F, 0x6B8E, 0x6BAF, 0x9D35,   // 0x1AB0 (6832) pixels
-  0xAD76, 0xB5B7, 0xB5D7, 0xB5B6, 0x7BF0, 0x39C7, 0x2966, 0x2125, 0x2104, 0x18C3, 0x10A2, 0x0861, 0x0841, 0x0000, 0x0000, 0x0000,   // 0x1AC0 (6848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x2965, 0x6B6D, 0x7BCF, 0x7BCF, 0x7BEF, 0x83CE, 0x7228, 0x89E6, 0xBA06,   // 0x1AD0 (6864) pixels
-  0xC1A4, 0xC184, 0xC1A4, 0xC1A4, 0xC184, 0xC1A4, 0xC1A4, 0xC1A4, 0xC1A4, 0xB984, 0xB983, 0xB963, 0xC9E5, 0xC9C5, 0xC1A4, 0xB984,   // 0x1AE0 (6880) pixels
-  0xA184, 0x8185, 0x5924, 0x4124, 0x3124, 0x2104, 0x2103, 0x18E4, 0x18E4, 0x18E3, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4,   // 0x1AF0 (6896) pixels
-  0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4,   // 0x1B00 (6912) pixels
-  0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4,   // 0x1B10 (6928) pixels
-  0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4,   // 0x1B20 (6944) pixels
-  0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4,   // 0x1B30 (6960) pixels
-  0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4,   // 0x1B40 (6976) pixels
-  0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x1903, 0x1903, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4,   // 0x1B50 (6992) pixels
-  0x1904, 0x1904, 0x1904, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2125, 0x2124, 0x2125, 0x2966, 0x2104, 0x2124, 0x1904,   // 0x1B60 (7008) pixels
-  0x10C3, 0x3A08, 0x634D, 0x632D, 0x634E, 0x634E, 0x632D, 0x5B0C, 0x73F0, 0x8451, 0x8C92, 0x8CB3, 0x8C92, 0x6B6E, 0x31A6, 0x2945,   // 0x1B70 (7024) pixels
-  0x2104, 0x18E3, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841,   // 0x1B80 (7040) pixels
-  0x2945, 0x6B4D, 0x738E, 0x73AE, 0x73AE, 0x7B8E, 0x61E7, 0x89E6, 0xB9E6, 0xC1A4, 0xB984, 0xC1A4, 0xC1A4, 0xC184, 0xC184, 0xB984,   // 0x1B90 (7056) pixels
-  0xC1A4, 0xB9A4, 0xB984, 0xB983, 0xB963, 0xC9E5, 0xC9C5, 0xC1A4, 0xB184, 0xA184, 0x8185, 0x5903, 0x4104, 0x3104, 0x2104, 0x2103,   // 0x1BA0 (7072) pixels
-  0x18E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1BB0 (7088) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1BC0 (7104) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1BD0 (7120) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1BE0 (7136) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1BF0 (7152) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1C00 (7168) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x1904, 0x1904,   // 0x1C10 (7184) pixels
-  0x2104, 0x2104, 0x2124, 0x2104, 0x2104, 0x2945, 0x18E3, 0x2104, 0x18E3, 0x10A3, 0x3A08, 0x5B0C, 0x5B0C, 0x5B0D, 0x5B0D, 0x52EC,   // 0x1C20 (7200) pixels
-  0x4A8B, 0x5B0D, 0x634E, 0x6B6E, 0x73AF, 0x6B8E, 0x5ACB, 0x2965, 0x2124, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0000,   // 0x1C30 (7216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x2945, 0x630C, 0x6B4D, 0x6B6D, 0x6B6D, 0x7B4D, 0x61C6,   // 0x1C40 (7232) pixels
-  0x89E6, 0xB1E6, 0xC1A4, 0xB984, 0xB9A4, 0xC1A5, 0xB984, 0xB9A4, 0xB9A4, 0xB9A4, 0xB9A4, 0xB184, 0xB184, 0xB984, 0xC9E6, 0xC9C5,   // 0x1C50 (7248) pixels
-  0xC1A4, 0xB184, 0xA184, 0x7964, 0x50C3, 0x38C3, 0x28C3, 0x20C2, 0x10A2, 0x10A2, 0x10A3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1C60 (7264) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1C70 (7280) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1C80 (7296) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1C90 (7312) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1CA0 (7328) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1CB0 (7344) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1CC0 (7360) pixels
-  0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A2, 0x10A3, 0x10A3, 0x10A3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x2104, 0x10A3,   // 0x1CD0 (7376) pixels
-  0x18C3, 0x18C3, 0x1082, 0x31C7, 0x52EC, 0x52CB, 0x52CC, 0x52CC, 0x4AAB, 0x3A09, 0x424A, 0x4A6A, 0x4A8B, 0x4AAB, 0x4AAB, 0x4209,   // 0x1CE0 (7392) pixels
-  0x2104, 0x18E4, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1CF0 (7408) pixels
-  0x0020, 0x0841, 0x2124, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x628A, 0x5985, 0x81C5, 0xA9C5, 0xA943, 0xA943, 0xA963, 0xA964, 0xA943,   // 0x1D00 (7424) pixels
-  0xA943, 0xA163, 0xA964, 0xA143, 0xA143, 0xA143, 0xA943, 0xB9C5, 0xB984, 0xB163, 0xA163, 0x9964, 0x7124, 0x4061, 0x2861, 0x1040,   // 0x1D10 (7440) pixels
-  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D20 (7456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D30 (7472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D40 (7488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D50 (7504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D60 (7520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D70 (7536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D80 (7552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0020, 0x0841, 0x1082, 0x0861, 0x0862, 0x1082, 0x0861, 0x31A7, 0x31C7, 0x2966, 0x2986,   // 0x1D90 (7568) pixels
-  0x2986, 0x2986, 0x31A7, 0x31C7, 0x31E8, 0x31E8, 0x31E8, 0x31C7, 0x2986, 0x18E4, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0841,   // 0x1DA0 (7584) pixels
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3,   // 0x1DB0 (7600) pixels
-  0x28E3, 0x4103, 0x79A5, 0xA1A4, 0xA123, 0xA122, 0xA143, 0xA143, 0x9923, 0x9923, 0x9923, 0x9923, 0x9923, 0x9923, 0x9922, 0xA123,   // 0x1DC0 (7616) pixels
-  0xB9A5, 0xB184, 0xA963, 0xA143, 0x9144, 0x7124, 0x4060, 0x2841, 0x1020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DD0 (7632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DE0 (7648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DF0 (7664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E00 (7680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E10 (7696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E20 (7712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E30 (7728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0020, 0x0841,   // 0x1E40 (7744) pixels
-  0x1082, 0x0841, 0x0861, 0x0862, 0x0841, 0x3186, 0x2125, 0x10C3, 0x10C3, 0x10C3, 0x10E4, 0x2125, 0x2145, 0x2145, 0x2145, 0x2145,   // 0x1E50 (7760) pixels
-  0x2145, 0x1904, 0x10A3, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E60 (7776) pixels
-  0x0000, 0x0000, 0x0000, 0x0020, 0x18C3, 0x10A2, 0x0861, 0x1082, 0x10A2, 0x2082, 0x40C2, 0x79A5, 0x9984, 0xA143, 0x9922, 0x9943,   // 0x1E70 (7792) pixels
-  0x9943, 0x9923, 0x9923, 0x9123, 0x9923, 0x9923, 0x9923, 0x9922, 0xA123, 0xB1A5, 0xB184, 0xA943, 0xA143, 0x9143, 0x7123, 0x4061,   // 0x1E80 (7808) pixels
-  0x2861, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E90 (7824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EA0 (7840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EB0 (7856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EC0 (7872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1ED0 (7888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EE0 (7904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EF0 (7920) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0020, 0x0841, 0x1082, 0x0041, 0x0841, 0x0861, 0x0841, 0x3186, 0x2104,   // 0x1F00 (7936) pixels
-  0x18C3, 0x10C3, 0x10A3, 0x10C3, 0x1904, 0x18E4, 0x1904, 0x1904, 0x1904, 0x18E4, 0x18C3, 0x1082, 0x1082, 0x0862, 0x0861, 0x0841,   // 0x1F10 (7952) pixels
-  0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x10A2, 0x10A2, 0x0861,   // 0x1F20 (7968) pixels
-  0x0861, 0x1082, 0x20A2, 0x40C2, 0x79A5, 0x9984, 0xA123, 0x9922, 0x9943, 0x9943, 0x9943, 0x9943, 0x9923, 0x9923, 0x9923, 0x9943,   // 0x1F30 (7984) pixels
-  0x9922, 0xA143, 0xB1C5, 0xB184, 0xA943, 0xA143, 0x9143, 0x7123, 0x4061, 0x2861, 0x1020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F40 (8000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F50 (8016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F60 (8032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F70 (8048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F80 (8064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F90 (8080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FA0 (8096) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x1FB0 (8112) pixels
-  0x0020, 0x0841, 0x1082, 0x0041, 0x0841, 0x0841, 0x0021, 0x2966, 0x2104, 0x10A3, 0x10A3, 0x10A2, 0x10A3, 0x10C3, 0x10A3, 0x10A3,   // 0x1FC0 (8128) pixels
-  0x10A2, 0x1082, 0x1082, 0x1082, 0x0862, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FD0 (8144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x1082, 0x0861, 0x0861, 0x1082, 0x1882, 0x38A2, 0x79A5, 0x9984, 0x9922,   // 0x1FE0 (8160) pixels
-  0x9922, 0x9943, 0x9943, 0x9923, 0x9923, 0x9123, 0x9923, 0x9923, 0x9943, 0x9923, 0xA123, 0xB1C5, 0xB184, 0xA163, 0x9943, 0x9143,   // 0x1FF0 (8176) pixels
-  0x7123, 0x4061, 0x2841, 0x1020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2000 (8192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2010 (8208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2020 (8224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2030 (8240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2040 (8256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2050 (8272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2060 (8288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0862, 0x0021, 0x0841, 0x0841, 0x0021,   // 0x2070 (8304) pixels
-  0x2965, 0x1904, 0x10A3, 0x10A3, 0x1082, 0x10A2, 0x10A3, 0x0862, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841,   // 0x2080 (8320) pixels
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2,   // 0x2090 (8336) pixels
-  0x1082, 0x0861, 0x0861, 0x1082, 0x1882, 0x38A2, 0x7985, 0x9984, 0x9922, 0x9922, 0x9943, 0x9943, 0x9923, 0x9923, 0x9123, 0x9923,   // 0x20A0 (8352) pixels
-  0x9923, 0x9923, 0x9923, 0xA122, 0xB1C5, 0xA983, 0xA963, 0x9943, 0x9143, 0x7123, 0x4060, 0x2841, 0x1020, 0x0820, 0x0000, 0x0000,   // 0x20B0 (8368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20C0 (8384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20D0 (8400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20E0 (8416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20F0 (8432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2100 (8448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2110 (8464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2120 (8480) pixels
-  0x0000, 0x0020, 0x0000, 0x0841, 0x0862, 0x0021, 0x0021, 0x0841, 0x0020, 0x2965, 0x18E4, 0x10A3, 0x1082, 0x1082, 0x1082, 0x10A3,   // 0x2130 (8496) pixels
-  0x0862, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0021, 0x0021, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2140 (8512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0861, 0x1881, 0x38A1, 0x7985,   // 0x2150 (8528) pixels
-  0x9984, 0x9922, 0x9922, 0x9943, 0x9943, 0x9923, 0x9123, 0x9923, 0x9923, 0x9923, 0x9923, 0x9923, 0xA122, 0xB9A5, 0xA963, 0xA163,   // 0x2160 (8544) pixels
-  0x9923, 0x9143, 0x7123, 0x4060, 0x2841, 0x1020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2170 (8560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2180 (8576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2190 (8592) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21A0 (8608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21B0 (8624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21C0 (8640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21D0 (8656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0841, 0x0861, 0x0020, 0x0841,   // 0x21E0 (8672) pixels
-  0x0841, 0x0020, 0x2965, 0x18E4, 0x10A3, 0x0882, 0x0882, 0x0882, 0x10A2, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0841, 0x0040,   // 0x21F0 (8688) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2200 (8704) pixels
-  0x0000, 0x1082, 0x1082, 0x0841, 0x0861, 0x1082, 0x1861, 0x38A1, 0x7985, 0x9984, 0x9922, 0x9922, 0x9943, 0x9943, 0x9922, 0x9123,   // 0x2210 (8720) pixels
-  0x9923, 0x9923, 0x9923, 0x9923, 0x9923, 0xA122, 0xB9A4, 0xA983, 0xA943, 0xA143, 0x9143, 0x7123, 0x4060, 0x2841, 0x1020, 0x0820,   // 0x2220 (8736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2230 (8752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2240 (8768) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2250 (8784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2260 (8800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2270 (8816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2280 (8832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2290 (8848) pixels
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x2945, 0x18E3, 0x10A3, 0x0882, 0x0862,   // 0x22A0 (8864) pixels
-  0x0882, 0x0882, 0x0041, 0x0041, 0x0041, 0x0020, 0x0020, 0x0041, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22B0 (8880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x1082, 0x0841, 0x0861, 0x1082, 0x1861,   // 0x22C0 (8896) pixels
-  0x3881, 0x7985, 0x9984, 0x9922, 0x9102, 0x9943, 0x9943, 0x9903, 0x9123, 0x9123, 0x9923, 0x9923, 0x9923, 0x9922, 0xA122, 0xB1C4,   // 0x22D0 (8912) pixels
-  0xB163, 0xA963, 0xA143, 0x9143, 0x7123, 0x4041, 0x2841, 0x1020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22E0 (8928) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22F0 (8944) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2300 (8960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2310 (8976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2320 (8992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2330 (9008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2340 (9024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0841, 0x0861,   // 0x2350 (9040) pixels
-  0x0821, 0x0841, 0x0861, 0x0861, 0x2966, 0x18E4, 0x1082, 0x0882, 0x0862, 0x0862, 0x0862, 0x0841, 0x0041, 0x0041, 0x0021, 0x0020,   // 0x2360 (9056) pixels
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2370 (9072) pixels
-  0x0000, 0x0000, 0x0000, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x1881, 0x3881, 0x7985, 0x99A4, 0x9942, 0x9922, 0x9943, 0x9943,   // 0x2380 (9088) pixels
-  0x9923, 0x9922, 0x9922, 0x9923, 0x9923, 0x9923, 0x9922, 0xA122, 0xB9A4, 0xB183, 0xA963, 0xA143, 0x9143, 0x7123, 0x4041, 0x2841,   // 0x2390 (9104) pixels
-  0x1020, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23A0 (9120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23B0 (9136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23C0 (9152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23D0 (9168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23E0 (9184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23F0 (9200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2400 (9216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0841, 0x0861, 0x0021, 0x0841, 0x1082, 0x1082, 0x2986, 0x18E4, 0x1082,   // 0x2410 (9232) pixels
-  0x0882, 0x0862, 0x0862, 0x0862, 0x0841, 0x0021, 0x0021, 0x0021, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2420 (9248) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x0861, 0x0861, 0x0861,   // 0x2430 (9264) pixels
-  0x0861, 0x1881, 0x3881, 0x7985, 0x9984, 0xA143, 0x9922, 0x9943, 0xA143, 0x9943, 0x9943, 0xA143, 0xA143, 0xA143, 0x9923, 0xA122,   // 0x2440 (9280) pixels
-  0xA923, 0xB9A5, 0xB184, 0xA963, 0xA143, 0x9143, 0x7123, 0x4061, 0x2881, 0x1861, 0x1061, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x2450 (9296) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x2460 (9312) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x2470 (9328) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x2480 (9344) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x2490 (9360) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x24A0 (9376) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x24B0 (9392) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0821, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861,   // 0x24C0 (9408) pixels
-  0x1082, 0x10A3, 0x0861, 0x0882, 0x1082, 0x10A2, 0x3186, 0x18E3, 0x1082, 0x0882, 0x0862, 0x0862, 0x0862, 0x0841, 0x0021, 0x0020,   // 0x24D0 (9424) pixels
-  0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24E0 (9440) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0861, 0x0841, 0x0861, 0x0861, 0x1861, 0x3081, 0x7985, 0x99A4, 0xA143, 0x9922,   // 0x24F0 (9456) pixels
-  0x9943, 0xA163, 0xA163, 0xA163, 0xA163, 0xA163, 0xA163, 0xA143, 0xA143, 0xA923, 0xB9C5, 0xB9A4, 0xA983, 0xA143, 0x9143, 0x7123,   // 0x2500 (9472) pixels
-  0x48A2, 0x30A2, 0x2082, 0x18A2, 0x1081, 0x1062, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x2510 (9488) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x2520 (9504) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x2530 (9520) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x2540 (9536) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0861,   // 0x2550 (9552) pixels
-  0x0861, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862,   // 0x2560 (9568) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862,   // 0x2570 (9584) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x1082, 0x10A2, 0x10A2, 0x10A3, 0x18E4, 0x1082, 0x10C3, 0x18C3, 0x10C3, 0x3186,   // 0x2580 (9600) pixels
-  0x18C3, 0x1082, 0x0862, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2590 (9616) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0861,   // 0x25A0 (9632) pixels
-  0x0841, 0x0861, 0x0861, 0x1861, 0x3061, 0x7985, 0x9984, 0xA143, 0x9922, 0xA143, 0xA163, 0xA143, 0xA143, 0xA143, 0xA143, 0xA143,   // 0x25B0 (9648) pixels
-  0xA163, 0xA143, 0xA923, 0xB9C4, 0xB9A4, 0xB183, 0xA143, 0x9143, 0x7943, 0x48A2, 0x30A2, 0x2082, 0x18A2, 0x1081, 0x1082, 0x1082,   // 0x25C0 (9664) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x25D0 (9680) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x25E0 (9696) pixels
-  0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x25F0 (9712) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x2600 (9728) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x2610 (9744) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x1082,   // 0x2620 (9760) pixels
-  0x1082, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x1062, 0x1082, 0x1082,   // 0x2630 (9776) pixels
-  0x10A2, 0x10A2, 0x18C3, 0x2104, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x3186, 0x18E3, 0x1082, 0x0882, 0x0861, 0x0861, 0x0861, 0x0041,   // 0x2640 (9792) pixels
-  0x0021, 0x0021, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2650 (9808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0861, 0x0841, 0x0861, 0x1082, 0x1861, 0x3061, 0x7985, 0x9984,   // 0x2660 (9824) pixels
-  0xA123, 0x9922, 0xA143, 0xA163, 0xA143, 0xA143, 0xA143, 0xA143, 0xA143, 0xA143, 0xA143, 0xA943, 0xB9C5, 0xB9A4, 0xB183, 0xA143,   // 0x2670 (9840) pixels
-  0x9143, 0x7123, 0x48A1, 0x30A2, 0x2082, 0x1882, 0x1082, 0x1062, 0x0861, 0x0862, 0x0862, 0x0862, 0x1082, 0x0862, 0x0862, 0x0862,   // 0x2680 (9856) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x2690 (9872) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x26A0 (9888) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x26B0 (9904) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861,   // 0x26C0 (9920) pixels
-  0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x26D0 (9936) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x26E0 (9952) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x2104, 0x10A2, 0x18E3, 0x18C4,   // 0x26F0 (9968) pixels
-  0x18C3, 0x3186, 0x18E3, 0x1082, 0x0882, 0x0861, 0x0861, 0x0861, 0x0041, 0x0021, 0x0021, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,   // 0x2700 (9984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2710 (10000) pixels
-  0x0861, 0x0861, 0x0861, 0x0862, 0x0861, 0x1861, 0x3061, 0x7985, 0x99A4, 0xA143, 0x9922, 0xA143, 0xA143, 0xA143, 0xA143, 0xA143,   // 0x2720 (10016) pixels
-  0xA143, 0xA143, 0xA143, 0xA143, 0xA943, 0xB9C4, 0xB984, 0xB163, 0xA143, 0x9143, 0x7123, 0x48A2, 0x30A2, 0x20A2, 0x18A2, 0x1082,   // 0x2730 (10032) pixels
-  0x1082, 0x1062, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2740 (10048) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2750 (10064) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2760 (10080) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2770 (10096) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2780 (10112) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2790 (10128) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x27A0 (10144) pixels
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x2104, 0x10A3, 0x1904, 0x18E3, 0x18E3, 0x3186, 0x18C3, 0x0882, 0x0862, 0x0861, 0x0861,   // 0x27B0 (10160) pixels
-  0x0841, 0x0021, 0x0021, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x27C0 (10176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0861, 0x0861, 0x0862, 0x0861, 0x1861, 0x3081,   // 0x27D0 (10192) pixels
-  0x7185, 0x99A4, 0xA123, 0x9922, 0xA143, 0xA143, 0xA143, 0xA143, 0xA143, 0xA143, 0xA143, 0xA143, 0xA943, 0xA943, 0xB9C5, 0xB984,   // 0x27E0 (10208) pixels
-  0xB163, 0xA143, 0x9143, 0x7123, 0x48A2, 0x30A2, 0x20A2, 0x1882, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x27F0 (10224) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2800 (10240) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2810 (10256) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2820 (10272) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2830 (10288) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2840 (10304) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2850 (10320) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x2104, 0x10A3,   // 0x2860 (10336) pixels
-  0x2104, 0x18E4, 0x18E4, 0x31A6, 0x18C3, 0x0882, 0x0862, 0x0861, 0x0861, 0x0841, 0x0021, 0x0020, 0x0020, 0x0000, 0x0020, 0x0841,   // 0x2870 (10352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2880 (10368) pixels
-  0x0000, 0x0000, 0x0861, 0x0861, 0x0861, 0x0862, 0x0861, 0x1861, 0x3081, 0x7185, 0x99A4, 0xA143, 0x9922, 0xA143, 0xA163, 0xA163,   // 0x2890 (10384) pixels
-  0xA943, 0xA943, 0xA163, 0xA163, 0xA143, 0xA143, 0xA943, 0xB9C5, 0xB9A4, 0xB163, 0xA143, 0x9143, 0x7123, 0x48A2, 0x30A2, 0x20A2,   // 0x28A0 (10400) pixels
-  0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x28B0 (10416) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x28C0 (10432) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x28D0 (10448) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x28E0 (10464) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x28F0 (10480) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2900 (10496) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2910 (10512) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10C2, 0x18C3, 0x2124, 0x10A3, 0x2124, 0x2104, 0x2104, 0x3186, 0x18C3, 0x0882, 0x0862,   // 0x2920 (10528) pixels
-  0x0861, 0x0861, 0x0862, 0x0882, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2930 (10544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0861, 0x0861, 0x0862, 0x1082,   // 0x2940 (10560) pixels
-  0x1861, 0x3081, 0x7164, 0x99A4, 0xA143, 0x9923, 0xA143, 0xA963, 0xA963, 0xA963, 0xA963, 0xA943, 0xA963, 0xA143, 0xA943, 0xA943,   // 0x2950 (10576) pixels
-  0xB9C5, 0xB9A4, 0xB184, 0xA143, 0x9143, 0x7123, 0x48A2, 0x30A2, 0x20A2, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2960 (10592) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2970 (10608) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2980 (10624) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2990 (10640) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x29A0 (10656) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x29B0 (10672) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x29C0 (10688) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10C2, 0x10C2, 0x18C3,   // 0x29D0 (10704) pixels
-  0x2125, 0x10A3, 0x2125, 0x2104, 0x2104, 0x31A6, 0x10A3, 0x1082, 0x0862, 0x0861, 0x0861, 0x18C3, 0x2125, 0x2125, 0x2125, 0x2124,   // 0x29E0 (10720) pixels
-  0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29F0 (10736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0861, 0x0841, 0x1082, 0x1082, 0x1861, 0x3081, 0x6964, 0x99A5, 0xA143, 0x9922, 0xA163,   // 0x2A00 (10752) pixels
-  0xA963, 0xA963, 0xA963, 0xA963, 0xA963, 0xA963, 0xA963, 0xA943, 0xA943, 0xB9C5, 0xB9A4, 0xB163, 0xA143, 0x9144, 0x7123, 0x48C2,   // 0x2A10 (10768) pixels
-  0x30A2, 0x20C3, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2A20 (10784) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2A30 (10800) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2A40 (10816) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2A50 (10832) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2A60 (10848) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2A70 (10864) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2A80 (10880) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x2925, 0x10C3, 0x2945, 0x2104, 0x2124, 0x31C7, 0x10A3,   // 0x2A90 (10896) pixels
-  0x1082, 0x0862, 0x0861, 0x0861, 0x2125, 0x31C7, 0x31C7, 0x31C7, 0x29A7, 0x2986, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AA0 (10912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0861, 0x0861,   // 0x2AB0 (10928) pixels
-  0x0861, 0x1082, 0x1861, 0x3081, 0x6964, 0x99A5, 0xA143, 0xA122, 0xA143, 0xA963, 0xA963, 0xA963, 0xA963, 0xA963, 0xA963, 0xA963,   // 0x2AC0 (10944) pixels
-  0xA943, 0xA943, 0xB9C5, 0xB9A4, 0xB183, 0xA143, 0x9164, 0x6903, 0x48C2, 0x30C3, 0x20C3, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082,   // 0x2AD0 (10960) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2AE0 (10976) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2AF0 (10992) pixels
-  0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2B00 (11008) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2B10 (11024) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2B20 (11040) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2B30 (11056) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18C3,   // 0x2B40 (11072) pixels
-  0x18C3, 0x18C4, 0x2945, 0x18C3, 0x2945, 0x2104, 0x2124, 0x39C7, 0x10A3, 0x1082, 0x0882, 0x0861, 0x0862, 0x2986, 0x4A6A, 0x426A,   // 0x2B50 (11088) pixels
-  0x4269, 0x4249, 0x31A7, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B60 (11104) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0861, 0x0861, 0x0861, 0x1082, 0x1861, 0x30A2, 0x6964, 0x99A5, 0xA143,   // 0x2B70 (11120) pixels
-  0xA122, 0xA143, 0xA963, 0xA963, 0xA963, 0xA963, 0xA963, 0xA963, 0xA963, 0xA943, 0xA943, 0xC1C5, 0xB9A4, 0xB183, 0xA943, 0x9164,   // 0x2B80 (11136) pixels
-  0x6903, 0x48C2, 0x30C3, 0x20C3, 0x18A3, 0x18A3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2B90 (11152) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2BA0 (11168) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2BB0 (11184) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2BC0 (11200) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2BD0 (11216) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2BE0 (11232) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2BF0 (11248) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E4, 0x2945, 0x18C3, 0x2965, 0x2124, 0x2124,   // 0x2C00 (11264) pixels
-  0x31A7, 0x10A3, 0x1082, 0x0882, 0x0861, 0x0862, 0x2125, 0x31A7, 0x31A6, 0x2986, 0x2145, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C10 (11280) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082,   // 0x2C20 (11296) pixels
-  0x1082, 0x0861, 0x0861, 0x1082, 0x1861, 0x30C2, 0x6964, 0x99A5, 0xA143, 0xA123, 0xA163, 0xA963, 0xA963, 0xA964, 0xA963, 0xA963,   // 0x2C30 (11312) pixels
-  0xA963, 0xA963, 0xA963, 0xA943, 0xC1C5, 0xB9A4, 0xB183, 0xA943, 0x9144, 0x6903, 0x40C2, 0x30C2, 0x20C3, 0x18A3, 0x18A3, 0x10A2,   // 0x2C40 (11328) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2C50 (11344) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2C60 (11360) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2C70 (11376) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2C80 (11392) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2C90 (11408) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2CA0 (11424) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2CB0 (11440) pixels
-  0x10A2, 0x18C3, 0x18C3, 0x18E4, 0x2966, 0x18E3, 0x2966, 0x2125, 0x2124, 0x31A6, 0x10A3, 0x1082, 0x0862, 0x0861, 0x0861, 0x10A3,   // 0x2CC0 (11456) pixels
-  0x1082, 0x1082, 0x0882, 0x0862, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CD0 (11472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x1082, 0x0861, 0x0861, 0x1082, 0x1881, 0x30C2, 0x6944,   // 0x2CE0 (11488) pixels
-  0x99A4, 0xA143, 0xA143, 0xA963, 0xA964, 0xB164, 0xB163, 0xB163, 0xB164, 0xA964, 0xA963, 0xA963, 0xA943, 0xC1C5, 0xB9A4, 0xB183,   // 0x2CF0 (11504) pixels
-  0xA143, 0x9164, 0x6903, 0x40C3, 0x30C3, 0x20C3, 0x20C3, 0x18A3, 0x10A3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2D00 (11520) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2D10 (11536) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2D20 (11552) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2D30 (11568) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2D40 (11584) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2D50 (11600) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2D60 (11616) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A3, 0x18C3, 0x18C3, 0x18E4, 0x2966, 0x18E3, 0x2966,   // 0x2D70 (11632) pixels
-  0x2145, 0x2124, 0x3186, 0x10A3, 0x1082, 0x0862, 0x0861, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x0862, 0x0000, 0x0000, 0x0000,   // 0x2D80 (11648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D90 (11664) pixels
-  0x0000, 0x1082, 0x1082, 0x0861, 0x0861, 0x1082, 0x1881, 0x30C2, 0x6144, 0x99A5, 0xA143, 0xA123, 0xA963, 0xA943, 0xB164, 0xB163,   // 0x2DA0 (11680) pixels
-  0xB163, 0xB164, 0xB164, 0xA963, 0xA963, 0xA943, 0xB9A5, 0xB9A4, 0xB184, 0xA143, 0x9164, 0x6103, 0x40C3, 0x30E3, 0x20C3, 0x18C3,   // 0x2DB0 (11696) pixels
-  0x18A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2DC0 (11712) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2DD0 (11728) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2DE0 (11744) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2DF0 (11760) pixels
-  0x10A2, 0x10A2, 0x10A3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2E00 (11776) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2E10 (11792) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2E20 (11808) pixels
-  0x10A3, 0x10A2, 0x10A3, 0x18C3, 0x18E3, 0x18E4, 0x2966, 0x18E4, 0x2986, 0x2945, 0x2104, 0x3186, 0x10A3, 0x1082, 0x0862, 0x0861,   // 0x2E30 (11824) pixels
-  0x0861, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E40 (11840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x10A2, 0x0861, 0x0861, 0x1082, 0x1882,   // 0x2E50 (11856) pixels
-  0x30A2, 0x6144, 0x99A5, 0xA143, 0xA143, 0xA963, 0xB164, 0xB164, 0xB164, 0xB183, 0xB164, 0xB164, 0xB163, 0xB163, 0xA943, 0xC1C5,   // 0x2E60 (11872) pixels
-  0xC1C5, 0xB184, 0xA163, 0x9164, 0x6103, 0x40C3, 0x30E3, 0x20C3, 0x18C3, 0x18A3, 0x18A3, 0x10A3, 0x10A2, 0x10C2, 0x10A3, 0x10A3,   // 0x2E70 (11888) pixels
-  0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3,   // 0x2E80 (11904) pixels
-  0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3,   // 0x2E90 (11920) pixels
-  0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3,   // 0x2EA0 (11936) pixels
-  0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3,   // 0x2EB0 (11952) pixels
-  0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3,   // 0x2EC0 (11968) pixels
-  0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3,   // 0x2ED0 (11984) pixels
-  0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x18E3, 0x18E3, 0x18E3, 0x2965,   // 0x2EE0 (12000) pixels
-  0x18E4, 0x3186, 0x2945, 0x2104, 0x3186, 0x10A2, 0x1082, 0x0862, 0x0861, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EF0 (12016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F00 (12032) pixels
-  0x0000, 0x0000, 0x0020, 0x1082, 0x18E3, 0x0861, 0x1081, 0x1082, 0x1882, 0x30C2, 0x6144, 0x99A5, 0xA943, 0xA143, 0xA964, 0xB164,   // 0x2F10 (12048) pixels
-  0xB184, 0xB184, 0xB163, 0xB164, 0xB184, 0xB183, 0xB163, 0xB143, 0xC1A4, 0xC1A5, 0xB184, 0xA943, 0x9164, 0x6103, 0x40E3, 0x30E3,   // 0x2F20 (12064) pixels
-  0x20C3, 0x20C3, 0x18C3, 0x18C3, 0x10A3, 0x10C2, 0x10C2, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3,   // 0x2F30 (12080) pixels
-  0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10C3, 0x10C3, 0x18C3,   // 0x2F40 (12096) pixels
-  0x18C3, 0x10C3, 0x10C3, 0x18C3, 0x18C3, 0x10C3, 0x10C3, 0x10C3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3,   // 0x2F50 (12112) pixels
-  0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10A3, 0x10C2, 0x10A3,   // 0x2F60 (12128) pixels
-  0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10A3,   // 0x2F70 (12144) pixels
-  0x10A3, 0x10C2, 0x10C2, 0x10A3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C2, 0x10C2, 0x10A3, 0x10A3, 0x10C2, 0x10C3, 0x10C3,   // 0x2F80 (12160) pixels
-  0x10C3, 0x10C3, 0x10C3, 0x10A3, 0x10A3, 0x10C2, 0x10C2, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C3,   // 0x2F90 (12176) pixels
-  0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x10C3, 0x18E3, 0x18C3, 0x18E3, 0x2965, 0x2104, 0x3186, 0x2965, 0x2104, 0x3186, 0x10A2, 0x1082,   // 0x2FA0 (12192) pixels
-  0x0882, 0x0861, 0x0862, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FB0 (12208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x18E3, 0x0881, 0x1081,   // 0x2FC0 (12224) pixels
-  0x1082, 0x1882, 0x28C2, 0x6144, 0x99A5, 0xA963, 0xA943, 0xA964, 0xB164, 0xB184, 0xB184, 0xB984, 0xB984, 0xB984, 0xB183, 0xB163,   // 0x2FD0 (12240) pixels
-  0xB143, 0xC1A4, 0xC1C5, 0xB184, 0xA943, 0x9164, 0x60E3, 0x40E3, 0x30E3, 0x20E3, 0x20C3, 0x18C3, 0x18C3, 0x18C3, 0x10C3, 0x10C3,   // 0x2FE0 (12256) pixels
-  0x18A3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x2FF0 (12272) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3000 (12288) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3010 (12304) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18A3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3020 (12320) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3030 (12336) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3040 (12352) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3,   // 0x3050 (12368) pixels
-  0x18E4, 0x2966, 0x2145, 0x3186, 0x2986, 0x2124, 0x3186, 0x10A2, 0x10A2, 0x0882, 0x0861, 0x0862, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x3060 (12384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3070 (12400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1081, 0x18E3, 0x1081, 0x1082, 0x1082, 0x1882, 0x30E3, 0x6164, 0x99A5, 0xA963, 0xA943,   // 0x3080 (12416) pixels
-  0xB163, 0xB184, 0xB984, 0xB984, 0xB984, 0xB984, 0xB984, 0xB984, 0xB163, 0xB143, 0xC1C5, 0xC1C5, 0xB184, 0xA163, 0x9144, 0x5903,   // 0x3090 (12432) pixels
-  0x40E3, 0x30E3, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x18C3, 0x10C3, 0x10C3, 0x18A3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x30A0 (12448) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x30B0 (12464) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x30C0 (12480) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x30D0 (12496) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x30E0 (12512) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x30F0 (12528) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3100 (12544) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x3186, 0x2965, 0x31A6, 0x3186, 0x2125, 0x3186,   // 0x3110 (12560) pixels
-  0x10A2, 0x10A2, 0x0882, 0x0861, 0x0862, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3120 (12576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2104,   // 0x3130 (12592) pixels
-  0x1082, 0x1082, 0x10A2, 0x18A2, 0x30E3, 0x5964, 0x99A5, 0xA963, 0xA943, 0xB164, 0xB984, 0xB984, 0xB984, 0xB984, 0xB984, 0xB984,   // 0x3140 (12608) pixels
-  0xB984, 0xB983, 0xB163, 0xC1A4, 0xC1C5, 0xB984, 0xA963, 0x8944, 0x58E3, 0x38E3, 0x3104, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x18C3,   // 0x3150 (12624) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3160 (12640) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3170 (12656) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3180 (12672) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3190 (12688) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x31A0 (12704) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x31B0 (12720) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x31C0 (12736) pixels
-  0x18E3, 0x2104, 0x2104, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x2965, 0x3186, 0x10A2, 0x10A3, 0x1082, 0x0861, 0x0862, 0x0020, 0x0000,   // 0x31D0 (12752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31E0 (12768) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2104, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x3104, 0x5964, 0xA1C5,   // 0x31F0 (12784) pixels
-  0xB163, 0xB163, 0xB984, 0xB984, 0xC1A4, 0xC1A4, 0xC1A4, 0xC1A4, 0xC1A4, 0xC1A4, 0xB984, 0xB963, 0xC1A4, 0xC1C5, 0xB9A4, 0xA963,   // 0x3200 (12800) pixels
-  0x8944, 0x50C3, 0x38E3, 0x28E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3,   // 0x3210 (12816) pixels
-  0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3,   // 0x3220 (12832) pixels
-  0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3230 (12848) pixels
-  0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3240 (12864) pixels
-  0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3,   // 0x3250 (12880) pixels
-  0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3260 (12896) pixels
-  0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3,   // 0x3270 (12912) pixels
-  0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x2104, 0x2124, 0x3186, 0x31A7, 0x31A6, 0x31A6,   // 0x3280 (12928) pixels
-  0x3186, 0x2986, 0x10A2, 0x1082, 0x0882, 0x0861, 0x0862, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3290 (12944) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32A0 (12960) pixels
-  0x1082, 0x2124, 0x10A2, 0x10A2, 0x10A3, 0x18C2, 0x3944, 0x6185, 0xA1C5, 0xB984, 0xB983, 0xC184, 0xC9C4, 0xC9C5, 0xC9C5, 0xC9C5,   // 0x32B0 (12976) pixels
-  0xC9C5, 0xC9C5, 0xC9C4, 0xC1A4, 0xC184, 0xC9A4, 0xC9C5, 0xB9A4, 0xA964, 0x8943, 0x50E3, 0x3904, 0x3104, 0x2104, 0x20E3, 0x18E3,   // 0x32C0 (12992) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x32D0 (13008) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x32E0 (13024) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x32F0 (13040) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3300 (13056) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3310 (13072) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3320 (13088) pixels
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3330 (13104) pixels
-  0x18E3, 0x18E3, 0x18E4, 0x2104, 0x2125, 0x31A6, 0x39E8, 0x39C7, 0x31A7, 0x31C7, 0x2966, 0x10A3, 0x1082, 0x0882, 0x0862, 0x0862,   // 0x3340 (13120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3350 (13136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x18C3, 0x10C3, 0x18C3, 0x20E3, 0x3985,   // 0x3360 (13152) pixels
-  0x69A6, 0xB206, 0xC9E5, 0xC9E5, 0xD1E5, 0xD1E6, 0xD1E6, 0xD206, 0xD206, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E5, 0xC9C5, 0xD1E5, 0xD1E5,   // 0x3370 (13168) pixels
-  0xC1C5, 0xB184, 0x8964, 0x5103, 0x4124, 0x3124, 0x2924, 0x2924, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x3380 (13184) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x3390 (13200) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x33A0 (13216) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x33B0 (13232) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x33C0 (13248) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x33D0 (13264) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x33E0 (13280) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2945, 0x2966, 0x39E7, 0x4A49,   // 0x33F0 (13296) pixels
-  0x39E8, 0x39C7, 0x3A08, 0x2966, 0x10C3, 0x10A3, 0x1082, 0x1082, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3400 (13312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3410 (13328) pixels
-  0x0000, 0x0000, 0x0861, 0x31A6, 0x4208, 0x4208, 0x4228, 0x4A28, 0x5A69, 0x69E7, 0xBA68, 0xDA68, 0xDA68, 0xDA67, 0xDA68, 0xDA68,   // 0x3420 (13344) pixels
-  0xDA68, 0xE268, 0xDA47, 0xE247, 0xDA47, 0xDA26, 0xD1E6, 0xDA06, 0xDA06, 0xC9E5, 0xB1C5, 0x8964, 0x5924, 0x4165, 0x3965, 0x3165,   // 0x3430 (13360) pixels
-  0x3165, 0x2945, 0x2945, 0x2945, 0x2945, 0x2145, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x3440 (13376) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,   // 0x3450 (13392) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x3460 (13408) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x3470 (13424) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x3480 (13440) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x3490 (13456) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x34A0 (13472) pixels
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x3186, 0x31A7, 0x4208, 0x52AA, 0x4249, 0x39E7, 0x4228, 0x31A7, 0x2145, 0x2125, 0x2124,   // 0x34B0 (13488) pixels
-  0x18E4, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34C0 (13504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x39E7, 0x5ACB, 0x5AEB, 0x5AEC,   // 0x34D0 (13520) pixels
-  0x630C, 0x6B0B, 0x7228, 0xC30B, 0xEB4C, 0xEB0B, 0xE2C9, 0xE2C9, 0xE2A9, 0xE2A9, 0xE2A9, 0xE2A9, 0xE289, 0xE268, 0xE247, 0xDA06,   // 0x34E0 (13536) pixels
-  0xDA26, 0xDA26, 0xC9E5, 0xB1C5, 0x8164, 0x5124, 0x4165, 0x3965, 0x3966, 0x3166, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x34F0 (13552) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3500 (13568) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3510 (13584) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3520 (13600) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3530 (13616) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3540 (13632) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2966, 0x2966, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3550 (13648) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x39C7,   // 0x3560 (13664) pixels
-  0x4228, 0x5AEB, 0x52CB, 0x4208, 0x4228, 0x31C7, 0x2986, 0x2966, 0x2145, 0x1904, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3570 (13680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3580 (13696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x39E7, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x734C, 0x7289, 0xC40F, 0xFCD2, 0xF42F, 0xE32B,   // 0x3590 (13712) pixels
-  0xE2EA, 0xE2CA, 0xE2CA, 0xE2AA, 0xE2A9, 0xE2A9, 0xE289, 0xDA48, 0xDA06, 0xDA26, 0xDA26, 0xC9E5, 0xA9C5, 0x8164, 0x5965, 0x4186,   // 0x35A0 (13728) pixels
-  0x3986, 0x3986, 0x3186, 0x3186, 0x3166, 0x2986, 0x2986, 0x2986, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x35B0 (13744) pixels
-  0x3186, 0x3186, 0x2986, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x35C0 (13760) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x35D0 (13776) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,   // 0x35E0 (13792) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2986, 0x2986, 0x2986, 0x2986, 0x2986, 0x2986, 0x2986, 0x2986, 0x2986, 0x2986,   // 0x35F0 (13808) pixels
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2986, 0x2986,   // 0x3600 (13824) pixels
-  0x2986, 0x2986, 0x2986, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2986, 0x2986, 0x3186, 0x2986, 0x2986, 0x2986,   // 0x3610 (13840) pixels
-  0x2986, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A7, 0x39E7, 0x4249, 0x632D, 0x632D, 0x4228, 0x3A08, 0x39E8, 0x31C7,   // 0x3620 (13856) pixels
-  0x29A7, 0x2966, 0x2145, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3630 (13872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x39C7, 0x6B4D,   // 0x3640 (13888) pixels
-  0x6B6D, 0x738E, 0x738E, 0x7B8D, 0x72CA, 0xC471, 0xFDF7, 0xF492, 0xE36D, 0xE34C, 0xE32C, 0xE32C, 0xE32B, 0xE30B, 0xE30B, 0xE2EA,   // 0x3650 (13904) pixels
-  0xE2A9, 0xDA48, 0xE247, 0xDA06, 0xCA05, 0xA9C5, 0x7964, 0x5985, 0x41A6, 0x41A6, 0x39C6, 0x39A7, 0x31A6, 0x31A7, 0x31A7, 0x31A6,   // 0x3660 (13920) pixels
-  0x31A7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x3670 (13936) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A7, 0x31A7, 0x31A6, 0x31A6, 0x31A6,   // 0x3680 (13952) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x3690 (13968) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x36A0 (13984) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x36B0 (14000) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x36C0 (14016) pixels
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,   // 0x36D0 (14032) pixels
-  0x31C7, 0x3A08, 0x4A49, 0x6B6E, 0x73AF, 0x4A69, 0x39E7, 0x4229, 0x3A29, 0x39E8, 0x31C7, 0x2986, 0x10A2, 0x0000, 0x0000, 0x0000,   // 0x36E0 (14048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36F0 (14064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x3186, 0x6B6D, 0x73AE, 0x7BCF, 0x7BEF, 0x83CF, 0x72EB, 0xC491, 0xFE79,   // 0x3700 (14080) pixels
-  0xFCF3, 0xE3CE, 0xE3AE, 0xEBAE, 0xEBAE, 0xEBAE, 0xEB8E, 0xEB6D, 0xEB4C, 0xE2EB, 0xE289, 0xE268, 0xDA26, 0xC205, 0xA1C5, 0x7185,   // 0x3710 (14096) pixels
-  0x51A6, 0x41C7, 0x41C7, 0x39C7, 0x39C7, 0x39C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7,   // 0x3720 (14112) pixels
-  0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7,   // 0x3730 (14128) pixels
-  0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7,   // 0x3740 (14144) pixels
-  0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7,   // 0x3750 (14160) pixels
-  0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x3760 (14176) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x3770 (14192) pixels
-  0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7,   // 0x3780 (14208) pixels
-  0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x39C7, 0x4208, 0x4A6A, 0x6B6D, 0x7BEF, 0x52AB, 0x39E8,   // 0x3790 (14224) pixels
-  0x4A6A, 0x4A8B, 0x424A, 0x4229, 0x31C7, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37A0 (14240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841,   // 0x37B0 (14256) pixels
-  0x2945, 0x632C, 0x8410, 0x8430, 0x8430, 0x8C30, 0x730B, 0xB3EF, 0xFDB6, 0xF491, 0xE3AE, 0xF3EF, 0xF3EE, 0xF3EF, 0xF3EE, 0xF3CE,   // 0x37C0 (14272) pixels
-  0xF3AE, 0xF38D, 0xF32B, 0xEAEA, 0xE288, 0xDA26, 0xC1E5, 0x99C5, 0x7185, 0x51A6, 0x41C7, 0x41E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7,   // 0x37D0 (14288) pixels
-  0x39C7, 0x39C7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x37E0 (14304) pixels
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7,   // 0x37F0 (14320) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7,   // 0x3800 (14336) pixels
-  0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7,   // 0x3810 (14352) pixels
-  0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39C7,   // 0x3820 (14368) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,   // 0x3830 (14384) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39E7, 0x39E7, 0x39C7,   // 0x3840 (14400) pixels
-  0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4A49, 0x634D, 0x8430, 0x630C, 0x3A08, 0x5B0C, 0x5B0D, 0x52EC, 0x52AB, 0x4249, 0x0862, 0x0000,   // 0x3850 (14416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3860 (14432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x52AA, 0x7BEF, 0x8410, 0x8C30, 0x8C30, 0x7B0B,   // 0x3870 (14448) pixels
-  0xA30B, 0xEC70, 0xE38D, 0xDAEB, 0xE2CA, 0xE2C9, 0xE2CA, 0xE2C9, 0xE2C9, 0xE2A9, 0xE2A9, 0xE288, 0xE268, 0xDA47, 0xD206, 0xB1C5,   // 0x3880 (14464) pixels
-  0x91A5, 0x6985, 0x51A6, 0x41C7, 0x41E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,   // 0x3890 (14480) pixels
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x31C7, 0x39E7, 0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x31C7, 0x31C7,   // 0x38A0 (14496) pixels
-  0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,   // 0x38B0 (14512) pixels
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7,   // 0x38C0 (14528) pixels
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,   // 0x38D0 (14544) pixels
-  0x31C7, 0x31C7, 0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,   // 0x38E0 (14560) pixels
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39E7, 0x31C7, 0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x31C7, 0x31C7, 0x31C7, 0x31C7,   // 0x38F0 (14576) pixels
-  0x39C7, 0x39C7, 0x31C7, 0x31C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x4208, 0x4249, 0x632C, 0x8410,   // 0x3900 (14592) pixels
-  0x6B6E, 0x4229, 0x632D, 0x636E, 0x5B2D, 0x5B0D, 0x3A08, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3910 (14608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3920 (14624) pixels
-  0x0000, 0x0020, 0x18C3, 0x39C7, 0x6B6D, 0x7BCF, 0x7BCF, 0x83EF, 0x72AA, 0x9A89, 0xEC0F, 0xEB6C, 0xDA88, 0xD227, 0xDA27, 0xDA27,   // 0x3930 (14640) pixels
-  0xDA27, 0xDA27, 0xD206, 0xD206, 0xD206, 0xDA06, 0xD206, 0xC9E5, 0xA984, 0x89C6, 0x61A6, 0x51E7, 0x4A08, 0x4208, 0x4208, 0x4208,   // 0x3940 (14656) pixels
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x4208, 0x3A08, 0x4228, 0x4228, 0x3A08,   // 0x3950 (14672) pixels
-  0x3A08, 0x4208, 0x4208, 0x4208, 0x3A08, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08,   // 0x3960 (14688) pixels
-  0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x3A08,   // 0x3970 (14704) pixels
-  0x3A08, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,   // 0x3980 (14720) pixels
-  0x4208, 0x4208, 0x4208, 0x4208, 0x3A08, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x4228,   // 0x3990 (14736) pixels
-  0x4228, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x4208,   // 0x39A0 (14752) pixels
-  0x3A08, 0x3A08, 0x4208, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x3A08, 0x3A08, 0x4208, 0x4208, 0x4208,   // 0x39B0 (14768) pixels
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4A49, 0x632D, 0x7BF0, 0x6B8E, 0x4229, 0x5B2D, 0x5B2D, 0x5B0C, 0x52EC, 0x2166,   // 0x39C0 (14784) pixels
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39D0 (14800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x2124, 0x4208, 0x528A, 0x52AA,   // 0x39E0 (14816) pixels
-  0x52AA, 0x51C6, 0x89E6, 0xC289, 0xD247, 0xD227, 0xD226, 0xDA26, 0xDA26, 0xDA26, 0xDA26, 0xD206, 0xD206, 0xD206, 0xD206, 0xD226,   // 0x39F0 (14832) pixels
-  0xCA05, 0xA184, 0x6944, 0x38E3, 0x2904, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x3A00 (14848) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x3A10 (14864) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x3A20 (14880) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x3A30 (14896) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x3A40 (14912) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x3A50 (14928) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x3A60 (14944) pixels
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2966,   // 0x3A70 (14960) pixels
-  0x52AA, 0x6B6E, 0x632D, 0x2986, 0x2986, 0x2986, 0x2966, 0x2125, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A80 (14976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A90 (14992) pixels
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x38E3, 0x7164, 0xA9E6, 0xB9E5, 0xB9C5, 0xB9E6,   // 0x3AA0 (15008) pixels
-  0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E5, 0xB9E5, 0xB9E6, 0xB1E6, 0x99C6, 0x48C2, 0x1820, 0x1021, 0x0841, 0x0841,   // 0x3AB0 (15024) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x3AC0 (15040) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x3AD0 (15056) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x3AE0 (15072) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x3AF0 (15088) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x3B00 (15104) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x3B10 (15120) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x3B20 (15136) pixels
-  0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x18E3, 0x4229, 0x5AEB, 0x4A6A, 0x2125, 0x10A3, 0x0882, 0x1082,   // 0x3B30 (15152) pixels
-  0x0861, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B40 (15168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2104, 0x2124,   // 0x3B50 (15184) pixels
-  0x10A2, 0x18C3, 0x18E3, 0x30C3, 0x6944, 0x9A06, 0xA1E6, 0x9985, 0x8944, 0x8144, 0x8144, 0x8144, 0x8144, 0x8144, 0x8144, 0x8144,   // 0x3B60 (15200) pixels
-  0x8144, 0x8144, 0x8144, 0x6944, 0x38A2, 0x20A2, 0x18A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2,   // 0x3B70 (15216) pixels
-  0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A2,   // 0x3B80 (15232) pixels
-  0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2,   // 0x3B90 (15248) pixels
-  0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2,   // 0x3BA0 (15264) pixels
-  0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A2, 0x10A2,   // 0x3BB0 (15280) pixels
-  0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A2, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2,   // 0x3BC0 (15296) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A2, 0x10A2,   // 0x3BD0 (15312) pixels
-  0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x10A2, 0x10A3, 0x10A3, 0x10C2, 0x10A2,   // 0x3BE0 (15328) pixels
-  0x10A3, 0x2104, 0x39C7, 0x4A69, 0x4229, 0x1904, 0x10A2, 0x0882, 0x0862, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BF0 (15344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C00 (15360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2965, 0x2965, 0x2965, 0x3186, 0x3965, 0x6185, 0x81C6, 0x89C6,   // 0x3C10 (15376) pixels
-  0x7964, 0x7144, 0x6944, 0x6944, 0x6965, 0x6944, 0x6944, 0x6944, 0x6944, 0x6944, 0x6965, 0x6164, 0x5944, 0x4145, 0x3145, 0x2945,   // 0x3C20 (15392) pixels
-  0x2965, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3C30 (15408) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3C40 (15424) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3C50 (15440) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3C60 (15456) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3C70 (15472) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3C80 (15488) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,   // 0x3C90 (15504) pixels
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2966, 0x3186, 0x39C7, 0x39E7, 0x3A08, 0x2986, 0x2145,   // 0x3CA0 (15520) pixels
-  0x1904, 0x2104, 0x18E3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3CB0 (15536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3CC0 (15552) pixels
-  0x0020, 0x18E3, 0x39C7, 0x4208, 0x39E7, 0x49E7, 0x5185, 0x5944, 0x6124, 0x5903, 0x5103, 0x5103, 0x48E3, 0x5103, 0x50E3, 0x5103,   // 0x3CD0 (15568) pixels
-  0x5103, 0x5103, 0x5103, 0x4903, 0x4903, 0x38E3, 0x28C3, 0x18C3, 0x18A3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3CE0 (15584) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3CF0 (15600) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3D00 (15616) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3D10 (15632) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A3, 0x18C3, 0x18C3, 0x18C3,   // 0x3D20 (15648) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3D30 (15664) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3D40 (15680) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x3D50 (15696) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x18C3, 0x18E3, 0x10C3, 0x10C3, 0x10A3, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D60 (15712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D70 (15728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x2104, 0x2104, 0x2104, 0x2903, 0x30C3,   // 0x3D80 (15744) pixels
-  0x3082, 0x3861, 0x3861, 0x3061, 0x3061, 0x3061, 0x3061, 0x3061, 0x3061, 0x3061, 0x3061, 0x3061, 0x3061, 0x2861, 0x2061, 0x1861,   // 0x3D90 (15760) pixels
-  0x1061, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861,   // 0x3DA0 (15776) pixels
-  0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3DB0 (15792) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3DC0 (15808) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0861,   // 0x3DD0 (15824) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x3DE0 (15840) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x3DF0 (15856) pixels
-  0x0862, 0x0862, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861,   // 0x3E00 (15872) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0841, 0x0862,   // 0x3E10 (15888) pixels
-  0x1082, 0x0862, 0x0862, 0x0861, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E20 (15904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E30 (15920) pixels
-  0x0000, 0x0000, 0x0841, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1081, 0x2882, 0x3082, 0x3882, 0x3061, 0x3061, 0x2861, 0x2861, 0x2861,   // 0x3E40 (15936) pixels
-  0x3061, 0x3061, 0x3061, 0x3061, 0x3061, 0x2861, 0x2861, 0x2061, 0x1861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3E50 (15952) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3E60 (15968) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3E70 (15984) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3E80 (16000) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3E90 (16016) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3EA0 (16032) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3EB0 (16048) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3EC0 (16064) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A3, 0x18C3, 0x18C3, 0x1082, 0x1082, 0x0862, 0x0861, 0x0841, 0x0020, 0x0000,   // 0x3ED0 (16080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3EE0 (16096) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861,   // 0x3EF0 (16112) pixels
-  0x1041, 0x2061, 0x3082, 0x38A2, 0x3881, 0x3061, 0x3081, 0x3081, 0x3081, 0x3061, 0x3061, 0x3061, 0x3081, 0x3081, 0x3081, 0x3081,   // 0x3F00 (16128) pixels
-  0x2861, 0x1020, 0x0820, 0x0821, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x3F10 (16144) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020,   // 0x3F20 (16160) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021,   // 0x3F30 (16176) pixels
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0040, 0x0040, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,   // 0x3F40 (16192) pixels
-  0x0021, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0041, 0x0041, 0x0041, 0x0041,   // 0x3F50 (16208) pixels
-  0x0041, 0x0841, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0841,   // 0x3F60 (16224) pixels
-  0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021,   // 0x3F70 (16240) pixels
-  0x0021, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0841, 0x0021, 0x0861, 0x18C3,   // 0x3F80 (16256) pixels
-  0x18E4, 0x18C3, 0x0862, 0x0841, 0x0021, 0x0021, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F90 (16272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3FA0 (16288) pixels
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1061, 0x2861, 0x38A2, 0x4081, 0x4081, 0x4081, 0x4081,   // 0x3FB0 (16304) pixels
-  0x4081, 0x40A1, 0x4081, 0x4081, 0x4081, 0x40A1, 0x4081, 0x4081, 0x4081, 0x3081, 0x1841, 0x0800, 0x0820, 0x0020, 0x0020, 0x0020,   // 0x3FC0 (16320) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x3FD0 (16336) pixels
-  0x0020, 0x0020, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x3FE0 (16352) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x3FF0 (16368) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4000 (16384) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4010 (16400) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4020 (16416) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4030 (16432) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0020, 0x0861, 0x18E3, 0x2104, 0x18E4, 0x0862, 0x0841, 0x0841, 0x0021, 0x0021,   // 0x4040 (16448) pixels
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4050 (16464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x18E3, 0x2104,   // 0x4060 (16480) pixels
-  0x2104, 0x2104, 0x20A2, 0x30A2, 0x48E3, 0x48C2, 0x48C2, 0x48A2, 0x48A2, 0x48C2, 0x48C2, 0x48A2, 0x48A2, 0x48A2, 0x48A1, 0x48A1,   // 0x4070 (16496) pixels
-  0x48A2, 0x4881, 0x3860, 0x2861, 0x1861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4080 (16512) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0882, 0x0882, 0x1082,   // 0x4090 (16528) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x40A0 (16544) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x40B0 (16560) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x40C0 (16576) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x40D0 (16592) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x40E0 (16608) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0862, 0x1082, 0x1082,   // 0x40F0 (16624) pixels
-  0x10A2, 0x2104, 0x2945, 0x2124, 0x10A2, 0x10A3, 0x10A3, 0x10A2, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4100 (16640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4110 (16656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10A2, 0x2124, 0x2945, 0x2945, 0x2965, 0x28E3, 0x30C3, 0x5165, 0x5124, 0x48C3,   // 0x4120 (16672) pixels
-  0x48C2, 0x48C2, 0x48C2, 0x48C2, 0x48C2, 0x48A2, 0x48A2, 0x48A2, 0x48A2, 0x48A1, 0x4881, 0x3860, 0x2881, 0x20A2, 0x18C2, 0x18C2,   // 0x4130 (16688) pixels
-  0x18C3, 0x18A3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x4140 (16704) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x4150 (16720) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x4160 (16736) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x4170 (16752) pixels
-  0x10C3, 0x10C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x4180 (16768) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x18C3, 0x18C3,   // 0x4190 (16784) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x41A0 (16800) pixels
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A3, 0x10A3, 0x18C3, 0x18C3, 0x2104, 0x2965, 0x2125, 0x18C3, 0x2104, 0x2124,   // 0x41B0 (16816) pixels
-  0x2104, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x41C0 (16832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x18E3,   // 0x41D0 (16848) pixels
-  0x2945, 0x2965, 0x2965, 0x2965, 0x2903, 0x3904, 0x5185, 0x4924, 0x4903, 0x4903, 0x5104, 0x4903, 0x4903, 0x4903, 0x5103, 0x5103,   // 0x41E0 (16864) pixels
-  0x48E3, 0x48E3, 0x48C2, 0x4881, 0x3861, 0x2861, 0x2081, 0x1882, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x41F0 (16880) pixels
-  0x10A2, 0x1083, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4200 (16896) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4210 (16912) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4220 (16928) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4230 (16944) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4240 (16960) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4250 (16976) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4260 (16992) pixels
-  0x1082, 0x10A3, 0x18C3, 0x2104, 0x2965, 0x2124, 0x10A3, 0x2104, 0x2104, 0x2104, 0x2104, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4270 (17008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4280 (17024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x2124, 0x2945, 0x2965, 0x2965, 0x2965, 0x2903, 0x3945, 0x59E7,   // 0x4290 (17040) pixels
-  0x5186, 0x4944, 0x5145, 0x5145, 0x5165, 0x5145, 0x5144, 0x5144, 0x5124, 0x5104, 0x48E3, 0x48C2, 0x48A2, 0x3861, 0x3081, 0x2081,   // 0x42A0 (17056) pixels
-  0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x42B0 (17072) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x42C0 (17088) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x42D0 (17104) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x42E0 (17120) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x42F0 (17136) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4300 (17152) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4310 (17168) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A3, 0x18C3, 0x2124, 0x2965, 0x18E4, 0x10A3,   // 0x4320 (17184) pixels
-  0x18E4, 0x1904, 0x1904, 0x18E4, 0x10C2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4330 (17200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4340 (17216) pixels
-  0x1082, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x20E3, 0x3965, 0x5A08, 0x51A6, 0x4924, 0x4924, 0x4924, 0x4924, 0x4924, 0x4924,   // 0x4350 (17232) pixels
-  0x4904, 0x4904, 0x48E3, 0x40C2, 0x48C2, 0x40A2, 0x3881, 0x3081, 0x2881, 0x1882, 0x18A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x4360 (17248) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4370 (17264) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4380 (17280) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4390 (17296) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x43A0 (17312) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x43B0 (17328) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x43C0 (17344) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x43D0 (17360) pixels
-  0x10A2, 0x10A2, 0x10A2, 0x10A3, 0x18C3, 0x2124, 0x2945, 0x18E3, 0x10A2, 0x18C3, 0x10C3, 0x10C3, 0x10C3, 0x10A2, 0x0020, 0x0000,   // 0x43E0 (17376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x43F0 (17392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x20C3,   // 0x4400 (17408) pixels
-  0x4165, 0x51C7, 0x4985, 0x4124, 0x4903, 0x40E3, 0x40E3, 0x40E3, 0x40E3, 0x40E3, 0x48E3, 0x40C2, 0x40A2, 0x40A2, 0x40A2, 0x3881,   // 0x4410 (17424) pixels
-  0x3061, 0x2861, 0x1881, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4420 (17440) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4430 (17456) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4440 (17472) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4450 (17488) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4460 (17504) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4470 (17520) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4480 (17536) pixels
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x2104, 0x2124,   // 0x4490 (17552) pixels
-  0x18C3, 0x10A2, 0x10A2, 0x10A3, 0x1082, 0x1082, 0x0882, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x44A0 (17568) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x44B0 (17584) pixels
-  0x0000, 0x0020, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x20E4, 0x2103, 0x20A2, 0x3924, 0x4965, 0x4944, 0x40E3, 0x40E3, 0x40E3, 0x40C3,   // 0x44C0 (17600) pixels
-  0x40E3, 0x40C3, 0x40C2, 0x40C2, 0x40A2, 0x4082, 0x4081, 0x40A1, 0x3881, 0x3061, 0x2861, 0x1861, 0x1061, 0x1082, 0x1082, 0x1082,   // 0x44D0 (17616) pixels
-  0x1082, 0x1082, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0861,   // 0x44E0 (17632) pixels
-  0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x44F0 (17648) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x4500 (17664) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x4510 (17680) pixels
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861,   // 0x4520 (17696) pixels
-  0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x4530 (17712) pixels
-  0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x4540 (17728) pixels
-  0x0862, 0x0862, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A3, 0x18E4, 0x18E4, 0x10A3, 0x10A2, 0x1082, 0x1082, 0x0882, 0x0862, 0x0862,   // 0x4550 (17744) pixels
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4560 (17760) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x4570 (17776) pixels
-  0x20E3, 0x20A2, 0x38E3, 0x40E3, 0x40E3, 0x40C2, 0x40C2, 0x40C2, 0x40C2, 0x40C2, 0x40C2, 0x40C2, 0x40A2, 0x40A2, 0x4081, 0x4081,   // 0x4580 (17792) pixels
-  0x40A1, 0x3861, 0x3061, 0x2841, 0x1861, 0x1061, 0x1062, 0x1062, 0x1082, 0x0881, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862,   // 0x4590 (17808) pixels
-  0x0881, 0x0881, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862,   // 0x45A0 (17824) pixels
-  0x0861, 0x0861, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862,   // 0x45B0 (17840) pixels
-  0x0861, 0x0861, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862,   // 0x45C0 (17856) pixels
-  0x0861, 0x0861, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862,   // 0x45D0 (17872) pixels
-  0x0861, 0x0861, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862,   // 0x45E0 (17888) pixels
-  0x0861, 0x0861, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862, 0x0881, 0x0881, 0x0862, 0x0862,   // 0x45F0 (17904) pixels
-  0x0881, 0x0881, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0862, 0x0861, 0x1082, 0x1082, 0x10A2,   // 0x4600 (17920) pixels
-  0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x0862, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4610 (17936) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4620 (17952) pixels
-  0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x18A2, 0x2082, 0x30A2, 0x3882, 0x40A2, 0x4082, 0x40A2,   // 0x4630 (17968) pixels
-  0x40A2, 0x40A2, 0x40A2, 0x40A2, 0x40A2, 0x4081, 0x3881, 0x3861, 0x3861, 0x3881, 0x3861, 0x3041, 0x2841, 0x1841, 0x1061, 0x1061,   // 0x4640 (17984) pixels
-  0x0861, 0x0861, 0x0861, 0x0862, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4650 (18000) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4660 (18016) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4670 (18032) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4680 (18048) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4690 (18064) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x46A0 (18080) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x46B0 (18096) pixels
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x0861, 0x0841,   // 0x46C0 (18112) pixels
-  0x0841, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x46D0 (18128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0841, 0x0841,   // 0x46E0 (18144) pixels
-  0x0841, 0x0841, 0x1061, 0x1861, 0x2861, 0x3041, 0x3861, 0x3860, 0x3861, 0x3861, 0x3861, 0x3861, 0x3861, 0x3861, 0x3861, 0x3861,   // 0x46F0 (18160) pixels
-  0x3860, 0x3860, 0x3881, 0x3060, 0x3040, 0x2840, 0x1841, 0x1041, 0x1041, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4700 (18176) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4710 (18192) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4720 (18208) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4730 (18224) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4740 (18240) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4750 (18256) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4760 (18272) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861,   // 0x4770 (18288) pixels
-  0x0861, 0x1082, 0x10A3, 0x1082, 0x1082, 0x1082, 0x0861, 0x0841, 0x0021, 0x0021, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4780 (18304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4790 (18320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841, 0x0020, 0x0020, 0x0841, 0x1061, 0x1861, 0x2841, 0x3020, 0x3020,   // 0x47A0 (18336) pixels
-  0x3040, 0x3040, 0x3040, 0x3841, 0x3840, 0x3861, 0x3040, 0x3040, 0x3840, 0x3040, 0x3040, 0x3060, 0x3040, 0x2820, 0x2040, 0x1841,   // 0x47B0 (18352) pixels
-  0x1041, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0821, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x47C0 (18368) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x47D0 (18384) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x47E0 (18400) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x47F0 (18416) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4800 (18432) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4810 (18448) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4820 (18464) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x0862, 0x1082, 0x0861,   // 0x4830 (18480) pixels
-  0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4840 (18496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841,   // 0x4850 (18512) pixels
-  0x0020, 0x0841, 0x0020, 0x0820, 0x1041, 0x1841, 0x2840, 0x2820, 0x2820, 0x3020, 0x3020, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,   // 0x4860 (18528) pixels
-  0x3040, 0x3040, 0x3020, 0x3040, 0x3040, 0x3040, 0x2820, 0x2020, 0x1820, 0x1040, 0x0841, 0x0841, 0x0821, 0x0821, 0x0841, 0x0841,   // 0x4870 (18544) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4880 (18560) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4890 (18576) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x48A0 (18592) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x48B0 (18608) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x48C0 (18624) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x48D0 (18640) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x48E0 (18656) pixels
-  0x0841, 0x0841, 0x0841, 0x0861, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0000, 0x0000,   // 0x48F0 (18672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4900 (18688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x1841, 0x2040,   // 0x4910 (18704) pixels
-  0x2820, 0x2820, 0x2820, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x2820, 0x2820, 0x3020, 0x2820, 0x3040, 0x3040, 0x2840, 0x2820,   // 0x4920 (18720) pixels
-  0x2020, 0x1841, 0x1040, 0x0841, 0x0841, 0x0821, 0x0821, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020,   // 0x4930 (18736) pixels
-  0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4940 (18752) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841,   // 0x4950 (18768) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4960 (18784) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4970 (18800) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4980 (18816) pixels
-  0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4990 (18832) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0862, 0x0862,   // 0x49A0 (18848) pixels
-  0x0861, 0x0861, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x49B0 (18864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x49C0 (18880) pixels
-  0x0020, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x1841, 0x2040, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820,   // 0x49D0 (18896) pixels
-  0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x3040, 0x3040, 0x2820, 0x2820, 0x2020, 0x1841, 0x1040, 0x0841, 0x0821, 0x0820, 0x0820,   // 0x49E0 (18912) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021,   // 0x49F0 (18928) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021,   // 0x4A00 (18944) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021,   // 0x4A10 (18960) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021,   // 0x4A20 (18976) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021,   // 0x4A30 (18992) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021,   // 0x4A40 (19008) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4A50 (19024) pixels
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0862, 0x0862, 0x0841, 0x0862, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020,   // 0x4A60 (19040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4A70 (19056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841,   // 0x4A80 (19072) pixels
-  0x1841, 0x2041, 0x2820, 0x2020, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820,   // 0x4A90 (19088) pixels
-  0x2820, 0x2820, 0x2020, 0x1841, 0x0820, 0x0840, 0x0821, 0x0020, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4AA0 (19104) pixels
-  0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4AB0 (19120) pixels
-  0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4AC0 (19136) pixels
-  0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4AD0 (19152) pixels
-  0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4AE0 (19168) pixels
-  0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4AF0 (19184) pixels
-  0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4B00 (19200) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x4B10 (19216) pixels
-  0x0861, 0x0861, 0x0841, 0x0861, 0x0021, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4B20 (19232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4B30 (19248) pixels
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x1021, 0x2020, 0x2020, 0x2020, 0x2020, 0x2820, 0x2820,   // 0x4B40 (19264) pixels
-  0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2020, 0x2040, 0x1040, 0x1020, 0x0840, 0x0821,   // 0x4B50 (19280) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4B60 (19296) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4B70 (19312) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4B80 (19328) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4B90 (19344) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4BA0 (19360) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4BB0 (19376) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4BC0 (19392) pixels
-  0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0020, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0021, 0x0020, 0x0020,   // 0x4BD0 (19408) pixels
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4BE0 (19424) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4BF0 (19440) pixels
-  0x0020, 0x0820, 0x1020, 0x2020, 0x2000, 0x2000, 0x2020, 0x2820, 0x2020, 0x2020, 0x2020, 0x2820, 0x2820, 0x2820, 0x2020, 0x2820,   // 0x4C00 (19456) pixels
-  0x2820, 0x2820, 0x2020, 0x2020, 0x1820, 0x1020, 0x1020, 0x0820, 0x0821, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4C10 (19472) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4C20 (19488) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4C30 (19504) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4C40 (19520) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4C50 (19536) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4C60 (19552) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4C70 (19568) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4C80 (19584) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4C90 (19600) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4CA0 (19616) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x1020, 0x2020, 0x2020, 0x2020, 0x2020,   // 0x4CB0 (19632) pixels
-  0x2020, 0x2020, 0x2020, 0x2020, 0x2020, 0x2020, 0x2020, 0x2020, 0x2020, 0x2820, 0x2820, 0x2020, 0x2020, 0x1820, 0x1020, 0x1020,   // 0x4CC0 (19648) pixels
-  0x0820, 0x0821, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4CD0 (19664) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4CE0 (19680) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4CF0 (19696) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4D00 (19712) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4D10 (19728) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4D20 (19744) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4D30 (19760) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0020,   // 0x4D40 (19776) pixels
-  0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4D50 (19792) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020,   // 0x4D60 (19808) pixels
-  0x0020, 0x0020, 0x0020, 0x0820, 0x1020, 0x1820, 0x2000, 0x2000, 0x2000, 0x2020, 0x2020, 0x2020, 0x2020, 0x2020, 0x2020, 0x2020,   // 0x4D70 (19824) pixels
-  0x2020, 0x2020, 0x2820, 0x2020, 0x2020, 0x2000, 0x1820, 0x1020, 0x0820, 0x0821, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4D80 (19840) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4D90 (19856) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4DA0 (19872) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4DB0 (19888) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4DC0 (19904) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4DD0 (19920) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4DE0 (19936) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4DF0 (19952) pixels
-  0x0020, 0x0020, 0x0841, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020,   // 0x4E00 (19968) pixels
-  0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4E10 (19984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x1020, 0x1820, 0x1800,   // 0x4E20 (20000) pixels
-  0x1800, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2020, 0x2020, 0x2020, 0x2000, 0x1820,   // 0x4E30 (20016) pixels
-  0x1020, 0x0820, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4E40 (20032) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4E50 (20048) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4E60 (20064) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4E70 (20080) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4E80 (20096) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4E90 (20112) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4EA0 (20128) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0020, 0x0841, 0x0841, 0x0841,   // 0x4EB0 (20144) pixels
-  0x0861, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4EC0 (20160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x4ED0 (20176) pixels
-  0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0800, 0x1020, 0x1820, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,   // 0x4EE0 (20192) pixels
-  0x2020, 0x2020, 0x1800, 0x2000, 0x2020, 0x2020, 0x2000, 0x1800, 0x1820, 0x1020, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4EF0 (20208) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4F00 (20224) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4F10 (20240) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4F20 (20256) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4F30 (20272) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4F40 (20288) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4F50 (20304) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4F60 (20320) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841,   // 0x4F70 (20336) pixels
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4F80 (20352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0820, 0x1020,   // 0x4F90 (20368) pixels
-  0x1820, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1820, 0x1800, 0x1820, 0x1800, 0x1800, 0x1800, 0x2020, 0x2020, 0x2020,   // 0x4FA0 (20384) pixels
-  0x1800, 0x1820, 0x1020, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4FB0 (20400) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4FC0 (20416) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4FD0 (20432) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4FE0 (20448) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x4FF0 (20464) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x5000 (20480) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x5010 (20496) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841,   // 0x5020 (20512) pixels
-  0x0841, 0x0841, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0862, 0x0862, 0x0862, 0x0862, 0x0841, 0x0000, 0x0000,   // 0x5030 (20528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5040 (20544) pixels
-  0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0820, 0x1020, 0x1820, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800,   // 0x5050 (20560) pixels
-  0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x2020, 0x2020, 0x1800, 0x1800, 0x1000, 0x1020, 0x0800, 0x0820, 0x0020, 0x0020,   // 0x5060 (20576) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x5070 (20592) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x5080 (20608) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000,   // 0x5090 (20624) pixels
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x50A0 (20640) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x50B0 (20656) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x50C0 (20672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020,   // 0x50D0 (20688) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0020, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000,   // 0x50E0 (20704) pixels
-  0x0000, 0x0021, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x50F0 (20720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5100 (20736) pixels
-  0x0820, 0x1020, 0x1820, 0x1800, 0x1800, 0x1820, 0x1820, 0x1820, 0x1820, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1820,   // 0x5110 (20752) pixels
-  0x2020, 0x1800, 0x1800, 0x1000, 0x1020, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020,   // 0x5120 (20768) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x5130 (20784) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020,   // 0x5140 (20800) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x5150 (20816) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000,   // 0x5160 (20832) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5170 (20848) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5180 (20864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020,   // 0x5190 (20880) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021,   // 0x51A0 (20896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x51B0 (20912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1020, 0x1000, 0x1000, 0x1000, 0x1800, 0x1800,   // 0x51C0 (20928) pixels
-  0x1800, 0x1820, 0x1800, 0x1800, 0x1820, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1000, 0x1000, 0x0800, 0x0800, 0x0820,   // 0x51D0 (20944) pixels
-  0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x51E0 (20960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x51F0 (20976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5200 (20992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5210 (21008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5220 (21024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x5230 (21040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5240 (21056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0020, 0x0000,   // 0x5250 (21072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5260 (21088) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5270 (21104) pixels
-  0x0000, 0x0000, 0x0800, 0x1020, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,   // 0x5280 (21120) pixels
-  0x1000, 0x1800, 0x1820, 0x1820, 0x1800, 0x1000, 0x0800, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5290 (21136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x52A0 (21152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x52B0 (21168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x52C0 (21184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x52D0 (21200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x52E0 (21216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x52F0 (21232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,   // 0x5300 (21248) pixels
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5310 (21264) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5320 (21280) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x1000, 0x1000, 0x1000,   // 0x5330 (21296) pixels
-  0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1820, 0x1820, 0x1020, 0x1000, 0x1000, 0x0800,   // 0x5340 (21312) pixels
-  0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5350 (21328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5360 (21344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5370 (21360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5380 (21376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5390 (21392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x53A0 (21408) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x53B0 (21424) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x53C0 (21440) pixels
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x53D0 (21456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x53E0 (21472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,   // 0x53F0 (21488) pixels
-  0x1000, 0x1000, 0x1000, 0x1020, 0x1000, 0x1020, 0x1000, 0x1000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5400 (21504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5410 (21520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5420 (21536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5430 (21552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5440 (21568) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5450 (21584) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5460 (21600) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5470 (21616) pixels
-  0x0020, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5480 (21632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5490 (21648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x1000,   // 0x54A0 (21664) pixels
-  0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1020, 0x1020, 0x1000, 0x1000,   // 0x54B0 (21680) pixels
-  0x1000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x54C0 (21696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x54D0 (21712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x54E0 (21728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x54F0 (21744) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5500 (21760) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5510 (21776) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5520 (21792) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000,   // 0x5530 (21808) pixels
-  0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5540 (21824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5550 (21840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,   // 0x5560 (21856) pixels
-  0x1000, 0x0800, 0x1000, 0x0800, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5570 (21872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5580 (21888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5590 (21904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x55A0 (21920) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x55B0 (21936) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x55C0 (21952) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x55D0 (21968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x55E0 (21984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x55F0 (22000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5600 (22016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5610 (22032) pixels
-  0x0800, 0x1000, 0x0800, 0x0800, 0x1000, 0x1000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x1000, 0x1000, 0x1000,   // 0x5620 (22048) pixels
-  0x1000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5630 (22064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5640 (22080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5650 (22096) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5660 (22112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5670 (22128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5680 (22144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5690 (22160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x56A0 (22176) pixels
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x56B0 (22192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x56C0 (22208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800,   // 0x56D0 (22224) pixels
-  0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x1000, 0x1000, 0x0800, 0x1000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000,   // 0x56E0 (22240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x56F0 (22256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5700 (22272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5710 (22288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5720 (22304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5730 (22320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5740 (22336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5750 (22352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x5760 (22368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5770 (22384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5780 (22400) pixels
-  0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800,   // 0x5790 (22416) pixels
-  0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x57A0 (22432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x57B0 (22448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x57C0 (22464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x57D0 (22480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x57E0 (22496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x57F0 (22512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5800 (22528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5810 (22544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5820 (22560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5830 (22576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800,   // 0x5840 (22592) pixels
-  0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000,   // 0x5850 (22608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5860 (22624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5870 (22640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5880 (22656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5890 (22672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x58A0 (22688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x58B0 (22704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x58C0 (22720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x58D0 (22736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x58E0 (22752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x58F0 (22768) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800,   // 0x5900 (22784) pixels
-  0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5910 (22800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5920 (22816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5930 (22832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5940 (22848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5950 (22864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5960 (22880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5970 (22896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5980 (22912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5990 (22928) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x59A0 (22944) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800,   // 0x59B0 (22960) pixels
-  0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800,   // 0x59C0 (22976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x59D0 (22992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x59E0 (23008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x59F0 (23024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A00 (23040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A10 (23056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A20 (23072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A30 (23088) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A40 (23104) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A50 (23120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A60 (23136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800,   // 0x5A70 (23152) pixels
-  0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A80 (23168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5A90 (23184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5AA0 (23200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5AB0 (23216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5AC0 (23232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5AD0 (23248) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5AE0 (23264) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5AF0 (23280) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B00 (23296) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B10 (23312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B20 (23328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000,   // 0x5B30 (23344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B40 (23360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B50 (23376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B60 (23392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B70 (23408) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B80 (23424) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5B90 (23440) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BA0 (23456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BB0 (23472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BC0 (23488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BD0 (23504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BE0 (23520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5BF0 (23536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C00 (23552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C10 (23568) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C20 (23584) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C30 (23600) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C40 (23616) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C50 (23632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C60 (23648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C70 (23664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C80 (23680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5C90 (23696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5CA0 (23712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5CB0 (23728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5CC0 (23744) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5CD0 (23760) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5CE0 (23776) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5CF0 (23792) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D00 (23808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D10 (23824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D20 (23840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D30 (23856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D40 (23872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D50 (23888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D60 (23904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D70 (23920) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D80 (23936) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5D90 (23952) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DA0 (23968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DB0 (23984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DC0 (24000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DD0 (24016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DE0 (24032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5DF0 (24048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E00 (24064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E10 (24080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E20 (24096) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E30 (24112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E40 (24128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E50 (24144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E60 (24160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E70 (24176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E80 (24192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5E90 (24208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5EA0 (24224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5EB0 (24240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5EC0 (24256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5ED0 (24272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5EE0 (24288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5EF0 (24304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F00 (24320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F10 (24336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F20 (24352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F30 (24368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F40 (24384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F50 (24400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F60 (24416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F70 (24432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F80 (24448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5F90 (24464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FA0 (24480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FB0 (24496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FC0 (24512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FD0 (24528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FE0 (24544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5FF0 (24560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6000 (24576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6010 (24592) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6020 (24608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6030 (24624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6040 (24640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6050 (24656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6060 (24672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6070 (24688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6080 (24704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6090 (24720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60A0 (24736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60B0 (24752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60C0 (24768) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60D0 (24784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60E0 (24800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x60F0 (24816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6100 (24832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6110 (24848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6120 (24864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6130 (24880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6140 (24896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6150 (24912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6160 (24928) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6170 (24944) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6180 (24960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6190 (24976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61A0 (24992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61B0 (25008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61C0 (25024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61D0 (25040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61E0 (25056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x61F0 (25072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6200 (25088) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6210 (25104) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6220 (25120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6230 (25136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6240 (25152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6250 (25168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6260 (25184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6270 (25200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6280 (25216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6290 (25232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x62A0 (25248) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x62B0 (25264) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x62C0 (25280) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x62D0 (25296) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x62E0 (25312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x62F0 (25328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6300 (25344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6310 (25360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6320 (25376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6330 (25392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6340 (25408) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6350 (25424) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6360 (25440) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6370 (25456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6380 (25472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6390 (25488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x63A0 (25504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x63B0 (25520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x63C0 (25536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x63D0 (25552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x63E0 (25568) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x63F0 (25584) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6400 (25600) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6410 (25616) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6420 (25632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6430 (25648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6440 (25664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6450 (25680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6460 (25696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6470 (25712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6480 (25728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6490 (25744) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x64A0 (25760) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x64B0 (25776) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x64C0 (25792) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x64D0 (25808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x64E0 (25824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x64F0 (25840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6500 (25856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6510 (25872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6520 (25888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6530 (25904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6540 (25920) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6550 (25936) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6560 (25952) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6570 (25968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6580 (25984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6590 (26000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x65A0 (26016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x65B0 (26032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x65C0 (26048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x65D0 (26064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x65E0 (26080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x65F0 (26096) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6600 (26112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6610 (26128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6620 (26144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6630 (26160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6640 (26176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6650 (26192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6660 (26208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6670 (26224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6680 (26240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6690 (26256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x66A0 (26272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x66B0 (26288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x66C0 (26304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x66D0 (26320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x66E0 (26336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x66F0 (26352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6700 (26368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6710 (26384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6720 (26400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6730 (26416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6740 (26432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6750 (26448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6760 (26464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6770 (26480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6780 (26496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6790 (26512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x67A0 (26528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x67B0 (26544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x67C0 (26560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x67D0 (26576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x67E0 (26592) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x67F0 (26608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6800 (26624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6810 (26640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6820 (26656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6830 (26672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6840 (26688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6850 (26704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6860 (26720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6870 (26736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6880 (26752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6890 (26768) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x68A0 (26784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x68B0 (26800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x68C0 (26816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x68D0 (26832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x68E0 (26848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x68F0 (26864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6900 (26880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6910 (26896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6920 (26912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6930 (26928) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6940 (26944) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6950 (26960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6960 (26976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6970 (26992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6980 (27008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6990 (27024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x69A0 (27040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x69B0 (27056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x69C0 (27072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x69D0 (27088) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x69E0 (27104) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x69F0 (27120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6A00 (27136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6A10 (27152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6A20 (27168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6A30 (27184) pixels
+// Packed by      : _TOOLS/bitmap_converter.py (palette + RLE, see GfxUi::drawPackedBitmap)
+// Packed size    : 185x147 pixels, 8 bits per pixel, 256 colours, 9063 bytes (was 54390)
+
+const uint8_t batteryLowIcon[9063] PROGMEM = {
+  0xB9, 0x00, 0x93, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x20, 0x00, 0x82, 0x10, 0xA2, 0x10, 0x41, 0x08,
+  0xC3, 0x18, 0x04, 0x21, 0x62, 0x08, 0x61, 0x08, 0xA6, 0x31, 0xC7, 0x39, 0x65, 0x29, 0xE3, 0x18,
+  0x45, 0x29, 0x86, 0x31, 0x21, 0x00, 0xA3, 0x10, 0xE7, 0x39, 0x08, 0x42, 0x24, 0x21, 0x6A, 0x4A,
+  0xA7, 0x31, 0x49, 0x42, 0x08, 0x3A, 0x00, 0x08, 0xC7, 0x31, 0x66, 0x29, 0xE8, 0x39, 0x8A, 0x52,
+  0x29, 0x42, 0x45, 0x21, 0xE4, 0x18, 0x00, 0x10, 0x43, 0xA1, 0xC2, 0x10, 0x49, 0x4A, 0x69, 0x4A,
+  0x20, 0x28, 0xC3, 0x10, 0xA4, 0xC1, 0x20, 0x20, 0x00, 0x18, 0x28, 0x42, 0x20, 0x08, 0x63, 0xA9,
+  0x86, 0x29, 0x84, 0xB9, 0x20, 0x10, 0x06, 0xDA, 0x25, 0x21, 0x23, 0x99, 0x61, 0x18, 0xE5, 0xD1,
+  0x40, 0x30, 0x43, 0xA9, 0x03, 0x19, 0x61, 0x10, 0x06, 0xD2, 0x63, 0xB1, 0x26, 0xDA, 0x81, 0x08,
+  0xC5, 0xC9, 0x20, 0x18, 0xA2, 0x18, 0x61, 0x30, 0x82, 0x08, 0x61, 0x38, 0xA5, 0xB9, 0x61, 0x28,
+  0x10, 0x84, 0x84, 0xB1, 0x22, 0x99, 0xA9, 0xE2, 0xA4, 0xC9, 0x43, 0x99, 0x8E, 0x73, 0xE3, 0x20,
+  0x43, 0x91, 0xAA, 0x52, 0x81, 0x40, 0xA4, 0xB9, 0x47, 0xE2, 0x2D, 0x63, 0x6E, 0x6B, 0xCF, 0x7B,
+  0xA2, 0x48, 0x68, 0xE2, 0xC5, 0xC1, 0xA2, 0x30, 0xF3, 0x9C, 0x64, 0xB1, 0xAB, 0x52, 0x0C, 0x63,
+  0x63, 0xA1, 0xC5, 0xD1, 0x00, 0x20, 0xE3, 0x40, 0x23, 0x71, 0xE5, 0xC9, 0xA2, 0x20, 0x04, 0x19,
+  0x44, 0x69, 0xCB, 0x5A, 0xEC, 0x5A, 0x21, 0x08, 0x27, 0xDA, 0x8A, 0x4A, 0xCB, 0x52, 0x84, 0x99,
+  0x41, 0x00, 0xAF, 0x73, 0xA2, 0x40, 0x85, 0x79, 0x6D, 0x6B, 0x81, 0x30, 0x10, 0x7C, 0xC2, 0x48,
+  0x03, 0x49, 0xFF, 0xFF, 0x83, 0xB1, 0xA6, 0x51, 0xE6, 0xB1, 0x4D, 0x6B, 0xC7, 0x41, 0xEB, 0x5A,
+  0x0C, 0x5B, 0x2C, 0x63, 0x71, 0x8C, 0xB2, 0x94, 0xA5, 0x99, 0x14, 0xA5, 0xC2, 0x40, 0xE3, 0x30,
+  0xC6, 0x79, 0xE6, 0xB9, 0xEA, 0xE2, 0x4C, 0xE3, 0xC5, 0xA9, 0x24, 0x49, 0x64, 0x91, 0x64, 0xA9,
+  0x83, 0xB9, 0xC6, 0x91, 0x44, 0x81, 0x31, 0x84, 0x72, 0x8C, 0xC5, 0xB1, 0x9E, 0xF7, 0xE5, 0xD9,
+  0x68, 0xDA, 0xB3, 0x94, 0xE6, 0x89, 0xBF, 0xF7, 0x24, 0x41, 0x44, 0x59, 0x65, 0x41, 0xE7, 0x61,
+  0x28, 0x72, 0x69, 0x62, 0x0B, 0xE3, 0x85, 0x81, 0xAE, 0xEB, 0x28, 0x4A, 0xBA, 0xD6, 0x03, 0x51,
+  0x03, 0x61, 0x61, 0x20, 0xE3, 0x28, 0x22, 0xA1, 0xEC, 0x52, 0x0D, 0x5B, 0xCE, 0xF3, 0x84, 0xA1,
+  0xF4, 0x9C, 0x38, 0xC6, 0x1C, 0xE7, 0x5D, 0xEF, 0x65, 0x31, 0x65, 0x39, 0x24, 0x31, 0x86, 0x39,
+  0x85, 0x59, 0x60, 0x38, 0xAF, 0x6B, 0x27, 0x92, 0x24, 0x51, 0xA2, 0x38, 0x44, 0x61, 0xC6, 0x71,
+  0x44, 0x89, 0x64, 0x79, 0x31, 0x7C, 0xB6, 0xB5, 0xB7, 0xB5, 0xD7, 0xBD, 0xE3, 0x38, 0x69, 0x52,
+  0x65, 0x51, 0x68, 0xCA, 0x68, 0xA2, 0xAB, 0x4A, 0x6E, 0x63, 0xF0, 0x73, 0xE7, 0x51, 0xB2, 0xBC,
+  0x35, 0xA5, 0x75, 0xAD, 0x96, 0xAD, 0xC5, 0xA1, 0x9A, 0xCE, 0x7D, 0xF7, 0x7E, 0xEF, 0xC3, 0x50,
+  0x03, 0x69, 0x24, 0x29, 0xA5, 0x91, 0xE6, 0xA9, 0xE8, 0x31, 0x06, 0xC2, 0xA6, 0x41, 0x85, 0x71,
+  0x60, 0x40, 0x79, 0xCE, 0xFB, 0xDE, 0x1C, 0xDF, 0x3D, 0xE7, 0xAA, 0x72, 0xEB, 0x82, 0xEF, 0xB3,
+  0x30, 0xDC, 0x30, 0x8C, 0x0B, 0xA3, 0x18, 0xBE, 0xBE, 0xFF, 0x28, 0x62, 0x88, 0xBA, 0x89, 0x9A,
+  0x89, 0x7A, 0xA9, 0xD2, 0xEB, 0x72, 0x6D, 0x93, 0x8D, 0x7B, 0xAE, 0xD3, 0xEF, 0xA3, 0x0F, 0xEC,
+  0x30, 0xAC, 0x91, 0xF4, 0x14, 0xC5, 0x79, 0xE6, 0xAE, 0xAB, 0xF3, 0xFC, 0x0B, 0xC3, 0xF7, 0xFD,
+  0xD6, 0xD5, 0x79, 0xFE, 0xFB, 0xF6, 0x85, 0x00, 0x89, 0x01, 0x04, 0x04, 0x04, 0x01, 0x01, 0x2B,
+  0x82, 0x01, 0x01, 0x18, 0x18, 0xFD, 0x00, 0x82, 0x01, 0x02, 0x04, 0x01, 0x01, 0x8B, 0x04, 0x86,
+  0x01, 0x8A, 0x00, 0x87, 0x01, 0x89, 0x04, 0x02, 0x68, 0x2B, 0x2B, 0x82, 0x18, 0x00, 0x2B, 0xF8,
+  0x00, 0x85, 0x01, 0x85, 0x04, 0x82, 0x08, 0x00, 0x04, 0x83, 0x08, 0x84, 0x04, 0x83, 0x01, 0x88,
+  0x00, 0x85, 0x01, 0x85, 0x04, 0x83, 0x08, 0x85, 0x04, 0x85, 0x2B, 0x82, 0x18, 0xF3, 0x00, 0x83,
+  0x01, 0x83, 0x04, 0x84, 0x08, 0x08, 0x02, 0x02, 0x08, 0x02, 0x02, 0x07, 0x38, 0x08, 0x08, 0x83,
+  0x04, 0x83, 0x01, 0x86, 0x00, 0x84, 0x01, 0x83, 0x04, 0x83, 0x08, 0x83, 0x02, 0x86, 0x38, 0x00,
+  0x2F, 0x83, 0x2B, 0x84, 0x18, 0xF0, 0x00, 0x83, 0x01, 0x82, 0x04, 0x83, 0x08, 0x8A, 0x02, 0x82,
+  0x08, 0x82, 0x04, 0x83, 0x01, 0x84, 0x00, 0x83, 0x01, 0x83, 0x04, 0x01, 0x08, 0x08, 0x82, 0x02,
+  0x82, 0x03, 0x84, 0x3F, 0x01, 0x33, 0x38, 0x82, 0x33, 0x83, 0x2F, 0x01, 0x20, 0x20, 0x84, 0x18,
+  0xED, 0x00, 0x00, 0x01, 0x82, 0x0F, 0x01, 0x04, 0x04, 0x83, 0x08, 0x01, 0x02, 0x02, 0x89, 0x03,
+  0x82, 0x02, 0x82, 0x08, 0x01, 0x04, 0x04, 0x83, 0x01, 0x83, 0x00, 0x01, 0x01, 0x01, 0x83, 0x04,
+  0x03, 0x08, 0x08, 0x02, 0x02, 0x82, 0x03, 0x82, 0x05, 0x02, 0x0C, 0x05, 0x3F, 0x82, 0x63, 0x82,
+  0xA6, 0x03, 0x28, 0x28, 0x3E, 0x3E, 0x82, 0x29, 0x04, 0x20, 0x20, 0x18, 0x18, 0x2B, 0xED, 0x00,
+  0x02, 0x01, 0x01, 0x0F, 0x82, 0x04, 0x00, 0x08, 0x83, 0x02, 0x0E, 0x03, 0x10, 0x05, 0x0C, 0x03,
+  0x05, 0x03, 0x03, 0x10, 0x05, 0x05, 0x03, 0x03, 0x02, 0x02, 0x82, 0x08, 0x82, 0x04, 0x82, 0x01,
+  0x82, 0x00, 0x00, 0x01, 0x82, 0x04, 0x82, 0x08, 0x07, 0x02, 0x02, 0x03, 0x03, 0x05, 0x0C, 0x0D,
+  0x11, 0x82, 0x12, 0x05, 0x7B, 0x9B, 0x58, 0x58, 0x40, 0x40, 0x83, 0x35, 0x83, 0x25, 0x08, 0x28,
+  0x3E, 0x3E, 0x2F, 0x04, 0x04, 0x68, 0x04, 0x04, 0xEA, 0x0F, 0x82, 0x04, 0x18, 0x07, 0x41, 0x02,
+  0x03, 0x10, 0x26, 0x05, 0x05, 0x1F, 0x1F, 0x06, 0x15, 0x0A, 0x19, 0x15, 0x2D, 0x31, 0x0C, 0x05,
+  0x05, 0x03, 0x02, 0x02, 0x08, 0x08, 0x82, 0x04, 0x83, 0x01, 0x04, 0x00, 0x00, 0x01, 0x04, 0x04,
+  0x82, 0x08, 0x0E, 0x02, 0x02, 0x03, 0x05, 0x0C, 0x06, 0x09, 0x4B, 0x59, 0x82, 0xAD, 0x59, 0xF5,
+  0xED, 0x9D, 0x85, 0x85, 0x85, 0xBC, 0x03, 0x9C, 0xCB, 0x7B, 0x0A, 0x86, 0x11, 0xA4, 0x0A, 0x85,
+  0x11, 0x83, 0x0A, 0x84, 0x11, 0x8B, 0x0A, 0x85, 0x11, 0x83, 0x0A, 0x85, 0x11, 0x8E, 0x0A, 0x86,
+  0x11, 0x00, 0x1B, 0x82, 0x12, 0x0C, 0x2A, 0x2A, 0x1D, 0x23, 0x23, 0x24, 0x14, 0x1C, 0x1C, 0x4E,
+  0x5B, 0x14, 0x53, 0x82, 0x73, 0x0D, 0x6E, 0x66, 0x0D, 0x0C, 0x0C, 0x05, 0x03, 0x03, 0x02, 0x02,
+  0x08, 0x08, 0x04, 0x04, 0x82, 0x01, 0x16, 0x00, 0x00, 0x01, 0x04, 0x08, 0x08, 0x02, 0x02, 0x03,
+  0x03, 0x05, 0x0C, 0x06, 0x0D, 0x66, 0x80, 0x59, 0x59, 0x82, 0x59, 0xE4, 0xB8, 0xC7, 0x85, 0x8E,
+  0x83, 0xD7, 0x05, 0x97, 0x97, 0xDC, 0x78, 0xB4, 0x0E, 0xE9, 0x09, 0x82, 0x15, 0x21, 0x19, 0x0A,
+  0x0A, 0x11, 0x1B, 0x1B, 0x12, 0x12, 0x1D, 0x16, 0x24, 0x24, 0x1C, 0x4E, 0x67, 0x7C, 0x67, 0x53,
+  0xC9, 0xC9, 0x52, 0x52, 0x16, 0x13, 0x06, 0x0C, 0x05, 0x05, 0x03, 0x02, 0x02, 0x08, 0x08, 0x04,
+  0x83, 0x01, 0x14, 0x00, 0x04, 0x04, 0x08, 0x02, 0x02, 0x03, 0x03, 0x05, 0x0C, 0x06, 0x0D, 0x09,
+  0x71, 0x45, 0x45, 0x7F, 0x7F, 0xF3, 0xE7, 0xC7, 0x8A, 0x79, 0x04, 0xD8, 0xD8, 0x8E, 0x8A, 0xA7,
+  0xE6, 0x06, 0x02, 0x13, 0x06, 0x06, 0x82, 0x13, 0x01, 0x31, 0x31, 0x82, 0x0D, 0x1C, 0x1A, 0x2D,
+  0x0E, 0x09, 0x0A, 0x11, 0x1B, 0x12, 0x2A, 0x1C, 0x67, 0x7E, 0x7D, 0x52, 0x7D, 0xA9, 0x6B, 0xA9,
+  0x67, 0x0B, 0x31, 0x06, 0x1F, 0x05, 0x05, 0x03, 0x02, 0x02, 0x08, 0x82, 0x04, 0x17, 0x01, 0x01,
+  0x00, 0x04, 0x04, 0x08, 0x02, 0x03, 0x05, 0x0C, 0x06, 0x13, 0x0D, 0x1A, 0x2A, 0x7A, 0x7C, 0x4E,
+  0x4E, 0x66, 0xE2, 0xC7, 0x79, 0x86, 0x8A, 0x43, 0x06, 0x92, 0x81, 0xD4, 0x29, 0x2F, 0x68, 0x2B,
+  0x82, 0x01, 0x01, 0x0F, 0x0F, 0xE1, 0x01, 0x83, 0x04, 0x33, 0x08, 0x08, 0x02, 0x02, 0x03, 0x22,
+  0x05, 0x0C, 0x06, 0x31, 0x0D, 0x0B, 0x09, 0x2A, 0x7C, 0x5C, 0x7D, 0x14, 0x2D, 0x2D, 0x1E, 0x1A,
+  0x6A, 0x11, 0x0D, 0x13, 0x06, 0x06, 0x0C, 0x05, 0x03, 0x02, 0x08, 0x08, 0x04, 0x04, 0x01, 0x01,
+  0x00, 0x04, 0x08, 0x02, 0x02, 0x03, 0x05, 0x0C, 0x13, 0x0D, 0x0E, 0x0A, 0x1C, 0x5C, 0x82, 0x24,
+  0x06, 0x1C, 0x9E, 0xC7, 0x86, 0x43, 0x50, 0x2E, 0x82, 0x8D, 0x84, 0x2E, 0x07, 0x46, 0x5A, 0x4D,
+  0xA5, 0x5F, 0x20, 0x2B, 0x2B, 0xE2, 0x00, 0x85, 0x01, 0x25, 0x68, 0x04, 0x04, 0x08, 0x08, 0x38,
+  0x03, 0x03, 0x05, 0x0C, 0x06, 0x31, 0x0B, 0x0B, 0x0A, 0x23, 0x71, 0x4B, 0x53, 0x6B, 0x1B, 0x19,
+  0x2D, 0x1A, 0x17, 0x1D, 0x2D, 0x0B, 0x0D, 0x13, 0x06, 0x05, 0x03, 0x02, 0x08, 0x08, 0x04, 0x04,
+  0x82, 0x01, 0x15, 0x04, 0x08, 0x02, 0x03, 0x05, 0x0C, 0x06, 0x0D, 0x0E, 0x0A, 0x12, 0x7E, 0x5C,
+  0x1C, 0x66, 0x4E, 0x4E, 0xE2, 0xC7, 0xDA, 0x57, 0x2E, 0x84, 0x3A, 0x0B, 0x46, 0x46, 0x3A, 0x3A,
+  0x5A, 0x2C, 0x8B, 0xD5, 0x25, 0x3E, 0x2B, 0x18, 0xE6, 0x00, 0x82, 0x01, 0x82, 0x04, 0x21, 0x08,
+  0x02, 0x02, 0x03, 0x05, 0x0C, 0x13, 0x0D, 0x0B, 0x0E, 0x12, 0x24, 0x4B, 0x45, 0x6E, 0x52, 0x16,
+  0x17, 0x1B, 0xD9, 0x17, 0x6A, 0x15, 0x0E, 0x0B, 0x13, 0x06, 0x0C, 0x03, 0x03, 0x02, 0x08, 0x08,
+  0x04, 0x82, 0x01, 0x0D, 0x04, 0x08, 0x02, 0x03, 0x05, 0x0C, 0x13, 0x0B, 0x09, 0x1B, 0x24, 0x4B,
+  0x7E, 0x7C, 0x82, 0x5C, 0x06, 0xE3, 0xC7, 0x62, 0x57, 0x2E, 0x3A, 0x46, 0x83, 0x77, 0x0B, 0x46,
+  0x5A, 0x5A, 0x2C, 0x2C, 0x4D, 0x61, 0xB6, 0x3E, 0x2F, 0x18, 0x2B, 0xE5, 0x00, 0x83, 0x01, 0x23,
+  0x04, 0x08, 0x08, 0x02, 0x03, 0x05, 0x0C, 0x06, 0x13, 0x0D, 0x0E, 0x0A, 0x2A, 0x1C, 0x54, 0x7F,
+  0x45, 0x53, 0x5B, 0x6A, 0x16, 0x16, 0x17, 0x4E, 0x11, 0x09, 0x0B, 0x0D, 0x06, 0x0C, 0x05, 0x03,
+  0x02, 0x08, 0x08, 0x04, 0x82, 0x01, 0x26, 0x08, 0x08, 0x02, 0x10, 0x05, 0x06, 0x13, 0x0B, 0x0A,
+  0x1D, 0x5B, 0x54, 0x71, 0x7A, 0x71, 0x4B, 0x4B, 0xF0, 0xEB, 0x62, 0x62, 0x27, 0x8D, 0x5A, 0x3A,
+  0x5A, 0x5A, 0x3A, 0x77, 0x3A, 0x5A, 0x8C, 0x8C, 0x4A, 0xBE, 0xDD, 0x28, 0x2F, 0x2B, 0xE8, 0x00,
+  0x25, 0x01, 0x0F, 0x6D, 0x04, 0x08, 0x02, 0x03, 0x05, 0x0C, 0x06, 0x0D, 0x0B, 0x15, 0x11, 0x23,
+  0x4E, 0x54, 0x91, 0x90, 0x73, 0xAA, 0x7D, 0xA9, 0x6B, 0x16, 0x7C, 0x12, 0x0A, 0x0E, 0x0B, 0x13,
+  0x06, 0x05, 0x03, 0x03, 0x02, 0x08, 0x04, 0x82, 0x01, 0x15, 0x08, 0x02, 0x03, 0x10, 0x0C, 0x06,
+  0x0D, 0x0E, 0x1B, 0x24, 0x5C, 0x45, 0x54, 0x45, 0x7F, 0x80, 0x80, 0xF3, 0xFB, 0xC6, 0x39, 0x57,
+  0x88, 0x2E, 0x09, 0x46, 0x46, 0xAC, 0xBD, 0x65, 0x78, 0xDB, 0xB4, 0x0A, 0x0A, 0x82, 0x09, 0x01,
+  0x15, 0x15, 0x99, 0x09, 0x01, 0x15, 0x09, 0x82, 0x15, 0x84, 0x09, 0x82, 0x15, 0x01, 0x09, 0x15,
+  0x82, 0x09, 0x82, 0x15, 0x02, 0x09, 0x15, 0x15, 0x83, 0x09, 0x01, 0x15, 0x09, 0x82, 0x15, 0x02,
+  0x09, 0x15, 0x15, 0x8A, 0x09, 0x04, 0x15, 0x15, 0x09, 0x15, 0x15, 0x83, 0x09, 0x83, 0x15, 0x85,
+  0x09, 0x45, 0x15, 0x15, 0x09, 0x09, 0x19, 0x19, 0x0A, 0x0A, 0x11, 0x1B, 0x12, 0x12, 0x1D, 0x23,
+  0x14, 0x1C, 0x5B, 0x7C, 0x5C, 0x7A, 0x4B, 0x54, 0x80, 0x59, 0x80, 0x80, 0xCF, 0xC1, 0xCF, 0xCD,
+  0x6E, 0x52, 0x23, 0x11, 0x09, 0x0B, 0x0D, 0x06, 0x0C, 0x05, 0x02, 0x02, 0x08, 0x04, 0x04, 0x01,
+  0x01, 0x08, 0x02, 0x03, 0x05, 0x0C, 0x13, 0x0D, 0x09, 0x12, 0x4E, 0x7A, 0x7F, 0xC2, 0xB0, 0x93,
+  0xD2, 0xD2, 0xF7, 0xF2, 0xA1, 0x87, 0x95, 0x39, 0x82, 0x3B, 0x01, 0x39, 0x3B, 0x83, 0x39, 0x06,
+  0x62, 0x92, 0x81, 0x97, 0x9D, 0x9E, 0x4E, 0x83, 0x1C, 0x00, 0x6A, 0xE0, 0x1C, 0x00, 0x4E, 0x83,
+  0x5B, 0x12, 0x66, 0x66, 0x67, 0x67, 0x5C, 0x52, 0x7A, 0x71, 0x4B, 0x6E, 0x54, 0x45, 0x90, 0x91,
+  0x59, 0x82, 0x59, 0x82, 0xE1, 0x82, 0x98, 0x1D, 0xA3, 0x6E, 0x24, 0x1B, 0x09, 0x0B, 0x0D, 0x13,
+  0x0C, 0x05, 0x03, 0x02, 0x08, 0x08, 0x04, 0x01, 0x01, 0x08, 0x02, 0x03, 0x05, 0x0C, 0x13, 0x0B,
+  0x0A, 0x2A, 0x4E, 0x4B, 0x59, 0xAF, 0x82, 0x76, 0x06, 0xE9, 0xCC, 0xE5, 0xAB, 0x88, 0x48, 0x95,
+  0x84, 0x51, 0x0C, 0x69, 0x30, 0x30, 0x39, 0x34, 0x57, 0x89, 0x8E, 0x9D, 0x9E, 0x9E, 0xC4, 0xC4,
+  0x82, 0x24, 0xDB, 0x14, 0x1C, 0x24, 0x14, 0x6A, 0x14, 0x14, 0x6A, 0x6A, 0x1C, 0x6A, 0x1C, 0x5B,
+  0x5B, 0x66, 0x67, 0x67, 0x5C, 0x7E, 0x7A, 0x53, 0x4B, 0x54, 0x45, 0x90, 0x91, 0x59, 0x82, 0xAD,
+  0x82, 0xAF, 0x82, 0x98, 0x1D, 0xD3, 0x91, 0x14, 0x12, 0x0A, 0x0E, 0x0D, 0x06, 0x0C, 0x05, 0x03,
+  0x02, 0x08, 0x08, 0x04, 0x01, 0x01, 0x08, 0x02, 0x03, 0x05, 0x0C, 0x13, 0x0B, 0x09, 0x2A, 0x4E,
+  0x4B, 0xCE, 0xB0, 0x82, 0x76, 0x05, 0xE9, 0xCC, 0xE5, 0xF4, 0x88, 0x87, 0x82, 0x48, 0x82, 0x56,
+  0x01, 0x51, 0x51, 0x82, 0x30, 0x6D, 0x3D, 0x92, 0x8E, 0x9D, 0x9E, 0x9E, 0xC4, 0xC4, 0x24, 0x23,
+  0x23, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14,
+  0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14,
+  0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14,
+  0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14,
+  0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14,
+  0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14, 0x14, 0x24, 0x24, 0x14,
+  0x24, 0x24, 0x14, 0x14, 0x82, 0x6A, 0x33, 0x1C, 0x5B, 0x6B, 0x66, 0x67, 0x7D, 0x7E, 0x52, 0x53,
+  0x4B, 0x6E, 0x73, 0x45, 0x7F, 0x59, 0xAD, 0x59, 0x82, 0xAF, 0x76, 0x98, 0x98, 0x93, 0x80, 0x14,
+  0x12, 0x0A, 0x0E, 0x0B, 0x13, 0x0C, 0x05, 0x03, 0x02, 0x08, 0x08, 0x04, 0x01, 0x01, 0x08, 0x02,
+  0x03, 0x05, 0x0C, 0x13, 0x0D, 0x09, 0x12, 0x1C, 0x4B, 0xCE, 0x93, 0x82, 0x76, 0x05, 0xD2, 0xCC,
+  0xE5, 0xF4, 0x88, 0x87, 0x82, 0x48, 0x82, 0x56, 0x01, 0x51, 0x51, 0x82, 0x30, 0x06, 0x3D, 0x92,
+  0x8E, 0x9D, 0x9E, 0xC4, 0xC4, 0x83, 0x23, 0x55, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23,
+  0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23,
+  0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23,
+  0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23,
+  0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23,
+  0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x23, 0x23, 0x16, 0x16, 0x85, 0x23,
+  0x05, 0x16, 0x16, 0x24, 0x24, 0x16, 0x24, 0x82, 0x14, 0x13, 0x6A, 0x1C, 0x5B, 0x4E, 0x6B, 0x66,
+  0x67, 0x5C, 0x52, 0x7A, 0x53, 0x6E, 0x73, 0x73, 0x7F, 0x80, 0x96, 0x96, 0xAD, 0xDF, 0x82, 0x98,
+  0x1C, 0xD3, 0x59, 0x24, 0x17, 0x0A, 0x0E, 0x0B, 0x13, 0x06, 0x05, 0x03, 0x02, 0x08, 0x08, 0x04,
+  0x01, 0x01, 0x08, 0x08, 0x02, 0x03, 0x05, 0x06, 0x0D, 0x0E, 0x11, 0x1C, 0x4B, 0xC0, 0x83, 0x76,
+  0x06, 0xD2, 0xF5, 0xE5, 0xAB, 0x9F, 0x87, 0x48, 0x84, 0x56, 0x0A, 0x51, 0x3B, 0x30, 0x30, 0x3B,
+  0x62, 0x43, 0xD8, 0x9D, 0x9E, 0xC4, 0x82, 0x23, 0xDD, 0x16, 0x00, 0x23, 0x83, 0x16, 0x82, 0x23,
+  0x82, 0x14, 0x11, 0x6A, 0x1C, 0x5B, 0x6B, 0x66, 0x67, 0x5C, 0x52, 0x53, 0x6E, 0x54, 0x54, 0x90,
+  0x7F, 0x91, 0x91, 0x80, 0xDF, 0x82, 0x93, 0x26, 0xD3, 0x82, 0x14, 0x1B, 0x09, 0x0E, 0x0D, 0x13,
+  0x06, 0x05, 0x03, 0x02, 0x02, 0x08, 0x04, 0x01, 0x01, 0x08, 0x08, 0x02, 0x03, 0x05, 0x06, 0x13,
+  0x0B, 0x11, 0x23, 0x4B, 0xC2, 0x93, 0x76, 0x76, 0xE9, 0xFF, 0xE4, 0xF2, 0x88, 0x87, 0x48, 0x82,
+  0x56, 0x82, 0x51, 0x00, 0x69, 0x82, 0x30, 0x05, 0x51, 0x34, 0x43, 0xD0, 0x9D, 0xEA, 0x82, 0xA2,
+  0x84, 0x2A, 0xD1, 0x1D, 0x01, 0x2A, 0x2A, 0x85, 0x1D, 0x09, 0x2A, 0x2A, 0x1D, 0x1D, 0x2A, 0x1D,
+  0x1D, 0x16, 0x23, 0x23, 0x82, 0x14, 0x09, 0x1C, 0x5B, 0x66, 0x67, 0x7D, 0x52, 0x7A, 0x53, 0x6E,
+  0x6E, 0x84, 0x45, 0x00, 0xA3, 0x82, 0xD3, 0x1C, 0xB0, 0xCE, 0x24, 0x11, 0x09, 0x0B, 0x0D, 0x13,
+  0x0C, 0x05, 0x03, 0x02, 0x08, 0x08, 0x04, 0x01, 0x01, 0x04, 0x08, 0x02, 0x03, 0x05, 0x0C, 0x13,
+  0x0B, 0x09, 0x2A, 0x7A, 0xC2, 0x82, 0x93, 0x1E, 0xE9, 0xF8, 0xF9, 0xF2, 0x9F, 0x48, 0x48, 0x56,
+  0x51, 0x51, 0x69, 0x69, 0x51, 0x3B, 0x30, 0x34, 0x3B, 0x51, 0x39, 0x57, 0xD0, 0x85, 0xEA, 0xA2,
+  0xA2, 0x2A, 0x2A, 0x12, 0x12, 0x2A, 0x2A, 0x85, 0x12, 0x05, 0x2A, 0x2A, 0x12, 0x12, 0x2A, 0x2A,
+  0x89, 0x12, 0x05, 0x2A, 0x2A, 0x12, 0x12, 0x2A, 0x2A, 0x89, 0x12, 0x05, 0x2A, 0x2A, 0x12, 0x12,
+  0x2A, 0x2A, 0x89, 0x12, 0x05, 0x2A, 0x2A, 0x12, 0x12, 0x2A, 0x2A, 0x89, 0x12, 0x05, 0x2A, 0x2A,
+  0x12, 0x12, 0x2A, 0x2A, 0x85, 0x12, 0x0C, 0x2A, 0x2A, 0x12, 0x12, 0x2A, 0x2A, 0x12, 0x12, 0x2A,
+  0x1D, 0x12, 0x12, 0x2A, 0x83, 0x1D, 0x13, 0x16, 0x23, 0x23, 0x14, 0x6A, 0x1C, 0x5B, 0x66, 0x7C,
+  0x5C, 0x7E, 0x71, 0x4B, 0x4B, 0x73, 0x45, 0x73, 0x54, 0x54, 0xD1, 0x82, 0xB0, 0x26, 0xAF, 0xCD,
+  0x23, 0x0A, 0x0E, 0x0B, 0x13, 0x06, 0x0C, 0x05, 0x03, 0x02, 0x08, 0x08, 0x04, 0x01, 0x01, 0x04,
+  0x08, 0x08, 0x02, 0x03, 0x0C, 0x06, 0x0D, 0x0E, 0x11, 0x7E, 0xC0, 0xB0, 0x93, 0x93, 0xD2, 0xF8,
+  0xF9, 0x9F, 0x48, 0x95, 0x56, 0x82, 0x69, 0x83, 0x3B, 0x0E, 0x94, 0x34, 0x30, 0x51, 0x34, 0x57,
+  0xD0, 0x85, 0x9C, 0xA2, 0xA2, 0x12, 0x12, 0x17, 0x12, 0x82, 0x17, 0x00, 0x12, 0xD9, 0x17, 0x05,
+  0x12, 0x12, 0x17, 0x17, 0x12, 0x12, 0x82, 0x1D, 0x3C, 0x16, 0x23, 0x14, 0x14, 0x1C, 0x4E, 0x6B,
+  0x7C, 0x5C, 0x52, 0x71, 0x71, 0x54, 0x73, 0x54, 0x54, 0x4B, 0xAE, 0xAF, 0xAF, 0xE0, 0xDF, 0x82,
+  0x2A, 0x09, 0x0E, 0x0B, 0x13, 0x06, 0x0C, 0x05, 0x03, 0x02, 0x08, 0x08, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x08, 0x02, 0x03, 0x05, 0x0C, 0x06, 0x0D, 0x0A, 0x5C, 0xC0, 0xAF, 0xB0, 0xB0, 0xD2, 0xF8,
+  0xE7, 0xEE, 0x56, 0x69, 0x51, 0x69, 0x82, 0x3B, 0x82, 0x30, 0x0C, 0x34, 0x5E, 0x3B, 0x3B, 0x34,
+  0x57, 0x89, 0x85, 0x9C, 0xCB, 0xA2, 0x7B, 0x11, 0xBB, 0x1B, 0x01, 0x11, 0x11, 0xA4, 0x1B, 0x01,
+  0x17, 0x17, 0x82, 0x12, 0x82, 0x1D, 0x0F, 0x23, 0x23, 0x14, 0x1C, 0x4E, 0x6B, 0x7C, 0x5C, 0x7E,
+  0x7E, 0x54, 0x6E, 0x4B, 0x53, 0x7E, 0xC1, 0x82, 0xA3, 0x27, 0xD1, 0x59, 0x12, 0x09, 0x0B, 0x0D,
+  0x13, 0x06, 0x0C, 0x05, 0x03, 0x02, 0x02, 0x08, 0x04, 0x04, 0x01, 0x04, 0x04, 0x08, 0x08, 0x02,
+  0x03, 0x05, 0x0C, 0x13, 0x0E, 0x66, 0xCE, 0xDF, 0xAF, 0xAF, 0xDF, 0xFD, 0xE7, 0xEE, 0x56, 0x69,
+  0x51, 0x3B, 0x85, 0x30, 0x0A, 0x34, 0x5E, 0x3B, 0x3B, 0x34, 0x27, 0x89, 0x85, 0x9C, 0xCB, 0x7B,
+  0x82, 0x11, 0x02, 0x0A, 0x0A, 0x1B, 0x82, 0x0A, 0x53, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A,
+  0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A,
+  0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A,
+  0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A,
+  0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A,
+  0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x83, 0x0A, 0x01,
+  0x11, 0x0A, 0x86, 0x1B, 0x32, 0x12, 0x12, 0x1D, 0x1D, 0x16, 0x23, 0x14, 0x6A, 0x4E, 0x5B, 0x7C,
+  0x67, 0x67, 0x4B, 0x53, 0x53, 0x52, 0x66, 0xCF, 0xDE, 0xAE, 0xAE, 0xE8, 0x96, 0x1B, 0x0E, 0x0B,
+  0x0D, 0x13, 0x06, 0x0C, 0x05, 0x03, 0x02, 0x02, 0x08, 0x04, 0x04, 0x01, 0x01, 0x04, 0x04, 0x08,
+  0x08, 0x02, 0x03, 0x05, 0x06, 0x0B, 0x1C, 0xCE, 0x83, 0xA3, 0x17, 0xF7, 0xEC, 0xEE, 0x51, 0x30,
+  0x3B, 0x30, 0x30, 0x94, 0x30, 0x30, 0x94, 0x34, 0x34, 0x5E, 0x30, 0x3B, 0x34, 0x57, 0x89, 0x85,
+  0x9C, 0xCB, 0x7B, 0xE1, 0x0A, 0x01, 0x19, 0x11, 0x83, 0x0A, 0x00, 0x11, 0x82, 0x1B, 0x25, 0x12,
+  0x12, 0x2A, 0x1D, 0x23, 0x24, 0x6A, 0x1C, 0x6B, 0x6B, 0x66, 0x71, 0x7E, 0x52, 0x67, 0x1C, 0xAD,
+  0xAE, 0xE8, 0xE8, 0xC1, 0x91, 0x1B, 0x2D, 0x0D, 0x0D, 0x13, 0x06, 0x0C, 0x05, 0x03, 0x03, 0x02,
+  0x08, 0x08, 0x04, 0x04, 0x01, 0x82, 0x04, 0x07, 0x08, 0x02, 0x02, 0x03, 0x0C, 0x0D, 0x23, 0x82,
+  0x83, 0xDE, 0x02, 0xF7, 0xEC, 0xC6, 0x84, 0x30, 0x01, 0x94, 0x94, 0x82, 0x34, 0x0C, 0x5E, 0x3D,
+  0x30, 0x3B, 0x62, 0x57, 0x89, 0x85, 0x78, 0x7B, 0x7B, 0x0A, 0x0A, 0xDF, 0x15, 0x03, 0x19, 0x19,
+  0x15, 0x19, 0x84, 0x0A, 0x08, 0x11, 0x11, 0x17, 0x12, 0x12, 0x1D, 0x16, 0x24, 0x14, 0x82, 0x1C,
+  0x1B, 0x52, 0x7C, 0x7D, 0x6B, 0x23, 0x96, 0xC1, 0xC1, 0xCF, 0xCF, 0x90, 0x0A, 0x1A, 0x0B, 0x0D,
+  0x13, 0x13, 0x06, 0x0C, 0x05, 0x03, 0x02, 0x08, 0x08, 0x04, 0x04, 0x01, 0x01, 0x82, 0x04, 0x06,
+  0x08, 0x08, 0x03, 0x05, 0x13, 0x12, 0x59, 0x83, 0xAE, 0x1B, 0xCC, 0xB8, 0xC6, 0x30, 0x34, 0x30,
+  0x94, 0x94, 0x5E, 0x94, 0x34, 0x34, 0x5E, 0x5E, 0x3D, 0x30, 0x30, 0x62, 0x27, 0x89, 0x70, 0x78,
+  0x78, 0xDB, 0x0A, 0x09, 0x15, 0x15, 0xE1, 0x09, 0x83, 0x15, 0x01, 0x19, 0x0A, 0x82, 0x11, 0x0D,
+  0x1B, 0x12, 0x2A, 0x1D, 0x23, 0x14, 0x24, 0x14, 0x7D, 0x4E, 0x66, 0x14, 0x12, 0x91, 0x82, 0xCD,
+  0x10, 0xAD, 0x90, 0x5B, 0x5B, 0x6A, 0x1C, 0x1D, 0x1A, 0x06, 0x06, 0x0C, 0x05, 0x03, 0x02, 0x08,
+  0x04, 0x04, 0x82, 0x01, 0x08, 0x04, 0x04, 0x08, 0x08, 0x02, 0x03, 0x06, 0x12, 0x59, 0x83, 0xC2,
+  0x18, 0xF5, 0xB8, 0xC6, 0x94, 0x34, 0x94, 0x34, 0x34, 0x5E, 0x34, 0x5E, 0x34, 0x5E, 0x3D, 0x49,
+  0x39, 0x30, 0x3D, 0x27, 0x89, 0x70, 0x78, 0x78, 0xB4, 0xB4, 0xE6, 0x0E, 0x14, 0x09, 0x09, 0x15,
+  0x15, 0x19, 0x0A, 0x0A, 0x11, 0x1B, 0x1B, 0x12, 0x2A, 0x16, 0x1D, 0x1D, 0x66, 0x14, 0x4E, 0x23,
+  0x11, 0x90, 0x82, 0xAD, 0x03, 0x96, 0x73, 0x6B, 0x67, 0x82, 0x6B, 0x09, 0x1D, 0x31, 0x06, 0x0C,
+  0x05, 0x03, 0x02, 0x02, 0x08, 0x04, 0x83, 0x01, 0x82, 0x04, 0x05, 0x08, 0x03, 0x0C, 0x12, 0x80,
+  0xCE, 0x82, 0xC0, 0x17, 0xF3, 0xB8, 0xC6, 0x94, 0x5E, 0x34, 0x34, 0x5E, 0x5E, 0x34, 0x5E, 0x34,
+  0x3D, 0x49, 0x49, 0x30, 0x34, 0x3D, 0x27, 0x89, 0xA0, 0xB5, 0x78, 0xB4, 0x82, 0x0E, 0xE0, 0x1A,
+  0x01, 0x2D, 0x2D, 0x84, 0x0E, 0x11, 0x09, 0x09, 0x15, 0x15, 0x19, 0x19, 0x11, 0x11, 0x1B, 0x12,
+  0x2A, 0x12, 0x5B, 0x16, 0x14, 0x12, 0x15, 0x53, 0x82, 0x96, 0x11, 0x91, 0xCA, 0x19, 0x1A, 0x1E,
+  0x31, 0x64, 0x1A, 0x0E, 0x0D, 0x06, 0x0C, 0x05, 0x03, 0x02, 0x08, 0x04, 0x00, 0x84, 0x01, 0x05,
+  0x04, 0x08, 0x02, 0x05, 0x12, 0x80, 0x83, 0x82, 0x18, 0xF0, 0xB8, 0xC6, 0x5E, 0x5E, 0x34, 0x34,
+  0x5E, 0x3D, 0x5E, 0x3D, 0x3D, 0x49, 0x27, 0x49, 0x39, 0x34, 0x3D, 0x27, 0x89, 0xA0, 0xB5, 0x78,
+  0xB2, 0xB1, 0xE4, 0x0B, 0x84, 0x1A, 0x02, 0x2D, 0x0E, 0x0E, 0x82, 0x09, 0x0C, 0x19, 0x19, 0x0A,
+  0x11, 0x11, 0x1B, 0x14, 0x11, 0x12, 0x0A, 0x2D, 0x52, 0x91, 0x82, 0x90, 0x11, 0x6E, 0xD9, 0x2D,
+  0x1A, 0x1E, 0x31, 0x1E, 0x0A, 0x0B, 0x13, 0x06, 0x0C, 0x03, 0x02, 0x08, 0x08, 0x00, 0x00, 0x83,
+  0x01, 0x05, 0x04, 0x04, 0x02, 0x03, 0x11, 0x7F, 0x83, 0x59, 0x07, 0xF0, 0xB8, 0xDA, 0x5E, 0x49,
+  0x5E, 0x5E, 0x3D, 0x82, 0x49, 0x0D, 0x3D, 0x3D, 0x27, 0x27, 0x39, 0x34, 0x3D, 0x50, 0x89, 0xA0,
+  0xB5, 0x9B, 0xB2, 0xB1, 0xE8, 0x0D, 0x83, 0x0B, 0x82, 0x0E, 0x82, 0x09, 0x08, 0x0A, 0x19, 0x15,
+  0x12, 0x09, 0x11, 0x09, 0x0B, 0x67, 0x83, 0xBF, 0x0F, 0xB7, 0x67, 0x53, 0x53, 0x52, 0x7D, 0x16,
+  0x1D, 0x0E, 0x0B, 0x13, 0x0C, 0x05, 0x03, 0x07, 0x04, 0x82, 0x00, 0x09, 0x01, 0x00, 0x01, 0x01,
+  0x04, 0x08, 0x02, 0x0A, 0x7F, 0x80, 0x82, 0x59, 0x06, 0xE3, 0xB8, 0xDA, 0x49, 0x49, 0x3D, 0x3D,
+  0x83, 0x49, 0x00, 0x3D, 0x82, 0x27, 0x09, 0x34, 0x34, 0x49, 0x2E, 0x8C, 0xA0, 0x9A, 0x9B, 0xB1,
+  0xB1, 0x82, 0x0D, 0x03, 0x1E, 0x1E, 0x0D, 0x31, 0xDD, 0x1E, 0x83, 0x0D, 0x01, 0x0B, 0x0D, 0x82,
+  0x0B, 0x04, 0x1A, 0x0B, 0x0B, 0x0E, 0x0E, 0x82, 0x09, 0x19, 0x17, 0x1A, 0x15, 0x2D, 0x0D, 0x6B,
+  0x73, 0x73, 0xBF, 0xBF, 0xB7, 0x96, 0xE0, 0xE0, 0xE1, 0xE1, 0xE8, 0x5C, 0x15, 0x0E, 0x0D, 0x06,
+  0x05, 0x03, 0x07, 0x04, 0x84, 0x00, 0x82, 0x01, 0x0E, 0x08, 0x02, 0x0A, 0x45, 0x7F, 0x7F, 0x80,
+  0x80, 0xE3, 0xB8, 0xDA, 0x49, 0x49, 0x3D, 0x3D, 0x84, 0x49, 0x82, 0x27, 0x0C, 0x34, 0x62, 0x27,
+  0x2E, 0xAC, 0xA0, 0x9A, 0x9B, 0xB1, 0x0D, 0x13, 0x31, 0x31, 0x85, 0x13, 0x83, 0x31, 0xD7, 0x13,
+  0x85, 0x31, 0x01, 0x1E, 0x1E, 0x83, 0x0D, 0x0A, 0x0B, 0x1A, 0x0E, 0x1A, 0x1A, 0x0A, 0x0D, 0x0E,
+  0x1A, 0x31, 0x6A, 0x83, 0xCA, 0x0F, 0x6E, 0x96, 0xE0, 0xE0, 0xE1, 0xE1, 0xA3, 0x73, 0x11, 0x0E,
+  0x0D, 0x06, 0x05, 0x03, 0x02, 0x08, 0x85, 0x00, 0x10, 0x01, 0x01, 0x04, 0x02, 0x09, 0x54, 0x45,
+  0x7F, 0x7F, 0xE6, 0xED, 0x97, 0xDA, 0x49, 0x27, 0x49, 0x3D, 0x85, 0x27, 0x0C, 0x2E, 0x27, 0x34,
+  0x62, 0x27, 0x2E, 0xAC, 0xA0, 0x9A, 0x99, 0xB3, 0xD6, 0x13, 0xE8, 0x06, 0x83, 0x13, 0x82, 0x31,
+  0x11, 0x0D, 0x0D, 0x1A, 0x0B, 0x1A, 0x15, 0x31, 0x0B, 0x31, 0x06, 0x14, 0x6E, 0xB7, 0xB7, 0x6E,
+  0xB7, 0xBF, 0xAE, 0x83, 0xD1, 0x08, 0x90, 0x11, 0x0E, 0x0D, 0x06, 0x05, 0x03, 0x02, 0x08, 0x82,
+  0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x01, 0x04, 0x08, 0x0E, 0x4B, 0x83, 0x45, 0x06, 0x9D, 0x97,
+  0x86, 0x49, 0x27, 0x27, 0x3D, 0x85, 0x27, 0x0B, 0x8D, 0x27, 0x34, 0x3D, 0x27, 0x2E, 0xAC, 0xA0,
+  0x9A, 0x99, 0xB3, 0xD6, 0xEA, 0x06, 0x86, 0x13, 0x00, 0x31, 0x82, 0x0D, 0x19, 0x0E, 0x06, 0x0D,
+  0x06, 0x0C, 0x16, 0x53, 0x53, 0xB7, 0xB7, 0x53, 0xB7, 0xCD, 0xCF, 0xC1, 0xC1, 0xC0, 0x73, 0x0A,
+  0x1A, 0x31, 0x06, 0x05, 0x03, 0x08, 0x04, 0x86, 0x00, 0x04, 0x01, 0x04, 0x08, 0x0B, 0x71, 0x82,
+  0x54, 0x03, 0x45, 0x9D, 0x97, 0x86, 0x88, 0x27, 0x10, 0x2E, 0x8D, 0x8D, 0x62, 0x3D, 0x27, 0x2E,
+  0xAC, 0xA0, 0x9A, 0x99, 0xB3, 0x06, 0x4C, 0x1F, 0x1F, 0x0C, 0x86, 0x1F, 0x09, 0x37, 0x37, 0x1F,
+  0x1F, 0x37, 0x37, 0x1F, 0x1F, 0x37, 0x37, 0x85, 0x1F, 0x09, 0x37, 0x37, 0x1F, 0x1F, 0x37, 0x37,
+  0x1F, 0x1F, 0x37, 0x37, 0x85, 0x1F, 0x09, 0x37, 0x37, 0x1F, 0x1F, 0x37, 0x37, 0x1F, 0x1F, 0x37,
+  0x37, 0x85, 0x1F, 0x09, 0x37, 0x37, 0x1F, 0x1F, 0x37, 0x37, 0x1F, 0x1F, 0x37, 0x37, 0x85, 0x1F,
+  0x09, 0x37, 0x37, 0x1F, 0x1F, 0x37, 0x37, 0x1F, 0x1F, 0x37, 0x37, 0x85, 0x1F, 0x09, 0x37, 0x37,
+  0x1F, 0x1F, 0x37, 0x37, 0x1F, 0x1F, 0x37, 0x37, 0x84, 0x1F, 0x82, 0x64, 0x85, 0x06, 0x1C, 0x31,
+  0x13, 0x31, 0x1A, 0x06, 0x13, 0x64, 0x26, 0x17, 0x52, 0x52, 0xC9, 0xC9, 0x52, 0x7D, 0xCA, 0x90,
+  0x91, 0x96, 0x91, 0x53, 0x09, 0x0D, 0x06, 0x0C, 0x03, 0x02, 0x08, 0x04, 0x86, 0x00, 0x04, 0x01,
+  0x04, 0x04, 0x0D, 0x7A, 0x82, 0x4B, 0x05, 0xF1, 0x9C, 0x97, 0x86, 0x27, 0x2E, 0x83, 0x27, 0x11,
+  0x2E, 0x27, 0x50, 0x2E, 0x8D, 0x8D, 0x62, 0x3D, 0x27, 0x46, 0xAC, 0xA0, 0xA5, 0x99, 0xB3, 0x06,
+  0x4C, 0x1F, 0xE7, 0x0C, 0x84, 0x1F, 0x20, 0x64, 0x64, 0x06, 0x06, 0x13, 0x06, 0x06, 0x0D, 0x0C,
+  0x06, 0x0C, 0x10, 0x17, 0x7D, 0x7D, 0xAA, 0xAA, 0xA9, 0xC8, 0xAA, 0xC9, 0x53, 0x6E, 0x53, 0x66,
+  0x0B, 0x13, 0x0C, 0x05, 0x03, 0x02, 0x08, 0x04, 0x87, 0x00, 0x0F, 0x01, 0x04, 0x0D, 0x5C, 0x7A,
+  0x71, 0x71, 0xF1, 0x9C, 0x97, 0x79, 0x27, 0x2E, 0x50, 0x57, 0x2E, 0x83, 0x50, 0x0F, 0x46, 0x46,
+  0x2E, 0x62, 0x3D, 0x27, 0x46, 0xAC, 0xBE, 0xD4, 0xC3, 0xA7, 0x63, 0x03, 0x03, 0x10, 0xE6, 0x03,
+  0x83, 0x10, 0x00, 0x03, 0x82, 0x10, 0x11, 0x05, 0x0C, 0x05, 0x0C, 0x06, 0x10, 0x05, 0x05, 0x02,
+  0x19, 0xA9, 0x6B, 0xA9, 0xA9, 0xC8, 0x17, 0x16, 0x14, 0x82, 0xC8, 0x08, 0x1D, 0x06, 0x1F, 0x05,
+  0x03, 0x02, 0x08, 0x08, 0x04, 0x87, 0x00, 0x12, 0x01, 0x04, 0x13, 0x24, 0x1C, 0x4E, 0x4E, 0x9E,
+  0xB5, 0xA0, 0x89, 0x36, 0x36, 0x2C, 0x8C, 0x36, 0x36, 0x5D, 0x8C, 0x82, 0x21, 0x0A, 0x36, 0x43,
+  0x2E, 0x3A, 0x5D, 0x6C, 0x61, 0x4F, 0x44, 0x2F, 0x2B, 0xF2, 0x00, 0x0A, 0x04, 0x01, 0x04, 0x02,
+  0x08, 0x07, 0x02, 0x08, 0x15, 0x19, 0x1A, 0x82, 0x2D, 0x01, 0x15, 0x19, 0x82, 0xD9, 0x06, 0x19,
+  0x2D, 0x1F, 0x05, 0x03, 0x02, 0x08, 0x82, 0x04, 0x88, 0x00, 0x0D, 0x01, 0x0C, 0x0C, 0x05, 0x0C,
+  0x0C, 0xA7, 0x60, 0x70, 0xAC, 0x21, 0xA8, 0x21, 0x21, 0x85, 0x32, 0x0B, 0x47, 0x21, 0x43, 0x46,
+  0x2C, 0x21, 0x8B, 0x61, 0xDD, 0x44, 0x2F, 0x2B, 0xF2, 0x00, 0x09, 0x04, 0x01, 0x04, 0x02, 0x04,
+  0x08, 0x07, 0x04, 0x0E, 0x31, 0x83, 0x26, 0x00, 0x31, 0x84, 0x1E, 0x08, 0x64, 0x10, 0x03, 0x02,
+  0x08, 0x08, 0x04, 0x01, 0x01, 0x88, 0x00, 0x10, 0x01, 0x05, 0x03, 0x08, 0x02, 0x03, 0x63, 0x83,
+  0x70, 0x6C, 0x21, 0x47, 0x4A, 0x4A, 0x32, 0x32, 0x4D, 0x82, 0x32, 0x0B, 0x47, 0x21, 0x92, 0x46,
+  0x36, 0x21, 0x4D, 0x61, 0x4F, 0x44, 0x2F, 0x2B, 0xF2, 0x00, 0x0F, 0x04, 0x01, 0x04, 0x02, 0x6D,
+  0x04, 0x08, 0x04, 0x0E, 0x06, 0x05, 0x26, 0x10, 0x26, 0x64, 0x1F, 0x82, 0x64, 0x09, 0x1F, 0x05,
+  0x02, 0x02, 0x07, 0x08, 0x04, 0x04, 0x01, 0x01, 0x88, 0x00, 0x0B, 0x01, 0x03, 0x03, 0x08, 0x08,
+  0x02, 0x63, 0x83, 0x70, 0x6C, 0x21, 0x47, 0x83, 0x4A, 0x82, 0x32, 0x0C, 0x4A, 0x47, 0x21, 0x92,
+  0x46, 0x36, 0x21, 0x4D, 0x61, 0x4F, 0x44, 0x2F, 0x2B, 0xF2, 0x00, 0x11, 0x01, 0x01, 0x04, 0x02,
+  0x6D, 0x04, 0x04, 0x0F, 0x1A, 0x06, 0x10, 0x10, 0x03, 0x10, 0x26, 0x10, 0x10, 0x03, 0x82, 0x02,
+  0x04, 0x07, 0x08, 0x08, 0x04, 0x04, 0x82, 0x01, 0x89, 0x00, 0x1E, 0x03, 0x02, 0x08, 0x08, 0x02,
+  0x3F, 0xBA, 0x70, 0x6C, 0x47, 0x47, 0x4A, 0x4A, 0x32, 0x32, 0x4D, 0x32, 0x32, 0x4A, 0x32, 0x21,
+  0x92, 0x46, 0x5D, 0x4A, 0x4D, 0x61, 0x4F, 0x44, 0x2F, 0x2B, 0xF2, 0x00, 0x14, 0x01, 0x01, 0x04,
+  0x07, 0x0F, 0x04, 0x04, 0x0F, 0x0B, 0x64, 0x10, 0x10, 0x02, 0x03, 0x10, 0x07, 0x08, 0x08, 0x04,
+  0x04, 0x08, 0x83, 0x04, 0x82, 0x01, 0x8A, 0x00, 0x0F, 0x03, 0x02, 0x08, 0x08, 0x02, 0x3F, 0xBA,
+  0x70, 0x6C, 0x47, 0x47, 0x4A, 0x4A, 0x32, 0x32, 0x4D, 0x83, 0x32, 0x0A, 0xA8, 0x92, 0x2C, 0x2C,
+  0x4A, 0x4D, 0x61, 0xDD, 0x44, 0x2F, 0x2B, 0xF2, 0x00, 0x0A, 0x01, 0x00, 0x04, 0x07, 0x0F, 0x0F,
+  0x04, 0x01, 0x0B, 0x1F, 0x10, 0x82, 0x02, 0x02, 0x10, 0x07, 0x08, 0x84, 0x04, 0x03, 0x0F, 0x0F,
+  0x01, 0x01, 0x8C, 0x00, 0x01, 0x03, 0x02, 0x82, 0x08, 0x09, 0x33, 0x42, 0x70, 0x6C, 0x47, 0x47,
+  0x4A, 0x4A, 0x32, 0x4D, 0x84, 0x32, 0x0A, 0xA8, 0x43, 0x2C, 0x5D, 0x32, 0x4D, 0x61, 0xDD, 0x44,
+  0x2F, 0x2B, 0xF2, 0x00, 0x0A, 0x01, 0x00, 0x04, 0x08, 0x01, 0x04, 0x04, 0x01, 0x0B, 0x1F, 0x10,
+  0x82, 0x41, 0x01, 0x03, 0x08, 0x82, 0x04, 0x01, 0x01, 0x04, 0x85, 0x01, 0x8B, 0x00, 0x0E, 0x02,
+  0x02, 0x04, 0x08, 0x02, 0x33, 0x42, 0x70, 0x6C, 0x47, 0x47, 0x4A, 0x4A, 0x47, 0x4D, 0x84, 0x32,
+  0x0A, 0xA8, 0x50, 0x2C, 0x36, 0x21, 0x4D, 0x61, 0xDD, 0x44, 0x2F, 0x2B, 0xF2, 0x00, 0x03, 0x01,
+  0x00, 0x04, 0x08, 0x82, 0x04, 0x07, 0x01, 0x0D, 0x0C, 0x10, 0x41, 0x07, 0x41, 0x41, 0x82, 0x6D,
+  0x05, 0x01, 0x01, 0x6D, 0x01, 0x00, 0x01, 0x8E, 0x00, 0x0F, 0x02, 0x02, 0x04, 0x08, 0x02, 0x33,
+  0x42, 0x70, 0x6C, 0x47, 0x4D, 0x4A, 0x4A, 0x32, 0x4D, 0x4D, 0x82, 0x32, 0x0B, 0x47, 0xA8, 0x92,
+  0x3A, 0x2C, 0x21, 0x4D, 0x61, 0x4F, 0x44, 0x2F, 0x2B, 0xF2, 0x00, 0x0B, 0x01, 0x00, 0x04, 0x08,
+  0x68, 0x04, 0x08, 0x08, 0x1A, 0x1F, 0x02, 0x41, 0x82, 0x07, 0x05, 0x04, 0x6D, 0x6D, 0x0F, 0x01,
+  0x01, 0x91, 0x00, 0x00, 0x02, 0x83, 0x08, 0x0A, 0x33, 0x42, 0x70, 0x6C, 0x47, 0x47, 0x4A, 0x4A,
+  0x32, 0x47, 0x47, 0x82, 0x32, 0x0B, 0x47, 0xA8, 0x50, 0x77, 0x2C, 0x21, 0x4D, 0x61, 0x4F, 0x44,
+  0x2F, 0x18, 0xF2, 0x00, 0x0B, 0x01, 0x00, 0x04, 0x08, 0x0F, 0x04, 0x02, 0x02, 0x2D, 0x1F, 0x02,
+  0x41, 0x82, 0x07, 0x00, 0x04, 0x82, 0x0F, 0x01, 0x01, 0x01, 0x90, 0x00, 0x01, 0x01, 0x02, 0x83,
+  0x08, 0x09, 0x33, 0x42, 0x70, 0x6C, 0x21, 0x47, 0x4A, 0x21, 0x4A, 0x4A, 0x82, 0x21, 0x0D, 0x32,
+  0xA8, 0x36, 0x43, 0x46, 0x2C, 0x21, 0x4D, 0x61, 0x4F, 0x44, 0x33, 0x38, 0x2B, 0xEB, 0x04, 0x00,
+  0x68, 0x84, 0x04, 0x0B, 0x08, 0x08, 0x02, 0x10, 0x08, 0x41, 0x02, 0x03, 0x0E, 0x0C, 0x02, 0x41,
+  0x82, 0x07, 0x01, 0x04, 0x0F, 0x83, 0x01, 0x91, 0x00, 0x0B, 0x02, 0x08, 0x04, 0x08, 0x08, 0x33,
+  0x72, 0x70, 0x6C, 0x21, 0x47, 0x4A, 0x85, 0x5D, 0x0F, 0x21, 0x21, 0x36, 0x43, 0x50, 0x2C, 0x21,
+  0x4D, 0x61, 0x55, 0x58, 0x63, 0x3F, 0x38, 0x02, 0x08, 0xC5, 0x07, 0x83, 0x08, 0x03, 0x07, 0x07,
+  0x08, 0x08, 0x85, 0x07, 0x01, 0x08, 0x08, 0x89, 0x07, 0x05, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08,
+  0x88, 0x07, 0x0C, 0x02, 0x03, 0x03, 0x10, 0x1F, 0x02, 0x26, 0x05, 0x26, 0x0E, 0x05, 0x02, 0x07,
+  0x82, 0x08, 0x00, 0x04, 0x82, 0x01, 0x01, 0x00, 0x01, 0x90, 0x00, 0x0D, 0x01, 0x08, 0x08, 0x04,
+  0x08, 0x08, 0x33, 0x40, 0x70, 0x6C, 0x21, 0x47, 0x21, 0x5D, 0x84, 0x21, 0x0F, 0x5D, 0x21, 0x36,
+  0x50, 0x50, 0x77, 0x21, 0x4D, 0xBE, 0x55, 0x58, 0x63, 0x3F, 0x38, 0x02, 0x02, 0x9F, 0x07, 0x01,
+  0x08, 0x08, 0xA3, 0x07, 0x83, 0x08, 0x91, 0x07, 0x04, 0x08, 0x08, 0x07, 0x02, 0x02, 0x8B, 0x07,
+  0x82, 0x02, 0x04, 0x03, 0x03, 0x05, 0x06, 0x03, 0x82, 0x05, 0x03, 0x0E, 0x0C, 0x02, 0x41, 0x82,
+  0x08, 0x05, 0x6D, 0x0F, 0x0F, 0x01, 0x00, 0x01, 0x90, 0x00, 0x0D, 0x01, 0x08, 0x08, 0x04, 0x08,
+  0x02, 0x33, 0x40, 0x70, 0x6C, 0x21, 0x47, 0x21, 0x5D, 0x86, 0x21, 0x0D, 0x36, 0x43, 0x50, 0x77,
+  0x21, 0x4D, 0x61, 0x55, 0x58, 0x63, 0x3F, 0x02, 0x02, 0x08, 0x82, 0x07, 0x00, 0x02, 0x9B, 0x07,
+  0x01, 0x08, 0x08, 0xA3, 0x07, 0x83, 0x08, 0x91, 0x07, 0x01, 0x08, 0x08, 0x90, 0x07, 0x0C, 0x02,
+  0x03, 0x03, 0x05, 0x06, 0x03, 0x0C, 0x1F, 0x05, 0x0E, 0x0C, 0x02, 0x41, 0x82, 0x08, 0x05, 0x6D,
+  0x0F, 0x0F, 0x01, 0x00, 0x01, 0x91, 0x00, 0x82, 0x08, 0x07, 0x07, 0x08, 0x33, 0x40, 0x70, 0x6C,
+  0x21, 0x47, 0x88, 0x21, 0x0A, 0x36, 0x50, 0x2E, 0x3A, 0x21, 0x4D, 0x61, 0x55, 0x58, 0x63, 0x3F,
+  0x82, 0x02, 0x00, 0x08, 0x84, 0x02, 0x83, 0x08, 0xE5, 0x02, 0x14, 0x03, 0x03, 0x05, 0x06, 0x10,
+  0x64, 0x0C, 0x0C, 0x0E, 0x05, 0x41, 0x07, 0x08, 0x08, 0x04, 0x0F, 0x0F, 0x01, 0x01, 0x00, 0x01,
+  0x91, 0x00, 0x82, 0x08, 0x07, 0x07, 0x08, 0x33, 0x72, 0xDC, 0x6C, 0x21, 0x47, 0x87, 0x21, 0x0B,
+  0x36, 0x36, 0x43, 0x2E, 0x3A, 0x21, 0x4D, 0x61, 0x55, 0x58, 0x63, 0x3F, 0xF2, 0x02, 0x14, 0x03,
+  0x03, 0x05, 0x06, 0x10, 0x06, 0x1F, 0x1F, 0x09, 0x05, 0x41, 0x07, 0x08, 0x08, 0x04, 0x0F, 0x01,
+  0x01, 0x00, 0x01, 0x04, 0x91, 0x00, 0x82, 0x08, 0x1C, 0x07, 0x08, 0x33, 0x72, 0xDC, 0x6C, 0x21,
+  0x47, 0x21, 0x5D, 0x5D, 0x36, 0x36, 0x5D, 0x5D, 0x21, 0x21, 0x36, 0x43, 0x50, 0x3A, 0x21, 0x4D,
+  0x61, 0x55, 0x58, 0x63, 0x3F, 0x03, 0xF1, 0x02, 0x0F, 0x03, 0x22, 0x05, 0x13, 0x10, 0x13, 0x06,
+  0x06, 0x0E, 0x05, 0x41, 0x07, 0x08, 0x08, 0x07, 0x41, 0x83, 0x07, 0x00, 0x08, 0x91, 0x00, 0x82,
+  0x08, 0x08, 0x07, 0x02, 0x33, 0x72, 0xBE, 0x6C, 0x21, 0x32, 0x21, 0x83, 0x2C, 0x0F, 0x36, 0x2C,
+  0x21, 0x36, 0x36, 0x43, 0x50, 0x46, 0x21, 0x4D, 0x61, 0x55, 0x58, 0x63, 0x3F, 0x03, 0xF0, 0x02,
+  0x0F, 0x03, 0x22, 0x22, 0x05, 0x31, 0x10, 0x31, 0x06, 0x06, 0x09, 0x10, 0x02, 0x07, 0x08, 0x08,
+  0x05, 0x82, 0x31, 0x02, 0x13, 0x06, 0x02, 0x91, 0x00, 0x0B, 0x08, 0x08, 0x04, 0x02, 0x02, 0x33,
+  0x72, 0x65, 0x81, 0x21, 0x47, 0x5D, 0x86, 0x2C, 0x0C, 0x36, 0x36, 0x43, 0x50, 0x3A, 0x21, 0x8B,
+  0x61, 0x74, 0x58, 0x4C, 0x3F, 0x03, 0xF0, 0x02, 0x00, 0x03, 0x82, 0x05, 0x0B, 0x0D, 0x26, 0x0D,
+  0x06, 0x13, 0x19, 0x10, 0x02, 0x07, 0x08, 0x08, 0x31, 0x82, 0x19, 0x02, 0x2D, 0x2D, 0x02, 0x91,
+  0x00, 0x83, 0x08, 0x07, 0x02, 0x33, 0x72, 0x65, 0x81, 0x21, 0xA8, 0x21, 0x86, 0x2C, 0x0C, 0x36,
+  0x36, 0x43, 0x50, 0x77, 0x21, 0x8B, 0xD5, 0x74, 0x84, 0x4C, 0x3F, 0x03, 0xA3, 0x02, 0x83, 0x03,
+  0x83, 0x02, 0x89, 0x03, 0xBA, 0x02, 0x10, 0x03, 0x05, 0x05, 0x1F, 0x0D, 0x05, 0x0D, 0x06, 0x13,
+  0x0A, 0x10, 0x02, 0x41, 0x08, 0x07, 0x2D, 0x14, 0x82, 0x16, 0x01, 0x15, 0x04, 0x91, 0x00, 0x00,
+  0x02, 0x82, 0x08, 0x07, 0x02, 0x33, 0x58, 0x65, 0x81, 0x21, 0xA8, 0x21, 0x86, 0x2C, 0x0C, 0x36,
+  0x36, 0x57, 0x50, 0x77, 0x36, 0x8B, 0xD5, 0x74, 0x84, 0x4C, 0x05, 0x05, 0xBF, 0x03, 0x01, 0x02,
+  0x02, 0xAF, 0x03, 0x13, 0x05, 0x05, 0x1F, 0x0D, 0x05, 0x0B, 0x13, 0x13, 0x15, 0x10, 0x02, 0x41,
+  0x08, 0x07, 0x31, 0x15, 0x09, 0x2D, 0x1E, 0x10, 0x92, 0x00, 0x0E, 0x02, 0x02, 0x08, 0x08, 0x02,
+  0x33, 0x58, 0x65, 0x81, 0x21, 0x21, 0x5D, 0x2C, 0x2C, 0x8C, 0x84, 0x2C, 0x0B, 0x36, 0x57, 0x50,
+  0x77, 0x36, 0x8B, 0xD5, 0x83, 0x58, 0x4C, 0x05, 0x05, 0xF1, 0x03, 0x13, 0x05, 0x05, 0x1F, 0x1A,
+  0x0C, 0x1A, 0x31, 0x13, 0x09, 0x10, 0x02, 0x07, 0x08, 0x08, 0x10, 0x02, 0x02, 0x41, 0x07, 0x6D,
+  0x92, 0x00, 0x20, 0x03, 0x02, 0x08, 0x08, 0x02, 0x33, 0x58, 0x65, 0x6C, 0x21, 0x21, 0x2C, 0x8C,
+  0x5A, 0x3A, 0x3A, 0x5A, 0x8C, 0x2C, 0x2C, 0x36, 0x57, 0x50, 0x77, 0x21, 0x8B, 0xD5, 0x60, 0x84,
+  0x4C, 0x4C, 0x05, 0x10, 0xEF, 0x03, 0x13, 0x10, 0x05, 0x05, 0x1F, 0x1A, 0x0C, 0x1A, 0x1E, 0x13,
+  0x0E, 0x10, 0x02, 0x07, 0x08, 0x08, 0x02, 0x03, 0x03, 0x02, 0x07, 0x93, 0x00, 0x22, 0x02, 0x02,
+  0x08, 0x08, 0x02, 0x33, 0x58, 0xBB, 0x81, 0x21, 0x21, 0x2C, 0x36, 0x5A, 0x3A, 0x3A, 0x5A, 0x5A,
+  0x2C, 0x2C, 0x36, 0x43, 0x50, 0x46, 0x21, 0x8B, 0xA5, 0x60, 0x84, 0x4C, 0x05, 0x05, 0x10, 0x03,
+  0x03, 0x82, 0x10, 0xBA, 0x03, 0x00, 0x10, 0xAC, 0x03, 0x11, 0x10, 0x03, 0x10, 0x05, 0x0C, 0x1F,
+  0x1A, 0x1F, 0x2D, 0x0D, 0x06, 0x0E, 0x10, 0x02, 0x07, 0x08, 0x08, 0x0F, 0x97, 0x00, 0x0B, 0x02,
+  0x03, 0x08, 0x08, 0x02, 0x3F, 0x58, 0xBB, 0x81, 0x21, 0x21, 0x2C, 0x82, 0x5A, 0x0E, 0x77, 0x5A,
+  0x5A, 0x3A, 0x3A, 0x36, 0x57, 0x57, 0x46, 0x5D, 0x8B, 0xA5, 0x60, 0x84, 0x4C, 0x82, 0x05, 0x12,
+  0x10, 0x03, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10,
+  0x10, 0x22, 0x22, 0x85, 0x10, 0x21, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22,
+  0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22,
+  0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x85, 0x10, 0x2F, 0x22, 0x22, 0x10, 0x10, 0x22,
+  0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22,
+  0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22,
+  0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x82, 0x0C, 0x0B, 0x0B, 0x1F,
+  0x0E, 0x0D, 0x06, 0x0E, 0x03, 0x02, 0x07, 0x08, 0x08, 0x01, 0x96, 0x00, 0x24, 0x01, 0x02, 0x0C,
+  0x08, 0x38, 0x02, 0x3F, 0x58, 0xBB, 0x81, 0x36, 0x21, 0x8C, 0x5A, 0x46, 0x46, 0x3A, 0x5A, 0x46,
+  0x77, 0x3A, 0x3A, 0x27, 0x57, 0x46, 0x36, 0x8B, 0xA5, 0x60, 0x84, 0x4C, 0x4C, 0x05, 0x05, 0x10,
+  0x22, 0x22, 0x83, 0x26, 0x08, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x84, 0x26,
+  0x83, 0x10, 0x07, 0x26, 0x26, 0x05, 0x05, 0x26, 0x26, 0x05, 0x05, 0x82, 0x26, 0x0B, 0x10, 0x22,
+  0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x84, 0x26, 0x01, 0x22, 0x22, 0x82,
+  0x10, 0x15, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10,
+  0x10, 0x22, 0x22, 0x10, 0x10, 0x22, 0x22, 0x10, 0x84, 0x26, 0x04, 0x22, 0x22, 0x10, 0x10, 0x22,
+  0x84, 0x26, 0x03, 0x10, 0x10, 0x22, 0x22, 0x8D, 0x26, 0x0E, 0x0C, 0x05, 0x0C, 0x0B, 0x06, 0x0E,
+  0x0B, 0x06, 0x0E, 0x03, 0x02, 0x41, 0x08, 0x07, 0x01, 0x97, 0x00, 0x0E, 0x02, 0x0C, 0x3C, 0x38,
+  0x02, 0x3F, 0x58, 0xBB, 0x81, 0x2C, 0x36, 0x8C, 0x5A, 0x46, 0x46, 0x82, 0x2E, 0x0C, 0x77, 0x3A,
+  0x3A, 0x27, 0x57, 0x46, 0x36, 0x8B, 0xA5, 0x60, 0x84, 0x4C, 0x4C, 0x82, 0x05, 0x01, 0x26, 0x26,
+  0xED, 0x05, 0x0E, 0x0C, 0x05, 0x1F, 0x1A, 0x1E, 0x0E, 0x2D, 0x13, 0x0E, 0x03, 0x03, 0x41, 0x08,
+  0x07, 0x01, 0x97, 0x00, 0x0C, 0x38, 0x0C, 0x38, 0x02, 0x02, 0x3F, 0x84, 0xBB, 0x81, 0x2C, 0x36,
+  0x3A, 0x46, 0x85, 0x2E, 0x0B, 0x3A, 0x3A, 0x57, 0x57, 0x46, 0x5D, 0x8B, 0xA5, 0x60, 0x84, 0x4C,
+  0x4C, 0x82, 0x05, 0x01, 0x26, 0x26, 0xED, 0x05, 0x0E, 0x0C, 0x0C, 0x06, 0x0E, 0x0B, 0x09, 0x0E,
+  0x31, 0x0E, 0x03, 0x03, 0x41, 0x08, 0x07, 0x01, 0x97, 0x00, 0x0B, 0x02, 0x06, 0x02, 0x02, 0x03,
+  0x3F, 0x84, 0x9A, 0x81, 0x2C, 0x36, 0x5A, 0x86, 0x2E, 0x0B, 0x8D, 0x3A, 0x27, 0x57, 0x2E, 0x2C,
+  0xBD, 0xA5, 0xC3, 0xB3, 0x4C, 0x4C, 0xF2, 0x05, 0x0E, 0x0C, 0x06, 0x06, 0x0E, 0x0E, 0x09, 0x09,
+  0x0B, 0x0E, 0x03, 0x10, 0x02, 0x08, 0x07, 0x01, 0x97, 0x00, 0x0C, 0x02, 0x06, 0x02, 0x02, 0x03,
+  0x3F, 0xB3, 0x9A, 0xD0, 0x3A, 0x3A, 0x2E, 0x2E, 0x85, 0x27, 0x30, 0x2E, 0x8D, 0x27, 0x57, 0x50,
+  0x2C, 0xBD, 0xD4, 0xC3, 0xA7, 0x4C, 0x4C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C,
+  0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C,
+  0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x85, 0x05, 0x09, 0x0C,
+  0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x85, 0x05, 0x15, 0x0C, 0x0C, 0x05, 0x05,
+  0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05,
+  0x0C, 0x0C, 0x89, 0x05, 0x26, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05,
+  0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x05, 0x0C, 0x06, 0x13,
+  0x0E, 0x15, 0x09, 0x09, 0x0E, 0x2D, 0x03, 0x02, 0x41, 0x08, 0x07, 0x01, 0x97, 0x00, 0x0C, 0x02,
+  0x13, 0x03, 0x03, 0x10, 0x3F, 0x99, 0xB5, 0xD0, 0x2E, 0x8D, 0x27, 0x49, 0x84, 0x3D, 0x0C, 0x49,
+  0x27, 0x27, 0x49, 0x3D, 0x50, 0x8C, 0xBD, 0xD4, 0x99, 0xB3, 0x06, 0x4C, 0x85, 0x0C, 0x00, 0x05,
+  0xEB, 0x0C, 0x0D, 0x1F, 0x06, 0x31, 0x09, 0x1B, 0x0A, 0x15, 0x19, 0x1A, 0x10, 0x02, 0x41, 0x07,
+  0x07, 0x98, 0x00, 0x0B, 0x08, 0x0D, 0x05, 0x26, 0x05, 0x4C, 0xB2, 0xBC, 0x79, 0x62, 0x62, 0x34,
+  0x86, 0x39, 0x0C, 0x34, 0x3D, 0x34, 0x34, 0x57, 0x46, 0xBD, 0xA4, 0x99, 0xB3, 0xD6, 0xD6, 0x13,
+  0xF1, 0x06, 0x0A, 0x13, 0x0D, 0x1A, 0x11, 0x23, 0x1B, 0x0A, 0x17, 0x1A, 0x26, 0x10, 0x82, 0x02,
+  0x98, 0x00, 0x0B, 0x08, 0x09, 0x12, 0x12, 0x2A, 0xA2, 0x9E, 0x9C, 0xEB, 0x95, 0x95, 0x69, 0x82,
+  0x95, 0x0F, 0x56, 0x69, 0x51, 0x69, 0x3B, 0x39, 0x30, 0x30, 0x62, 0x92, 0xBD, 0x9A, 0x9B, 0xB2,
+  0xB1, 0xB1, 0x83, 0x0D, 0x00, 0x1E, 0x97, 0x0D, 0x01, 0x0B, 0x0B, 0xD4, 0x0D, 0x0C, 0x0E, 0x15,
+  0x12, 0x4E, 0x16, 0x11, 0x2A, 0x15, 0x1E, 0x31, 0x13, 0x1F, 0x10, 0x97, 0x00, 0x0B, 0x01, 0x08,
+  0x11, 0x66, 0x7C, 0x67, 0x5C, 0xEF, 0x9D, 0xFB, 0x88, 0x9F, 0x86, 0x48, 0x0C, 0x56, 0x51, 0x30,
+  0x3B, 0x3B, 0x62, 0x92, 0x8F, 0xB9, 0x9B, 0xB2, 0xB4, 0x0E, 0xDE, 0x0B, 0x01, 0x1A, 0x1A, 0x92,
+  0x0B, 0x0C, 0x0E, 0x0A, 0x2A, 0x7C, 0x6B, 0x12, 0x2A, 0x19, 0x2D, 0x1A, 0x1E, 0x64, 0x03, 0x98,
+  0x00, 0x03, 0x08, 0x11, 0x5C, 0x7E, 0x82, 0x7A, 0x04, 0xED, 0xE4, 0xFA, 0xAB, 0x9F, 0x83, 0x87,
+  0x82, 0x48, 0x0A, 0x95, 0x30, 0x3B, 0x3B, 0x62, 0x89, 0x8F, 0xB5, 0xDB, 0xB4, 0xB4, 0x82, 0x0E,
+  0x82, 0x2D, 0x89, 0x0E, 0x00, 0x2D, 0xB2, 0x0E, 0x89, 0x2D, 0x8D, 0x0E, 0x84, 0x2D, 0x86, 0x0E,
+  0x02, 0x2D, 0x2D, 0x0E, 0x83, 0x2D, 0x85, 0x0E, 0x0C, 0x15, 0x11, 0x16, 0x52, 0x52, 0x2A, 0x17,
+  0x1B, 0x19, 0x2D, 0x1A, 0x1E, 0x03, 0x97, 0x00, 0x0B, 0x01, 0x04, 0x0A, 0x7A, 0x71, 0x4B, 0x4B,
+  0xF1, 0xE2, 0xCC, 0xFC, 0xF6, 0x83, 0x88, 0x82, 0x9F, 0x11, 0x87, 0x48, 0x95, 0x51, 0x30, 0x62,
+  0x89, 0xBE, 0xB5, 0xDB, 0xDB, 0x0A, 0x0A, 0x09, 0x15, 0x15, 0x09, 0x15, 0x99, 0x09, 0x01, 0x15,
+  0x15, 0xB5, 0x09, 0x83, 0x15, 0x98, 0x09, 0x0C, 0x19, 0x17, 0x23, 0x53, 0x6E, 0x24, 0x11, 0x1D,
+  0x17, 0x1B, 0x19, 0x2D, 0x03, 0x97, 0x00, 0x0B, 0x01, 0x01, 0x0E, 0x71, 0x4B, 0x54, 0x54, 0x45,
+  0xEF, 0xCC, 0xFE, 0xFA, 0x86, 0xA1, 0x0A, 0x88, 0x9F, 0x48, 0x56, 0x3B, 0x57, 0xD0, 0xDC, 0x78,
+  0x7B, 0x7B, 0x82, 0x0A, 0xC3, 0x19, 0x88, 0x0A, 0x88, 0x19, 0x83, 0x0A, 0x03, 0x19, 0x19, 0x0A,
+  0x0A, 0x92, 0x19, 0x82, 0x0A, 0x0B, 0x12, 0x14, 0x71, 0x54, 0x5B, 0x1B, 0x14, 0xC8, 0x16, 0x1D,
+  0x19, 0x10, 0x98, 0x00, 0x02, 0x04, 0x0D, 0x7E, 0x82, 0x45, 0x05, 0xE6, 0xEF, 0xE4, 0xFC, 0xF6,
+  0xA1, 0x85, 0xAB, 0x0C, 0xA1, 0x88, 0x87, 0x56, 0x3B, 0x57, 0x81, 0xDC, 0x78, 0x7B, 0x7B, 0x11,
+  0x11, 0x83, 0x0A, 0x00, 0x11, 0x85, 0x0A, 0x01, 0x11, 0x11, 0x84, 0x0A, 0x83, 0x11, 0x83, 0x0A,
+  0x85, 0x11, 0x86, 0x0A, 0x1D, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A,
+  0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A,
+  0x0A, 0x11, 0x11, 0x88, 0x0A, 0x82, 0x11, 0x89, 0x0A, 0x01, 0x11, 0x11, 0x88, 0x0A, 0x00, 0x11,
+  0x82, 0x0A, 0x83, 0x11, 0x02, 0x0A, 0x11, 0x11, 0x82, 0x0A, 0x0C, 0x11, 0x12, 0x23, 0x52, 0x45,
+  0x5C, 0x17, 0x7D, 0xAA, 0xA9, 0x5B, 0x16, 0x07, 0x98, 0x00, 0x0E, 0x01, 0x06, 0x4E, 0x54, 0x45,
+  0xE6, 0xE6, 0xE3, 0xE7, 0xF6, 0x88, 0x9F, 0x87, 0x48, 0x87, 0x83, 0x48, 0x0B, 0x56, 0x56, 0x69,
+  0x39, 0x92, 0xD7, 0x65, 0x78, 0x7B, 0x7B, 0x11, 0x11, 0x86, 0x0A, 0x0F, 0x11, 0x11, 0x0A, 0x0A,
+  0x11, 0x11, 0x19, 0x11, 0x19, 0x19, 0x0A, 0x0A, 0x19, 0x19, 0x0A, 0x0A, 0x8B, 0x19, 0x85, 0x11,
+  0x09, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x83, 0x11, 0x85, 0x0A, 0x01,
+  0x11, 0x11, 0x83, 0x0A, 0x05, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x11, 0x83, 0x19, 0x05, 0x0A, 0x0A,
+  0x19, 0x19, 0x0A, 0x0A, 0x85, 0x11, 0x06, 0x0A, 0x0A, 0x11, 0x11, 0x0A, 0x0A, 0x11, 0x82, 0x19,
+  0x01, 0x0A, 0x0A, 0x83, 0x19, 0x07, 0x0A, 0x0A, 0x19, 0x19, 0x0A, 0x0A, 0x11, 0x11, 0x83, 0x0A,
+  0x0B, 0x12, 0x16, 0x7E, 0x45, 0x53, 0x1D, 0x52, 0xC9, 0xAA, 0xAA, 0x17, 0x0F, 0x98, 0x00, 0x0C,
+  0x01, 0x05, 0x0A, 0x71, 0x54, 0x54, 0x45, 0xE2, 0xEC, 0xF4, 0x88, 0x95, 0x39, 0x83, 0x69, 0x82,
+  0x39, 0x07, 0x30, 0x39, 0x62, 0x8C, 0x97, 0x9C, 0xCB, 0xA2, 0x89, 0x12, 0x01, 0x17, 0x17, 0x82,
+  0x12, 0x04, 0x17, 0x2A, 0x2A, 0x17, 0x17, 0x82, 0x12, 0x02, 0x17, 0x12, 0x12, 0x91, 0x17, 0x0B,
+  0x12, 0x12, 0x17, 0x17, 0x12, 0x12, 0x17, 0x17, 0x12, 0x12, 0x17, 0x17, 0x8E, 0x12, 0x02, 0x17,
+  0x12, 0x12, 0x85, 0x17, 0x0F, 0x12, 0x12, 0x2A, 0x2A, 0x12, 0x12, 0x17, 0x17, 0x12, 0x12, 0x17,
+  0x17, 0x12, 0x12, 0x17, 0x17, 0x82, 0x12, 0x01, 0x17, 0x17, 0x82, 0x12, 0x83, 0x17, 0x03, 0x12,
+  0x12, 0x17, 0x17, 0x87, 0x12, 0x0B, 0x2A, 0x23, 0x52, 0x73, 0x53, 0x1D, 0xAA, 0xAA, 0x7D, 0xA9,
+  0x1E, 0x01, 0x98, 0x00, 0x09, 0x01, 0x02, 0x13, 0x12, 0x1C, 0x4E, 0x4E, 0x78, 0x97, 0xEB, 0x82,
+  0x39, 0x83, 0x3B, 0x84, 0x39, 0x06, 0x62, 0xAC, 0x65, 0xC3, 0xD6, 0x13, 0x13, 0xF7, 0x06, 0x03,
+  0x1A, 0x4E, 0x53, 0x52, 0x82, 0x2D, 0x02, 0x1A, 0x31, 0x02, 0x99, 0x00, 0x0B, 0x01, 0x08, 0x06,
+  0x0C, 0x0C, 0x06, 0x06, 0xC3, 0xBE, 0xD8, 0x43, 0x43, 0x86, 0x86, 0x07, 0x43, 0x43, 0x86, 0x79,
+  0x8E, 0x74, 0x3E, 0x38, 0xF3, 0x04, 0x00, 0x08, 0x84, 0x04, 0x09, 0x0C, 0x1D, 0x7C, 0x14, 0x31,
+  0x10, 0x41, 0x02, 0x08, 0x08, 0x9A, 0x00, 0x0B, 0x04, 0x06, 0x13, 0x03, 0x05, 0x0C, 0x84, 0x65,
+  0x8E, 0xD8, 0x81, 0xBD, 0x89, 0x8F, 0x14, 0x65, 0xBA, 0x63, 0x3F, 0x03, 0x10, 0x10, 0x03, 0x03,
+  0x10, 0x10, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03, 0x86, 0x10, 0x20, 0x03,
+  0x10, 0x10, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03,
+  0x10, 0x10, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03,
+  0x85, 0x10, 0x01, 0x03, 0x03, 0x85, 0x10, 0x0A, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03, 0x10, 0x10,
+  0x03, 0x03, 0x10, 0x82, 0x03, 0x01, 0x10, 0x10, 0x85, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03, 0x85,
+  0x10, 0x1C, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03, 0x10, 0x10, 0x03, 0x03,
+  0x10, 0x10, 0x22, 0x03, 0x10, 0x06, 0x0A, 0x24, 0x1D, 0x64, 0x03, 0x41, 0x07, 0x02, 0x04, 0x9B,
+  0x00, 0x00, 0x02, 0x82, 0x0B, 0x06, 0x0E, 0xB2, 0xB5, 0x85, 0x97, 0xBE, 0x61, 0x88, 0x65, 0x06,
+  0xBB, 0x9A, 0x9B, 0xB1, 0x0D, 0x0B, 0x0D, 0xF6, 0x0B, 0x0A, 0x1A, 0x0E, 0x0A, 0x11, 0x17, 0x2D,
+  0x1E, 0x64, 0x06, 0x0C, 0x01, 0x9B, 0x00, 0x0E, 0x01, 0x0C, 0x0A, 0x12, 0x11, 0x7B, 0xC5, 0x9A,
+  0xBB, 0xA5, 0xA4, 0xA4, 0x75, 0xA4, 0xD4, 0x83, 0xA4, 0x03, 0x75, 0x75, 0xC3, 0xA7, 0xC4, 0x05,
+  0x00, 0x10, 0xB7, 0x05, 0x06, 0x03, 0x05, 0x0C, 0x26, 0x26, 0x10, 0x08, 0x9C, 0x00, 0x01, 0x01,
+  0x02, 0x82, 0x06, 0x04, 0xA7, 0x84, 0x58, 0x42, 0x42, 0x89, 0x40, 0x04, 0x44, 0xA6, 0x33, 0x38,
+  0x08, 0x8C, 0x07, 0x83, 0x08, 0x83, 0x07, 0x9D, 0x08, 0x87, 0x07, 0x88, 0x08, 0x89, 0x07, 0x86,
+  0x08, 0x8A, 0x07, 0x88, 0x08, 0x83, 0x07, 0x84, 0x08, 0x88, 0x07, 0x07, 0x08, 0x04, 0x07, 0x02,
+  0x07, 0x07, 0x08, 0x0F, 0x9C, 0x00, 0x00, 0x04, 0x82, 0x02, 0x06, 0x03, 0x38, 0x44, 0x58, 0xBA,
+  0x40, 0x40, 0x82, 0x44, 0x84, 0x40, 0x04, 0x44, 0x44, 0xA6, 0x33, 0x38, 0xFA, 0x02, 0x09, 0x03,
+  0x10, 0x05, 0x05, 0x02, 0x02, 0x07, 0x08, 0x04, 0x01, 0x9A, 0x00, 0x0B, 0x01, 0x08, 0x08, 0x04,
+  0x04, 0x08, 0x38, 0xA6, 0x58, 0xBA, 0x42, 0x40, 0x82, 0x72, 0x82, 0x40, 0x83, 0x72, 0x03, 0x44,
+  0x2F, 0x2B, 0x68, 0x84, 0x04, 0x8B, 0x01, 0x84, 0x0F, 0x84, 0x04, 0x8F, 0x01, 0x87, 0x0F, 0x01,
+  0x01, 0x01, 0x89, 0x0F, 0x85, 0x01, 0x82, 0x0F, 0x84, 0x6D, 0x00, 0x04, 0x84, 0x0F, 0x01, 0x01,
+  0x01, 0x85, 0x0F, 0x83, 0x04, 0x89, 0x01, 0x85, 0x0F, 0x01, 0x01, 0x01, 0x86, 0x0F, 0x0B, 0x04,
+  0x0F, 0x08, 0x05, 0x1F, 0x05, 0x07, 0x04, 0x0F, 0x0F, 0x04, 0x01, 0x9A, 0x00, 0x00, 0x01, 0x82,
+  0x08, 0x04, 0x02, 0x02, 0x38, 0x44, 0xBA, 0x8C, 0x4F, 0x03, 0x72, 0x33, 0x18, 0x2B, 0x94, 0x01,
+  0x00, 0x0F, 0xE1, 0x01, 0x0B, 0x0F, 0x01, 0x08, 0x0C, 0x06, 0x1F, 0x07, 0x04, 0x04, 0x0F, 0x0F,
+  0x01, 0x9A, 0x00, 0x02, 0x01, 0x08, 0x0C, 0x82, 0x06, 0x08, 0x63, 0x58, 0x75, 0x74, 0x74, 0x55,
+  0x55, 0x74, 0x74, 0x86, 0x55, 0x03, 0xB6, 0x44, 0x33, 0x38, 0x96, 0x02, 0x01, 0x41, 0x41, 0xDD,
+  0x02, 0x0C, 0x07, 0x02, 0x02, 0x03, 0x06, 0x0D, 0x13, 0x03, 0x10, 0x10, 0x03, 0x02, 0x04, 0x9A,
+  0x00, 0x0A, 0x04, 0x03, 0x13, 0x0D, 0x0D, 0x0B, 0xA7, 0x84, 0xC5, 0xB9, 0x75, 0x84, 0x74, 0x85,
+  0x55, 0x04, 0xB6, 0x44, 0x63, 0x3F, 0x3F, 0x94, 0x05, 0x84, 0x10, 0xA5, 0x05, 0x01, 0x26, 0x26,
+  0x84, 0x05, 0x83, 0x10, 0x8E, 0x05, 0x83, 0x10, 0x97, 0x05, 0x0C, 0x10, 0x10, 0x05, 0x05, 0x06,
+  0x0B, 0x31, 0x05, 0x06, 0x13, 0x06, 0x06, 0x02, 0x9A, 0x00, 0x02, 0x08, 0x0C, 0x0D, 0x82, 0x0B,
+  0x06, 0xA7, 0x99, 0xC5, 0x8A, 0x75, 0x75, 0xB9, 0x82, 0x75, 0x09, 0xA4, 0xA4, 0x75, 0x75, 0x74,
+  0x55, 0x42, 0x44, 0xA6, 0x3F, 0x88, 0x03, 0x00, 0x10, 0xED, 0x03, 0x06, 0x02, 0x10, 0x05, 0x06,
+  0x0B, 0x13, 0x10, 0x83, 0x06, 0x00, 0x10, 0x99, 0x00, 0x03, 0x01, 0x08, 0x13, 0x0D, 0x82, 0x0B,
+  0x04, 0xA7, 0xB2, 0x9C, 0x78, 0x8A, 0x83, 0xC5, 0x83, 0xB9, 0x07, 0x75, 0x74, 0x55, 0x42, 0x72,
+  0xA6, 0x3F, 0x3F, 0xF7, 0x03, 0x0B, 0x10, 0x05, 0x13, 0x0B, 0x1F, 0x10, 0x1F, 0x64, 0x64, 0x1F,
+  0x22, 0x01, 0x99, 0x00, 0x02, 0x02, 0x13, 0x13, 0x82, 0x0D, 0x03, 0x4C, 0xB2, 0xEA, 0x78, 0x87,
+  0x8A, 0x08, 0x75, 0x83, 0x74, 0x6F, 0x42, 0x72, 0x44, 0x3F, 0x3F, 0x82, 0x02, 0xF4, 0x03, 0x06,
+  0x10, 0x05, 0x13, 0x0D, 0x0C, 0x03, 0x05, 0x82, 0x26, 0x01, 0x03, 0x01, 0x99, 0x00, 0x00, 0x03,
+  0x84, 0x06, 0x05, 0x4C, 0x9B, 0xCB, 0x9B, 0x99, 0x75, 0x84, 0x60, 0x01, 0x75, 0x83, 0x82, 0x6F,
+  0x03, 0x42, 0x40, 0x44, 0x33, 0xF8, 0x02, 0x0B, 0x03, 0x05, 0x06, 0x13, 0x05, 0x03, 0x03, 0x10,
+  0x02, 0x02, 0x41, 0x0F, 0x98, 0x00, 0x01, 0x01, 0x03, 0x82, 0x0C, 0x05, 0x06, 0x4C, 0x63, 0x99,
+  0x9B, 0x8A, 0x85, 0x60, 0x0A, 0x83, 0x83, 0x6F, 0x6F, 0x4F, 0x4F, 0x42, 0x40, 0x44, 0x33, 0x38,
+  0x84, 0x02, 0x8A, 0x07, 0x83, 0x08, 0xBD, 0x07, 0x01, 0x08, 0x08, 0x85, 0x07, 0x01, 0x08, 0x08,
+  0x89, 0x07, 0x01, 0x08, 0x08, 0x8C, 0x07, 0x82, 0x02, 0x0B, 0x03, 0x10, 0x1F, 0x1F, 0x10, 0x03,
+  0x02, 0x02, 0x41, 0x07, 0x07, 0x0F, 0x98, 0x00, 0x01, 0x01, 0x03, 0x83, 0x0C, 0x04, 0x4C, 0x63,
+  0xC3, 0x60, 0x60, 0x86, 0x83, 0x01, 0x6F, 0x6F, 0x82, 0x4F, 0x04, 0x42, 0x40, 0x44, 0x33, 0x38,
+  0x82, 0x02, 0x68, 0x3C, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x08, 0x08,
+  0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x3C, 0x3C,
+  0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x3C, 0x3C,
+  0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x3C, 0x3C,
+  0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08,
+  0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x3C, 0x3C,
+  0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x3C, 0x3C, 0x07, 0x07, 0x3C, 0x3C, 0x85, 0x07, 0x11, 0x08,
+  0x08, 0x07, 0x07, 0x08, 0x02, 0x02, 0x03, 0x05, 0x05, 0x03, 0x03, 0x02, 0x07, 0x08, 0x08, 0x04,
+  0x01, 0x98, 0x00, 0x00, 0x01, 0x84, 0x02, 0x03, 0x3F, 0x63, 0x58, 0xBA, 0x87, 0x6F, 0x00, 0x4F,
+  0x84, 0x42, 0x04, 0x40, 0x44, 0x33, 0x38, 0x38, 0x82, 0x08, 0x00, 0x07, 0xF2, 0x08, 0x07, 0x02,
+  0x03, 0x05, 0x03, 0x02, 0x03, 0x02, 0x08, 0x82, 0x04, 0x00, 0x01, 0x98, 0x00, 0x01, 0x01, 0x08,
+  0x83, 0x04, 0x05, 0x38, 0x33, 0x44, 0x40, 0x42, 0xB6, 0x87, 0x42, 0x08, 0xB6, 0xB6, 0x42, 0x35,
+  0x35, 0x25, 0x33, 0x38, 0x38, 0xF5, 0x04, 0x03, 0x08, 0x08, 0x02, 0x10, 0x82, 0x02, 0x05, 0x08,
+  0x04, 0x0F, 0x0F, 0x01, 0x01, 0x98, 0x00, 0x08, 0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x38, 0x33,
+  0x44, 0x84, 0x35, 0x05, 0x42, 0xB6, 0x42, 0x35, 0x35, 0xB6, 0x83, 0x35, 0x03, 0x25, 0x28, 0x33,
+  0x38, 0x86, 0x04, 0x00, 0x68, 0xEF, 0x04, 0x00, 0x08, 0x82, 0x02, 0x07, 0x07, 0x02, 0x08, 0x01,
+  0x0F, 0x0F, 0x01, 0x01, 0x98, 0x00, 0x07, 0x01, 0x04, 0x01, 0x04, 0x01, 0x2B, 0x38, 0x33, 0x82,
+  0x25, 0x8C, 0x35, 0x07, 0x25, 0x28, 0x3E, 0x2F, 0x04, 0x04, 0x68, 0x68, 0xF4, 0x04, 0x00, 0x08,
+  0x82, 0x07, 0x06, 0x08, 0x08, 0x01, 0x0F, 0x0F, 0x01, 0x01, 0x98, 0x00, 0x01, 0x01, 0x04, 0x83,
+  0x01, 0x02, 0x04, 0x33, 0x28, 0x82, 0x25, 0x84, 0x35, 0x0E, 0x25, 0x25, 0x35, 0x25, 0x35, 0x35,
+  0x25, 0x25, 0x28, 0x33, 0x2F, 0x04, 0x04, 0x68, 0x68, 0x87, 0x04, 0x83, 0x01, 0x90, 0x04, 0x89,
+  0x01, 0x85, 0x04, 0x82, 0x01, 0xA1, 0x04, 0x87, 0x01, 0x9A, 0x04, 0x0A, 0x08, 0x08, 0x07, 0x07,
+  0x08, 0x08, 0x01, 0x0F, 0x0F, 0x01, 0x01, 0x98, 0x00, 0x01, 0x01, 0x04, 0x83, 0x01, 0x02, 0x04,
+  0x33, 0x28, 0x8B, 0x25, 0x0A, 0x35, 0x35, 0x25, 0x25, 0x28, 0x33, 0x2F, 0x04, 0x68, 0x2B, 0x2B,
+  0x89, 0x01, 0x05, 0x0F, 0x0F, 0x01, 0x01, 0x0F, 0x0F, 0x89, 0x01, 0x05, 0x0F, 0x0F, 0x01, 0x01,
+  0x0F, 0x0F, 0x89, 0x01, 0x05, 0x0F, 0x0F, 0x01, 0x01, 0x0F, 0x0F, 0x89, 0x01, 0x05, 0x0F, 0x0F,
+  0x01, 0x01, 0x0F, 0x0F, 0x89, 0x01, 0x05, 0x0F, 0x0F, 0x01, 0x01, 0x0F, 0x0F, 0x89, 0x01, 0x05,
+  0x0F, 0x0F, 0x01, 0x01, 0x0F, 0x0F, 0x91, 0x01, 0x82, 0x04, 0x07, 0x08, 0x08, 0x07, 0x07, 0x04,
+  0x07, 0x0F, 0x0F, 0x82, 0x01, 0x98, 0x00, 0x01, 0x01, 0x04, 0x83, 0x01, 0x04, 0x04, 0x33, 0xA6,
+  0x25, 0x28, 0x8D, 0x25, 0x06, 0x28, 0x33, 0x2B, 0x2B, 0x68, 0x01, 0x2B, 0x89, 0x01, 0x05, 0x0F,
+  0x0F, 0x01, 0x01, 0x0F, 0x0F, 0x89, 0x01, 0x05, 0x0F, 0x0F, 0x01, 0x01, 0x0F, 0x0F, 0x89, 0x01,
+  0x05, 0x0F, 0x0F, 0x01, 0x01, 0x0F, 0x0F, 0x89, 0x01, 0x05, 0x0F, 0x0F, 0x01, 0x01, 0x0F, 0x0F,
+  0x89, 0x01, 0x05, 0x0F, 0x0F, 0x01, 0x01, 0x0F, 0x0F, 0x89, 0x01, 0x05, 0x0F, 0x0F, 0x01, 0x01,
+  0x0F, 0x0F, 0x92, 0x01, 0x83, 0x04, 0x06, 0x08, 0x08, 0x04, 0x08, 0x0F, 0x01, 0x01, 0x9A, 0x00,
+  0x85, 0x01, 0x01, 0x2B, 0x38, 0x83, 0x28, 0x8B, 0x25, 0x05, 0x28, 0x28, 0x2F, 0x2F, 0x2B, 0x68,
+  0xF4, 0x01, 0x0C, 0x04, 0x01, 0x04, 0x04, 0x08, 0x04, 0x04, 0x08, 0x0F, 0x01, 0x01, 0x00, 0x01,
+  0x98, 0x00, 0x85, 0x01, 0x06, 0x2B, 0x2F, 0x28, 0x5F, 0x5F, 0x28, 0x25, 0x82, 0x28, 0x82, 0x25,
+  0x00, 0x28, 0x82, 0x25, 0x06, 0x28, 0x28, 0x3E, 0x2F, 0x2F, 0x2B, 0x68, 0xF6, 0x01, 0x84, 0x04,
+  0x01, 0x08, 0x0F, 0x83, 0x01, 0x98, 0x00, 0x85, 0x01, 0x01, 0x2B, 0x2F, 0x8C, 0x28, 0x08, 0x25,
+  0x25, 0x28, 0x28, 0x3E, 0x2F, 0x2F, 0x2B, 0x68, 0xF6, 0x01, 0x84, 0x04, 0x00, 0x08, 0x82, 0x01,
+  0x9A, 0x00, 0x85, 0x01, 0x02, 0x2B, 0x2F, 0x3E, 0x82, 0x5F, 0x88, 0x28, 0x08, 0x25, 0x28, 0x28,
+  0x5F, 0x3E, 0x2F, 0x2B, 0x68, 0x2B, 0xF6, 0x01, 0x01, 0x04, 0x01, 0x83, 0x04, 0x82, 0x01, 0x01,
+  0x00, 0x00, 0x84, 0x01, 0x93, 0x00, 0x85, 0x01, 0x04, 0x2B, 0x2F, 0x3E, 0x29, 0x29, 0x89, 0x5F,
+  0x82, 0x28, 0x02, 0x5F, 0x3E, 0x2F, 0x82, 0x2B, 0xF6, 0x01, 0x01, 0x04, 0x01, 0x82, 0x04, 0x00,
+  0x08, 0x82, 0x01, 0x01, 0x00, 0x00, 0x83, 0x01, 0x94, 0x00, 0x01, 0x01, 0x00, 0x83, 0x01, 0x02,
+  0x18, 0x2F, 0x3E, 0x87, 0x29, 0x0B, 0x28, 0x28, 0x29, 0x5F, 0x28, 0x28, 0x5F, 0x29, 0x3E, 0x2F,
+  0x2B, 0x2B, 0xF7, 0x01, 0x01, 0x04, 0x01, 0x83, 0x04, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x84,
+  0x04, 0x00, 0x01, 0x92, 0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x03, 0x00, 0x2B, 0x2F, 0x3E, 0x85,
+  0x29, 0x02, 0x3E, 0x29, 0x3E, 0x82, 0x29, 0x82, 0x28, 0x04, 0x29, 0x3E, 0x2F, 0x2B, 0x2B, 0xF9,
+  0x01, 0x83, 0x04, 0x00, 0x01, 0x83, 0x00, 0x00, 0x04, 0x83, 0x07, 0x00, 0x04, 0x92, 0x00, 0x02,
+  0x01, 0x00, 0x01, 0x82, 0x00, 0x02, 0x2B, 0x2F, 0x3E, 0x8B, 0x29, 0x07, 0x28, 0x28, 0x29, 0x29,
+  0x20, 0x2F, 0x18, 0x2B, 0x9D, 0x01, 0x82, 0x00, 0x8F, 0x01, 0x83, 0x00, 0xA0, 0x01, 0x82, 0x00,
+  0x84, 0x01, 0x90, 0x00, 0x8B, 0x01, 0x02, 0x04, 0x01, 0x04, 0x82, 0x01, 0x02, 0x00, 0x00, 0x0F,
+  0x84, 0x04, 0x98, 0x00, 0x04, 0x2B, 0x2F, 0x3E, 0x29, 0x29, 0x83, 0x3E, 0x85, 0x29, 0x07, 0x3E,
+  0x28, 0x29, 0x29, 0x20, 0x2F, 0x2B, 0x2B, 0x83, 0x01, 0x01, 0x00, 0x00, 0x98, 0x01, 0x86, 0x00,
+  0x8A, 0x01, 0x01, 0x00, 0x00, 0x93, 0x01, 0x01, 0x00, 0x00, 0x8B, 0x01, 0x83, 0x00, 0x83, 0x01,
+  0x92, 0x00, 0x85, 0x01, 0x00, 0x00, 0x85, 0x01, 0x01, 0x04, 0x01, 0x83, 0x00, 0x01, 0x01, 0x01,
+  0x83, 0x0F, 0x98, 0x00, 0x01, 0x18, 0x2F, 0x82, 0x20, 0x82, 0x29, 0x03, 0x3E, 0x29, 0x29, 0x3E,
+  0x85, 0x29, 0x05, 0x20, 0x20, 0x18, 0x18, 0x2B, 0x00, 0x82, 0x01, 0xD4, 0x00, 0x83, 0x01, 0x97,
+  0x00, 0x01, 0x01, 0x00, 0x85, 0x01, 0x01, 0x04, 0x01, 0x84, 0x00, 0x00, 0x01, 0x9C, 0x00, 0x01,
+  0x18, 0x2F, 0x8C, 0x20, 0x08, 0x29, 0x3E, 0x3E, 0x29, 0x20, 0x18, 0x18, 0x00, 0x01, 0xF3, 0x00,
+  0x87, 0x01, 0x01, 0x04, 0x01, 0xA2, 0x00, 0x01, 0x18, 0x18, 0x8C, 0x20, 0x08, 0x3E, 0x3E, 0x2F,
+  0x20, 0x20, 0x18, 0x18, 0x00, 0x01, 0xF3, 0x00, 0x83, 0x01, 0x00, 0x00, 0x84, 0x01, 0xA2, 0x00,
+  0x01, 0x18, 0x18, 0x8C, 0x20, 0x06, 0x2F, 0x20, 0x2F, 0x20, 0x20, 0x18, 0x18, 0xF5, 0x00, 0x09,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0xA2, 0x00, 0x01, 0x18, 0x18, 0x8C,
+  0x20, 0x01, 0x2F, 0x2F, 0x82, 0x20, 0x01, 0x18, 0x18, 0xF7, 0x00, 0x07, 0x01, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0xA3, 0x00, 0x00, 0x18, 0x88, 0x20, 0x02, 0x18, 0x20, 0x18, 0x84, 0x20,
+  0x01, 0x18, 0x18, 0xFE, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x05, 0x18, 0x20, 0x18, 0x18, 0x20, 0x20,
+  0x86, 0x18, 0x83, 0x20, 0x82, 0x18, 0xFE, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x8D, 0x18, 0x05, 0x20,
+  0x20, 0x18, 0x20, 0x18, 0x18, 0xFE, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x93, 0x18, 0xFE, 0x00, 0x00,
+  0x01, 0xA4, 0x00, 0x93, 0x18, 0xFF, 0x00, 0xA5, 0x00, 0x91, 0x18, 0xFF, 0x00, 0xA6, 0x00, 0x86,
+  0x18, 0x00, 0x00, 0x89, 0x18, 0xFF, 0x00, 0xAA, 0x00, 0x04, 0x18, 0x18, 0x00, 0x00, 0x18, 0x82,
+  0x00, 0x84, 0x18, 0xFF, 0x00, 0xB4, 0x00, 0x00, 0x18, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8C, 0x00,
 };
@@ -95,6 +95,20 @@ void ScreenPlaneSpotter::activate()
 
   LCD.fillRect(0, geoMap.getMapHeight() + TOP_BAR_HEIGHT, LCD.width(), LCD.height() - geoMap.getMapHeight() - TOP_BAR_HEIGHT, TFT_BLACK);
 
+  // Decoded once, to erase the aircrafts from
+  planeSpotter.setBackground();
+
+  // The map does not move: the query is built once
+  String queryString = F("fAltL=1500&trFmt=sa");
+  adsbClient.setSearchQuery(queryString +
+                            F("&lat=") +
+                            String(mapCenter.lat, 6) +
+                            F("&lng=") + String(mapCenter.lon, 6) +
+                            F("&fNBnd=") + String(northWestBound.lat, 9) +
+                            F("&fWBnd=") + String(northWestBound.lon, 9) +
+                            F("&fSBnd=") + String(southEastBound.lat, 9) +
+                            F("&fEBnd=") + String(southEastBound.lon, 9));
+
   isInitialised = true;
 
 }
@@ -111,54 +125,34 @@ void ScreenPlaneSpotter::update()
   if ( !config.connected || !isInitialised)
     return;
 
-  //local variable for test
-  AdsbExchangeClient * adsbClient;
-
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, String(F("1 - START UPDATING ADSB = ")) + String(ESP.getFreeHeap()) + F(" bytes"));
 #endif
 
-  adsbClient = new AdsbExchangeClient();
-
-#ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, String(F("2 - AFTER INSTANCIATING ADSBCLIENT = ")) + String(ESP.getFreeHeap()) + F(" bytes"));
-#endif
-
-  String queryString = F("fAltL=1500&trFmt=sa");
-  adsbClient->updateVisibleAircraft(queryString +
-                                    F("&lat=") +
-                                    String(mapCenter.lat, 6) +
-                                    F("&lng=") + String(mapCenter.lon, 6) +
-                                    F("&fNBnd=") + String(northWestBound.lat, 9) +
-                                    F("&fWBnd=") + String(northWestBound.lon, 9) +
-                                    F("&fSBnd=") + String(southEastBound.lat, 9) +
-                                    F("&fEBnd=") + String(southEastBound.lon, 9));
-
+  // Refresh the arena in place, not every time: in between the aircrafts are flown on
+  if (!polled || millis() - lastPoll >= ADSB_POLL_PERIOD)
+  {
+    adsbClient.updateVisibleAircraft();
+    lastPoll = millis();
+    polled = true;
+  }
+  adsbClient.extrapolate();
 
 #ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, String(F("3 - AFTER CALL TO ADSBCLIENT = ")) + String(ESP.getFreeHeap()) + F(" bytes"));
+  syslog.log(LOG_DEBUG, String(F("2 - AFTER CALL TO ADSBCLIENT = ")) + String(ESP.getFreeHeap()) + F(" bytes"));
 #endif
 
-  Aircraft closestAircraft = adsbClient->getClosestAircraft(mapCenter.lat, mapCenter.lon);
+  const Aircraft &closestAircraft = adsbClient.getClosestAircraft(mapCenter.lat, mapCenter.lon);
 
   // Before refreshing display, check if a userEvent is pending and skip in case
   if ( !procPtr.UIManager.eventPending())
   {
 
-    // Draw map
-    ui.drawJpeg(geoMap.getMapName(), 0, TOP_BAR_HEIGHT);
-
-    // Get aircrafts data
-    for (int i = 0; i < adsbClient->getNumberOfAircrafts(); i++)
-    {
-      Aircraft aircraft = adsbClient->getAircraft(i);
-      AircraftHistory history = adsbClient->getAircraftHistory(i);
-      planeSpotter.drawAircraftHistory(aircraft, history);
-      planeSpotter.drawPlane(aircraft, aircraft.call == closestAircraft.call);
-    }
+    // Aircrafts that moved are erased from the copy of the map, no map decoding
+    planeSpotter.drawAircrafts(adsbClient, closestAircraft);
 
     // Draf info of closest aircraft
-    if (adsbClient->getNumberOfAircrafts())
+    if (adsbClient.getNumberOfAircrafts())
     {
       // YES - print infobox of the closes
       planeSpotter.drawInfoBox(closestAircraft);
@@ -182,14 +176,7 @@ void ScreenPlaneSpotter::update()
   }
 
 #ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, String(F("4 - AFTER DRAWING = ")) + String(ESP.getFreeHeap()) + F(" bytes"));
-#endif
-
-  // Free up memory
-  delete adsbClient;
-
-#ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, String(F("5 - AFTER CLEANUP = ")) + String(ESP.getFreeHeap()) + F(" bytes"));
+  syslog.log(LOG_DEBUG, String(F("3 - AFTER DRAWING = ")) + String(ESP.getFreeHeap()) + F(" bytes"));
 
   syslog.log(LOG_DEBUG, String(F("Rendering took (mS) ")) + String(millis() - startMillis));
 #endif
@@ -242,7 +229,7 @@ bool ScreenPlaneSpotter::onUserEvent(int event)
 
 long ScreenPlaneSpotter::getRefreshPeriod()
 {
-  return 1500;
+  return PLANE_SPOTTER_REFRESH;
 }
 
 String ScreenPlaneSpotter::getScreenName()
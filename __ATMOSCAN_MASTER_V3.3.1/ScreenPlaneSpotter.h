@@ -38,6 +38,9 @@ class ScreenPlaneSpotter: public Screen
   private:
     GeoMap geoMap;
     PlaneSpotter planeSpotter;
+    AdsbExchangeClient adsbClient;        // Aircraft arena, lives as long as the screen
+    unsigned long lastPoll = 0;
+    bool polled = false;
     Coordinates mapCenter;
     Coordinates northWestBound;
     Coordinates southEastBound;
@@ -31,3 +31,7 @@
 #define MAP_ZOOM 10
 #define MAP_WIDTH 240
 #define MAP_HEIGHT 210
+
+// Aircrafts are drawn more often than polled, flown on from their speed and heading in between
+#define PLANE_SPOTTER_REFRESH 1000        // ms
+#define ADSB_POLL_PERIOD 10000            // ms
@@ -33,50 +33,63 @@ void ScreenSensors::activate()
   LCD.setFreeFont(&Dialog_plain_15);
   int xpos = 5;
   int ypos = 75;
+  int valueXpos = 75;
 
   LCD.drawString(F("Temp"), xpos, ypos);
+  fields[FIELD_TEMPERATURE].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   LCD.drawString(F("Humid"), xpos, ypos, GFXFF);
+  fields[FIELD_HUMIDITY].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   LCD.drawString(F("Press"), xpos, ypos, GFXFF);
+  fields[FIELD_PRESSURE].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   ui.drawSeparator(ypos);
   ypos +=  LCD.fontHeight(GFXFF) / 2;
 
   LCD.drawString(F("CO2"), xpos, ypos, GFXFF);
+  fields[FIELD_CO2].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   LCD.drawString(F("CO"), xpos, ypos, GFXFF);
+  fields[FIELD_CO].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   LCD.drawString(F("NO2"), xpos, ypos, GFXFF);
+  fields[FIELD_NO2].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   LCD.drawString(F("VOC"), xpos, ypos, GFXFF);
+  fields[FIELD_VOC].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   ui.drawSeparator(ypos);
   ypos +=  LCD.fontHeight(GFXFF) / 2;
 
   LCD.drawString(F("PM01"), xpos, ypos, GFXFF);
+  fields[FIELD_PM01].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   LCD.drawString(F("PM2.5"), xpos, ypos, GFXFF);
+  fields[FIELD_PM2_5].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   LCD.drawString(F("PM10"), xpos, ypos, GFXFF);
+  fields[FIELD_PM10].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   ui.drawSeparator(ypos);
   ypos +=  LCD.fontHeight(GFXFF) / 2;
 
   LCD.drawString(F("CPM"), xpos, ypos, GFXFF);
+  fields[FIELD_CPM].setPosition(valueXpos, ypos);
 
   ypos +=  LCD.fontHeight(GFXFF);
   LCD.drawString(F("Rad"), xpos, ypos, GFXFF);
+  fields[FIELD_RADIATION].setPosition(valueXpos, ypos);
 
 }
 
@@ -86,136 +99,99 @@ void ScreenSensors::update()
   syslog.log(LOG_INFO, F("ScreenSensors::update()"));
 #endif
 
-  LCD.setTextDatum(TL_DATUM);
-  LCD.setTextColor(TFT_WHITE, TFT_BLACK);
   LCD.setFreeFont(&Dialog_plain_15);
 
-  float currValue;
-
-  int xpos = 75;
-  int ypos = 75;
+  // NOTE: fields only send what changed since the last update
 
   // TEMPERATURE
   if (procPtr.ComboTemperatureHumiditySensor.isEnabled())
-    printWithTrend(lastTemperatureColor, lastTemperature, procPtr.ComboTemperatureHumiditySensor.getTemperature(), F(" C   "), 1 , xpos, ypos);
+    printWithTrend(fields[FIELD_TEMPERATURE], lastTemperatureColor, procPtr.ComboTemperatureHumiditySensor.getTemperatureStats(), procPtr.ComboTemperatureHumiditySensor.getTemperature(), F(" C"), 1);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
+    fields[FIELD_TEMPERATURE].draw(F("------"));
 
   // HUMIDITY
-  ypos +=  LCD.fontHeight(GFXFF);
   if (procPtr.ComboTemperatureHumiditySensor.isEnabled())
-    printWithTrend(lastHumidityColor, lastHumidity, procPtr.ComboTemperatureHumiditySensor.getHumidity() , F(" %  "), 1, xpos, ypos);
+    printWithTrend(fields[FIELD_HUMIDITY], lastHumidityColor, procPtr.ComboTemperatureHumiditySensor.getHumidityStats(), procPtr.ComboTemperatureHumiditySensor.getHumidity(), F(" %"), 1);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
+    fields[FIELD_HUMIDITY].draw(F("------"));
 
   // PRESSURE
-  ypos +=  LCD.fontHeight(GFXFF);
   if (procPtr.ComboPressureHumiditySensor.isEnabled())
-    printWithTrend(lastPressureColor, lastPressure, procPtr.ComboPressureHumiditySensor.getPressure() , F(" hPa  "), 1, xpos, ypos);
+    printWithTrend(fields[FIELD_PRESSURE], lastPressureColor, procPtr.ComboPressureHumiditySensor.getPressureStats(), procPtr.ComboPressureHumiditySensor.getPressure(), F(" hPa"), 1);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
-
-  ypos +=  LCD.fontHeight(GFXFF);
-  ui.drawSeparator(ypos);
-  ypos +=  LCD.fontHeight(GFXFF) / 2;
+    fields[FIELD_PRESSURE].draw(F("------"));
 
   // CO2
   if (procPtr.CO2Sensor.isEnabled())
-    printWithTrend(lastCO2Color, lastCO2, procPtr.CO2Sensor.getCO2() , F(" ppm     "), 0,  xpos, ypos);
+    printWithTrend(fields[FIELD_CO2], lastCO2Color, procPtr.CO2Sensor.getCO2Stats(), procPtr.CO2Sensor.getCO2(), F(" ppm"), 0);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
+    fields[FIELD_CO2].draw(F("------"));
 
   // CO
-  ypos +=  LCD.fontHeight(GFXFF);
   if (procPtr.MultiGasSensor.isEnabled())
-    printWithTrend(lastCOColor, lastCO , procPtr.MultiGasSensor.getCO() , F(" ppm    "), 2,  xpos, ypos);
+    printWithTrend(fields[FIELD_CO], lastCOColor, procPtr.MultiGasSensor.getCOStats(), procPtr.MultiGasSensor.getCO(), F(" ppm"), 2);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
+    fields[FIELD_CO].draw(F("------"));
 
   // NO2
-  ypos +=  LCD.fontHeight(GFXFF);
   if (procPtr.MultiGasSensor.isEnabled())
-    printWithTrend(lastNO2Color, lastNO2 , procPtr.MultiGasSensor.getNO2() , F(" ppm   "), 2,  xpos, ypos);
+    printWithTrend(fields[FIELD_NO2], lastNO2Color, procPtr.MultiGasSensor.getNO2Stats(), procPtr.MultiGasSensor.getNO2(), F(" ppm"), 2);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
+    fields[FIELD_NO2].draw(F("------"));
 
   // VOC
-  ypos +=  LCD.fontHeight(GFXFF);
   if (procPtr.VOCSensor.isEnabled())
-    printWithTrend(lastVOCColor, lastVOC , procPtr.VOCSensor.getVOC() , F("         "), 0,  xpos, ypos);
+    printWithTrend(fields[FIELD_VOC], lastVOCColor, procPtr.VOCSensor.getVOCStats(), procPtr.VOCSensor.getVOC(), F(""), 0);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
-
-
-  ypos +=  LCD.fontHeight(GFXFF);
-  ui.drawSeparator(ypos);
-  ypos +=  LCD.fontHeight(GFXFF) / 2;
+    fields[FIELD_VOC].draw(F("------"));
 
   // PM01
-  if (procPtr.ParticleSensor.isEnabled())
-    printWithTrend(lastPM01Color, lastPM01 , procPtr.ParticleSensor.getPM01(), F(" ug/m3    "), 0,  xpos, ypos);
+  if (procPtr.ParticleSensor.isEnabled() && procPtr.ParticleSensor.hasData())
+    printWithTrend(fields[FIELD_PM01], lastPM01Color, procPtr.ParticleSensor.getPM01Stats(), procPtr.ParticleSensor.getPM01(), F(" ug/m3"), 0);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
+    fields[FIELD_PM01].draw(F("------"));
 
   // PM25
-  ypos +=  LCD.fontHeight(GFXFF);
-  if (procPtr.ParticleSensor.isEnabled())
-    printWithTrend(lastPM2_5Color, lastPM2_5 , procPtr.ParticleSensor.getPM2_5() , F(" ug/m3    "), 0,  xpos, ypos);
+  if (procPtr.ParticleSensor.isEnabled() && procPtr.ParticleSensor.hasData())
+    printWithTrend(fields[FIELD_PM2_5], lastPM2_5Color, procPtr.ParticleSensor.getPM2_5Stats(), procPtr.ParticleSensor.getPM2_5(), F(" ug/m3"), 0);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
+    fields[FIELD_PM2_5].draw(F("------"));
 
   // PM10
-  ypos +=  LCD.fontHeight(GFXFF);
-  if (procPtr.ParticleSensor.isEnabled())
-    printWithTrend(lastPM10Color, lastPM10 , procPtr.ParticleSensor.getPM10() , F(" ug/m3    "), 0,  xpos, ypos);
+  if (procPtr.ParticleSensor.isEnabled() && procPtr.ParticleSensor.hasData())
+    printWithTrend(fields[FIELD_PM10], lastPM10Color, procPtr.ParticleSensor.getPM10Stats(), procPtr.ParticleSensor.getPM10(), F(" ug/m3"), 0);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
-
-  ypos +=  LCD.fontHeight(GFXFF);
-  ui.drawSeparator(ypos);
-  ypos +=  LCD.fontHeight(GFXFF) / 2;
+    fields[FIELD_PM10].draw(F("------"));
 
   // CPM
   if (procPtr.GeigerSensor.isEnabled())
-    printWithTrend(lastCPMColor, lastCPM , procPtr.GeigerSensor.getCPM() , F(" Counts        "), 0,  xpos, ypos);
+    printWithTrend(fields[FIELD_CPM], lastCPMColor, procPtr.GeigerSensor.getCPMStats(), procPtr.GeigerSensor.getCPM(), F(" Counts"), 0);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
-
+    fields[FIELD_CPM].draw(F("------"));
 
   // RADIATION
-  ypos +=  LCD.fontHeight(GFXFF);
   if (procPtr.GeigerSensor.isEnabled())
-    printWithTrend(lastRadiationColor, lastRadiation , procPtr.GeigerSensor.getRadiation() , F(" uSv/h     "), 2,  xpos, ypos);
+    printWithTrend(fields[FIELD_RADIATION], lastRadiationColor, procPtr.GeigerSensor.getRadiationStats(), procPtr.GeigerSensor.getRadiation(), F(" uSv/h"), 2);
   else
-    LCD.drawString(F("------                   "), xpos, ypos, GFXFF);
-
+    fields[FIELD_RADIATION].draw(F("------"));
 }
 
 
 
-void ScreenSensors::printWithTrend(int &lastColor, float &lastValue, float newValue, String suffix, int decimals, int xpos, int ypos)
+void ScreenSensors::printWithTrend(TextField &field, int &lastColor, SensorStats &stats, float value, String suffix, int decimals)
 {
   // Decide new color
-  if (lastValue != -1)
-    if (newValue < lastValue)
-      lastColor = TFT_GREEN;
-    else if (newValue > lastValue)
-      lastColor = TFT_RED;
+  float trend = stats.trend();
+  if (trend < 0)
+    lastColor = TFT_GREEN;
+  else if (trend > 0)
+    lastColor = TFT_RED;
 
-  // NOTE: If value constant, dont change color (show past trent)
-
-  // Set color
-  LCD.setTextColor(lastColor, TFT_BLACK);
+  // NOTE: If value constant, dont change color (show past trend)
 
   // Print value
   String strBuffer = F(" ");
-  LCD.drawString(strBuffer + String(newValue, decimals) + suffix, xpos, ypos, GFXFF);
-
-  // Remember last value
-  lastValue = newValue;
-
-  // Reset color to white
-  LCD.setTextColor(TFT_WHITE, TFT_BLACK);
+  field.draw(strBuffer + String(value, decimals) + suffix, lastColor);
 }
 
 void ScreenSensors::deactivate()
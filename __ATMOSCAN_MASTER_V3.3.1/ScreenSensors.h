@@ -10,6 +10,8 @@
 #include <TFT_eSPI.h>             // https://github.com/Bodmer/TFT_eSPI
 
 #include "Screen.h"
+#include "RunningStats.h"
+#include "TextField.h"
 
 // Screen Handler definition
 class ScreenSensors: public Screen
@@ -28,20 +30,27 @@ class ScreenSensors: public Screen
     virtual bool getRefreshWithScreenOff();
 
   private:
+    enum SensorField
+    {
+      FIELD_TEMPERATURE,
+      FIELD_HUMIDITY,
+      FIELD_PRESSURE,
+      FIELD_CO2,
+      FIELD_CO,
+      FIELD_NO2,
+      FIELD_VOC,
+      FIELD_PM01,
+      FIELD_PM2_5,
+      FIELD_PM10,
+      FIELD_CPM,
+      FIELD_RADIATION,
+      SENSOR_FIELDS
+    };
 
-    void printWithTrend(int &lastColor, float &lastValue, float newValue, String suffix, int decimals, int xpos, int ypos);
-    float lastTemperature = -1;
-    float lastHumidity = -1;
-    float lastPressure = -1;
-    float lastCO2 = -1;
-    float lastCO = -1;
-    float lastNO2 = -1;
-    float lastVOC = -1;
-    float lastPM01 = -1;
-    float lastPM2_5 = -1;
-    float lastPM10 = -1;
-    float lastCPM = -1;
-    float lastRadiation = -1;
+    TextField fields[SENSOR_FIELDS];
+
+    // NOTE: color follows the trend over the sensor averaging window
+    void printWithTrend(TextField &field, int &lastColor, SensorStats &stats, float value, String suffix, int decimals);
 
     int  lastTemperatureColor = TFT_WHITE;
     int  lastHumidityColor = TFT_WHITE;
@@ -27,6 +27,7 @@ extern String systemID;
 #ifdef KILL_INSTALLED
 void turnOff();
 #endif
+void wifiClearCache();
 
 bool shouldSaveConfig = false;
 
@@ -188,6 +189,9 @@ void  ScreenSetup::startHotspot()
   WiFi.mode(WIFI_AP);
   WiFi.mode(WIFI_OFF);
 
+  // Network about to change, the next restart must scan
+  wifiClearCache();
+
   syslog.log(LOG_INFO, F("Starting hotspot"));
 
   // Clear screen except title
@@ -201,7 +205,7 @@ void  ScreenSetup::startHotspot()
   LCD.drawString(systemID, 120, 110);
 
   // Draw hotspot icon
-  ui.drawBitmap(hotspot, (LCD.width() - hotspotWidth) / 2, 145, hotspotWidth, hotspotHeight);
+  ui.drawPackedBitmap(hotspot, (LCD.width() - hotspotWidth) / 2, 145);
 
   // Position cursor for further messages
   LCD.setTextColor(TFT_YELLOW, TFT_BLACK);
@@ -215,6 +219,7 @@ void  ScreenSetup::startHotspot()
   WiFiManagerParameter custom_mqtt_topic1("topic1", "MQTT Topic1", config.mqtt_topic1, 64);
   WiFiManagerParameter custom_mqtt_topic2("topic2", "MQTT Topic2", config.mqtt_topic2, 64);
   WiFiManagerParameter custom_mqtt_topic3("topic3", "MQTT Topic3", config.mqtt_topic3, 64);
+  WiFiManagerParameter custom_mqtt_systopic("systopic", "MQTT System topic (optional)", config.mqtt_systopic, 64);
   WiFiManagerParameter custom_syslog_server("syslog", "Syslog server", config.syslog_server, 20);
 
   WiFiManagerParameter custom_google_key("Google Key", "Google Key", config.google_key, 64);
@@ -236,6 +241,7 @@ void  ScreenSetup::startHotspot()
   wifiManager.addParameter(&custom_mqtt_topic1);
   wifiManager.addParameter(&custom_mqtt_topic2);
   wifiManager.addParameter(&custom_mqtt_topic3);
+  wifiManager.addParameter(&custom_mqtt_systopic);
   wifiManager.addParameter(&custom_syslog_server);
   wifiManager.addParameter(&custom_google_key);
   wifiManager.addParameter(&custom_wunderground_key);
@@ -251,6 +257,7 @@ void  ScreenSetup::startHotspot()
   strcpy(config.mqtt_topic1, custom_mqtt_topic1.getValue());
   strcpy(config.mqtt_topic2, custom_mqtt_topic2.getValue());
   strcpy(config.mqtt_topic3, custom_mqtt_topic3.getValue());
+  strcpy(config.mqtt_systopic, custom_mqtt_systopic.getValue());
   strcpy(config.syslog_server, custom_syslog_server.getValue());
   strcpy(config.google_key, custom_google_key.getValue());
   strcpy(config.wunderground_key, custom_wunderground_key.getValue());
@@ -266,6 +273,7 @@ void  ScreenSetup::startHotspot()
     json[F("mqtt_topic1")] = config.mqtt_topic1;
     json[F("mqtt_topic2")] = config.mqtt_topic2;
     json[F("mqtt_topic3")] = config.mqtt_topic3;
+    json[F("mqtt_systopic")] = config.mqtt_systopic;
     json[F("syslog_server")] = config.syslog_server;
     json[F("google_key")] = config.google_key;
     json[F("wunderground_key")] = config.wunderground_key;
@@ -44,972 +44,182 @@ class ScreenSetup: public Screen
 const uint16_t hotspotWidth = 120;
 const uint16_t hotspotHeight = 129;
 
-const unsigned short hotspot[15480] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x221F, 0x013F,   // 0x0010 (16) pixels
-  0x19FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0030 (48) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0040 (64) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0050 (80) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0060 (96) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19DF, 0x013F, 0x221F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0070 (112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0080 (128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0090 (144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00A0 (160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00B0 (176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00C0 (192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00D0 (208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x00E0 (224) pixels
-  0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00F0 (240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F,   // 0x0100 (256) pixels
-  0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0110 (272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0120 (288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0130 (304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0140 (320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0150 (336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0160 (352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0170 (368) pixels
-  0x0000, 0x0000, 0x0000, 0x19DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x3ABF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0180 (384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0190 (400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01A0 (416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01B0 (432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01C0 (448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x223F, 0x013F, 0x013F,   // 0x01D0 (464) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01E0 (480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x537F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x01F0 (496) pixels
-  0x013F, 0x013F, 0x6C1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0200 (512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0210 (528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0220 (544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0230 (560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0240 (576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C1F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x537F, 0x0000, 0x0000,   // 0x0250 (592) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0260 (608) pixels
-  0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x221F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0270 (624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0280 (640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0290 (656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02A0 (672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02B0 (688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19FF, 0x013F,   // 0x02C0 (704) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02D0 (720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x099F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x02E0 (736) pixels
-  0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02F0 (752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0300 (768) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0310 (784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0320 (800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0330 (816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000,   // 0x0340 (832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0350 (848) pixels
-  0x5B9F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0360 (864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0370 (880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0380 (896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0390 (912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03A0 (928) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03B0 (944) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x5B9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03C0 (960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x537F,   // 0x03D0 (976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03E0 (992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03F0 (1008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0400 (1024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0410 (1040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0420 (1056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x535F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F,   // 0x0430 (1072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x329F,   // 0x0440 (1088) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0450 (1104) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0460 (1120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0470 (1136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0480 (1152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0490 (1168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04A0 (1184) pixels
-  0x0000, 0x11DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x329F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04B0 (1200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000,   // 0x04C0 (1216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04D0 (1232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04E0 (1248) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04F0 (1264) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0500 (1280) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0510 (1296) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0520 (1312) pixels
-  0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A5F, 0x013F,   // 0x0530 (1328) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x4B1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0540 (1344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0550 (1360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0560 (1376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0570 (1392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0580 (1408) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0590 (1424) pixels
-  0x0000, 0x0000, 0x42FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x329F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05A0 (1440) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000,   // 0x05B0 (1456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6BFF, 0x19FF, 0x2A3F,   // 0x05C0 (1472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05D0 (1488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05E0 (1504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05F0 (1520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A5F, 0x19FF, 0x6C1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0600 (1536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0610 (1552) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42FF, 0x013F, 0x013F,   // 0x0620 (1568) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x5BBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0630 (1584) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2A5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x745F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0640 (1600) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0650 (1616) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0660 (1632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x745F, 0x013F,   // 0x0670 (1648) pixels
-  0x013F, 0x013F, 0x013F, 0x327F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0680 (1664) pixels
-  0x0000, 0x0000, 0x0000, 0x5B9F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0690 (1680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06A0 (1696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42FF, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x06B0 (1712) pixels
-  0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06C0 (1728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06D0 (1744) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06E0 (1760) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x431F, 0x0000, 0x0000, 0x0000,   // 0x06F0 (1776) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0700 (1792) pixels
-  0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63FF, 0x013F, 0x013F, 0x013F,   // 0x0710 (1808) pixels
-  0x013F, 0x013F, 0x013F, 0x537F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0720 (1824) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0730 (1840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0740 (1856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0750 (1872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x0760 (1888) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0770 (1904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x537F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6BFF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0780 (1920) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x099F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0790 (1936) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x07A0 (1952) pixels
-  0x013F, 0x19FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07B0 (1968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07C0 (1984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07D0 (2000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000,   // 0x07E0 (2016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F,   // 0x07F0 (2032) pixels
-  0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0800 (2048) pixels
-  0x013F, 0x013F, 0x2A5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0810 (2064) pixels
-  0x0000, 0x3ABF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0820 (2080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0830 (2096) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0840 (2112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F,   // 0x0850 (2128) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x3ABF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0860 (2144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x221F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0870 (2160) pixels
-  0x0000, 0x0000, 0x0000, 0x4B3F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x7C7F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0880 (2176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0890 (2192) pixels
-  0x63FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08A0 (2208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08B0 (2224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08C0 (2240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000,   // 0x08D0 (2256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C7F, 0x013F, 0x013F,   // 0x08E0 (2272) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x4B3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x08F0 (2288) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0900 (2304) pixels
-  0x221F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x2A5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0910 (2320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0920 (2336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0930 (2352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0940 (2368) pixels
-  0x2A3F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x223F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0950 (2384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000,   // 0x0960 (2400) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x2A5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0970 (2416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000,   // 0x0980 (2432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0990 (2448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09A0 (2464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09B0 (2480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x09C0 (2496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A5F, 0x013F,   // 0x09D0 (2512) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x09E0 (2528) pixels
-  0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x223F,   // 0x09F0 (2544) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x63DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A00 (2560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A10 (2576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A20 (2592) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A30 (2608) pixels
-  0x0000, 0x63BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x2A3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A40 (2624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x63DF, 0x0000, 0x0000,   // 0x0A50 (2640) pixels
-  0x0000, 0x0000, 0x19DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A60 (2656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000,   // 0x0A70 (2672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A80 (2688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A90 (2704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AA0 (2720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x099F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0AB0 (2736) pixels
-  0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F,   // 0x0AC0 (2752) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0AD0 (2768) pixels
-  0x2A7F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42FF, 0x013F,   // 0x0AE0 (2784) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x745F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AF0 (2800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B00 (2816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B10 (2832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B20 (2848) pixels
-  0x0000, 0x0000, 0x745F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x4B1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B30 (2864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x223F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000,   // 0x0B40 (2880) pixels
-  0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x7C9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B50 (2896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000,   // 0x0B60 (2912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C1F, 0x4B3F, 0x745F, 0x0000, 0x0000,   // 0x0B70 (2928) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B80 (2944) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63DF, 0x535F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B90 (2960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0BA0 (2976) pixels
-  0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C9F,   // 0x0BB0 (2992) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x6BFF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0BC0 (3008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x0BD0 (3024) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x537F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BE0 (3040) pixels
-  0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BF0 (3056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C00 (3072) pixels
-  0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x537F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C10 (3088) pixels
-  0x0000, 0x0000, 0x0000, 0x537F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C20 (3104) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6BFF, 0x0000,   // 0x0C30 (3120) pixels
-  0x0000, 0x2A5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C40 (3136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ABF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C50 (3152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x743F,   // 0x0C60 (3168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C70 (3184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x7C7F, 0x0000,   // 0x0C80 (3200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0C90 (3216) pixels
-  0x013F, 0x013F, 0x3ADF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CA0 (3232) pixels
-  0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x327F, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x3ADF,   // 0x0CB0 (3248) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F,   // 0x0CC0 (3264) pixels
-  0x013F, 0x013F, 0x013F, 0x19FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CD0 (3280) pixels
-  0x63DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CE0 (3296) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CF0 (3312) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D00 (3328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x11DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D10 (3344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x32BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000,   // 0x0D20 (3360) pixels
-  0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6C1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D30 (3376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6C1F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D40 (3392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6BFF,   // 0x0D50 (3408) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D60 (3424) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x3ABF,   // 0x0D70 (3440) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6BFF, 0x013F, 0x013F, 0x013F,   // 0x0D80 (3456) pixels
-  0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D90 (3472) pixels
-  0x6C1F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000,   // 0x0DA0 (3488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x745F, 0x013F, 0x013F, 0x013F,   // 0x0DB0 (3504) pixels
-  0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x431F,   // 0x0DC0 (3520) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DD0 (3536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DE0 (3552) pixels
-  0x6C1F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DF0 (3568) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x745F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E00 (3584) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000,   // 0x0E10 (3600) pixels
-  0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E20 (3616) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3ADF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E30 (3632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000,   // 0x0E40 (3648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E50 (3664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A7F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0E60 (3680) pixels
-  0x431F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F,   // 0x0E70 (3696) pixels
-  0x013F, 0x013F, 0x013F, 0x3ADF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E80 (3712) pixels
-  0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x63FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000,   // 0x0E90 (3728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x099F, 0x013F, 0x013F, 0x013F,   // 0x0EA0 (3744) pixels
-  0x013F, 0x013F, 0x2A7F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x743F, 0x013F,   // 0x0EB0 (3760) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x3ADF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EC0 (3776) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0ED0 (3792) pixels
-  0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EE0 (3808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EF0 (3824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x63FF,   // 0x0F00 (3840) pixels
-  0x4B3F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F10 (3856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x63DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F20 (3872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x221F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000,   // 0x0F30 (3888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x6C1F,   // 0x0F40 (3904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0F50 (3920) pixels
-  0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63DF, 0x013F, 0x013F,   // 0x0F60 (3936) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F70 (3952) pixels
-  0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x4B3F, 0x329F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000,   // 0x0F80 (3968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x0F90 (3984) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x0FA0 (4000) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x2A5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42DF,   // 0x0FB0 (4016) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FC0 (4032) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FD0 (4048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FE0 (4064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x329F,   // 0x0FF0 (4080) pixels
-  0x221F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x3ABF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1000 (4096) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1010 (4112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1020 (4128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x329F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1030 (4144) pixels
-  0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11DF, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1040 (4160) pixels
-  0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x1050 (4176) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1060 (4192) pixels
-  0x0000, 0x3ABF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x221F, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x4B3F, 0x0000,   // 0x1070 (4208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1080 (4224) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C1F, 0x013F, 0x013F,   // 0x1090 (4240) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x10A0 (4256) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x329F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10B0 (4272) pixels
-  0x0000, 0x0000, 0x0000, 0x63BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10C0 (4288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10D0 (4304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B3F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F,   // 0x10E0 (4320) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x5B9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10F0 (4336) pixels
-  0x0000, 0x0000, 0x0000, 0x743F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1100 (4352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ADF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1110 (4368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1120 (4384) pixels
-  0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1130 (4400) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x1140 (4416) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x743F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1150 (4432) pixels
-  0x0000, 0x5B9F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6C1F, 0x0000,   // 0x1160 (4448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63DF, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1170 (4464) pixels
-  0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x223F, 0x013F, 0x013F,   // 0x1180 (4480) pixels
-  0x013F, 0x013F, 0x013F, 0x223F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F,   // 0x1190 (4496) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6BFF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11A0 (4512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11B0 (4528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x63DF, 0x0000, 0x0000, 0x0000,   // 0x11C0 (4544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C1F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x11D0 (4560) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x743F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11E0 (4576) pixels
-  0x0000, 0x0000, 0x0000, 0x5B9F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11F0 (4592) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1200 (4608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1210 (4624) pixels
-  0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1220 (4640) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F,   // 0x1230 (4656) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x5B9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1240 (4672) pixels
-  0x0000, 0x743F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x743F, 0x0000,   // 0x1250 (4688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B5F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1260 (4704) pixels
-  0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11BF, 0x013F, 0x013F,   // 0x1270 (4720) pixels
-  0x013F, 0x013F, 0x013F, 0x431F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F,   // 0x1280 (4736) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x327F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1290 (4752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x7C7F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12A0 (4768) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x099F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x535F, 0x0000, 0x0000, 0x0000,   // 0x12B0 (4784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x743F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x12C0 (4800) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x743F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12D0 (4816) pixels
-  0x0000, 0x0000, 0x0000, 0x535F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12E0 (4832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x431F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12F0 (4848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1300 (4864) pixels
-  0x013F, 0x013F, 0x013F, 0x4B5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1310 (4880) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F,   // 0x1320 (4896) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x537F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1330 (4912) pixels
-  0x0000, 0x743F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x743F, 0x0000,   // 0x1340 (4928) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63DF, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1350 (4944) pixels
-  0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19FF, 0x013F, 0x013F,   // 0x1360 (4960) pixels
-  0x013F, 0x013F, 0x013F, 0x32BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F,   // 0x1370 (4976) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1380 (4992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1390 (5008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x63DF, 0x0000, 0x0000, 0x0000,   // 0x13A0 (5024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x743F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x13B0 (5040) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x63DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13C0 (5056) pixels
-  0x0000, 0x0000, 0x0000, 0x6BFF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13D0 (5072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x327F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19DF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13E0 (5088) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x13F0 (5104) pixels
-  0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1400 (5120) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x1410 (5136) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x6BFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1420 (5152) pixels
-  0x0000, 0x63DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x537F, 0x0000,   // 0x1430 (5168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1440 (5184) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B9F, 0x013F, 0x013F,   // 0x1450 (5200) pixels
-  0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x1460 (5216) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x745F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1470 (5232) pixels
-  0x0000, 0x0000, 0x0000, 0x745F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1480 (5248) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1490 (5264) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x537F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F,   // 0x14A0 (5280) pixels
-  0x11BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x14B0 (5296) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x14C0 (5312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x14D0 (5328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x14E0 (5344) pixels
-  0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ADF, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x14F0 (5360) pixels
-  0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x1500 (5376) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1510 (5392) pixels
-  0x0000, 0x42FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x2A7F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x2A7F, 0x0000,   // 0x1520 (5408) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1530 (5424) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x1540 (5440) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x537F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1550 (5456) pixels
-  0x119F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x63FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1560 (5472) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x2A5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1570 (5488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1580 (5504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x2A7F,   // 0x1590 (5520) pixels
-  0x42FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15A0 (5536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x745F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15B0 (5552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000,   // 0x15C0 (5568) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ADF, 0x221F, 0x19FF, 0x2A7F, 0x6C1F, 0x0000,   // 0x15D0 (5584) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x15E0 (5600) pixels
-  0x013F, 0x6C1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x745F, 0x013F, 0x013F,   // 0x15F0 (5616) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1600 (5632) pixels
-  0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x63DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000,   // 0x1610 (5648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1620 (5664) pixels
-  0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x537F, 0x013F,   // 0x1630 (5680) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x745F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1640 (5696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1650 (5712) pixels
-  0x0000, 0x0000, 0x11BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1660 (5728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1670 (5744) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x63DF,   // 0x1680 (5760) pixels
-  0x743F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1690 (5776) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2A3F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x16A0 (5792) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000,   // 0x16B0 (5808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x16C0 (5824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x745F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x16D0 (5840) pixels
-  0x19FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F,   // 0x16E0 (5856) pixels
-  0x013F, 0x013F, 0x013F, 0x2A3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x16F0 (5872) pixels
-  0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x743F, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000,   // 0x1700 (5888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5BBF, 0x013F, 0x013F, 0x013F,   // 0x1710 (5904) pixels
-  0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19FF,   // 0x1720 (5920) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x329F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1730 (5936) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1740 (5952) pixels
-  0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1750 (5968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x5BBF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1760 (5984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000,   // 0x1770 (6000) pixels
-  0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1780 (6016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1790 (6032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000,   // 0x17A0 (6048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x17B0 (6064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x119F,   // 0x17C0 (6080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F,   // 0x17D0 (6096) pixels
-  0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x17E0 (6112) pixels
-  0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x537F,   // 0x17F0 (6128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F,   // 0x1800 (6144) pixels
-  0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1810 (6160) pixels
-  0x223F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x4B1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1820 (6176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1830 (6192) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1840 (6208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3ADF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1850 (6224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x535F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000,   // 0x1860 (6240) pixels
-  0x0000, 0x11BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x221F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1870 (6256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1880 (6272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x537F,   // 0x1890 (6288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18A0 (6304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x32BF, 0x0000,   // 0x18B0 (6320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x18C0 (6336) pixels
-  0x013F, 0x013F, 0x221F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18D0 (6352) pixels
-  0x19DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000, 0x0000, 0x4B3F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x18E0 (6368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6BFF, 0x013F, 0x013F,   // 0x18F0 (6384) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1900 (6400) pixels
-  0x0000, 0x7C5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1910 (6416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1920 (6432) pixels
-  0x3ADF, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1930 (6448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6BFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1940 (6464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x4B3F, 0x0000,   // 0x1950 (6480) pixels
-  0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1960 (6496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000, 0x0000, 0x0000,   // 0x1970 (6512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x099F, 0x013F, 0x099F, 0x0000, 0x0000,   // 0x1980 (6528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1990 (6544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ADF, 0x015F, 0x013F, 0x2A7F, 0x0000, 0x0000, 0x0000,   // 0x19A0 (6560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11DF, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x19B0 (6576) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x19C0 (6592) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x19D0 (6608) pixels
-  0x4B3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19FF, 0x013F,   // 0x19E0 (6624) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x19F0 (6640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A00 (6656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A10 (6672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A20 (6688) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x221F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A30 (6704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B1F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000,   // 0x1A40 (6720) pixels
-  0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A50 (6736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x327F, 0x0000, 0x0000,   // 0x1A60 (6752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A70 (6768) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A80 (6784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A90 (6800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x327F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1AA0 (6816) pixels
-  0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F,   // 0x1AB0 (6832) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ADF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1AC0 (6848) pixels
-  0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F,   // 0x1AD0 (6864) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1AE0 (6880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1AF0 (6896) pixels
-  0x0000, 0x0000, 0x745F, 0x63FF, 0x6C1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B00 (6912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B10 (6928) pixels
-  0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B20 (6944) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000,   // 0x1B30 (6960) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x4B3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B40 (6976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000,   // 0x1B50 (6992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B60 (7008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x329F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000,   // 0x1B70 (7024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B80 (7040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1B90 (7056) pixels
-  0x63DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B3F, 0x013F,   // 0x1BA0 (7072) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1BB0 (7088) pixels
-  0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1BC0 (7104) pixels
-  0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6C1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1BD0 (7120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x099F,   // 0x1BE0 (7136) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x745F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1BF0 (7152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C00 (7168) pixels
-  0x6C1F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C10 (7184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000,   // 0x1C20 (7200) pixels
-  0x0000, 0x0000, 0x0000, 0x2A5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C30 (7216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F,   // 0x1C40 (7232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C50 (7248) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1C60 (7264) pixels
-  0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C70 (7280) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6BFF,   // 0x1C80 (7296) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x1C90 (7312) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x2A5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1CA0 (7328) pixels
-  0x013F, 0x013F, 0x4B1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1CB0 (7344) pixels
-  0x0000, 0x099F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1CC0 (7360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x537F, 0x013F, 0x013F,   // 0x1CD0 (7376) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1CE0 (7392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11BF,   // 0x1CF0 (7408) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D00 (7424) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D10 (7440) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D20 (7456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1D30 (7472) pixels
-  0x013F, 0x42DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D40 (7488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1D50 (7504) pixels
-  0x013F, 0x013F, 0x6C1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D60 (7520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000,   // 0x1D70 (7536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F,   // 0x1D80 (7552) pixels
-  0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x32BF, 0x013F, 0x013F, 0x013F,   // 0x1D90 (7568) pixels
-  0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DA0 (7584) pixels
-  0x0000, 0x0000, 0x3ADF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DB0 (7600) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B1F, 0x013F, 0x013F, 0x013F,   // 0x1DC0 (7616) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DD0 (7632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x1DE0 (7648) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DF0 (7664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x3ADF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E00 (7680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E10 (7696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1E20 (7712) pixels
-  0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E30 (7728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1E40 (7744) pixels
-  0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E50 (7760) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000, 0x0000,   // 0x1E60 (7776) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19FF, 0x013F, 0x013F, 0x013F,   // 0x1E70 (7792) pixels
-  0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11DF, 0x013F, 0x013F,   // 0x1E80 (7808) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E90 (7824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x3ABF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EA0 (7840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1EB0 (7856) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x2A5F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EC0 (7872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x329F, 0x013F,   // 0x1ED0 (7888) pixels
-  0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EE0 (7904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EF0 (7920) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000, 0x0000, 0x0000,   // 0x1F00 (7936) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F,   // 0x1F10 (7952) pixels
-  0x223F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F20 (7968) pixels
-  0x0000, 0x0000, 0x0000, 0x3ABF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1F30 (7984) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F40 (8000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x221F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F50 (8016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19DF, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1F60 (8032) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F,   // 0x1F70 (8048) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F80 (8064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F90 (8080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x1FA0 (8096) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FB0 (8112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FC0 (8128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FD0 (8144) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FE0 (8160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x745F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x099F, 0x0000, 0x0000,   // 0x1FF0 (8176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2000 (8192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2010 (8208) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2020 (8224) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x3ABF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2030 (8240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2040 (8256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2050 (8272) pixels
-  0x013F, 0x745F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x119F,   // 0x2060 (8288) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x4B3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2070 (8304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2080 (8320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2090 (8336) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000,   // 0x20A0 (8352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20B0 (8368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20C0 (8384) pixels
-  0x0000, 0x4B3F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20D0 (8400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000,   // 0x20E0 (8416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20F0 (8432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2100 (8448) pixels
-  0x0000, 0x0000, 0x11BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2110 (8464) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2120 (8480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2130 (8496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2140 (8512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2150 (8528) pixels
-  0x221F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2160 (8544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2170 (8560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2180 (8576) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x537F, 0x0000, 0x0000,   // 0x2190 (8592) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21A0 (8608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21B0 (8624) pixels
-  0x099F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x223F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21C0 (8640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x21D0 (8656) pixels
-  0x3ADF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21E0 (8672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21F0 (8688) pixels
-  0x0000, 0x745F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2200 (8704) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x119F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2210 (8720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2220 (8736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ABF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000,   // 0x2230 (8752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2240 (8768) pixels
-  0x0000, 0x5B9F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6BFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2250 (8784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2260 (8800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2270 (8816) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000,   // 0x2280 (8832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2290 (8848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63FF, 0x013F,   // 0x22A0 (8864) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x5BBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22B0 (8880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x22C0 (8896) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22D0 (8912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22E0 (8928) pixels
-  0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x22F0 (8944) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x743F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2300 (8960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2310 (8976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19DF, 0x0000, 0x0000,   // 0x2320 (8992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2330 (9008) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2340 (9024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2350 (9040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2360 (9056) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x2A7F, 0x0000,   // 0x2370 (9072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2380 (9088) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42FF, 0x013F, 0x013F,   // 0x2390 (9104) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23A0 (9120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C1F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x23B0 (9136) pixels
-  0x013F, 0x013F, 0x3ABF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23C0 (9152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23D0 (9168) pixels
-  0x4B1F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x23E0 (9184) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23F0 (9200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2400 (9216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x223F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x743F, 0x0000, 0x0000, 0x0000,   // 0x2410 (9232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2420 (9248) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x42FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x743F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2430 (9264) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2440 (9280) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2450 (9296) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000,   // 0x2460 (9312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2470 (9328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6BFF, 0x013F, 0x013F,   // 0x2480 (9344) pixels
-  0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2490 (9360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42FF, 0x013F, 0x013F,   // 0x24A0 (9376) pixels
-  0x013F, 0x327F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24B0 (9392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24C0 (9408) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x24D0 (9424) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24E0 (9440) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24F0 (9456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x327F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2500 (9472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2510 (9488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2520 (9504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2530 (9520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2540 (9536) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x097F,   // 0x2550 (9552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2560 (9568) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2570 (9584) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2580 (9600) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2590 (9616) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x25A0 (9632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11BF,   // 0x25B0 (9648) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x25C0 (9664) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x25D0 (9680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x25E0 (9696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x25F0 (9712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2600 (9728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2610 (9744) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2620 (9760) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2630 (9776) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2640 (9792) pixels
-  0x63BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2650 (9808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2660 (9824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2670 (9840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2680 (9856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2690 (9872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C7F, 0x013F,   // 0x26A0 (9888) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x26B0 (9904) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x26C0 (9920) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x26D0 (9936) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x26E0 (9952) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x26F0 (9968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2700 (9984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2710 (10000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A5F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2720 (10016) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2730 (10032) pixels
-  0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2740 (10048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2750 (10064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2760 (10080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2770 (10096) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2780 (10112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x2790 (10128) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x27A0 (10144) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x7C7F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x27B0 (10160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x27C0 (10176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x27D0 (10192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x27E0 (10208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x27F0 (10224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2800 (10240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2810 (10256) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2820 (10272) pixels
-  0x013F, 0x327F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2830 (10288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2840 (10304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2850 (10320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2860 (10336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2870 (10352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B3F, 0x013F, 0x013F,   // 0x2880 (10368) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2890 (10384) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28A0 (10400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28B0 (10416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28C0 (10432) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28D0 (10448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28E0 (10464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28F0 (10480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2900 (10496) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2910 (10512) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2920 (10528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2930 (10544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2940 (10560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2950 (10576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2960 (10592) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F,   // 0x2970 (10608) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2980 (10624) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x4B1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2990 (10640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29A0 (10656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29B0 (10672) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29C0 (10688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29D0 (10704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29E0 (10720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x6BFF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x29F0 (10736) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2A00 (10752) pixels
-  0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A10 (10768) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A20 (10784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A30 (10800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A40 (10816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A50 (10832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11DF, 0x013F, 0x013F, 0x013F,   // 0x2A60 (10848) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2A70 (10864) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A80 (10880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A90 (10896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AA0 (10912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AB0 (10928) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AC0 (10944) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AD0 (10960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2AE0 (10976) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2AF0 (10992) pixels
-  0x013F, 0x013F, 0x013F, 0x6BFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B00 (11008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B10 (11024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B20 (11040) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B30 (11056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B40 (11072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C9F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2B50 (11088) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2B60 (11104) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B70 (11120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B80 (11136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B90 (11152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BA0 (11168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BB0 (11184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BC0 (11200) pixels
-  0x0000, 0x0000, 0x0000, 0x327F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2BD0 (11216) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2BE0 (11232) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BF0 (11248) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C00 (11264) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C10 (11280) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C20 (11296) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C30 (11312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2C40 (11328) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2C50 (11344) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C60 (11360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C70 (11376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C80 (11392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C90 (11408) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CA0 (11424) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CB0 (11440) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2CC0 (11456) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2CD0 (11472) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x329F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CE0 (11488) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CF0 (11504) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D00 (11520) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D10 (11536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D20 (11552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B1F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2D30 (11568) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2D40 (11584) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000,   // 0x2D50 (11600) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D60 (11616) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D70 (11632) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D80 (11648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D90 (11664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DA0 (11680) pixels
-  0x0000, 0x0000, 0x099F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2DB0 (11696) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2DC0 (11712) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DD0 (11728) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DE0 (11744) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DF0 (11760) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E00 (11776) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E10 (11792) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2E20 (11808) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2E30 (11824) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x537F, 0x0000, 0x0000,   // 0x2E40 (11840) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E50 (11856) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E60 (11872) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E70 (11888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E80 (11904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E90 (11920) pixels
-  0x0000, 0x6BFF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2EA0 (11936) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2EB0 (11952) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EC0 (11968) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2ED0 (11984) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EE0 (12000) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EF0 (12016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F00 (12032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19DF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2F10 (12048) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2F20 (12064) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000,   // 0x2F30 (12080) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F40 (12096) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F50 (12112) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F60 (12128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F70 (12144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F80 (12160) pixels
-  0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2F90 (12176) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x2FA0 (12192) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x6C1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FB0 (12208) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FC0 (12224) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FD0 (12240) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FE0 (12256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FF0 (12272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3000 (12288) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3010 (12304) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x2A5F, 0x0000,   // 0x3020 (12320) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3030 (12336) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3040 (12352) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3050 (12368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3060 (12384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3070 (12400) pixels
-  0x329F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3080 (12416) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3090 (12432) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30A0 (12448) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30B0 (12464) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30C0 (12480) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30D0 (12496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30E0 (12512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x30F0 (12528) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3100 (12544) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000,   // 0x3110 (12560) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3120 (12576) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3130 (12592) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3140 (12608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3150 (12624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3160 (12640) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3170 (12656) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3180 (12672) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x3ADF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3190 (12688) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31A0 (12704) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31B0 (12720) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31C0 (12736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31D0 (12752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B3F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x31E0 (12768) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x31F0 (12784) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F,   // 0x3200 (12800) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3210 (12816) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3220 (12832) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3230 (12848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3240 (12864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F,   // 0x3250 (12880) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3260 (12896) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3270 (12912) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3280 (12928) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3290 (12944) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32A0 (12960) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32B0 (12976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32C0 (12992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x32D0 (13008) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x32E0 (13024) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x32F0 (13040) pixels
-  0x5BBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3300 (13056) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3310 (13072) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3320 (13088) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3330 (13104) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C1F, 0x013F,   // 0x3340 (13120) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3350 (13136) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3360 (13152) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x11BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3370 (13168) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3380 (13184) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3390 (13200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x33A0 (13216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x33B0 (13232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19FF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x33C0 (13248) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x33D0 (13264) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x33E0 (13280) pixels
-  0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x33F0 (13296) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3400 (13312) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3410 (13328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3420 (13344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F,   // 0x3430 (13360) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3440 (13376) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3450 (13392) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x743F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3460 (13408) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3470 (13424) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3480 (13440) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3490 (13456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34A0 (13472) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x34B0 (13488) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x34C0 (13504) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x34D0 (13520) pixels
-  0x013F, 0x2A5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34E0 (13536) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34F0 (13552) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3500 (13568) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3510 (13584) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x329F, 0x013F, 0x013F,   // 0x3520 (13600) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3530 (13616) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3540 (13632) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3550 (13648) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3560 (13664) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3570 (13680) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3580 (13696) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3590 (13712) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x35A0 (13728) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x35B0 (13744) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x35C0 (13760) pixels
-  0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x35D0 (13776) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x35E0 (13792) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x35F0 (13808) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3600 (13824) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F,   // 0x3610 (13840) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3620 (13856) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3630 (13872) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x42FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3640 (13888) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3650 (13904) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3660 (13920) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3670 (13936) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3680 (13952) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x537F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3690 (13968) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x36A0 (13984) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x36B0 (14000) pixels
-  0x013F, 0x013F, 0x097F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36C0 (14016) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36D0 (14032) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36E0 (14048) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36F0 (14064) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F,   // 0x3700 (14080) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3710 (14096) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3720 (14112) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3730 (14128) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3740 (14144) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3750 (14160) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3760 (14176) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3770 (14192) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3780 (14208) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3790 (14224) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x37A0 (14240) pixels
-  0x013F, 0x013F, 0x013F, 0x63DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37B0 (14256) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37C0 (14272) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37D0 (14288) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37E0 (14304) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x743F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x37F0 (14320) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3800 (14336) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3810 (14352) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19FF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3820 (14368) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3830 (14384) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3840 (14400) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3850 (14416) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3860 (14432) pixels
-  0x0000, 0x0000, 0x0000, 0x223F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3870 (14448) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3880 (14464) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3890 (14480) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38A0 (14496) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38B0 (14512) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38C0 (14528) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38D0 (14544) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x38E0 (14560) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x38F0 (14576) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3900 (14592) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x7C7F, 0x0000, 0x0000, 0x0000,   // 0x3910 (14608) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3920 (14624) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3930 (14640) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3940 (14656) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3950 (14672) pixels
-  0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3960 (14688) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3970 (14704) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3980 (14720) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x329F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3990 (14736) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39A0 (14752) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39B0 (14768) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39C0 (14784) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x39D0 (14800) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x39E0 (14816) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x39F0 (14832) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x3ABF, 0x0000, 0x0000, 0x0000,   // 0x3A00 (14848) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A10 (14864) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A20 (14880) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A30 (14896) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A40 (14912) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x097F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3A50 (14928) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3A60 (14944) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3A70 (14960) pixels
-  0x013F, 0x013F, 0x013F, 0x4B3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A80 (14976) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A90 (14992) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3AA0 (15008) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3AB0 (15024) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x535F, 0x015F, 0x013F,   // 0x3AC0 (15040) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3AD0 (15056) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3AE0 (15072) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x2A5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3AF0 (15088) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B00 (15104) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B10 (15120) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B20 (15136) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B30 (15152) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x329F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3B40 (15168) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3B50 (15184) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x19DF, 0x6C1F,   // 0x3B60 (15200) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B70 (15216) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B80 (15232) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B90 (15248) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BA0 (15264) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BB0 (15280) pixels
-  0x0000, 0x0000, 0x0000, 0x6BFF, 0x3ABF, 0x11BF, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3BC0 (15296) pixels
-  0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3BD0 (15312) pixels
-  0x013F, 0x097F, 0x2A3F, 0x537F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BE0 (15328) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BF0 (15344) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C00 (15360) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C10 (15376) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C20 (15392) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C30 (15408) pixels
-  0x0000, 0x745F, 0x5BBF, 0x42FF, 0x2A7F, 0x221F, 0x099F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F, 0x013F,   // 0x3C40 (15424) pixels
-  0x015F, 0x19DF, 0x2A7F, 0x3ABF, 0x537F, 0x6C1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C50 (15440) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C60 (15456) pixels
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C70 (15472) pixels
+// Packed by      : _TOOLS/bitmap_converter.py (palette + RLE, see GfxUi::drawPackedBitmap)
+// Packed size    : 120x129 pixels, 8 bits per pixel, 40 colours, 2784 bytes (was 30960)
+
+const uint8_t hotspot[2784] PROGMEM = {
+  0x78, 0x00, 0x81, 0x00, 0x08, 0x27, 0x00, 0x00, 0x3F, 0x01, 0x5F, 0x01, 0x7F, 0x09, 0xFF, 0x42,
+  0x9F, 0x09, 0xFF, 0x19, 0xBF, 0x11, 0x1F, 0x6C, 0x5F, 0x2A, 0x7F, 0x53, 0xDF, 0x63, 0x3F, 0x74,
+  0x5F, 0x74, 0xFF, 0x6B, 0x3F, 0x4B, 0xDF, 0x19, 0xDF, 0x3A, 0x1F, 0x22, 0x9F, 0x32, 0xBF, 0x3A,
+  0x3F, 0x22, 0x7F, 0x2A, 0x7F, 0x32, 0x9F, 0x5B, 0x1F, 0x4B, 0xDF, 0x11, 0xFF, 0x63, 0x7F, 0x7C,
+  0x3F, 0x2A, 0xBF, 0x5B, 0x5F, 0x53, 0x1F, 0x43, 0x9F, 0x11, 0xBF, 0x63, 0xBF, 0x32, 0x9F, 0x7C,
+  0x5F, 0x4B, 0xDF, 0x42, 0x5F, 0x7C, 0x8D, 0x00, 0x02, 0x12, 0x01, 0x06, 0xD5, 0x00, 0x02, 0x10,
+  0x01, 0x12, 0x9A, 0x00, 0x84, 0x01, 0xD3, 0x00, 0x84, 0x01, 0x98, 0x00, 0x00, 0x02, 0x84, 0x01,
+  0x00, 0x04, 0xD1, 0x00, 0x00, 0x04, 0x84, 0x01, 0x00, 0x03, 0x96, 0x00, 0x00, 0x10, 0x85, 0x01,
+  0x00, 0x14, 0xD1, 0x00, 0x00, 0x15, 0x85, 0x01, 0x00, 0x06, 0x94, 0x00, 0x00, 0x0A, 0x86, 0x01,
+  0x00, 0x08, 0xD1, 0x00, 0x00, 0x08, 0x86, 0x01, 0x00, 0x0A, 0x93, 0x00, 0x86, 0x01, 0x00, 0x12,
+  0xD3, 0x00, 0x00, 0x06, 0x86, 0x01, 0x92, 0x00, 0x00, 0x05, 0x85, 0x01, 0x00, 0x03, 0xD5, 0x00,
+  0x00, 0x03, 0x85, 0x01, 0x00, 0x07, 0x90, 0x00, 0x00, 0x18, 0x86, 0x01, 0xD7, 0x00, 0x86, 0x01,
+  0x00, 0x18, 0x8F, 0x00, 0x86, 0x01, 0x00, 0x0A, 0xD7, 0x00, 0x00, 0x1F, 0x85, 0x01, 0x00, 0x02,
+  0x8E, 0x00, 0x00, 0x13, 0x85, 0x01, 0x00, 0x1A, 0xD9, 0x00, 0x00, 0x1A, 0x85, 0x01, 0x00, 0x13,
+  0x8D, 0x00, 0x86, 0x01, 0xDB, 0x00, 0x86, 0x01, 0x8C, 0x00, 0x00, 0x09, 0x85, 0x01, 0x00, 0x19,
+  0xDB, 0x00, 0x00, 0x04, 0x85, 0x01, 0x00, 0x13, 0x8B, 0x00, 0x85, 0x01, 0x00, 0x02, 0x8F, 0x00,
+  0x02, 0x0E, 0x06, 0x1D, 0xB7, 0x00, 0x02, 0x09, 0x06, 0x08, 0x8F, 0x00, 0x86, 0x01, 0x8A, 0x00,
+  0x00, 0x04, 0x85, 0x01, 0x00, 0x1E, 0x8E, 0x00, 0x00, 0x09, 0x83, 0x01, 0x00, 0x0D, 0xB3, 0x00,
+  0x00, 0x0D, 0x83, 0x01, 0x00, 0x17, 0x8E, 0x00, 0x00, 0x18, 0x85, 0x01, 0x00, 0x04, 0x89, 0x00,
+  0x85, 0x01, 0x00, 0x02, 0x8E, 0x00, 0x00, 0x04, 0x84, 0x01, 0x00, 0x05, 0xB3, 0x00, 0x00, 0x02,
+  0x84, 0x01, 0x00, 0x20, 0x8E, 0x00, 0x86, 0x01, 0x88, 0x00, 0x00, 0x1B, 0x85, 0x01, 0x00, 0x0A,
+  0x8E, 0x00, 0x86, 0x01, 0xB3, 0x00, 0x86, 0x01, 0x8E, 0x00, 0x00, 0x0A, 0x85, 0x01, 0x00, 0x0E,
+  0x87, 0x00, 0x00, 0x05, 0x85, 0x01, 0x8E, 0x00, 0x00, 0x02, 0x85, 0x01, 0x00, 0x06, 0xB3, 0x00,
+  0x00, 0x07, 0x85, 0x01, 0x00, 0x03, 0x8E, 0x00, 0x85, 0x01, 0x00, 0x07, 0x87, 0x00, 0x85, 0x01,
+  0x00, 0x09, 0x8D, 0x00, 0x00, 0x14, 0x86, 0x01, 0xB5, 0x00, 0x86, 0x01, 0x00, 0x14, 0x8D, 0x00,
+  0x00, 0x12, 0x85, 0x01, 0x86, 0x00, 0x00, 0x0F, 0x85, 0x01, 0x00, 0x1C, 0x8D, 0x00, 0x86, 0x01,
+  0x00, 0x1B, 0xB5, 0x00, 0x00, 0x0B, 0x86, 0x01, 0x8D, 0x00, 0x00, 0x1C, 0x85, 0x01, 0x00, 0x0F,
+  0x85, 0x00, 0x00, 0x02, 0x85, 0x01, 0x8D, 0x00, 0x00, 0x12, 0x85, 0x01, 0x00, 0x09, 0xB7, 0x00,
+  0x00, 0x1D, 0x85, 0x01, 0x00, 0x15, 0x8D, 0x00, 0x85, 0x01, 0x00, 0x03, 0x85, 0x00, 0x85, 0x01,
+  0x00, 0x09, 0x8D, 0x00, 0x85, 0x01, 0x00, 0x02, 0xB9, 0x00, 0x00, 0x02, 0x85, 0x01, 0x8D, 0x00,
+  0x00, 0x09, 0x85, 0x01, 0x84, 0x00, 0x00, 0x0B, 0x85, 0x01, 0x8D, 0x00, 0x00, 0x15, 0x85, 0x01,
+  0x00, 0x0B, 0xB9, 0x00, 0x00, 0x22, 0x85, 0x01, 0x00, 0x1D, 0x8D, 0x00, 0x85, 0x01, 0x00, 0x0B,
+  0x83, 0x00, 0x00, 0x10, 0x84, 0x01, 0x00, 0x02, 0x8D, 0x00, 0x85, 0x01, 0x00, 0x05, 0xBB, 0x00,
+  0x00, 0x05, 0x85, 0x01, 0x8D, 0x00, 0x85, 0x01, 0x00, 0x06, 0x83, 0x00, 0x85, 0x01, 0x00, 0x16,
+  0x8C, 0x00, 0x00, 0x04, 0x85, 0x01, 0x00, 0x0D, 0xBB, 0x00, 0x00, 0x0D, 0x85, 0x01, 0x00, 0x19,
+  0x8C, 0x00, 0x00, 0x15, 0x85, 0x01, 0x83, 0x00, 0x85, 0x01, 0x00, 0x24, 0x8C, 0x00, 0x00, 0x02,
+  0x84, 0x01, 0x00, 0x02, 0x8D, 0x00, 0x02, 0x08, 0x0F, 0x0D, 0x9B, 0x00, 0x01, 0x0B, 0x1F, 0x8E,
+  0x00, 0x85, 0x01, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x24, 0x85, 0x01, 0x82, 0x00, 0x00, 0x0E, 0x85,
+  0x01, 0x8D, 0x00, 0x85, 0x01, 0x00, 0x0A, 0x8C, 0x00, 0x00, 0x03, 0x82, 0x01, 0x00, 0x06, 0x99,
+  0x00, 0x83, 0x01, 0x00, 0x0A, 0x8C, 0x00, 0x00, 0x0A, 0x85, 0x01, 0x8D, 0x00, 0x85, 0x01, 0x03,
+  0x0E, 0x00, 0x00, 0x09, 0x84, 0x01, 0x00, 0x05, 0x8C, 0x00, 0x00, 0x14, 0x85, 0x01, 0x8C, 0x00,
+  0x00, 0x06, 0x84, 0x01, 0x00, 0x0C, 0x97, 0x00, 0x00, 0x03, 0x84, 0x01, 0x00, 0x1C, 0x8C, 0x00,
+  0x85, 0x01, 0x00, 0x11, 0x8C, 0x00, 0x00, 0x03, 0x84, 0x01, 0x03, 0x17, 0x00, 0x00, 0x02, 0x84,
+  0x01, 0x00, 0x11, 0x8C, 0x00, 0x00, 0x02, 0x84, 0x01, 0x00, 0x06, 0x8B, 0x00, 0x00, 0x0B, 0x85,
+  0x01, 0x00, 0x04, 0x97, 0x00, 0x85, 0x01, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x1A, 0x84, 0x01, 0x00,
+  0x03, 0x8C, 0x00, 0x00, 0x23, 0x84, 0x01, 0x02, 0x05, 0x00, 0x00, 0x85, 0x01, 0x00, 0x08, 0x8C,
+  0x00, 0x85, 0x01, 0x00, 0x08, 0x8B, 0x00, 0x86, 0x01, 0x00, 0x0E, 0x97, 0x00, 0x00, 0x03, 0x85,
+  0x01, 0x00, 0x14, 0x8B, 0x00, 0x00, 0x0E, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x08, 0x85, 0x01, 0x01,
+  0x00, 0x00, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x0D, 0x85, 0x01, 0x8B, 0x00, 0x00, 0x20, 0x85, 0x01,
+  0x00, 0x03, 0x98, 0x00, 0x00, 0x08, 0x86, 0x01, 0x8C, 0x00, 0x85, 0x01, 0x00, 0x0D, 0x8C, 0x00,
+  0x85, 0x01, 0x01, 0x00, 0x00, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x11, 0x84, 0x01, 0x00, 0x02, 0x8B,
+  0x00, 0x00, 0x02, 0x85, 0x01, 0x9A, 0x00, 0x00, 0x16, 0x85, 0x01, 0x00, 0x20, 0x8B, 0x00, 0x85,
+  0x01, 0x00, 0x11, 0x8C, 0x00, 0x85, 0x01, 0x01, 0x00, 0x1B, 0x84, 0x01, 0x00, 0x02, 0x8C, 0x00,
+  0x00, 0x05, 0x84, 0x01, 0x00, 0x16, 0x8A, 0x00, 0x00, 0x0C, 0x85, 0x01, 0x00, 0x11, 0x9B, 0x00,
+  0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x8B, 0x00, 0x00, 0x09, 0x84, 0x01, 0x00, 0x05, 0x8C, 0x00,
+  0x85, 0x01, 0x01, 0x1B, 0x0F, 0x84, 0x01, 0x00, 0x03, 0x8C, 0x00, 0x85, 0x01, 0x00, 0x0B, 0x8A,
+  0x00, 0x00, 0x12, 0x85, 0x01, 0x8B, 0x00, 0x00, 0x10, 0x83, 0x01, 0x01, 0x03, 0x08, 0x89, 0x00,
+  0x00, 0x25, 0x85, 0x01, 0x8B, 0x00, 0x00, 0x0B, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x02, 0x84, 0x01,
+  0x01, 0x0F, 0x13, 0x84, 0x01, 0x00, 0x06, 0x8C, 0x00, 0x85, 0x01, 0x8B, 0x00, 0x85, 0x01, 0x00,
+  0x09, 0x89, 0x00, 0x00, 0x26, 0x87, 0x01, 0x00, 0x07, 0x89, 0x00, 0x85, 0x01, 0x00, 0x04, 0x8B,
+  0x00, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x10, 0x84, 0x01, 0x01, 0x13, 0x12, 0x84, 0x01, 0x00, 0x14,
+  0x8C, 0x00, 0x85, 0x01, 0x8B, 0x00, 0x85, 0x01, 0x89, 0x00, 0x00, 0x13, 0x89, 0x01, 0x00, 0x05,
+  0x88, 0x00, 0x00, 0x1A, 0x84, 0x01, 0x00, 0x05, 0x8B, 0x00, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x14,
+  0x84, 0x01, 0x01, 0x12, 0x03, 0x84, 0x01, 0x00, 0x0F, 0x8C, 0x00, 0x85, 0x01, 0x8A, 0x00, 0x00,
+  0x08, 0x85, 0x01, 0x89, 0x00, 0x8B, 0x01, 0x00, 0x13, 0x87, 0x00, 0x00, 0x22, 0x85, 0x01, 0x8B,
+  0x00, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x0F, 0x84, 0x01, 0x00, 0x03, 0x85, 0x01, 0x00, 0x18, 0x8B,
+  0x00, 0x00, 0x0C, 0x85, 0x01, 0x8A, 0x00, 0x00, 0x11, 0x84, 0x01, 0x00, 0x05, 0x88, 0x00, 0x00,
+  0x03, 0x8C, 0x01, 0x88, 0x00, 0x85, 0x01, 0x8B, 0x00, 0x85, 0x01, 0x00, 0x0C, 0x8B, 0x00, 0x00,
+  0x18, 0x8B, 0x01, 0x00, 0x08, 0x8B, 0x00, 0x00, 0x0B, 0x84, 0x01, 0x00, 0x03, 0x8A, 0x00, 0x00,
+  0x15, 0x84, 0x01, 0x00, 0x15, 0x88, 0x00, 0x8D, 0x01, 0x00, 0x0E, 0x87, 0x00, 0x85, 0x01, 0x8B,
+  0x00, 0x00, 0x02, 0x84, 0x01, 0x00, 0x0B, 0x8B, 0x00, 0x00, 0x08, 0x8B, 0x01, 0x00, 0x0C, 0x8B,
+  0x00, 0x00, 0x18, 0x84, 0x01, 0x00, 0x03, 0x8A, 0x00, 0x00, 0x06, 0x84, 0x01, 0x00, 0x04, 0x88,
+  0x00, 0x8D, 0x01, 0x00, 0x04, 0x87, 0x00, 0x85, 0x01, 0x8B, 0x00, 0x00, 0x02, 0x84, 0x01, 0x00,
+  0x18, 0x8B, 0x00, 0x00, 0x0C, 0x8B, 0x01, 0x00, 0x0C, 0x8B, 0x00, 0x00, 0x25, 0x84, 0x01, 0x00,
+  0x07, 0x8A, 0x00, 0x00, 0x07, 0x84, 0x01, 0x00, 0x20, 0x88, 0x00, 0x8D, 0x01, 0x00, 0x17, 0x87,
+  0x00, 0x85, 0x01, 0x00, 0x1C, 0x8A, 0x00, 0x00, 0x05, 0x84, 0x01, 0x00, 0x1F, 0x8B, 0x00, 0x00,
+  0x0C, 0x8B, 0x01, 0x00, 0x0C, 0x8B, 0x00, 0x00, 0x1F, 0x84, 0x01, 0x00, 0x05, 0x8A, 0x00, 0x00,
+  0x10, 0x84, 0x01, 0x00, 0x20, 0x88, 0x00, 0x8D, 0x01, 0x00, 0x25, 0x87, 0x00, 0x85, 0x01, 0x8B,
+  0x00, 0x00, 0x03, 0x84, 0x01, 0x00, 0x0A, 0x8B, 0x00, 0x00, 0x0C, 0x8B, 0x01, 0x00, 0x0C, 0x8B,
+  0x00, 0x00, 0x0B, 0x84, 0x01, 0x00, 0x03, 0x8A, 0x00, 0x00, 0x06, 0x84, 0x01, 0x00, 0x23, 0x88,
+  0x00, 0x8D, 0x01, 0x88, 0x00, 0x85, 0x01, 0x8B, 0x00, 0x00, 0x02, 0x84, 0x01, 0x00, 0x0B, 0x8B,
+  0x00, 0x00, 0x0C, 0x8B, 0x01, 0x00, 0x0B, 0x8B, 0x00, 0x00, 0x0E, 0x84, 0x01, 0x00, 0x02, 0x8A,
+  0x00, 0x00, 0x17, 0x84, 0x01, 0x00, 0x10, 0x88, 0x00, 0x00, 0x09, 0x8B, 0x01, 0x00, 0x03, 0x88,
+  0x00, 0x85, 0x01, 0x8B, 0x00, 0x85, 0x01, 0x00, 0x0E, 0x8B, 0x00, 0x00, 0x0B, 0x85, 0x01, 0x00,
+  0x02, 0x84, 0x01, 0x00, 0x0A, 0x8C, 0x00, 0x85, 0x01, 0x8A, 0x00, 0x00, 0x18, 0x84, 0x01, 0x00,
+  0x02, 0x89, 0x00, 0x8B, 0x01, 0x00, 0x0D, 0x87, 0x00, 0x00, 0x0D, 0x85, 0x01, 0x8B, 0x00, 0x85,
+  0x01, 0x8C, 0x00, 0x00, 0x0A, 0x84, 0x01, 0x01, 0x02, 0x07, 0x84, 0x01, 0x00, 0x04, 0x8C, 0x00,
+  0x85, 0x01, 0x8B, 0x00, 0x85, 0x01, 0x8A, 0x00, 0x89, 0x01, 0x00, 0x04, 0x88, 0x00, 0x00, 0x11,
+  0x84, 0x01, 0x00, 0x03, 0x8B, 0x00, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x04, 0x84, 0x01, 0x01, 0x07,
+  0x16, 0x84, 0x01, 0x00, 0x16, 0x8C, 0x00, 0x85, 0x01, 0x8B, 0x00, 0x85, 0x01, 0x00, 0x0A, 0x8A,
+  0x00, 0x00, 0x21, 0x85, 0x01, 0x01, 0x02, 0x1B, 0x89, 0x00, 0x85, 0x01, 0x00, 0x09, 0x8B, 0x00,
+  0x85, 0x01, 0x8C, 0x00, 0x00, 0x09, 0x84, 0x01, 0x01, 0x16, 0x04, 0x84, 0x01, 0x00, 0x07, 0x8C,
+  0x00, 0x85, 0x01, 0x00, 0x0D, 0x8A, 0x00, 0x00, 0x03, 0x84, 0x01, 0x00, 0x02, 0x8C, 0x00, 0x04,
+  0x11, 0x12, 0x06, 0x16, 0x08, 0x8B, 0x00, 0x85, 0x01, 0x00, 0x08, 0x8A, 0x00, 0x00, 0x0D, 0x85,
+  0x01, 0x8C, 0x00, 0x00, 0x03, 0x84, 0x01, 0x01, 0x04, 0x0B, 0x84, 0x01, 0x00, 0x03, 0x8C, 0x00,
+  0x85, 0x01, 0x00, 0x04, 0x8A, 0x00, 0x00, 0x0A, 0x85, 0x01, 0x00, 0x0D, 0x9B, 0x00, 0x00, 0x07,
+  0x85, 0x01, 0x8B, 0x00, 0x00, 0x04, 0x85, 0x01, 0x8C, 0x00, 0x85, 0x01, 0x01, 0x0B, 0x0C, 0x85,
+  0x01, 0x8C, 0x00, 0x00, 0x1D, 0x84, 0x01, 0x00, 0x07, 0x8B, 0x00, 0x85, 0x01, 0x00, 0x03, 0x9A,
+  0x00, 0x00, 0x0D, 0x85, 0x01, 0x00, 0x06, 0x8B, 0x00, 0x00, 0x03, 0x84, 0x01, 0x00, 0x1D, 0x8C,
+  0x00, 0x85, 0x01, 0x01, 0x0C, 0x00, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x1E, 0x85, 0x01, 0x8B, 0x00,
+  0x00, 0x06, 0x85, 0x01, 0x00, 0x13, 0x99, 0x00, 0x00, 0x02, 0x85, 0x01, 0x8C, 0x00, 0x85, 0x01,
+  0x00, 0x1E, 0x8C, 0x00, 0x85, 0x01, 0x01, 0x00, 0x00, 0x85, 0x01, 0x8D, 0x00, 0x85, 0x01, 0x8C,
+  0x00, 0x86, 0x01, 0x98, 0x00, 0x00, 0x09, 0x85, 0x01, 0x00, 0x21, 0x8C, 0x00, 0x85, 0x01, 0x8D,
+  0x00, 0x85, 0x01, 0x02, 0x00, 0x00, 0x02, 0x84, 0x01, 0x00, 0x0A, 0x8C, 0x00, 0x85, 0x01, 0x00,
+  0x04, 0x8B, 0x00, 0x00, 0x15, 0x85, 0x01, 0x00, 0x19, 0x97, 0x00, 0x86, 0x01, 0x8C, 0x00, 0x00,
+  0x11, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x1F, 0x84, 0x01, 0x03, 0x02, 0x00, 0x00, 0x07, 0x84, 0x01,
+  0x00, 0x12, 0x8C, 0x00, 0x00, 0x10, 0x84, 0x01, 0x00, 0x02, 0x8C, 0x00, 0x85, 0x01, 0x00, 0x0A,
+  0x97, 0x00, 0x85, 0x01, 0x00, 0x23, 0x8C, 0x00, 0x85, 0x01, 0x00, 0x12, 0x8C, 0x00, 0x00, 0x10,
+  0x84, 0x01, 0x03, 0x06, 0x00, 0x00, 0x0F, 0x85, 0x01, 0x8C, 0x00, 0x00, 0x0E, 0x85, 0x01, 0x8C,
+  0x00, 0x00, 0x27, 0x84, 0x01, 0x98, 0x00, 0x00, 0x11, 0x83, 0x01, 0x00, 0x07, 0x8D, 0x00, 0x85,
+  0x01, 0x00, 0x0E, 0x8C, 0x00, 0x85, 0x01, 0x00, 0x0F, 0x82, 0x00, 0x85, 0x01, 0x8D, 0x00, 0x85,
+  0x01, 0x00, 0x06, 0x8D, 0x00, 0x02, 0x05, 0x01, 0x05, 0x9A, 0x00, 0x03, 0x11, 0x02, 0x01, 0x16,
+  0x8D, 0x00, 0x00, 0x1A, 0x85, 0x01, 0x8D, 0x00, 0x85, 0x01, 0x83, 0x00, 0x85, 0x01, 0x00, 0x0F,
+  0x8C, 0x00, 0x00, 0x06, 0x85, 0x01, 0xBD, 0x00, 0x85, 0x01, 0x00, 0x12, 0x8C, 0x00, 0x00, 0x19,
+  0x85, 0x01, 0x83, 0x00, 0x00, 0x03, 0x84, 0x01, 0x00, 0x03, 0x8D, 0x00, 0x85, 0x01, 0x00, 0x17,
+  0xBB, 0x00, 0x00, 0x17, 0x85, 0x01, 0x8D, 0x00, 0x00, 0x02, 0x84, 0x01, 0x00, 0x03, 0x83, 0x00,
+  0x00, 0x11, 0x85, 0x01, 0x8D, 0x00, 0x00, 0x03, 0x85, 0x01, 0x9B, 0x00, 0x02, 0x0D, 0x1B, 0x08,
+  0x9C, 0x00, 0x85, 0x01, 0x00, 0x05, 0x8D, 0x00, 0x85, 0x01, 0x00, 0x04, 0x84, 0x00, 0x85, 0x01,
+  0x00, 0x0F, 0x8C, 0x00, 0x00, 0x0B, 0x85, 0x01, 0x00, 0x06, 0x98, 0x00, 0x00, 0x13, 0x84, 0x01,
+  0x00, 0x03, 0x99, 0x00, 0x00, 0x10, 0x85, 0x01, 0x00, 0x0B, 0x8C, 0x00, 0x00, 0x0F, 0x85, 0x01,
+  0x85, 0x00, 0x85, 0x01, 0x00, 0x02, 0x8D, 0x00, 0x00, 0x02, 0x85, 0x01, 0x00, 0x08, 0x96, 0x00,
+  0x00, 0x05, 0x87, 0x01, 0x00, 0x0D, 0x96, 0x00, 0x00, 0x08, 0x85, 0x01, 0x00, 0x02, 0x8D, 0x00,
+  0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x85, 0x00, 0x00, 0x09, 0x85, 0x01, 0x8D, 0x00, 0x00, 0x1B,
+  0x85, 0x01, 0x00, 0x02, 0x95, 0x00, 0x00, 0x07, 0x89, 0x01, 0x96, 0x00, 0x86, 0x01, 0x00, 0x0E,
+  0x8D, 0x00, 0x85, 0x01, 0x00, 0x09, 0x86, 0x00, 0x85, 0x01, 0x00, 0x19, 0x8D, 0x00, 0x00, 0x05,
+  0x85, 0x01, 0x00, 0x07, 0x93, 0x00, 0x00, 0x0A, 0x8A, 0x01, 0x00, 0x07, 0x94, 0x00, 0x00, 0x07,
+  0x85, 0x01, 0x00, 0x05, 0x8D, 0x00, 0x00, 0x04, 0x85, 0x01, 0x87, 0x00, 0x85, 0x01, 0x00, 0x03,
+  0x8E, 0x00, 0x86, 0x01, 0x00, 0x26, 0x92, 0x00, 0x8C, 0x01, 0x00, 0x08, 0x92, 0x00, 0x00, 0x04,
+  0x86, 0x01, 0x8E, 0x00, 0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x87, 0x00, 0x00, 0x23, 0x85, 0x01,
+  0x8E, 0x00, 0x00, 0x11, 0x85, 0x01, 0x00, 0x02, 0x91, 0x00, 0x00, 0x19, 0x8C, 0x01, 0x00, 0x03,
+  0x92, 0x00, 0x86, 0x01, 0x00, 0x04, 0x8E, 0x00, 0x85, 0x01, 0x00, 0x11, 0x88, 0x00, 0x85, 0x01,
+  0x00, 0x06, 0x8E, 0x00, 0x00, 0x03, 0x84, 0x01, 0x00, 0x02, 0x91, 0x00, 0x00, 0x02, 0x8D, 0x01,
+  0x92, 0x00, 0x85, 0x01, 0x00, 0x05, 0x8E, 0x00, 0x00, 0x06, 0x85, 0x01, 0x89, 0x00, 0x00, 0x1A,
+  0x85, 0x01, 0x8F, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x14, 0x91, 0x00, 0x8E, 0x01, 0x00, 0x09,
+  0x91, 0x00, 0x00, 0x13, 0x83, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x85, 0x01, 0x00, 0x1A, 0x8A, 0x00,
+  0x85, 0x01, 0x00, 0x06, 0x8F, 0x00, 0x03, 0x03, 0x01, 0x01, 0x15, 0x91, 0x00, 0x00, 0x14, 0x8F,
+  0x01, 0x92, 0x00, 0x03, 0x12, 0x01, 0x01, 0x05, 0x8F, 0x00, 0x00, 0x10, 0x85, 0x01, 0x8B, 0x00,
+  0x00, 0x03, 0x85, 0x01, 0xA5, 0x00, 0x00, 0x02, 0x8F, 0x01, 0xA6, 0x00, 0x85, 0x01, 0x00, 0x05,
+  0x8B, 0x00, 0x00, 0x0D, 0x85, 0x01, 0x00, 0x05, 0xA4, 0x00, 0x90, 0x01, 0x00, 0x14, 0xA4, 0x00,
+  0x00, 0x03, 0x85, 0x01, 0x00, 0x0D, 0x8C, 0x00, 0x00, 0x21, 0x85, 0x01, 0x00, 0x0F, 0xA2, 0x00,
+  0x00, 0x22, 0x90, 0x01, 0x00, 0x03, 0xA3, 0x00, 0x00, 0x0F, 0x85, 0x01, 0x00, 0x07, 0x8E, 0x00,
+  0x86, 0x01, 0xA2, 0x00, 0x00, 0x07, 0x91, 0x01, 0xA3, 0x00, 0x86, 0x01, 0x8F, 0x00, 0x00, 0x12,
+  0x85, 0x01, 0x00, 0x07, 0xA1, 0x00, 0x92, 0x01, 0x00, 0x0A, 0xA1, 0x00, 0x00, 0x05, 0x85, 0x01,
+  0x00, 0x15, 0x90, 0x00, 0x86, 0x01, 0x00, 0x11, 0x9F, 0x00, 0x00, 0x0D, 0x92, 0x01, 0x00, 0x21,
+  0xA0, 0x00, 0x00, 0x14, 0x86, 0x01, 0x91, 0x00, 0x00, 0x18, 0x86, 0x01, 0x00, 0x0E, 0x9E, 0x00,
+  0x00, 0x09, 0x93, 0x01, 0x9F, 0x00, 0x00, 0x1B, 0x86, 0x01, 0x00, 0x1E, 0x92, 0x00, 0x00, 0x10,
+  0x86, 0x01, 0x9E, 0x00, 0x94, 0x01, 0x00, 0x0C, 0x9E, 0x00, 0x86, 0x01, 0x00, 0x10, 0x94, 0x00,
+  0x86, 0x01, 0x00, 0x04, 0x9D, 0x00, 0x94, 0x01, 0x00, 0x16, 0x9D, 0x00, 0x00, 0x04, 0x85, 0x01,
+  0x00, 0x02, 0x95, 0x00, 0x00, 0x08, 0x85, 0x01, 0x00, 0x14, 0x9C, 0x00, 0x00, 0x19, 0x95, 0x01,
+  0x9D, 0x00, 0x00, 0x15, 0x85, 0x01, 0x00, 0x0C, 0x96, 0x00, 0x00, 0x04, 0x84, 0x01, 0x00, 0x0C,
+  0x9C, 0x00, 0x00, 0x02, 0x95, 0x01, 0x9D, 0x00, 0x00, 0x0E, 0x84, 0x01, 0x00, 0x04, 0x98, 0x00,
+  0x00, 0x04, 0x82, 0x01, 0x00, 0x17, 0x9D, 0x00, 0x96, 0x01, 0x00, 0x04, 0x9D, 0x00, 0x00, 0x17,
+  0x82, 0x01, 0x00, 0x04, 0xBB, 0x00, 0x00, 0x0B, 0x96, 0x01, 0x00, 0x03, 0xDE, 0x00, 0x00, 0x07,
+  0x97, 0x01, 0xDE, 0x00, 0x98, 0x01, 0x00, 0x22, 0xDC, 0x00, 0x00, 0x1C, 0x98, 0x01, 0x00, 0x1A,
+  0xDC, 0x00, 0x00, 0x09, 0x99, 0x01, 0xDC, 0x00, 0x9A, 0x01, 0x00, 0x1C, 0xDB, 0x00, 0x9A, 0x01,
+  0x00, 0x17, 0xDA, 0x00, 0x00, 0x0F, 0x9A, 0x01, 0x00, 0x02, 0xDA, 0x00, 0x00, 0x03, 0x9B, 0x01,
+  0xDA, 0x00, 0x9C, 0x01, 0x00, 0x19, 0xD8, 0x00, 0x00, 0x0E, 0x9C, 0x01, 0x00, 0x03, 0xD8, 0x00,
+  0x00, 0x1A, 0x9D, 0x01, 0xD8, 0x00, 0x9E, 0x01, 0x00, 0x0E, 0xD6, 0x00, 0x00, 0x24, 0x9E, 0x01,
+  0x00, 0x06, 0xD6, 0x00, 0x00, 0x17, 0x9F, 0x01, 0xD6, 0x00, 0xA0, 0x01, 0xD6, 0x00, 0xA0, 0x01,
+  0x00, 0x13, 0xD4, 0x00, 0x00, 0x19, 0xA0, 0x01, 0x00, 0x02, 0xD4, 0x00, 0x00, 0x05, 0xA1, 0x01,
+  0xD4, 0x00, 0xA2, 0x01, 0x00, 0x0A, 0xD2, 0x00, 0x00, 0x0E, 0xA2, 0x01, 0x00, 0x07, 0xD2, 0x00,
+  0x00, 0x10, 0xA3, 0x01, 0xD2, 0x00, 0xA4, 0x01, 0x00, 0x08, 0xD1, 0x00, 0xA4, 0x01, 0x00, 0x09,
+  0xD0, 0x00, 0x00, 0x13, 0xA5, 0x01, 0xD0, 0x00, 0xA6, 0x01, 0xD0, 0x00, 0xA6, 0x01, 0x00, 0x11,
+  0xCE, 0x00, 0x00, 0x0F, 0xA6, 0x01, 0x00, 0x02, 0xCE, 0x00, 0x00, 0x03, 0xA7, 0x01, 0xCE, 0x00,
+  0xA8, 0x01, 0x00, 0x1E, 0xCC, 0x00, 0x00, 0x08, 0xA8, 0x01, 0x00, 0x07, 0xCC, 0x00, 0x00, 0x06,
+  0xA9, 0x01, 0xCC, 0x00, 0xAA, 0x01, 0x00, 0x0C, 0xCB, 0x00, 0xAA, 0x01, 0x00, 0x09, 0xCA, 0x00,
+  0x00, 0x13, 0xAA, 0x01, 0x00, 0x02, 0xCA, 0x00, 0x00, 0x02, 0xAB, 0x01, 0xCA, 0x00, 0xAC, 0x01,
+  0x00, 0x04, 0xC8, 0x00, 0x00, 0x0A, 0xAC, 0x01, 0x00, 0x03, 0xC8, 0x00, 0x00, 0x03, 0xAD, 0x01,
+  0xC8, 0x00, 0xAE, 0x01, 0x00, 0x0B, 0xC6, 0x00, 0x00, 0x0C, 0xAE, 0x01, 0x00, 0x06, 0xC6, 0x00,
+  0x00, 0x15, 0xAF, 0x01, 0xC6, 0x00, 0xB0, 0x01, 0x00, 0x1C, 0xC5, 0x00, 0xB0, 0x01, 0x00, 0x13,
+  0xC5, 0x00, 0xB0, 0x01, 0x00, 0x14, 0xC6, 0x00, 0x00, 0x03, 0xAD, 0x01, 0x00, 0x0F, 0xC8, 0x00,
+  0x01, 0x1F, 0x02, 0xA9, 0x01, 0x00, 0x09, 0xCD, 0x00, 0x00, 0x13, 0xA4, 0x01, 0x01, 0x10, 0x08,
+  0xD2, 0x00, 0x02, 0x0E, 0x14, 0x07, 0x9A, 0x01, 0x02, 0x03, 0x1D, 0x0A, 0xDC, 0x00, 0x05, 0x0D,
+  0x1E, 0x04, 0x16, 0x12, 0x05, 0x88, 0x01, 0x05, 0x02, 0x10, 0x16, 0x14, 0x0A, 0x08, 0xB1, 0x00,
 };
@@ -13,6 +13,9 @@
 #include "ESP8266WiFi.h"
 #include "GlobalDefinitions.h"
 #include "P_AirSensors.h"
+#include "ProcessProfiler.h"
+#include "MemoryMonitor.h"
+#include "ScreenFactory.h"
 #include "Free_Fonts.h"
 #include "Fonts.h"
 
@@ -31,66 +34,113 @@ void ScreenStatus::activate()
 
   LCD.fillScreen(TFT_BLACK);
 
+  drawLabels();
+}
+
+void ScreenStatus::drawLabels()
+{
   LCD.setTextColor(TFT_YELLOW, TFT_BLACK);
   LCD.setFreeFont(&Dialog_plain_13);
 
   LCD.setTextDatum(TC_DATUM);
   LCD.drawString(systemID, 120, 68, GFXFF);
 
-  LCD.setTextDatum(TL_DATUM);
-
   int xpos = 0;
   int ypos = 83;
   int lineSpacing = LCD.fontHeight(GFXFF) - 2;
 
-  LCD.drawString(F("Version"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-
-  LCD.drawString(F("Built"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-
-  LCD.drawString(F("UpTime"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("Free"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("Charge"), xpos, ypos, GFXFF);
+  if (page == PAGE_PROCESSES)
+  {
+    // Column headers, times in milliseconds
+    LCD.setTextDatum(TL_DATUM);
+    LCD.drawString(F("Process"), xpos, ypos, GFXFF);
+
+    LCD.setTextDatum(TR_DATUM);
+    LCD.drawString(F("avg"), 96, ypos, GFXFF);
+    LCD.drawString(F("p99"), 132, ypos, GFXFF);
+    LCD.drawString(F("max"), 168, ypos, GFXFF);
+    LCD.drawString(F("jit"), 204, ypos, GFXFF);
+    LCD.drawString(F("miss"), 240, ypos, GFXFF);
+
+    // Process names, and a right aligned field per column
+    LCD.setTextDatum(TL_DATUM);
+    for (int i = 0; i < profiler.count(); i++)
+    {
+      ypos +=  lineSpacing;
+      LCD.drawString(profiler.get(i).name, xpos, ypos, GFXFF);
+
+      for (int column = 0; column < PROCESS_COLUMNS; column++)
+        fields[i * PROCESS_COLUMNS + column].setPosition(96 + column * 36, ypos, TR_DATUM);
+    }
+
+    ypos +=  lineSpacing * 2;
+    LCD.drawString(F("Load"), xpos, ypos, GFXFF);
+    fields[profiler.count() * PROCESS_COLUMNS].setPosition(45, ypos);
+    return;
+  }
+
+  if (page == PAGE_MEMORY)
+  {
+    // Heap now and at its worst since boot, in bytes
+    LCD.setTextDatum(TL_DATUM);
+    LCD.drawString(F("Heap"), xpos, ypos, GFXFF);
+    LCD.setTextDatum(TR_DATUM);
+    LCD.drawString(F("now"), 168, ypos, GFXFF);
+    LCD.drawString(F("worst"), 240, ypos, GFXFF);
+
+    const __FlashStringHelper *heapLabels[3] = { F("Free"), F("Block"), F("Frag") };
+
+    int field = 0;
+    for (int i = 0; i < 3; i++)
+    {
+      ypos +=  lineSpacing;
+      LCD.setTextDatum(TL_DATUM);
+      LCD.drawString(heapLabels[i], xpos, ypos, GFXFF);
+      fields[field++].setPosition(168, ypos, TR_DATUM);
+      fields[field++].setPosition(240, ypos, TR_DATUM);
+    }
+
+    // High-water marks of process runs (last and highest) and of screens (highest)
+    ypos +=  lineSpacing * 2;
+    LCD.setTextDatum(TL_DATUM);
+    LCD.drawString(F("Proc"), xpos, ypos, GFXFF);
+    LCD.drawString(F("Scrn"), 164, ypos, GFXFF);
+    LCD.setTextDatum(TR_DATUM);
+    LCD.drawString(F("last"), 101, ypos, GFXFF);
+    LCD.drawString(F("max"), 142, ypos, GFXFF);
+    LCD.drawString(F("max"), 240, ypos, GFXFF);
+
+    LCD.setTextDatum(TL_DATUM);
+    int screens = min(ScreenFactory::getInstance()->getScreenCount(), MEMORY_MAX_SCREENS);
+    for (int i = 0; i < MEMORY_ROWS; i++)
+    {
+      ypos +=  lineSpacing;
+      if (i < profiler.count())
+        LCD.drawString(profiler.get(i).name, xpos, ypos, GFXFF);
+      if (i < screens)
+        LCD.drawString(String(F("#")) + String(i), 164, ypos, GFXFF);
+
+      fields[field++].setPosition(101, ypos, TR_DATUM);
+      fields[field++].setPosition(142, ypos, TR_DATUM);
+      fields[field++].setPosition(240, ypos, TR_DATUM);
+    }
+    return;
+  }
 
-  ypos +=  lineSpacing;
-  LCD.drawString(F("Volt"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("Temp"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("WiFi"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("Net"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("IP"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("Syslog"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("MQTT"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("Topic1"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("Topic2"), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(F("Topic3"), xpos, ypos, GFXFF);
+  LCD.setTextDatum(TL_DATUM);
 
-  ypos +=  lineSpacing;
-  LCD.drawString(F("Updated"), xpos, ypos, GFXFF);
+  const __FlashStringHelper *labels[SYSTEM_FIELDS] =
+  {
+    F("Version"), F("Built"), F("UpTime"), F("Heap"), F("Charge"), F("Volt"), F("Temp"), F("WiFi"),
+    F("Net"), F("IP"), F("Syslog"), F("MQTT"), F("Topic1"), F("Topic2"), F("Topic3"), F("Updated")
+  };
+
+  for (int i = 0; i < SYSTEM_FIELDS; i++)
+  {
+    LCD.drawString(labels[i], xpos, ypos, GFXFF);
+    fields[i].setPosition(75, ypos);
+    ypos +=  lineSpacing;
+  }
 }
 
 void ScreenStatus::update()
@@ -99,60 +149,85 @@ void ScreenStatus::update()
   syslog.log(LOG_INFO, F("ScreenStatus::update()"));
 #endif
 
-  LCD.setTextDatum(TL_DATUM);
-  LCD.setTextColor(TFT_WHITE, TFT_BLACK);
+  // NOTE: fields only send what changed since the last update
   LCD.setFreeFont(&Dialog_plain_13);
 
-  int xpos = 75;
-  int ypos = 83;
-  int lineSpacing = LCD.fontHeight(GFXFF) - 2;
-
-  LCD.drawString(F(ATMOSCAN_VERSION), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(String(__DATE__ " " __TIME__), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(procPtr.UIManager.upTime(), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(String(ESP.getFreeHeap()) + F(" Bytes    "), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(String(procPtr.UIManager.getSoC(), 0) + F("%    "), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(String(procPtr.UIManager.getVolt()) + F(" V    "), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(String(procPtr.ComboPressureHumiditySensor.getTemperature()) + F(" C   "), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(config.connected ? String(WiFi.RSSI()) + F(" dbm   ") : String(F("                ")), xpos, ypos, GFXFF);
-
-  ypos +=  lineSpacing;
-  LCD.drawString(config.connected ? String(WiFi.SSID())  : String(F("                ")), xpos, ypos, GFXFF);
+  if (page == PAGE_PROCESSES)
+    updateProcesses();
+  else if (page == PAGE_MEMORY)
+    updateMemory();
+  else
+    updateSystem();
+}
 
-  ypos +=  lineSpacing;
-  LCD.drawString(config.connected ? String(WiFi.localIP().toString()) : String(F("                ")) , xpos, ypos, GFXFF);
+void ScreenStatus::updateSystem()
+{
+  int field = 0;
+
+  fields[field++].draw(F(ATMOSCAN_VERSION));
+  fields[field++].draw(F(__DATE__ " " __TIME__));
+  fields[field++].draw(procPtr.UIManager.upTime());
+  // Free / largest block, fragmentation
+  fields[field++].draw(String(memoryMonitor.getFreeHeap()) + F(" / ") + String(memoryMonitor.getMaxBlock()) +
+                       F(" B, ") + String(memoryMonitor.getFragmentation()) + F("%"));
+  fields[field++].draw(String(procPtr.UIManager.getSoC(), 0) + F("%"));
+  fields[field++].draw(String(procPtr.UIManager.getVolt()) + F(" V"));
+  fields[field++].draw(String(procPtr.ComboPressureHumiditySensor.getTemperature()) + F(" C"));
+  fields[field++].draw(config.connected ? String(WiFi.RSSI()) + F(" dbm") : String());
+  fields[field++].draw(config.connected ? String(WiFi.SSID()) : String());
+  fields[field++].draw(config.connected ? String(WiFi.localIP().toString()) : String());
+  fields[field++].draw(config.syslog_server);
+  fields[field++].draw(config.mqtt_server);
+  fields[field++].draw(config.mqtt_topic1);
+  fields[field++].draw(config.mqtt_topic2);
+  fields[field++].draw(config.mqtt_topic3);
+  fields[field++].draw(procPtr.MQTTUpdate.getLastMqttUpdate());
+}
 
-  ypos +=  lineSpacing;
-  LCD.drawString(String(config.syslog_server), xpos, ypos, GFXFF);
+void ScreenStatus::updateProcesses()
+{
+  TextField *field = fields;
 
-  ypos +=  lineSpacing;
-  LCD.drawString(String(config.mqtt_server), xpos, ypos, GFXFF);
+  for (int i = 0; i < profiler.count(); i++)
+  {
+    ServiceStats &stats = profiler.get(i);
 
-  ypos +=  lineSpacing;
-  LCD.drawString(String(config.mqtt_topic1), xpos, ypos, GFXFF);
+    (field++)->draw(ProcessProfiler::formatTime(profiler.getAvgTime(stats)));
+    (field++)->draw(ProcessProfiler::formatTime(profiler.getPercentile(stats, 99)));
+    (field++)->draw(ProcessProfiler::formatTime(stats.maxTime));
+    (field++)->draw(ProcessProfiler::formatTime(profiler.getAvgLateness(stats)));
 
-  ypos +=  lineSpacing;
-  LCD.drawString(String(config.mqtt_topic2), xpos, ypos, GFXFF);
+    // Missed deadlines in red
+    (field++)->draw(String(stats.missed), stats.missed ? TFT_RED : TFT_WHITE);
+  }
 
-  ypos +=  lineSpacing;
-  LCD.drawString(String(config.mqtt_topic3), xpos, ypos, GFXFF);
+  field->draw(String(profiler.getLoad() * 100, 1) + F("% busy, ") + String(profiler.getTotalMissed()) + F(" missed"));
+}
 
-  ypos +=  lineSpacing;
-  LCD.drawString(String(procPtr.MQTTUpdate.getLastMqttUpdate()), xpos, ypos, GFXFF);
+void ScreenStatus::updateMemory()
+{
+  TextField *field = fields;
+
+  (field++)->draw(String(memoryMonitor.getFreeHeap()));
+  (field++)->draw(String(memoryMonitor.getMinFreeHeap()));
+  (field++)->draw(String(memoryMonitor.getMaxBlock()));
+  (field++)->draw(String(memoryMonitor.getMinMaxBlock()));
+  (field++)->draw(String(memoryMonitor.getFragmentation()) + F("%"));
+  (field++)->draw(String(memoryMonitor.getMaxFragmentation()) + F("%"));
+
+  // Empty where there is no process or screen, or it never ran
+  int screens = min(ScreenFactory::getInstance()->getScreenCount(), MEMORY_MAX_SCREENS);
+  for (int i = 0; i < MEMORY_ROWS; i++)
+  {
+    MemoryStats *stats = i < profiler.count() ? &profiler.get(i).memory : NULL;
+    bool ran = stats != NULL && stats->runs > 0;
+    (field++)->draw(ran ? String(stats->lastPeak) : String());
+    (field++)->draw(ran ? String(stats->peak) : String());
+
+    stats = i < screens ? &memoryMonitor.getScreen(i) : NULL;
+    ran = stats != NULL && stats->runs > 0;
+    (field++)->draw(ran ? String(stats->peak) : String());
+  }
 }
 
 void ScreenStatus::deactivate()
@@ -165,6 +240,19 @@ void ScreenStatus::deactivate()
 
 bool ScreenStatus::onUserEvent(int event)
 {
+  if (event == GES_UP || event == GES_DOWN)
+  {
+    page = (page + (event == GES_UP ? 1 : PAGES - 1)) % PAGES;
+
+    // Wipe page below top bar and redraw it
+    LCD.fillRect(0, TOP_BAR_HEIGHT, 240, 320 - TOP_BAR_HEIGHT, TFT_BLACK);
+    drawLabels();
+    update();
+
+    // Event consumed
+    return true;
+  }
+
   return false;
 }
 
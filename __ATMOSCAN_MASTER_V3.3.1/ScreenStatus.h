@@ -8,6 +8,8 @@
 #pragma once
 
 #include "Screen.h"
+#include "TextField.h"
+#include "ProcessProfiler.h"
 
 // Screen Handler definition
 class ScreenStatus: public Screen
@@ -24,4 +26,21 @@ class ScreenStatus: public Screen
     virtual String getScreenName();
     virtual bool isFullScreen();
     virtual bool getRefreshWithScreenOff();
+
+  private:
+    // Swipe up/down cycles through system, process and memory page
+    enum Page { PAGE_SYSTEM, PAGE_PROCESSES, PAGE_MEMORY, PAGES };
+    int page = PAGE_SYSTEM;
+
+    // Values, one per line on the system page, one per column (and load) on the process page,
+    // lowest figures then high-water marks of processes and screens on the memory page
+    static const int SYSTEM_FIELDS = 16;
+    static const int PROCESS_COLUMNS = 5;
+    static const int MEMORY_ROWS = 10;
+    TextField fields[PROFILER_MAX_PROCESSES * PROCESS_COLUMNS + 1];
+
+    void drawLabels();
+    void updateSystem();
+    void updateProcesses();
+    void updateMemory();
 };
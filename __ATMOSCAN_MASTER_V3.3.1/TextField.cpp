@@ -0,0 +1,103 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#include "TextField.h"
+#include "Free_Fonts.h"
+
+// External variables
+extern TFT_eSPI LCD;
+
+void TextField::setPosition(int xpos, int ypos, uint8_t datum)
+{
+  this->xpos = xpos;
+  this->ypos = ypos;
+  this->datum = datum;
+  valid = false;
+}
+
+void TextField::draw(const String &text, uint16_t color)
+{
+  // Nothing changed, nothing to send
+  if (valid && color == this->color && text == this->text)
+    return;
+
+  // Characters in common with the previous text, at the beginning and at the end
+  // NOTE: a new colour redraws everything
+  unsigned int head = 0;
+  unsigned int tail = 0;
+  if (valid && color == this->color)
+  {
+    unsigned int length = min(text.length(), this->text.length());
+
+    while (head < length && text[head] == this->text[head])
+      head++;
+    while (tail < length - head && text[text.length() - 1 - tail] == this->text[this->text.length() - 1 - tail])
+      tail++;
+  }
+
+  String middle = text.substring(head, text.length() - tail);
+  int16_t headWidth = head ? LCD.textWidth(text.substring(0, head), GFXFF) : 0;
+  int16_t oldWidth = valid ? width : 0;
+
+  LCD.setTextColor(color, TFT_BLACK);
+  LCD.setTextDatum(TL_DATUM);
+
+  // Same width in the middle (e.g. digits): the end stays in place, only the middle is sent
+  if (tail > 0 && middle.length() > 0 &&
+      LCD.textWidth(middle, GFXFF) == LCD.textWidth(this->text.substring(head, this->text.length() - tail), GFXFF))
+  {
+    int16_t left = datum == TR_DATUM ? xpos - width + headWidth : xpos + headWidth;
+    LCD.drawString(middle, left, ypos, GFXFF);
+  }
+
+  // Left aligned: the beginning stays, the rest is redrawn and padded over the previous end
+  else if (datum != TR_DATUM)
+  {
+    String changed = text.substring(head);
+    int16_t drawn = 0;
+
+    if (changed.length() > 0)
+    {
+      LCD.setTextPadding(max(oldWidth - headWidth, 0));
+      drawn = LCD.drawString(changed, xpos + headWidth, ypos, GFXFF);
+      LCD.setTextPadding(0);
+    }
+    else if (oldWidth > headWidth)
+      LCD.fillRect(xpos + headWidth, ypos, oldWidth - headWidth, LCD.fontHeight(GFXFF), TFT_BLACK);
+
+    width = headWidth + drawn;
+  }
+
+  // Right aligned: the end stays, the rest is redrawn and padded over the previous beginning
+  else
+  {
+    String changed = text.substring(0, text.length() - tail);
+    int16_t tailWidth = tail ? LCD.textWidth(text.substring(text.length() - tail), GFXFF) : 0;
+    int16_t drawn = 0;
+
+    if (changed.length() > 0)
+    {
+      LCD.setTextDatum(TR_DATUM);
+      LCD.setTextPadding(max(oldWidth - tailWidth, 0));
+      drawn = LCD.drawString(changed, xpos - tailWidth, ypos, GFXFF);
+      LCD.setTextPadding(0);
+    }
+    else if (oldWidth > tailWidth)
+      LCD.fillRect(xpos - oldWidth, ypos, oldWidth - tailWidth, LCD.fontHeight(GFXFF), TFT_BLACK);
+
+    width = tailWidth + drawn;
+  }
+
+  this->text = text;
+  this->color = color;
+  valid = true;
+}
+
+void TextField::invalidate()
+{
+  valid = false;
+}
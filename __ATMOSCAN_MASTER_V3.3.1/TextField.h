@@ -0,0 +1,38 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <TFT_eSPI.h>             // https://github.com/Bodmer/TFT_eSPI
+
+// A line of text that remembers what it shows: drawing the same text and colour again
+// costs nothing, and a changed text only redraws from the first differing character
+// (last, if right aligned), erasing what is left of the previous one.
+// NOTE: drawn with the current font of the LCD, on black
+class TextField
+{
+  public:
+    TextField() {}
+
+    // TL_DATUM or TR_DATUM
+    void setPosition(int xpos, int ypos, uint8_t datum = TL_DATUM);
+
+    void draw(const String &text, uint16_t color = TFT_WHITE);
+
+    // Screen wiped: the next draw is complete
+    void invalidate();
+
+  private:
+    int16_t xpos = 0;
+    int16_t ypos = 0;
+    uint8_t datum = TL_DATUM;
+
+    String text;
+    uint16_t color = TFT_WHITE;
+    int16_t width = 0;                // Pixels
+    bool valid = false;
+};
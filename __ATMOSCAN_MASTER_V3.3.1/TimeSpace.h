@@ -8,7 +8,7 @@
 #pragma once
 
 #include "ESP8266WiFi.h"
-#include "JsonListener.h"
+#include "JsonTokenizer.h"
 #include "WsClient.h"
 
 
@@ -32,7 +32,7 @@ const char PROGMEM  geoCodeHost[] = "api.geonames.org";
 const char PROGMEM  geoCodeURL[] = "/findNearbyPlaceNameJSON?";
 
 
-class Timezone : public JsonListener, public WsClient
+class Timezone : public JsonHandler, public WsClient
 {
   public:
     Timezone()
@@ -51,10 +51,9 @@ class Timezone : public JsonListener, public WsClient
     };
 
     bool acquire(double latitude, double longitude);
-    virtual void whitespace(char c);
     virtual void startDocument();
-    virtual void key(String key);
-    virtual void value(String value);
+    virtual void key(uint32_t keyId, const char *key, uint16_t length);
+    virtual void value(char *value, uint16_t length);
     virtual void endArray();
     virtual void endObject();
     virtual void endDocument();
@@ -64,17 +63,18 @@ class Timezone : public JsonListener, public WsClient
     String getTimeZoneName();
     bool isDst();
     int getUtcOffset();
+    uint32_t getZoneEnd();
 
   private:
-    String currentKey;
-    String currentParent;
+    uint32_t currentKey = 0;
     bool dst;
     int utcOffset;
+    uint32_t zoneEnd = 0;                     // UTC, end of the current offset (DST change)
     String timeZoneId;
     String timeZoneName;
 };
 
-class Geolocate : public JsonListener, public WsClient
+class Geolocate : public JsonHandler, public WsClient
 {
   public:
     Geolocate() {
@@ -89,11 +89,11 @@ class Geolocate : public JsonListener, public WsClient
 #endif
     };
 
-    bool acquire();
-    virtual void whitespace(char c);
+    // From the networks of the last WiFi scan
+    bool acquire(int networks);
     virtual void startDocument();
-    virtual void key(String key);
-    virtual void value(String value);
+    virtual void key(uint32_t keyId, const char *key, uint16_t length);
+    virtual void value(char *value, uint16_t length);
     virtual void endArray();
     virtual void endObject();
     virtual void endDocument();
@@ -106,13 +106,12 @@ class Geolocate : public JsonListener, public WsClient
     String encodeBase64(char* bytes_to_encode, unsigned int in_len);
     double latitude    = 0.0;
     double longitude   = 0.0;
-    String currentKey;
-    String currentParent;
+    uint32_t currentKey = 0;
     String base64_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 };
 
 
-class Geocode : public JsonListener, public WsClient
+class Geocode : public JsonHandler, public WsClient
 {
   public:
     Geocode() {
@@ -133,10 +132,9 @@ class Geocode : public JsonListener, public WsClient
     String getCountryCode();
 
 
-    virtual void whitespace(char c);
     virtual void startDocument();
-    virtual void key(String key);
-    virtual void value(String value);
+    virtual void key(uint32_t keyId, const char *key, uint16_t length);
+    virtual void value(char *value, uint16_t length);
     virtual void endArray();
     virtual void endObject();
     virtual void endDocument();
@@ -144,7 +142,7 @@ class Geocode : public JsonListener, public WsClient
     virtual void startObject();
 
   private:
-    String currentKey;
+    uint32_t currentKey = 0;
     String locality;
     String country;
     String countryCode;
@@ -6,7 +6,6 @@
 /********************************************************/
 
 #include "ESP8266WiFi.h"
-#include <JsonStreamingParser.h> // https://github.com/squix78/json-streaming-parser
 #include "WsClient.h"
 #include "TimeSpace.h"
 #include <Syslog.h>
@@ -23,10 +22,6 @@ bool Timezone::acquire(double latitude, double longitude)
      Get Timezone from latitude and longitude
    **********************************************************/
 
-#ifdef DEBUG_SYSLOG
-  String myBuffer;
-#endif
-
   //Connect to the client and make the api call
   if (httpConnect())
   {
@@ -49,38 +44,13 @@ bool Timezone::acquire(double latitude, double longitude)
 
     if (httpGet(url) && skipResponseHeaders())
     {
-      JsonStreamingParser parser;
-      parser.setListener(this);
-      char c;
+      JsonTokenizer parser(this);
 
-      // Allow for slow server...
-      int retryCounter = 0;
-      while (!client.available())
+      // Bounded in time, a slow server does not hold the system
+      if (!readBody(parser))
       {
-        delay(1000);
-        retryCounter++;
-        if (retryCounter > 10)
-        {
-          return false;
-        }
-      }
-
-      while (client.available())
-      {
-        c = client.read();
-
-#ifdef DEBUG_SERIAL
-        Serial.print(c);
-#endif
-
-#ifdef DEBUG_SYSLOG
-        myBuffer = myBuffer + String(c);
-#endif
-
-        parser.parse(c);
-
-        // Improves reliability from ESP version 2.4.0
-        yield();
+        disconnect();
+        return false;
       }
     }
     else
@@ -89,6 +59,7 @@ bool Timezone::acquire(double latitude, double longitude)
 #ifdef DEBUG_SERIAL
       Serial.println("get failed");
 #endif
+      disconnect();
       return false;
     }
   }
@@ -103,19 +74,9 @@ bool Timezone::acquire(double latitude, double longitude)
 
   disconnect();
 
-#ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, String(F("RESPONSE = ")) + myBuffer);
-#endif
-
   return true;
 }
 
-void Timezone::whitespace(char c) {
-#ifdef DEBUG_SERIAL
-  Serial.println("whitespace");
-#endif
-}
-
 void Timezone::startDocument() {
 #ifdef DEBUG_SERIAL
   Serial.println("start document");
@@ -123,33 +84,40 @@ void Timezone::startDocument() {
 }
 
 
-void Timezone::key(String key) {
+void Timezone::key(uint32_t keyId, const char *, uint16_t) {
 #ifdef DEBUG_SERIAL
-  Serial.println("key: " + key);
+  Serial.println(String("key ID: ") + String(keyId, HEX));
 #endif
-  currentKey = String(key);
+  currentKey = keyId;
 }
 
-void Timezone::value(String value)
+void Timezone::value(char *value, uint16_t)
 {
 #ifdef DEBUG_SERIAL
-  Serial.println("value: " + value);
+  Serial.println(String("value: ") + value);
 #endif
-  if (currentKey == F("dst"))
-  {
-    dst = value.toInt();
-  }
-  else if (currentKey == F("gmtOffset"))
-  {
-    utcOffset = value.toInt();
-  }
-  else if (currentKey == F("abbreviation"))
-  {
-    timeZoneId = value;
-  }
-  else if (currentKey == F("zoneName"))
+
+  switch (currentKey)
   {
-    timeZoneName = value;
+    case jsonKey("dst"):
+      dst = atoi(value);
+      break;
+
+    case jsonKey("gmtOffset"):
+      utcOffset = atoi(value);
+      break;
+
+    case jsonKey("zoneEnd"):
+      zoneEnd = strtoul(value, NULL, 10);
+      break;
+
+    case jsonKey("abbreviation"):
+      timeZoneId = value;
+      break;
+
+    case jsonKey("zoneName"):
+      timeZoneName = value;
+      break;
   }
 }
 
@@ -202,3 +170,8 @@ int Timezone::getUtcOffset()
 {
   return utcOffset;
 }
+
+uint32_t Timezone::getZoneEnd()
+{
+  return zoneEnd;
+}
@@ -7,32 +7,202 @@
 
 
 #include "WsClient.h"
+#include "GlobalDefinitions.h"
 
+#ifdef DEBUG_SYSLOG
+#include <Syslog.h>
+extern Syslog syslog;
+#endif
+
+// External variables
+extern struct ProcessContainer procPtr;
+
+// Prototypes
+void errLog(String msg);
 
 const int httpPort = 80;
 
-// Skip HTTP headers so that we are at the beginning of the response's body
+// Read the status line and the headers, so that we are at the beginning of the response's body
 bool WsClient::skipResponseHeaders()
 {
-  bool outcome = false;
-  while (client.connected())
-  {
-    String line = client.readStringUntil('\n');
+  char line[WS_LINE_SIZE];
+
+  httpCode = 0;
+  remaining = -1;
+  chunked = false;
+  chunkEnded = false;
+  bodyEnded = false;
 
+  // Status line: HTTP/1.1 200 OK
+  if (!readLine(line, sizeof(line)))
+    return false;
+
+  if (strncmp(line, "HTTP/1.", 7) == 0 && strlen(line) >= 12)
+    httpCode = atoi(line + 9);
+
+  // Headers, up to the empty line
+  while (readLine(line, sizeof(line)))
+  {
 #ifdef DEBUG_LOG
-    Serial.println("HEADERS: " + line);
+    Serial.println(String("HEADERS: ") + line);
 #endif
 
-    if (line == F("\r"))
+    if (line[0] == '\0')
     {
+      if (httpCode != 200)
+      {
+        errLog(hostName + F(": HTTP code ") + String(httpCode));
+        return false;
+      }
+
 #ifdef DEBUG_LOG
       Serial.println(F("headers received"));
 #endif
-      outcome = true;
-      break;
+      return true;
+    }
+
+    if (strncasecmp(line, "Content-Length:", 15) == 0)
+      remaining = atol(line + 15);
+    else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0 && strstr(line + 18, "chunked"))
+      chunked = true;
+  }
+
+  return false;
+}
+
+
+// Read up to size bytes of the body, chunked or not, as they arrive
+// Returns the number of bytes read, 0 at the end of the body, -1 if it did not arrive in time
+int WsClient::read(uint8_t *buffer, size_t size)
+{
+  if (bodyEnded)
+    return 0;
+
+  // Between chunks: CRLF after the previous one, then the size of the next one in hex
+  if (chunked && remaining <= 0)
+  {
+    char line[WS_LINE_SIZE];
+
+    if (chunkEnded && !readLine(line, sizeof(line)))
+      return -1;
+
+    if (!readLine(line, sizeof(line)))
+      return -1;
+
+    remaining = strtol(line, NULL, 16);
+    chunkEnded = true;
+
+    // Last chunk, trailers are not used
+    if (remaining <= 0)
+    {
+      bodyEnded = true;
+      return 0;
+    }
+  }
+
+  // All of Content-Length received
+  if (remaining == 0)
+  {
+    bodyEnded = true;
+    return 0;
+  }
+
+  if (!waitData())
+  {
+    // Without length, the body ends with the connection
+    if (remaining < 0 && !client.connected())
+    {
+      bodyEnded = true;
+      return 0;
+    }
+    return -1;
+  }
+
+  size_t count = client.available();
+  if (count > size)
+    count = size;
+  if (remaining > 0 && count > (size_t)remaining)
+    count = remaining;
+
+  int received = client.read(buffer, count);
+  if (received > 0 && remaining > 0)
+    remaining -= received;
+
+  return received;
+}
+
+
+// Feed the whole body to a JSON tokenizer
+bool WsClient::readBody(JsonTokenizer &parser)
+{
+  uint8_t buffer[WS_BUFFER_SIZE];
+  int received;
+
+  while ((received = read(buffer, sizeof(buffer))) > 0)
+  {
+#ifdef DEBUG_SERIAL
+    Serial.write(buffer, received);
+#endif
+    parser.parse((const char *)buffer, received);
+  }
+
+  return received == 0;
+}
+
+
+// Wait for data until the deadline, letting the system run meanwhile
+bool WsClient::waitData()
+{
+  while (!client.available())
+  {
+    if (!client.connected())
+      return false;
+
+    if (millis() - requestTime > timeout)
+    {
+      errLog(hostName + F(": timeout"));
+      return false;
+    }
+
+    // Give up as soon as the user interacts, the caller will try again later
+    if (abortOnUserEvent && procPtr.UIManager.eventPending())
+    {
+#ifdef DEBUG_SYSLOG
+      syslog.log(LOG_DEBUG, hostName + F(": userEvent pending, aborting"));
+#endif
+      return false;
+    }
+
+    delay(WS_POLL);
+  }
+  return true;
+}
+
+
+// Read a line without its CRLF, truncated to size - 1 characters
+bool WsClient::readLine(char *line, size_t size)
+{
+  size_t length = 0;
+
+  while (waitData())
+  {
+    char c = client.read();
+
+    if (c == '\n')
+    {
+      // Strip the CR
+      if (length > 0 && line[length - 1] == '\r')
+        length--;
+      line[length] = '\0';
+      return true;
     }
+
+    if (length < size - 1)
+      line[length++] = c;
   }
-  return outcome;
+
+  line[length] = '\0';
+  return false;
 }
 
 
@@ -44,8 +214,11 @@ bool WsClient::httpConnect()
 
 
 // Send the HTTP GET request to the server
-bool WsClient::httpGet(String url)
+bool WsClient::httpGet(const String &url)
 {
+  // The deadline runs from here
+  requestTime = millis();
+
   client.print(F("GET "));
   client.print(url);
   client.println(F(" HTTP/1.1"));
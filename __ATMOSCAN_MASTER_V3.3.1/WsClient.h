@@ -8,6 +8,12 @@
 #pragma once
 
 #include "ESP8266WiFi.h"
+#include "JsonTokenizer.h"
+
+#define WS_TIMEOUT 5000           // ms allowed for a whole response, from the request
+#define WS_POLL 5                 // ms between polls while waiting for data
+#define WS_BUFFER_SIZE 128        // Bytes read from the socket at a time
+#define WS_LINE_SIZE 64           // Longest header line kept, longer ones are truncated
 
 class WsClient
 {
@@ -21,9 +27,29 @@ class WsClient
   public:
     String hostName;
     bool httpConnect();
-    bool httpGet(String resource);
+    bool httpGet(const String &resource);
     bool skipResponseHeaders();
+    int read(uint8_t *buffer, size_t size);
+    bool readBody(JsonTokenizer &parser);
     void disconnect();
 
     WiFiClient client;
+
+    // Whole response deadline, ms
+    unsigned long timeout = WS_TIMEOUT;
+
+    // Give up as soon as the user interacts (clients called by screens)
+    bool abortOnUserEvent = false;
+
+    int httpCode = 0;
+
+  private:
+    unsigned long requestTime = 0;
+    long remaining = -1;              // Body or chunk bytes left, -1 = until the server closes
+    bool chunked = false;
+    bool chunkEnded = false;          // The CRLF closing a chunk is still to be read
+    bool bodyEnded = false;
+
+    bool waitData();
+    bool readLine(char *line, size_t size);
 };
@@ -32,13 +32,16 @@
 
 // External variables
 extern Syslog syslog;
-extern WiFiClient wifiClient;
 
 bool usePM = false; // Set to true if you want to use AM/PM time disaply
 bool isPM = false; // JJG added ///////////
 
 WundergroundClient::WundergroundClient(bool _isMetric) {
   isMetric = _isMetric;
+  hostName = F("api.wunderground.com");
+
+  // Called by the screen: the user must not wait for the download
+  abortOnUserEvent = true;
 }
 
 // Added by fowlerk, 12/22/16, as an option to change metric setting other than at instantiation
@@ -110,11 +113,9 @@ bool WundergroundClient::doUpdate(String url)
 #endif
   url.replace(F(" "), F("%20"));
 
-  JsonStreamingParser parser;
-  parser.setListener(this);
+  JsonTokenizer parser(this);
 
-  const int httpPort = 80;
-  if (!wifiClient.connect(F("api.wunderground.com"), httpPort))
+  if (!httpConnect())
   {
 #ifdef DEBUG_SYSLOG
     syslog.log(LOG_DEBUG, F("connection failed"));
@@ -122,70 +123,33 @@ bool WundergroundClient::doUpdate(String url)
     return false;
   }
 
-  // This will send the request to the server
-  wifiClient.print(F("GET "));
-  wifiClient.print(url);
-  wifiClient.print(F(" HTTP/1.1\r\nHost: api.wunderground.com\r\nConnection: close\r\n\r\n"));
-
-  int retryCounter = 0;
-  while (!wifiClient.available())
-  {
-    delay(1000);
-    retryCounter++;
-    if (retryCounter > 10)
-    {
-#ifdef DEBUG_SYSLOG
-      syslog.log(LOG_DEBUG, F("Too many retries, giving up"));
-#endif
-      return false;
-    }
-  }
-
-  int pos = 0;
-  bool isBody = false;
-  char c;
-
-  int size = 0;
-  wifiClient.setNoDelay(false);
-  while (wifiClient.connected()) {
-    while ((size = wifiClient.available()) > 0) {
-      c = wifiClient.read();
-      //response +=c;
-      if (c == '{' || c == '[') {
-        isBody = true;
-      }
-      if (isBody)
-      {
-        parser.parse(c);
-      }
-    }
-  }
-  wifiClient.stop();
+  // Bounded in time, a slow server does not hold the UI
+  bool outcome = httpGet(url) && skipResponseHeaders() && readBody(parser);
+  disconnect();
 
 #ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, F("Job done"));
+  if (outcome)
+    syslog.log(LOG_DEBUG, F("Job done"));
+  else
+    syslog.log(LOG_DEBUG, F("No response, giving up"));
 #endif
 
-  return true;
+  return outcome;
 }
 
 
-void WundergroundClient::whitespace(char c) {
-  // #ifdef DEBUG_SERIAL Serial.println("whitespace");
-}
-
 void WundergroundClient::startDocument() {
   // #ifdef DEBUG_SERIAL Serial.println("start document");
 }
 
-void WundergroundClient::key(String key)
+void WundergroundClient::key(uint32_t keyId, const char *, uint16_t)
 {
 #ifdef DEBUG_SYSLOG
-  syslog.log(LOG_DEBUG, String(F("KEY =  ")) + key);
+  syslog.log(LOG_DEBUG, String(F("KEY ID =  ")) + String(keyId, HEX));
 #endif
 
 
-  currentKey = String(key);
+  currentKey = keyId;
 
   // #ifdef DEBUG_SERIAL Serial.println("Key = " + currentKey);
 
@@ -198,7 +162,7 @@ void WundergroundClient::key(String key)
   //	observations (current_observation), from the observations API call; or alerts (alerts), for the future) weather alerts API call.
 
   //    Added by MarcFinns 15 Feb 2017
-  if (currentKey == F("geolookup"))
+  if (currentKey == jsonKey("geolookup"))
   {
     isGeolookup = true;
     isForecast = false;
@@ -211,14 +175,14 @@ void WundergroundClient::key(String key)
 
 
   //		Added by fowlerk...18-Dec-2016
-  if (currentKey == F("txt_forecast")) {
+  if (currentKey == jsonKey("txt_forecast")) {
     isForecast = true;
     isGeolookup = false;
     isCurrentObservation = false;	// fowlerk
     isSimpleForecast = false;		// fowlerk
     //   isAlerts = false;				// fowlerk
   }
-  if (currentKey == F("simpleforecast")) {
+  if (currentKey == jsonKey("simpleforecast")) {
     isSimpleForecast = true;
     isGeolookup = false;
     isCurrentObservation = false;	// fowlerk
@@ -226,14 +190,14 @@ void WundergroundClient::key(String key)
     //   isAlerts = false;				// fowlerk
   }
   //  Added by fowlerk...
-  if (currentKey == F("current_observation")) {
+  if (currentKey == jsonKey("current_observation")) {
     isCurrentObservation = true;
     isGeolookup = false;
     isSimpleForecast = false;
     isForecast = false;
     //   isAlerts = false;
   }
-  if (currentKey == F("alerts")) {
+  if (currentKey == jsonKey("alerts")) {
     isCurrentObservation = false;
     isGeolookup = false;
     isSimpleForecast = false;
@@ -243,38 +207,38 @@ void WundergroundClient::key(String key)
   // end fowlerk add
 }
 
-void WundergroundClient::value(String value)
+void WundergroundClient::value(char *value, uint16_t)
 {
 #ifdef DEBUG_SYSLOG
   syslog.log(LOG_DEBUG, String(F("VALUE = ")) + value);
 #endif
 
   /*
-    if (currentKey == F("local_epoch"))
+    if (currentKey == jsonKey("local_epoch"))
     {
-    localEpoc = value.toInt();
+    localEpoc = atoi(value);
     localMillisAtUpdate = millis();
     }
   */
   // JJG added ... //////////////////////// search for keys /////////////////////////
-  if (currentKey == F("percentIlluminated"))
+  if (currentKey == jsonKey("percentIlluminated"))
   {
     moonPctIlum = value;
   }
 
-  if (currentKey == F("ageOfMoon"))
+  if (currentKey == jsonKey("ageOfMoon"))
   {
     moonAge = value;
   }
 
-  if (currentKey == F("phaseofMoon"))
+  if (currentKey == jsonKey("phaseofMoon"))
   {
     moonPhase = value;
   }
 
-  if (currentParent == F("sunrise")) {      // Has a Parent key and 2 sub-keys
-    if (currentKey == F("hour")) {
-      int tempHour = value.toInt();    // do this to concert to 12 hour time (make it a function!)
+  if (currentParent == jsonKey("sunrise")) {      // Has a Parent key and 2 sub-keys
+    if (currentKey == jsonKey("hour")) {
+      int tempHour = atoi(value);    // do this to concert to 12 hour time (make it a function!)
       if (usePM && tempHour > 12) {
         tempHour -= 12;
         isPM = true;
@@ -285,9 +249,9 @@ void WundergroundClient::value(String value)
       sunriseTime = String(tempHourBuff);				// fowlerk add for formatting, 12/22/16
       //sunriseTime = value;
     }
-    if (currentKey == F("minute")) {
+    if (currentKey == jsonKey("minute")) {
       char tempMinBuff[3] = "";						// fowlerk add for formatting, 12/22/16
-      sprintf(tempMinBuff, "%02d", value.toInt());	// fowlerk add for formatting, 12/22/16
+      sprintf(tempMinBuff, "%02d", atoi(value));	// fowlerk add for formatting, 12/22/16
       sunriseTime += ":" + String(tempMinBuff);		// fowlerk add for formatting, 12/22/16
       if (isPM) sunriseTime += F("pm");
       else if (usePM) sunriseTime += F("am");
@@ -295,9 +259,9 @@ void WundergroundClient::value(String value)
   }
 
 
-  if (currentParent == F("sunset")) {      // Has a Parent key and 2 sub-keys
-    if (currentKey == F("hour")) {
-      int tempHour = value.toInt();   // do this to concert to 12 hour time (make it a function!)
+  if (currentParent == jsonKey("sunset")) {      // Has a Parent key and 2 sub-keys
+    if (currentKey == jsonKey("hour")) {
+      int tempHour = atoi(value);   // do this to concert to 12 hour time (make it a function!)
       if (usePM && tempHour > 12) {
         tempHour -= 12;
         isPM = true;
@@ -308,18 +272,18 @@ void WundergroundClient::value(String value)
       sunsetTime = String(tempHourBuff);				// fowlerk add for formatting, 12/22/16
       // sunsetTime = value;
     }
-    if (currentKey == F("minute")) {
+    if (currentKey == jsonKey("minute")) {
       char tempMinBuff[3] = "";						// fowlerk add for formatting, 12/22/16
-      sprintf(tempMinBuff, "%02d", value.toInt());	// fowlerk add for formatting, 12/22/16
+      sprintf(tempMinBuff, "%02d", atoi(value));	// fowlerk add for formatting, 12/22/16
       sunsetTime += ":" + String(tempMinBuff);		// fowlerk add for formatting, 12/22/16
       if (isPM) sunsetTime += F("pm");
       else if (usePM) sunsetTime += F("am");
     }
   }
 
-  if (currentParent == F("moonrise")) {      // Has a Parent key and 2 sub-keys
-    if (currentKey == F("hour")) {
-      int tempHour = value.toInt();   // do this to concert to 12 hour time (make it a function!)
+  if (currentParent == jsonKey("moonrise")) {      // Has a Parent key and 2 sub-keys
+    if (currentKey == jsonKey("hour")) {
+      int tempHour = atoi(value);   // do this to concert to 12 hour time (make it a function!)
       if (usePM && tempHour > 12) {
         tempHour -= 12;
         isPM = true;
@@ -330,55 +294,55 @@ void WundergroundClient::value(String value)
       moonriseTime = String(tempHourBuff);			// fowlerk add for formatting, 12/22/16
       // moonriseTime = value;
     }
-    if (currentKey == F("minute")) {
+    if (currentKey == jsonKey("minute")) {
       char tempMinBuff[3] = "";						// fowlerk add for formatting, 12/22/16
-      sprintf(tempMinBuff, "%02d", value.toInt());	// fowlerk add for formatting, 12/22/16
+      sprintf(tempMinBuff, "%02d", atoi(value));	// fowlerk add for formatting, 12/22/16
       moonriseTime = moonriseTime + F(":") + String(tempMinBuff);		// fowlerk add for formatting, 12/22/16
       if (isPM) moonriseTime += F("pm");
       else if (usePM) moonriseTime += F("am");
     }
   }
 
-  if (currentParent == F("moonset")) {      // Not used - has a Parent key and 2 sub-keys
-    if (currentKey == F("hour")) {
+  if (currentParent == jsonKey("moonset")) {      // Not used - has a Parent key and 2 sub-keys
+    if (currentKey == jsonKey("hour")) {
       char tempHourBuff[3] = "";						// fowlerk add for formatting, 12/22/16
-      sprintf(tempHourBuff, "%2d", value.toInt());	// fowlerk add for formatting, 12/22/16
+      sprintf(tempHourBuff, "%2d", atoi(value));	// fowlerk add for formatting, 12/22/16
       moonsetTime = String(tempHourBuff);				// fowlerk add for formatting, 12/22/16
     }
-    if (currentKey == F("minute")) {
+    if (currentKey == jsonKey("minute")) {
       char tempMinBuff[3] = "";						// fowlerk add for formatting, 12/22/16
-      sprintf(tempMinBuff, "%02d", value.toInt());	// fowlerk add for formatting, 12/22/16
+      sprintf(tempMinBuff, "%02d", atoi(value));	// fowlerk add for formatting, 12/22/16
       moonsetTime = moonsetTime + F(":") + String(tempMinBuff);		// fowlerk add for formatting, 12/22/16
     }
   }
 
-  if (currentKey == F("wind_mph")) {
+  if (currentKey == jsonKey("wind_mph")) {
     windSpeed = value;
   }
 
-  if (currentKey == F("wind_dir")) {
+  if (currentKey == jsonKey("wind_dir")) {
     windDir = value;
   }
 
   // end JJG add  ////////////////////////////////////////////////////////////////////
   /*
-    if (currentKey == F("observation_time_rfc822")) {
+    if (currentKey == jsonKey("observation_time_rfc822")) {
       date = value.substring(0, 16);
     }
 
     // Begin add, fowlerk...04-Dec-2016
-    if (currentKey == F("observation_time")) {
+    if (currentKey == jsonKey("observation_time")) {
       observationTime = value;
     }
     // end add, fowlerk
   */
-  if (currentKey == F("temp_f") && !isMetric) {
+  if (currentKey == jsonKey("temp_f") && !isMetric) {
     currentTemp = value;
   }
-  if (currentKey == F("temp_c") && isMetric) {
+  if (currentKey == jsonKey("temp_c") && isMetric) {
     currentTemp = value;
   }
-  if (currentKey == F("icon")) {
+  if (currentKey == jsonKey("icon")) {
     if (isForecast && !isSimpleForecast &&  currentForecastPeriod < MAX_FORECAST_PERIODS) {
       // #ifdef DEBUG_SERIAL Serial.println(String(currentForecastPeriod) + ": " + value + ":" + currentParent);
       forecastIcon[currentForecastPeriod] = value;
@@ -388,59 +352,60 @@ void WundergroundClient::value(String value)
       weatherIcon = value;
     }
   }
-  if (currentKey == F("weather")) {
+  if (currentKey == jsonKey("weather")) {
     weatherText = value;
   }
 
   /*
-    if (currentKey == F("relative_humidity")) {
+    if (currentKey == jsonKey("relative_humidity")) {
     humidity = value;
     }
-    if (currentKey == F("pressure_mb") && isMetric) {
+    if (currentKey == jsonKey("pressure_mb") && isMetric) {
     pressure = value + "mb";
     }
-    if (currentKey == F("pressure_in") && !isMetric) {
+    if (currentKey == jsonKey("pressure_in") && !isMetric) {
     pressure = value + "in";
     }
     // fowlerk added...
-    if (currentKey == F("feelslike_f") && !isMetric) {
+    if (currentKey == jsonKey("feelslike_f") && !isMetric) {
     feelslike = value;
     }
 
-    if (currentKey == F("feelslike_c") && isMetric) {
+    if (currentKey == jsonKey("feelslike_c") && isMetric) {
     feelslike = value;
     }
 
-    if (currentKey == F("UV")) {
+    if (currentKey == jsonKey("UV")) {
       UV = value;
     }
     // Active alerts...added 18-Dec-2016
-    if (currentKey == F("type") && isAlerts) {
+    if (currentKey == jsonKey("type") && isAlerts) {
       activeAlertsCnt++;
       currentAlert++;
       activeAlerts[currentAlert - 1] = value;
       // #ifdef DEBUG_SERIAL Serial.print("Alert type processed, value:  "); // #ifdef DEBUG_SERIAL Serial.println(activeAlerts[currentAlert - 1]);
     }
 
-    if (currentKey == F("description") && isAlerts && isAlertUS) {
+    if (currentKey == jsonKey("description") && isAlerts && isAlertUS) {
       activeAlertsText[currentAlert - 1] = value;
       // #ifdef DEBUG_SERIAL Serial.print("Alert description processed, value:  "); // #ifdef DEBUG_SERIAL Serial.println(activeAlertsText[currentAlert - 1]);
     }
-    if (currentKey == F("wtype_meteoalarm_name") && isAlerts && isAlertEU) {
+    if (currentKey == jsonKey("wtype_meteoalarm_name") && isAlerts && isAlertEU) {
       activeAlertsText[currentAlert - 1] = value;
       // #ifdef DEBUG_SERIAL Serial.print("Alert description processed, value:  "); // #ifdef DEBUG_SERIAL Serial.println(activeAlertsText[currentAlert - 1]);
     }
-    if (currentKey == F("message") && isAlerts) {
+    if (currentKey == jsonKey("message") && isAlerts) {
       activeAlertsMessage[currentAlert - 1] = value;
       // #ifdef DEBUG_SERIAL Serial.print("Alert msg length:  "); // #ifdef DEBUG_SERIAL Serial.println(activeAlertsMessage[currentAlert - 1].length());
-      if (activeAlertsMessage[currentAlert - 1].length() >= 511) {
+      // Tokens longer than the tokenizer buffer arrive truncated to its size
+      if (activeAlertsMessage[currentAlert - 1].length() >= JSON_TOKEN_SIZE - 1) {
         activeAlertsMessageTrunc[currentAlert - 1] = true;
       } else {
         activeAlertsMessageTrunc[currentAlert - 1] = false;
       }
       // #ifdef DEBUG_SERIAL Serial.print("Alert message processed, value:  "); // #ifdef DEBUG_SERIAL Serial.println(activeAlertsMessage[currentAlert - 1]);
     }
-    if (currentKey == ("date") && isAlerts) {
+    if (currentKey == jsonKey("date") && isAlerts) {
       activeAlertsStart[currentAlert - 1] = value;
       // Check last char for a "/"; the returned value sometimes includes this; if so, strip it (47 is a "/" char)
       if (activeAlertsStart[currentAlert - 1].charAt(activeAlertsStart[currentAlert - 1].length() - 1) == 47) {
@@ -453,25 +418,25 @@ void WundergroundClient::value(String value)
       }
       // #ifdef DEBUG_SERIAL Serial.print("Alert start processed, value:  "); // #ifdef DEBUG_SERIAL Serial.println(activeAlertsStart[currentAlert - 1]);
     }
-    if (currentKey == F("expires") && isAlerts) {
+    if (currentKey == jsonKey("expires") && isAlerts) {
       activeAlertsEnd[currentAlert - 1] = value;
       // #ifdef DEBUG_SERIAL Serial.print("Alert expiration processed, value:  "); // #ifdef DEBUG_SERIAL Serial.println(activeAlertsEnd[currentAlert - 1]);
     }
-    if (currentKey == F("phenomena") && isAlerts) {
+    if (currentKey == jsonKey("phenomena") && isAlerts) {
       activeAlertsPhenomena[currentAlert - 1] = value;
       // #ifdef DEBUG_SERIAL Serial.print("Alert phenomena processed, value:  "); // #ifdef DEBUG_SERIAL Serial.println(activeAlertsPhenomena[currentAlert - 1]);
     }
-    if (currentKey == F("significance") && isAlerts && isAlertUS) {
+    if (currentKey == jsonKey("significance") && isAlerts && isAlertUS) {
       activeAlertsSignificance[currentAlert - 1] = value;
       // #ifdef DEBUG_SERIAL Serial.print("Alert significance processed, value:  "); // #ifdef DEBUG_SERIAL Serial.println(activeAlertsSignificance[currentAlert - 1]);
     }
     // Map meteoalarm level to the field for significance for consistency (used for European alerts)
-    if (currentKey == F("level_meteoalarm") && isAlerts && isAlertEU) {
+    if (currentKey == jsonKey("level_meteoalarm") && isAlerts && isAlertEU) {
       activeAlertsSignificance[currentAlert - 1] = value;
       // #ifdef DEBUG_SERIAL Serial.print("Meteo alert significance processed, value:  "); // #ifdef DEBUG_SERIAL Serial.println(activeAlertsSignificance[currentAlert - 1]);
     }
     // For meteoalarms only (European alerts); attribution must be displayed according to the T&C's of use
-    if (currentKey == F("attribution") && isAlerts) {
+    if (currentKey == jsonKey("attribution") && isAlerts) {
       activeAlertsAttribution[currentAlert - 1] = value;
       // Remove some of the markup in the attribution
       activeAlertsAttribution[currentAlert - 1].replace(" <a href='", " ");
@@ -481,45 +446,45 @@ void WundergroundClient::value(String value)
 
     // end fowlerk add
 
-    if (currentKey == F("dewpoint_f") && !isMetric) {
+    if (currentKey == jsonKey("dewpoint_f") && !isMetric) {
       dewPoint = value;
     }
-    if (currentKey == F("dewpoint_c") && isMetric) {
+    if (currentKey == jsonKey("dewpoint_c") && isMetric) {
       dewPoint = value;
     }
-    if (currentKey == F("precip_today_metric") && isMetric) {
+    if (currentKey == jsonKey("precip_today_metric") && isMetric) {
       precipitationToday = value + "mm";
     }
-    if (currentKey == F("precip_today_in") && !isMetric) {
+    if (currentKey == jsonKey("precip_today_in") && !isMetric) {
       precipitationToday = value + "in";
     }
   */
-  if (currentKey == F("period")) {
-    currentForecastPeriod = value.toInt();
+  if (currentKey == jsonKey("period")) {
+    currentForecastPeriod = atoi(value);
   }
   // Modified below line to add check to ensure we are processing the 10-day forecast
   // before setting the forecastTitle (day of week of the current forecast day).
   // (The keyword title is used in both the current observation and the 10-day forecast.)
   //		Modified by fowlerk
   // if (currentKey ==F("title") && currentForecastPeriod < MAX_FORECAST_PERIODS) {				// Removed, fowlerk
-  if (currentKey == F("title") && isForecast && currentForecastPeriod < MAX_FORECAST_PERIODS) {
+  if (currentKey == jsonKey("title") && isForecast && currentForecastPeriod < MAX_FORECAST_PERIODS) {
     // #ifdef DEBUG_SERIAL Serial.println(String(currentForecastPeriod) + ": " + value);
     forecastTitle[currentForecastPeriod] = value;
   }
 
   /*
     // Added forecastText key following...fowlerk, 12/3/16
-    if (currentKey == F("fcttext") && isForecast && !isMetric && currentForecastPeriod < MAX_FORECAST_PERIODS) {
+    if (currentKey == jsonKey("fcttext") && isForecast && !isMetric && currentForecastPeriod < MAX_FORECAST_PERIODS) {
       forecastText[currentForecastPeriod] = value;
     }
     // Added option for metric forecast following...fowlerk, 12/22/16
-    if (currentKey == F("fcttext_metric") && isForecast && isMetric && currentForecastPeriod < MAX_FORECAST_PERIODS) {
+    if (currentKey == jsonKey("fcttext_metric") && isForecast && isMetric && currentForecastPeriod < MAX_FORECAST_PERIODS) {
       forecastText[currentForecastPeriod] = value;
     }
     // end fowlerk add, 12/3/16
 
         // Added PoP (probability of precipitation) key following...fowlerk, 12/22/16
-        if (currentKey == F("pop") && isForecast && currentForecastPeriod < MAX_FORECAST_PERIODS) {
+        if (currentKey == jsonKey("pop") && isForecast && currentForecastPeriod < MAX_FORECAST_PERIODS) {
           PoP[currentForecastPeriod] = value;
         }
         // end fowlerk add, 12/22/16
@@ -528,29 +493,29 @@ void WundergroundClient::value(String value)
   // night and day, starting at index 1.
   int dailyForecastPeriod = (currentForecastPeriod - 1) * 2;
 
-  if (currentKey == F("fahrenheit") && !isMetric && dailyForecastPeriod < MAX_FORECAST_PERIODS) {
+  if (currentKey == jsonKey("fahrenheit") && !isMetric && dailyForecastPeriod < MAX_FORECAST_PERIODS) {
 
-    if (currentParent == F("high")) {
+    if (currentParent == jsonKey("high")) {
       forecastHighTemp[dailyForecastPeriod] = value;
     }
-    if (currentParent == F("low")) {
+    if (currentParent == jsonKey("low")) {
       forecastLowTemp[dailyForecastPeriod] = value;
     }
   }
-  if (currentKey == F("celsius") && isMetric && dailyForecastPeriod < MAX_FORECAST_PERIODS) {
+  if (currentKey == jsonKey("celsius") && isMetric && dailyForecastPeriod < MAX_FORECAST_PERIODS) {
 
-    if (currentParent == F("high")) {
+    if (currentParent == jsonKey("high")) {
       // #ifdef DEBUG_SERIAL Serial.println(String(currentForecastPeriod) + ": " + value);
       forecastHighTemp[dailyForecastPeriod] = value;
     }
-    if (currentParent == F("low")) {
+    if (currentParent == jsonKey("low")) {
       forecastLowTemp[dailyForecastPeriod] = value;
     }
   }
 
   /*
     // fowlerk added...to pull month/day from the forecast period
-    if (currentKey == F("month") && isSimpleForecast && currentForecastPeriod < MAX_FORECAST_PERIODS)
+    if (currentKey == jsonKey("month") && isSimpleForecast && currentForecastPeriod < MAX_FORECAST_PERIODS)
     {
     //	Added by fowlerk to handle transition from txtforecast to simpleforecast, as
     //	the key "period" doesn't appear until after some of the key values needed and is
@@ -563,7 +528,7 @@ void WundergroundClient::value(String value)
     }
 
 
-    if (currentKey == F("day") && isSimpleForecast && currentForecastPeriod < MAX_FORECAST_PERIODS)  {
+    if (currentKey == jsonKey("day") && isSimpleForecast && currentForecastPeriod < MAX_FORECAST_PERIODS)  {
     //	Added by fowlerk to handle transition from txtforecast to simpleforecast, as
     //	the key "period" doesn't appear until after some of the key values needed and is
     //	used as an array index.
@@ -576,17 +541,17 @@ void WundergroundClient::value(String value)
   */
 
   // MarcFinns mods
-  if (isGeolookup && currentParent == F("location" ))
+  if (isGeolookup && currentParent == jsonKey("location"))
   {
-    if (currentKey == F("country"))
+    if (currentKey == jsonKey("country"))
       country = value;
-    else if (currentKey == F("country_name"))
+    else if (currentKey == jsonKey("country_name"))
       country_name = value;
-    else if (currentKey == F("city"))
+    else if (currentKey == jsonKey("city"))
       city = value;
-    else if (currentKey == F("tz_short"))
+    else if (currentKey == jsonKey("tz_short"))
       tz_short = value;
-    else if (currentKey == F("tz_long"))
+    else if (currentKey == jsonKey("tz_long"))
       tz_long = value;
   }
   // end MarcFinns mods
@@ -610,7 +575,7 @@ void WundergroundClient::startObject()
 void WundergroundClient::endObject()
 {
   // #ifdef DEBUG_SERIAL Serial.println("end object. " + currentParent);
-  currentParent = FPSTR(empty);
+  currentParent = 0;
 }
 
 void WundergroundClient::endDocument()
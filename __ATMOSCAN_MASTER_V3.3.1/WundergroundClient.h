@@ -25,18 +25,19 @@
 
 #pragma once
 
-#include <JsonStreamingParser.h> // https://github.com/squix78/json-streaming-parser
+#include "JsonTokenizer.h"
+#include "WsClient.h"
 
 #define MAX_FORECAST_PERIODS 6  // Changed from 7 to 12 to support 6 day / 2 screen forecast (Neptune)
 // Changed to 20 to support max 10-day forecast returned from 'forecast10day' API (fowlerk)
 
 #define MAX_WEATHER_ALERTS 3  	 // The maximum number of concurrent weather alerts supported by the library
 
-class WundergroundClient: public JsonListener
+class WundergroundClient: public JsonHandler, public WsClient
 {
   private:
-    String currentKey;
-    String currentParent = "";
+    uint32_t currentKey = 0;
+    uint32_t currentParent = 0;
     long localEpoc = 0;
     int gmtOffset = 1;
     // long localMillisAtUpdate;
@@ -149,13 +150,11 @@ class WundergroundClient: public JsonListener
 
     // end MarcFinns mods
 
-    virtual void whitespace(char c);
-
     virtual void startDocument();
 
-    virtual void key(String key);
+    virtual void key(uint32_t keyId, const char *key, uint16_t length);
 
-    virtual void value(String value);
+    virtual void value(char *value, uint16_t length);
 
     virtual void endArray();
 
@@ -0,0 +1,59 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - OTA (no update ever arrives)      */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum
+{
+  OTA_AUTH_ERROR,
+  OTA_BEGIN_ERROR,
+  OTA_CONNECT_ERROR,
+  OTA_RECEIVE_ERROR,
+  OTA_END_ERROR
+} ota_error_t;
+
+class ArduinoOTAClass
+{
+  public:
+    typedef std::function<void(void)> THandlerFunction;
+    typedef std::function<void(ota_error_t)> THandlerFunction_Error;
+    typedef std::function<void(unsigned int, unsigned int)> THandlerFunction_Progress;
+
+    void setPort(uint16_t port) {}
+    void setHostname(const char *hostname) {}
+    void setPassword(const char *password) {}
+    void onStart(THandlerFunction fn)
+    {
+      startCallback = fn;
+    }
+    void onEnd(THandlerFunction fn)
+    {
+      endCallback = fn;
+    }
+    void onError(THandlerFunction_Error fn)
+    {
+      errorCallback = fn;
+    }
+    void onProgress(THandlerFunction_Progress fn)
+    {
+      progressCallback = fn;
+    }
+    void begin() {}
+    void handle() {}
+
+  private:
+    THandlerFunction startCallback;
+    THandlerFunction endCallback;
+    THandlerFunction_Error errorCallback;
+    THandlerFunction_Progress progressCallback;
+};
+
+extern ArduinoOTAClass ArduinoOTA;
@@ -0,0 +1,23 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - captive portal DNS                */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "ESP8266WiFi.h"
+
+class DNSServer
+{
+  public:
+    bool start(const uint16_t &port, const String &domainName, const IPAddress &resolvedIP)
+    {
+      return true;
+    }
+    void processNextRequest() {}
+    void stop() {}
+};
@@ -0,0 +1,61 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - HTTP client                       */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "ESP8266WiFi.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED  (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED  (-2)
+#define HTTPC_ERROR_CONNECTION_LOST     (-5)
+#define HTTPC_ERROR_NO_HTTP_SERVER      (-7)
+#define HTTPC_ERROR_READ_TIMEOUT        (-11)
+
+typedef enum
+{
+  HTTP_CODE_OK = 200,
+  HTTP_CODE_NOT_FOUND = 404
+} t_http_codes;
+
+// Minimal HTTP/1.1 GET client on top of the simulated WiFiClient
+class HTTPClient
+{
+  public:
+    bool begin(String url);
+    int GET();
+    int getSize()
+    {
+      return size;
+    }
+    bool connected()
+    {
+      return client.connected() || client.available();
+    }
+    WiFiClient *getStreamPtr()
+    {
+      return &client;
+    }
+    WiFiClient &getStream()
+    {
+      return client;
+    }
+    String getString();
+    void end()
+    {
+      client.stop();
+    }
+    static String errorToString(int error);
+
+  private:
+    WiFiClient client;
+    String host;
+    String path;
+    uint16_t port = 80;
+    int size = -1;
+};
@@ -0,0 +1,27 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - web server (never reached)        */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "ESP8266WiFi.h"
+
+class ESP8266WebServer
+{
+  public:
+    ESP8266WebServer(int port = 80) {}
+    void begin() {}
+    void handleClient() {}
+    void on(const String &uri, std::function<void(void)> handler) {}
+    void onNotFound(std::function<void(void)> handler) {}
+    void send(int code, const char *content_type = NULL, const String &content = String()) {}
+    String arg(const String &name)
+    {
+      return String();
+    }
+};
@@ -0,0 +1,311 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - ESP8266 WiFi stack                */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <deque>
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "Client.h"
+
+typedef enum
+{
+  WL_NO_SHIELD = 255,
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+// scanComplete() before results are available
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED (-2)
+
+typedef enum WiFiMode
+{
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2,
+  WIFI_AP_STA = 3
+} WiFiMode_t;
+
+typedef enum WiFiSleepType
+{
+  WIFI_NONE_SLEEP = 0,
+  WIFI_LIGHT_SLEEP = 1,
+  WIFI_MODEM_SLEEP = 2
+} WiFiSleepType_t;
+
+struct WiFiEventStationModeGotIP
+{
+  IPAddress ip;
+  IPAddress mask;
+  IPAddress gw;
+};
+
+struct WiFiEventStationModeDisconnected
+{
+  String ssid;
+  uint8_t bssid[6];
+  int reason;
+};
+
+class WiFiEventHandlerOpaque;
+typedef std::shared_ptr<WiFiEventHandlerOpaque> WiFiEventHandler;
+
+class ESP8266WiFiClass
+{
+  public:
+    WiFiMode_t getMode()
+    {
+      return wifiMode;
+    }
+    bool mode(WiFiMode_t m);
+    void persistent(bool) {}
+    bool setAutoConnect(bool)
+    {
+      return true;
+    }
+    bool setAutoReconnect(bool)
+    {
+      return true;
+    }
+
+    wl_status_t begin();
+    wl_status_t begin(const char *ssid, const char *passphrase = NULL, int32_t channel = 0, const uint8_t *bssid = NULL, bool connect = true);
+    bool config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1 = (uint32_t)0, IPAddress dns2 = (uint32_t)0);
+    bool disconnect(bool wifioff = false);
+    bool reconnect();
+    bool hostname(const String &name)
+    {
+      return true;
+    }
+    bool hostname(const char *name)
+    {
+      return true;
+    }
+    wl_status_t status();
+    bool isConnected()
+    {
+      return status() == WL_CONNECTED;
+    }
+
+    bool setSleepMode(WiFiSleepType_t type, uint8_t listenInterval = 0);
+    WiFiSleepType_t getSleepMode()
+    {
+      return sleepMode;
+    }
+    bool forceSleepBegin(uint32_t sleepUs = 0);
+    bool forceSleepWake();
+
+    String macAddress()
+    {
+      return F("5C:CF:7F:C0:FF:EE");
+    }
+    String SSID() const;
+    String psk() const;
+    uint8_t *BSSID();
+    String BSSIDstr();
+    int32_t channel();
+    int32_t RSSI();
+    IPAddress localIP();
+    IPAddress gatewayIP();
+    IPAddress subnetMask();
+    IPAddress dnsIP(uint8_t dns_no = 0);
+    int hostByName(const char *aHostname, IPAddress &aResult);
+    int hostByName(const char *aHostname, IPAddress &aResult, uint32_t timeout_ms)
+    {
+      return hostByName(aHostname, aResult);
+    }
+
+    int8_t scanNetworks(bool async = false, bool show_hidden = false);
+    int8_t scanComplete();
+    void scanDelete()
+    {
+      scanning = false;
+      scanResults = false;
+    }
+    String SSID(uint8_t networkItem);
+    uint8_t *BSSID(uint8_t networkItem);
+    String BSSIDstr(uint8_t networkItem);
+    int32_t RSSI(uint8_t networkItem);
+    int32_t channel(uint8_t networkItem);
+
+    WiFiEventHandler onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP &)> f);
+    WiFiEventHandler onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected &)> f);
+
+    // Simulation hooks
+    void simPoll();
+    uint64_t simNextEvent();
+    void simReport(FILE *out);
+
+  private:
+    WiFiMode_t wifiMode = WIFI_OFF;
+    WiFiSleepType_t sleepMode = WIFI_NONE_SLEEP;
+    bool linkUp = false;
+    bool started = false;
+    bool asleep = false;
+    bool staticIP = false;
+    uint64_t connectAt = 0;           // Simulated time the link comes up
+    bool scanning = false;
+    bool scanResults = false;
+    uint64_t scanDoneAt = 0;          // Simulated time an asynchronous scan completes
+    uint64_t dhcpAt = 0;              // Simulated time DHCP started on a connected link completes (0: none)
+    uint8_t bssid[6] = {0x00, 0x1A, 0x2B, 0x3C, 0x4D, 0x5E};
+    uint32_t associations = 0;
+    uint32_t renewals = 0;            // DHCP completed on a connected link
+    uint64_t radioOffMicros = 0;      // Forced sleep or WIFI_OFF
+    uint64_t modemSleepMicros = 0;    // Associated, sleeping between beacons
+    uint64_t accountedAt = 0;
+    void account();
+    std::vector<std::function<void(const WiFiEventStationModeGotIP &)>> gotIPHandlers;
+    std::vector<std::function<void(const WiFiEventStationModeDisconnected &)>> disconnectedHandlers;
+    void checkAssociation();
+    void associate(bool knownChannel);
+};
+
+extern ESP8266WiFiClass WiFi;
+
+// -------------------------------------------------------
+// TCP client - connects to canned responses in data/www
+// -------------------------------------------------------
+
+class WiFiClient : public Client
+{
+  public:
+    // Same default as the core (Stream default is 1s)
+    WiFiClient()
+    {
+      _timeout = 5000;
+    }
+    virtual ~WiFiClient() {}
+
+    virtual int connect(IPAddress ip, uint16_t port);
+    virtual int connect(const char *host, uint16_t port);
+    int connect(const String &host, uint16_t port)
+    {
+      return connect(host.c_str(), port);
+    }
+    int connect(const __FlashStringHelper *host, uint16_t port)
+    {
+      return connect(reinterpret_cast<const char *>(host), port);
+    }
+    virtual size_t write(uint8_t c);
+    virtual size_t write(const uint8_t *buf, size_t size);
+    using Print::write;
+    virtual int available();
+    size_t availableForWrite();
+    virtual int read();
+    virtual int read(uint8_t *buf, size_t size);
+    virtual int peek();
+    virtual void flush() {}
+    virtual void stop();
+    virtual uint8_t connected();
+    virtual operator bool()
+    {
+      return connected();
+    }
+    void setNoDelay(bool) {}
+    void setTimeout(unsigned long timeout)
+    {
+      Stream::setTimeout(timeout);
+    }
+
+  protected:
+    struct Connection
+    {
+      std::string host;
+      std::string request;
+      std::string response;
+      size_t readPos = 0;
+      bool requestComplete = false;
+      uint64_t firstByteAt = 0;
+    };
+    std::shared_ptr<Connection> conn;
+
+    // Bytes of the canned response that have "arrived" by now
+    size_t arrived();
+};
+
+namespace BearSSL
+{
+class WiFiClientSecure : public WiFiClient
+{
+  public:
+    // Adds the cost of the TLS handshake to the TCP connection
+    virtual int connect(const char *host, uint16_t port);
+    using WiFiClient::connect;
+    void setInsecure() {}
+    void setBufferSizes(int recv, int xmit) {}
+    void setFingerprint(const char *) {}
+};
+}
+
+typedef BearSSL::WiFiClientSecure WiFiClientSecure;
+
+// -------------------------------------------------------
+// UDP - datagrams are swallowed (syslog goes to stdout)
+// -------------------------------------------------------
+
+class WiFiUDP : public Stream
+{
+  public:
+    uint8_t begin(uint16_t port)
+    {
+      return 1;
+    }
+    void stop() {}
+    int beginPacket(const char *host, uint16_t port)
+    {
+      return 1;
+    }
+    int beginPacket(IPAddress ip, uint16_t port)
+    {
+      return 1;
+    }
+    int endPacket()
+    {
+      return 1;
+    }
+    int parsePacket()
+    {
+      return 0;
+    }
+    virtual size_t write(uint8_t)
+    {
+      return 1;
+    }
+    virtual size_t write(const uint8_t *, size_t size)
+    {
+      return size;
+    }
+    using Print::write;
+    virtual int available()
+    {
+      return 0;
+    }
+    virtual int read()
+    {
+      return -1;
+    }
+    int read(unsigned char *, size_t)
+    {
+      return 0;
+    }
+    virtual int peek()
+    {
+      return -1;
+    }
+    virtual void flush() {}
+};
+
+typedef WiFiUDP UDP;
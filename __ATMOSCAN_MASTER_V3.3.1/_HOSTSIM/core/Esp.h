@@ -0,0 +1,109 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - ESP class                         */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include "WString.h"
+
+enum FlashMode_t
+{
+  FM_QIO = 0x00,
+  FM_QOUT = 0x01,
+  FM_DIO = 0x02,
+  FM_DOUT = 0x03,
+  FM_UNKNOWN = 0xff
+};
+
+enum RFMode
+{
+  RF_DEFAULT = 0,
+  RF_CAL = 1,
+  RF_NO_CAL = 2,
+  RF_DISABLED = 4
+};
+
+class EspClass
+{
+  public:
+    // Heap figures come from the accounting allocator (see HostSim.cpp)
+    uint32_t getFreeHeap();
+    uint32_t getMaxFreeBlockSize();
+    uint8_t getHeapFragmentation();
+    void getHeapStats(uint32_t *free, uint16_t *max, uint8_t *frag);
+
+    void wdtEnable(uint32_t timeout_ms = 0) {}
+    void wdtDisable() {}
+    void wdtFeed() {}
+
+    void restart();
+    void reset();
+    void deepSleep(uint64_t time_us, RFMode mode = RF_DEFAULT);
+    bool eraseConfig()
+    {
+      return true;
+    }
+
+    uint32_t getChipId()
+    {
+      return 0x00C0FFEE;
+    }
+    uint32_t getFlashChipId()
+    {
+      return 0x001640E0;
+    }
+    uint32_t getFlashChipRealSize()
+    {
+      return 4194304;
+    }
+    uint32_t getFlashChipSize()
+    {
+      return 4194304;
+    }
+    uint32_t getFlashChipSpeed()
+    {
+      return 40000000;
+    }
+    FlashMode_t getFlashChipMode()
+    {
+      return FM_DIO;
+    }
+    uint8_t getCpuFreqMHz();
+    uint32_t getCycleCount();
+    uint16_t getVcc()
+    {
+      return 3300;
+    }
+    uint32_t getSketchSize()
+    {
+      return 600000;
+    }
+    uint32_t getFreeSketchSpace()
+    {
+      return 1400000;
+    }
+    String getResetReason()
+    {
+      return F("External System");
+    }
+    String getCoreVersion()
+    {
+      return F("host");
+    }
+    const char *getSdkVersion()
+    {
+      return "host";
+    }
+
+    // 512 bytes of user RTC memory, addressed in 4 byte blocks
+    bool rtcUserMemoryRead(uint32_t offset, uint32_t *data, size_t size);
+    bool rtcUserMemoryWrite(uint32_t offset, uint32_t *data, size_t size);
+};
+
+extern EspClass ESP;
@@ -0,0 +1,307 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - SPIFFS backed by a host directory */
+/*                                                      */
+/********************************************************/
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "FS.h"
+#include "HostSim.h"
+
+fs::FS SPIFFS;
+
+// Geometry of the 1MB SPIFFS partition of the 4M1M layout
+#define SIM_SPIFFS_TOTAL (1024 * 1024 - 4 * 8192)
+#define SIM_SPIFFS_BLOCK 8192
+#define SIM_SPIFFS_PAGE 256
+#define SIM_SPIFFS_MAX_PATH 32
+
+namespace fs
+{
+
+// SPIFFS has a flat namespace: '/' inside names is encoded on the host
+static std::string encodeName(const char *path)
+{
+  std::string out;
+  for (const char *p = path; *p; p++)
+  {
+    if (*p == '/')
+      out += p == path ? "" : "%2F";
+    else
+      out += *p;
+  }
+  return out;
+}
+
+static std::string decodeName(const std::string &name)
+{
+  std::string out = "/";
+  for (size_t i = 0; i < name.size(); i++)
+  {
+    if (name.compare(i, 3, "%2F") == 0)
+    {
+      out += '/';
+      i += 2;
+    }
+    else
+      out += name[i];
+  }
+  return out;
+}
+
+class FileImpl
+{
+  public:
+    FileImpl(FILE *f, const char *path) : f(f), path(path) {}
+    ~FileImpl()
+    {
+      close();
+    }
+    void close()
+    {
+      if (f)
+        fclose(f);
+      f = nullptr;
+    }
+    FILE *f;
+    std::string path;
+};
+
+class DirImpl
+{
+  public:
+    std::vector<std::string> names;
+    std::string root;
+    int index = -1;
+};
+
+std::string FS::hostPath(const char *path) const
+{
+  return root + "/" + encodeName(path);
+}
+
+bool FS::begin()
+{
+  mkdir(root.c_str(), 0755);
+  struct stat st;
+  return stat(root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+bool FS::format()
+{
+  Dir dir = openDir("/");
+  while (dir.next())
+    remove(dir.fileName());
+  return true;
+}
+
+bool FS::info(FSInfo &info)
+{
+  size_t used = 0;
+  Dir dir = openDir("/");
+  while (dir.next())
+  {
+    // Account for the object header page plus data pages
+    used += SIM_SPIFFS_PAGE + (dir.fileSize() + SIM_SPIFFS_PAGE - 1) / SIM_SPIFFS_PAGE * SIM_SPIFFS_PAGE;
+  }
+  info.totalBytes = SIM_SPIFFS_TOTAL;
+  info.usedBytes = std::min<size_t>(used, SIM_SPIFFS_TOTAL);
+  info.blockSize = SIM_SPIFFS_BLOCK;
+  info.pageSize = SIM_SPIFFS_PAGE;
+  info.maxOpenFiles = 5;
+  info.maxPathLength = SIM_SPIFFS_MAX_PATH;
+  return true;
+}
+
+File FS::open(const char *path, const char *mode)
+{
+  if (strlen(path) >= SIM_SPIFFS_MAX_PATH)
+    return File();
+
+  // SPIFFS modes map directly onto stdio ones, always binary
+  std::string m = mode;
+  m += 'b';
+  FILE *f = fopen(hostPath(path).c_str(), m.c_str());
+  if (!f)
+    return File();
+  return File(std::make_shared<FileImpl>(f, path));
+}
+
+bool FS::exists(const char *path)
+{
+  struct stat st;
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+Dir FS::openDir(const char *path)
+{
+  auto impl = std::make_shared<DirImpl>();
+  impl->root = root;
+  DIR *d = opendir(root.c_str());
+  if (d)
+  {
+    struct dirent *e;
+    while ((e = readdir(d)) != nullptr)
+    {
+      if (e->d_name[0] == '.')
+        continue;
+      std::string name = decodeName(e->d_name);
+      if (name.compare(0, strlen(path), path) == 0)
+        impl->names.push_back(name);
+    }
+    closedir(d);
+  }
+  std::sort(impl->names.begin(), impl->names.end());
+  return Dir(impl);
+}
+
+bool FS::remove(const char *path)
+{
+  return unlink(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char *pathFrom, const char *pathTo)
+{
+  if (exists(pathTo))
+    return false;
+  return ::rename(hostPath(pathFrom).c_str(), hostPath(pathTo).c_str()) == 0;
+}
+
+// -------------------------------------------------------
+// File
+// -------------------------------------------------------
+
+size_t File::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t File::write(const uint8_t *buf, size_t size)
+{
+  if (!impl || !impl->f)
+    return 0;
+  size_t n = fwrite(buf, 1, size, impl->f);
+
+  // SPIFFS write throughput (~60kB/s, page programming)
+  HostSim::busy(n * 50 / 3);
+  return n;
+}
+
+int File::available()
+{
+  if (!impl || !impl->f)
+    return 0;
+  return size() - position();
+}
+
+int File::read()
+{
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+size_t File::read(uint8_t *buf, size_t size)
+{
+  if (!impl || !impl->f)
+    return 0;
+  size_t n = fread(buf, 1, size, impl->f);
+
+  // SPIFFS read throughput (~400kB/s)
+  HostSim::busy(n * 10 / 4);
+  return n;
+}
+
+int File::peek()
+{
+  if (!impl || !impl->f)
+    return -1;
+  int c = fgetc(impl->f);
+  if (c != EOF)
+    ungetc(c, impl->f);
+  return c == EOF ? -1 : c;
+}
+
+void File::flush()
+{
+  if (impl && impl->f)
+    fflush(impl->f);
+}
+
+bool File::seek(uint32_t pos, SeekMode mode)
+{
+  if (!impl || !impl->f)
+    return false;
+  int whence = mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END;
+  return fseek(impl->f, pos, whence) == 0;
+}
+
+size_t File::position() const
+{
+  if (!impl || !impl->f)
+    return 0;
+  return ftell(impl->f);
+}
+
+size_t File::size() const
+{
+  if (!impl || !impl->f)
+    return 0;
+  fflush(impl->f);
+  struct stat st;
+  if (fstat(fileno(impl->f), &st) != 0)
+    return 0;
+  return st.st_size;
+}
+
+void File::close()
+{
+  if (impl)
+    impl->close();
+  impl.reset();
+}
+
+File::operator bool() const
+{
+  return impl && impl->f;
+}
+
+const char *File::name() const
+{
+  return impl ? impl->path.c_str() : "";
+}
+
+// -------------------------------------------------------
+// Dir
+// -------------------------------------------------------
+
+bool Dir::next()
+{
+  if (!impl)
+    return false;
+  return ++impl->index < (int)impl->names.size();
+}
+
+String Dir::fileName()
+{
+  if (!impl || impl->index < 0 || impl->index >= (int)impl->names.size())
+    return String();
+  return String(impl->names[impl->index].c_str());
+}
+
+size_t Dir::fileSize()
+{
+  File f = openFile("r");
+  return f.size();
+}
+
+File Dir::openFile(const char *mode)
+{
+  return SPIFFS.open(fileName(), mode);
+}
+
+} // namespace fs
@@ -0,0 +1,148 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - SPIFFS backed by a host directory */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <memory>
+#include "Arduino.h"
+
+namespace fs
+{
+
+enum SeekMode
+{
+  SeekSet = 0,
+  SeekCur = 1,
+  SeekEnd = 2
+};
+
+struct FSInfo
+{
+  size_t totalBytes;
+  size_t usedBytes;
+  size_t blockSize;
+  size_t pageSize;
+  size_t maxOpenFiles;
+  size_t maxPathLength;
+};
+
+class FileImpl;
+class DirImpl;
+
+class File : public Stream
+{
+  public:
+    File() {}
+    explicit File(std::shared_ptr<FileImpl> p) : impl(p) {}
+
+    // Print methods
+    virtual size_t write(uint8_t c);
+    virtual size_t write(const uint8_t *buf, size_t size);
+    using Print::write;
+
+    // Stream methods
+    virtual int available();
+    virtual int read();
+    virtual int peek();
+    virtual void flush();
+    size_t read(uint8_t *buf, size_t size);
+    size_t readBytes(char *buffer, size_t length)
+    {
+      return read((uint8_t *)buffer, length);
+    }
+
+    bool seek(uint32_t pos, SeekMode mode);
+    bool seek(uint32_t pos)
+    {
+      return seek(pos, SeekSet);
+    }
+    size_t position() const;
+    size_t size() const;
+    void close();
+    operator bool() const;
+    const char *name() const;
+
+  protected:
+    std::shared_ptr<FileImpl> impl;
+};
+
+class Dir
+{
+  public:
+    Dir() {}
+    explicit Dir(std::shared_ptr<DirImpl> p) : impl(p) {}
+
+    File openFile(const char *mode);
+    String fileName();
+    size_t fileSize();
+    bool next();
+
+  protected:
+    std::shared_ptr<DirImpl> impl;
+};
+
+class FS
+{
+  public:
+    bool begin();
+    void end() {}
+    bool format();
+    bool info(FSInfo &info);
+
+    File open(const char *path, const char *mode);
+    File open(const String &path, const char *mode)
+    {
+      return open(path.c_str(), mode);
+    }
+    bool exists(const char *path);
+    bool exists(const String &path)
+    {
+      return exists(path.c_str());
+    }
+    Dir openDir(const char *path);
+    Dir openDir(const String &path)
+    {
+      return openDir(path.c_str());
+    }
+    bool remove(const char *path);
+    bool remove(const String &path)
+    {
+      return remove(path.c_str());
+    }
+    bool rename(const char *pathFrom, const char *pathTo);
+    bool rename(const String &pathFrom, const String &pathTo)
+    {
+      return rename(pathFrom.c_str(), pathTo.c_str());
+    }
+
+    // Host directory holding the flash image contents
+    void setRoot(const std::string &dir)
+    {
+      root = dir;
+    }
+    std::string hostPath(const char *path) const;
+
+  private:
+    std::string root = "spiffs";
+};
+
+} // namespace fs
+
+#ifndef FS_NO_GLOBALS
+using fs::FS;
+using fs::File;
+using fs::Dir;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::FSInfo;
+#endif
+
+extern fs::FS SPIFFS;
@@ -0,0 +1,94 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - UART ports                        */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <deque>
+#include "Stream.h"
+
+// Peripheral attached to a simulated UART (see SimDevices.cpp)
+class SimSerialDevice
+{
+  public:
+    virtual ~SimSerialDevice() {}
+
+    // Called for every byte the firmware transmits
+    virtual void onReceive(uint8_t c) = 0;
+};
+
+// UART with baud rate accurate timing: bytes queued by the attached
+// device only become readable once they would have been clocked in
+class SimSerialPort : public Stream
+{
+  public:
+    void attach(SimSerialDevice *device)
+    {
+      this->device = device;
+    }
+
+    // Queue a device response, delivered after latencyMs
+    void reply(const uint8_t *data, size_t len, unsigned long latencyMs);
+
+    void begin(unsigned long baud)
+    {
+      this->baud = baud;
+    }
+    void end() {}
+
+    virtual int available();
+    virtual int read();
+    virtual int peek();
+    virtual size_t write(uint8_t c);
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    using Print::write;
+
+    operator bool() const
+    {
+      return true;
+    }
+
+  protected:
+    struct RxByte
+    {
+      uint8_t value;
+      unsigned long arrival;
+    };
+    std::deque<RxByte> rx;
+    SimSerialDevice *device = nullptr;
+    unsigned long baud = 9600;
+    unsigned long txBusyUntil = 0;
+    size_t rxCapacity = 256;        // Bytes beyond this are lost (overrun)
+    bool blockingTx = false;        // Bit banged ports hold the CPU while sending
+
+    // Time (us) needed to shift one 8N1 character at the current baud rate
+    unsigned long charTime() const
+    {
+      return 10000000UL / baud;
+    }
+    // Discards the input received so far
+    void dropRx();
+};
+
+class HardwareSerial : public SimSerialPort
+{
+  public:
+    HardwareSerial(int uart_nr) : uart(uart_nr) {}
+
+    // Waits for the transmission of outgoing data to complete
+    virtual void flush();
+
+    void swap() {}
+    void setDebugOutput(bool) {}
+
+  private:
+    int uart;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
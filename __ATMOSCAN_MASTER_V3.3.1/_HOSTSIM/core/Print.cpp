@@ -0,0 +1,264 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - Print & Stream                    */
+/*                                                      */
+/********************************************************/
+
+#include <stdarg.h>
+#include "Arduino.h"
+
+// -------------------------------------------------------
+// Print
+// -------------------------------------------------------
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--)
+  {
+    if (!write(*buffer++))
+      break;
+    n++;
+  }
+  return n;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  char buf[256];
+  va_list arg;
+  va_start(arg, format);
+  int len = vsnprintf(buf, sizeof(buf), format, arg);
+  va_end(arg);
+  if (len < 0)
+    return 0;
+  return write((const uint8_t *)buf, std::min<size_t>(len, sizeof(buf) - 1));
+}
+
+size_t Print::print(const __FlashStringHelper *ifsh)
+{
+  return write(reinterpret_cast<const char *>(ifsh));
+}
+
+size_t Print::print(const String &s)
+{
+  return write((const uint8_t *)s.c_str(), s.length());
+}
+
+size_t Print::print(const char str[])
+{
+  return write(str);
+}
+
+size_t Print::print(char c)
+{
+  return write((uint8_t)c);
+}
+
+size_t Print::print(unsigned char b, int base)
+{
+  return print(String(b, base));
+}
+
+size_t Print::print(int n, int base)
+{
+  return print(String(n, base));
+}
+
+size_t Print::print(unsigned int n, int base)
+{
+  return print(String(n, base));
+}
+
+size_t Print::print(long n, int base)
+{
+  return print(String(n, base));
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+  return print(String(n, base));
+}
+
+size_t Print::print(double n, int digits)
+{
+  return print(String(n, digits));
+}
+
+size_t Print::println(void)
+{
+  return write("\r\n");
+}
+
+size_t Print::println(const __FlashStringHelper *ifsh)
+{
+  return print(ifsh) + println();
+}
+
+size_t Print::println(const String &s)
+{
+  return print(s) + println();
+}
+
+size_t Print::println(const char str[])
+{
+  return print(str) + println();
+}
+
+size_t Print::println(char c)
+{
+  return print(c) + println();
+}
+
+size_t Print::println(unsigned char b, int base)
+{
+  return print(b, base) + println();
+}
+
+size_t Print::println(int n, int base)
+{
+  return print(n, base) + println();
+}
+
+size_t Print::println(unsigned int n, int base)
+{
+  return print(n, base) + println();
+}
+
+size_t Print::println(long n, int base)
+{
+  return print(n, base) + println();
+}
+
+size_t Print::println(unsigned long n, int base)
+{
+  return print(n, base) + println();
+}
+
+size_t Print::println(double n, int digits)
+{
+  return print(n, digits) + println();
+}
+
+// -------------------------------------------------------
+// Stream
+// -------------------------------------------------------
+
+int Stream::timedRead()
+{
+  unsigned long start = millis();
+  do
+  {
+    int c = read();
+    if (c >= 0)
+      return c;
+    delay(1);
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+int Stream::timedPeek()
+{
+  unsigned long start = millis();
+  do
+  {
+    int c = peek();
+    if (c >= 0)
+      return c;
+    delay(1);
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+bool Stream::find(const char *target)
+{
+  size_t len = strlen(target);
+  size_t index = 0;
+  if (!len)
+    return true;
+  int c;
+  while ((c = timedRead()) >= 0)
+  {
+    if (c == target[index])
+    {
+      if (++index >= len)
+        return true;
+    }
+    else
+      index = (c == target[0]) ? 1 : 0;
+  }
+  return false;
+}
+
+size_t Stream::readBytes(char *buffer, size_t length)
+{
+  size_t count = 0;
+  while (count < length)
+  {
+    int c = timedRead();
+    if (c < 0)
+      break;
+    *buffer++ = (char)c;
+    count++;
+  }
+  return count;
+}
+
+size_t Stream::readBytesUntil(char terminator, char *buffer, size_t length)
+{
+  size_t index = 0;
+  while (index < length)
+  {
+    int c = timedRead();
+    if (c < 0 || c == terminator)
+      break;
+    *buffer++ = (char)c;
+    index++;
+  }
+  return index;
+}
+
+String Stream::readString()
+{
+  String ret;
+  int c;
+  while ((c = timedRead()) >= 0)
+    ret += (char)c;
+  return ret;
+}
+
+String Stream::readStringUntil(char terminator)
+{
+  String ret;
+  int c;
+  while ((c = timedRead()) >= 0 && c != terminator)
+    ret += (char)c;
+  return ret;
+}
+
+long Stream::parseInt()
+{
+  int c;
+  bool negative = false;
+  long value = 0;
+
+  // Skip to first digit or sign
+  while ((c = timedPeek()) >= 0 && c != '-' && !isdigit(c))
+    read();
+  if (c < 0)
+    return 0;
+  if (c == '-')
+  {
+    negative = true;
+    read();
+  }
+  while ((c = timedPeek()) >= 0 && isdigit(c))
+  {
+    value = value * 10 + c - '0';
+    read();
+  }
+  return negative ? -value : value;
+}
@@ -0,0 +1,23 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - SPI (display traffic is modelled  */
+/*  inside the TFT_eSPI replacement)                    */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+class SPIClass
+{
+  public:
+    void begin() {}
+    void end() {}
+    void setFrequency(uint32_t) {}
+};
+
+extern SPIClass SPI;
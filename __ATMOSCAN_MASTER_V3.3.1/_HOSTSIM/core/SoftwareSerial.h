@@ -0,0 +1,39 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - espsoftwareserial                 */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+class SoftwareSerial : public SimSerialPort
+{
+  public:
+    SoftwareSerial(int receivePin, int transmitPin, bool inverse_logic = false, unsigned int buffSize = 64);
+    ~SoftwareSerial();
+
+    void enableIntTx(bool on) {}
+    void enableRx(bool on) {}
+    bool isValidGPIOpin(int pin)
+    {
+      return true;
+    }
+
+    // Like the 3.x espsoftwareserial, flush() discards pending input
+    virtual void flush()
+    {
+      dropRx();
+    }
+
+    // Lookup of the instance wired to a given RX pin (used by the simulator)
+    static SoftwareSerial *onPin(int receivePin);
+
+  private:
+    int rxPin;
+    unsigned int bufferSize;
+};
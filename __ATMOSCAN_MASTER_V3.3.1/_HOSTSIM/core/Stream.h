@@ -0,0 +1,47 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - Stream                            */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Print.h"
+
+class Stream : public Print
+{
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeout)
+    {
+      _timeout = timeout;
+    }
+    unsigned long getTimeout()
+    {
+      return _timeout;
+    }
+
+    bool find(const char *target);
+    virtual size_t readBytes(char *buffer, size_t length);
+    size_t readBytes(uint8_t *buffer, size_t length)
+    {
+      return readBytes((char *)buffer, length);
+    }
+    size_t readBytesUntil(char terminator, char *buffer, size_t length);
+    String readString();
+    String readStringUntil(char terminator);
+    long parseInt();
+
+  protected:
+    unsigned long _timeout = 1000;
+
+    // Waits (in simulated time) up to _timeout for the next character
+    int timedRead();
+    int timedPeek();
+};
@@ -0,0 +1,421 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - Arduino String                    */
+/*                                                      */
+/********************************************************/
+
+#include "Arduino.h"
+
+static std::string numberToString(unsigned long value, unsigned char base, bool negative)
+{
+  char buf[8 * sizeof(unsigned long) + 2];
+  char *p = &buf[sizeof(buf) - 1];
+  *p = '\0';
+  if (base < 2)
+    base = 10;
+  do
+  {
+    unsigned long digit = value % base;
+    *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    value /= base;
+  } while (value);
+  if (negative)
+    *--p = '-';
+  return std::string(p);
+}
+
+static std::string signedToString(long value, unsigned char base)
+{
+  if (base == 10 && value < 0)
+    return numberToString((unsigned long)(-value), base, true);
+  return numberToString((unsigned long)value, base, false);
+}
+
+static std::string floatToString(double value, unsigned char decimalPlaces)
+{
+  char buf[40];
+  dtostrf(value, decimalPlaces + 2, decimalPlaces, buf);
+  return std::string(buf);
+}
+
+String::String(const char *cstr) : s(cstr ? cstr : "") {}
+String::String(const __FlashStringHelper *str) : s(str ? reinterpret_cast<const char *>(str) : "") {}
+String::String(char c) : s(1, c) {}
+String::String(unsigned char value, unsigned char base) : s(numberToString(value, base, false)) {}
+String::String(int value, unsigned char base) : s(signedToString(value, base)) {}
+String::String(unsigned int value, unsigned char base) : s(numberToString(value, base, false)) {}
+String::String(long value, unsigned char base) : s(signedToString(value, base)) {}
+String::String(unsigned long value, unsigned char base) : s(numberToString(value, base, false)) {}
+String::String(float value, unsigned char decimalPlaces) : s(floatToString(value, decimalPlaces)) {}
+String::String(double value, unsigned char decimalPlaces) : s(floatToString(value, decimalPlaces)) {}
+
+String &String::operator =(const char *cstr)
+{
+  s = cstr ? cstr : "";
+  return *this;
+}
+
+String &String::operator =(const __FlashStringHelper *str)
+{
+  s = str ? reinterpret_cast<const char *>(str) : "";
+  return *this;
+}
+
+unsigned char String::reserve(unsigned int size)
+{
+  s.reserve(size);
+  return 1;
+}
+
+unsigned char String::concat(const String &str)
+{
+  s += str.s;
+  return 1;
+}
+
+unsigned char String::concat(const char *cstr)
+{
+  if (!cstr)
+    return 0;
+  s += cstr;
+  return 1;
+}
+
+unsigned char String::concat(const char *cstr, unsigned int length)
+{
+  if (!cstr)
+    return 0;
+  s.append(cstr, length);
+  return 1;
+}
+
+unsigned char String::concat(char c)
+{
+  s += c;
+  return 1;
+}
+
+unsigned char String::concat(unsigned char num)
+{
+  return concat(String(num));
+}
+
+unsigned char String::concat(int num)
+{
+  return concat(String(num));
+}
+
+unsigned char String::concat(unsigned int num)
+{
+  return concat(String(num));
+}
+
+unsigned char String::concat(long num)
+{
+  return concat(String(num));
+}
+
+unsigned char String::concat(unsigned long num)
+{
+  return concat(String(num));
+}
+
+unsigned char String::concat(float num)
+{
+  return concat(String(num));
+}
+
+unsigned char String::concat(double num)
+{
+  return concat(String(num));
+}
+
+unsigned char String::concat(const __FlashStringHelper *str)
+{
+  return concat(reinterpret_cast<const char *>(str));
+}
+
+int String::compareTo(const String &str) const
+{
+  return s.compare(str.s);
+}
+
+unsigned char String::equals(const String &str) const
+{
+  return s == str.s;
+}
+
+unsigned char String::equals(const char *cstr) const
+{
+  return s == (cstr ? cstr : "");
+}
+
+unsigned char String::equalsIgnoreCase(const String &str) const
+{
+  if (s.length() != str.s.length())
+    return 0;
+  for (size_t i = 0; i < s.length(); i++)
+    if (tolower((unsigned char)s[i]) != tolower((unsigned char)str.s[i]))
+      return 0;
+  return 1;
+}
+
+unsigned char String::startsWith(const String &prefix) const
+{
+  return startsWith(prefix, 0);
+}
+
+unsigned char String::startsWith(const String &prefix, unsigned int offset) const
+{
+  if (offset > s.length() || prefix.s.length() > s.length() - offset)
+    return 0;
+  return s.compare(offset, prefix.s.length(), prefix.s) == 0;
+}
+
+unsigned char String::endsWith(const String &suffix) const
+{
+  if (suffix.s.length() > s.length())
+    return 0;
+  return s.compare(s.length() - suffix.s.length(), suffix.s.length(), suffix.s) == 0;
+}
+
+char String::charAt(unsigned int index) const
+{
+  return index < s.length() ? s[index] : 0;
+}
+
+void String::setCharAt(unsigned int index, char c)
+{
+  if (index < s.length())
+    s[index] = c;
+}
+
+char String::operator [](unsigned int index) const
+{
+  return charAt(index);
+}
+
+char &String::operator [](unsigned int index)
+{
+  static char dummy;
+  if (index >= s.length())
+  {
+    dummy = 0;
+    return dummy;
+  }
+  return s[index];
+}
+
+void String::getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index) const
+{
+  if (!bufsize || !buf)
+    return;
+  if (index >= s.length())
+  {
+    buf[0] = 0;
+    return;
+  }
+  unsigned int n = std::min<unsigned int>(bufsize - 1, s.length() - index);
+  memcpy(buf, s.data() + index, n);
+  buf[n] = 0;
+}
+
+void String::toCharArray(char *buf, unsigned int bufsize, unsigned int index) const
+{
+  getBytes((unsigned char *)buf, bufsize, index);
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const
+{
+  size_t pos = s.find(ch, fromIndex);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String &str, unsigned int fromIndex) const
+{
+  size_t pos = s.find(str.s, fromIndex);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char ch) const
+{
+  size_t pos = s.rfind(ch);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char ch, unsigned int fromIndex) const
+{
+  size_t pos = s.rfind(ch, fromIndex);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(const String &str) const
+{
+  size_t pos = s.rfind(str.s);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(const String &str, unsigned int fromIndex) const
+{
+  size_t pos = s.rfind(str.s, fromIndex);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int beginIndex) const
+{
+  return substring(beginIndex, s.length());
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const
+{
+  if (beginIndex > endIndex)
+    std::swap(beginIndex, endIndex);
+  String out;
+  if (beginIndex >= s.length())
+    return out;
+  if (endIndex > s.length())
+    endIndex = s.length();
+  out.s = s.substr(beginIndex, endIndex - beginIndex);
+  return out;
+}
+
+void String::replace(char find, char replace)
+{
+  std::replace(s.begin(), s.end(), find, replace);
+}
+
+void String::replace(const String &find, const String &replace)
+{
+  if (find.s.empty())
+    return;
+  size_t pos = 0;
+  while ((pos = s.find(find.s, pos)) != std::string::npos)
+  {
+    s.replace(pos, find.s.length(), replace.s);
+    pos += replace.s.length();
+  }
+}
+
+void String::remove(unsigned int index)
+{
+  if (index < s.length())
+    s.erase(index);
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+  if (index < s.length())
+    s.erase(index, count);
+}
+
+void String::toLowerCase()
+{
+  for (auto &c : s)
+    c = tolower((unsigned char)c);
+}
+
+void String::toUpperCase()
+{
+  for (auto &c : s)
+    c = toupper((unsigned char)c);
+}
+
+void String::trim()
+{
+  size_t first = s.find_first_not_of(" \t\r\n\f\v");
+  if (first == std::string::npos)
+  {
+    s.clear();
+    return;
+  }
+  size_t last = s.find_last_not_of(" \t\r\n\f\v");
+  s = s.substr(first, last - first + 1);
+}
+
+long String::toInt() const
+{
+  return atol(s.c_str());
+}
+
+float String::toFloat() const
+{
+  return atof(s.c_str());
+}
+
+double String::toDouble() const
+{
+  return atof(s.c_str());
+}
+
+String operator +(const String &lhs, const String &rhs)
+{
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator +(const String &lhs, const char *rhs)
+{
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator +(const char *lhs, const String &rhs)
+{
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator +(const String &lhs, const __FlashStringHelper *rhs)
+{
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator +(const String &lhs, char rhs)
+{
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator +(const String &lhs, unsigned char rhs)
+{
+  return lhs + String(rhs);
+}
+
+String operator +(const String &lhs, int rhs)
+{
+  return lhs + String(rhs);
+}
+
+String operator +(const String &lhs, unsigned int rhs)
+{
+  return lhs + String(rhs);
+}
+
+String operator +(const String &lhs, long rhs)
+{
+  return lhs + String(rhs);
+}
+
+String operator +(const String &lhs, unsigned long rhs)
+{
+  return lhs + String(rhs);
+}
+
+String operator +(const String &lhs, float rhs)
+{
+  return lhs + String(rhs);
+}
+
+String operator +(const String &lhs, double rhs)
+{
+  return lhs + String(rhs);
+}
@@ -0,0 +1,172 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - Arduino String                    */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <string>
+#include <stdint.h>
+
+class __FlashStringHelper;
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper *>(pstr_pointer))
+#define F(string_literal) (FPSTR(string_literal))
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+// Arduino compatible String, backed by std::string so that every
+// allocation goes through the (heap accounted) global operator new
+class String
+{
+  public:
+    String(const char *cstr = "");
+    String(const String &str) = default;
+    String(String &&str) = default;
+    String(const __FlashStringHelper *str);
+    explicit String(char c);
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(float value, unsigned char decimalPlaces = 2);
+    explicit String(double value, unsigned char decimalPlaces = 2);
+
+    String &operator =(const String &rhs) = default;
+    String &operator =(String &&rhs) = default;
+    String &operator =(const char *cstr);
+    String &operator =(const __FlashStringHelper *str);
+
+    unsigned char reserve(unsigned int size);
+    unsigned int length() const
+    {
+      return s.length();
+    }
+    const char *c_str() const
+    {
+      return s.c_str();
+    }
+
+    // Concatenation
+    unsigned char concat(const String &str);
+    unsigned char concat(const char *cstr);
+    unsigned char concat(const char *cstr, unsigned int length);
+    unsigned char concat(char c);
+    unsigned char concat(unsigned char num);
+    unsigned char concat(int num);
+    unsigned char concat(unsigned int num);
+    unsigned char concat(long num);
+    unsigned char concat(unsigned long num);
+    unsigned char concat(float num);
+    unsigned char concat(double num);
+    unsigned char concat(const __FlashStringHelper *str);
+
+    template <typename T> String &operator +=(const T &rhs)
+    {
+      concat(rhs);
+      return *this;
+    }
+    String &operator +=(const char *cstr)
+    {
+      concat(cstr);
+      return *this;
+    }
+
+    // Comparison
+    int compareTo(const String &str) const;
+    unsigned char equals(const String &str) const;
+    unsigned char equals(const char *cstr) const;
+    unsigned char equalsIgnoreCase(const String &str) const;
+    unsigned char startsWith(const String &prefix) const;
+    unsigned char startsWith(const String &prefix, unsigned int offset) const;
+    unsigned char endsWith(const String &suffix) const;
+
+    unsigned char operator ==(const String &rhs) const
+    {
+      return equals(rhs);
+    }
+    unsigned char operator ==(const char *cstr) const
+    {
+      return equals(cstr);
+    }
+    unsigned char operator ==(const __FlashStringHelper *rhs) const
+    {
+      return equals(String(rhs));
+    }
+    unsigned char operator !=(const String &rhs) const
+    {
+      return !equals(rhs);
+    }
+    unsigned char operator !=(const char *cstr) const
+    {
+      return !equals(cstr);
+    }
+    unsigned char operator !=(const __FlashStringHelper *rhs) const
+    {
+      return !equals(String(rhs));
+    }
+    unsigned char operator <(const String &rhs) const
+    {
+      return compareTo(rhs) < 0;
+    }
+    unsigned char operator >(const String &rhs) const
+    {
+      return compareTo(rhs) > 0;
+    }
+
+    // Character access
+    char charAt(unsigned int index) const;
+    void setCharAt(unsigned int index, char c);
+    char operator [](unsigned int index) const;
+    char &operator [](unsigned int index);
+    void getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index = 0) const;
+    void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const;
+
+    // Search
+    int indexOf(char ch, unsigned int fromIndex = 0) const;
+    int indexOf(const String &str, unsigned int fromIndex = 0) const;
+    int lastIndexOf(char ch) const;
+    int lastIndexOf(char ch, unsigned int fromIndex) const;
+    int lastIndexOf(const String &str) const;
+    int lastIndexOf(const String &str, unsigned int fromIndex) const;
+    String substring(unsigned int beginIndex) const;
+    String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+    // Modification
+    void replace(char find, char replace);
+    void replace(const String &find, const String &replace);
+    void remove(unsigned int index);
+    void remove(unsigned int index, unsigned int count);
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+
+    // Parsing
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+
+  private:
+    std::string s;
+};
+
+// Concatenation operators (Arduino's StringSumHelper equivalents)
+String operator +(const String &lhs, const String &rhs);
+String operator +(const String &lhs, const char *rhs);
+String operator +(const char *lhs, const String &rhs);
+String operator +(const String &lhs, const __FlashStringHelper *rhs);
+String operator +(const String &lhs, char rhs);
+String operator +(const String &lhs, unsigned char rhs);
+String operator +(const String &lhs, int rhs);
+String operator +(const String &lhs, unsigned int rhs);
+String operator +(const String &lhs, long rhs);
+String operator +(const String &lhs, unsigned long rhs);
+String operator +(const String &lhs, float rhs);
+String operator +(const String &lhs, double rhs);
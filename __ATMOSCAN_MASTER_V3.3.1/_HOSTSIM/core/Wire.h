@@ -0,0 +1,54 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - I2C bus                           */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+// Only address probing is modelled: the I2C sensors themselves are
+// replaced by replaying drivers (see libraries/)
+class TwoWire : public Stream
+{
+  public:
+    void begin(int sda, int scl) {}
+    void begin() {}
+    void setClock(uint32_t) {}
+    void beginTransmission(uint8_t address)
+    {
+      txAddress = address;
+    }
+    uint8_t endTransmission(bool sendStop = true);
+    uint8_t requestFrom(uint8_t address, uint8_t quantity)
+    {
+      return 0;
+    }
+
+    virtual size_t write(uint8_t)
+    {
+      return 1;
+    }
+    using Print::write;
+    virtual int available()
+    {
+      return 0;
+    }
+    virtual int read()
+    {
+      return -1;
+    }
+    virtual int peek()
+    {
+      return -1;
+    }
+
+  private:
+    uint8_t txAddress = 0;
+};
+
+extern TwoWire Wire;
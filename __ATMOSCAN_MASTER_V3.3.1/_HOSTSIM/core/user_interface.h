@@ -0,0 +1,39 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - ESP8266 NONOS SDK subset          */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+
+enum sleep_type
+{
+  NONE_SLEEP_T = 0,
+  LIGHT_SLEEP_T,
+  MODEM_SLEEP_T
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool system_update_cpu_freq(uint8 freq);
+uint8 system_get_cpu_freq(void);
+uint32 system_get_time(void);
+
+bool wifi_set_sleep_type(enum sleep_type type);
+enum sleep_type wifi_get_sleep_type(void);
+
+#ifdef __cplusplus
+}
+#endif
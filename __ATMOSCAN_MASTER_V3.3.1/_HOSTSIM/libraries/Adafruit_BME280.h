@@ -0,0 +1,48 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - Adafruit BME280 driver            */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "HostSim.h"
+
+class Adafruit_BME280
+{
+  public:
+    bool begin(uint8_t addr = 0x77)
+    {
+      _address = addr;
+      // Chip ID, reset, calibration readout (~40 bytes)
+      HostSim::i2cTransfer(48);
+      delay(300);
+      return HostSim::i2cPresent(addr);
+    }
+
+    // Normal mode: every reading is a burst read of the data registers
+    float readTemperature()
+    {
+      HostSim::i2cTransfer(5);
+      return HostSim::sample().temperature + 1.2f;   // Self heating of the module
+    }
+    float readPressure()
+    {
+      readTemperature();
+      HostSim::i2cTransfer(5);
+      return HostSim::sample().pressure * 100.0f;
+    }
+    float readHumidity()
+    {
+      readTemperature();
+      HostSim::i2cTransfer(4);
+      return HostSim::sample().humidity - 2.5f;
+    }
+
+  private:
+    uint8_t _address = 0x77;
+};
@@ -0,0 +1,350 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - ArduinoJson 5 (flat objects)      */
+/*                                                      */
+/********************************************************/
+
+#include "ArduinoJson.h"
+
+// -------------------------------------------------------
+// Subscript
+// -------------------------------------------------------
+
+JsonObjectSubscript &JsonObjectSubscript::operator=(const char *value)
+{
+  auto &m = _object.slot(_key);
+  m.value = value ? value : "";
+  m.quoted = value != nullptr;
+  if (!value)
+    m.value = "null";
+  return *this;
+}
+
+JsonObjectSubscript &JsonObjectSubscript::operator=(long value)
+{
+  auto &m = _object.slot(_key);
+  m.value = std::to_string(value);
+  m.quoted = false;
+  return *this;
+}
+
+JsonObjectSubscript &JsonObjectSubscript::operator=(double value)
+{
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%g", value);
+  auto &m = _object.slot(_key);
+  m.value = buf;
+  m.quoted = false;
+  return *this;
+}
+
+JsonObjectSubscript &JsonObjectSubscript::operator=(bool value)
+{
+  auto &m = _object.slot(_key);
+  m.value = value ? "true" : "false";
+  m.quoted = false;
+  return *this;
+}
+
+JsonObjectSubscript::operator const char *() const
+{
+  auto m = _object.find(_key.c_str());
+  return m ? m->value.c_str() : nullptr;
+}
+
+bool JsonObjectSubscript::success() const
+{
+  return _object.find(_key.c_str()) != nullptr;
+}
+
+// -------------------------------------------------------
+// Object
+// -------------------------------------------------------
+
+JsonObject &JsonObject::invalid()
+{
+  static JsonObject object;
+  object._success = false;
+  object._members.clear();
+  return object;
+}
+
+const JsonObject::Member *JsonObject::find(const char *key) const
+{
+  for (auto &m : _members)
+    if (m.key == key)
+      return &m;
+  return nullptr;
+}
+
+JsonObject::Member &JsonObject::slot(const std::string &key)
+{
+  for (auto &m : _members)
+    if (m.key == key)
+      return m;
+  _members.push_back({key, "", false});
+  return _members.back();
+}
+
+bool JsonObject::remove(const char *key)
+{
+  for (auto it = _members.begin(); it != _members.end(); ++it)
+    if (it->key == key)
+    {
+      _members.erase(it);
+      return true;
+    }
+  return false;
+}
+
+static void appendEscaped(std::string &out, const std::string &s)
+{
+  out += '"';
+  for (char c : s)
+  {
+    switch (c)
+    {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\r':
+        out += "\\r";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default:
+        out += c;
+    }
+  }
+  out += '"';
+}
+
+std::string JsonObject::serialize() const
+{
+  std::string out = "{";
+  for (size_t i = 0; i < _members.size(); i++)
+  {
+    if (i)
+      out += ',';
+    appendEscaped(out, _members[i].key);
+    out += ':';
+    if (_members[i].quoted)
+      appendEscaped(out, _members[i].value);
+    else
+      out += _members[i].value;
+  }
+  out += '}';
+  return out;
+}
+
+size_t JsonObject::printTo(Print &out) const
+{
+  std::string s = serialize();
+  return out.write((const uint8_t *)s.data(), s.size());
+}
+
+size_t JsonObject::printTo(char *buffer, size_t size) const
+{
+  std::string s = serialize();
+  if (!size)
+    return 0;
+  size_t n = std::min(s.size(), size - 1);
+  memcpy(buffer, s.data(), n);
+  buffer[n] = 0;
+  return n;
+}
+
+size_t JsonObject::printTo(String &out) const
+{
+  std::string s = serialize();
+  out += s.c_str();
+  return s.size();
+}
+
+size_t JsonObject::measureLength() const
+{
+  return serialize().size();
+}
+
+// -------------------------------------------------------
+// Buffer / parser
+// -------------------------------------------------------
+
+JsonObject &DynamicJsonBuffer::createObject()
+{
+  _objects.emplace_back();
+  return _objects.back();
+}
+
+namespace
+{
+struct Parser
+{
+  const char *p;
+
+  void skipSpace()
+  {
+    while (*p && isspace((unsigned char)*p))
+      p++;
+  }
+
+  bool parseString(std::string &out)
+  {
+    if (*p != '"' && *p != '\'')
+      return false;
+    char quote = *p++;
+    while (*p && *p != quote)
+    {
+      if (*p == '\\')
+      {
+        p++;
+        switch (*p)
+        {
+          case 'n':
+            out += '\n';
+            break;
+          case 't':
+            out += '\t';
+            break;
+          case 'r':
+            out += '\r';
+            break;
+          case 'b':
+            out += '\b';
+            break;
+          case 'f':
+            out += '\f';
+            break;
+          case 0:
+            return false;
+          default:
+            out += *p;
+        }
+        p++;
+      }
+      else
+        out += *p++;
+    }
+    if (*p != quote)
+      return false;
+    p++;
+    return true;
+  }
+
+  // Nested arrays/objects are kept verbatim
+  bool parseRaw(std::string &out)
+  {
+    int depth = 0;
+    const char *start = p;
+    do
+    {
+      if (*p == '"')
+      {
+        std::string dummy;
+        if (!parseString(dummy))
+          return false;
+        continue;
+      }
+      if (*p == '{' || *p == '[')
+        depth++;
+      else if (*p == '}' || *p == ']')
+        depth--;
+      else if (!*p)
+        return false;
+      p++;
+    }
+    while (depth > 0);
+    out.assign(start, p - start);
+    return true;
+  }
+
+  bool parseLiteral(std::string &out)
+  {
+    while (*p && (isalnum((unsigned char)*p) || *p == '.' || *p == '-' || *p == '+'))
+      out += *p++;
+    return !out.empty();
+  }
+};
+}
+
+JsonObject &DynamicJsonBuffer::parseObject(const char *json)
+{
+  if (!json)
+    return JsonObject::invalid();
+
+  JsonObject &object = createObject();
+  Parser parser = {json};
+
+  parser.skipSpace();
+  if (*parser.p++ != '{')
+    return JsonObject::invalid();
+
+  parser.skipSpace();
+  if (*parser.p == '}')
+    return object;
+
+  while (true)
+  {
+    std::string key, value;
+    bool quoted = false;
+
+    parser.skipSpace();
+    if (!parser.parseString(key))
+      return JsonObject::invalid();
+    parser.skipSpace();
+    if (*parser.p++ != ':')
+      return JsonObject::invalid();
+    parser.skipSpace();
+
+    if (*parser.p == '"' || *parser.p == '\'')
+    {
+      quoted = true;
+      if (!parser.parseString(value))
+        return JsonObject::invalid();
+    }
+    else if (*parser.p == '{' || *parser.p == '[')
+    {
+      if (!parser.parseRaw(value))
+        return JsonObject::invalid();
+    }
+    else if (!parser.parseLiteral(value))
+      return JsonObject::invalid();
+
+    auto &m = object.slot(key);
+    m.value = value;
+    m.quoted = quoted;
+
+    parser.skipSpace();
+    if (*parser.p == ',')
+    {
+      parser.p++;
+      continue;
+    }
+    if (*parser.p == '}')
+      return object;
+    return JsonObject::invalid();
+  }
+}
+
+JsonObject &DynamicJsonBuffer::parseObject(Stream &json)
+{
+  return parseObject(json.readString());
+}
+
+size_t DynamicJsonBuffer::size() const
+{
+  size_t total = 0;
+  for (auto &o : _objects)
+    total += o.measureLength();
+  return total;
+}
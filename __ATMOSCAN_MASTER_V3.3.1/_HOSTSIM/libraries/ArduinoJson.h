@@ -0,0 +1,193 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - ArduinoJson 5 (flat objects)      */
+/*                                                      */
+/*  Covers what the firmware uses: the configuration    */
+/*  object, made of string, number and boolean values.  */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+class JsonObject;
+
+// Value slot returned by JsonObject::operator[]
+class JsonObjectSubscript
+{
+  public:
+    JsonObjectSubscript(JsonObject &object, const std::string &key) : _object(object), _key(key) {}
+
+    JsonObjectSubscript &operator=(const char *value);
+    JsonObjectSubscript &operator=(const String &value)
+    {
+      return *this = value.c_str();
+    }
+    JsonObjectSubscript &operator=(long value);
+    JsonObjectSubscript &operator=(int value)
+    {
+      return *this = (long)value;
+    }
+    JsonObjectSubscript &operator=(double value);
+    JsonObjectSubscript &operator=(bool value);
+
+    operator const char *() const;
+
+    template <typename T>
+    T as() const;
+
+    bool success() const;
+
+  private:
+    JsonObject &_object;
+    std::string _key;
+};
+
+class JsonObject
+{
+    friend class JsonObjectSubscript;
+
+  public:
+    bool success() const
+    {
+      return _success;
+    }
+
+    bool containsKey(const char *key) const
+    {
+      return find(key) != nullptr;
+    }
+    bool containsKey(const String &key) const
+    {
+      return containsKey(key.c_str());
+    }
+    bool containsKey(const __FlashStringHelper *key) const
+    {
+      return containsKey((const char *)key);
+    }
+
+    JsonObjectSubscript operator[](const char *key)
+    {
+      return JsonObjectSubscript(*this, key);
+    }
+    JsonObjectSubscript operator[](const String &key)
+    {
+      return JsonObjectSubscript(*this, key.c_str());
+    }
+    JsonObjectSubscript operator[](const __FlashStringHelper *key)
+    {
+      return JsonObjectSubscript(*this, (const char *)key);
+    }
+
+    template <typename T>
+    bool set(const char *key, T value)
+    {
+      (*this)[key] = value;
+      return true;
+    }
+    bool remove(const char *key);
+    size_t size() const
+    {
+      return _members.size();
+    }
+
+    size_t printTo(Print &out) const;
+    size_t printTo(char *buffer, size_t size) const;
+    size_t printTo(String &out) const;
+    size_t prettyPrintTo(Print &out) const
+    {
+      return printTo(out);
+    }
+    size_t measureLength() const;
+
+    static JsonObject &invalid();
+
+  private:
+    struct Member
+    {
+      std::string key;
+      std::string value;
+      bool quoted;    // String (vs number/boolean/literal)
+    };
+    std::vector<Member> _members;
+    bool _success = true;
+
+    const Member *find(const char *key) const;
+    Member &slot(const std::string &key);
+    std::string serialize() const;
+
+    friend class DynamicJsonBuffer;
+};
+
+class DynamicJsonBuffer
+{
+  public:
+    DynamicJsonBuffer(size_t initialSize = 256) {}
+
+    JsonObject &createObject();
+    JsonObject &parseObject(const char *json);
+    JsonObject &parseObject(char *json)
+    {
+      return parseObject((const char *)json);
+    }
+    JsonObject &parseObject(const String &json)
+    {
+      return parseObject(json.c_str());
+    }
+    JsonObject &parseObject(Stream &json);
+
+    size_t size() const;
+
+  private:
+    std::deque<JsonObject> _objects;
+};
+
+template <size_t CAPACITY>
+class StaticJsonBuffer : public DynamicJsonBuffer
+{
+};
+
+template <>
+inline const char *JsonObjectSubscript::as<const char *>() const
+{
+  return *this;
+}
+template <>
+inline long JsonObjectSubscript::as<long>() const
+{
+  const char *s = *this;
+  return s ? atol(s) : 0;
+}
+template <>
+inline int JsonObjectSubscript::as<int>() const
+{
+  return as<long>();
+}
+template <>
+inline float JsonObjectSubscript::as<float>() const
+{
+  const char *s = *this;
+  return s ? atof(s) : 0;
+}
+template <>
+inline double JsonObjectSubscript::as<double>() const
+{
+  const char *s = *this;
+  return s ? atof(s) : 0;
+}
+template <>
+inline bool JsonObjectSubscript::as<bool>() const
+{
+  const char *s = *this;
+  return s && strcmp(s, "true") == 0;
+}
+template <>
+inline String JsonObjectSubscript::as<String>() const
+{
+  const char *s = *this;
+  return s ? String(s) : String();
+}
@@ -0,0 +1,100 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - Chronos (DateTime subset)         */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "TimeLib.h"
+
+namespace Chronos
+{
+
+namespace Span
+{
+class Delta
+{
+  public:
+    explicit Delta(int32_t seconds) : seconds(seconds) {}
+    int32_t seconds;
+};
+
+class Seconds : public Delta
+{
+  public:
+    explicit Seconds(int32_t n) : Delta(n) {}
+};
+class Minutes : public Delta
+{
+  public:
+    explicit Minutes(int32_t n) : Delta(n * 60) {}
+};
+class Hours : public Delta
+{
+  public:
+    explicit Hours(int32_t n) : Delta(n * 3600) {}
+};
+class Days : public Delta
+{
+  public:
+    explicit Days(int32_t n) : Delta(n * 86400) {}
+};
+}
+
+class DateTime
+{
+  public:
+    DateTime(time_t t = 0) : t(t) {}
+
+    static DateTime now()
+    {
+      return DateTime(::now());
+    }
+
+    DateTime operator+(const Span::Delta &span) const
+    {
+      return DateTime(t + span.seconds);
+    }
+    DateTime operator-(const Span::Delta &span) const
+    {
+      return DateTime(t - span.seconds);
+    }
+
+    int year() const
+    {
+      return ::year(t);
+    }
+    int month() const
+    {
+      return ::month(t);
+    }
+    int day() const
+    {
+      return ::day(t);
+    }
+    int hour() const
+    {
+      return ::hour(t);
+    }
+    int minute() const
+    {
+      return ::minute(t);
+    }
+    int second() const
+    {
+      return ::second(t);
+    }
+    time_t asEpoch() const
+    {
+      return t;
+    }
+
+  private:
+    time_t t;
+};
+
+}
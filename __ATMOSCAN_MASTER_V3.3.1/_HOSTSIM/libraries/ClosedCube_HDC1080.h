@@ -0,0 +1,55 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - ClosedCube HDC1080 driver         */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "HostSim.h"
+
+class ClosedCube_HDC1080
+{
+  public:
+    void begin(uint8_t address)
+    {
+      _address = address;
+      HostSim::i2cTransfer(4);
+    }
+
+    double readTemperature()
+    {
+      // Trigger, 9ms conversion (the driver delays), read back
+      HostSim::i2cTransfer(2);
+      delay(9);
+      HostSim::i2cTransfer(3);
+      return HostSim::sample().temperature;
+    }
+
+    double readHumidity()
+    {
+      HostSim::i2cTransfer(2);
+      delay(9);
+      HostSim::i2cTransfer(3);
+      return HostSim::sample().humidity;
+    }
+
+    uint16_t readManufacturerId()
+    {
+      HostSim::i2cTransfer(5);
+      return HostSim::i2cPresent(_address) ? 0x5449 : 0xFFFF;
+    }
+
+    uint16_t readDeviceId()
+    {
+      HostSim::i2cTransfer(5);
+      return HostSim::i2cPresent(_address) ? 0x1050 : 0xFFFF;
+    }
+
+  private:
+    uint8_t _address = 0x40;
+};
@@ -0,0 +1,116 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - Bodmer JPEGDecoder                */
+/*                                                      */
+/********************************************************/
+
+#include "JPEGDecoder.h"
+#include "HostSim.h"
+
+JPEGDecoder JpegDec;
+
+int JPEGDecoder::decodeFsFile(const char *pFilename)
+{
+  fs::File file = SPIFFS.open(pFilename, "r");
+  if (!file)
+    return 0;
+  return decodeFsFile(file);
+}
+
+int JPEGDecoder::decodeFsFile(fs::File jpgFile)
+{
+  data.resize(jpgFile.size());
+  jpgFile.read(data.data(), data.size());
+  jpgFile.close();
+  return decode();
+}
+
+int JPEGDecoder::decodeArray(const uint8_t array[], uint32_t array_size)
+{
+  data.assign(array, array + array_size);
+  return decode();
+}
+
+int JPEGDecoder::decode()
+{
+  // Locate the baseline (SOF0) or progressive (SOF2) frame header
+  width = height = 0;
+  for (size_t i = 0; i + 11 < data.size(); i++)
+  {
+    if (data[i] == 0xFF && (data[i + 1] == 0xC0 || data[i + 1] == 0xC2))
+    {
+      if (data[i + 1] == 0xC2)
+        return 0;   // Progressive JPEGs are not supported by picojpeg
+      height = (data[i + 5] << 8) | data[i + 6];
+      width = (data[i + 7] << 8) | data[i + 8];
+      comps = data[i + 9];
+      uint8_t sampling = comps > 1 ? data[i + 11] : 0x11;
+      MCUWidth = 8 * (sampling >> 4);
+      MCUHeight = 8 * (sampling & 0x0F);
+      break;
+    }
+  }
+  if (!width || !height || !MCUWidth || !MCUHeight)
+    return 0;
+
+  scanType = comps == 1 ? 0 : (MCUWidth == 16 ? (MCUHeight == 16 ? 4 : 2) : (MCUHeight == 16 ? 3 : 1));
+  MCUSPerRow = (width + MCUWidth - 1) / MCUWidth;
+  MCUSPerCol = (height + MCUHeight - 1) / MCUHeight;
+  mcu.assign(MCUWidth * MCUHeight, 0);
+  pImage = mcu.data();
+  mcuIndex = 0;
+  MCUx = MCUy = 0;
+
+  seed = 2166136261u;
+  for (uint8_t b : data)
+    seed = (seed ^ b) * 16777619u;
+  return 1;
+}
+
+int JPEGDecoder::read()
+{
+  if (mcuIndex >= MCUSPerRow * MCUSPerCol)
+  {
+    abort();
+    return 0;
+  }
+
+  MCUx = mcuIndex % MCUSPerRow;
+  MCUy = mcuIndex / MCUSPerRow;
+  mcuIndex++;
+
+  // Each MCU holds (MCUWidth/8 * MCUHeight/8) luma blocks plus two chroma blocks
+  int blocks = (MCUWidth / 8) * (MCUHeight / 8) + (comps > 1 ? 2 : 0);
+  HostSim::busy(HostSim::cpuMicros(blocks * SIM_JPEG_BLOCK_MICROS));
+
+  // Synthetic content: a gradient that depends on the image
+  for (int y = 0; y < MCUHeight; y++)
+    for (int x = 0; x < MCUWidth; x++)
+    {
+      int px = MCUx * MCUWidth + x, py = MCUy * MCUHeight + y;
+      uint8_t r = (px * 255 / width + (seed & 0xFF)) & 0xFF;
+      uint8_t g = (py * 255 / height + ((seed >> 8) & 0xFF)) & 0xFF;
+      uint8_t b = ((px + py) + ((seed >> 16) & 0xFF)) & 0xFF;
+      mcu[y * MCUWidth + x] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+  return 1;
+}
+
+int JPEGDecoder::readSwappedBytes()
+{
+  if (!read())
+    return 0;
+  for (auto &c : mcu)
+    c = (c >> 8) | (c << 8);
+  return 1;
+}
+
+void JPEGDecoder::abort()
+{
+  mcuIndex = MCUSPerRow * MCUSPerCol;
+  data.clear();
+  data.shrink_to_fit();
+}
@@ -0,0 +1,63 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - Bodmer JPEGDecoder                */
+/*                                                      */
+/*  Parses the frame header for the geometry and MCU    */
+/*  layout, then delivers synthetic MCUs charging the   */
+/*  modelled picojpeg decode time of each one.          */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "FS.h"
+
+// picojpeg on the ESP8266 at 80MHz, per 8x8 block (scales with the CPU clock)
+#define SIM_JPEG_BLOCK_MICROS 300
+
+class JPEGDecoder
+{
+  public:
+    uint16_t *pImage = nullptr;
+
+    int width = 0;
+    int height = 0;
+    int comps = 0;
+    int MCUSPerRow = 0;
+    int MCUSPerCol = 0;
+    int scanType = 0;
+    int MCUWidth = 0;
+    int MCUHeight = 0;
+    int MCUx = 0;
+    int MCUy = 0;
+
+    int decodeFsFile(const char *pFilename);
+    int decodeFsFile(const String &pFilename)
+    {
+      return decodeFsFile(pFilename.c_str());
+    }
+    int decodeFsFile(fs::File jpgFile);
+    int decodeSdFile(fs::File jpgFile)
+    {
+      return decodeFsFile(jpgFile);
+    }
+    int decodeArray(const uint8_t array[], uint32_t array_size);
+
+    int read();
+    int readSwappedBytes();
+    void abort();
+
+  private:
+    std::vector<uint8_t> data;
+    std::vector<uint16_t> mcu;
+    int mcuIndex = 0;
+    uint32_t seed = 0;
+
+    int decode();
+};
+
+extern JPEGDecoder JpegDec;
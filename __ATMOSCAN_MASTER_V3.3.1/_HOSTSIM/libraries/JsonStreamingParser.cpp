@@ -0,0 +1,443 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - squix78 json-streaming-parser     */
+/*                                                      */
+/********************************************************/
+
+#include "JsonStreamingParser.h"
+
+JsonStreamingParser::JsonStreamingParser()
+{
+  reset();
+}
+
+void JsonStreamingParser::reset()
+{
+  state = STATE_START_DOCUMENT;
+  bufferPos = 0;
+  unicodeEscapeBufferPos = 0;
+  unicodeBufferPos = 0;
+  characterCounter = 0;
+  stackPos = 0;
+}
+
+void JsonStreamingParser::parse(char c)
+{
+  // Whitespace outside strings
+  if ((c == ' ' || c == '\t' || c == '\n' || c == '\r') &&
+      !(state == STATE_IN_STRING || state == STATE_UNICODE || state == STATE_START_ESCAPE || state == STATE_IN_NUMBER ||
+        state == STATE_START_DOCUMENT))
+  {
+    return;
+  }
+
+  switch (state)
+  {
+    case STATE_IN_STRING:
+      if (c == '"')
+        endString();
+      else if (c == '\\')
+        state = STATE_START_ESCAPE;
+      else if ((c < 0x1f) || (c == 0x7f))
+      {
+        // Unescaped control character: ignored
+      }
+      else
+      {
+        buffer[bufferPos] = c;
+        increaseBufferPointer();
+      }
+      break;
+    case STATE_IN_ARRAY:
+      if (c == ']')
+        endArray();
+      else
+        startValue(c);
+      break;
+    case STATE_IN_OBJECT:
+      if (c == '}')
+        endObject();
+      else if (c == '"')
+        startKey();
+      break;
+    case STATE_END_KEY:
+      if (c == ':')
+        state = STATE_AFTER_KEY;
+      break;
+    case STATE_AFTER_KEY:
+      startValue(c);
+      break;
+    case STATE_START_ESCAPE:
+      processEscapeCharacters(c);
+      break;
+    case STATE_UNICODE:
+      processUnicodeCharacter(c);
+      break;
+    case STATE_UNICODE_SURROGATE:
+      unicodeEscapeBuffer[unicodeEscapeBufferPos] = c;
+      unicodeEscapeBufferPos++;
+      if (unicodeEscapeBufferPos == 2)
+        endUnicodeSurrogateInterstitial();
+      break;
+    case STATE_AFTER_VALUE:
+    {
+      int within = stack[stackPos - 1];
+      if (within == STACK_OBJECT)
+      {
+        if (c == '}')
+          endObject();
+        else if (c == ',')
+          state = STATE_IN_OBJECT;
+      }
+      else if (within == STACK_ARRAY)
+      {
+        if (c == ']')
+          endArray();
+        else if (c == ',')
+          state = STATE_IN_ARRAY;
+      }
+    }
+    break;
+    case STATE_IN_NUMBER:
+      if (c >= '0' && c <= '9')
+      {
+        buffer[bufferPos] = c;
+        increaseBufferPointer();
+      }
+      else if (c == '.')
+      {
+        if (!doesCharArrayContain(buffer, bufferPos, '.'))
+        {
+          buffer[bufferPos] = c;
+          increaseBufferPointer();
+        }
+      }
+      else if (c == 'e' || c == 'E')
+      {
+        if (!doesCharArrayContain(buffer, bufferPos, 'e') && !doesCharArrayContain(buffer, bufferPos, 'E'))
+        {
+          buffer[bufferPos] = c;
+          increaseBufferPointer();
+        }
+      }
+      else if (c == '+' || c == '-')
+      {
+        char last = buffer[bufferPos - 1];
+        if (last == 'e' || last == 'E')
+        {
+          buffer[bufferPos] = c;
+          increaseBufferPointer();
+        }
+      }
+      else
+      {
+        endNumber();
+        // Everything else ends the number and is then handled as usual
+        parse(c);
+      }
+      break;
+    case STATE_IN_TRUE:
+      buffer[bufferPos] = c;
+      increaseBufferPointer();
+      if (bufferPos == 4)
+        endTrue();
+      break;
+    case STATE_IN_FALSE:
+      buffer[bufferPos] = c;
+      increaseBufferPointer();
+      if (bufferPos == 5)
+        endFalse();
+      break;
+    case STATE_IN_NULL:
+      buffer[bufferPos] = c;
+      increaseBufferPointer();
+      if (bufferPos == 4)
+        endNull();
+      break;
+    case STATE_START_DOCUMENT:
+      myListener->startDocument();
+      if (c == '[')
+        startArray();
+      else if (c == '{')
+        startObject();
+      break;
+  }
+  characterCounter++;
+}
+
+void JsonStreamingParser::increaseBufferPointer()
+{
+  bufferPos = min(bufferPos + 1, BUFFER_MAX_LENGTH - 1);
+}
+
+void JsonStreamingParser::endString()
+{
+  int popped = stack[stackPos - 1];
+  stackPos--;
+  if (popped == STACK_KEY)
+  {
+    buffer[bufferPos] = '\0';
+    myListener->key(String(buffer));
+    state = STATE_END_KEY;
+  }
+  else if (popped == STACK_STRING)
+  {
+    buffer[bufferPos] = '\0';
+    myListener->value(String(buffer));
+    state = STATE_AFTER_VALUE;
+  }
+  bufferPos = 0;
+}
+
+void JsonStreamingParser::startValue(char c)
+{
+  if (c == '[')
+    startArray();
+  else if (c == '{')
+    startObject();
+  else if (c == '"')
+    startString();
+  else if (isDigit(c))
+    startNumber(c);
+  else if (c == 't')
+  {
+    state = STATE_IN_TRUE;
+    buffer[bufferPos] = c;
+    increaseBufferPointer();
+  }
+  else if (c == 'f')
+  {
+    state = STATE_IN_FALSE;
+    buffer[bufferPos] = c;
+    increaseBufferPointer();
+  }
+  else if (c == 'n')
+  {
+    state = STATE_IN_NULL;
+    buffer[bufferPos] = c;
+    increaseBufferPointer();
+  }
+}
+
+bool JsonStreamingParser::isDigit(char c)
+{
+  return (c >= '0' && c <= '9') || c == '-';
+}
+
+void JsonStreamingParser::endArray()
+{
+  stackPos--;
+  myListener->endArray();
+  state = STATE_AFTER_VALUE;
+  if (stackPos == 0)
+    endDocument();
+}
+
+void JsonStreamingParser::startKey()
+{
+  stack[stackPos] = STACK_KEY;
+  stackPos++;
+  state = STATE_IN_STRING;
+}
+
+void JsonStreamingParser::endObject()
+{
+  stackPos--;
+  myListener->endObject();
+  state = STATE_AFTER_VALUE;
+  if (stackPos == 0)
+    endDocument();
+}
+
+void JsonStreamingParser::processEscapeCharacters(char c)
+{
+  switch (c)
+  {
+    case '"':
+    case '\\':
+    case '/':
+      buffer[bufferPos] = c;
+      break;
+    case 'b':
+      buffer[bufferPos] = 0x08;
+      break;
+    case 'f':
+      buffer[bufferPos] = '\f';
+      break;
+    case 'n':
+      buffer[bufferPos] = '\n';
+      break;
+    case 'r':
+      buffer[bufferPos] = '\r';
+      break;
+    case 't':
+      buffer[bufferPos] = '\t';
+      break;
+    case 'u':
+      state = STATE_UNICODE;
+      return;
+  }
+  increaseBufferPointer();
+  if (state != STATE_UNICODE)
+    state = STATE_IN_STRING;
+}
+
+void JsonStreamingParser::processUnicodeCharacter(char c)
+{
+  if (!isHexCharacter(c))
+    return;
+
+  unicodeBuffer[unicodeBufferPos] = c;
+  unicodeBufferPos++;
+
+  if (unicodeBufferPos == 4)
+  {
+    int codepoint = getHexArrayAsDecimal(unicodeBuffer, unicodeBufferPos);
+    endUnicodeCharacter(codepoint);
+    return;
+  }
+}
+
+bool JsonStreamingParser::isHexCharacter(char c)
+{
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+int JsonStreamingParser::getHexArrayAsDecimal(char hexArray[], int length)
+{
+  int result = 0;
+  for (int i = 0; i < length; i++)
+  {
+    char current = hexArray[length - i - 1];
+    int value = 0;
+    if (current >= 'a' && current <= 'f')
+      value = current - 'a' + 10;
+    else if (current >= 'A' && current <= 'F')
+      value = current - 'A' + 10;
+    else if (current >= '0' && current <= '9')
+      value = current - '0';
+    result += value * (1 << (i * 4));
+  }
+  return result;
+}
+
+bool JsonStreamingParser::doesCharArrayContain(char myArray[], int length, char c)
+{
+  for (int i = 0; i < length; i++)
+    if (myArray[i] == c)
+      return true;
+  return false;
+}
+
+void JsonStreamingParser::endUnicodeSurrogateInterstitial()
+{
+  char unicodeEscape = unicodeEscapeBuffer[unicodeEscapeBufferPos - 1];
+  if (unicodeEscape != 'u')
+  {
+    // Expected "\u" following a Unicode high surrogate: ignored
+  }
+  unicodeBufferPos = 0;
+  unicodeEscapeBufferPos = 0;
+  state = STATE_UNICODE;
+}
+
+void JsonStreamingParser::endNumber()
+{
+  buffer[bufferPos] = '\0';
+  myListener->value(String(buffer));
+  bufferPos = 0;
+  state = STATE_AFTER_VALUE;
+}
+
+int JsonStreamingParser::convertDecimalBufferToInt(char myArray[], int length)
+{
+  int result = 0;
+  for (int i = 0; i < length; i++)
+    result = result * 10 + (myArray[i] - '0');
+  return result;
+}
+
+void JsonStreamingParser::endDocument()
+{
+  myListener->endDocument();
+  state = STATE_DONE;
+}
+
+void JsonStreamingParser::endTrue()
+{
+  buffer[bufferPos] = '\0';
+  String value = String(buffer);
+  if (value == "true")
+    myListener->value("true");
+  bufferPos = 0;
+  state = STATE_AFTER_VALUE;
+}
+
+void JsonStreamingParser::endFalse()
+{
+  buffer[bufferPos] = '\0';
+  String value = String(buffer);
+  if (value == "false")
+    myListener->value("false");
+  bufferPos = 0;
+  state = STATE_AFTER_VALUE;
+}
+
+void JsonStreamingParser::endNull()
+{
+  buffer[bufferPos] = '\0';
+  String value = String(buffer);
+  if (value == "null")
+    myListener->value("null");
+  bufferPos = 0;
+  state = STATE_AFTER_VALUE;
+}
+
+void JsonStreamingParser::startArray()
+{
+  myListener->startArray();
+  state = STATE_IN_ARRAY;
+  stack[stackPos] = STACK_ARRAY;
+  stackPos++;
+}
+
+void JsonStreamingParser::startObject()
+{
+  myListener->startObject();
+  state = STATE_IN_OBJECT;
+  stack[stackPos] = STACK_OBJECT;
+  stackPos++;
+}
+
+void JsonStreamingParser::startString()
+{
+  stack[stackPos] = STACK_STRING;
+  stackPos++;
+  state = STATE_IN_STRING;
+}
+
+void JsonStreamingParser::startNumber(char c)
+{
+  state = STATE_IN_NUMBER;
+  buffer[bufferPos] = c;
+  increaseBufferPointer();
+}
+
+void JsonStreamingParser::endUnicodeCharacter(int codepoint)
+{
+  buffer[bufferPos] = convertCodepointToCharacter(codepoint);
+  increaseBufferPointer();
+  unicodeBufferPos = 0;
+  unicodeHighSurrogate = -1;
+  state = STATE_IN_STRING;
+}
+
+char JsonStreamingParser::convertCodepointToCharacter(int num)
+{
+  if (num <= 0x7F)
+    return (char)(num);
+  return ' ';
+}
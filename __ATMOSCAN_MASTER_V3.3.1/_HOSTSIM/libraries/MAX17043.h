@@ -0,0 +1,45 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - MAX17043 fuel gauge               */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "HostSim.h"
+
+class MAX17043
+{
+  public:
+    void reset()
+    {
+      HostSim::i2cTransfer(4);
+    }
+    void quickStart()
+    {
+      HostSim::i2cTransfer(4);
+    }
+    float getVCell()
+    {
+      HostSim::i2cTransfer(4);
+      return HostSim::sample().vcell;
+    }
+    float getSoC()
+    {
+      HostSim::i2cTransfer(4);
+
+      // Piecewise linear LiPo discharge curve
+      float v = HostSim::sample().vcell;
+      float soc = v >= 3.7f ? 20.0f + (v - 3.7f) * 160.0f : (v - 3.4f) * 66.0f;
+      return constrain(soc, 0.0f, 100.0f);
+    }
+    int getVersion()
+    {
+      HostSim::i2cTransfer(4);
+      return 3;
+    }
+};
@@ -0,0 +1,98 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - Grove Multichannel Gas Sensor     */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "HostSim.h"
+
+class MutichannelGasSensor
+{
+  public:
+    void begin(int address)
+    {
+      _address = address;
+      HostSim::i2cTransfer(8);
+    }
+    void begin()
+    {
+      begin(0x04);
+    }
+    void powerOn()
+    {
+      HostSim::i2cTransfer(2);
+    }
+    void powerOff()
+    {
+      HostSim::i2cTransfer(2);
+    }
+    unsigned char getVersion()
+    {
+      HostSim::i2cTransfer(4);
+      return HostSim::i2cPresent(_address) ? 2 : 0;
+    }
+
+    // Each measure reads three ADC channels and R0 values, the
+    // firmware on the sensor side needs ~2ms per request
+    float measure_CO()
+    {
+      readChannels();
+      return HostSim::sample().co;
+    }
+    float measure_NO2()
+    {
+      readChannels();
+      return HostSim::sample().no2;
+    }
+    float measure_NH3()
+    {
+      readChannels();
+      return 1.0f;
+    }
+    float measure_C3H8()
+    {
+      readChannels();
+      return 1000.0f;
+    }
+    float measure_C4H10()
+    {
+      readChannels();
+      return 1000.0f;
+    }
+    float measure_CH4()
+    {
+      readChannels();
+      return 2000.0f;
+    }
+    float measure_H2()
+    {
+      readChannels();
+      return 1.0f;
+    }
+    float measure_C2H5OH()
+    {
+      readChannels();
+      return 1.0f;
+    }
+
+  private:
+    int _address = 0x04;
+
+    void readChannels()
+    {
+      for (int i = 0; i < 6; i++)
+      {
+        HostSim::i2cTransfer(4);
+        delay(2);
+      }
+    }
+};
+
+extern MutichannelGasSensor gas;
@@ -0,0 +1,98 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - gmag11 NtpClientLib               */
+/*                                                      */
+/********************************************************/
+
+#include "NtpClientLib.h"
+#include "ESP8266WiFi.h"
+#include "HostSim.h"
+
+NTPClient NTP;
+
+static time_t ntpProvider()
+{
+  return NTP.getTime();
+}
+
+bool NTPClient::begin(String ntpServerName, int timeOffset, bool daylight)
+{
+  _ntpServerName = ntpServerName;
+  _timeZone = timeOffset;
+  _daylight = daylight;
+  setSyncInterval(_shortInterval);
+  setSyncProvider(ntpProvider);
+  return true;
+}
+
+bool NTPClient::stop()
+{
+  setSyncProvider(nullptr);
+  return true;
+}
+
+bool NTPClient::setInterval(int interval)
+{
+  _shortInterval = _longInterval = interval;
+  setSyncInterval(interval);
+  return true;
+}
+
+bool NTPClient::setInterval(int shortInterval, int longInterval)
+{
+  _shortInterval = shortInterval;
+  _longInterval = longInterval;
+  setSyncInterval(timeStatus() == timeSet ? longInterval : shortInterval);
+  return true;
+}
+
+bool NTPClient::setTimeZone(int timeZone)
+{
+  _timeZone = timeZone;
+  return true;
+}
+
+time_t NTPClient::getTime()
+{
+  if (!WiFi.isConnected())
+  {
+    if (onSyncEvent)
+      onSyncEvent(noResponse);
+    return 0;
+  }
+
+  // One 48 byte UDP exchange
+  HostSim::busy(2 * HostSim::networkMicros(48));
+
+  time_t t = HostSim::wallClock() + _timeZone * 3600 + (_daylight ? 3600 : 0);
+  _lastSyncd = t;
+  if (!_firstSync)
+    _firstSync = t;
+  setSyncInterval(_longInterval);
+
+  if (onSyncEvent)
+    onSyncEvent(timeSyncd);
+  return t;
+}
+
+String NTPClient::getTimeStr(time_t moment)
+{
+  char buf[12];
+  snprintf(buf, sizeof(buf), "%02d:%02d:%02d", hour(moment), minute(moment), second(moment));
+  return String(buf);
+}
+
+String NTPClient::getDateStr(time_t moment)
+{
+  char buf[12];
+  snprintf(buf, sizeof(buf), "%02d/%02d/%4d", day(moment), month(moment), year(moment));
+  return String(buf);
+}
+
+String NTPClient::getTimeDateString(time_t moment)
+{
+  return getTimeStr(moment) + " " + getDateStr(moment);
+}
@@ -0,0 +1,117 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - gmag11 NtpClientLib               */
+/*                                                      */
+/*  Synchronisation answers with the simulated wall     */
+/*  clock (see --epoch) after one network round trip.   */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "TimeLib.h"
+
+#define DEFAULT_NTP_SERVER "pool.ntp.org"
+#define DEFAULT_NTP_PORT 123
+#define DEFAULT_NTP_INTERVAL 1800
+#define DEFAULT_NTP_SHORTINTERVAL 15
+#define DEFAULT_NTP_TIMEZONE 0
+
+typedef enum
+{
+  timeSyncd,
+  noResponse,
+  invalidAddress
+} NTPSyncEvent_t;
+
+typedef std::function<void(NTPSyncEvent_t)> onSyncEvent_t;
+
+class NTPClient
+{
+  public:
+    bool begin(String ntpServerName = DEFAULT_NTP_SERVER, int timeOffset = DEFAULT_NTP_TIMEZONE, bool daylight = false);
+    bool stop();
+
+    bool setInterval(int interval);
+    bool setInterval(int shortInterval, int longInterval);
+    int getInterval()
+    {
+      return _longInterval;
+    }
+    int getShortInterval()
+    {
+      return _shortInterval;
+    }
+
+    bool setTimeZone(int timeZone);
+    int getTimeZone()
+    {
+      return _timeZone;
+    }
+    void setDayLight(bool daylight)
+    {
+      _daylight = daylight;
+    }
+    bool getDayLight()
+    {
+      return _daylight;
+    }
+    // NOTE: the library applies its own summer time rules, the simulated clock is always in summer time
+    bool isSummerTime()
+    {
+      return _daylight;
+    }
+
+    String getTimeStr(time_t moment);
+    String getTimeStr()
+    {
+      return getTimeStr(now());
+    }
+    String getDateStr(time_t moment);
+    String getDateStr()
+    {
+      return getDateStr(now());
+    }
+    String getTimeDateString(time_t moment);
+    String getTimeDateString()
+    {
+      return getTimeDateString(now());
+    }
+
+    time_t getLastNTPSync()
+    {
+      return _lastSyncd;
+    }
+    time_t getFirstSync()
+    {
+      return _firstSync;
+    }
+    time_t getUptime()
+    {
+      return millis() / 1000;
+    }
+
+    void onNTPSyncEvent(onSyncEvent_t handler)
+    {
+      onSyncEvent = handler;
+    }
+
+    // Time provider registered with TimeLib
+    time_t getTime();
+
+  private:
+    String _ntpServerName;
+    int _timeZone = 0;
+    bool _daylight = false;
+    int _shortInterval = DEFAULT_NTP_SHORTINTERVAL;
+    int _longInterval = DEFAULT_NTP_INTERVAL;
+    time_t _lastSyncd = 0;
+    time_t _firstSync = 0;
+    onSyncEvent_t onSyncEvent;
+};
+
+extern NTPClient NTP;
@@ -0,0 +1,194 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - ArduinoProcessScheduler           */
+/*                                                      */
+/********************************************************/
+
+#include <cxxabi.h>
+#include <typeinfo>
+#include "ProcessScheduler.h"
+#include "HostSim.h"
+
+// -------------------------------------------------------
+// Process
+// -------------------------------------------------------
+
+Process::Process(Scheduler &manager, ProcPriority priority, uint32_t period, int iterations)
+  : _scheduler(manager), _priority(priority), _period(period), _iterations(iterations) {}
+
+Process::~Process()
+{
+  // Unlink without calling back into a partially destroyed object
+  auto &list = _scheduler._processes;
+  list.erase(std::remove(list.begin(), list.end(), this), list.end());
+}
+
+bool Process::add(bool enableIfNot)
+{
+  if (_added)
+    return false;
+  _added = true;
+  _scheduler._processes.push_back(this);
+  setup();
+  if (enableIfNot)
+    enable();
+  return true;
+}
+
+bool Process::remove()
+{
+  if (!_added)
+    return false;
+  disable();
+  cleanup();
+  _added = false;
+  auto &list = _scheduler._processes;
+  list.erase(std::remove(list.begin(), list.end(), this), list.end());
+  return true;
+}
+
+bool Process::enable()
+{
+  if (!_added || _enabled)
+    return false;
+  _enabled = true;
+  _scheduledTS = getCurrTS();
+  onEnable();
+  return true;
+}
+
+bool Process::disable()
+{
+  if (!_enabled)
+    return false;
+  _enabled = false;
+  onDisable();
+  return true;
+}
+
+bool Process::restart()
+{
+  disable();
+  return enable();
+}
+
+bool Process::force()
+{
+  _forced = true;
+  return true;
+}
+
+void Process::setPeriod(uint32_t period)
+{
+  _period = period;
+}
+
+uint32_t Process::getCurrTS()
+{
+  return _scheduler.getCurrTS();
+}
+
+bool Process::due(uint32_t now)
+{
+  return _enabled && (_forced || (int32_t)(now - _scheduledTS) >= (int32_t)_period);
+}
+
+void Process::run(uint32_t now)
+{
+  _forced = false;
+  _actualTS = now;
+
+  // Stay on the period grid, unless more than a period behind
+  _scheduledTS += _period;
+  if ((int32_t)(now - _scheduledTS) >= (int32_t)_period)
+    _scheduledTS = now;
+
+  unsigned long simStart = micros();
+  uint64_t hostStart = HostSim::hostNanos();
+
+  service();
+
+  uint64_t host = HostSim::hostNanos() - hostStart;
+  uint64_t sim = micros() - simStart;
+  _simStats.runs++;
+  _simStats.hostNanos += host;
+  _simStats.hostNanosMax = std::max(_simStats.hostNanosMax, host);
+  _simStats.simMicros += sim;
+  _simStats.simMicrosMax = std::max(_simStats.simMicrosMax, sim);
+
+  if (_iterations > 0 && --_iterations == 0)
+    remove();
+}
+
+const char *Process::simName() const
+{
+  if (_simName.empty())
+  {
+    int status = 0;
+    char *name = abi::__cxa_demangle(typeid(*this).name(), nullptr, nullptr, &status);
+    _simName = status == 0 ? name : typeid(*this).name();
+    free(name);
+  }
+  return _simName.c_str();
+}
+
+// -------------------------------------------------------
+// Scheduler
+// -------------------------------------------------------
+
+int Scheduler::run()
+{
+  int count = 0;
+  for (int pr = HIGH_PRIORITY; pr < NUM_PRIORITY; pr++)
+  {
+    // Copy: services may add or remove processes
+    std::vector<Process *> list = _processes;
+    for (Process *p : list)
+    {
+      if (p->_priority != pr)
+        continue;
+      if (std::find(_processes.begin(), _processes.end(), p) == _processes.end())
+        continue;
+      uint32_t now = getCurrTS();
+      if (!p->due(now))
+        continue;
+      _active = p;
+      p->run(now);
+      _active = nullptr;
+      count++;
+    }
+  }
+  return count;
+}
+
+int Scheduler::countProcesses(bool enabledOnly)
+{
+  int count = 0;
+  for (Process *p : _processes)
+    if (!enabledOnly || p->isEnabled())
+      count++;
+  return count;
+}
+
+bool Scheduler::simNextDue(uint32_t &ts)
+{
+  bool found = false;
+  uint32_t now = getCurrTS();
+  int32_t best = 0;
+  for (Process *p : _processes)
+  {
+    if (!p->isEnabled())
+      continue;
+    int32_t wait = p->_forced ? 0 : (int32_t)(p->_scheduledTS + p->_period - now);
+    if (!found || wait < best)
+    {
+      best = wait;
+      found = true;
+    }
+  }
+  ts = now + std::max<int32_t>(best, 0);
+  return found;
+}
@@ -0,0 +1,162 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - ArduinoProcessScheduler           */
+/*                                                      */
+/*  Same API and scheduling rules as wizard97's         */
+/*  library, plus per process run time accounting used  */
+/*  by the simulation report.                           */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum ProcPriority
+{
+  HIGH_PRIORITY = 0,
+  MEDIUM_PRIORITY,
+  LOW_PRIORITY,
+  NUM_PRIORITY
+} ProcPriority;
+
+#define RUNTIME_FOREVER -1
+#define SERVICE_CONSTANTLY 0
+#define SERVICE_SECONDLY 1000
+#define SERVICE_MINUTELY 60000
+
+class Scheduler;
+
+// Run time accounting of a process (simulation only)
+struct ProcessSimStats
+{
+  uint32_t runs = 0;
+  uint64_t hostNanos = 0;        // Host CPU time spent in service()
+  uint64_t hostNanosMax = 0;
+  uint64_t simMicros = 0;        // Simulated time spent in service() (includes modelled I/O)
+  uint64_t simMicrosMax = 0;
+};
+
+class Process
+{
+    friend class Scheduler;
+
+  public:
+    Process(Scheduler &manager, ProcPriority priority, uint32_t period, int iterations = RUNTIME_FOREVER);
+    virtual ~Process();
+
+    // Adds the process to the scheduler (calls setup())
+    bool add(bool enableIfNot = false);
+    // Removes the process from the scheduler (calls cleanup())
+    bool remove();
+
+    bool enable();
+    bool disable();
+    bool restart();
+    bool force();
+
+    void setPeriod(uint32_t period);
+    uint32_t getPeriod()
+    {
+      return _period;
+    }
+    void setIterations(int iterations)
+    {
+      _iterations = iterations;
+    }
+    int getIterations()
+    {
+      return _iterations;
+    }
+    bool isEnabled()
+    {
+      return _enabled;
+    }
+    bool isNotDestroyed()
+    {
+      return _added;
+    }
+    ProcPriority getPriority()
+    {
+      return _priority;
+    }
+    Scheduler &scheduler()
+    {
+      return _scheduler;
+    }
+
+    uint32_t getScheduledTS()
+    {
+      return _scheduledTS;
+    }
+    uint32_t getActualRunTS()
+    {
+      return _actualTS;
+    }
+
+    // Simulation hooks
+    const ProcessSimStats &simStats() const
+    {
+      return _simStats;
+    }
+    const char *simName() const;
+
+  protected:
+    virtual void setup() {}
+    virtual void service() = 0;
+    virtual void cleanup() {}
+    virtual void onEnable() {}
+    virtual void onDisable() {}
+
+    uint32_t getCurrTS();
+
+  private:
+    Scheduler &_scheduler;
+    ProcPriority _priority;
+    uint32_t _period;
+    int _iterations;
+    bool _enabled = false;
+    bool _added = false;
+    bool _forced = false;
+    uint32_t _scheduledTS = 0;
+    uint32_t _actualTS = 0;
+    ProcessSimStats _simStats;
+    mutable std::string _simName;
+
+    bool due(uint32_t now);
+    void run(uint32_t now);
+};
+
+class Scheduler
+{
+    friend class Process;
+
+  public:
+    // Runs every process that is due, highest priority first; returns how many ran
+    int run();
+
+    Process *getCurrProcess()
+    {
+      return _active;
+    }
+    uint32_t getCurrTS()
+    {
+      return millis();
+    }
+    int countProcesses(bool enabledOnly = true);
+
+    // Simulation hooks
+    const std::vector<Process *> &simProcesses() const
+    {
+      return _processes;
+    }
+    // Earliest time (millis) any enabled process becomes due, false if none is enabled
+    bool simNextDue(uint32_t &ts);
+
+  private:
+    std::vector<Process *> _processes;
+    Process *_active = nullptr;
+};
@@ -0,0 +1,106 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - PubSubClient                      */
+/*                                                      */
+/********************************************************/
+
+#include "PubSubClient.h"
+#include "ESP8266WiFi.h"
+#include "HostSim.h"
+
+uint32_t PubSubClient::simPublished = 0;
+uint32_t PubSubClient::simConnects = 0;
+std::deque<MqttSimMessage> PubSubClient::simLog;
+
+#define SIM_MQTT_LOG_DEPTH 64
+
+PubSubClient &PubSubClient::setServer(const char *domain, uint16_t port)
+{
+  _domain = domain;
+  return *this;
+}
+
+bool PubSubClient::connect(const char *id, const char *user, const char *pass)
+{
+  if (connected())
+    return true;
+
+  if (!_domain || !*_domain || !WiFi.isConnected() || !HostSim::brokerAvailable())
+  {
+    // The real client blocks until the TCP connection (client timeout), or the CONNACK (socket timeout), times out
+    unsigned long timeout = _client ? min(_client->getTimeout() * 1000UL, _socketTimeout * 1000000UL) : _socketTimeout * 1000000UL;
+    HostSim::busy(HostSim::brokerAvailable() ? 5000 : timeout);
+    _state = MQTT_CONNECT_FAILED;
+    return false;
+  }
+
+  // DNS + TCP handshake + CONNECT/CONNACK
+  HostSim::busy(3 * HostSim::networkMicros(64));
+  simConnects++;
+  _state = MQTT_CONNECTED;
+  _lastActivity = millis();
+  return true;
+}
+
+void PubSubClient::disconnect()
+{
+  if (_state == MQTT_CONNECTED)
+    HostSim::busy(HostSim::networkMicros(2));
+  _state = MQTT_DISCONNECTED;
+}
+
+bool PubSubClient::connected()
+{
+  if (_state != MQTT_CONNECTED)
+    return false;
+
+  // The broker drops clients that miss 1.5 keepalive periods
+  if (!WiFi.isConnected() || millis() - _lastActivity > _keepAlive * 1500UL)
+  {
+    _state = MQTT_CONNECTION_LOST;
+    return false;
+  }
+  return true;
+}
+
+bool PubSubClient::loop()
+{
+  if (!connected())
+    return false;
+
+  // PINGREQ when the keepalive period elapsed
+  if (millis() - _lastActivity > _keepAlive * 1000UL)
+  {
+    HostSim::busy(HostSim::networkMicros(2));
+    _lastActivity = millis();
+  }
+  return true;
+}
+
+bool PubSubClient::publish(const char *topic, const uint8_t *payload, unsigned int plength, bool retained)
+{
+  if (!connected())
+    return false;
+
+  // Same size limit as the library: fixed header + topic + payload
+  if (5 + 2 + strlen(topic) + plength > MQTT_MAX_PACKET_SIZE)
+    return false;
+
+  HostSim::busy(HostSim::networkMicros(5 + strlen(topic) + plength));
+  _lastActivity = millis();
+  simPublished++;
+
+  {
+    HostSim::Section section;
+    simLog.push_back({millis(), topic, std::string((const char *)payload, plength)});
+    if (simLog.size() > SIM_MQTT_LOG_DEPTH)
+      simLog.pop_front();
+  }
+
+  if (HostSim::verbose())
+    printf("[%10.3f] mqtt    %s <- %.*s\n", millis() / 1000.0, topic, (int)plength, (const char *)payload);
+  return true;
+}
@@ -0,0 +1,124 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - PubSubClient                      */
+/*                                                      */
+/*  The broker is modelled, not contacted: connect and  */
+/*  publish charge a network round trip to the clock    */
+/*  and published messages are counted.                 */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "Client.h"
+#include "IPAddress.h"
+
+#ifndef MQTT_MAX_PACKET_SIZE
+#define MQTT_MAX_PACKET_SIZE 128
+#endif
+
+#ifndef MQTT_KEEPALIVE
+#define MQTT_KEEPALIVE 15
+#endif
+
+#ifndef MQTT_SOCKET_TIMEOUT
+#define MQTT_SOCKET_TIMEOUT 15
+#endif
+
+#define MQTT_CONNECTION_TIMEOUT     -4
+#define MQTT_CONNECTION_LOST        -3
+#define MQTT_CONNECT_FAILED         -2
+#define MQTT_DISCONNECTED           -1
+#define MQTT_CONNECTED               0
+#define MQTT_CONNECT_BAD_PROTOCOL    1
+#define MQTT_CONNECT_BAD_CLIENT_ID   2
+#define MQTT_CONNECT_UNAVAILABLE     3
+#define MQTT_CONNECT_BAD_CREDENTIALS 4
+#define MQTT_CONNECT_UNAUTHORIZED    5
+
+#define MQTT_CALLBACK_SIGNATURE std::function<void(char *, uint8_t *, unsigned int)> callback
+
+// Published message record (simulation only)
+struct MqttSimMessage
+{
+  unsigned long at;
+  std::string topic;
+  std::string payload;
+};
+
+class PubSubClient
+{
+  public:
+    PubSubClient() {}
+    PubSubClient(Client &client) : _client(&client) {}
+
+    PubSubClient &setServer(const char *domain, uint16_t port);
+    PubSubClient &setServer(IPAddress ip, uint16_t port)
+    {
+      _ip = ip.toString().c_str();
+      return setServer(_ip.c_str(), port);
+    }
+    PubSubClient &setCallback(MQTT_CALLBACK_SIGNATURE)
+    {
+      return *this;
+    }
+    PubSubClient &setClient(Client &client)
+    {
+      _client = &client;
+      return *this;
+    }
+    PubSubClient &setKeepAlive(uint16_t keepAlive)
+    {
+      _keepAlive = keepAlive;
+      return *this;
+    }
+    PubSubClient &setSocketTimeout(uint16_t timeout)
+    {
+      _socketTimeout = timeout;
+      return *this;
+    }
+
+    bool connect(const char *id)
+    {
+      return connect(id, nullptr, nullptr);
+    }
+    bool connect(const char *id, const char *user, const char *pass);
+    void disconnect();
+    bool publish(const char *topic, const char *payload)
+    {
+      return publish(topic, (const uint8_t *)payload, strlen(payload), false);
+    }
+    bool publish(const char *topic, const char *payload, bool retained)
+    {
+      return publish(topic, (const uint8_t *)payload, strlen(payload), retained);
+    }
+    bool publish(const char *topic, const uint8_t *payload, unsigned int plength, bool retained = false);
+    bool subscribe(const char *topic, uint8_t qos = 0)
+    {
+      return connected();
+    }
+    bool loop();
+    bool connected();
+    int state()
+    {
+      return _state;
+    }
+
+    // Simulation hooks
+    static uint32_t simPublished;
+    static uint32_t simConnects;
+    static std::deque<MqttSimMessage> simLog;   // Last messages, newest at the back
+
+  private:
+    Client *_client = nullptr;
+    const char *_domain = nullptr;    // Like the real client, not copied
+    std::string _ip;
+    int _state = MQTT_DISCONNECTED;
+    unsigned long _lastActivity = 0;
+    uint16_t _keepAlive = MQTT_KEEPALIVE;
+    uint16_t _socketTimeout = MQTT_SOCKET_TIMEOUT;
+};
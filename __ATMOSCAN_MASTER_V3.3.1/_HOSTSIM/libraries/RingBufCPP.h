@@ -0,0 +1,72 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - Embedded_RingBuf_CPP              */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+template <typename Type, size_t MaxElements>
+class RingBufCPP
+{
+  public:
+    RingBufCPP() {}
+
+    // Adds an element, optionally overwriting the oldest one when full
+    bool add(const Type &obj, bool overwrite = false)
+    {
+      bool full = isFull();
+      if (full && !overwrite)
+        return false;
+      _buf[_head] = obj;
+      _head = (_head + 1) % MaxElements;
+      if (full)
+        _tail = (_tail + 1) % MaxElements;
+      else
+        _numElements++;
+      return true;
+    }
+
+    // Removes the oldest element
+    bool pull(Type *dest)
+    {
+      if (isEmpty())
+        return false;
+      *dest = _buf[_tail];
+      _tail = (_tail + 1) % MaxElements;
+      _numElements--;
+      return true;
+    }
+
+    // Element num (0 = oldest), nullptr if out of range
+    Type *peek(size_t num)
+    {
+      if (num >= _numElements)
+        return nullptr;
+      return &_buf[(_tail + num) % MaxElements];
+    }
+
+    bool isFull()
+    {
+      return _numElements >= MaxElements;
+    }
+    bool isEmpty()
+    {
+      return _numElements == 0;
+    }
+    size_t numElements()
+    {
+      return _numElements;
+    }
+
+  private:
+    Type _buf[MaxElements];
+    size_t _head = 0;
+    size_t _tail = 0;
+    size_t _numElements = 0;
+};
@@ -0,0 +1,43 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - ESP8266_Syslog                    */
+/*                                                      */
+/********************************************************/
+
+#include <stdarg.h>
+#include "Syslog.h"
+#include "HostSim.h"
+
+uint32_t Syslog::simMessages = 0;
+
+static const char *const priorityNames[] = {"EMERG", "ALERT", "CRIT", "ERR", "WARNING", "NOTICE", "INFO", "DEBUG"};
+
+bool Syslog::send(uint16_t pri, const char *message)
+{
+  if (!(LOG_MASK(LOG_PRI(pri)) & _priMask))
+    return true;
+  if (_server.empty() || !WiFi.isConnected())
+    return false;
+
+  simMessages++;
+
+  // One UDP datagram (~100 bytes of header + message)
+  HostSim::busy(HostSim::networkMicros(100 + strlen(message)));
+
+  if (HostSim::verbose())
+    printf("[%10.3f] syslog %-7s %s\n", millis() / 1000.0, priorityNames[LOG_PRI(pri)], message);
+  return true;
+}
+
+bool Syslog::logf(uint16_t pri, const char *fmt, ...)
+{
+  char message[256];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(message, sizeof(message), fmt, args);
+  va_end(args);
+  return send(pri, message);
+}
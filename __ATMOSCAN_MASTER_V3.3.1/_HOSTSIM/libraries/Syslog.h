@@ -0,0 +1,117 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - ESP8266_Syslog                    */
+/*                                                      */
+/*  Messages are counted and, with --verbose, echoed    */
+/*  on stdout instead of being sent over UDP.           */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "ESP8266WiFi.h"
+
+#define SYSLOG_PROTO_IETF 0
+#define SYSLOG_PROTO_BSD 1
+
+#define SYSLOG_NILVALUE "-"
+
+// Priorities
+#define LOG_EMERG 0
+#define LOG_ALERT 1
+#define LOG_CRIT 2
+#define LOG_ERR 3
+#define LOG_WARNING 4
+#define LOG_NOTICE 5
+#define LOG_INFO 6
+#define LOG_DEBUG 7
+
+#define LOG_PRIMASK 0x07
+#define LOG_PRI(p) ((p) & LOG_PRIMASK)
+#define LOG_MAKEPRI(fac, pri) (((fac) << 3) | (pri))
+
+// Facilities
+#define LOG_KERN (0 << 3)
+#define LOG_USER (1 << 3)
+#define LOG_DAEMON (3 << 3)
+#define LOG_LOCAL0 (16 << 3)
+
+#define LOG_MASK(pri) (1 << (pri))
+#define LOG_UPTO(pri) ((1 << ((pri) + 1)) - 1)
+
+class Syslog
+{
+  public:
+    Syslog(UDP &client, uint8_t protocol = SYSLOG_PROTO_IETF) : _client(client), _protocol(protocol) {}
+
+    Syslog &server(const char *server, uint16_t port)
+    {
+      _server = server ? server : "";
+      return *this;
+    }
+    Syslog &server(IPAddress ip, uint16_t port)
+    {
+      _server = ip.toString().c_str();
+      return *this;
+    }
+    Syslog &deviceHostname(const char *deviceHostname)
+    {
+      _deviceHostname = deviceHostname ? deviceHostname : SYSLOG_NILVALUE;
+      return *this;
+    }
+    Syslog &appName(const char *appName)
+    {
+      _appName = appName ? appName : SYSLOG_NILVALUE;
+      return *this;
+    }
+    Syslog &defaultPriority(uint16_t pri = LOG_KERN)
+    {
+      _priDefault = pri;
+      return *this;
+    }
+    Syslog &logMask(uint8_t priMask)
+    {
+      _priMask = priMask;
+      return *this;
+    }
+
+    bool log(uint16_t pri, const __FlashStringHelper *message)
+    {
+      return send(pri, (const char *)message);
+    }
+    bool log(uint16_t pri, const String &message)
+    {
+      return send(pri, message.c_str());
+    }
+    bool log(uint16_t pri, const char *message)
+    {
+      return send(pri, message);
+    }
+    bool log(const String &message)
+    {
+      return send(_priDefault, message.c_str());
+    }
+    bool log(const char *message)
+    {
+      return send(_priDefault, message);
+    }
+    bool logf(uint16_t pri, const char *fmt, ...);
+
+    // Simulation hooks
+    static uint32_t simMessages;
+
+  private:
+    UDP &_client;
+    uint8_t _protocol;
+    std::string _server;
+    std::string _deviceHostname = SYSLOG_NILVALUE;
+    std::string _appName = SYSLOG_NILVALUE;
+    uint16_t _priDefault = LOG_KERN;
+    uint8_t _priMask = 0xff;
+
+    bool send(uint16_t pri, const char *message);
+};
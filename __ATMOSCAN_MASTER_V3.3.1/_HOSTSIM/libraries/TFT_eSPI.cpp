@@ -0,0 +1,1047 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - TFT_eSPI (ILI9341 240x320)        */
+/*                                                      */
+/*  Primitive and text semantics follow Bodmer's        */
+/*  TFT_eSPI 1.x, which the firmware is written for.    */
+/*                                                      */
+/********************************************************/
+
+#include "TFT_eSPI.h"
+#include "HostSim.h"
+
+#include <new>
+
+// Bytes sent on the bus to open an address window (CASET + PASET + RAMWR)
+#define WINDOW_BYTES 11
+
+// -------------------------------------------------------
+// Metric-only free fonts
+// -------------------------------------------------------
+
+namespace
+{
+const int metricSizes[4] = {22, 29, 42, 56};   // yAdvance of the 9, 12, 18 and 24pt faces
+GFXglyph metricGlyphs[4][95];
+
+GFXfont makeMetricFont(int sizeIndex)
+{
+  int yAdvance = metricSizes[sizeIndex];
+  for (int c = 0; c < 95; c++)
+  {
+    GFXglyph &g = metricGlyphs[sizeIndex][c];
+    g.bitmapOffset = 0;
+    g.xAdvance = c == 0 ? yAdvance / 4 : yAdvance * 46 / 100;
+    g.width = c == 0 ? 0 : g.xAdvance - 2;
+    g.height = yAdvance * 6 / 10;
+    g.xOffset = 1;
+    g.yOffset = -g.height;
+  }
+  GFXfont f = {nullptr, metricGlyphs[sizeIndex], 0x20, 0x7E, (uint8_t)yAdvance};
+  return f;
+}
+}
+
+#define METRIC_FONT_FAMILY(name) \
+  const GFXfont name##9pt7b = makeMetricFont(0); \
+  const GFXfont name##12pt7b = makeMetricFont(1); \
+  const GFXfont name##18pt7b = makeMetricFont(2); \
+  const GFXfont name##24pt7b = makeMetricFont(3);
+
+METRIC_FONT_FAMILY(FreeMono)
+METRIC_FONT_FAMILY(FreeMonoBold)
+METRIC_FONT_FAMILY(FreeMonoOblique)
+METRIC_FONT_FAMILY(FreeMonoBoldOblique)
+METRIC_FONT_FAMILY(FreeSans)
+METRIC_FONT_FAMILY(FreeSansBold)
+METRIC_FONT_FAMILY(FreeSansOblique)
+METRIC_FONT_FAMILY(FreeSansBoldOblique)
+METRIC_FONT_FAMILY(FreeSerif)
+METRIC_FONT_FAMILY(FreeSerifBold)
+METRIC_FONT_FAMILY(FreeSerifItalic)
+METRIC_FONT_FAMILY(FreeSerifBoldItalic)
+
+// Built-in numbered fonts: height and average advance
+static void builtinMetrics(uint8_t font, int &height, int &advance)
+{
+  switch (font)
+  {
+    case 2:
+      height = 16;
+      advance = 8;
+      break;
+    case 4:
+      height = 26;
+      advance = 14;
+      break;
+    case 6:
+      height = 48;
+      advance = 26;
+      break;
+    case 7:
+      height = 48;
+      advance = 32;
+      break;
+    case 8:
+      height = 75;
+      advance = 55;
+      break;
+    default:
+      height = 8;
+      advance = 6;
+      break;
+  }
+}
+
+// -------------------------------------------------------
+// Setup
+// -------------------------------------------------------
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+{
+  _init_width = _width = w;
+  _init_height = _height = h;
+
+  // Panel memory, not ESP8266 heap (sprites allocate theirs in createSprite())
+  if (w <= 0 || h <= 0)
+    return;
+  HostSim::Section section;
+  frame = new uint16_t[(size_t)w * h];
+  memset(frame, 0, (size_t)w * h * sizeof(uint16_t));
+}
+
+TFT_eSPI::~TFT_eSPI()
+{
+  HostSim::Section section;
+  delete[] frame;
+}
+
+void TFT_eSPI::init()
+{
+  // Reset + initialisation sequence of the ILI9341 driver
+  HostSim::busy(150000);
+}
+
+void TFT_eSPI::setRotation(uint8_t r)
+{
+  rotation = r % 8;
+  if (rotation & 1)
+  {
+    _width = _init_height;
+    _height = _init_width;
+  }
+  else
+  {
+    _width = _init_width;
+    _height = _init_height;
+  }
+  busWindow();
+}
+
+void TFT_eSPI::physical(int32_t x, int32_t y, int32_t &px, int32_t &py)
+{
+  // Rotations 4-7 mirror the vertical axis (used to draw bottom-up BMPs)
+  if (rotation >= 4)
+    y = _height - 1 - y;
+
+  switch (rotation & 3)
+  {
+    case 0:
+      px = x;
+      py = y;
+      break;
+    case 1:
+      px = _init_width - 1 - y;
+      py = x;
+      break;
+    case 2:
+      px = _init_width - 1 - x;
+      py = _init_height - 1 - y;
+      break;
+    default:
+      px = y;
+      py = _init_height - 1 - x;
+      break;
+  }
+}
+
+void TFT_eSPI::plot(int32_t x, int32_t y, uint16_t color)
+{
+  if (x < 0 || y < 0 || x >= _width || y >= _height)
+    return;
+  int32_t px, py;
+  physical(x, y, px, py);
+  frame[py * _init_width + px] = color;
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y)
+{
+  if (x < 0 || y < 0 || x >= _width || y >= _height)
+    return 0;
+  int32_t px, py;
+  physical(x, y, px, py);
+  busWindow();
+  busPixels(1);
+  return frame[py * _init_width + px];
+}
+
+// -------------------------------------------------------
+// Bus model
+// -------------------------------------------------------
+
+void TFT_eSPI::busWindow()
+{
+  if (!accountBus)
+    return;
+  stats.windows++;
+  uint32_t us = HostSim::spiMicros(WINDOW_BYTES);
+  stats.busMicros += us;
+  HostSim::busy(us);
+}
+
+void TFT_eSPI::busPixels(uint64_t count)
+{
+  if (!accountBus || !count)
+    return;
+  stats.pixels += count;
+  uint32_t us = HostSim::spiMicros(count * 2);
+  stats.busMicros += us;
+  HostSim::busy(us);
+}
+
+void TFT_eSPI::resetStats()
+{
+  stats = {0, 0, 0};
+}
+
+bool TFT_eSPI::savePPM(const char *filename)
+{
+  FILE *f = fopen(filename, "wb");
+  if (!f)
+    return false;
+  fprintf(f, "P6\n%d %d\n255\n", _width, _height);
+  for (int32_t y = 0; y < _height; y++)
+  {
+    for (int32_t x = 0; x < _width; x++)
+    {
+      int32_t px, py;
+      physical(x, y, px, py);
+      uint16_t c = frame[py * _init_width + px];
+      uint8_t rgb[3] = {(uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)((c << 3) & 0xF8)};
+      fwrite(rgb, 1, 3, f);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+// -------------------------------------------------------
+// Primitives
+// -------------------------------------------------------
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+  if (x < 0 || y < 0 || x >= _width || y >= _height)
+    return;
+  busWindow();
+  busPixels(1);
+  plot(x, y, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  // Clip
+  if (x < 0)
+  {
+    w += x;
+    x = 0;
+  }
+  if (y < 0)
+  {
+    h += y;
+    y = 0;
+  }
+  if (x + w > _width)
+    w = _width - x;
+  if (y + h > _height)
+    h = _height - y;
+  if (w <= 0 || h <= 0)
+    return;
+
+  busWindow();
+  busPixels((uint64_t)w * h);
+  for (int32_t j = y; j < y + h; j++)
+    for (int32_t i = x; i < x + w; i++)
+      plot(i, j, color);
+}
+
+void TFT_eSPI::fillScreen(uint32_t color)
+{
+  fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+{
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep)
+  {
+    std::swap(x0, y0);
+    std::swap(x1, y1);
+  }
+  if (x0 > x1)
+  {
+    std::swap(x0, x1);
+    std::swap(y0, y1);
+  }
+
+  int32_t dx = x1 - x0, dy = abs(y1 - y0);
+  int32_t err = dx >> 1, ystep = (y0 < y1) ? 1 : -1;
+
+  // Like TFT_eSPI, consecutive pixels on a scan line share one window
+  int32_t runStart = x0;
+  for (int32_t x = x0; x <= x1; x++)
+  {
+    err -= dy;
+    if (err < 0 || x == x1)
+    {
+      int32_t len = x - runStart + 1;
+      if (steep)
+        fillRect(y0, runStart, 1, len, color);
+      else
+        fillRect(runStart, y0, len, 1, color);
+      if (err < 0)
+      {
+        y0 += ystep;
+        err += dx;
+      }
+      runStart = x + 1;
+    }
+  }
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
+{
+  int32_t f = 1 - r, ddF_y = -2 * r, ddF_x = 1, x = 0, y = r;
+
+  drawPixel(x0 + r, y0, color);
+  drawPixel(x0 - r, y0, color);
+  drawPixel(x0, y0 - r, color);
+  drawPixel(x0, y0 + r, color);
+
+  while (x < y)
+  {
+    if (f >= 0)
+    {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    drawPixel(x0 + x, y0 + y, color);
+    drawPixel(x0 - x, y0 + y, color);
+    drawPixel(x0 - x, y0 - y, color);
+    drawPixel(x0 + x, y0 - y, color);
+    drawPixel(x0 + y, y0 + x, color);
+    drawPixel(x0 - y, y0 + x, color);
+    drawPixel(x0 - y, y0 - x, color);
+    drawPixel(x0 + y, y0 - x, color);
+  }
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
+{
+  int32_t x = 0, dx = 1, dy = r + r, p = -(r >> 1);
+
+  drawFastHLine(x0 - r, y0, dy + 1, color);
+
+  while (x < r)
+  {
+    if (p >= 0)
+    {
+      drawFastHLine(x0 - x, y0 + r, 2 * x + 1, color);
+      drawFastHLine(x0 - x, y0 - r, 2 * x + 1, color);
+      dy -= 2;
+      p -= dy;
+      r--;
+    }
+    dx += 2;
+    p += dx;
+    x++;
+    drawFastHLine(x0 - r, y0 + x, 2 * r + 1, color);
+    drawFastHLine(x0 - r, y0 - x, 2 * r + 1, color);
+  }
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color)
+{
+  drawFastHLine(x + r, y, w - 2 * r, color);
+  drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+  drawFastVLine(x, y + r, h - 2 * r, color);
+  drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+
+  // Corners
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, px = 0, py = r;
+  while (px < py)
+  {
+    if (f >= 0)
+    {
+      py--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    px++;
+    ddF_x += 2;
+    f += ddF_x;
+    drawPixel(x + w - 1 - r + px, y + r - py, color);
+    drawPixel(x + w - 1 - r + py, y + r - px, color);
+    drawPixel(x + w - 1 - r + px, y + h - 1 - r + py, color);
+    drawPixel(x + w - 1 - r + py, y + h - 1 - r + px, color);
+    drawPixel(x + r - px, y + h - 1 - r + py, color);
+    drawPixel(x + r - py, y + h - 1 - r + px, color);
+    drawPixel(x + r - px, y + r - py, color);
+    drawPixel(x + r - py, y + r - px, color);
+  }
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color)
+{
+  fillRect(x, y + r, w, h - 2 * r, color);
+
+  // Top and bottom caps
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, px = 0, py = r;
+  int32_t delta = w - 2 * r - 1;
+  while (px < py)
+  {
+    if (f >= 0)
+    {
+      py--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    px++;
+    ddF_x += 2;
+    f += ddF_x;
+    drawFastHLine(x + r - px, y + r - py, 2 * px + 1 + delta, color);
+    drawFastHLine(x + r - py, y + r - px, 2 * py + 1 + delta, color);
+    drawFastHLine(x + r - px, y + h - 1 - r + py, 2 * px + 1 + delta, color);
+    drawFastHLine(x + r - py, y + h - 1 - r + px, 2 * py + 1 + delta, color);
+  }
+}
+
+void TFT_eSPI::drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+}
+
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+  // Sort by y
+  if (y0 > y1)
+  {
+    std::swap(y0, y1);
+    std::swap(x0, x1);
+  }
+  if (y1 > y2)
+  {
+    std::swap(y2, y1);
+    std::swap(x2, x1);
+  }
+  if (y0 > y1)
+  {
+    std::swap(y0, y1);
+    std::swap(x0, x1);
+  }
+
+  if (y0 == y2)
+  {
+    int32_t a = std::min({x0, x1, x2}), b = std::max({x0, x1, x2});
+    drawFastHLine(a, y0, b - a + 1, color);
+    return;
+  }
+
+  for (int32_t y = y0; y <= y2; y++)
+  {
+    int32_t a, b;
+    b = x0 + (int64_t)(x2 - x0) * (y - y0) / (y2 - y0);
+    if (y < y1 || y1 == y2)
+      a = y1 == y0 ? x1 : x0 + (int64_t)(x1 - x0) * (y - y0) / (y1 - y0);
+    else
+      a = x1 + (int64_t)(x2 - x1) * (y - y1) / (y2 - y1);
+    if (a > b)
+      std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+// -------------------------------------------------------
+// Pixel streaming
+// -------------------------------------------------------
+
+void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  win_x0 = x0;
+  win_y0 = y0;
+  win_x1 = x1;
+  win_y1 = y1;
+  win_xp = x0;
+  win_yp = y0;
+  busWindow();
+}
+
+void TFT_eSPI::pushColor(uint16_t color)
+{
+  busPixels(1);
+  plot(win_xp, win_yp, color);
+  if (++win_xp > win_x1)
+  {
+    win_xp = win_x0;
+    if (++win_yp > win_y1)
+      win_yp = win_y0;
+  }
+}
+
+void TFT_eSPI::pushColor(uint16_t color, uint32_t len)
+{
+  bool account = accountBus;
+  busPixels(len);
+  accountBus = false;
+  while (len--)
+    pushColor(color);
+  accountBus = account;
+}
+
+void TFT_eSPI::pushColors(uint16_t *data, uint32_t len, bool swap)
+{
+  bool account = accountBus;
+  busPixels(len);
+  accountBus = false;
+  while (len--)
+  {
+    uint16_t c = *data++;
+    pushColor(swap ? c : (uint16_t)((c >> 8) | (c << 8)));
+  }
+  accountBus = account;
+}
+
+void TFT_eSPI::pushColors(uint8_t *data, uint32_t len)
+{
+  // Byte stream already in panel (big endian) order
+  bool account = accountBus;
+  busPixels(len / 2);
+  accountBus = false;
+  for (uint32_t i = 0; i + 1 < len; i += 2)
+    pushColor((uint16_t)((data[i] << 8) | data[i + 1]));
+  accountBus = account;
+}
+
+void TFT_eSPI::pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+{
+  setWindow(x, y, x + w - 1, y + h - 1);
+  pushColors(data, w * h);
+}
+
+void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+{
+  busWindow();
+  busPixels((uint64_t)w * h);
+  for (int32_t j = 0; j < h; j++)
+    for (int32_t i = 0; i < w; i++)
+    {
+      int32_t lx = x + i, ly = y + j;
+      uint16_t c = 0;
+      if (lx >= 0 && ly >= 0 && lx < _width && ly < _height)
+      {
+        int32_t px, py;
+        physical(lx, ly, px, py);
+        c = frame[py * _init_width + px];
+      }
+      *data++ = c;
+    }
+}
+
+// -------------------------------------------------------
+// Text
+// -------------------------------------------------------
+
+void TFT_eSPI::setFreeFont(const GFXfont *f)
+{
+  textfont = 1;
+  gfxFont = f;
+}
+
+int16_t TFT_eSPI::charWidth(uint16_t c, uint8_t font)
+{
+  if (font == 1 && gfxFont)
+  {
+    if (c < gfxFont->first || c > gfxFont->last)
+      return 0;
+    return gfxFont->glyph[c - gfxFont->first].xAdvance * textsize;
+  }
+  int height, advance;
+  builtinMetrics(font, height, advance);
+  return advance * textsize;
+}
+
+int16_t TFT_eSPI::textWidth(const char *string, uint8_t font)
+{
+  int16_t w = 0;
+  while (*string)
+    w += charWidth((uint8_t)*string++, font);
+  return w;
+}
+
+int16_t TFT_eSPI::textWidth(const char *string)
+{
+  return textWidth(string, textfont);
+}
+
+int16_t TFT_eSPI::textWidth(const String &string, uint8_t font)
+{
+  return textWidth(string.c_str(), font);
+}
+
+int16_t TFT_eSPI::textWidth(const String &string)
+{
+  return textWidth(string.c_str(), textfont);
+}
+
+int16_t TFT_eSPI::fontHeight(int16_t font)
+{
+  if (font == 1 && gfxFont)
+    return gfxFont->yAdvance * textsize;
+  int height, advance;
+  builtinMetrics(font, height, advance);
+  return height * textsize;
+}
+
+int16_t TFT_eSPI::fontHeight()
+{
+  return fontHeight(textfont);
+}
+
+// Renders one character with its top-left (or baseline for free fonts) at x,y
+int16_t TFT_eSPI::drawGlyph(uint16_t c, int32_t x, int32_t y, uint8_t font)
+{
+  if (font == 1 && gfxFont)
+  {
+    if (c < gfxFont->first || c > gfxFont->last)
+      return 0;
+    const GFXglyph &g = gfxFont->glyph[c - gfxFont->first];
+    int32_t gx = x + g.xOffset * textsize, gy = y + g.yOffset * textsize;
+
+    if (!gfxFont->bitmap)
+    {
+      // Metric-only font: draw the glyph box outline
+      if (g.width && g.height)
+        drawRect(gx, gy, g.width * textsize, g.height * textsize, textcolor);
+      return g.xAdvance * textsize;
+    }
+
+    // Set pixels are emitted as horizontal runs, one window each
+    const uint8_t *bitmap = gfxFont->bitmap + g.bitmapOffset;
+    uint32_t bit = 0;
+    for (int32_t yy = 0; yy < g.height; yy++)
+    {
+      int32_t runStart = -1;
+      for (int32_t xx = 0; xx <= g.width; xx++)
+      {
+        bool set = false;
+        if (xx < g.width)
+        {
+          set = bitmap[bit >> 3] & (0x80 >> (bit & 7));
+          bit++;
+        }
+        if (set && runStart < 0)
+          runStart = xx;
+        else if (!set && runStart >= 0)
+        {
+          fillRect(gx + runStart * textsize, gy + yy * textsize, (xx - runStart) * textsize, textsize, textcolor);
+          runStart = -1;
+        }
+      }
+    }
+    return g.xAdvance * textsize;
+  }
+
+  // Built-in fonts: character cell with background, glyph approximated by a box
+  int height, advance;
+  builtinMetrics(font, height, advance);
+  advance *= textsize;
+  height *= textsize;
+  if (textbgcolor != textcolor)
+    fillRect(x, y, advance, height, textbgcolor);
+  if (c != ' ')
+    drawRect(x + 1, y + 1, advance - 2, height - 2, textcolor);
+  return advance;
+}
+
+int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8_t font)
+{
+  int16_t sumX = 0;
+  uint8_t padding = 1;
+  int32_t baseline = 0;
+  int16_t cwidth = textWidth(string, font);
+  int16_t cheight = fontHeight(font);
+  int16_t glyph_ab = 0, glyph_bb = 0;
+  bool freeFont = font == 1 && gfxFont;
+
+  if (freeFont)
+  {
+    // Font ascent/descent, as computed by TFT_eSPI::setFreeFont()
+    // NOTE: like the library, the last glyph is not scanned (some fonts lack it)
+    for (uint16_t c = gfxFont->first; c < gfxFont->last; c++)
+    {
+      const GFXglyph &g = gfxFont->glyph[c - gfxFont->first];
+      glyph_ab = std::max<int16_t>(glyph_ab, -g.yOffset);
+      glyph_bb = std::max<int16_t>(glyph_bb, g.height + g.yOffset);
+    }
+    cheight = glyph_ab * textsize;
+    poY += cheight;
+    baseline = cheight;
+    padding = 101;
+    if (textdatum == BL_DATUM || textdatum == BC_DATUM || textdatum == BR_DATUM)
+      cheight += glyph_bb * textsize;
+  }
+
+  switch (textdatum)
+  {
+    case TC_DATUM:
+      poX -= cwidth / 2;
+      padding += 1;
+      break;
+    case TR_DATUM:
+      poX -= cwidth;
+      padding += 2;
+      break;
+    case ML_DATUM:
+      poY -= cheight / 2;
+      break;
+    case MC_DATUM:
+      poX -= cwidth / 2;
+      poY -= cheight / 2;
+      padding += 1;
+      break;
+    case MR_DATUM:
+      poX -= cwidth;
+      poY -= cheight / 2;
+      padding += 2;
+      break;
+    case BL_DATUM:
+      poY -= cheight;
+      break;
+    case BC_DATUM:
+      poX -= cwidth / 2;
+      poY -= cheight;
+      padding += 1;
+      break;
+    case BR_DATUM:
+      poX -= cwidth;
+      poY -= cheight;
+      padding += 2;
+      break;
+    case L_BASELINE:
+      poY -= baseline;
+      break;
+    case C_BASELINE:
+      poX -= cwidth / 2;
+      poY -= baseline;
+      padding += 1;
+      break;
+    case R_BASELINE:
+      poX -= cwidth;
+      poY -= baseline;
+      padding += 2;
+      break;
+  }
+
+  // Free fonts are transparent, unless a background colour is set: then the
+  // string box is cleared first (TFT_eSPI "free fonts with background" mod)
+  if (freeFont && textcolor != textbgcolor && *string)
+  {
+    const GFXglyph *g = nullptr;
+    if ((uint8_t)string[0] >= gfxFont->first && (uint8_t)string[0] <= gfxFont->last)
+      g = &gfxFont->glyph[(uint8_t)string[0] - gfxFont->first];
+    if (g)
+    {
+      int32_t xo = std::min<int32_t>(g->xOffset * textsize, 0);
+      fillRect(poX + xo, poY - glyph_ab * textsize, cwidth - xo, (glyph_ab + glyph_bb) * textsize, textbgcolor);
+    }
+    padding -= 100;
+  }
+
+  int32_t startX = poX;
+  for (const char *p = string; *p; p++)
+    sumX += drawGlyph((uint8_t)*p, poX + sumX, poY, font);
+
+  // Padding: erase the area around the text up to padX pixels wide
+  if (padX > cwidth && textcolor != textbgcolor)
+  {
+    if (freeFont)
+    {
+      int32_t top = poY - glyph_ab * textsize;
+      int32_t h = (glyph_ab + glyph_bb) * textsize;
+      switch (padding > 100 ? padding - 100 : padding)
+      {
+        case 1:
+          fillRect(startX + cwidth, top, padX - cwidth, h, textbgcolor);
+          break;
+        case 2:
+        {
+          int32_t half = (padX - cwidth) >> 1;
+          fillRect(startX - half, top, half, h, textbgcolor);
+          fillRect(startX + cwidth, top, half + 1, h, textbgcolor);
+          break;
+        }
+        case 3:
+          fillRect(startX - padX + cwidth, top, padX - cwidth, h, textbgcolor);
+          break;
+      }
+    }
+    else
+    {
+      switch (padding)
+      {
+        case 1:
+          fillRect(startX + cwidth, poY, padX - cwidth, cheight, textbgcolor);
+          break;
+        case 2:
+        {
+          int32_t half = (padX - cwidth) >> 1;
+          fillRect(startX - half, poY, half, cheight, textbgcolor);
+          fillRect(startX + cwidth, poY, half + 1, cheight, textbgcolor);
+          break;
+        }
+        case 3:
+          fillRect(startX - padX + cwidth, poY, padX - cwidth, cheight, textbgcolor);
+          break;
+      }
+    }
+  }
+
+  return sumX;
+}
+
+int16_t TFT_eSPI::drawString(const char *string, int32_t x, int32_t y)
+{
+  return drawString(string, x, y, textfont);
+}
+
+int16_t TFT_eSPI::drawString(const String &string, int32_t x, int32_t y, uint8_t font)
+{
+  return drawString(string.c_str(), x, y, font);
+}
+
+int16_t TFT_eSPI::drawString(const String &string, int32_t x, int32_t y)
+{
+  return drawString(string.c_str(), x, y, textfont);
+}
+
+int16_t TFT_eSPI::drawCentreString(const String &string, int32_t x, int32_t y, uint8_t font)
+{
+  uint8_t datum = textdatum;
+  textdatum = TC_DATUM;
+  int16_t w = drawString(string, x, y, font);
+  textdatum = datum;
+  return w;
+}
+
+int16_t TFT_eSPI::drawRightString(const String &string, int32_t x, int32_t y, uint8_t font)
+{
+  uint8_t datum = textdatum;
+  textdatum = TR_DATUM;
+  int16_t w = drawString(string, x, y, font);
+  textdatum = datum;
+  return w;
+}
+
+int16_t TFT_eSPI::drawNumber(long number, int32_t x, int32_t y, uint8_t font)
+{
+  return drawString(String(number), x, y, font);
+}
+
+int16_t TFT_eSPI::drawFloat(float number, uint8_t decimals, int32_t x, int32_t y, uint8_t font)
+{
+  return drawString(String(number, decimals), x, y, font);
+}
+
+// Print support, cursor based (used by println())
+size_t TFT_eSPI::write(uint8_t c)
+{
+  int16_t lineHeight = fontHeight(textfont);
+  if (c == '\r')
+    return 1;
+  if (c == '\n')
+  {
+    cursor_x = 0;
+    cursor_y += lineHeight;
+    return 1;
+  }
+  int16_t w = charWidth(c, textfont);
+  if (textwrapX && cursor_x + w > _width)
+  {
+    cursor_x = 0;
+    cursor_y += lineHeight;
+  }
+  bool freeFont = textfont == 1 && gfxFont;
+  cursor_x += drawGlyph(c, cursor_x, freeFont ? cursor_y + lineHeight * 2 / 3 : cursor_y, textfont);
+  return 1;
+}
+
+// -------------------------------------------------------
+// Sprites
+// -------------------------------------------------------
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft)
+  : TFT_eSPI(0, 0), _tft(tft)
+{
+  accountBus = false;
+  memset(palette, 0, sizeof(palette));
+}
+
+TFT_eSprite::~TFT_eSprite()
+{
+  deleteSprite();
+}
+
+void TFT_eSprite::setColorDepth(int8_t bits)
+{
+  bpp = bits == 4 || bits == 8 ? bits : 16;
+}
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h)
+{
+  if (storage)
+    return storage;
+  if (w <= 0 || h <= 0)
+    return nullptr;
+
+  // What the sprite costs on the ESP8266, rows of 4 bit sprites rounded to a byte
+  size_t bytes = bpp == 4 ? (size_t)((w + 1) / 2) * h : (size_t)w * h * (bpp / 8);
+  // NOTE: through new, which the heap model accounts (malloc is not)
+  storage = new (std::nothrow) uint8_t[bytes];
+  if (!storage)
+    return nullptr;
+  memset(storage, 0, bytes);
+
+  // Pixels as drawn (colours or indexes), on the host
+  {
+    HostSim::Section section;
+    frame = new uint16_t[(size_t)w * h];
+    memset(frame, 0, (size_t)w * h * sizeof(uint16_t));
+  }
+
+  _init_width = _width = w;
+  _init_height = _height = h;
+  rotation = 0;
+  return storage;
+}
+
+void TFT_eSprite::deleteSprite()
+{
+  if (!storage)
+    return;
+  delete[] (uint8_t *)storage;
+  storage = nullptr;
+
+  HostSim::Section section;
+  delete[] frame;
+  frame = nullptr;
+  _init_width = _width = 0;
+  _init_height = _height = 0;
+}
+
+void TFT_eSprite::createPalette(const uint16_t *colors, uint8_t count)
+{
+  for (uint8_t i = 0; i < 16; i++)
+    palette[i] = i < count ? colors[i] : TFT_BLACK;
+}
+
+void TFT_eSprite::fillSprite(uint32_t color)
+{
+  fillRect(0, 0, _width, _height, color);
+}
+
+uint16_t TFT_eSprite::color565(uint16_t stored)
+{
+  if (bpp == 4)
+    return palette[stored & 0x0F];
+  if (bpp == 8)
+  {
+    // Through RGB332, as stored by the library
+    uint8_t c = ((stored & 0xE000) >> 8) | ((stored & 0x0700) >> 6) | ((stored & 0x0018) >> 3);
+    uint16_t r = (c & 0xE0) >> 5, g = (c & 0x1C) >> 2, b = c & 0x03;
+    return (uint16_t)((r * 31 / 7) << 11 | (g * 63 / 7) << 5 | (b * 31 / 3));
+  }
+  return stored;
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y)
+{
+  pushSprite(x, y, 0, 0, _width, _height);
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh)
+{
+  // Clip the area to the sprite
+  if (!storage)
+    return false;
+  if (sx < 0)
+  {
+    tx -= sx;
+    sw += sx;
+    sx = 0;
+  }
+  if (sy < 0)
+  {
+    ty -= sy;
+    sh += sy;
+    sy = 0;
+  }
+  if (sx + sw > _width)
+    sw = _width - sx;
+  if (sy + sh > _height)
+    sh = _height - sy;
+  if (sw <= 0 || sh <= 0)
+    return false;
+
+  // One window, rows converted to RGB565 a chunk at a time
+  uint16_t line[64];
+  _tft->setWindow(tx, ty, tx + sw - 1, ty + sh - 1);
+  for (int32_t j = sy; j < sy + sh; j++)
+  {
+    for (int32_t i = sx; i < sx + sw; )
+    {
+      uint32_t n = 0;
+      while (n < 64 && i < sx + sw)
+        line[n++] = color565(frame[j * _init_width + i++]);
+      _tft->pushColors(line, n);
+    }
+  }
+  return true;
+}
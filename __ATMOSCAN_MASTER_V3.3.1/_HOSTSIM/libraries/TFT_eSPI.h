@@ -0,0 +1,287 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - TFT_eSPI (ILI9341 240x320)        */
+/*                                                      */
+/*  Draws into an RGB565 frame buffer and models the    */
+/*  SPI traffic every primitive would cause, charging   */
+/*  its transfer time to the simulated clock.           */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+#define TFT_WIDTH  240
+#define TFT_HEIGHT 320
+
+// Colours (RGB565)
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xC618
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFC9F
+
+// Text datums
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE 9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+// Adafruit GFX font format
+typedef struct
+{
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct
+{
+  uint8_t *bitmap;
+  GFXglyph *glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+
+// Bus statistics accumulated since the last reset
+struct TFTStats
+{
+  uint32_t windows;       // Address window (CASET/PASET/RAMWR) commands
+  uint64_t pixels;        // Pixels transferred
+  uint64_t busMicros;     // Modelled SPI busy time
+};
+
+class TFT_eSPI : public Print
+{
+  public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    virtual ~TFT_eSPI();
+
+    void init();
+    void begin()
+    {
+      init();
+    }
+
+    void setRotation(uint8_t r);
+    uint8_t getRotation()
+    {
+      return rotation;
+    }
+    int16_t width()
+    {
+      return _width;
+    }
+    int16_t height()
+    {
+      return _height;
+    }
+
+    // Graphics primitives
+    virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+    virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void fillScreen(uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRoundRect(int32_t x0, int32_t y0, int32_t w, int32_t h, int32_t radius, uint32_t color);
+    void fillRoundRect(int32_t x0, int32_t y0, int32_t w, int32_t h, int32_t radius, uint32_t color);
+    void drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+    void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+    void drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+    void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+
+    // Pixel streaming
+    virtual void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+    void setAddrWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+    {
+      setWindow(x0, y0, x1, y1);
+    }
+    virtual void pushColor(uint16_t color);
+    void pushColor(uint16_t color, uint32_t len);
+    virtual void pushColors(uint16_t *data, uint32_t len, bool swap = true);
+    void pushColors(uint8_t *data, uint32_t len);
+    void pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+    void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+    uint16_t readPixel(int32_t x, int32_t y);
+
+    // Text
+    void setCursor(int16_t x, int16_t y)
+    {
+      cursor_x = x;
+      cursor_y = y;
+    }
+    void setTextColor(uint16_t color)
+    {
+      textcolor = textbgcolor = color;
+    }
+    void setTextColor(uint16_t fgcolor, uint16_t bgcolor)
+    {
+      textcolor = fgcolor;
+      textbgcolor = bgcolor;
+    }
+    void setTextSize(uint8_t size)
+    {
+      textsize = size > 0 ? size : 1;
+    }
+    void setTextWrap(bool wrapX, bool wrapY = false)
+    {
+      textwrapX = wrapX;
+    }
+    void setTextDatum(uint8_t datum)
+    {
+      textdatum = datum;
+    }
+    uint8_t getTextDatum()
+    {
+      return textdatum;
+    }
+    void setTextPadding(uint16_t x_width)
+    {
+      padX = x_width;
+    }
+    void setTextFont(uint8_t font)
+    {
+      textfont = font;
+      gfxFont = nullptr;
+    }
+    void setFreeFont(const GFXfont *f = nullptr);
+
+    int16_t drawString(const String &string, int32_t x, int32_t y, uint8_t font);
+    int16_t drawString(const String &string, int32_t x, int32_t y);
+    int16_t drawString(const char *string, int32_t x, int32_t y, uint8_t font);
+    int16_t drawString(const char *string, int32_t x, int32_t y);
+    int16_t drawCentreString(const String &string, int32_t x, int32_t y, uint8_t font);
+    int16_t drawRightString(const String &string, int32_t x, int32_t y, uint8_t font);
+    int16_t drawNumber(long number, int32_t x, int32_t y, uint8_t font);
+    int16_t drawFloat(float number, uint8_t decimals, int32_t x, int32_t y, uint8_t font);
+
+    int16_t textWidth(const String &string, uint8_t font);
+    int16_t textWidth(const String &string);
+    int16_t textWidth(const char *string, uint8_t font);
+    int16_t textWidth(const char *string);
+    int16_t fontHeight(int16_t font);
+    int16_t fontHeight();
+
+    virtual size_t write(uint8_t c);
+    using Print::write;
+
+    // Simulation hooks
+    const TFTStats &getStats() const
+    {
+      return stats;
+    }
+    void resetStats();
+    bool savePPM(const char *filename);
+
+  protected:
+    int16_t _init_width, _init_height;
+    int16_t _width, _height;
+    uint8_t rotation = 0;
+    uint16_t *frame = nullptr;       // Physical panel memory
+    bool accountBus = true;          // Sprites do not touch the SPI bus
+
+    int32_t win_x0 = 0, win_y0 = 0, win_x1 = 0, win_y1 = 0, win_xp = 0, win_yp = 0;
+
+    int16_t cursor_x = 0, cursor_y = 0;
+    uint16_t textcolor = TFT_WHITE, textbgcolor = TFT_BLACK;
+    uint8_t textsize = 1, textfont = 1, textdatum = TL_DATUM;
+    uint16_t padX = 0;
+    bool textwrapX = true;
+    const GFXfont *gfxFont = nullptr;
+
+    TFTStats stats = {0, 0, 0};
+
+    // Frame buffer access in the current rotation, unclipped writes are dropped
+    void plot(int32_t x, int32_t y, uint16_t color);
+    void physical(int32_t x, int32_t y, int32_t &px, int32_t &py);
+
+    // Bus modelling
+    void busWindow();
+    void busPixels(uint64_t count);
+
+    int16_t drawGlyph(uint16_t c, int32_t x, int32_t y, uint8_t font);
+    int16_t charWidth(uint16_t c, uint8_t font);
+};
+
+// Off-screen canvas (TFT_eSPI Extensions/Sprite.h): drawn with the same primitives
+// without touching the bus, then pushed to the parent display in one window.
+// In 4 bit colour depth the colours drawn are palette indexes (0-15).
+class TFT_eSprite : public TFT_eSPI
+{
+  public:
+    TFT_eSprite(TFT_eSPI *tft);
+    virtual ~TFT_eSprite();
+
+    // Before createSprite(): 16, 8 (RGB332) or 4 (palette) bits per pixel
+    void setColorDepth(int8_t bits);
+    void *createSprite(int16_t w, int16_t h);
+    void deleteSprite();
+    bool created()
+    {
+      return storage != nullptr;
+    }
+
+    void createPalette(const uint16_t *colors, uint8_t count = 16);
+    void fillSprite(uint32_t color);
+
+    void pushSprite(int32_t x, int32_t y);
+    // Area (sx, sy, sw, sh) of the sprite, drawn at (tx, ty)
+    bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+  private:
+    TFT_eSPI *_tft;
+    uint8_t bpp = 16;
+    uint16_t palette[16];
+    void *storage = nullptr;         // Sprite memory on the ESP heap (frame holds the pixels on the host)
+
+    uint16_t color565(uint16_t stored);
+};
+
+// Free fonts shipped with TFT_eSPI (metrics only on the host)
+extern const GFXfont FreeMono9pt7b, FreeMono12pt7b, FreeMono18pt7b, FreeMono24pt7b;
+extern const GFXfont FreeMonoBold9pt7b, FreeMonoBold12pt7b, FreeMonoBold18pt7b, FreeMonoBold24pt7b;
+extern const GFXfont FreeMonoOblique9pt7b, FreeMonoOblique12pt7b, FreeMonoOblique18pt7b, FreeMonoOblique24pt7b;
+extern const GFXfont FreeMonoBoldOblique9pt7b, FreeMonoBoldOblique12pt7b, FreeMonoBoldOblique18pt7b, FreeMonoBoldOblique24pt7b;
+extern const GFXfont FreeSans9pt7b, FreeSans12pt7b, FreeSans18pt7b, FreeSans24pt7b;
+extern const GFXfont FreeSansBold9pt7b, FreeSansBold12pt7b, FreeSansBold18pt7b, FreeSansBold24pt7b;
+extern const GFXfont FreeSansOblique9pt7b, FreeSansOblique12pt7b, FreeSansOblique18pt7b, FreeSansOblique24pt7b;
+extern const GFXfont FreeSansBoldOblique9pt7b, FreeSansBoldOblique12pt7b, FreeSansBoldOblique18pt7b, FreeSansBoldOblique24pt7b;
+extern const GFXfont FreeSerif9pt7b, FreeSerif12pt7b, FreeSerif18pt7b, FreeSerif24pt7b;
+extern const GFXfont FreeSerifBold9pt7b, FreeSerifBold12pt7b, FreeSerifBold18pt7b, FreeSerifBold24pt7b;
+extern const GFXfont FreeSerifItalic9pt7b, FreeSerifItalic12pt7b, FreeSerifItalic18pt7b, FreeSerifItalic24pt7b;
+extern const GFXfont FreeSerifBoldItalic9pt7b, FreeSerifBoldItalic12pt7b, FreeSerifBoldItalic18pt7b, FreeSerifBoldItalic24pt7b;
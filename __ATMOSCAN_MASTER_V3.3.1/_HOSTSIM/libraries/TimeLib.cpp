@@ -0,0 +1,175 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - PaulStoffregen Time library       */
+/*                                                      */
+/********************************************************/
+
+#include "TimeLib.h"
+
+static time_t sysTime = 0;
+static unsigned long prevMillis = 0;
+static timeStatus_t status = timeNotSet;
+static getExternalTime getTimePtr = nullptr;
+static time_t syncInterval = 300;
+static time_t nextSyncTime = 0;
+
+time_t now()
+{
+  // Same drift free accounting as the library
+  while (millis() - prevMillis >= 1000)
+  {
+    sysTime++;
+    prevMillis += 1000;
+  }
+  if (getTimePtr && nextSyncTime <= sysTime)
+  {
+    // Provider callbacks may call now() again (e.g. the NTP error event logs
+    // with a timestamp): do not re-enter the provider from there
+    nextSyncTime = sysTime + syncInterval;
+    time_t t = getTimePtr();
+    if (t != 0)
+      setTime(t);
+    else
+    {
+      nextSyncTime = sysTime + syncInterval;
+      status = status == timeNotSet ? timeNotSet : timeNeedsSync;
+    }
+  }
+  return sysTime;
+}
+
+void setTime(time_t t)
+{
+  sysTime = t;
+  nextSyncTime = t + syncInterval;
+  status = timeSet;
+  prevMillis = millis();
+}
+
+timeStatus_t timeStatus()
+{
+  now();
+  return status;
+}
+
+void setSyncProvider(getExternalTime getTimeFunction)
+{
+  getTimePtr = getTimeFunction;
+  nextSyncTime = sysTime;
+  now();
+}
+
+void setSyncInterval(time_t interval)
+{
+  syncInterval = interval;
+  nextSyncTime = sysTime + syncInterval;
+}
+
+static struct tm breakTime(time_t t)
+{
+  struct tm tm;
+  gmtime_r(&t, &tm);
+  return tm;
+}
+
+int hour(time_t t)
+{
+  return breakTime(t).tm_hour;
+}
+int hour()
+{
+  return hour(now());
+}
+int hourFormat12()
+{
+  int h = hour() % 12;
+  return h == 0 ? 12 : h;
+}
+bool isAM()
+{
+  return hour() < 12;
+}
+bool isPM()
+{
+  return !isAM();
+}
+int minute(time_t t)
+{
+  return breakTime(t).tm_min;
+}
+int minute()
+{
+  return minute(now());
+}
+int second(time_t t)
+{
+  return breakTime(t).tm_sec;
+}
+int second()
+{
+  return second(now());
+}
+int day(time_t t)
+{
+  return breakTime(t).tm_mday;
+}
+int day()
+{
+  return day(now());
+}
+int weekday(time_t t)
+{
+  return breakTime(t).tm_wday + 1;   // Sunday is day 1
+}
+int weekday()
+{
+  return weekday(now());
+}
+int month(time_t t)
+{
+  return breakTime(t).tm_mon + 1;
+}
+int month()
+{
+  return month(now());
+}
+int year(time_t t)
+{
+  return breakTime(t).tm_year + 1900;
+}
+int year()
+{
+  return year(now());
+}
+
+static const char *const monthNames[] = {"", "January", "February", "March", "April", "May", "June",
+                                         "July", "August", "September", "October", "November", "December"
+                                        };
+static const char *const dayNames[] = {"Err", "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+static char buffer[12];
+
+char *monthStr(uint8_t month)
+{
+  strncpy(buffer, monthNames[month <= 12 ? month : 0], sizeof(buffer) - 1);
+  return buffer;
+}
+char *monthShortStr(uint8_t month)
+{
+  strncpy(buffer, monthNames[month <= 12 ? month : 0], 3);
+  buffer[3] = 0;
+  return buffer;
+}
+char *dayStr(uint8_t day)
+{
+  strncpy(buffer, dayNames[day <= 7 ? day : 0], sizeof(buffer) - 1);
+  return buffer;
+}
+char *dayShortStr(uint8_t day)
+{
+  strncpy(buffer, dayNames[day <= 7 ? day : 0], 3);
+  buffer[3] = 0;
+  return buffer;
+}
@@ -0,0 +1,50 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - PaulStoffregen Time library       */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum
+{
+  timeNotSet,
+  timeNeedsSync,
+  timeSet
+} timeStatus_t;
+
+typedef time_t (*getExternalTime)();
+
+time_t now();
+void setTime(time_t t);
+timeStatus_t timeStatus();
+void setSyncProvider(getExternalTime getTimeFunction);
+void setSyncInterval(time_t interval);
+
+int hour();
+int hour(time_t t);
+int hourFormat12();
+bool isAM();
+bool isPM();
+int minute();
+int minute(time_t t);
+int second();
+int second(time_t t);
+int day();
+int day(time_t t);
+int weekday();
+int weekday(time_t t);
+int month();
+int month(time_t t);
+int year();
+int year(time_t t);
+
+char *monthStr(uint8_t month);
+char *dayStr(uint8_t day);
+char *monthShortStr(uint8_t month);
+char *dayShortStr(uint8_t day);
@@ -0,0 +1,100 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - tzapu WiFiManager                 */
+/*                                                      */
+/*  Nobody joins the configuration portal on the host:  */
+/*  it times out and leaves the configuration alone.    */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "ESP8266WiFi.h"
+#include "HostSim.h"
+
+class WiFiManagerParameter
+{
+  public:
+    WiFiManagerParameter(const char *custom) : _id(nullptr), _placeholder(nullptr), _length(0), _customHTML(custom) {}
+    WiFiManagerParameter(const char *id, const char *placeholder, const char *defaultValue, int length)
+      : _id(id), _placeholder(placeholder), _length(length)
+    {
+      _value.assign(defaultValue ? defaultValue : "", 0, length);
+    }
+
+    const char *getID()
+    {
+      return _id;
+    }
+    const char *getValue()
+    {
+      return _value.c_str();
+    }
+    const char *getPlaceholder()
+    {
+      return _placeholder;
+    }
+    int getValueLength()
+    {
+      return _length;
+    }
+    const char *getCustomHTML()
+    {
+      return _customHTML;
+    }
+
+  private:
+    const char *_id;
+    const char *_placeholder;
+    int _length;
+    std::string _value;
+    const char *_customHTML = "";
+};
+
+class WiFiManager
+{
+  public:
+    bool autoConnect()
+    {
+      return WiFi.isConnected();
+    }
+    bool autoConnect(const char *apName, const char *apPassword = NULL)
+    {
+      return autoConnect();
+    }
+
+    bool startConfigPortal(const char *apName, const char *apPassword = NULL)
+    {
+      // Soft AP start up, then the portal times out (capped on the host)
+      HostSim::busy(std::min<unsigned long>(_timeout, 30) * 1000000UL);
+      return false;
+    }
+
+    void setConfigPortalTimeout(unsigned long seconds)
+    {
+      _timeout = seconds;
+    }
+    void setConnectTimeout(unsigned long seconds) {}
+    void setDebugOutput(bool debug) {}
+    void setMinimumSignalQuality(int quality = 8) {}
+    void setBreakAfterConfig(bool shouldBreak) {}
+    void setSaveConfigCallback(void (*func)(void))
+    {
+      _saveCallback = func;
+    }
+    void setAPCallback(void (*func)(WiFiManager *)) {}
+    void addParameter(WiFiManagerParameter *p)
+    {
+      _params.push_back(p);
+    }
+    void resetSettings() {}
+
+  private:
+    unsigned long _timeout = 0;
+    void (*_saveCallback)(void) = nullptr;
+    std::vector<WiFiManagerParameter *> _params;
+};
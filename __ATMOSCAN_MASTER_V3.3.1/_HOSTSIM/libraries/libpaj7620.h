@@ -0,0 +1,51 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - PAJ7620U gesture sensor           */
+/*                                                      */
+/*  Gestures come from the script loaded by the         */
+/*  simulator (data/gestures.csv), which also pulls     */
+/*  the interrupt line low when one is pending.         */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "HostSim.h"
+
+#define GES_NONE 0
+#define GES_RIGHT 1
+#define GES_LEFT 2
+#define GES_UP 3
+#define GES_DOWN 4
+#define GES_FORWARD 5
+#define GES_BACKWARD 6
+#define GES_CLOCKWISE 7
+#define GES_CNTRCLOCKWISE 8
+#define GES_WAVE 9
+
+class PAJ7620U
+{
+  public:
+    uint8_t begin()
+    {
+      // Wake up plus the 219 register initialisation table
+      HostSim::i2cTransfer(2 * 219);
+      return HostSim::i2cPresent(0x73) ? 0 : 1;
+    }
+
+    int readGesture()
+    {
+      HostSim::i2cTransfer(6);
+      return HostSim::takeGesture();
+    }
+
+    void cancelGesture()
+    {
+      HostSim::i2cTransfer(2);
+      HostSim::takeGesture();
+    }
+};
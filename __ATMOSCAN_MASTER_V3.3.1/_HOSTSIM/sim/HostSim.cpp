@@ -0,0 +1,798 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - clock, heap, GPIO and ESP core    */
+/*                                                      */
+/********************************************************/
+
+#include <map>
+#include <new>
+#include <random>
+#include "Arduino.h"
+#include "HostSim.h"
+#include "SimHarness.h"
+#include "user_interface.h"
+
+// -------------------------------------------------------
+// Clock
+// -------------------------------------------------------
+
+namespace
+{
+uint64_t warpMicros = 0;          // Time charged by models and delay()
+uint64_t cpuFoldedMicros = 0;     // Scaled firmware CPU time, up to cpuMark
+uint64_t cpuMark = 0;             // Host thread CPU ns at the last fold
+uint64_t excludedNanos = 0;       // Host ns spent in Sections since the last fold
+uint64_t sectionStart = 0;
+int sectionDepth = 0;
+uint8_t cpuMHz = 80;
+uint64_t clockReads = 0;          // Keeps busy waits moving with --cpu-slowdown 0
+
+uint64_t threadNanos()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Firmware CPU ns (host) accumulated since the last fold
+uint64_t pendingNanos()
+{
+  uint64_t t = threadNanos();
+  uint64_t excluded = excludedNanos + (sectionDepth > 0 ? t - sectionStart : 0);
+  uint64_t elapsed = t - cpuMark;
+  return elapsed > excluded ? elapsed - excluded : 0;
+}
+
+uint64_t scaleNanos(uint64_t nanos)
+{
+  // Host ns -> ESP8266 us at the current clock
+  return nanos * SimHarness::options().cpuSlowdown * 80 / cpuMHz / 1000;
+}
+
+void foldCpu()
+{
+  cpuFoldedMicros += scaleNanos(pendingNanos());
+  cpuMark = threadNanos();
+  excludedNanos = 0;
+  if (sectionDepth > 0)
+    sectionStart = cpuMark;
+}
+}
+
+namespace HostSim
+{
+
+uint64_t now()
+{
+  uint64_t t = warpMicros + cpuFoldedMicros + scaleNanos(pendingNanos());
+  if (SimHarness::options().cpuSlowdown == 0)
+    t += ++clockReads / 8;
+  return t;
+}
+
+void busy(uint64_t micros)
+{
+  warpMicros += micros;
+}
+
+uint64_t cpuMicros(uint64_t micros80)
+{
+  return micros80 * 80 / cpuMHz;
+}
+
+uint64_t hostNanos()
+{
+  return threadNanos();
+}
+
+time_t wallClock()
+{
+  return SimHarness::options().epoch + now() / 1000000;
+}
+
+Section::Section()
+{
+  if (sectionDepth++ == 0)
+    sectionStart = threadNanos();
+}
+
+Section::~Section()
+{
+  if (--sectionDepth == 0)
+    excludedNanos += threadNanos() - sectionStart;
+}
+
+Section::Suspend::Suspend() : depth(sectionDepth)
+{
+  if (sectionDepth > 0)
+    excludedNanos += threadNanos() - sectionStart;
+  sectionDepth = 0;
+}
+
+Section::Suspend::~Suspend()
+{
+  sectionDepth = depth;
+  if (sectionDepth > 0)
+    sectionStart = threadNanos();
+}
+
+uint8_t cpuFreq()
+{
+  return cpuMHz;
+}
+
+void setCpuFreq(uint8_t mhz)
+{
+  if (mhz != 80 && mhz != 160)
+    return;
+  foldCpu();
+  cpuMHz = mhz;
+}
+
+// -------------------------------------------------------
+// Bus and network models
+// -------------------------------------------------------
+
+uint64_t spiMicros(uint64_t bytes)
+{
+  // 8 bits per byte at SPI_FREQUENCY, plus per transaction overhead of
+  // the HSPI driver (64 byte FIFO chunks)
+  uint64_t hz = SimHarness::options().spiHz;
+  return (bytes * 8 * 1000000ULL + hz - 1) / hz + bytes / 64;
+}
+
+void i2cTransfer(uint32_t bytes)
+{
+  // Bit banged I2C (core_esp8266_si2c) at ~100kHz: 9 clocks per byte,
+  // plus start/address/stop
+  busy(cpuMicros((bytes + 2) * 90));
+}
+
+bool i2cPresent(uint8_t address)
+{
+  return SimHarness::i2cDevicePresent(address);
+}
+
+uint64_t networkMicros(uint64_t bytes)
+{
+  // One way latency plus serialisation at the configured throughput
+  const SimHarness::SimOptions &o = SimHarness::options();
+  return o.netLatencyMs * 1000ULL + bytes * 1000000ULL / o.netBytesPerSec;
+}
+
+bool brokerAvailable()
+{
+  return SimHarness::options().broker;
+}
+
+bool verbose()
+{
+  return SimHarness::options().verbose;
+}
+
+}
+
+// -------------------------------------------------------
+// Heap accounting
+// -------------------------------------------------------
+
+// Every allocation made outside simulator Sections is also placed in a
+// virtual heap of the ESP8266's size, using the umm_malloc first fit policy
+// and block granularity, so that free heap, largest free block and
+// fragmentation reflect what the firmware would see on the device.
+
+namespace
+{
+#define UMM_BLOCK 8
+#define UMM_HEADER 4
+#define HEADER_MAGIC 0x5EA1AB1E
+#define NO_OFFSET 0xFFFFFFFF
+
+struct alignas(16) BlockHeader
+{
+  uint32_t size;
+  uint32_t offset;      // Position in the virtual heap, NO_OFFSET if not accounted
+  uint32_t span;        // Virtual bytes taken (block rounded)
+  uint32_t magic;
+};
+
+bool inAllocator = false;
+uint32_t heapUsed = 0;
+uint32_t heapPeak = 0;
+uint32_t heapMark = 0;          // Peak since umm_free_heap_size_min_reset()
+uint32_t heapAllocations = 0;
+uint32_t heapFailures = 0;
+uint32_t heapTotal = 0;
+
+typedef std::map<uint32_t, uint32_t> FreeMap;   // offset -> size
+
+FreeMap &freeMap()
+{
+  // Constructed on first use: operator new runs during static initialisation
+  alignas(FreeMap) static char storage[sizeof(FreeMap)];
+  static FreeMap *map = nullptr;
+  if (!map)
+  {
+    bool wasIn = inAllocator;
+    inAllocator = true;
+    map = new (storage) FreeMap();
+    heapTotal = SIM_DEFAULT_HEAP;
+    (*map)[0] = heapTotal;
+    inAllocator = wasIn;
+  }
+  return *map;
+}
+
+uint32_t virtualAlloc(uint32_t span)
+{
+  FreeMap &map = freeMap();
+  for (auto it = map.begin(); it != map.end(); ++it)
+  {
+    if (it->second >= span)
+    {
+      uint32_t offset = it->first, remaining = it->second - span;
+      map.erase(it);
+      if (remaining)
+        map[offset + span] = remaining;
+      return offset;
+    }
+  }
+  return NO_OFFSET;
+}
+
+void virtualFree(uint32_t offset, uint32_t span)
+{
+  FreeMap &map = freeMap();
+  auto next = map.lower_bound(offset);
+
+  // Coalesce with the following block
+  if (next != map.end() && offset + span == next->first)
+  {
+    span += next->second;
+    next = map.erase(next);
+  }
+  // ...and with the previous one
+  if (next != map.begin())
+  {
+    auto prev = std::prev(next);
+    if (prev->first + prev->second == offset)
+    {
+      prev->second += span;
+      return;
+    }
+  }
+  map[offset] = span;
+}
+
+bool accounted()
+{
+  return sectionDepth == 0 && !inAllocator;
+}
+
+void *trackedAlloc(size_t size)
+{
+  BlockHeader *h = (BlockHeader *)malloc(sizeof(BlockHeader) + size);
+  if (!h)
+    throw std::bad_alloc();
+  h->size = size;
+  h->offset = NO_OFFSET;
+  h->span = 0;
+  h->magic = HEADER_MAGIC;
+
+  if (accounted())
+  {
+    inAllocator = true;
+    uint32_t span = (size + UMM_HEADER + UMM_BLOCK - 1) / UMM_BLOCK * UMM_BLOCK;
+    uint32_t offset = virtualAlloc(span);
+    if (offset != NO_OFFSET)
+    {
+      h->offset = offset;
+      h->span = span;
+      heapUsed += span;
+      heapPeak = std::max(heapPeak, heapUsed);
+      heapMark = std::max(heapMark, heapUsed);
+      heapAllocations++;
+    }
+    else
+    {
+      heapFailures++;
+      SimHarness::onHeapExhausted(size);
+    }
+    inAllocator = false;
+  }
+  return h + 1;
+}
+
+void trackedFree(void *p)
+{
+  if (!p)
+    return;
+  BlockHeader *h = (BlockHeader *)p - 1;
+  if (h->magic != HEADER_MAGIC)
+    abort();
+  if (h->offset != NO_OFFSET)
+  {
+    bool wasIn = inAllocator;
+    inAllocator = true;
+    virtualFree(h->offset, h->span);
+    heapUsed -= h->span;
+    inAllocator = wasIn;
+  }
+  h->magic = 0;
+  free(h);
+}
+}
+
+void *operator new(size_t size)
+{
+  return trackedAlloc(size);
+}
+void *operator new[](size_t size)
+{
+  return trackedAlloc(size);
+}
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+  try
+  {
+    return trackedAlloc(size);
+  }
+  catch (...)
+  {
+    return nullptr;
+  }
+}
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+  return operator new(size, std::nothrow);
+}
+void operator delete(void *p) noexcept
+{
+  trackedFree(p);
+}
+void operator delete[](void *p) noexcept
+{
+  trackedFree(p);
+}
+void operator delete(void *p, size_t) noexcept
+{
+  trackedFree(p);
+}
+void operator delete[](void *p, size_t) noexcept
+{
+  trackedFree(p);
+}
+
+namespace SimHarness
+{
+void resizeHeap(uint32_t total)
+{
+  // Static constructors have already allocated: grow or shrink the free
+  // space at the top of the heap
+  FreeMap &map = freeMap();
+  bool wasIn = inAllocator;
+  inAllocator = true;
+  uint32_t tail = 0;
+  if (!map.empty() && map.rbegin()->first + map.rbegin()->second == heapTotal)
+  {
+    tail = map.rbegin()->second;
+    map.erase(std::prev(map.end()));
+  }
+  uint32_t base = heapTotal - tail;
+  if (total > base)
+    map[base] = total - base;
+  heapTotal = std::max(total, base);
+  options().heapSize = heapTotal;
+  inAllocator = wasIn;
+}
+}
+
+namespace HostSim
+{
+
+HeapStats heapStats()
+{
+  HeapStats s;
+  freeMap();
+  s.total = heapTotal;
+  s.used = heapUsed;
+  s.peakUsed = heapPeak;
+  s.minFree = s.total - heapPeak;
+  s.maxFreeBlock = 0;
+  {
+    bool wasIn = inAllocator;
+    inAllocator = true;
+    for (auto &b : freeMap())
+      s.maxFreeBlock = std::max(s.maxFreeBlock, b.second);
+    inAllocator = wasIn;
+  }
+  // umm_malloc reports usable bytes of the largest block
+  s.maxFreeBlock = s.maxFreeBlock > UMM_HEADER ? s.maxFreeBlock - UMM_HEADER : 0;
+  s.allocations = heapAllocations;
+  s.failures = heapFailures;
+  return s;
+}
+
+uint8_t heapFragmentation()
+{
+  // Same metric as the core's ESP.getHeapFragmentation()
+  double total = 0, squares = 0;
+  bool wasIn = inAllocator;
+  inAllocator = true;
+  for (auto &b : freeMap())
+  {
+    total += b.second;
+    squares += (double)b.second * b.second;
+  }
+  inAllocator = wasIn;
+  if (total == 0)
+    return 100;
+  return (uint8_t)(100 - sqrt(squares) * 100 / total);
+}
+
+}
+
+// -------------------------------------------------------
+// ESP class
+// -------------------------------------------------------
+
+EspClass ESP;
+
+namespace
+{
+uint32_t rtcMemory[128];
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+  HostSim::HeapStats s = HostSim::heapStats();
+  return s.total - s.used;
+}
+
+uint32_t EspClass::getMaxFreeBlockSize()
+{
+  return HostSim::heapStats().maxFreeBlock;
+}
+
+uint8_t EspClass::getHeapFragmentation()
+{
+  return HostSim::heapFragmentation();
+}
+
+// umm_malloc statistics (UMM_STATS): low watermark of the free heap
+extern "C" size_t umm_free_heap_size_min()
+{
+  return heapTotal - heapMark;
+}
+
+extern "C" size_t umm_free_heap_size_min_reset()
+{
+  heapMark = heapUsed;
+  return heapTotal - heapMark;
+}
+
+void EspClass::getHeapStats(uint32_t *free, uint16_t *max, uint8_t *frag)
+{
+  if (free)
+    *free = getFreeHeap();
+  if (max)
+    *max = std::min<uint32_t>(getMaxFreeBlockSize(), 0xFFFF);
+  if (frag)
+    *frag = getHeapFragmentation();
+}
+
+void EspClass::restart()
+{
+  HostSim::stop("ESP.restart()");
+}
+
+void EspClass::reset()
+{
+  HostSim::stop("ESP.reset()");
+}
+
+void EspClass::deepSleep(uint64_t time_us, RFMode mode)
+{
+  HostSim::stop("ESP.deepSleep()");
+}
+
+uint8_t EspClass::getCpuFreqMHz()
+{
+  return HostSim::cpuFreq();
+}
+
+uint32_t EspClass::getCycleCount()
+{
+  return (uint32_t)(HostSim::now() * HostSim::cpuFreq());
+}
+
+bool EspClass::rtcUserMemoryRead(uint32_t offset, uint32_t *data, size_t size)
+{
+  if (offset * 4 + size > sizeof(rtcMemory) || (size & 3))
+    return false;
+  memcpy(data, &rtcMemory[offset], size);
+  return true;
+}
+
+bool EspClass::rtcUserMemoryWrite(uint32_t offset, uint32_t *data, size_t size)
+{
+  if (offset * 4 + size > sizeof(rtcMemory) || (size & 3))
+    return false;
+  memcpy(&rtcMemory[offset], data, size);
+  return true;
+}
+
+namespace SimHarness
+{
+void *rtcMemoryImage(size_t &size)
+{
+  size = sizeof(rtcMemory);
+  return rtcMemory;
+}
+}
+
+// -------------------------------------------------------
+// SDK (user_interface.h)
+// -------------------------------------------------------
+
+namespace
+{
+sleep_type sleepType = NONE_SLEEP_T;
+}
+
+bool system_update_cpu_freq(uint8 freq)
+{
+  HostSim::setCpuFreq(freq);
+  return freq == 80 || freq == 160;
+}
+
+uint8 system_get_cpu_freq(void)
+{
+  return HostSim::cpuFreq();
+}
+
+uint32 system_get_time(void)
+{
+  return (uint32)HostSim::now();
+}
+
+bool wifi_set_sleep_type(enum sleep_type type)
+{
+  sleepType = type;
+  return true;
+}
+
+enum sleep_type wifi_get_sleep_type(void)
+{
+  return sleepType;
+}
+
+// -------------------------------------------------------
+// Arduino timing
+// -------------------------------------------------------
+
+unsigned long millis()
+{
+  return (unsigned long)(HostSim::now() / 1000);
+}
+
+unsigned long micros()
+{
+  return (unsigned long)HostSim::now();
+}
+
+void delay(unsigned long ms)
+{
+  // delay() yields to the SDK: let the simulator deliver due events
+  HostSim::busy(ms * 1000ULL);
+  SimHarness::poll();
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  HostSim::busy(us);
+}
+
+void yield()
+{
+  SimHarness::poll();
+}
+
+// -------------------------------------------------------
+// GPIO
+// -------------------------------------------------------
+
+namespace
+{
+#define SIM_PINS 18
+
+struct Pin
+{
+  uint8_t mode = INPUT;
+  int level = HIGH;
+  void (*isr)(void) = nullptr;
+  int isrMode = 0;
+};
+Pin pins[SIM_PINS];
+bool interruptsEnabled = true;
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  if (pin >= SIM_PINS)
+    return;
+  pins[pin].mode = mode;
+
+  // The output latch resets low: the pin is driven low straight away
+  if (mode == OUTPUT && pins[pin].level == HIGH)
+  {
+    pins[pin].level = LOW;
+    SimHarness::onOutputChanged(pin, LOW);
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  if (pin >= SIM_PINS)
+    return;
+  int old = pins[pin].level;
+  pins[pin].level = val ? HIGH : LOW;
+  if (pins[pin].mode == OUTPUT && old != pins[pin].level)
+    SimHarness::onOutputChanged(pin, pins[pin].level);
+}
+
+int digitalRead(uint8_t pin)
+{
+  return pin < SIM_PINS ? pins[pin].level : LOW;
+}
+
+int analogRead(uint8_t pin)
+{
+  // SAR ADC conversion through the SDK
+  HostSim::busy(HostSim::cpuMicros(100));
+  if (pin != A0)
+    return 0;
+  return constrain((int)HostSim::sample().voc, 0, 1023);
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode)
+{
+  if (pin >= SIM_PINS)
+    return;
+  pins[pin].isr = handler;
+  pins[pin].isrMode = mode;
+}
+
+void detachInterrupt(uint8_t pin)
+{
+  if (pin < SIM_PINS)
+    pins[pin].isr = nullptr;
+}
+
+void noInterrupts()
+{
+  interruptsEnabled = false;
+}
+
+void interrupts()
+{
+  interruptsEnabled = true;
+}
+
+namespace HostSim
+{
+
+void setPin(uint8_t pin, int level)
+{
+  if (pin >= SIM_PINS)
+    return;
+  Pin &p = pins[pin];
+  int old = p.level;
+  p.level = level ? HIGH : LOW;
+  if (!p.isr || old == p.level || !interruptsEnabled)
+    return;
+
+  bool rising = p.level == HIGH;
+  if (p.isrMode == CHANGE || (p.isrMode == RISING && rising) || (p.isrMode == FALLING && !rising))
+    p.isr();
+}
+
+int getPin(uint8_t pin)
+{
+  return pin < SIM_PINS ? pins[pin].level : LOW;
+}
+
+}
+
+// -------------------------------------------------------
+// Misc core functions
+// -------------------------------------------------------
+
+namespace
+{
+std::mt19937 &rng()
+{
+  static std::mt19937 gen(SimHarness::options().seed);
+  return gen;
+}
+}
+
+long random(long howbig)
+{
+  if (howbig <= 0)
+    return 0;
+  return std::uniform_int_distribution<long>(0, howbig - 1)(rng());
+}
+
+long random(long howsmall, long howbig)
+{
+  if (howsmall >= howbig)
+    return howsmall;
+  return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed)
+{
+  rng().seed(seed);
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+char *dtostrf(double val, signed char width, unsigned char prec, char *s)
+{
+  sprintf(s, "%*.*f", width, prec, val);
+  return s;
+}
+
+static char *convert(unsigned long value, bool negative, char *result, int base)
+{
+  if (base < 2 || base > 36)
+  {
+    *result = 0;
+    return result;
+  }
+  char buf[34];
+  int i = 0;
+  do
+  {
+    int d = value % base;
+    buf[i++] = d < 10 ? '0' + d : 'a' + d - 10;
+    value /= base;
+  }
+  while (value);
+  char *out = result;
+  if (negative)
+    *out++ = '-';
+  while (i)
+    *out++ = buf[--i];
+  *out = 0;
+  return result;
+}
+
+char *itoa(int value, char *result, int base)
+{
+  return ltoa(value, result, base);
+}
+
+char *ltoa(long value, char *result, int base)
+{
+  if (base == 10 && value < 0)
+    return convert(-(unsigned long)value, true, result, base);
+  return convert((unsigned long)value, false, result, base);
+}
+
+char *utoa(unsigned value, char *result, int base)
+{
+  return convert(value, false, result, base);
+}
+
+char *ultoa(unsigned long value, char *result, int base)
+{
+  return convert(value, false, result, base);
+}
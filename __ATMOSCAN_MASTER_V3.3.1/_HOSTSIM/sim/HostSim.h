@@ -0,0 +1,128 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - simulator services                */
+/*                                                      */
+/*  Simulated clock: host CPU time spent in firmware    */
+/*  code, scaled to the ESP8266 clock, plus the time    */
+/*  charged by device models (bus transfers, sensor     */
+/*  conversions, network) and by delay().               */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+namespace HostSim
+{
+
+// One row of the sensor replay (data/replay.csv)
+struct Sample
+{
+  float temperature;   // C
+  float humidity;      // %
+  float pressure;      // hPa
+  float co2;           // ppm
+  float pm01;          // ug/m3
+  float pm25;
+  float pm10;
+  float voc;           // ADC counts
+  float co;            // ppm
+  float no2;           // ppm
+  float cpm;           // Geiger counts per minute
+  float vcell;         // V
+};
+
+// Current replay sample (step-wise, looping)
+const Sample &sample();
+
+// -------------------------------------------------------
+// Clock
+// -------------------------------------------------------
+
+// Simulated microseconds since boot
+uint64_t now();
+// Charge simulated time (device/bus busy, blocking I/O)
+void busy(uint64_t micros);
+// Scales a time measured on the ESP8266 at 80MHz to the current CPU clock
+uint64_t cpuMicros(uint64_t micros80);
+// Host CPU time of this thread
+uint64_t hostNanos();
+// Simulated UTC wall clock (seconds)
+time_t wallClock();
+
+// Marks simulator internal code: its host CPU time is not charged to the
+// simulated clock and its allocations do not count against the ESP heap
+class Section
+{
+  public:
+    Section();
+    ~Section();
+
+    // Runs firmware code from inside a Section (the harness calling loop())
+    class Suspend
+    {
+      public:
+        Suspend();
+        ~Suspend();
+      private:
+        int depth;
+    };
+};
+
+// -------------------------------------------------------
+// Bus and network cost models
+// -------------------------------------------------------
+
+uint64_t spiMicros(uint64_t bytes);
+void i2cTransfer(uint32_t bytes);
+bool i2cPresent(uint8_t address);
+uint64_t networkMicros(uint64_t bytes);
+bool brokerAvailable();
+
+// -------------------------------------------------------
+// Heap accounting
+// -------------------------------------------------------
+
+struct HeapStats
+{
+  uint32_t total;         // Heap available to the sketch
+  uint32_t used;          // Live bytes, including allocator overhead
+  uint32_t peakUsed;
+  uint32_t minFree;
+  uint32_t maxFreeBlock;  // Largest contiguous free block
+  uint32_t allocations;
+  uint32_t failures;      // Requests that would not have fit on the ESP8266
+};
+HeapStats heapStats();
+uint8_t heapFragmentation();
+
+// -------------------------------------------------------
+// GPIO
+// -------------------------------------------------------
+
+// Pulls an input pin, firing the attached interrupt on a matching edge
+void setPin(uint8_t pin, int level);
+int getPin(uint8_t pin);
+
+// Gesture queue fed by data/gestures.csv
+int takeGesture();
+
+// -------------------------------------------------------
+// Harness
+// -------------------------------------------------------
+
+bool verbose();
+uint8_t cpuFreq();
+void setCpuFreq(uint8_t mhz);
+
+// Ends the simulation after the current loop() (restart, power off...)
+void stop(const char *reason);
+bool stopped();
+
+}
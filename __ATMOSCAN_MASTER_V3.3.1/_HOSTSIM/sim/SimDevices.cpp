@@ -0,0 +1,442 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - UARTs, I2C and the serial sensors */
+/*                                                      */
+/*  PMS7003 (Serial) and MH-Z19 (SoftwareSerial) are    */
+/*  modelled at protocol level, answering the firmware  */
+/*  commands with frames built from the replay data.    */
+/*                                                      */
+/********************************************************/
+
+#include "Arduino.h"
+#include "SoftwareSerial.h"
+#include "Wire.h"
+#include "SPI.h"
+#include "ArduinoOTA.h"
+#include "MutichannelGasSensor.h"
+#include "HostSim.h"
+#include "SimHarness.h"
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+TwoWire Wire;
+SPIClass SPI;
+ArduinoOTAClass ArduinoOTA;
+MutichannelGasSensor gas;
+
+// -------------------------------------------------------
+// UART timing
+// -------------------------------------------------------
+
+void SimSerialPort::reply(const uint8_t *data, size_t len, unsigned long latencyMs)
+{
+  HostSim::Section section;
+  unsigned long at = micros() + latencyMs * 1000;
+  if (!rx.empty())
+    at = std::max(at, rx.back().arrival);
+  for (size_t i = 0; i < len; i++)
+  {
+    at += charTime();
+    rx.push_back({data[i], at});
+  }
+}
+
+int SimSerialPort::available()
+{
+  HostSim::Section section;
+  unsigned long t = micros();
+  size_t n = 0;
+  for (auto &b : rx)
+  {
+    if ((long)(t - b.arrival) < 0)
+      break;
+    n++;
+  }
+
+  // Characters that arrived while the FIFO/buffer was full are lost
+  while (n > rxCapacity)
+  {
+    rx.erase(rx.begin() + rxCapacity);
+    n--;
+  }
+  return n;
+}
+
+int SimSerialPort::read()
+{
+  if (!available())
+    return -1;
+  uint8_t c = rx.front().value;
+  rx.pop_front();
+  return c;
+}
+
+int SimSerialPort::peek()
+{
+  if (!available())
+    return -1;
+  return rx.front().value;
+}
+
+size_t SimSerialPort::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t SimSerialPort::write(const uint8_t *buffer, size_t size)
+{
+  unsigned long t = micros();
+  if (blockingTx)
+  {
+    // Bit banged: the CPU is busy for the whole transmission
+    HostSim::busy((uint64_t)size * charTime());
+  }
+  else
+  {
+    // Hardware FIFO: transmission proceeds in the background
+    txBusyUntil = std::max(txBusyUntil, t) + size * charTime();
+  }
+
+  HostSim::Section section;
+  if (device)
+  {
+    for (size_t i = 0; i < size; i++)
+      device->onReceive(buffer[i]);
+  }
+  return size;
+}
+
+void SimSerialPort::dropRx()
+{
+  HostSim::Section section;
+  unsigned long t = micros();
+  while (!rx.empty() && (long)(t - rx.front().arrival) >= 0)
+    rx.pop_front();
+}
+
+void HardwareSerial::flush()
+{
+  unsigned long t = micros();
+  if ((long)(txBusyUntil - t) > 0)
+    HostSim::busy(txBusyUntil - t);
+}
+
+// -------------------------------------------------------
+// SoftwareSerial
+// -------------------------------------------------------
+
+static std::map<int, SoftwareSerial *> &softwareSerialPorts()
+{
+  static std::map<int, SoftwareSerial *> ports;
+  return ports;
+}
+
+SoftwareSerial::SoftwareSerial(int receivePin, int transmitPin, bool inverse_logic, unsigned int buffSize)
+  : rxPin(receivePin), bufferSize(buffSize)
+{
+  HostSim::Section section;
+  rxCapacity = buffSize;
+  blockingTx = true;
+  softwareSerialPorts()[receivePin] = this;
+}
+
+SoftwareSerial::~SoftwareSerial()
+{
+  HostSim::Section section;
+  auto it = softwareSerialPorts().find(rxPin);
+  if (it != softwareSerialPorts().end() && it->second == this)
+    softwareSerialPorts().erase(it);
+}
+
+SoftwareSerial *SoftwareSerial::onPin(int receivePin)
+{
+  auto it = softwareSerialPorts().find(receivePin);
+  return it == softwareSerialPorts().end() ? nullptr : it->second;
+}
+
+// -------------------------------------------------------
+// I2C
+// -------------------------------------------------------
+
+uint8_t TwoWire::endTransmission(bool sendStop)
+{
+  HostSim::i2cTransfer(1);
+
+  // 0: ACK, 2: NACK on address
+  return HostSim::i2cPresent(txAddress) ? 0 : 2;
+}
+
+// -------------------------------------------------------
+// PMS7003 particle sensor
+// -------------------------------------------------------
+
+namespace
+{
+
+#define PMS_FRAME_SIZE 32
+#define PMS_ACTIVE_PERIOD 1000000UL     // us between frames in active mode
+#define PMS_RESPONSE_LATENCY 5          // ms
+#define PMS_FAN_SPINUP 2500             // ms before the first frame after wake up
+#define PMS_WARMUP 30000000ULL          // us before readings are stable
+
+class PMS7003 : public SimSerialDevice
+{
+  public:
+    void begin(SimSerialPort *port)
+    {
+      this->port = port;
+      port->attach(this);
+      awakeSince = HostSim::now();
+      nextFrame = awakeSince + PMS_FAN_SPINUP * 1000ULL;
+    }
+
+    virtual void onReceive(uint8_t c)
+    {
+      // Commands are 42 4D CMD DATAH DATAL LRCH LRCL
+      if (received == 0 && c != 0x42)
+        return;
+      if (received == 1 && c != 0x4d)
+      {
+        received = 0;
+        return;
+      }
+      command[received++] = c;
+      if (received < sizeof(command))
+        return;
+      received = 0;
+
+      uint16_t sum = 0;
+      for (int i = 0; i < 5; i++)
+        sum += command[i];
+      if (sum != ((command[5] << 8) | command[6]))
+        return;
+      execute(command[2], command[4]);
+    }
+
+    void poll()
+    {
+      if (awake && !passive && HostSim::now() >= nextFrame)
+      {
+        sendFrame(0);
+        nextFrame = HostSim::now() + PMS_ACTIVE_PERIOD;
+      }
+    }
+
+    uint64_t nextEvent()
+    {
+      return awake && !passive ? nextFrame : UINT64_MAX;
+    }
+
+    uint64_t awakeMicros()
+    {
+      return awakeTotal + (awake ? HostSim::now() - awakeSince : 0);
+    }
+
+    uint32_t frames = 0;
+    uint32_t unstableFrames = 0;
+
+  private:
+    SimSerialPort *port = nullptr;
+    uint8_t command[7];
+    size_t received = 0;
+    bool passive = false;
+    bool awake = true;
+    uint64_t awakeSince = 0;
+    uint64_t awakeTotal = 0;
+    uint64_t nextFrame = 0;
+
+    void execute(uint8_t cmd, uint8_t data)
+    {
+      switch (cmd)
+      {
+        case 0xe1:    // Change mode
+          passive = data == 0;
+          ack(cmd, data);
+          break;
+
+        case 0xe2:    // Passive read
+          if (awake && passive)
+          {
+            uint64_t sinceWake = HostSim::now() - awakeSince;
+            unsigned long spinup = PMS_FAN_SPINUP * 1000UL;
+            sendFrame(sinceWake < spinup ? (spinup - sinceWake) / 1000 : 0);
+          }
+          break;
+
+        case 0xe4:    // Sleep / wake up
+          if (data == 0 && awake)
+          {
+            ack(cmd, data);
+            awakeTotal += HostSim::now() - awakeSince;
+            awake = false;
+          }
+          else if (data == 1 && !awake)
+          {
+            awake = true;
+            awakeSince = HostSim::now();
+            nextFrame = awakeSince + PMS_FAN_SPINUP * 1000ULL;
+          }
+          break;
+      }
+    }
+
+    void ack(uint8_t cmd, uint8_t data)
+    {
+      uint8_t frame[8] = {0x42, 0x4d, 0x00, 0x04, cmd, data, 0, 0};
+      uint16_t sum = 0;
+      for (int i = 0; i < 6; i++)
+        sum += frame[i];
+      frame[6] = sum >> 8;
+      frame[7] = sum & 0xff;
+      port->reply(frame, sizeof(frame), PMS_RESPONSE_LATENCY);
+    }
+
+    void sendFrame(unsigned long extraLatencyMs)
+    {
+      const HostSim::Sample &s = HostSim::sample();
+
+      // Until the fan has run for the warm up period, readings are low and noisy
+      float scale = 1.0f;
+      uint64_t sinceWake = HostSim::now() - awakeSince;
+      if (sinceWake < PMS_WARMUP)
+      {
+        scale = 0.3f + 0.7f * sinceWake / PMS_WARMUP;
+        unstableFrames++;
+      }
+      frames++;
+
+      uint16_t values[13] =
+      {
+        (uint16_t)(s.pm01 * scale), (uint16_t)(s.pm25 * scale), (uint16_t)(s.pm10 * scale),
+        (uint16_t)(s.pm01 * scale), (uint16_t)(s.pm25 * scale), (uint16_t)(s.pm10 * scale),
+        (uint16_t)(s.pm01 * 180), (uint16_t)(s.pm01 * 60), (uint16_t)(s.pm25 * 10),
+        (uint16_t)(s.pm25 * 2), (uint16_t)(s.pm10), (uint16_t)(s.pm10 / 2), 0x9100
+      };
+
+      uint8_t frame[PMS_FRAME_SIZE] = {0x42, 0x4d, 0x00, 0x1c};
+      for (int i = 0; i < 13; i++)
+      {
+        frame[4 + i * 2] = values[i] >> 8;
+        frame[5 + i * 2] = values[i] & 0xff;
+      }
+      uint16_t sum = 0;
+      for (int i = 0; i < PMS_FRAME_SIZE - 2; i++)
+        sum += frame[i];
+      frame[30] = sum >> 8;
+      frame[31] = sum & 0xff;
+      port->reply(frame, sizeof(frame), PMS_RESPONSE_LATENCY + extraLatencyMs);
+    }
+};
+
+// -------------------------------------------------------
+// MH-Z19 CO2 sensor
+// -------------------------------------------------------
+
+#define MHZ19_FRAME_SIZE 9
+#define MHZ19_RESPONSE_LATENCY 5          // ms
+
+class MHZ19 : public SimSerialDevice
+{
+  public:
+    void begin(SimSerialPort *port)
+    {
+      this->port = port;
+      port->attach(this);
+    }
+
+    virtual void onReceive(uint8_t c)
+    {
+      if (received == 0 && c != 0xff)
+        return;
+      command[received++] = c;
+      if (received < sizeof(command))
+        return;
+      received = 0;
+
+      if (checksum(command) != command[8])
+        return;
+
+      // Read CO2 concentration
+      if (command[2] == 0x86)
+      {
+        uint16_t ppm = (uint16_t)HostSim::sample().co2;
+        uint8_t frame[MHZ19_FRAME_SIZE] = {0xff, 0x86, (uint8_t)(ppm >> 8), (uint8_t)(ppm & 0xff), 0x47, 0x00, 0x00, 0x00, 0};
+        frame[8] = checksum(frame);
+        port->reply(frame, sizeof(frame), MHZ19_RESPONSE_LATENCY);
+      }
+    }
+
+  private:
+    SimSerialPort *port = nullptr;
+    uint8_t command[MHZ19_FRAME_SIZE];
+    size_t received = 0;
+
+    static uint8_t checksum(const uint8_t *frame)
+    {
+      uint8_t sum = 0;
+      for (int i = 1; i < 8; i++)
+        sum += frame[i];
+      return 0xff - sum + 1;
+    }
+};
+
+PMS7003 pms7003;
+MHZ19 mhz19;
+
+}
+
+// -------------------------------------------------------
+// Device wiring
+// -------------------------------------------------------
+
+namespace SimHarness
+{
+
+bool i2cDevicePresent(uint8_t address)
+{
+  switch (address)
+  {
+    case 0x04:  // MiCS6814 multichannel gas sensor
+    case 0x36:  // MAX17043 fuel gauge
+    case 0x40:  // HDC1080
+    case 0x73:  // PAJ7620U gesture sensor
+    case 0x76:  // BME280
+      return true;
+    default:
+      return false;
+  }
+}
+
+void devicesBegin()
+{
+  HostSim::Section section;
+  pms7003.begin(&Serial);
+
+  // MH-Z19 TX is wired to GPIO0 (SoftwareSerial RX)
+  SoftwareSerial *co2Port = SoftwareSerial::onPin(0);
+  if (co2Port)
+    mhz19.begin(co2Port);
+}
+
+void devicesPoll()
+{
+  HostSim::Section section;
+  pms7003.poll();
+}
+
+uint64_t devicesNextEvent()
+{
+  return pms7003.nextEvent();
+}
+
+void devicesReport(FILE *out)
+{
+  uint64_t awake = pms7003.awakeMicros();
+  fprintf(out, "PMS7003: %u frames (%u during warm up), fan on %.0f s (%.1f%%)\n",
+          pms7003.frames, pms7003.unstableFrames, awake / 1e6, HostSim::now() ? awake * 100.0 / HostSim::now() : 0);
+}
+
+}
@@ -0,0 +1,76 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - harness internals shared by the   */
+/*  simulator sources (not visible to the firmware)     */
+/*                                                      */
+/********************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string>
+
+// Free heap of the sketch after core and SDK initialisation
+#define SIM_DEFAULT_HEAP 48000
+
+namespace SimHarness
+{
+
+struct SimOptions
+{
+  double durationSec = 600;
+  std::string replayFile = "data/replay.csv";
+  std::string gesturesFile = "data/gestures.csv";
+  std::string spiffsDir = "data/spiffs";
+  std::string wwwDir = "data/www";
+  std::string screenshotDir;
+  double screenshotEverySec = 0;
+  bool verbose = false;
+  uint32_t heapSize = SIM_DEFAULT_HEAP;
+  uint32_t seed = 1;
+  double cpuSlowdown = 30;          // ESP8266 @80MHz vs host, per instruction
+  time_t epoch = 1539561600;        // 2018-10-15 00:00 UTC
+  uint32_t spiHz = 40000000;
+  uint32_t netLatencyMs = 20;
+  uint32_t netBytesPerSec = 100000;
+  bool wifi = true;
+  bool broker = true;
+  bool warmBoot = false;
+  double outageStartSec = -1;
+  double outageDurationSec = 0;
+  std::string benchJpegFile;
+};
+
+SimOptions &options();
+
+// Called from delay() and yield(): delivers due external events
+void poll();
+
+// Device models
+bool i2cDevicePresent(uint8_t address);
+void onOutputChanged(uint8_t pin, int level);
+void onHeapExhausted(size_t size);
+
+// Virtual heap size (applied after command line parsing)
+void resizeHeap(uint32_t total);
+
+// RTC user memory image, persisted across runs with --warm-boot
+void *rtcMemoryImage(size_t &size);
+
+// Devices (SimDevices.cpp)
+void devicesBegin();
+void devicesPoll();
+uint64_t devicesNextEvent();
+void devicesReport(FILE *out);
+
+// Network (SimNetwork.cpp)
+void networkPoll();
+uint64_t networkNextEvent();
+void networkReport(FILE *out);
+
+}
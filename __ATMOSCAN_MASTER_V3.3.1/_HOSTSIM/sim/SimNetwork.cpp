@@ -0,0 +1,755 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - WiFi station, TCP and HTTP        */
+/*                                                      */
+/*  Web services are replaced by canned responses found */
+/*  in data/www/<host>: either a single file served for */
+/*  every request, or a directory holding one file per  */
+/*  request path (and an optional "default").           */
+/*                                                      */
+/********************************************************/
+
+#include <sys/stat.h>
+#include "Arduino.h"
+#include "ESP8266WiFi.h"
+#include "ESP8266HTTPClient.h"
+#include "HostSim.h"
+#include "SimHarness.h"
+
+ESP8266WiFiClass WiFi;
+
+class WiFiEventHandlerOpaque
+{
+};
+
+// Association timings (ms)
+#define WIFI_SCAN_TIME 2000         // Full channel scan
+#define WIFI_PROBE_TIME 100         // Direct probe on a known channel/BSSID
+#define WIFI_AUTH_TIME 200          // Authentication, association, 4 way handshake
+#define WIFI_DHCP_TIME 800          // DHCP discover/offer/request/ack
+
+// Server side
+#define SERVER_THINK_TIME 150       // ms before the first response byte
+#define TCP_MSS 1460
+#define TLS_HANDSHAKE_CPU 2000000   // us of BearSSL handshake at 80MHz
+
+namespace
+{
+bool inOutage()
+{
+  const SimHarness::SimOptions &o = SimHarness::options();
+  if (o.outageStartSec < 0)
+    return false;
+  double t = HostSim::now() / 1e6;
+  return t >= o.outageStartSec && t < o.outageStartSec + o.outageDurationSec;
+}
+
+uint64_t outageEnd()
+{
+  const SimHarness::SimOptions &o = SimHarness::options();
+  return (uint64_t)((o.outageStartSec + o.outageDurationSec) * 1e6);
+}
+}
+
+// -------------------------------------------------------
+// Station
+// -------------------------------------------------------
+
+// Charges the time since the last state change to the radio state it was in
+void ESP8266WiFiClass::account()
+{
+  uint64_t t = HostSim::now() - accountedAt;
+  accountedAt = HostSim::now();
+
+  if (asleep || wifiMode == WIFI_OFF)
+    radioOffMicros += t;
+  else if (linkUp && sleepMode != WIFI_NONE_SLEEP)
+    modemSleepMicros += t;
+}
+
+bool ESP8266WiFiClass::mode(WiFiMode_t m)
+{
+  account();
+  wifiMode = m;
+  if (m == WIFI_OFF)
+    disconnect(true);
+  return true;
+}
+
+void ESP8266WiFiClass::associate(bool knownChannel)
+{
+  started = true;
+  uint64_t t = knownChannel ? WIFI_PROBE_TIME : WIFI_SCAN_TIME;
+  t += WIFI_AUTH_TIME;
+  if (!staticIP)
+    t += WIFI_DHCP_TIME;
+  connectAt = HostSim::now() + t * 1000;
+}
+
+wl_status_t ESP8266WiFiClass::begin()
+{
+  // Reconnect with the credentials stored in flash
+  if (wifiMode == WIFI_OFF)
+    wifiMode = WIFI_STA;
+  associate(false);
+  return status();
+}
+
+wl_status_t ESP8266WiFiClass::begin(const char *ssid, const char *passphrase, int32_t channel, const uint8_t *bssid, bool connect)
+{
+  if (wifiMode == WIFI_OFF)
+    wifiMode = WIFI_STA;
+  if (connect)
+  {
+    associate(channel != 0 && bssid != nullptr);
+
+    // Pinned to an access point that is not around: never associates
+    if (bssid != nullptr && memcmp(bssid, this->bssid, sizeof(this->bssid)) != 0)
+      connectAt = UINT64_MAX;
+  }
+  return status();
+}
+
+bool ESP8266WiFiClass::config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1, IPAddress dns2)
+{
+  // Back to DHCP while connected: the address stays usable until the lease is bound
+  bool wasStatic = staticIP;
+  staticIP = (uint32_t)local_ip != 0;
+  if (wasStatic && !staticIP && linkUp)
+    dhcpAt = HostSim::now() + WIFI_DHCP_TIME * 1000ULL;
+  return true;
+}
+
+bool ESP8266WiFiClass::disconnect(bool wifioff)
+{
+  account();
+  bool wasUp = linkUp;
+  linkUp = false;
+  started = false;
+  dhcpAt = 0;
+  if (wasUp)
+  {
+    WiFiEventStationModeDisconnected e;
+    memcpy(e.bssid, bssid, sizeof(bssid));
+    e.reason = 8;   // Association leave
+    for (auto &h : disconnectedHandlers)
+      h(e);
+  }
+  return true;
+}
+
+bool ESP8266WiFiClass::reconnect()
+{
+  disconnect();
+  associate(true);
+  return true;
+}
+
+void ESP8266WiFiClass::checkAssociation()
+{
+  const SimHarness::SimOptions &o = SimHarness::options();
+
+  // Lost beacons: the SDK reports the disconnection and keeps retrying
+  if (linkUp && inOutage())
+  {
+    account();
+    linkUp = false;
+    dhcpAt = 0;
+    WiFiEventStationModeDisconnected e;
+    memcpy(e.bssid, bssid, sizeof(bssid));
+    e.reason = 200;   // Beacon timeout
+    for (auto &h : disconnectedHandlers)
+      h(e);
+    connectAt = outageEnd() + (WIFI_SCAN_TIME + WIFI_AUTH_TIME + (staticIP ? 0 : WIFI_DHCP_TIME)) * 1000ULL;
+    return;
+  }
+
+  // DHCP on a connected link: reported like the SDK does, with a new got IP event
+  if (linkUp && dhcpAt && HostSim::now() >= dhcpAt)
+  {
+    dhcpAt = 0;
+    renewals++;
+    WiFiEventStationModeGotIP e;
+    e.ip = localIP();
+    e.mask = subnetMask();
+    e.gw = gatewayIP();
+    for (auto &h : gotIPHandlers)
+      h(e);
+    return;
+  }
+
+  if (!started || linkUp || asleep || !o.wifi || inOutage())
+    return;
+  if (HostSim::now() < connectAt)
+    return;
+
+  account();
+  linkUp = true;
+  associations++;
+  WiFiEventStationModeGotIP e;
+  e.ip = localIP();
+  e.mask = subnetMask();
+  e.gw = gatewayIP();
+  for (auto &h : gotIPHandlers)
+    h(e);
+}
+
+wl_status_t ESP8266WiFiClass::status()
+{
+  checkAssociation();
+  if (linkUp)
+    return WL_CONNECTED;
+  if (!SimHarness::options().wifi)
+    return WL_NO_SSID_AVAIL;
+  return WL_DISCONNECTED;
+}
+
+bool ESP8266WiFiClass::setSleepMode(WiFiSleepType_t type, uint8_t listenInterval)
+{
+  account();
+  sleepMode = type;
+  return true;
+}
+
+bool ESP8266WiFiClass::forceSleepBegin(uint32_t sleepUs)
+{
+  disconnect();
+  account();
+  asleep = true;
+  return true;
+}
+
+bool ESP8266WiFiClass::forceSleepWake()
+{
+  // RF calibration and modem start up
+  HostSim::busy(2000);
+  account();
+  asleep = false;
+  return true;
+}
+
+String ESP8266WiFiClass::SSID() const
+{
+  return F("SimNet");
+}
+
+String ESP8266WiFiClass::psk() const
+{
+  return F("simulation");
+}
+
+uint8_t *ESP8266WiFiClass::BSSID()
+{
+  return bssid;
+}
+
+String ESP8266WiFiClass::BSSIDstr()
+{
+  char buf[18];
+  sprintf(buf, "%02X:%02X:%02X:%02X:%02X:%02X", bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
+  return String(buf);
+}
+
+int32_t ESP8266WiFiClass::channel()
+{
+  return 6;
+}
+
+int32_t ESP8266WiFiClass::RSSI()
+{
+  return linkUp ? -58 - random(6) : 31;
+}
+
+IPAddress ESP8266WiFiClass::localIP()
+{
+  return linkUp ? IPAddress(192, 168, 1, 50) : IPAddress(0, 0, 0, 0);
+}
+
+IPAddress ESP8266WiFiClass::gatewayIP()
+{
+  return linkUp ? IPAddress(192, 168, 1, 1) : IPAddress(0, 0, 0, 0);
+}
+
+IPAddress ESP8266WiFiClass::subnetMask()
+{
+  return linkUp ? IPAddress(255, 255, 255, 0) : IPAddress(0, 0, 0, 0);
+}
+
+IPAddress ESP8266WiFiClass::dnsIP(uint8_t dns_no)
+{
+  return linkUp && dns_no == 0 ? IPAddress(192, 168, 1, 1) : IPAddress(0, 0, 0, 0);
+}
+
+int ESP8266WiFiClass::hostByName(const char *aHostname, IPAddress &aResult)
+{
+  if (!linkUp || !aHostname || !*aHostname)
+    return 0;
+
+  // One DNS exchange, every name resolves to the same (simulated) host
+  HostSim::busy(HostSim::networkMicros(64) * 2);
+  aResult = IPAddress(192, 168, 1, 10);
+  return 1;
+}
+
+// Access points visible from the simulated location
+namespace
+{
+struct SimAP
+{
+  const char *ssid;
+  const char *bssid;
+  int32_t rssi;
+  int32_t channel;
+};
+const SimAP accessPoints[] =
+{
+  {"SimNet", "00:1A:2B:3C:4D:5E", -58, 6},
+  {"Neighbour-5G", "A4:91:B1:22:7C:10", -71, 11},
+  {"FreeWifi", "F4:CA:E5:8D:01:33", -80, 1},
+  {"Printer-Setup", "DE:AD:10:C0:FF:01", -86, 6},
+};
+#define SIM_AP_COUNT (sizeof(accessPoints) / sizeof(accessPoints[0]))
+}
+
+int8_t ESP8266WiFiClass::scanNetworks(bool async, bool show_hidden)
+{
+  // Asynchronous: results through scanComplete() once every channel was visited
+  if (async)
+  {
+    if (!scanning)
+    {
+      scanning = true;
+      scanResults = false;
+      scanDoneAt = HostSim::now() + WIFI_SCAN_TIME * 1000ULL;
+    }
+    return WIFI_SCAN_RUNNING;
+  }
+
+  // A blocking scan dwells on every channel
+  HostSim::busy(WIFI_SCAN_TIME * 1000ULL);
+  scanning = false;
+  scanResults = true;
+  return SIM_AP_COUNT;
+}
+
+int8_t ESP8266WiFiClass::scanComplete()
+{
+  if (scanning && HostSim::now() >= scanDoneAt)
+  {
+    scanning = false;
+    scanResults = true;
+  }
+  if (scanning)
+    return WIFI_SCAN_RUNNING;
+  return scanResults ? SIM_AP_COUNT : WIFI_SCAN_FAILED;
+}
+
+String ESP8266WiFiClass::SSID(uint8_t networkItem)
+{
+  return networkItem < SIM_AP_COUNT ? String(accessPoints[networkItem].ssid) : String();
+}
+
+uint8_t *ESP8266WiFiClass::BSSID(uint8_t networkItem)
+{
+  // Like the SDK, points into the scan results
+  static uint8_t scanBssid[6];
+  unsigned int b[6] = {0};
+  if (networkItem < SIM_AP_COUNT)
+    sscanf(accessPoints[networkItem].bssid, "%x:%x:%x:%x:%x:%x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]);
+  for (int i = 0; i < 6; i++)
+    scanBssid[i] = b[i];
+  return scanBssid;
+}
+
+String ESP8266WiFiClass::BSSIDstr(uint8_t networkItem)
+{
+  return networkItem < SIM_AP_COUNT ? String(accessPoints[networkItem].bssid) : String();
+}
+
+int32_t ESP8266WiFiClass::RSSI(uint8_t networkItem)
+{
+  return networkItem < SIM_AP_COUNT ? accessPoints[networkItem].rssi : 0;
+}
+
+int32_t ESP8266WiFiClass::channel(uint8_t networkItem)
+{
+  return networkItem < SIM_AP_COUNT ? accessPoints[networkItem].channel : 0;
+}
+
+WiFiEventHandler ESP8266WiFiClass::onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP &)> f)
+{
+  gotIPHandlers.push_back(f);
+  return std::make_shared<WiFiEventHandlerOpaque>();
+}
+
+WiFiEventHandler ESP8266WiFiClass::onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected &)> f)
+{
+  disconnectedHandlers.push_back(f);
+  return std::make_shared<WiFiEventHandlerOpaque>();
+}
+
+void ESP8266WiFiClass::simPoll()
+{
+  checkAssociation();
+}
+
+void ESP8266WiFiClass::simReport(FILE *out)
+{
+  account();
+  double total = HostSim::now() ? HostSim::now() / 100.0 : 1;
+  fprintf(out, "WiFi: %u associations, %u DHCP while connected, radio off %.0f s (%.1f%%), modem sleep %.0f s (%.1f%%)\n",
+          associations, renewals, radioOffMicros / 1e6, radioOffMicros / total, modemSleepMicros / 1e6, modemSleepMicros / total);
+}
+
+uint64_t ESP8266WiFiClass::simNextEvent()
+{
+  uint64_t next = UINT64_MAX;
+  const SimHarness::SimOptions &o = SimHarness::options();
+  if (started && !linkUp && !asleep && o.wifi)
+    next = std::max(connectAt, HostSim::now());
+  if (linkUp && dhcpAt)
+    next = std::max(dhcpAt, HostSim::now());
+  if (o.outageStartSec >= 0)
+  {
+    uint64_t start = (uint64_t)(o.outageStartSec * 1e6);
+    if (start > HostSim::now())
+      next = std::min(next, start);
+  }
+  return next;
+}
+
+// -------------------------------------------------------
+// TCP client
+// -------------------------------------------------------
+
+namespace
+{
+std::string encodePath(const std::string &path)
+{
+  std::string out;
+  for (char c : path)
+    out += isalnum((unsigned char)c) || c == '.' || c == '-' ? c : '_';
+  return out;
+}
+
+bool readFile(const std::string &name, std::string &content)
+{
+  FILE *f = fopen(name.c_str(), "rb");
+  if (!f)
+    return false;
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+    content.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+bool isDirectory(const std::string &name)
+{
+  struct stat st;
+  return stat(name.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+bool exists(const std::string &name)
+{
+  struct stat st;
+  return stat(name.c_str(), &st) == 0;
+}
+
+// Builds the full HTTP response for a request on a simulated host
+std::string cannedResponse(const std::string &host, const std::string &path)
+{
+  std::string base = SimHarness::options().wwwDir + "/" + host;
+  std::string body;
+  bool found;
+  if (isDirectory(base))
+    found = readFile(base + "/" + encodePath(path), body) || readFile(base + "/default", body);
+  else
+    found = readFile(base, body);
+
+  if (found && body.compare(0, 5, "HTTP/") == 0)
+    return body;
+
+  std::string type = "application/json";
+  if (path.find(".png") != std::string::npos)
+    type = "image/png";
+  else if (path.find(".jpg") != std::string::npos || path.find(".jpeg") != std::string::npos)
+    type = "image/jpeg";
+  else if (path.find(".gif") != std::string::npos)
+    type = "image/gif";
+
+  std::string head = found ? "HTTP/1.1 200 OK\r\n" : "HTTP/1.1 404 Not Found\r\n";
+  if (!found)
+    body = "Not Found";
+  head += "Content-Type: " + (found ? type : std::string("text/plain")) + "\r\n";
+  head += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+  head += "Connection: close\r\n\r\n";
+  return head + body;
+}
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port)
+{
+  // Only the MQTT broker is addressed by IP, and PubSubClient is simulated
+  HostSim::busy(HostSim::networkMicros(0) * 2);
+  return 0;
+}
+
+int WiFiClient::connect(const char *host, uint16_t port)
+{
+  stop();
+  if (!WiFi.isConnected())
+    return 0;
+
+  // DNS lookup
+  HostSim::busy(HostSim::networkMicros(64) * 2);
+
+  HostSim::Section section;
+  if (!exists(SimHarness::options().wwwDir + "/" + host))
+  {
+    if (HostSim::verbose())
+      printf("[%9.3f] TCP   %s:%u refused (no canned responses)\n", HostSim::now() / 1e6, host, port);
+    return 0;
+  }
+
+  // SYN / SYN-ACK
+  HostSim::busy(HostSim::networkMicros(0) * 2);
+
+  conn = std::make_shared<Connection>();
+  conn->host = host;
+  return 1;
+}
+
+int BearSSL::WiFiClientSecure::connect(const char *host, uint16_t port)
+{
+  if (!WiFiClient::connect(host, port))
+    return 0;
+
+  // BearSSL handshake: RSA/ECDHE math dominates, plus two round trips
+  HostSim::busy(HostSim::cpuMicros(TLS_HANDSHAKE_CPU) + HostSim::networkMicros(4096) * 2);
+  return 1;
+}
+
+size_t WiFiClient::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t WiFiClient::write(const uint8_t *buf, size_t size)
+{
+  if (!conn)
+    return 0;
+
+  // lwIP copies into its buffers, the actual transmission happens in the background
+  HostSim::busy(HostSim::cpuMicros(size / 8 + 20));
+
+  HostSim::Section section;
+  if (conn->requestComplete)
+    return size;
+  conn->request.append((const char *)buf, size);
+  if (conn->request.find("\r\n\r\n") == std::string::npos)
+    return size;
+
+  // Request line: METHOD SP PATH SP VERSION
+  std::string path = "/";
+  size_t sp1 = conn->request.find(' ');
+  size_t sp2 = sp1 == std::string::npos ? sp1 : conn->request.find(' ', sp1 + 1);
+  if (sp2 != std::string::npos)
+    path = conn->request.substr(sp1 + 1, sp2 - sp1 - 1);
+
+  conn->requestComplete = true;
+  conn->response = cannedResponse(conn->host, path);
+  conn->firstByteAt = HostSim::now() + HostSim::networkMicros(conn->request.size()) + SERVER_THINK_TIME * 1000ULL;
+
+  if (HostSim::verbose())
+    printf("[%9.3f] HTTP  GET %s%s -> %u bytes\n", HostSim::now() / 1e6, conn->host.c_str(), path.c_str(), (unsigned)conn->response.size());
+  return size;
+}
+
+size_t WiFiClient::arrived()
+{
+  if (!conn || !conn->requestComplete)
+    return 0;
+  uint64_t t = HostSim::now();
+  if (t < conn->firstByteAt)
+    return 0;
+
+  // Data arrives in full TCP segments at the link throughput
+  uint64_t perSegment = (uint64_t)TCP_MSS * 1000000ULL / SimHarness::options().netBytesPerSec;
+  uint64_t segments = (t - conn->firstByteAt) / perSegment + 1;
+  return std::min<uint64_t>(conn->response.size(), segments * TCP_MSS);
+}
+
+int WiFiClient::available()
+{
+  HostSim::Section section;
+  if (!conn)
+    return 0;
+  return arrived() - conn->readPos;
+}
+
+// The simulated peer always keeps up: the whole lwIP send buffer (2 * MSS) is free
+size_t WiFiClient::availableForWrite()
+{
+  return WiFi.isConnected() ? 2 * TCP_MSS : 0;
+}
+
+int WiFiClient::read()
+{
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t *buf, size_t size)
+{
+  size_t n = std::min<size_t>(size, available());
+  if (!n)
+    return conn ? 0 : -1;
+  memcpy(buf, conn->response.data() + conn->readPos, n);
+  conn->readPos += n;
+  return n;
+}
+
+int WiFiClient::peek()
+{
+  if (!available())
+    return -1;
+  return (uint8_t)conn->response[conn->readPos];
+}
+
+void WiFiClient::stop()
+{
+  HostSim::Section section;
+  conn.reset();
+}
+
+uint8_t WiFiClient::connected()
+{
+  HostSim::Section section;
+  if (!conn)
+    return 0;
+
+  // The server closes after the response: the socket reports connected
+  // until all the data has been received
+  return !conn->requestComplete || arrived() < conn->response.size() || available() > 0;
+}
+
+// -------------------------------------------------------
+// HTTP client
+// -------------------------------------------------------
+
+bool HTTPClient::begin(String url)
+{
+  String rest = url;
+  port = 80;
+  if (rest.startsWith(F("https://")))
+  {
+    rest = rest.substring(8);
+    port = 443;
+  }
+  else if (rest.startsWith(F("http://")))
+    rest = rest.substring(7);
+
+  int slash = rest.indexOf('/');
+  host = slash < 0 ? rest : rest.substring(0, slash);
+  path = slash < 0 ? String(F("/")) : rest.substring(slash);
+  int colon = host.indexOf(':');
+  if (colon >= 0)
+  {
+    port = host.substring(colon + 1).toInt();
+    host = host.substring(0, colon);
+  }
+  size = -1;
+  return host.length() > 0;
+}
+
+int HTTPClient::GET()
+{
+  if (!client.connect(host.c_str(), port))
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+
+  String request = String(F("GET ")) + path + F(" HTTP/1.1\r\nHost: ") + host + F("\r\nUser-Agent: ESP8266HTTPClient\r\nConnection: close\r\n\r\n");
+  if (client.write((const uint8_t *)request.c_str(), request.length()) != request.length())
+    return HTTPC_ERROR_SEND_HEADER_FAILED;
+
+  client.setTimeout(5000);
+  String status = client.readStringUntil('\n');
+  if (!status.startsWith(F("HTTP/")))
+    return HTTPC_ERROR_READ_TIMEOUT;
+  int code = status.substring(status.indexOf(' ') + 1).toInt();
+
+  while (client.connected())
+  {
+    String header = client.readStringUntil('\n');
+    header.trim();
+    if (header.length() == 0)
+      break;
+    if (header.startsWith(F("Content-Length:")))
+      size = header.substring(15).toInt();
+  }
+  return code > 0 ? code : HTTPC_ERROR_NO_HTTP_SERVER;
+}
+
+String HTTPClient::getString()
+{
+  String payload;
+  client.setTimeout(5000);
+  while (connected() && (size < 0 || (int)payload.length() < size))
+  {
+    int c = client.read();
+    if (c < 0)
+    {
+      delay(1);
+      continue;
+    }
+    payload += (char)c;
+  }
+  return payload;
+}
+
+String HTTPClient::errorToString(int error)
+{
+  switch (error)
+  {
+    case HTTPC_ERROR_CONNECTION_REFUSED:
+      return F("connection refused");
+    case HTTPC_ERROR_SEND_HEADER_FAILED:
+      return F("send header failed");
+    case HTTPC_ERROR_CONNECTION_LOST:
+      return F("connection lost");
+    case HTTPC_ERROR_NO_HTTP_SERVER:
+      return F("no HTTP server");
+    case HTTPC_ERROR_READ_TIMEOUT:
+      return F("read Timeout");
+    default:
+      return String();
+  }
+}
+
+// -------------------------------------------------------
+// Harness glue
+// -------------------------------------------------------
+
+namespace SimHarness
+{
+
+void networkPoll()
+{
+  WiFi.simPoll();
+}
+
+void networkReport(FILE *out)
+{
+  WiFi.simReport(out);
+}
+
+uint64_t networkNextEvent()
+{
+  return WiFi.simNextEvent();
+}
+
+}
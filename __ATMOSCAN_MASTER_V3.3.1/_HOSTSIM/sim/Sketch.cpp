@@ -0,0 +1,33 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - the sketch as a C++ translation   */
+/*  unit (the Arduino IDE adds these prototypes itself) */
+/*                                                      */
+/********************************************************/
+
+#include "Arduino.h"
+#include <ESP8266WiFi.h>
+
+bool retrieveConfig();
+void wifiBegin();
+void wifiRescan();
+void wifiSaveCache(const WiFiEventStationModeGotIP &ipInfo);
+void wifiClearCache();
+void wifiCheckFastPath();
+void initNTP();
+void initOTA();
+void addProcesses();
+void startProcesses();
+void errLog(String msg);
+void setTurbo(bool setTurbo);
+bool isTurbo();
+void turnOff();
+bool logBootDetails(int step);
+void listFiles();
+void i2cScan();
+String byte2hex(unsigned char buf);
+
+#include "../../__ATMOSCAN_MASTER_V3.3.1.ino"
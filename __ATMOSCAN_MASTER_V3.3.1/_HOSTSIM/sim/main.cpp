@@ -0,0 +1,644 @@
+/********************************************************/
+/*                    ATMOSCAN                          */
+/*                                                      */
+/*            Author: Marc Finns 2017                   */
+/*                                                      */
+/*  Host simulation - harness                           */
+/*                                                      */
+/*  Runs setup() and loop() against the simulated       */
+/*  hardware for a given simulated duration, injecting  */
+/*  recorded sensor data, gestures and Geiger pulses,   */
+/*  then reports loop latency, heap and per process     */
+/*  CPU usage.                                          */
+/*                                                      */
+/********************************************************/
+
+#include <sys/stat.h>
+#include <functional>
+#include "Arduino.h"
+#include "FS.h"
+#include "PubSubClient.h"
+#include "Syslog.h"
+#include "ProcessScheduler.h"
+#include "RingBufCPP.h"
+#include "TFT_eSPI.h"
+#include "GfxUi.h"
+#include "HostSim.h"
+#include "SimHarness.h"
+
+// Sketch entry points and globals
+void setup();
+void loop();
+extern Scheduler sched;
+extern TFT_eSPI LCD;
+extern GfxUi ui;
+extern RingBufCPP<String, 18> lastErrors;
+
+#define GESTURE_PIN 10
+#define GEIGER_PIN 15
+#define KILL_PIN 9
+#define BACKLIGHT_PIN 12
+#define RTC_IMAGE_FILE "rtcmem.bin"
+#define BENCH_JPEG_FILE "/bench.jpg"
+#define BENCH_FRAME_FILE "/bench.frm"
+#define BENCH_JPEG_FRAMES 24
+
+namespace
+{
+
+// -------------------------------------------------------
+// Harness state
+// -------------------------------------------------------
+
+std::vector<std::pair<double, HostSim::Sample>> replay;
+double replayLength = 0;
+
+std::deque<std::pair<uint64_t, int>> gestures;
+
+double geigerAccumulator = 0;
+uint64_t geigerLastPoll = 0;
+uint32_t geigerPulses = 0;
+
+bool stopRequested = false;
+std::string stopReason;
+bool polling = false;
+
+uint64_t backlightOnSince = 0;
+uint64_t backlightOnTotal = 0;
+bool backlightOn = false;
+
+uint32_t heapExhaustedReports = 0;
+
+// -------------------------------------------------------
+// Input files
+// -------------------------------------------------------
+
+bool loadReplay(const std::string &name)
+{
+  FILE *f = fopen(name.c_str(), "r");
+  if (!f)
+    return false;
+  char line[512];
+  while (fgets(line, sizeof(line), f))
+  {
+    if (line[0] == '#' || !isdigit((unsigned char)line[0]))
+      continue;
+    double t;
+    HostSim::Sample s;
+    int n = sscanf(line, "%lf,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f", &t,
+                   &s.temperature, &s.humidity, &s.pressure, &s.co2, &s.pm01, &s.pm25, &s.pm10,
+                   &s.voc, &s.co, &s.no2, &s.cpm, &s.vcell);
+    if (n == 13)
+      replay.push_back(std::make_pair(t, s));
+  }
+  fclose(f);
+  if (replay.empty())
+    return false;
+
+  // Loop with the same spacing as the last two samples
+  double step = replay.size() > 1 ? replay.back().first - replay[replay.size() - 2].first : 60;
+  replayLength = replay.back().first + step;
+  return true;
+}
+
+int gestureCode(const char *name)
+{
+  static const char *const names[] = {"NONE", "RIGHT", "LEFT", "UP", "DOWN", "FORWARD", "BACKWARD", "CLOCKWISE", "CNTRCLOCKWISE", "WAVE"};
+  for (int i = 0; i < 10; i++)
+    if (strcasecmp(name, names[i]) == 0)
+      return i;
+  return atoi(name);
+}
+
+bool loadGestures(const std::string &name)
+{
+  FILE *f = fopen(name.c_str(), "r");
+  if (!f)
+    return false;
+  char line[128];
+  while (fgets(line, sizeof(line), f))
+  {
+    double t;
+    char gesture[32];
+    if (line[0] == '#' || sscanf(line, "%lf,%31[A-Za-z0-9]", &t, gesture) != 2)
+      continue;
+    gestures.push_back(std::make_pair((uint64_t)(t * 1e6), gestureCode(gesture)));
+  }
+  fclose(f);
+  std::sort(gestures.begin(), gestures.end());
+  return true;
+}
+
+void loadRtcMemory()
+{
+  size_t size;
+  void *image = SimHarness::rtcMemoryImage(size);
+  FILE *f = fopen(RTC_IMAGE_FILE, "rb");
+  if (!f)
+    return;
+  if (fread(image, 1, size, f) != size)
+    memset(image, 0, size);
+  fclose(f);
+}
+
+void saveRtcMemory()
+{
+  size_t size;
+  void *image = SimHarness::rtcMemoryImage(size);
+  FILE *f = fopen(RTC_IMAGE_FILE, "wb");
+  if (!f)
+    return;
+  fwrite(image, 1, size, f);
+  fclose(f);
+}
+
+// -------------------------------------------------------
+// Event sources
+// -------------------------------------------------------
+
+void pollGestures()
+{
+  if (!gestures.empty() && gestures.front().first <= HostSim::now() && HostSim::getPin(GESTURE_PIN) == HIGH)
+    HostSim::setPin(GESTURE_PIN, LOW);
+}
+
+void pollGeiger()
+{
+  uint64_t t = HostSim::now();
+  double cpm = HostSim::sample().cpm;
+  geigerAccumulator += cpm * (t - geigerLastPoll) / 60e6;
+  geigerLastPoll = t;
+  while (geigerAccumulator >= 1)
+  {
+    geigerAccumulator -= 1;
+    geigerPulses++;
+    HostSim::setPin(GEIGER_PIN, HIGH);
+    HostSim::setPin(GEIGER_PIN, LOW);
+  }
+}
+
+uint64_t nextGeigerPulse()
+{
+  double cpm = HostSim::sample().cpm;
+  if (cpm <= 0)
+    return UINT64_MAX;
+  return geigerLastPoll + (uint64_t)((1 - geigerAccumulator) * 60e6 / cpm) + 1;
+}
+
+// -------------------------------------------------------
+// Statistics
+// -------------------------------------------------------
+
+struct LatencyStats
+{
+  std::vector<uint32_t> samples;
+  uint64_t total = 0;
+
+  void add(uint32_t us)
+  {
+    samples.push_back(us);
+    total += us;
+  }
+  uint32_t percentile(double p)
+  {
+    if (samples.empty())
+      return 0;
+    std::vector<uint32_t> sorted(samples);
+    size_t index = std::min(sorted.size() - 1, (size_t)(p * sorted.size()));
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+  }
+  uint32_t maximum()
+  {
+    return samples.empty() ? 0 : *std::max_element(samples.begin(), samples.end());
+  }
+  uint32_t minimum()
+  {
+    return samples.empty() ? 0 : *std::min_element(samples.begin(), samples.end());
+  }
+  double mean()
+  {
+    return samples.empty() ? 0 : (double)total / samples.size();
+  }
+};
+
+uint32_t totalRuns()
+{
+  uint32_t runs = 0;
+  for (Process *p : sched.simProcesses())
+    runs += p->simStats().runs;
+  return runs;
+}
+
+void usage(const char *name)
+{
+  printf("Usage: %s [options]\n"
+         "  --duration S          simulated seconds to run (600)\n"
+         "  --replay FILE         sensor replay CSV (data/replay.csv)\n"
+         "  --gestures FILE       gesture script CSV (data/gestures.csv)\n"
+         "  --spiffs DIR          SPIFFS contents (data/spiffs)\n"
+         "  --www DIR             canned web service responses (data/www)\n"
+         "  --screenshot-dir DIR  save the display as PPM at the end of the run\n"
+         "  --screenshot-every S  ...and every S simulated seconds\n"
+         "  --heap BYTES          free heap at boot (%u)\n"
+         "  --cpu-slowdown X      ESP8266 @80MHz time per host CPU time (30)\n"
+         "  --seed N              random seed\n"
+         "  --epoch T             UTC time at boot (unix seconds)\n"
+         "  --no-wifi             access point never found\n"
+         "  --no-broker           MQTT broker unreachable\n"
+         "  --wifi-outage S,D     drop the access point at S for D seconds\n"
+         "  --warm-boot           keep RTC memory in " RTC_IMAGE_FILE " across runs\n"
+         "  --verbose             trace syslog, MQTT and HTTP traffic\n"
+         "  --bench-jpeg FILE     after boot, time drawing a JPEG like the radar loop, then exit\n",
+         name, SIM_DEFAULT_HEAP);
+}
+
+bool parseArgs(int argc, char **argv)
+{
+  SimHarness::SimOptions &o = SimHarness::options();
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (a == "--duration" && hasValue)
+      o.durationSec = atof(argv[++i]);
+    else if (a == "--replay" && hasValue)
+      o.replayFile = argv[++i];
+    else if (a == "--gestures" && hasValue)
+      o.gesturesFile = argv[++i];
+    else if (a == "--spiffs" && hasValue)
+      o.spiffsDir = argv[++i];
+    else if (a == "--www" && hasValue)
+      o.wwwDir = argv[++i];
+    else if (a == "--screenshot-dir" && hasValue)
+      o.screenshotDir = argv[++i];
+    else if (a == "--screenshot-every" && hasValue)
+      o.screenshotEverySec = atof(argv[++i]);
+    else if (a == "--heap" && hasValue)
+      o.heapSize = atoi(argv[++i]);
+    else if (a == "--cpu-slowdown" && hasValue)
+      o.cpuSlowdown = atof(argv[++i]);
+    else if (a == "--seed" && hasValue)
+      o.seed = atoi(argv[++i]);
+    else if (a == "--epoch" && hasValue)
+      o.epoch = atol(argv[++i]);
+    else if (a == "--no-wifi")
+      o.wifi = false;
+    else if (a == "--no-broker")
+      o.broker = false;
+    else if (a == "--wifi-outage" && hasValue)
+    {
+      if (sscanf(argv[++i], "%lf,%lf", &o.outageStartSec, &o.outageDurationSec) != 2)
+        return false;
+    }
+    else if (a == "--warm-boot")
+      o.warmBoot = true;
+    else if (a == "--verbose")
+      o.verbose = true;
+    else if (a == "--bench-jpeg" && hasValue)
+      o.benchJpegFile = argv[++i];
+    else
+      return false;
+  }
+  return true;
+}
+
+void screenshot(const char *tag)
+{
+  const std::string &dir = SimHarness::options().screenshotDir;
+  if (dir.empty())
+    return;
+  mkdir(dir.c_str(), 0755);
+  char name[64];
+  snprintf(name, sizeof(name), "/screen_%s.ppm", tag);
+  LCD.savePPM((dir + name).c_str());
+}
+
+// -------------------------------------------------------
+// JPEG benchmark
+// -------------------------------------------------------
+
+// Times a drawing over as many frames as the radar loop has
+void benchFrames(const char *what, const std::function<void()> &draw)
+{
+  LatencyStats frames;
+  const TFTStats before = LCD.getStats();
+  for (int i = 0; i < BENCH_JPEG_FRAMES; i++)
+  {
+    uint64_t t0 = HostSim::now();
+    {
+      HostSim::Section::Suspend firmware;
+      draw();
+    }
+    frames.add(HostSim::now() - t0);
+  }
+  const TFTStats &after = LCD.getStats();
+
+  printf("  %-12s per frame min %.1f  avg %.1f  max %.1f ms, %.1f windows, %.0f pixels, %.1f ms SPI busy\n", what,
+         frames.minimum() / 1e3, frames.mean() / 1e3, frames.maximum() / 1e3,
+         (double)(after.windows - before.windows) / BENCH_JPEG_FRAMES,
+         (double)(after.pixels - before.pixels) / BENCH_JPEG_FRAMES,
+         (after.busMicros - before.busMicros) / 1e3 / BENCH_JPEG_FRAMES);
+}
+
+// Draws the image where the radar frames go: from the JPEG, then from its frame copy
+int benchJpeg(const std::string &name)
+{
+  std::string image;
+  FILE *f = fopen(name.c_str(), "rb");
+  if (!f)
+  {
+    fprintf(stderr, "Cannot read %s\n", name.c_str());
+    return 1;
+  }
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+    image.append(buf, n);
+  fclose(f);
+
+  fs::File file = SPIFFS.open(BENCH_JPEG_FILE, "w");
+  file.write((const uint8_t *)image.data(), image.size());
+  file.close();
+
+  printf("\nJPEG %s: %u bytes, %d frames\n", name.c_str(), (unsigned)image.size(), BENCH_JPEG_FRAMES);
+  benchFrames("JPEG", []()
+  {
+    ui.drawJpeg(BENCH_JPEG_FILE, 0, 65);
+  });
+
+  bool converted;
+  uint64_t t0 = HostSim::now();
+  {
+    HostSim::Section::Suspend firmware;
+    converted = ui.jpegToFrame(BENCH_JPEG_FILE, BENCH_FRAME_FILE);
+  }
+  uint64_t conversion = HostSim::now() - t0;
+
+  if (converted)
+  {
+    file = SPIFFS.open(BENCH_FRAME_FILE, "r");
+    printf("  frame copy   %u bytes, converted in %.1f ms\n", (unsigned)file.size(), conversion / 1e3);
+    file.close();
+    benchFrames("frame copy", []()
+    {
+      ui.drawFrame(BENCH_FRAME_FILE, 0, 65);
+    });
+  }
+  else
+    printf("  frame copy   not converted\n");
+
+  SPIFFS.remove(BENCH_JPEG_FILE);
+  SPIFFS.remove(BENCH_FRAME_FILE);
+  screenshot("bench");
+  return 0;
+}
+
+}
+
+// -------------------------------------------------------
+// Services used by the simulated hardware
+// -------------------------------------------------------
+
+namespace SimHarness
+{
+
+SimOptions &options()
+{
+  static SimOptions o;
+  return o;
+}
+
+void poll()
+{
+  // Events are delivered from the SDK context: never nested
+  if (polling)
+    return;
+  HostSim::Section section;
+  polling = true;
+  pollGestures();
+  pollGeiger();
+  devicesPoll();
+  networkPoll();
+  polling = false;
+}
+
+void onOutputChanged(uint8_t pin, int level)
+{
+  if (pin == KILL_PIN && level == LOW)
+    HostSim::stop("power off (KILL pin)");
+
+  if (pin == BACKLIGHT_PIN)
+  {
+    // Driven through a MOSFET: high turns the LED on
+    bool on = level == HIGH;
+    if (on && !backlightOn)
+      backlightOnSince = HostSim::now();
+    else if (!on && backlightOn)
+      backlightOnTotal += HostSim::now() - backlightOnSince;
+    backlightOn = on;
+  }
+}
+
+void onHeapExhausted(size_t size)
+{
+  if (heapExhaustedReports++ < 10)
+    fprintf(stderr, "[%9.3f] HEAP  allocation of %u bytes would fail on the ESP8266\n", HostSim::now() / 1e6, (unsigned)size);
+}
+
+}
+
+namespace HostSim
+{
+
+const Sample &sample()
+{
+  static Sample none = {20, 50, 1013, 400, 0, 0, 0, 100, 1, 0.1f, 20, 3.9f};
+  if (replay.empty())
+    return none;
+  double t = fmod(now() / 1e6, replayLength);
+  auto it = std::upper_bound(replay.begin(), replay.end(), t,
+                             [](double v, const std::pair<double, Sample> &r)
+  {
+    return v < r.first;
+  });
+  return it == replay.begin() ? replay.front().second : std::prev(it)->second;
+}
+
+int takeGesture()
+{
+  Section section;
+  int gesture = 0;
+  if (!gestures.empty() && gestures.front().first <= now())
+  {
+    gesture = gestures.front().second;
+    gestures.pop_front();
+  }
+
+  // Interrupt line released when nothing else is pending
+  if (gestures.empty() || gestures.front().first > now())
+    setPin(GESTURE_PIN, HIGH);
+  return gesture;
+}
+
+void stop(const char *reason)
+{
+  if (!stopRequested)
+    stopReason = reason;
+  stopRequested = true;
+}
+
+bool stopped()
+{
+  return stopRequested;
+}
+
+}
+
+// -------------------------------------------------------
+// Main
+// -------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+  HostSim::Section harness;
+  SimHarness::SimOptions &o = SimHarness::options();
+  if (!parseArgs(argc, argv))
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  SimHarness::resizeHeap(o.heapSize);
+  randomSeed(o.seed);
+  if (!loadReplay(o.replayFile))
+    fprintf(stderr, "No replay data in %s, using constant readings\n", o.replayFile.c_str());
+  loadGestures(o.gesturesFile);
+  if (o.warmBoot)
+    loadRtcMemory();
+  SPIFFS.setRoot(o.spiffsDir);
+  HostSim::setPin(GESTURE_PIN, HIGH);
+  SimHarness::devicesBegin();
+
+  // Boot
+  uint64_t bootStart = HostSim::now();
+  {
+    HostSim::Section::Suspend firmware;
+    setup();
+  }
+  uint64_t bootTime = HostSim::now() - bootStart;
+  HostSim::HeapStats bootHeap = HostSim::heapStats();
+
+  if (!o.benchJpegFile.empty())
+    return benchJpeg(o.benchJpegFile);
+
+  // Main loop
+  LatencyStats active, all;
+  uint64_t loops = 0, idleLoops = 0;
+  uint64_t endAt = (uint64_t)(o.durationSec * 1e6);
+  uint64_t nextShot = o.screenshotEverySec > 0 ? (uint64_t)(o.screenshotEverySec * 1e6) : UINT64_MAX;
+  int shots = 0;
+  uint32_t minFreeBlock = UINT32_MAX;
+  uint8_t maxFragmentation = 0;
+
+  while (HostSim::now() < endAt && !HostSim::stopped())
+  {
+    SimHarness::poll();
+
+    uint32_t runsBefore = totalRuns();
+    uint64_t t0 = HostSim::now();
+    {
+      HostSim::Section::Suspend firmware;
+      loop();
+    }
+    uint32_t elapsed = HostSim::now() - t0;
+    loops++;
+    all.add(elapsed);
+
+    if (totalRuns() != runsBefore)
+    {
+      active.add(elapsed);
+      HostSim::HeapStats h = HostSim::heapStats();
+      minFreeBlock = std::min(minFreeBlock, h.maxFreeBlock);
+      maxFragmentation = std::max(maxFragmentation, HostSim::heapFragmentation());
+    }
+    else
+    {
+      // Nothing was due: skip ahead to the next event instead of spinning
+      idleLoops++;
+      uint32_t due;
+      uint64_t next = endAt;
+      if (sched.simNextDue(due))
+        next = std::min<uint64_t>(next, t0 + (uint32_t)(due - (uint32_t)(t0 / 1000)) * 1000ULL);
+      if (!gestures.empty())
+        next = std::min(next, gestures.front().first);
+      next = std::min(next, nextGeigerPulse());
+      next = std::min(next, SimHarness::devicesNextEvent());
+      next = std::min(next, SimHarness::networkNextEvent());
+      next = std::min(next, nextShot);
+      uint64_t t = HostSim::now();
+      if (next > t)
+        HostSim::busy(next - t);
+    }
+
+    if (HostSim::now() >= nextShot)
+    {
+      char tag[16];
+      snprintf(tag, sizeof(tag), "%05d", shots++);
+      screenshot(tag);
+      nextShot += (uint64_t)(o.screenshotEverySec * 1e6);
+    }
+  }
+  screenshot("final");
+  if (o.warmBoot)
+    saveRtcMemory();
+
+  // -------------------------------------------------------
+  // Report
+  // -------------------------------------------------------
+
+  double simSeconds = HostSim::now() / 1e6;
+  printf("\n=== ATMOSCAN host simulation: %.1f s simulated", simSeconds);
+  if (HostSim::stopped())
+    printf(" (stopped: %s)", stopReason.c_str());
+  printf(" ===\n\n");
+
+  printf("Boot (setup): %.3f s, heap free after boot %u bytes\n\n", bootTime / 1e6, bootHeap.total - bootHeap.used);
+
+  printf("loop(): %llu calls, %llu idle\n", (unsigned long long)loops, (unsigned long long)idleLoops);
+  printf("  with work   n=%-6u min %7u  avg %9.0f  p99 %9u  max %9u us\n",
+         (unsigned)active.samples.size(), active.minimum(), active.mean(), active.percentile(0.99), active.maximum());
+  printf("  all calls   n=%-6u min %7u  avg %9.0f  p99 %9u  max %9u us\n\n",
+         (unsigned)all.samples.size(), all.minimum(), all.mean(), all.percentile(0.99), all.maximum());
+
+  printf("%-36s %6s %10s %10s %10s %10s %6s\n", "Process", "runs", "total ms", "avg us", "max us", "host ms", "cpu%");
+  for (Process *p : sched.simProcesses())
+  {
+    const ProcessSimStats &s = p->simStats();
+    printf("%-36s %6u %10.1f %10.0f %10llu %10.2f %6.2f\n", p->simName(), s.runs, s.simMicros / 1e3,
+           s.runs ? (double)s.simMicros / s.runs : 0, (unsigned long long)s.simMicrosMax, s.hostNanos / 1e6,
+           simSeconds > 0 ? s.simMicros / 1e4 / simSeconds : 0);
+  }
+
+  HostSim::HeapStats h = HostSim::heapStats();
+  printf("\nHeap: %u total, %u free now, %u min free, %u max block now, %u min max block, "
+         "fragmentation %u%% now / %u%% max, %u allocations, %u failed\n",
+         h.total, h.total - h.used, h.minFree, h.maxFreeBlock, minFreeBlock == UINT32_MAX ? h.maxFreeBlock : minFreeBlock,
+         HostSim::heapFragmentation(), maxFragmentation, h.allocations, h.failures);
+
+  const TFTStats &tft = LCD.getStats();
+  printf("Display: %u windows, %llu pixels, %.1f ms SPI busy, backlight on %.1f%%\n", tft.windows,
+         (unsigned long long)tft.pixels, tft.busMicros / 1e3,
+         simSeconds > 0 ? (backlightOnTotal + (backlightOn ? HostSim::now() - backlightOnSince : 0)) / 1e4 / simSeconds : 0);
+
+  SimHarness::devicesReport(stdout);
+  SimHarness::networkReport(stdout);
+  printf("Geiger pulses: %u\n", geigerPulses);
+  printf("MQTT: %u connects, %u publishes\n", PubSubClient::simConnects, PubSubClient::simPublished);
+  printf("Syslog: %u messages\n", Syslog::simMessages);
+
+  printf("Error log (%u):\n", (unsigned)lastErrors.numElements());
+  for (size_t i = 0; i < lastErrors.numElements(); i++)
+    printf("  %s\n", lastErrors.peek(i)->c_str());
+  return 0;
+}
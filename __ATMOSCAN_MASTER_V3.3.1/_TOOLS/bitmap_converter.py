@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+#
+#  ATMOSCAN - bitmap converter
+#
+#  Author: Marc Finns 2017
+#
+#  Packs an RGB565 array generated by ImageConverter 565 into the palette + RLE
+#  format drawn by GfxUi::drawPackedBitmap():
+#
+#    width, height           uint16, little endian
+#    bits per pixel          1, 2, 4 or 8
+#    colours - 1             uint8
+#    palette                 colours x RGB565, little endian
+#    runs, in rows           n >= 128  next byte is the index of n - 127 pixels
+#                            n < 128   n + 1 indexes follow, packed MSB first
+#                                      at bits per pixel, padded to a byte
+#
+#  Images with more colours than the palette (at most 256) are reduced: the
+#  colours that cost least (pixels x distance) are merged into their nearest,
+#  the largest error is reported.
+#
+#  Usage:
+#    bitmap_converter.py HEADER ARRAY WIDTH HEIGHT [--colors N] [--replace]
+#
+#  Prints the packed array, or with --replace rewrites it in HEADER in place.
+#
+
+import argparse
+import math
+import re
+import sys
+
+RUN_MAX = 128
+LITERAL_MAX = 128
+
+
+def read_array(text, name):
+    match = re.search(r'const\s+unsigned\s+short\s+' + re.escape(name) + r'\s*\[\s*(\d*)\s*\]\s*PROGMEM\s*=\s*\{(.*?)\};',
+                      text, re.S)
+    if not match:
+        sys.exit('%s: no RGB565 array' % name)
+    body = re.sub(r'//[^\n]*', '', match.group(2))
+    return match, [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', body)]
+
+
+def rgb(color):
+    return ((color >> 11) << 3, ((color >> 5) & 0x3F) << 2, (color & 0x1F) << 3)
+
+
+def distance(a, b):
+    (r1, g1, b1), (r2, g2, b2) = rgb(a), rgb(b)
+    return 3 * (r1 - r2) ** 2 + 4 * (g1 - g2) ** 2 + 2 * (b1 - b2) ** 2
+
+
+def make_palette(pixels, max_colors):
+    counts = {}
+    for p in pixels:
+        counts[p] = counts.get(p, 0) + 1
+
+    # Merge the colour that costs least (pixels x error) into its nearest, until it fits
+    target = {c: c for c in counts}
+    kept = set(counts)
+
+    def nearest(c):
+        return min((k for k in kept if k != c), key=lambda k: distance(c, k))
+
+    neighbour = {c: nearest(c) for c in kept} if len(kept) > max_colors else {}
+    while len(kept) > max_colors:
+        c = min(kept, key=lambda k: counts[k] * distance(k, neighbour[k]))
+        into = neighbour[c]
+        kept.remove(c)
+        counts[into] += counts[c]
+        for k in target:
+            if target[k] == c:
+                target[k] = into
+        for k in kept:
+            if neighbour[k] == c:
+                neighbour[k] = nearest(k)
+
+    palette = sorted(kept, key=lambda c: -counts[c])
+    position = {c: i for i, c in enumerate(palette)}
+    index = {c: position[target[c]] for c in target}
+    error = max(distance(c, target[c]) for c in target)
+    return palette, index, error
+
+
+def encode(indexes, bits):
+    # Shorter runs are cheaper as literals
+    min_run = max(2, 16 // bits + 1)
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:LITERAL_MAX]
+            del literal[:LITERAL_MAX]
+            out.append(len(chunk) - 1)
+            acc = used = 0
+            for i in chunk:
+                acc = (acc << bits) | i
+                used += bits
+                if used == 8:
+                    out.append(acc)
+                    acc = used = 0
+            if used:
+                out.append(acc << (8 - used))
+
+    i = 0
+    while i < len(indexes):
+        run = 1
+        while i + run < len(indexes) and run < RUN_MAX and indexes[i + run] == indexes[i]:
+            run += 1
+        if run >= min_run:
+            flush()
+            out.append(127 + run)
+            out.append(indexes[i])
+        else:
+            literal.extend(indexes[i:i + run])
+        i += run
+    flush()
+    return out
+
+
+def decode(data, count):
+    width, height, bits, colors = data[0] | data[1] << 8, data[2] | data[3] << 8, data[4], data[5] + 1
+    palette = [data[6 + 2 * i] | data[7 + 2 * i] << 8 for i in range(colors)]
+    pos = 6 + 2 * colors
+    pixels = []
+    while len(pixels) < count:
+        code = data[pos]
+        pos += 1
+        if code >= 128:
+            pixels += [palette[data[pos]]] * (code - 127)
+            pos += 1
+        else:
+            acc = available = 0
+            for _ in range(code + 1):
+                if available == 0:
+                    acc, available = data[pos], 8
+                    pos += 1
+                available -= bits
+                pixels.append(palette[(acc >> available) & ((1 << bits) - 1)])
+    return pixels[:count]
+
+
+def pack(pixels, width, height, max_colors):
+    palette, index, error = make_palette(pixels, max_colors)
+    bits = next(b for b in (1, 2, 4, 8) if len(palette) <= 1 << b)
+
+    data = bytearray([width & 0xFF, width >> 8, height & 0xFF, height >> 8, bits, len(palette) - 1])
+    for c in palette:
+        data += bytes([c & 0xFF, c >> 8])
+    data += encode([index[p] for p in pixels], bits)
+
+    expected = [palette[index[p]] for p in pixels]
+    if decode(data, len(pixels)) != expected:
+        sys.exit('internal error: packed image does not decode back')
+    return data, bits, len(palette), error
+
+
+def declaration(name, data, width, height, bits, colors, original):
+    lines = ['// Packed by      : _TOOLS/bitmap_converter.py (palette + RLE, see GfxUi::drawPackedBitmap)',
+             '// Packed size    : %dx%d pixels, %d bits per pixel, %d colours, %d bytes (was %d)'
+             % (width, height, bits, colors, len(data), original),
+             '',
+             'const uint8_t %s[%d] PROGMEM = {' % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append('  ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Packs an ImageConverter 565 array as palette + RLE')
+    parser.add_argument('header')
+    parser.add_argument('array')
+    parser.add_argument('width', type=int)
+    parser.add_argument('height', type=int)
+    parser.add_argument('--colors', type=int, default=256, help='palette size limit (2..256)')
+    parser.add_argument('--replace', action='store_true', help='rewrite the array in the header')
+    args = parser.parse_args()
+
+    text = open(args.header).read()
+    match, pixels = read_array(text, args.array)
+
+    # Arrays shorter than declared are zero filled by the compiler
+    count = args.width * args.height
+    if len(pixels) > count:
+        sys.exit('%s: %d pixels, more than %dx%d' % (args.array, len(pixels), args.width, args.height))
+    pixels += [0] * (count - len(pixels))
+
+    data, bits, colors, error = pack(pixels, args.width, args.height, max(2, min(args.colors, 256)))
+    result = declaration(args.array, data, args.width, args.height, bits, colors, count * 2)
+
+    # Error as a per channel difference, in 8 bit levels
+    sys.stderr.write('%s: %d -> %d bytes, %d bits per pixel, %d colours, largest colour error %d\n'
+                     % (args.array, count * 2, len(data), bits, colors, round(math.sqrt(error / 9))))
+
+    if args.replace:
+        open(args.header, 'w').write(text[:match.start()] + result + text[match.end():])
+    else:
+        print(result)
+
+
+if __name__ == '__main__':
+    main()
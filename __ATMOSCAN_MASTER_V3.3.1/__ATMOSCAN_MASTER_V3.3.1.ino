@@ -49,24 +49,26 @@
 #define FS_NO_GLOBALS
 #include <FS.h>                   //this needs to be first
 #include <ArduinoOTA.h>
-#include <ESP8266WiFi.h>
+#include <ESP8266WiFi.h>          // NOTE: Requires the ESP8266 core 2.5.0 or later (ESP.getMaxFreeBlockSize, ESP.getHeapFragmentation)
 #include <WiFiClient.h>
 #include <DNSServer.h>
 #include <SPI.h>
 #include <Wire.h>
 
 #include <Syslog.h>               // https://github.com/arcao/ESP8266_Syslog
-#include <Average.h>              // https://github.com/MajenkoLibraries/Average
-#include <PubSubClient.h>         // https://github.com/knolleary/pubsubclient
+#include <PubSubClient.h>         // https://github.com/knolleary/pubsubclient             NOTE: Requires 2.8+ (setSocketTimeout/setKeepAlive) and MQTT_MAX_PACKET_SIZE 256 (PubSubClient.h or build flags)
 #include <ProcessScheduler.h>     // https://github.com/wizard97/ArduinoProcessScheduler  NOTE: Requires https://github.com/wizard97/ArduinoRingBuffer
 #include <NtpClientLib.h>         // https://github.com/gmag11/NtpClient                  NOTE: Requires https://github.com/PaulStoffregen/Time
 #include <ArduinoJson.h>          // https://github.com/bblanchon/ArduinoJson
-#include <TFT_eSPI.h>             // https://github.com/Bodmer/TFT_eSPI
+#include <TFT_eSPI.h>             // https://github.com/Bodmer/TFT_eSPI                    NOTE: Requires 2.3 or later (4 bit sprites, windowed pushSprite)
 
 // Project includes
 #include "GlobalDefinitions.h"
 #include "ScreenFactory.h"
 #include "TimeSpace.h"
+#include "ProcessProfiler.h"
+#include "MemoryMonitor.h"
+#include "History.h"
 
 // Screens
 #include "ScreenSensors.h"
@@ -77,6 +79,7 @@
 #include "ScreenWeatherStation.h"
 #include "ScreenErrLog.h"
 #include "ScreenBuienRadar.h"
+#include "ScreenHistory.h"
 
 // Graphics & fonts
 #include "GlobalBitmaps.h"
@@ -104,8 +107,6 @@ TFT_eSPI LCD = TFT_eSPI();
 // Global UI management
 GfxUi ui(&LCD);
 
-WiFiClient wifiClient;
-
 // UDP instance to send and receive packets over UDP
 WiFiUDP udpClient;
 
@@ -124,16 +125,29 @@ ScreenCreatorImpl<ScreenGeiger> creator4;
 ScreenCreatorImpl<ScreenPlaneSpotter> creator5;
 ScreenCreatorImpl<ScreenWeatherStation> creator6;
 ScreenCreatorImpl<ScreenBuienRadar> creator7;
+ScreenCreatorImpl<ScreenHistory> creator8;
 
 // Global Scheduler object
 Scheduler sched;
 
+// Process execution profiler
+ProcessProfiler profiler;
+
+// Heap usage and fragmentation
+MemoryMonitor memoryMonitor;
+
+// Sensor history (minutes, quarters, hours)
+History history;
+
 // Last errors list
 RingBufCPP<String, 18> lastErrors;
 
 // Configuration container structure
 Configuration config;
 
+// WiFi connection times
+WifiStats wifiStats;
+
 //  Processes container structure
 ProcessContainer procPtr =
 {
@@ -185,6 +199,21 @@ ProcessContainer procPtr =
   Proc_GeoLocation(sched,
   MEDIUM_PRIORITY,
   GEOLOC_RETRY_PERIOD,
+  RUNTIME_FOREVER),
+
+  Proc_Boot(sched,
+  HIGH_PRIORITY,
+  BOOT_STEP_PERIOD,
+  RUNTIME_FOREVER),
+
+  Proc_PowerManager(sched,
+  LOW_PRIORITY,
+  POWER_CHECK_PERIOD,
+  RUNTIME_FOREVER),
+
+  Proc_HistoryStore(sched,
+  LOW_PRIORITY,
+  HISTORY_CHECK_PERIOD,
   RUNTIME_FOREVER)
 
 };
@@ -196,14 +225,17 @@ void setup()
   Serial.begin(115200);
 #endif
 
-  // Wait for electronics to settle
-  delay(3000);
+  // No waiting for the electronics to settle: sensors are tested by their processes, with retries
 
   // Dynamically create systemID based on MAC address
   systemID = F("ATMOSCAN-");
   systemID += WiFi.macAddress();
   systemID.replace(F(":"), F(""));
 
+  // Network association takes seconds: started first, completes while the rest boots
+  initNTP();
+  wifiBegin();
+
   // Initiatlise the LCD
   LCD.begin();
   LCD.setRotation(2);
@@ -219,7 +251,7 @@ void setup()
   LCD.setTextDatum(BR_DATUM);
 
   // **********************  Draw splash screen
-  ui.drawBitmap(Splash_Screen, (LCD.width() - splashWidth) / 2, 20, splashWidth, splashHeight);
+  ui.drawPackedBitmap(Splash_Screen, (LCD.width() - splashWidth) / 2, 20);
 
   LCD.drawString(F(ATMOSCAN_VERSION), xpos, ypos, GFXFF);
 
@@ -290,83 +322,22 @@ void setup()
   // Initialise I2C bus
   Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN);
 
-  // Add process objects to scheduler
-  addProcesses();
-
-  // Turn on LCD and wait a bit on splash screen...
+  // Turn on LCD on the splash screen, boot phases are timed below it
   procPtr.UIManager.displayOn();
-  delay (1000);
+  procPtr.Boot.mark(BOOT_DISPLAY);
 
-  // **********************  Initialization with progress bar...
-  LCD.setFreeFont(FSS9);
-  LCD.setTextDatum(TL_DATUM);
-  LCD.setTextColor(TFT_YELLOW, TFT_BLACK);
-  xpos = 6;
-  ypos = 195;
-
-  // Retrieve dynamic config parameters from SPIFSS (such as MQTT Topics and servers)
-
-  // Draw progress bar...
-  ui.drawProgressBar(10, 175, 240 - 20, 15, 0, TFT_YELLOW, TFT_BLUE);
-
-  // Show init step...
-  LCD.drawString(F("Retrieving configuration...       "), xpos, ypos, GFXFF);
-  ui.drawProgressBar(10, 175, 240 - 20, 15, 30, TFT_YELLOW, TFT_BLUE);
-
-  delay(500);
-
-  // Retrieve configuration from SPIFFS, if existent
+  // Retrieve configuration from SPIFFS, if existent (dynamic parameters such as MQTT Topics and servers)
   if (retrieveConfig())
   {
     config.configValid = true;
+    procPtr.Boot.mark(BOOT_CONFIG);
 
-    // Show init step...
-    LCD.drawString(F("Connecting to network...    "), xpos, ypos, GFXFF);
-    ui.drawProgressBar(10, 175, 240 - 20, 15, 60, TFT_YELLOW, TFT_BLUE);
-
-    delay(500);
-
-    // Handle Wifi connection, including dynamic config parameters such as MQTT Topic and server
-    config.connected = wifiConnect();
-
-    // Initialize NTP library
-    initNTP();
-
-    //  Configure syslog instance
+    //  Configure syslog instance (messages go out once connected)
     syslog.server(config.syslog_server, SYSLOG_PORT);
     syslog.deviceHostname(systemID.c_str());
     syslog.appName(APP_NAME);
     syslog.defaultPriority(LOG_KERN);
 
-    // Start logging
-    delay(200);
-    String strBuffer = F("******* BOOTING FIRMWARE ") ;
-    syslog.log(LOG_INFO, strBuffer + F(ATMOSCAN_VERSION) + F(", BUILT ") + String(__DATE__ " " __TIME__) + F(" ******* "));
-
-    // Log current configuration
-    strBuffer = F("Connected to network ");
-    syslog.log(LOG_INFO, strBuffer + WiFi.SSID() + F(" with address ") + WiFi.localIP().toString());
-
-    // Scan I2C bus and log devices found
-#ifdef DEBUG_SYSLOG
-    delay(1000); // Syslog does not like too many messages at a time...
-    i2cScan();
-#endif
-
-    // Log current AtmoScan configuration
-#ifdef DEBUG_SYSLOG
-    delay(1000); // Syslog does not like too many messages at a time...
-    syslog.log(LOG_DEBUG, F("Configuration is:"));
-    syslog.log(LOG_DEBUG, config.mqtt_server);
-    syslog.log(LOG_DEBUG, config.mqtt_topic1);
-    syslog.log(LOG_DEBUG, config.mqtt_topic2);
-    syslog.log(LOG_DEBUG, config.syslog_server);
-    syslog.log(LOG_DEBUG, config.google_key);
-    syslog.log(LOG_DEBUG, config.wunderground_key);
-    syslog.log(LOG_DEBUG, config.geonames_user);
-    syslog.log(LOG_DEBUG, config.timezonedb_key);
-#endif
-
 #ifdef DEBUG_SERIAL
     Serial.println(F("Configuration is:"));
     Serial.println(config.mqtt_server);
@@ -378,14 +349,6 @@ void setup()
     Serial.println(config.geonames_user);
     Serial.println(config.timezonedb_key);
 
-#endif
-
-    // Log ESP configuration
-#ifdef DEBUG_SYSLOG
-    logESPconfig();
-
-    // log SPIFFS usage
-    listFiles();
 #endif
   }
   else
@@ -398,18 +361,13 @@ void setup()
   // Initialise OTA
   initOTA();
 
-  // Show init step...
-  LCD.drawString(F("Starting processes...         "), xpos, ypos, GFXFF);
-  ui.drawProgressBar(10, 175, 240 - 20, 15, 100, TFT_YELLOW, TFT_BLUE);
+  // Restore sensor history saved before last reboot
+  history.begin();
 
-  // Start processes
+  // Add process objects to scheduler and start them: the boot process completes the boot
+  addProcesses();
   startProcesses();
-
-  // Wait a bit (optical)
-  delay(500);
-
-  // Configuration completed!
-  syslog.log(LOG_INFO, F("************ BOOT SEQUENCE COMPLETE *************"));
+  procPtr.Boot.mark(BOOT_SCHEDULER);
 
   ESP.wdtEnable(0);
 }
@@ -541,6 +499,10 @@ void onSTADisconnected(WiFiEventStationModeDisconnected event_info)
   Serial.println("WiFi disconnected");
 #endif
 
+  // Reconnection timed from the first disconnection
+  if (config.connected)
+    wifiStats.connectStart = millis();
+
   config.connected = false;
 }
 
@@ -552,8 +514,43 @@ void onSTAGotIP(WiFiEventStationModeGotIP ipInfo)
   Serial.println("WiFi Connected");
 #endif
 
+  // Already connected: DHCP restarted on a reused address is done, same connection with a renewed lease
+  if (config.connected)
+  {
+    wifiStats.leaseValid = true;
+    wifiStats.leaseTime = millis();
+    wifiSaveCache(ipInfo);
+    return;
+  }
+
   // Remember current connection status in configuration
   config.connected =  true;
+
+  // Connect time
+  wifiStats.connects++;
+  wifiStats.lastConnectTime = millis() - wifiStats.connectStart;
+  wifiStats.lastFastPath = wifiStats.fastPath;
+  wifiStats.fastPath = false;
+
+  // Reused address: usable right away, DHCP renews its lease in the background (the radio may stay up for long)
+  if (wifiStats.staticLease)
+  {
+    wifiStats.staticLease = false;
+    WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+  }
+
+  // Fresh lease
+  else
+  {
+    wifiStats.leaseValid = true;
+    wifiStats.leaseTime = millis();
+  }
+
+  // Next restart goes straight to this access point
+  wifiSaveCache(ipInfo);
+
+  // Boot phase (the first connection only)
+  procPtr.Boot.mark(BOOT_NETWORK);
 }
 
 
@@ -565,6 +562,10 @@ void initNTP()
   // NTP start
   NTP.onNTPSyncEvent([](NTPSyncEvent_t error)
   {
+    // Radio off between MQTT bursts, NTP retries later
+    if (error && procPtr.PowerManager.isRadioOff())
+      return;
+
     if (error)
     {
       if (error == noResponse)
@@ -587,6 +588,21 @@ void initNTP()
   e2 = WiFi.onStationModeDisconnected(onSTADisconnected);
 }
 
+// Offset of the local time (timezone and summer time, as applied by NTP), seconds
+int32_t utcOffset()
+{
+  return NTP.getTimeZone() * 3600 + (NTP.isSummerTime() ? 3600 : 0);
+}
+
+// UTC time, 0 if the clock was never set
+time_t utcNow()
+{
+  if (timeStatus() == timeNotSet)
+    return 0;
+
+  return now() - utcOffset();
+}
+
 // Add processes to scheduler
 void addProcesses()
 {
@@ -600,10 +616,29 @@ void addProcesses()
   procPtr.MultiGasSensor.add();
   procPtr.GeigerSensor.add();
   procPtr.MQTTUpdate.add();
+  procPtr.HistoryStore.add();
 #endif
 
-  procPtr.UIManager.add();
   procPtr.GeoLocation.add();
+  procPtr.Boot.add();
+
+  // NOTE: enabled by the UI manager, while the display is off
+  procPtr.PowerManager.add();
+
+  // NOTE: the UI manager is added by the boot process, its first screen replaces the splash screen
+
+  // Register processes with the profiler
+  profiler.add(procPtr.ComboTemperatureHumiditySensor, F("Temp"));
+  profiler.add(procPtr.ComboPressureHumiditySensor, F("Press"));
+  profiler.add(procPtr.CO2Sensor, F("CO2"));
+  profiler.add(procPtr.ParticleSensor, F("PM"));
+  profiler.add(procPtr.VOCSensor, F("VOC"));
+  profiler.add(procPtr.MultiGasSensor, F("Gas"));
+  profiler.add(procPtr.GeigerSensor, F("Geiger"));
+  profiler.add(procPtr.UIManager, F("UI"));
+  profiler.add(procPtr.MQTTUpdate, F("MQTT"));
+  profiler.add(procPtr.GeoLocation, F("GeoLoc"));
+  profiler.add(procPtr.HistoryStore, F("HistStore"));
 }
 
 // Enable Process scheduling
@@ -621,6 +656,7 @@ void startProcesses()
     procPtr.MultiGasSensor.enable();
     procPtr.GeigerSensor.enable();
     procPtr.MQTTUpdate.enable();
+    procPtr.HistoryStore.enable();
 #endif
     procPtr.GeoLocation.enable();
   }
@@ -631,8 +667,7 @@ void startProcesses()
 #endif
   }
 
-  procPtr.UIManager.enable();
-
+  procPtr.Boot.enable();
 }
 
 // Retrieve previously saved configuration from SPIFFS
@@ -678,6 +713,8 @@ bool retrieveConfig()
           strcpy(config.mqtt_topic1, json[F("mqtt_topic1")]);
           strcpy(config.mqtt_topic2, json[F("mqtt_topic2")]);
           strcpy(config.mqtt_topic3, json[F("mqtt_topic3")]);
+          if (json.containsKey(F("mqtt_systopic")))
+            strcpy(config.mqtt_systopic, json[F("mqtt_systopic")]);
           strcpy(config.syslog_server, json[F("syslog_server")]);
           strcpy(config.google_key, json[F("google_key")]);
           strcpy(config.wunderground_key, json[F("wunderground_key")]);
@@ -698,6 +735,9 @@ bool retrieveConfig()
           return false;
         }
       }
+
+      // Configuration file could not be opened
+      return false;
     }
     else
     {
@@ -720,60 +760,165 @@ bool retrieveConfig()
 }
 
 
-// Connect to WiFi
-bool wifiConnect()
+// Start connecting to WiFi, the boot process waits for the connection
+void wifiBegin()
 {
-  // Connect using last good credentials
-  WiFi.mode(WIFI_STA);
-  WiFi.begin();
+  WifiRtcCache cache;
 
   // Set hostname
+  WiFi.mode(WIFI_STA);
   WiFi.hostname(systemID);
 
-  // Wait for connection...
-  int counter = 0;
-  while (WiFi.status() != WL_CONNECTED && counter++ < 30)
+  wifiStats.connectStart = millis();
+
+  // After a restart (or radio sleep): straight to the last access point, no scan
+  if (ESP.rtcUserMemoryRead(WIFI_RTC_OFFSET, (uint32_t *)&cache, sizeof(cache)) && cache.magic == WIFI_RTC_MAGIC)
   {
-    delay(500);
+    // Last address, if still within its lease (DHCP otherwise, which also renews it)
+    wifiStats.staticLease = wifiStats.leaseValid && millis() - wifiStats.leaseTime < WIFI_LEASE_REUSE_PERIOD;
+#ifdef WIFI_REUSE_LEASE
+    wifiStats.staticLease = true;
+#endif
+
+    if (wifiStats.staticLease)
+      WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+    else
+      WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+
+    // Not saved to flash, so the stored credentials keep working with any access point
+    String ssid = WiFi.SSID();
+    String psk = WiFi.psk();
+    WiFi.persistent(false);
+    WiFi.begin(ssid.c_str(), psk.c_str(), cache.channel, cache.bssid);
+    WiFi.persistent(true);
+
+    wifiStats.fastPath = true;
+    return;
   }
-  if (WiFi.status() == WL_CONNECTED )
+
+  // Connect using last good credentials
+  wifiStats.staticLease = false;
+  WiFi.begin();
+}
+
+// The cached access point did not answer (moved, or gone): forget it, full scan and DHCP
+void wifiRescan()
+{
+  wifiClearCache();
+  wifiStats.fastPath = false;
+  wifiStats.staticLease = false;
+
+  // NOTE: disconnecting clears the credentials, unless not persistent
+  String ssid = WiFi.SSID();
+  String psk = WiFi.psk();
+  WiFi.persistent(false);
+  WiFi.disconnect();
+  WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+  WiFi.begin(ssid.c_str(), psk.c_str());
+  WiFi.persistent(true);
+}
+
+// Falls back to a full scan when the cached access point does not answer
+void wifiCheckFastPath()
+{
+  if (wifiStats.fastPath && millis() - wifiStats.connectStart >= WIFI_FAST_CONNECT_TIMEOUT)
   {
-    return true;
-  }
-  else
-  {
-    return false;
+    syslog.log(LOG_INFO, F("Fast reconnect failed, scanning"));
+    wifiRescan();
   }
 }
 
+// Keeps the access point and address of the connection in RTC memory
+void wifiSaveCache(const WiFiEventStationModeGotIP &ipInfo)
+{
+  WifiRtcCache cache;
+
+  memset(&cache, 0, sizeof(cache));
+  cache.magic = WIFI_RTC_MAGIC;
+  memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+  cache.channel = WiFi.channel();
+  cache.ip = ipInfo.ip;
+  cache.gateway = ipInfo.gw;
+  cache.subnet = ipInfo.mask;
+  cache.dns = WiFi.dnsIP();
+
+  ESP.rtcUserMemoryWrite(WIFI_RTC_OFFSET, (uint32_t *)&cache, sizeof(cache));
+}
 
-#ifdef DEBUG_SYSLOG
-void logESPconfig()
+void wifiClearCache()
 {
+  WifiRtcCache cache;
 
-  syslog.log(LOG_DEBUG, F("FLASH CONFIGURATION LOG"));
-  // Log ESP configuration
+  memset(&cache, 0, sizeof(cache));
+  ESP.rtcUserMemoryWrite(WIFI_RTC_OFFSET, (uint32_t *)&cache, sizeof(cache));
+}
+
+
+#ifdef DEBUG_SYSLOG
+// Boot details, a step at a time as syslog does not like too many messages at a time (false when over)
+bool logBootDetails(int step)
+{
   uint32_t realSize = ESP.getFlashChipRealSize();
   uint32_t ideSize = ESP.getFlashChipSize();
   FlashMode_t ideMode = ESP.getFlashChipMode();
-  delay(1000);
-  syslog.logf(LOG_DEBUG, "Flash real id:   %08X\n", ESP.getFlashChipId());
-  delay(1000);
-  syslog.logf(LOG_DEBUG, "Flash real size: %u\n\n", realSize);
-  delay(1000);
-  syslog.logf(LOG_DEBUG, "Flash ide  size: %u\n", ideSize);
-  delay(1000);
-  syslog.logf(LOG_DEBUG, "Flash ide speed: %u\n", ESP.getFlashChipSpeed());
-  delay(1000);
-  syslog.logf(LOG_DEBUG, "Flash ide mode:  %s\n", (ideMode == FM_QIO ? "QIO" : ideMode == FM_QOUT ? "QOUT" : ideMode == FM_DIO ? "DIO" : ideMode == FM_DOUT ? "DOUT" : "UNKNOWN"));
-  delay(1000);
-  if (ideSize != realSize)
-  {
-    errLog( F("Flash Chip configuration wrong!"));
-  }
-  else
+
+  switch (step)
   {
-    syslog.log(LOG_DEBUG, F("Flash Chip configuration ok."));
+    // Scan I2C bus and log devices found
+    case 0:
+      i2cScan();
+      return true;
+
+    // Log current AtmoScan configuration
+    case 1:
+      syslog.log(LOG_DEBUG, F("Configuration is:"));
+      syslog.log(LOG_DEBUG, config.mqtt_server);
+      syslog.log(LOG_DEBUG, config.mqtt_topic1);
+      syslog.log(LOG_DEBUG, config.mqtt_topic2);
+      syslog.log(LOG_DEBUG, config.syslog_server);
+      syslog.log(LOG_DEBUG, config.google_key);
+      syslog.log(LOG_DEBUG, config.wunderground_key);
+      syslog.log(LOG_DEBUG, config.geonames_user);
+      syslog.log(LOG_DEBUG, config.timezonedb_key);
+      return true;
+
+    // Log ESP configuration
+    case 2:
+      syslog.log(LOG_DEBUG, F("FLASH CONFIGURATION LOG"));
+      syslog.logf(LOG_DEBUG, "Flash real id:   %08X\n", ESP.getFlashChipId());
+      return true;
+
+    case 3:
+      syslog.logf(LOG_DEBUG, "Flash real size: %u\n\n", realSize);
+      return true;
+
+    case 4:
+      syslog.logf(LOG_DEBUG, "Flash ide  size: %u\n", ideSize);
+      return true;
+
+    case 5:
+      syslog.logf(LOG_DEBUG, "Flash ide speed: %u\n", ESP.getFlashChipSpeed());
+      return true;
+
+    case 6:
+      syslog.logf(LOG_DEBUG, "Flash ide mode:  %s\n", (ideMode == FM_QIO ? "QIO" : ideMode == FM_QOUT ? "QOUT" : ideMode == FM_DIO ? "DIO" : ideMode == FM_DOUT ? "DOUT" : "UNKNOWN"));
+      return true;
+
+    case 7:
+      if (ideSize != realSize)
+      {
+        errLog( F("Flash Chip configuration wrong!"));
+      }
+      else
+      {
+        syslog.log(LOG_DEBUG, F("Flash Chip configuration ok."));
+      }
+      return true;
+
+    // log SPIFFS usage
+    default:
+      listFiles();
+      return false;
   }
 }
 #endif